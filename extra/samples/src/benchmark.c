@@ -23,6 +23,8 @@
 ***     ./benchmark SHA-256
 ***     ./benchmark AES/CTR
 ***     ./benchmark AES
+***     ./benchmark Threefish-512/CTR Skein-512
+***     ./benchmark BLAKE2b BLAKE2bp
 **/
 /*===----------------------------------------------------------------------===*/
 
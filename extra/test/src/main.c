@@ -48,22 +48,41 @@ extern int test_inc_buffer(void);
 extern int test_vectors_md5(void);
 extern int test_vectors_sha1(void);
 extern int test_vectors_sha256(void);
+extern int test_vectors_sha512(void);
+extern int test_vectors_blake2(void);
+extern int test_vectors_blake3(void);
+extern int test_vectors_sha3(void);
 extern int test_vectors_skein256(void);
+extern int test_vectors_skein256_tree(void);
+extern int test_vectors_skein512(void);
 extern int test_vectors_hmac(void);
 extern int test_vectors_hkdf(void);
 extern int test_vectors_pbkdf2(void);
+extern int test_vectors_scrypt(void);
+extern int test_vectors_argon2(void);
 extern int test_vectors_rc4(void);
 extern int test_vectors_aes(void);
 extern int test_vectors_threefish256(void);
+extern int test_vectors_threefish512(void);
 extern int test_vectors_ecb(void);
 extern int test_vectors_cbc(void);
 extern int test_vectors_ctr(void);
 extern int test_vectors_cfb(void);
 extern int test_vectors_ofb(void);
+extern int test_vectors_ctr_drbg(void);
+extern int test_vectors_threefry(void);
 extern int test_vectors_curve25519(void);
+extern int test_vectors_ed25519(void);
 
 extern int test_pbkdf2_precond(void);
+extern int test_pbkdf2_batch_precond(void);
 extern int test_hkdf_precond(void);
+extern int test_scrypt_precond(void);
+extern int test_argon2_precond(void);
+extern int test_ctr_drbg_precond(void);
+extern int test_threefry_precond(void);
+extern int test_curve25519_precond(void);
+extern int test_ed25519_precond(void);
 
 extern int test_ordo_digest(void);
 extern int test_ordo_hmac(void);
@@ -86,21 +105,40 @@ static const struct TEST tests[] =
     { test_vectors_md5,                  "MD5 test vectors"                 },
     { test_vectors_sha1,                 "SHA-1 test vectors"               },
     { test_vectors_sha256,               "SHA-256 test vectors"             },
+    { test_vectors_sha512,               "SHA-512 test vectors"             },
+    { test_vectors_blake2,               "BLAKE2 test vectors"              },
+    { test_vectors_blake3,               "BLAKE3 test vectors"              },
+    { test_vectors_sha3,                 "SHA-3 test vectors"               },
     { test_vectors_skein256,             "Skein-256 test vectors"           },
+    { test_vectors_skein256_tree,        "Skein-256 tree test vectors"      },
+    { test_vectors_skein512,             "Skein-512 test vectors"           },
     { test_vectors_hmac,                 "HMAC test vectors"                },
     { test_vectors_hkdf,                 "HKDF test vectors"                },
     { test_vectors_pbkdf2,               "PBKDF2 test vectors"              },
+    { test_vectors_scrypt,               "scrypt test vectors"              },
+    { test_vectors_argon2,               "Argon2 test vectors"              },
     { test_vectors_rc4,                  "RC4 test vectors"                 },
     { test_vectors_aes,                  "AES test vectors"                 },
     { test_vectors_threefish256,         "Threefish-256 test vectors"       },
+    { test_vectors_threefish512,         "Threefish-512 test vectors"       },
     { test_vectors_ecb,                  "ECB test vectors"                 },
     { test_vectors_cbc,                  "CBC test vectors"                 },
     { test_vectors_ctr,                  "CTR test vectors"                 },
     { test_vectors_cfb,                  "CFB test vectors"                 },
     { test_vectors_ofb,                  "OFB test vectors"                 },
-  /*{ test_vectors_curve25519,           "Curve25519 test vectors"          },*/
+    { test_vectors_ctr_drbg,             "CTR_DRBG test vectors"            },
+    { test_vectors_threefry,             "Threefry test vectors"            },
+    { test_vectors_curve25519,           "Curve25519 test vectors"          },
+    { test_vectors_ed25519,              "Ed25519 test vectors"             },
     { test_pbkdf2_precond,               "PBKDF2 unit tests"                },
+    { test_pbkdf2_batch_precond,         "PBKDF2 batch unit tests"          },
     { test_hkdf_precond,                 "HKDF unit tests"                  },
+    { test_scrypt_precond,               "scrypt unit tests"                },
+    { test_argon2_precond,               "Argon2 unit tests"                },
+    { test_ctr_drbg_precond,             "CTR_DRBG unit tests"              },
+    { test_threefry_precond,             "Threefry unit tests"              },
+    { test_curve25519_precond,           "Curve25519 unit tests"            },
+    { test_ed25519_precond,              "Ed25519 unit tests"               },
     { test_ctcmp,                        "Constant-time comparison tests"   },
     { test_ordo_digest,                  "Ordo API tests (digest)"          },
     { test_ordo_hmac,                    "Ordo API tests (hmac)"            },
@@ -0,0 +1,144 @@
+/*===-- test_vectors/argon2.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the Argon2 module, the first three from RFC 9106.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_BLAKE2B
+
+struct TEST_VECTOR
+{
+    int type;
+    uint32_t passes, memory, lanes;
+    const char *pwd;
+    size_t pwd_len;
+    const char *salt;
+    size_t salt_len;
+    const char *secret;
+    size_t secret_len;
+    const char *ad;
+    size_t ad_len;
+    const char *out;
+    size_t out_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    ARGON2_ID, 3, 32, 4,
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01"
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01", 32,
+    "\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02", 16,
+    "\x03\x03\x03\x03\x03\x03\x03\x03", 8,
+    "\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04", 12,
+    "\x0d\x64\x0d\xf5\x8d\x78\x76\x6c\x08\xc0\x37\xa3\x4a\x8b\x53\xc9"
+    "\xd0\x1e\xf0\x45\x2d\x75\xb6\x5e\xb5\x25\x20\xe9\x6b\x01\xe6\x59", 32
+},
+{
+    ARGON2_D, 3, 32, 4,
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01"
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01", 32,
+    "\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02", 16,
+    "\x03\x03\x03\x03\x03\x03\x03\x03", 8,
+    "\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04", 12,
+    "\x51\x2b\x39\x1b\x6f\x11\x62\x97\x53\x71\xd3\x09\x19\x73\x42\x94"
+    "\xf8\x68\xe3\xbe\x39\x84\xf3\xc1\xa1\x3a\x4d\xb9\xfa\xbe\x4a\xcb", 32
+},
+{
+    ARGON2_I, 3, 32, 4,
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01"
+    "\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01\x01", 32,
+    "\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02\x02", 16,
+    "\x03\x03\x03\x03\x03\x03\x03\x03", 8,
+    "\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04\x04", 12,
+    "\xc8\x14\xd9\xd1\xdc\x7f\x37\xaa\x13\xf0\xd7\x7f\x24\x94\xbd\xa1"
+    "\xc8\xde\x6b\x01\x6d\xd3\x88\xd2\x99\x52\xa4\xc4\x67\x2b\x6c\xe8", 32
+},
+{
+    ARGON2_ID, 2, 2048, 2,
+    "\x70\x61\x73\x73\x77\x6f\x72\x64", 8,
+    "\x73\x6f\x6d\x65\x73\x61\x6c\x74", 8,
+    "", 0,
+    "", 0,
+    "\x79\x17\x79\x18\x46\xab\x25\x5d\x61\x55\x2e\x64\x8a\x2e\x13\xb8"
+    "\xb1\xee\x12\xa8\x5e\xf6\x1b\xc8\x5d\x47\xb9\x3e\x6a\x24\xda\xd5", 32
+},
+{
+    ARGON2_I, 2, 1024, 1,
+    "\x70\x61\x73\x73\x77\x6f\x72\x64", 8,
+    "\x73\x6f\x6d\x65\x73\x61\x6c\x74", 8,
+    "", 0,
+    "", 0,
+    "\x93\xbc\x9a\x60\x9b\xba\x5f\x69\xa9\xb2\x4f\xa8\x74\xcf\xa0\x4f"
+    "\x43\xe7\xbb\xb6\x71\x96\x12\xc5\x9e\xe9\x07\x41\x3c\x4e\xb9\x2d"
+    "\x22\x1c\xfb\xe6\x43\x96\x30\xaf\xdb\x93\xe4\x44\x5b\x38\xdb\xa7"
+    "\xa8\xd2\x0b\x14\x6e\x7a\x69\x64\x1b\xb0\x2c\xa0\xb5\xfa\x4b\x07"
+    "\x77\x99\xcb\x3c\xbf\x71\xe8\xc9\x15\xc3\xe0\x4e\x21\x05\x17\xd6"
+    "\x39\x48\x89\x57\xdf\x63\x12\x36\x31\x69\x2a\xa2\xac\x8a\x8d\xec"
+    "\x67\x7a\xe1\xcb", 100
+},
+{
+    ARGON2_D, 1, 64, 3,
+    "", 0,
+    "\x73\x61\x6c\x74\x73\x61\x6c\x74", 8,
+    "\x6b\x65\x79", 3,
+    "", 0,
+    "\x7c\xa8\xc8\x9f\x50\x33\x47\x48\x7f\x93\x00\x41\x5f\xfa\x83\x24"
+    "\x5a\x3f\x1b\x6b\x22\xd2\x62\xd8\xab\xf1\x53\x0b\x7a\x47\x09\xc5"
+    "\x59\xdb\x82\x1c\xe8\x3d\x32\xc7\x0c\xaa\xc3\xf4\x88\x0c\x2d\xd9"
+    "\xea\xd3\xdc\x15\xb1\x0e\xb6\xb4\x2c\xc7\x96\x64\x52\xd9\x28\xc4", 64
+}
+};
+
+#define MAX_OUT_LEN 100
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct ARGON2_PARAMS params;
+
+    if (!prim_avail(HASH_BLAKE2B))
+        return 1;
+
+    params.type = test->type;
+    params.passes = test->passes;
+    params.memory = test->memory;
+    params.lanes = test->lanes;
+    params.secret = test->secret;
+    params.secret_len = test->secret_len;
+    params.ad = test->ad;
+    params.ad_len = test->ad_len;
+
+    ASSERT_SUCCESS(kdf_argon2(&params,
+                              test->pwd, test->pwd_len,
+                              test->salt, test->salt_len,
+                              out, test->out_len));
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_argon2(void);
+int test_vectors_argon2(void)
+{
+#if WITH_BLAKE2B
+    size_t t;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+#endif
+
+    return 1;
+}
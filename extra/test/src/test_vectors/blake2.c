@@ -0,0 +1,482 @@
+/*===-- test_vectors/blake2.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the BLAKE2b and BLAKE2s hash functions and their parallel
+*** variants BLAKE2bp and BLAKE2sp, with and without a key. As in the reference
+*** test vectors, the input and key bytes simply count up from zero.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+struct TEST_VECTOR
+{
+    prim_t hash;
+    size_t in_len;
+    size_t key_len;
+    const char *out;
+    size_t out_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    HASH_BLAKE2B, 0, 0,
+    "\x78\x6a\x02\xf7\x42\x01\x59\x03\xc6\xc6\xfd\x85\x25\x52\xd2\x72"
+    "\x91\x2f\x47\x40\xe1\x58\x47\x61\x8a\x86\xe2\x17\xf7\x1f\x54\x19"
+    "\xd2\x5e\x10\x31\xaf\xee\x58\x53\x13\x89\x64\x44\x93\x4e\xb0\x4b"
+    "\x90\x3a\x68\x5b\x14\x48\xb7\x55\xd5\x6f\x70\x1a\xfe\x9b\xe2\xce", 64
+},
+{
+    HASH_BLAKE2B, 0, 64,
+    "\x10\xeb\xb6\x77\x00\xb1\x86\x8e\xfb\x44\x17\x98\x7a\xcf\x46\x90"
+    "\xae\x9d\x97\x2f\xb7\xa5\x90\xc2\xf0\x28\x71\x79\x9a\xaa\x47\x86"
+    "\xb5\xe9\x96\xe8\xf0\xf4\xeb\x98\x1f\xc2\x14\xb0\x05\xf4\x2d\x2f"
+    "\xf4\x23\x34\x99\x39\x16\x53\xdf\x7a\xef\xcb\xc1\x3f\xc5\x15\x68", 64
+},
+{
+    HASH_BLAKE2B, 3, 0,
+    "\x40\xa3\x74\x72\x73\x02\xd9\xa4\x76\x9c\x17\xb5\xf4\x09\xff\x32"
+    "\xf5\x8a\xa2\x4f\xf1\x22\xd7\x60\x3e\x4f\xda\x15\x09\xe9\x19\xd4"
+    "\x10\x7a\x52\xc5\x75\x70\xa6\xd9\x4e\x50\x96\x7a\xea\x57\x3b\x11"
+    "\xf8\x6f\x47\x3f\x53\x75\x65\xc6\x6f\x70\x39\x83\x0a\x85\xd1\x86", 64
+},
+{
+    HASH_BLAKE2B, 3, 64,
+    "\x33\xd0\x82\x5d\xdd\xf7\xad\xa9\x9b\x0e\x7e\x30\x71\x04\xad\x07"
+    "\xca\x9c\xfd\x96\x92\x21\x4f\x15\x61\x35\x63\x15\xe7\x84\xf3\xe5"
+    "\xa1\x7e\x36\x4a\xe9\xdb\xb1\x4c\xb2\x03\x6d\xf9\x32\xb7\x7f\x4b"
+    "\x29\x27\x61\x36\x5f\xb3\x28\xde\x7a\xfd\xc6\xd8\x99\x8f\x5f\xc1", 64
+},
+{
+    HASH_BLAKE2B, 128, 0,
+    "\x23\x19\xe3\x78\x9c\x47\xe2\xda\xa5\xfe\x80\x7f\x61\xbe\xc2\xa1"
+    "\xa6\x53\x7f\xa0\x3f\x19\xff\x32\xe8\x7e\xec\xbf\xd6\x4b\x7e\x0e"
+    "\x8c\xcf\xf4\x39\xac\x33\x3b\x04\x0f\x19\xb0\xc4\xdd\xd1\x1a\x61"
+    "\xe2\x4a\xc1\xfe\x0f\x10\xa0\x39\x80\x6c\x5d\xcc\x0d\xa3\xd1\x15", 64
+},
+{
+    HASH_BLAKE2B, 128, 64,
+    "\x72\x06\x5e\xe4\xdd\x91\xc2\xd8\x50\x9f\xa1\xfc\x28\xa3\x7c\x7f"
+    "\xc9\xfa\x7d\x5b\x3f\x8a\xd3\xd0\xd7\xa2\x56\x26\xb5\x7b\x1b\x44"
+    "\x78\x8d\x4c\xaf\x80\x62\x90\x42\x5f\x98\x90\xa3\xa2\xa3\x5a\x90"
+    "\x5a\xb4\xb3\x7a\xcf\xd0\xda\x6e\x45\x17\xb2\x52\x5c\x96\x51\xe4", 64
+},
+{
+    HASH_BLAKE2B, 129, 0,
+    "\xf5\x97\x11\xd4\x4a\x03\x1d\x5f\x97\xa9\x41\x3c\x06\x5d\x1e\x61"
+    "\x4c\x41\x7e\xde\x99\x85\x90\x32\x5f\x49\xba\xd2\xfd\x44\x4d\x3e"
+    "\x44\x18\xbe\x19\xae\xc4\xe1\x14\x49\xac\x1a\x57\x20\x78\x98\xbc"
+    "\x57\xd7\x6a\x1b\xcf\x35\x66\x29\x2c\x20\xc6\x83\xa5\xc4\x64\x8f", 64
+},
+{
+    HASH_BLAKE2B, 129, 64,
+    "\x64\x47\x5d\xfe\x76\x00\xd7\x17\x1b\xea\x0b\x39\x4e\x27\xc9\xb0"
+    "\x0d\x8e\x74\xdd\x1e\x41\x6a\x79\x47\x36\x82\xad\x3d\xfd\xbb\x70"
+    "\x66\x31\x55\x80\x55\xcf\xc8\xa4\x0e\x07\xbd\x01\x5a\x45\x40\xdc"
+    "\xde\xa1\x58\x83\xcb\xbf\x31\x41\x2d\xf1\xde\x1c\xd4\x15\x2b\x91", 64
+},
+{
+    HASH_BLAKE2B, 896, 0,
+    "\xe6\x03\xf3\x43\xbc\x24\x09\xc2\x6d\x05\x08\x2b\x19\x89\x19\xe9"
+    "\x96\xa8\x7d\x59\x76\x44\xb7\x27\x48\x1e\xba\xd2\xec\xb7\x47\x71"
+    "\x7b\x00\x11\xdf\xfc\x96\x31\x08\xa3\xec\x38\x1a\x2e\xd5\x94\x60"
+    "\x0f\xd3\x01\xe1\x77\x7f\x2e\x4e\xa4\xf1\xf9\x41\x4b\x76\x38\x8a", 64
+},
+{
+    HASH_BLAKE2B, 896, 64,
+    "\x7b\x8c\xc5\x79\x71\xfd\x0a\x4a\xd3\xe6\x44\xad\x17\xbb\x8a\xcf"
+    "\xc2\x18\xd4\xab\xb0\xa4\xee\xf1\xb7\x70\x40\x63\xc2\x9f\x2a\x74"
+    "\x19\x6d\x0c\x96\x5b\xfa\xfc\x68\x39\x02\xdf\x1f\x30\x68\x48\xdf"
+    "\xd3\x88\x36\x6e\xe0\xd6\x05\x34\x6e\xea\x2a\x21\x6d\xc2\x2e\x30", 64
+},
+{
+    HASH_BLAKE2B, 897, 0,
+    "\xb0\x3b\xb0\xed\xbd\xb8\xde\xab\x75\x77\xe1\xe3\xdc\x88\x55\x4b"
+    "\xff\xd4\x6f\x2f\x2a\x8e\xbf\x6e\x9c\x8e\xf0\x90\xad\x22\xda\x76"
+    "\x74\xc4\x23\xf7\x12\xf7\x6f\xea\xda\x6b\x15\x32\x20\x63\xfa\x08"
+    "\x39\xba\x14\x07\x64\xeb\xe4\x6b\xff\x6e\x17\xad\x2d\x82\x71\x53", 64
+},
+{
+    HASH_BLAKE2B, 897, 64,
+    "\x5e\xe8\x07\x77\xc9\x88\xec\x4a\x1a\x90\xec\x73\x4c\xde\x1e\x53"
+    "\x06\xe8\x70\x36\xaa\x8c\x6d\x5a\xdb\xcc\x76\x0d\x0a\xbb\x78\xab"
+    "\xd8\x6e\xbd\x13\xac\x11\x21\xde\x4c\x51\x44\x7d\xee\x45\x79\x39"
+    "\x13\x2e\xd9\xd5\xf3\xec\xbb\x89\xa5\x75\x53\xd2\x5e\xc9\x3c\xf1", 64
+},
+{
+    HASH_BLAKE2B, 1536, 0,
+    "\xe0\x30\x7a\xa5\x7d\x85\xdb\x28\xc9\x92\x36\xc3\x65\x67\x0b\xfc"
+    "\xe7\xc8\x48\x65\x34\xc9\x02\x1d\x6c\x6a\x17\xc4\xad\x8f\xe0\x2e"
+    "\x26\x85\x88\x90\x48\x57\x55\xf8\x38\x19\x00\xf2\x35\xbf\x97\x5e"
+    "\x2e\x04\xe9\x45\x53\xa6\x0d\x80\x0b\x26\xe7\x11\xc9\xb8\xf6\x8e", 64
+},
+{
+    HASH_BLAKE2B, 1536, 64,
+    "\xa8\x04\xfe\xd1\xad\x6a\xae\x67\xa0\x98\xc9\xe6\x6d\x52\x95\x49"
+    "\x50\x7f\xf5\xf1\xa4\xf1\xa8\x16\xea\xa5\xa8\x6f\xda\xcc\x62\xb6"
+    "\x69\xd3\x87\x69\x9f\x88\x9b\xf7\x7b\x4f\xb5\x28\x3d\xaa\xe5\x87"
+    "\x48\x21\x0c\xfa\xea\xeb\x8a\xd5\x3e\x26\x46\x80\x3d\xf8\xbf\x13", 64
+},
+{
+    HASH_BLAKE2B, 5000, 0,
+    "\x5c\x29\x4a\xde\xa5\x0a\x2b\xe0\x78\x1b\x41\x85\x09\x3e\x5f\x9d"
+    "\xf0\xcf\xd4\x38\x48\xae\xa0\x17\xbf\x06\xef\x83\xf1\x59\xa7\xb2"
+    "\xc8\x35\xe6\xdc\xd0\x73\x67\xfc\x82\x33\x4f\xec\x8c\x7d\x20\x73"
+    "\x76\xda\xa1\x27\x2e\x1b\x48\xec\x48\xaa\xfa\x7f\xc8\xe1\xd1\xe6", 64
+},
+{
+    HASH_BLAKE2B, 5000, 64,
+    "\x8b\xd4\xb0\x5b\xff\x87\x56\x44\xaa\x71\xfa\xc6\xad\x29\x29\x1b"
+    "\x83\xd6\xab\x3c\x41\x43\x9c\x9f\x5e\x58\xc0\xe3\xa2\xa1\x5c\x29"
+    "\x7c\x8d\x63\x31\xa5\x11\xc6\xa8\xa0\xcd\x18\x0b\x08\x40\x19\x00"
+    "\x2e\x19\x69\x60\xd2\xed\x3e\x4b\xea\xcd\x52\x54\xfc\xfc\xb0\xc0", 64
+},
+{
+    HASH_BLAKE2S, 0, 0,
+    "\x69\x21\x7a\x30\x79\x90\x80\x94\xe1\x11\x21\xd0\x42\x35\x4a\x7c"
+    "\x1f\x55\xb6\x48\x2c\xa1\xa5\x1e\x1b\x25\x0d\xfd\x1e\xd0\xee\xf9", 32
+},
+{
+    HASH_BLAKE2S, 0, 32,
+    "\x48\xa8\x99\x7d\xa4\x07\x87\x6b\x3d\x79\xc0\xd9\x23\x25\xad\x3b"
+    "\x89\xcb\xb7\x54\xd8\x6a\xb7\x1a\xee\x04\x7a\xd3\x45\xfd\x2c\x49", 32
+},
+{
+    HASH_BLAKE2S, 3, 0,
+    "\xe8\xf9\x1c\x6e\xf2\x32\xa0\x41\x45\x2a\xb0\xe1\x49\x07\x0c\xdd"
+    "\x7d\xd1\x76\x9e\x75\xb3\xa5\x92\x1b\xe3\x78\x76\xc4\x5c\x99\x00", 32
+},
+{
+    HASH_BLAKE2S, 3, 32,
+    "\x1d\x22\x0d\xbe\x2e\xe1\x34\x66\x1f\xdf\x6d\x9e\x74\xb4\x17\x04"
+    "\x71\x05\x56\xf2\xf6\xe5\xa0\x91\xb2\x27\x69\x74\x45\xdb\xea\x6b", 32
+},
+{
+    HASH_BLAKE2S, 128, 0,
+    "\x1f\xa8\x77\xde\x67\x25\x9d\x19\x86\x3a\x2a\x34\xbc\xc6\x96\x2a"
+    "\x2b\x25\xfc\xbf\x5c\xbe\xcd\x7e\xde\x8f\x1f\xa3\x66\x88\xa7\x96", 32
+},
+{
+    HASH_BLAKE2S, 128, 32,
+    "\x0c\x31\x1f\x38\xc3\x5a\x4f\xb9\x0d\x65\x1c\x28\x9d\x48\x68\x56"
+    "\xcd\x14\x13\xdf\x9b\x06\x77\xf5\x3e\xce\x2c\xd9\xe4\x77\xc6\x0a", 32
+},
+{
+    HASH_BLAKE2S, 129, 0,
+    "\x5b\xd1\x69\xe6\x7c\x82\xc2\xc2\xe9\x8e\xf7\x00\x8b\xdf\x26\x1f"
+    "\x2d\xdf\x30\xb1\xc0\x0f\x9e\x7f\x27\x5b\xb3\xe8\xa2\x8d\xc9\xa2", 32
+},
+{
+    HASH_BLAKE2S, 129, 32,
+    "\x46\xa7\x3a\x8d\xd3\xe7\x0f\x59\xd3\x94\x2c\x01\xdf\x59\x9d\xef"
+    "\x78\x3c\x9d\xa8\x2f\xd8\x32\x22\xcd\x66\x2b\x53\xdc\xe7\xdb\xdf", 32
+},
+{
+    HASH_BLAKE2S, 896, 0,
+    "\x1b\xfe\xaa\x68\x22\xb7\xb1\xf3\x9e\x50\x02\x89\x02\x16\x65\xfb"
+    "\x70\xe5\x97\x0a\x45\x80\x11\x5b\xe3\x19\xd7\xb7\x6f\x20\xba\x13", 32
+},
+{
+    HASH_BLAKE2S, 896, 32,
+    "\x2f\xd5\xdd\x6d\xf2\xf2\x92\x0b\xcf\x11\xb6\x2f\x92\xf0\x53\x02"
+    "\xa9\x7d\xc8\xbd\x05\xd1\x91\x59\xf1\x3c\xc2\xa6\x48\x92\x4c\x07", 32
+},
+{
+    HASH_BLAKE2S, 897, 0,
+    "\x31\x1d\xed\xd3\x47\xa9\x02\xc5\xff\xb8\x2e\xb3\x46\xcd\x43\xf6"
+    "\xbe\x6c\xe9\xf7\xc3\x4d\x3f\xff\x7e\xab\xdb\x44\xe6\x04\x91\xad", 32
+},
+{
+    HASH_BLAKE2S, 897, 32,
+    "\x4d\x57\x1a\xd0\x0f\x57\x6f\x12\x8d\xfb\xae\x16\xa2\x6f\xa0\x60"
+    "\xf2\xe2\x1b\x63\x49\x93\xbf\x7c\xf6\x82\xa2\xa4\x56\x79\x6e\x9f", 32
+},
+{
+    HASH_BLAKE2S, 1536, 0,
+    "\x86\x09\x1a\x90\xb5\x66\x7e\xfa\xf0\x58\x65\x97\x53\x6f\x7b\x52"
+    "\x7e\xad\x27\x05\x19\x0d\x0a\x7b\xaf\x8f\xca\x28\xa0\xfe\x5b\xc7", 32
+},
+{
+    HASH_BLAKE2S, 1536, 32,
+    "\x83\x4b\xda\x00\x06\x33\x21\x02\xed\xc6\xd6\x9d\xaf\x7a\xa9\xe0"
+    "\x49\x46\x33\x04\xd5\xf5\x57\x3c\x9c\xf5\x77\x0a\xd7\x4f\xf2\x64", 32
+},
+{
+    HASH_BLAKE2S, 5000, 0,
+    "\x13\x73\x83\xb3\x9d\x4a\xf0\x04\xc1\xb7\x3d\xcc\x5f\x42\xed\xdd"
+    "\xef\xb6\xe7\x76\x5b\x0d\xfc\xaf\x62\xd1\xe9\x1f\x79\x08\x67\xc5", 32
+},
+{
+    HASH_BLAKE2S, 5000, 32,
+    "\x01\x9a\x16\xe9\xfb\x18\xc7\x1e\xee\x7f\x17\xa6\xd4\xe5\xf4\xe6"
+    "\x50\x77\xbd\xd9\x18\xf7\xa8\x4b\xa3\x5c\xcd\xea\x37\x20\xa5\x3a", 32
+},
+{
+    HASH_BLAKE2BP, 0, 0,
+    "\xb5\xef\x81\x1a\x80\x38\xf7\x0b\x62\x8f\xa8\xb2\x94\xda\xae\x74"
+    "\x92\xb1\xeb\xe3\x43\xa8\x0e\xaa\xbb\xf1\xf6\xae\x66\x4d\xd6\x7b"
+    "\x9d\x90\xb0\x12\x07\x91\xea\xb8\x1d\xc9\x69\x85\xf2\x88\x49\xf6"
+    "\xa3\x05\x18\x6a\x85\x50\x1b\x40\x51\x14\xbf\xa6\x78\xdf\x93\x80", 64
+},
+{
+    HASH_BLAKE2BP, 0, 64,
+    "\x9d\x94\x61\x07\x3e\x4e\xb6\x40\xa2\x55\x35\x7b\x83\x9f\x39\x4b"
+    "\x83\x8c\x6f\xf5\x7c\x9b\x68\x6a\x3f\x76\x10\x7c\x10\x66\x72\x8f"
+    "\x3c\x99\x56\xbd\x78\x5c\xbc\x3b\xf7\x9d\xc2\xab\x57\x8c\x5a\x0c"
+    "\x06\x3b\x9d\x9c\x40\x58\x48\xde\x1d\xbe\x82\x1c\xd0\x5c\x94\x0a", 64
+},
+{
+    HASH_BLAKE2BP, 3, 0,
+    "\x8c\xf9\x33\xa2\xd3\x61\xa3\xe6\xa1\x36\xdb\xe4\xa0\x1e\x79\x03"
+    "\x79\x7a\xd6\xce\x76\x6e\x2b\x91\xb9\xb4\xa4\x03\x51\x27\xd6\x5f"
+    "\x4b\xe8\x65\x50\x11\x94\x18\xe2\x2d\xa0\x0f\xd0\x6b\xf2\xb2\x75"
+    "\x96\xb3\x7f\x06\xbe\x0a\x15\x4a\xaf\x7e\xca\x54\xc4\x52\x0b\x97", 64
+},
+{
+    HASH_BLAKE2BP, 3, 64,
+    "\x30\x30\x2c\x3f\xc9\x99\x06\x5d\x10\xdc\x98\x2c\x8f\xee\xf4\x1b"
+    "\xbb\x66\x42\x71\x8f\x62\x4a\xf6\xe3\xea\xbe\xa0\x83\xe7\xfe\x78"
+    "\x53\x40\xdb\x4b\x08\x97\xef\xff\x39\xce\xe1\xdc\x1e\xb7\x37\xcd"
+    "\x1e\xea\x0f\xe7\x53\x84\x98\x4e\x7d\x8f\x44\x6f\xaa\x68\x3b\x80", 64
+},
+{
+    HASH_BLAKE2BP, 128, 0,
+    "\x05\xad\x0f\x27\x1f\xaf\x7e\x36\x13\x20\x51\x84\x52\x81\x3f\xf9"
+    "\xfb\x99\x76\xac\x37\x80\x50\xb6\xee\xfb\x05\xf7\x86\x7b\x57\x7b"
+    "\x8f\x14\x47\x57\x94\xcf\xf6\x1b\x2b\xc0\x62\xd3\x46\xa7\xc6\x5c"
+    "\x6e\x00\x67\xc6\x0a\x37\x4a\xf7\x94\x0f\x10\xaa\x44\x9d\x5f\xb9", 64
+},
+{
+    HASH_BLAKE2BP, 128, 64,
+    "\x92\x80\xf4\xd1\x15\x70\x32\xab\x31\x5c\x10\x0d\x63\x62\x83\xfb"
+    "\xf4\xfb\xa2\xfb\xad\x0f\x8b\xc0\x20\x72\x1d\x76\xbc\x1c\x89\x73"
+    "\xce\xd2\x88\x71\xcc\x90\x7d\xab\x60\xe5\x97\x56\x98\x7b\x0e\x0f"
+    "\x86\x7f\xa2\xfe\x9d\x90\x41\xf2\xc9\x61\x80\x74\xe4\x4f\xe5\xe9", 64
+},
+{
+    HASH_BLAKE2BP, 129, 0,
+    "\xb5\x45\x88\x02\x94\xaf\xa1\x53\xf8\xb9\xf4\x9c\x73\xd9\x52\xb5"
+    "\xd1\x22\x8f\x1a\x1a\xb5\xeb\xcb\x05\xff\x79\xe5\x60\xc0\x30\xf7"
+    "\x50\x0f\xe2\x56\xa4\x0b\x6a\x0e\x6c\xb3\xd4\x2a\xcd\x4b\x98\x59"
+    "\x5c\x5b\x51\xea\xec\x5a\xd6\x9c\xd4\x0f\x1f\xc1\x6d\x2d\x5f\x50", 64
+},
+{
+    HASH_BLAKE2BP, 129, 64,
+    "\x55\x30\xc2\xd5\x9f\x14\x48\x72\xe9\x87\xe4\xe2\x58\xa7\xd8\xc3"
+    "\x8c\xe8\x44\xe2\xcc\x2e\xed\x94\x0f\xfc\x68\x3b\x49\x88\x15\xe5"
+    "\x3a\xdb\x1f\xaa\xf5\x68\x94\x61\x22\x80\x5a\xc3\xb8\xe2\xfe\xd4"
+    "\x35\xfe\xd6\x16\x2e\x76\xf5\x64\xe5\x86\xba\x46\x44\x24\xe8\x85", 64
+},
+{
+    HASH_BLAKE2BP, 896, 0,
+    "\x64\x4a\x57\x37\xc8\xdc\xdb\x68\xb1\xea\xee\x39\x9b\x87\x44\xc2"
+    "\x0b\xf5\x0a\x3d\x63\xf4\x50\xc3\xea\x78\xc5\x7a\x47\x0e\xa8\x27"
+    "\xb2\x32\xcd\x51\x61\x84\x47\x5b\x9a\xdf\x1a\xad\x4f\xe4\x7c\xcc"
+    "\x1f\x7f\xdd\xc1\x39\x72\x86\x69\xfa\x8a\x9b\x23\x27\xde\x62\xab", 64
+},
+{
+    HASH_BLAKE2BP, 896, 64,
+    "\x84\x17\x03\xa8\x6e\xcb\x58\x50\x0f\xf2\xfd\x22\x6e\x7d\x78\x5f"
+    "\xe1\xa9\x85\xe7\x96\x6b\x6e\xbb\x5e\x59\x4c\x2a\x34\x19\x0e\xd0"
+    "\x9e\xcb\x38\x69\x27\x61\xe8\xea\xf8\x78\xdf\x51\x7c\xeb\xc2\x76"
+    "\xcd\x03\x1e\x76\xd9\x53\xf2\x82\x89\xd9\x0e\xc3\xdb\xab\x12\x67", 64
+},
+{
+    HASH_BLAKE2BP, 897, 0,
+    "\x66\x69\xf5\xed\x8d\x27\x37\x26\x52\x70\x20\x4f\x36\xe2\x36\x13"
+    "\xd4\x67\xc3\x6d\x6a\x89\x11\xf6\x55\x8a\x18\xf9\x82\x40\xb7\x76"
+    "\x96\xac\x5e\xf1\x2a\x15\x86\x85\x8e\x0d\xb1\xaf\xf4\x0a\x73\x83"
+    "\xf4\x2a\x23\x6a\x30\x16\xac\xc8\xa0\xad\xb8\x51\x02\x60\x94\x57", 64
+},
+{
+    HASH_BLAKE2BP, 897, 64,
+    "\x55\xdc\xb9\x8e\xbe\x65\x56\x7e\x22\x52\x6e\x83\x54\x16\xd5\xe4"
+    "\x8c\xf2\xd8\x4a\xdb\x73\x05\x5f\x77\x0f\xdf\xfa\x6c\xa5\xc0\xba"
+    "\x1b\x1e\x3c\x0b\x23\x1d\x52\xf5\x39\x74\xc0\xdf\xe0\xf4\xf3\xaa"
+    "\x04\x46\x10\x9f\xd4\xde\x14\xcb\x3a\xa7\x37\x5d\xde\xd7\x0a\x90", 64
+},
+{
+    HASH_BLAKE2BP, 1536, 0,
+    "\x40\xf9\x65\x93\x99\x34\xe8\xab\xbb\x0e\x79\x04\xa9\x6c\x58\xf6"
+    "\xbe\x63\xdf\x67\xe6\x70\xa9\x8e\xd0\x05\xc0\xf4\x17\x23\x53\x54"
+    "\xd3\xf9\x5f\x57\xba\xae\x7a\xcd\x7a\xe9\x66\xd4\x35\x6d\x34\x00"
+    "\xad\xf4\x58\xe1\x4c\x8e\xef\xed\xb7\x2c\xdc\xc1\x1e\x65\xe1\xf4", 64
+},
+{
+    HASH_BLAKE2BP, 1536, 64,
+    "\x32\x66\xed\x39\xdf\x7f\x64\x5e\x6b\x26\x68\x40\x96\xe0\xa2\xa6"
+    "\x36\x7f\xd1\x9d\x77\x4d\xa3\x2a\xc1\x17\x34\xee\x19\xf7\x61\x0a"
+    "\x47\xb8\x6b\x33\xc0\xab\xef\x8a\x83\x55\xf0\x1b\x2b\xce\x6b\xc0"
+    "\x8e\xf3\x25\xba\xc8\xc3\x4a\x17\x7e\x60\xef\x90\x50\xcb\x41\x6f", 64
+},
+{
+    HASH_BLAKE2BP, 5000, 0,
+    "\x05\x24\xd5\xcd\x2b\xf8\x42\xb6\xa0\x13\x15\x96\x4d\xc3\xf7\x5b"
+    "\x21\x28\x83\x3b\xf3\xdc\x4d\x75\xa3\x30\xe1\x9b\xdd\x1b\x31\xc9"
+    "\x74\x9e\x76\xa5\x17\x39\x16\x50\x01\xc0\x00\x85\x34\xcf\x4c\x1d"
+    "\x57\x5f\x7a\x4f\xd3\x66\x0f\x71\x2e\x1d\x53\xfb\x7c\x33\x4e\x06", 64
+},
+{
+    HASH_BLAKE2BP, 5000, 64,
+    "\x33\xc2\xdb\xeb\x45\x4f\x98\x51\x0a\xfa\x28\x7f\x61\x65\xe1\x21"
+    "\xc9\x78\x43\x07\xf8\x3a\x19\x91\x8c\xe0\xf9\x14\x87\x5e\xdb\xc6"
+    "\x86\x80\x05\x12\xb1\x1f\x90\x13\x88\x08\x36\x77\xe1\x54\x3f\xed"
+    "\x3a\x09\x9f\x72\xe2\x4e\x2d\xb9\xa3\xf1\x4a\x3a\x2b\xbf\xe0\x5b", 64
+},
+{
+    HASH_BLAKE2SP, 0, 0,
+    "\xdd\x0e\x89\x17\x76\x93\x3f\x43\xc7\xd0\x32\xb0\x8a\x91\x7e\x25"
+    "\x74\x1f\x8a\xa9\xa1\x2c\x12\xe1\xca\xc8\x80\x15\x00\xf2\xca\x4f", 32
+},
+{
+    HASH_BLAKE2SP, 0, 32,
+    "\x71\x5c\xb1\x38\x95\xae\xb6\x78\xf6\x12\x41\x60\xbf\xf2\x14\x65"
+    "\xb3\x0f\x4f\x68\x74\x19\x3f\xc8\x51\xb4\x62\x10\x43\xf0\x9c\xc6", 32
+},
+{
+    HASH_BLAKE2SP, 3, 0,
+    "\xed\x14\x41\x3b\x40\xda\x68\x9f\x1f\x7f\xed\x2b\x08\xdf\xf4\x5b"
+    "\x80\x92\xdb\x5e\xc2\xc3\x61\x0e\x02\x72\x4d\x20\x2f\x42\x3c\x46", 32
+},
+{
+    HASH_BLAKE2SP, 3, 32,
+    "\x8d\xbc\xc0\x58\x9a\x3d\x17\x29\x6a\x7a\x58\xe2\xf1\xef\xf0\xe2"
+    "\xaa\x42\x10\xb5\x8d\x1f\x88\xb8\x6d\x7b\xa5\xf2\x9d\xd3\xb5\x83", 32
+},
+{
+    HASH_BLAKE2SP, 128, 0,
+    "\x05\xcf\x3a\x90\x04\x91\x16\xdc\x60\xef\xc3\x15\x36\xaa\xa3\xd1"
+    "\x67\x76\x29\x94\x89\x28\x76\xdc\xb7\xef\x3f\xbe\xcd\x74\x49\xc0", 32
+},
+{
+    HASH_BLAKE2SP, 128, 32,
+    "\x0c\x6c\xe3\x2a\x3e\xa0\x56\x12\xc5\xf8\x09\x0f\x6a\x7e\x87\xf5"
+    "\xab\x30\xe4\x1b\x70\x7d\xcb\xe5\x41\x55\x62\x0a\xd7\x70\xa3\x40", 32
+},
+{
+    HASH_BLAKE2SP, 129, 0,
+    "\xcc\xd6\x1c\x92\x6c\xc1\xe5\xe9\x12\x8c\x02\x1c\x0c\x6e\x92\xae"
+    "\xfc\x4f\xfb\xde\x39\x4d\xd6\xf3\xb7\xd8\x7a\x8c\xed\x89\x60\x14", 32
+},
+{
+    HASH_BLAKE2SP, 129, 32,
+    "\xc6\x59\x38\xdd\x3a\x05\x3c\x72\x9c\xf5\xb7\xc8\x9f\x39\x0b\xfe"
+    "\xbb\x51\x12\x76\x6b\xb0\x0a\xa5\xfa\x31\x64\xdf\xdf\x3b\x56\x47", 32
+},
+{
+    HASH_BLAKE2SP, 896, 0,
+    "\x62\xc9\x80\xaf\xaf\x79\xf0\xac\xb1\x7b\xf9\x9b\x08\x99\xe4\x25"
+    "\x67\x2a\xae\x33\x8a\x38\xc3\x5e\xf4\xd7\xbb\x2d\xaa\xc4\x2f\x4f", 32
+},
+{
+    HASH_BLAKE2SP, 896, 32,
+    "\x51\xf2\x51\x87\x92\x82\xcf\x95\xeb\x70\x8b\xb9\x39\xc5\x95\x5b"
+    "\xe5\x69\x94\x43\x4e\xe4\x0e\x9d\xa7\xe6\xa4\x99\x46\x3f\x69\x76", 32
+},
+{
+    HASH_BLAKE2SP, 897, 0,
+    "\x96\x20\x00\xd0\x41\x62\xb9\x69\xcd\x5a\x09\x95\x98\x4b\x44\x48"
+    "\x41\xd7\x07\x89\x50\x3c\xa2\xd0\xbb\x1a\x57\x60\x64\x34\xe7\xe3", 32
+},
+{
+    HASH_BLAKE2SP, 897, 32,
+    "\xad\x50\xdd\x00\x5d\x2e\x03\xdd\xf4\x24\xe0\x80\x58\x7f\x1a\x8a"
+    "\x97\xcd\x0e\x0b\xb8\xb2\x0b\x19\x25\xe7\xd8\xaf\xc1\x89\xc2\x39", 32
+},
+{
+    HASH_BLAKE2SP, 1536, 0,
+    "\x39\x9b\xf7\x42\xb4\x9a\x59\x78\x58\xa1\xb0\xc2\xb5\x99\xf9\xfd"
+    "\x4d\x6d\x66\x20\x49\x41\xa8\x93\xbc\x79\xfc\xf0\x97\xe9\xd9\x92", 32
+},
+{
+    HASH_BLAKE2SP, 1536, 32,
+    "\xf1\x3a\x32\x1a\xf4\x44\xd1\xf6\x2c\x0a\xa7\x85\x95\x21\x89\x2c"
+    "\xaf\x37\x19\xba\xb8\x88\xca\x37\xfb\x29\x2e\x7e\x1b\x10\x40\xd3", 32
+},
+{
+    HASH_BLAKE2SP, 5000, 0,
+    "\xd7\xad\x4e\xd2\x6c\xe8\x5b\x35\xd9\x5d\xb2\x76\xde\xac\xd4\x8d"
+    "\xf0\xe5\x32\xfd\xf2\x68\x36\x22\xa4\xa9\x79\x99\xaa\x97\xe5\xc2", 32
+},
+{
+    HASH_BLAKE2SP, 5000, 32,
+    "\x68\x1a\xd4\x46\xcc\x4f\x8f\x48\xcc\x65\x6c\x90\x4b\xfe\x93\x19"
+    "\x79\x20\x5d\x26\x3f\x0a\x83\x3e\xad\x5c\xce\xba\x62\x19\x9e\xd3", 32
+}
+};
+
+#define MAX_IN_LEN 5000
+#define MAX_KEY_LEN 64
+#define MAX_OUT_LEN 64
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    static unsigned char in[MAX_IN_LEN];
+    unsigned char key[MAX_KEY_LEN];
+    unsigned char out[MAX_OUT_LEN];
+    union HASH_PARAMS params;
+    struct HASH_STATE state;
+    size_t t;
+
+    for (t = 0; t < test->in_len; ++t) in[t] = (unsigned char)t;
+    for (t = 0; t < test->key_len; ++t) key[t] = (unsigned char)t;
+
+    if (test->hash == HASH_BLAKE2B || test->hash == HASH_BLAKE2BP)
+    {
+        params.blake2b.key = key;
+        params.blake2b.key_len = test->key_len;
+    }
+    else
+    {
+        params.blake2s.key = key;
+        params.blake2s.key_len = test->key_len;
+    }
+
+    ASSERT_SUCCESS(hash_init(&state, test->hash, &params));
+
+    hash_update(&state, in, test->in_len);
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* Again, in small uneven pieces, which are buffered very differently. */
+
+    ASSERT_SUCCESS(hash_init(&state, test->hash, &params));
+
+    for (t = 0; t < test->in_len; t += 37)
+        hash_update(&state, in + t, test->in_len - t < 37
+                                    ? test->in_len - t : 37);
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* Keys which are too long must be rejected. */
+
+    params.blake2b.key_len = MAX_KEY_LEN + 1;
+    params.blake2s.key_len = MAX_KEY_LEN + 1;
+
+    ASSERT_FAILURE(hash_init(&state, test->hash, &params));
+
+    return 1;
+}
+
+int test_vectors_blake2(void);
+int test_vectors_blake2(void)
+{
+    size_t t;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (prim_avail(tests[t].hash))
+            if (!check(tests + t)) return 0;
+
+    return 1;
+}
@@ -0,0 +1,661 @@
+/*===-- test_vectors/blake3.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the BLAKE3 hash function, with and without a key, and for
+*** its extendable output. As in the reference test vectors, the input bytes
+*** are the byte offsets modulo 251, and the key is the same 32-byte string.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+#if WITH_BLAKE3
+#include "ordo/primitives/hash_functions/blake3.h"
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_BLAKE3
+
+struct TEST_VECTOR
+{
+    size_t in_len;
+    int keyed;
+    const char *out;
+    size_t out_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    0, 0,
+    "\xaf\x13\x49\xb9\xf5\xf9\xa1\xa6\xa0\x40\x4d\xea\x36\xdc\xc9\x49"
+    "\x9b\xcb\x25\xc9\xad\xc1\x12\xb7\xcc\x9a\x93\xca\xe4\x1f\x32\x62"
+    "\xe0\x0f\x03\xe7\xb6\x9a\xf2\x6b\x7f\xaa\xf0\x9f\xcd\x33\x30\x50"
+    "\x33\x8d\xdf\xe0\x85\xb8\xcc\x86\x9c\xa9\x8b\x20\x6c\x08\x24\x3a"
+    "\x26\xf5\x48\x77\x89\xe8\xf6\x60\xaf\xe6\xc9\x9e\xf9\xe0\xc5\x2b"
+    "\x92\xe7\x39\x30\x24\xa8\x04\x59\xcf\x91\xf4\x76\xf9\xff\xdb\xda"
+    "\x70\x01\xc2\x2e\x15\x9b\x40\x26\x31\xf2\x77\xca\x96\xf2\xde\xfd"
+    "\xf1\x07\x82\x82\x31\x4e\x76\x36\x99\xa3\x1c\x53\x63\x16\x54\x21"
+    "\xcc\xe1\x4d", 131
+},
+{
+    0, 1,
+    "\x92\xb2\xb7\x56\x04\xed\x3c\x76\x1f\x9d\x6f\x62\x39\x2c\x8a\x92"
+    "\x27\xad\x0e\xa3\xf0\x95\x73\xe7\x83\xf1\x49\x8a\x4e\xd6\x0d\x26"
+    "\xb1\x81\x71\xa2\xf2\x2a\x4b\x94\x82\x2c\x70\x1f\x10\x71\x53\xdb"
+    "\xa2\x49\x18\xc4\xba\xe4\xd2\x94\x5c\x20\xec\xe1\x33\x87\x62\x7d"
+    "\x3b\x73\xcb\xf9\x7b\x79\x7d\x5e\x59\x94\x8c\x7e\xf7\x88\xf5\x43"
+    "\x72\xdf\x45\xe4\x5e\x42\x93\xc7\xdc\x18\xc1\xd4\x11\x44\xa9\x75"
+    "\x8b\xe5\x89\x60\x85\x6b\xe1\xea\xbb\xe2\x2c\x26\x53\x19\x0d\xe5"
+    "\x60\xca\x3b\x2a\xc4\xaa\x69\x2a\x92\x10\x69\x42\x54\xc3\x71\xe8"
+    "\x51\xbc\x8f", 131
+},
+{
+    1, 0,
+    "\x2d\x3a\xde\xdf\xf1\x1b\x61\xf1\x4c\x88\x6e\x35\xaf\xa0\x36\x73"
+    "\x6d\xcd\x87\xa7\x4d\x27\xb5\xc1\x51\x02\x25\xd0\xf5\x92\xe2\x13"
+    "\xc3\xa6\xcb\x8b\xf6\x23\xe2\x0c\xdb\x53\x5f\x8d\x1a\x5f\xfb\x86"
+    "\x34\x2d\x9c\x0b\x64\xac\xa3\xbc\xe1\xd3\x1f\x60\xad\xfa\x13\x7b"
+    "\x35\x8a\xd4\xd7\x9f\x97\xb4\x7c\x3d\x5e\x79\xf1\x79\xdf\x87\xa3"
+    "\xb9\x77\x6e\xf8\x32\x5f\x83\x29\x88\x6b\xa4\x2f\x07\xfb\x13\x8b"
+    "\xb5\x02\xf4\x08\x1c\xbc\xec\x31\x95\xc5\x87\x1e\x6c\x23\xe2\xcc"
+    "\x97\xd3\xc6\x9a\x61\x3e\xba\x13\x1e\x5f\x13\x51\xf3\xf1\xda\x78"
+    "\x65\x45\xe5", 131
+},
+{
+    1, 1,
+    "\x6d\x78\x78\xdf\xff\x2f\x48\x56\x35\xd3\x90\x13\x27\x8a\xe1\x4f"
+    "\x14\x54\xb8\xc0\xa3\xa2\xd3\x4b\xc1\xab\x38\x22\x8a\x80\xc9\x5b"
+    "\x65\x68\xc0\x49\x06\x09\x41\x30\x06\xfb\xd4\x28\xeb\x3f\xd1\x4e"
+    "\x77\x56\xd9\x0f\x73\xa4\x72\x5f\xad\x14\x7f\x7b\xf7\x0f\xd6\x1c"
+    "\x4e\x0c\xf7\x07\x48\x85\xe9\x2b\x0e\x3f\x12\x59\x78\xb4\x15\x49"
+    "\x86\xd4\xfb\x20\x2a\x3f\x33\x1a\x3f\xb6\xcf\x34\x9a\x3a\x70\xe4"
+    "\x99\x90\xf9\x8f\xe4\x28\x97\x61\xc8\x60\x2c\x4e\x6a\xb1\x13\x8d"
+    "\x31\xd3\xb6\x22\x18\x07\x8b\x2f\x3b\xa9\xa8\x8e\x1d\x08\xd0\xdd"
+    "\x4c\xea\x11", 131
+},
+{
+    63, 0,
+    "\xe9\xbc\x37\xa5\x94\xda\xad\x83\xbe\x94\x70\xdf\x7f\x7b\x37\x98"
+    "\x29\x7c\x3d\x83\x4c\xe8\x0b\xa8\x5d\x6e\x20\x76\x27\xb7\xdb\x7b"
+    "\x11\x97\x01\x2b\x1e\x7d\x9a\xf4\xd7\xcb\x7b\xdd\x1f\x3b\xb4\x9a"
+    "\x90\xa9\xb5\xde\xc3\xea\x2b\xbc\x6e\xae\xbc\xe7\x7f\x4e\x47\x0c"
+    "\xbf\x46\x87\x09\x3b\x53\x52\xf0\x4e\x4a\x45\x70\xfb\xa2\x33\x16"
+    "\x4e\x6a\xcc\x36\x90\x0e\x35\xd1\x85\x88\x6a\x82\x7f\x7e\xa9\xbd"
+    "\xc1\xe5\xc3\xce\x88\xb0\x95\xa2\x00\xe6\x2c\x10\xc0\x43\xb3\xe9"
+    "\xbc\x6c\xb9\xb6\xac\x4d\xfa\x51\x79\x4b\x02\xac\xe9\xf9\x87\x79"
+    "\x04\x07\x55", 131
+},
+{
+    63, 1,
+    "\xbb\x1e\xb5\xd4\xaf\xa7\x93\xc1\xeb\xdd\x9f\xb0\x8d\xef\x6c\x36"
+    "\xd1\x00\x96\x98\x6a\xe0\xcf\xe1\x48\xcd\x10\x11\x70\xce\x37\xae"
+    "\xa0\x5a\x63\xd7\x4a\x84\x0a\xec\xd5\x14\xf6\x54\xf0\x80\xe5\x1a"
+    "\xc5\x0f\xd6\x17\xd2\x26\x10\xd9\x17\x80\xfe\x6b\x07\xa2\x6b\x08"
+    "\x47\xab\xb3\x82\x91\x05\x8c\x97\x47\x4e\xf6\xdd\xd1\x90\xd3\x0f"
+    "\xc3\x18\x18\x5c\x09\xca\x15\x89\xd2\x02\x4f\x0a\x6f\x16\xd4\x5f"
+    "\x11\x67\x83\x77\x48\x3f\xa5\xc0\x05\xb2\xa1\x07\xcb\x99\x43\xe5"
+    "\xda\x63\x4e\x70\x46\x85\x5e\xaa\x88\x86\x63\xde\x55\xd6\x47\x13"
+    "\x71\xd5\x5d", 131
+},
+{
+    64, 0,
+    "\x4e\xed\x71\x41\xea\x4a\x5c\xd4\xb7\x88\x60\x6b\xd2\x3f\x46\xe2"
+    "\x12\xaf\x9c\xac\xeb\xac\xdc\x7d\x1f\x4c\x6d\xc7\xf2\x51\x1b\x98"
+    "\xfc\x9c\xc5\x6c\xb8\x31\xff\xe3\x3e\xa8\xe7\xe1\xd1\xdf\x09\xb2"
+    "\x6e\xfd\x27\x67\x67\x00\x66\xaa\x82\xd0\x23\xb1\xdf\xe8\xab\x1b"
+    "\x2b\x7f\xbb\x5b\x97\x59\x2d\x46\xff\xe3\xe0\x5a\x6a\x9b\x59\x2e"
+    "\x29\x49\xc7\x41\x60\xe4\x67\x43\x01\xbc\x3f\x97\xe0\x49\x03\xf8"
+    "\xc6\xcf\x95\xb8\x63\x17\x4c\x33\x22\x89\x24\xcd\xef\x7a\xe4\x75"
+    "\x59\xb1\x0b\x29\x4a\xcd\x66\x06\x66\xc4\x53\x88\x33\x58\x2b\x43"
+    "\xf8\x2d\x74", 131
+},
+{
+    64, 1,
+    "\xba\x8c\xed\x36\xf3\x27\x70\x0d\x21\x3f\x12\x0b\x1a\x20\x7a\x3b"
+    "\x8c\x04\x33\x05\x28\x58\x6f\x41\x4d\x09\xf2\xf7\xd9\xcc\xb7\xe6"
+    "\x82\x44\xc2\x60\x10\xaf\xc3\xf7\x62\x61\x5b\xba\xc5\x52\xa1\xca"
+    "\x90\x9e\x67\xc8\x3e\x2f\xd5\x47\x8c\xf4\x6b\x9e\x81\x1e\xfc\xcc"
+    "\x93\xf7\x7a\x21\xb1\x7a\x15\x2e\xba\xca\x16\x95\x73\x3f\xdb\x08"
+    "\x6e\x23\xcd\x0e\xb4\x8c\x41\xc0\x34\xd5\x25\x23\xfc\x21\x23\x6e"
+    "\x5d\x8c\x92\x55\x30\x6e\x48\xd5\x2b\xa4\x0b\x4d\xac\x24\x25\x64"
+    "\x60\xd5\x65\x73\xd1\x31\x23\x19\xaf\xcf\x3e\xd3\x9d\x72\xd0\xbf"
+    "\xc6\x9a\xcb", 131
+},
+{
+    65, 0,
+    "\xde\x1e\x5f\xa0\xbe\x70\xdf\x6d\x2b\xe8\xff\xfd\x0e\x99\xce\xaa"
+    "\x8e\xb6\xe8\xc9\x3a\x63\xf2\xd8\xd1\xc3\x0e\xcb\x6b\x26\x3d\xee"
+    "\x0e\x16\xe0\xa4\x74\x9d\x68\x11\xdd\x1d\x6d\x12\x65\xc2\x97\x29"
+    "\xb1\xb7\x5a\x9a\xc3\x46\xcf\x93\xf0\xe1\xd7\x29\x6d\xfc\xfd\x43"
+    "\x13\xb3\xa2\x27\xfa\xaa\xaf\x77\x57\xcc\x95\xb4\xe8\x7a\x49\xbe"
+    "\x3b\x8a\x27\x0a\x12\x02\x02\x33\x50\x9b\x1c\x36\x32\xb3\x48\x5e"
+    "\xef\x30\x9d\x0a\xbc\x4a\x4a\x69\x6c\x9d\xec\xc6\xe9\x04\x54\xb5"
+    "\x3b\x00\x0f\x45\x6a\x3f\x10\x07\x90\x72\xba\xaf\x7a\x98\x16\x53"
+    "\x22\x1f\x2c", 131
+},
+{
+    65, 1,
+    "\xc0\xa4\xed\xef\xa2\xd2\xac\xcb\x92\x77\xc3\x71\xac\x12\xfc\xdb"
+    "\xb5\x29\x88\xa8\x6e\xdc\x54\xf0\x71\x6e\x15\x91\xb4\x32\x6e\x72"
+    "\xd5\xe7\x95\xf4\x6a\x59\x6b\x02\xd3\xd4\xbf\xb4\x3a\xba\xd1\xe5"
+    "\xd1\x92\x11\x15\x27\x22\xec\x1f\x20\xfe\xf2\xcd\x41\x3e\x3c\x22"
+    "\xf2\xfc\x5d\xa3\xd7\x30\x41\x27\x5b\xe6\xed\xe3\x51\x7b\x3b\x9f"
+    "\x0f\xc6\x7a\xde\x59\x56\xa6\x72\xb8\xb7\x5d\x96\xcb\x43\x29\x4b"
+    "\x90\x41\x49\x7d\xe9\x26\x37\xed\x3f\x24\x39\x22\x5e\x68\x39\x10"
+    "\xcb\x3a\xe9\x23\x37\x44\x49\xca\x78\x8f\xb0\xf9\xbe\xa9\x27\x31"
+    "\xbc\x26\xad", 131
+},
+{
+    1023, 0,
+    "\x10\x10\x89\x70\xee\xda\x3e\xb9\x32\xba\xac\x14\x28\xc7\xa2\x16"
+    "\x3b\x0e\x92\x4c\x9a\x9e\x25\xb3\x5b\xba\x72\xb2\x8f\x70\xbd\x11"
+    "\xa1\x82\xd2\x7a\x59\x1b\x05\x59\x2b\x15\x60\x75\x00\xe1\xe8\xdd"
+    "\x56\xbc\x6c\x7f\xc0\x63\x71\x5b\x7a\x1d\x73\x7d\xf5\xba\xd3\x33"
+    "\x9c\x56\x77\x89\x57\xd8\x70\xeb\x97\x17\xb5\x7e\xa3\xd9\xfb\x68"
+    "\xd1\xb5\x51\x27\xbb\xa6\xa9\x06\xa4\xa2\x4b\xbd\x5a\xcb\x2d\x12"
+    "\x3a\x37\xb2\x8f\x9e\x9a\x81\xbb\xaa\xe3\x60\xd5\x8f\x85\xe5\xfc"
+    "\x9d\x75\xf7\xc3\x70\xa0\xcc\x09\xb6\x52\x2d\x9c\x8d\x82\x2f\x2f"
+    "\x28\xf4\x85", 131
+},
+{
+    1023, 1,
+    "\xc9\x51\xec\xdf\x03\x28\x8d\x0f\xcc\x96\xee\x34\x13\x56\x3d\x8a"
+    "\x6d\x35\x89\x54\x7f\x2c\x2f\xb3\x6d\x97\x86\x47\x0f\x1b\x9d\x6e"
+    "\x89\x03\x16\xd2\xe6\xd8\xb8\xc2\x5b\x0a\x5b\x21\x80\xf9\x4f\xb1"
+    "\xa1\x58\xef\x50\x8c\x3c\xde\x45\xe2\x96\x6b\xd7\x96\xa6\x96\xd3"
+    "\xe1\x3e\xfd\x86\x25\x9d\x75\x63\x87\xd9\xbe\xcf\x5c\x8b\xf1\xce"
+    "\x21\x92\xb8\x70\x25\x15\x29\x07\xb6\xd8\xcc\x33\xd1\x78\x26\xd8"
+    "\xb7\xb9\xbc\x97\xe3\x8c\x3c\x85\x10\x8e\xf0\x9f\x01\x3e\x01\xc2"
+    "\x29\xc2\x0a\x83\xd9\xe8\xef\xac\x5b\x37\x47\x0d\xa2\x85\x75\xfd"
+    "\x75\x5a\x10", 131
+},
+{
+    1024, 0,
+    "\x42\x21\x47\x39\xf0\x95\xa4\x06\xf3\xfc\x83\xde\xb8\x89\x74\x4a"
+    "\xc0\x0d\xf8\x31\xc1\x0d\xaa\x55\x18\x9b\x5d\x12\x1c\x85\x5a\xf7"
+    "\x1c\xf8\x10\x72\x65\xec\xda\xf8\x50\x5b\x95\xd8\xfc\xec\x83\xa9"
+    "\x8a\x6a\x96\xea\x51\x09\xd2\xc1\x79\xc4\x7a\x38\x7f\xfb\xb4\x04"
+    "\x75\x6f\x6e\xea\xe7\x88\x3b\x44\x6b\x70\xeb\xb1\x44\x52\x7c\x20"
+    "\x75\xab\x8a\xb2\x04\xc0\x08\x6b\xb2\x2b\x7c\x93\xd4\x65\xef\xc5"
+    "\x7f\x8d\x91\x7f\x0b\x38\x5c\x6d\xf2\x65\xe7\x70\x03\xb8\x51\x02"
+    "\x96\x74\x86\xed\x57\xdb\x5c\x5c\xa1\x70\xba\x44\x14\x27\xed\x9a"
+    "\xfa\x68\x4e", 131
+},
+{
+    1024, 1,
+    "\x75\xc4\x6f\x6f\x3d\x9e\xb4\xf5\x5e\xca\xae\xe4\x80\xdb\x73\x2e"
+    "\x6c\x21\x05\x54\x6f\x1e\x67\x50\x03\x68\x7c\x31\x71\x9c\x7b\xa4"
+    "\xa7\x8b\xc8\x38\xc7\x28\x52\xd4\xf4\x9c\x86\x4a\xcb\x7a\xda\xfe"
+    "\x24\x78\xe8\x24\xaf\xe5\x1c\x89\x19\xd0\x61\x68\x41\x4c\x26\x5f"
+    "\x29\x8a\x80\x94\xb1\xad\x81\x3a\x9b\x86\x14\xac\xab\xac\x32\x1f"
+    "\x24\xce\x61\xc5\xa5\x34\x6e\xb5\x19\x52\x0d\x38\xec\xc4\x3e\x89"
+    "\xb5\x00\x02\x36\xdf\x05\x97\x24\x3e\x4d\x24\x93\xfd\x62\x67\x30"
+    "\xe2\xba\x17\xac\x4d\x88\x24\xd0\x9d\x1a\x4a\x8f\x57\xb8\x22\x77"
+    "\x78\xe2\xde", 131
+},
+{
+    1025, 0,
+    "\xd0\x02\x78\xae\x47\xeb\x27\xb3\x4f\xae\xcf\x67\xb4\xfe\x26\x3f"
+    "\x82\xd5\x41\x29\x16\xc1\xff\xd9\x7c\x8c\xb7\xfb\x81\x4b\x84\x44"
+    "\xf4\xc4\xa2\x2b\x4b\x39\x91\x55\x35\x8a\x99\x4e\x52\xbf\x25\x5d"
+    "\xe6\x00\x35\x74\x2e\xc7\x1b\xd0\x8a\xc2\x75\xa1\xb5\x1c\xc6\xbf"
+    "\xe3\x32\xb0\xef\x84\xb4\x09\x10\x8c\xda\x08\x0e\x62\x69\xed\x4b"
+    "\x3e\x2c\x3f\x7d\x72\x2a\xa4\xcd\xc9\x8d\x16\xde\xb5\x54\xe5\x62"
+    "\x7b\xe8\xf9\x55\xc9\x8e\x1d\x5f\x95\x65\xa9\x19\x4c\xad\x0c\x42"
+    "\x85\xf9\x37\x00\x06\x2d\x95\x95\xad\xb9\x92\xae\x68\xff\x12\x80"
+    "\x0a\xb6\x7a", 131
+},
+{
+    1025, 1,
+    "\x35\x7d\xc5\x5d\xe0\xc7\xe3\x82\xc9\x00\xfd\x6e\x32\x0a\xcc\x04"
+    "\x14\x6b\xe0\x1d\xb6\xa8\xce\x72\x10\xb7\x18\x9b\xd6\x64\xea\x69"
+    "\x36\x23\x96\xb7\x7f\xdc\x0d\x26\x34\xa5\x52\x97\x08\x43\x72\x20"
+    "\x66\xc3\xc1\x59\x02\xae\x50\x97\xe0\x0f\xf5\x3f\x1e\x11\x6f\x1c"
+    "\xd5\x35\x27\x20\x11\x3a\x83\x7a\xb2\x45\x2c\xaf\xbd\xe4\xd5\x40"
+    "\x85\xd9\xcf\x5d\x21\xca\x61\x30\x71\x55\x1b\x25\xd5\x2e\x69\xd6"
+    "\xc8\x11\x23\x87\x2b\x6f\x19\xcd\x3b\xc1\x33\x3e\xdf\x0c\x52\xb9"
+    "\x4d\xe2\x3b\xa7\x72\xcf\x82\x63\x6c\xff\x45\x42\x54\x0a\x77\x38"
+    "\xd5\xb9\x30", 131
+},
+{
+    2048, 0,
+    "\xe7\x76\xb6\x02\x8c\x7c\xd2\x2a\x4d\x0b\xa1\x82\xa8\xbf\x62\x20"
+    "\x5d\x2e\xf5\x76\x46\x7e\x83\x8e\xd6\xf2\x52\x9b\x85\xfb\xa2\x4a"
+    "\x9a\x60\xbf\x80\x00\x14\x10\xec\x9e\xea\x66\x98\xcd\x53\x79\x39"
+    "\xfa\xd4\x74\x9e\xdd\x48\x4c\xb5\x41\xac\xed\x55\xcd\x9b\xf5\x47"
+    "\x64\xd0\x63\xf2\x3f\x6f\x1e\x32\xe1\x29\x58\xba\x5c\xfe\xb1\xbf"
+    "\x61\x8a\xd0\x94\x26\x6d\x4f\xc3\xc9\x68\xc2\x08\x8f\x67\x74\x54"
+    "\xc2\x88\xc6\x7b\xa0\xdb\xa3\x37\xb9\xd9\x1c\x7e\x1b\xa5\x86\xdc"
+    "\x9a\x5b\xc2\xd5\xe9\x0c\x14\xf5\x3a\x88\x63\xac\x75\x65\x54\x61"
+    "\xce\xa8\xf9", 131
+},
+{
+    2048, 1,
+    "\x87\x9c\xf1\xfa\x2e\xa0\xe7\x91\x26\xcb\x10\x63\x61\x7a\x05\xb6"
+    "\xad\x9d\x0b\x69\x6d\x0d\x75\x7c\xf0\x53\x43\x9f\x60\xa9\x9d\xd1"
+    "\x01\x73\xb9\x61\xcd\x57\x42\x88\x19\x4b\x23\xec\xe2\x78\xc3\x30"
+    "\xfb\xb8\x58\x54\x85\xe7\x49\x67\xf3\x13\x52\xa8\x18\x3a\xa7\x82"
+    "\xb2\xb2\x2f\x26\xcd\xca\xdb\x61\xee\xd1\xa5\xbc\x14\x4b\x81\x98"
+    "\xfb\xb0\xc1\x3a\xbb\xf8\xe3\x19\x2c\x14\x5d\x0a\x5c\x21\x63\x3b"
+    "\x0e\xf8\x60\x54\xf4\x28\x09\xdf\x82\x33\x89\xee\x40\x81\x1a\x59"
+    "\x10\xdc\xbd\x10\x18\xaf\x31\xc3\xb4\x3a\xa5\x52\x01\xed\x4e\xda"
+    "\xac\x74\xfe", 131
+},
+{
+    2049, 0,
+    "\x5f\x4d\x72\xf4\x0d\x7a\x5f\x82\xb1\x5c\xa2\xb2\xe4\x4b\x1d\xe3"
+    "\xc2\xef\x86\xc4\x26\xc9\x5c\x1a\xf0\xb6\x87\x95\x22\x56\x30\x30"
+    "\x96\xde\x31\xd7\x1d\x74\x10\x34\x03\x82\x2a\x2e\x0b\xc1\xeb\x19"
+    "\x3e\x7a\xec\xc9\x64\x3a\x76\xb7\xbb\xc0\xc9\xf9\xc5\x2e\x87\x83"
+    "\xaa\xe9\x87\x64\xca\x46\x89\x62\xb5\xc2\xec\x92\xf0\xc7\x4e\xb5"
+    "\x44\x8d\x51\x97\x13\xe0\x94\x13\x71\x94\x31\xc8\x02\xf9\x48\xdd"
+    "\x5d\x90\x42\x5a\x4e\xcd\xad\xec\xe9\xeb\x17\x8d\x80\xf2\x6e\xfc"
+    "\xca\xe6\x30\x73\x4d\xff\x63\x34\x02\x85\xad\xec\x2a\xed\x3b\x51"
+    "\x07\x3a\xd3", 131
+},
+{
+    2049, 1,
+    "\x9f\x29\x70\x09\x02\xf7\xc8\x6e\x51\x4d\xdc\x4d\xf1\xe3\x04\x9f"
+    "\x25\x8b\x24\x72\xb6\xdd\x52\x67\xf6\x1b\xf1\x39\x83\xb7\x8d\xd5"
+    "\xf9\xa8\x8a\xbf\xef\xdf\xa1\xe0\x0b\x41\x89\x71\xf2\xb3\x9c\x64"
+    "\xca\x62\x1e\x8e\xb3\x7f\xce\xac\x57\xfd\x0c\x8f\xc8\xe1\x17\xd4"
+    "\x3b\x81\x44\x7b\xe2\x2d\x5d\x81\x86\xf8\xf5\x91\x9b\xa6\xbc\xc6"
+    "\x84\x6b\xd7\xd5\x07\x26\xc0\x6d\x24\x56\x72\xc2\xad\x4f\x61\x70"
+    "\x2c\x64\x64\x99\xee\x11\x73\xda\xa0\x61\xff\xe1\x5b\xf4\x5a\x63"
+    "\x1e\x29\x46\xd6\x16\xa4\xc3\x45\x82\x2f\x11\x51\x28\x47\x12\xf7"
+    "\x6b\x2b\x0e", 131
+},
+{
+    3072, 0,
+    "\xb9\x8c\xb0\xff\x36\x23\xbe\x03\x32\x6b\x37\x3d\xe6\xb9\x09\x52"
+    "\x18\x51\x3e\x64\xf1\xee\x2e\xdd\x25\x25\xc7\xad\x1e\x5c\xff\xd2"
+    "\x9a\x3f\x6b\x0b\x97\x8d\x66\x08\x33\x5c\x09\xdc\x94\xcc\xf6\x82"
+    "\xf9\x95\x1c\xdf\xc5\x01\xbf\xe4\x7b\x9c\x91\x89\xa6\xfc\x7b\x40"
+    "\x4d\x12\x02\x58\x50\x63\x41\xa6\xd8\x02\x85\x73\x22\xfb\xd2\x0d"
+    "\x3e\x5d\xae\x05\xb9\x5c\x88\x79\x3f\xa8\x3d\xb1\xcb\x08\xe7\xd8"
+    "\x00\x8d\x15\x99\xb6\x20\x9d\x78\x33\x6e\x24\x83\x97\x24\xc1\x91"
+    "\xb2\xa5\x2a\x80\x44\x83\x06\xe0\xda\xa8\x4a\x3f\xdb\x56\x66\x61"
+    "\xa3\x7e\x11", 131
+},
+{
+    3072, 1,
+    "\x04\x4a\x0e\x7b\x17\x2a\x31\x2d\xc0\x2a\x4c\x9a\x81\x8c\x03\x6f"
+    "\xfa\x27\x76\x36\x8d\x7f\x52\x82\x68\xd2\xe6\xb5\xdf\x19\x17\x70"
+    "\x22\xf3\x02\xd0\x52\x9e\x41\x74\xcc\x50\x7c\x46\x36\x71\x21\x79"
+    "\x75\xe8\x1d\xab\x02\xb8\xfd\xeb\x0d\x7c\xcc\x75\x68\xdd\x22\x57"
+    "\x4c\x78\x3a\x76\xbe\x21\x54\x41\xb3\x2e\x91\xb9\xa9\x04\xbe\x8e"
+    "\xa8\x1f\x7a\x0a\xfd\x14\xba\xd8\xee\x7c\x8e\xfc\x30\x5a\xce\x5d"
+    "\x3d\xd6\x1b\x99\x6f\xeb\xe8\xda\x4f\x56\xca\x09\x19\x35\x9a\x75"
+    "\x33\x21\x6e\x29\x99\xfc\x87\xff\x7d\x8f\x17\x6f\xbe\xcb\x3d\x6f"
+    "\x34\x27\x8b", 131
+},
+{
+    3073, 0,
+    "\x71\x24\xb4\x95\x01\x01\x2f\x81\xcc\x7f\x11\xca\x06\x9e\xc9\x22"
+    "\x6c\xec\xb8\xa2\xc8\x50\xcf\xe6\x44\xe3\x27\xd2\x2d\x3e\x1c\xd3"
+    "\x9a\x27\xae\x3b\x79\xd6\x8d\x89\xda\x9b\xf2\x5b\xc2\x71\x39\xae"
+    "\x65\xa3\x24\x91\x8a\x5f\x9b\x78\x28\x18\x1e\x52\xcf\x37\x3c\x84"
+    "\xf3\x5b\x63\x9b\x7f\xcc\xbb\x98\x5b\x6f\x2f\xa5\x6a\xea\x0c\x18"
+    "\xf5\x31\x20\x34\x97\xb8\xbb\xd3\xa0\x7c\xeb\x59\x26\xf1\xca\xb7"
+    "\x4d\x14\xbd\x66\x48\x6d\x9a\x91\xeb\xa9\x90\x59\xa9\x8b\xd1\xcd"
+    "\x25\x87\x6b\x2a\xf5\xa7\x6c\x3e\x9e\xed\x55\x4e\xd7\x2e\xa9\x52"
+    "\xb6\x03\xbf", 131
+},
+{
+    3073, 1,
+    "\x68\xde\xde\x9b\xef\x00\xba\x89\xe4\x3f\x31\xa6\x82\x5f\x4c\xf4"
+    "\x33\x38\x9f\xed\xae\x75\xc0\x4e\xe9\xf0\xcf\x16\xa4\x27\xc9\x5a"
+    "\x96\xd6\xda\x3f\xe9\x85\x05\x4d\x34\x78\x86\x5b\xe9\xa0\x92\x25"
+    "\x08\x39\xa6\x97\xbb\xda\x74\xe2\x79\xe8\xa9\xe6\x9f\x00\x25\xe4"
+    "\xcf\xdd\xd6\xcf\xb4\x34\xb1\xcd\x95\x43\xaa\xf9\x7c\x63\x5d\x1b"
+    "\x45\x1a\x43\x86\x04\x1e\x4b\xb1\x00\xf5\xe4\x54\x07\xcb\xbc\x24"
+    "\xfa\x53\xea\x2d\xe3\x53\x6c\xcb\x32\x9e\x4e\xb9\x46\x6e\xc3\x70"
+    "\x93\xa4\x2c\xf6\x2b\x82\x90\x3c\x69\x6a\x93\xa5\x0b\x70\x2c\x80"
+    "\xf3\xc3\xc5", 131
+},
+{
+    4096, 0,
+    "\x01\x50\x94\x01\x3f\x57\xa5\x27\x7b\x59\xd8\x47\x5c\x05\x01\x04"
+    "\x2c\x0b\x64\x2e\x53\x1b\x0a\x1c\x8f\x58\xd2\x16\x32\x29\xe9\x69"
+    "\x02\x89\xe9\x40\x9d\xdb\x1b\x99\x76\x8e\xaf\xe1\x62\x3d\xa8\x96"
+    "\xfa\xf7\xe1\x11\x4b\xeb\xea\xdc\x1b\xe3\x08\x29\xb6\xf8\xaf\x70"
+    "\x7d\x85\xc2\x98\xf4\xf0\xff\x4d\x94\x38\xae\xf9\x48\x33\x56\x12"
+    "\xae\x92\x1e\x76\xd4\x11\xc3\xa9\x11\x1d\xf6\x2d\x27\xea\xf8\x71"
+    "\x95\x9a\xe0\x06\x2b\x54\x92\xa0\xfe\xb9\x8e\xf3\xed\x4a\xf2\x77"
+    "\xf5\x39\x51\x72\xdb\xe5\xc3\x11\x91\x8e\xa0\x07\x4c\xe0\x03\x64"
+    "\x54\xf6\x20", 131
+},
+{
+    4096, 1,
+    "\xbe\xfc\x66\x0a\xea\x2f\x17\x18\x88\x4c\xd8\xde\xb9\x90\x28\x11"
+    "\xd3\x32\xf4\xfc\x4a\x38\xcf\x7c\x73\x00\xd5\x97\xa0\x81\xbf\xc0"
+    "\xbb\xb6\x4a\x36\xed\xb5\x64\xe0\x1e\x4b\x4a\xaf\x3b\x06\x00\x92"
+    "\xa6\xb8\x38\xbe\xa4\x4a\xfe\xbd\x2d\xeb\x82\x98\xfa\x56\x2b\x7b"
+    "\x59\x7c\x75\x7b\x9d\xf4\xc9\x11\xc3\xca\x46\x2e\x2a\xc8\x9e\x9a"
+    "\x78\x73\x57\xaa\xf7\x4c\x3b\x56\xd5\xc0\x7b\xc9\x3c\xe8\x99\x56"
+    "\x8a\x3e\xb1\x7d\x92\x50\xc2\x0f\x6c\x5f\x6c\x1e\x79\x2e\xc9\xa2"
+    "\xdc\xb7\x15\x39\x8d\x5a\x6e\xc6\xd5\xc5\x4f\x58\x6a\x00\x40\x3a"
+    "\x1a\xf1\xde", 131
+},
+{
+    4097, 0,
+    "\x9b\x40\x52\xb3\x8f\x1c\x5f\xc8\xb1\xf9\xff\x7a\xc7\xb2\x7c\xd2"
+    "\x42\x48\x7b\x3d\x89\x0d\x15\xc9\x6a\x1c\x25\xb8\xaa\x0f\xb9\x95"
+    "\x05\xf9\x1b\x0b\x56\x00\xa1\x12\x51\x65\x2e\xac\xfa\x94\x97\xb3"
+    "\x1c\xd3\xc4\x09\xce\x2e\x45\xcf\xe6\xc0\xa0\x16\x96\x73\x16\xc4"
+    "\x26\xbd\x26\xf6\x19\xea\xb5\xd7\x0a\xf9\xa4\x18\xb8\x45\xc6\x08"
+    "\x84\x03\x90\xf3\x61\x63\x0b\xd4\x97\xb1\xab\x44\x01\x93\x16\x35"
+    "\x7c\x61\xdb\xe0\x91\xce\x72\xfc\x16\xdc\x34\x0a\xc3\xd6\xe0\x09"
+    "\xe0\x50\xb3\xad\xac\x4b\x5b\x2c\x92\xe7\x22\xcf\xfd\xc4\x65\x01"
+    "\x53\x19\x56", 131
+},
+{
+    4097, 1,
+    "\x00\xdf\x94\x0c\xd3\x6b\xb9\xfa\x7c\xbb\xc3\x55\x67\x44\xe0\xdb"
+    "\xc8\x19\x14\x01\xaf\xe7\x05\x20\xba\x29\x2e\xe3\xca\x80\xab\xbc"
+    "\x60\x6d\xb4\x97\x6c\xfd\xd2\x66\xae\x0a\xbf\x66\x7d\x94\x81\x83"
+    "\x1f\xf1\x2e\x0c\xaa\x26\x8e\x7d\x3e\x57\x26\x0c\x08\x24\x11\x5a"
+    "\x54\xce\x59\x5c\xcc\x89\x77\x86\xd9\xdc\xbf\x49\x55\x99\xcf\xd9"
+    "\x01\x57\x18\x6a\x46\xec\x80\x0a\x67\x63\xf1\xc5\x9e\x36\x19\x7e"
+    "\x99\x39\xe9\x00\x80\x9f\x70\x77\xc1\x02\xf8\x88\xca\xaf\x86\x4b"
+    "\x25\x3b\xc4\x1e\xea\x81\x26\x56\xd4\x67\x42\xe4\xea\x42\x76\x9f"
+    "\x89\xb8\x3f", 131
+},
+{
+    5120, 0,
+    "\x9c\xad\xc1\x5f\xed\x8b\x5d\x85\x45\x62\xb2\x6a\x95\x36\xd9\x70"
+    "\x7c\xad\xed\xa9\xb1\x43\x97\x8f\x31\x9a\xb3\x42\x30\x53\x58\x33"
+    "\xac\xc6\x1c\x8f\xdc\x11\x4a\x20\x10\xce\x80\x38\xc8\x53\xe1\x21"
+    "\xe1\x54\x49\x85\x13\x3f\xcc\xdd\x0a\x2d\x50\x7e\x8e\x61\x5e\x61"
+    "\x1e\x9a\x0b\xa4\xf4\x79\x15\xf4\x9e\x53\xd7\x21\x81\x6a\x91\x98"
+    "\xe8\xb3\x0f\x12\xd2\x0e\xc3\x68\x99\x89\x17\x5f\x1b\xf7\xa3\x00"
+    "\xee\xe0\xd9\x32\x1f\xad\x8d\xa2\x32\xec\xe6\xef\xb8\xe9\xfd\x81"
+    "\xb4\x2a\xd1\x61\xf6\xb9\x55\x0a\x06\x9e\x66\xb1\x1b\x40\x48\x7a"
+    "\x5f\x50\x59", 131
+},
+{
+    5120, 1,
+    "\x2c\x49\x3e\x48\xe9\xb9\xbf\x31\xe0\x55\x3a\x22\xb2\x35\x03\xc0"
+    "\xa3\x38\x8f\x03\x5c\xec\xe6\x8e\xb4\x38\xd2\x2f\xa1\x94\x3e\x20"
+    "\x9b\x4d\xc9\x20\x9c\xd8\x0c\xe7\xc1\xf7\xc9\xa7\x44\x65\x8e\x7e"
+    "\x28\x84\x65\x71\x7a\xe6\xe5\x6d\x54\x63\xd4\xf8\x0c\xdb\x2e\xf5"
+    "\x64\x95\xf6\xa4\xf5\x48\x7f\x69\x74\x9a\xf0\xc3\x4c\x2c\xdf\xa8"
+    "\x57\xf3\x05\x6b\xf8\xd8\x07\x33\x6a\x14\xd7\xb8\x9b\xf6\x2b\xef"
+    "\x2f\xb5\x4f\x9a\xf6\xa5\x46\xf8\x18\xdc\x1e\x98\xb9\xe0\x7f\x8a"
+    "\x58\x34\xda\x50\xfa\x28\xfb\x58\x74\xaf\x91\xbf\x06\x02\x0d\x1b"
+    "\xf0\x12\x0e", 131
+},
+{
+    5121, 0,
+    "\x62\x8b\xd2\xcb\x20\x04\x69\x4a\xda\xab\x7b\xbd\x77\x8a\x25\xdf"
+    "\x25\xc4\x7b\x9d\x41\x55\xa5\x5f\x8f\xbd\x79\xf2\xfe\x15\x4c\xff"
+    "\x96\xad\xaa\xb0\x61\x3a\x61\x46\xcd\xaa\xbe\x49\x8c\x3a\x94\xe5"
+    "\x29\xd3\xfc\x1d\xa2\xbd\x08\xed\xf5\x4e\xd6\x4d\x40\xdc\xd6\x77"
+    "\x76\x47\xea\xc5\x1d\x82\x77\xd7\x02\x19\xa9\x69\x43\x34\xa6\x8b"
+    "\xc8\xf0\xf2\x3e\x20\xb0\xff\x70\xad\xa6\xf8\x44\x54\x2d\xfa\x32"
+    "\xcd\x42\x04\xca\x18\x46\xef\x76\xd8\x11\xcd\xb2\x96\xf6\x5e\x26"
+    "\x02\x27\xf4\x77\xaa\x7a\xa0\x08\xba\xc8\x78\xf7\x22\x57\x48\x4f"
+    "\x2b\x6c\x95", 131
+},
+{
+    5121, 1,
+    "\x6c\xcf\x1c\x34\x75\x3e\x7a\x04\x4d\xb8\x07\x98\xec\xd0\x78\x2a"
+    "\x8f\x76\xf3\x35\x63\xac\xca\xdd\xbf\xbb\x2e\x0e\xa4\xb2\xd0\x24"
+    "\x0d\x07\xe6\x3f\x13\x66\x7a\x8d\x14\x90\xe5\xe0\x4f\x13\xeb\x61"
+    "\x7a\xea\x16\xa8\xc8\xa5\xaa\xed\x1e\xf6\xfb\xde\x1b\x05\x15\xe3"
+    "\xc8\x10\x50\xb3\x61\xaf\x6e\xad\x12\x60\x32\x99\x82\x90\xb5\x63"
+    "\xe3\xca\xdd\xea\xeb\xfa\xb5\x92\xe1\x55\xf2\xe1\x61\xfb\x7c\xba"
+    "\x93\x90\x92\x13\x3f\x23\xf9\xe6\x52\x45\xe5\x8e\xc2\x34\x57\xb7"
+    "\x8a\x2e\x8a\x12\x55\x88\xaa\xd6\xe0\x7d\x7f\x11\xa8\x5b\x88\xd3"
+    "\x75\xb7\x2d", 131
+},
+{
+    8192, 0,
+    "\xaa\xe7\x92\x48\x4c\x8e\xfe\x4f\x19\xe2\xca\x7d\x37\x1d\x8c\x46"
+    "\x7f\xfb\x10\x74\x8d\x8a\x5a\x1a\xe5\x79\x94\x8f\x71\x8a\x2a\x63"
+    "\x5f\xe5\x1a\x27\xdb\x04\x5a\x56\x7c\x1a\xd5\x1b\xe5\xaa\x34\xc0"
+    "\x1c\x66\x51\xc4\xd9\xb5\xb5\xac\x5d\x0f\xd5\x8c\xf1\x8d\xd6\x1a"
+    "\x47\x77\x85\x66\xb7\x97\xa8\xc6\x7d\xf7\xb1\xd6\x0b\x97\xb1\x92"
+    "\x88\xd2\xd8\x77\xbb\x2d\xf4\x17\xac\xe0\x09\xdc\xb0\x24\x1c\xa1"
+    "\x25\x7d\x62\x71\x2b\x6a\x40\x43\xb4\xff\x33\xf6\x90\xd8\x49\xda"
+    "\x91\xea\x3b\xf7\x11\xed\x58\x3c\xb7\xb7\xa7\xda\x28\x39\xba\x71"
+    "\x30\x9b\xbf", 131
+},
+{
+    8192, 1,
+    "\xdc\x96\x37\xc8\x84\x5a\x77\x0b\x4c\xbf\x76\xb8\xda\xec\x0e\xeb"
+    "\xf7\xdc\x2e\xac\x11\x49\x85\x17\xf0\x8d\x44\xc8\xfc\x00\xd5\x8a"
+    "\x48\x34\x46\x41\x59\xdc\xbc\x12\xa0\xba\x0c\x6d\x6e\xb4\x1b\xac"
+    "\x0e\xd6\x58\x5c\xab\xfe\x0a\xca\x36\xa3\x75\xe6\xc5\x48\x0c\x22"
+    "\xaf\xdc\x40\x78\x5c\x17\x0f\x5a\x6b\x8a\x11\x07\xdb\xee\x28\x23"
+    "\x18\xd0\x0d\x91\x5a\xc9\xed\x11\x43\xad\x40\x76\x5e\xc1\x20\x04"
+    "\x2e\xe1\x21\xcd\x2b\xaa\x36\x25\x0c\x61\x8a\xda\xf9\xe2\x72\x60"
+    "\xfd\xa2\xf9\x4d\xea\x8f\xb6\xf0\x8c\x04\xf8\xf1\x0c\x78\x29\x2a"
+    "\xa4\x61\x02", 131
+},
+{
+    8193, 0,
+    "\xba\xb6\xc0\x9c\xb8\xce\x8c\xf4\x59\x26\x13\x98\xd2\xe7\xae\xf3"
+    "\x57\x00\xbf\x48\x81\x16\xce\xb9\x4a\x36\xd0\xf5\xf1\xb7\xbc\x3b"
+    "\xb2\x28\x2a\xa6\x9b\xe0\x89\x35\x9e\xa1\x15\x4b\x9a\x92\x86\xc4"
+    "\xa5\x6a\xf4\xde\x97\x5a\x9a\xa4\xa5\xc4\x97\x65\x49\x14\xd2\x79"
+    "\xbe\xa6\x0b\xb6\xd2\xcf\x72\x25\xa2\xfa\x0f\xf5\xef\x56\xbb\xe4"
+    "\xb1\x49\xf3\xed\x15\x86\x0f\x78\xb4\xe2\xad\x04\xe1\x58\xe3\x75"
+    "\xc1\xe0\xc0\xb5\x51\xcd\x7d\xfc\x82\xf1\xb1\x55\xc1\x1b\x6b\x3e"
+    "\xd5\x1e\xc9\xed\xb3\x0d\x13\x36\x53\xbb\x57\x09\xd1\xdb\xd5\x5f"
+    "\x4e\x1f\xf6", 131
+},
+{
+    8193, 1,
+    "\x95\x4a\x2a\x75\x42\x0c\x8d\x65\x47\xe3\xba\x5b\x98\xd9\x63\xe6"
+    "\xfa\x64\x91\xad\xdc\x8c\x02\x31\x89\xcc\x51\x98\x21\xb4\xa1\xf5"
+    "\xf0\x32\x28\x64\x8f\xd9\x83\xae\xf0\x45\xc2\xfa\x82\x90\x93\x4b"
+    "\x08\x66\xb6\x15\xf5\x85\x14\x95\x87\xdd\xa2\x29\x90\x39\x96\x53"
+    "\x28\x83\x5a\x2b\x18\xf1\xd6\x3b\x7e\x30\x0f\xc7\x6f\xf2\x60\xb5"
+    "\x71\x83\x9f\xe4\x48\x76\xa4\xea\xe6\x6c\xba\xc8\xc6\x76\x94\x41"
+    "\x1e\xd7\xe0\x9d\xf5\x10\x68\xa2\x2c\x6e\x67\xd6\xd3\xdd\x2c\xca"
+    "\x8f\xf1\x2e\x32\x75\x38\x40\x06\xc8\x0f\x4d\xb6\x80\x23\xf2\x4e"
+    "\xeb\xba\x57", 131
+},
+{
+    16384, 0,
+    "\xf8\x75\xd6\x64\x6d\xe2\x89\x85\x64\x6f\x34\xee\x13\xbe\x9a\x57"
+    "\x6f\xd5\x15\xf7\x6b\x5b\x0a\x26\xbb\x32\x47\x35\x04\x1d\xdd\xe4"
+    "\x9d\x76\x4c\x27\x01\x76\xe5\x3e\x97\xbd\xff\xa5\x8d\x54\x90\x73"
+    "\xf2\xc6\x60\xbe\x0e\x81\x29\x37\x67\xed\x4e\x49\x29\xf9\xad\x34"
+    "\xbb\xb3\x9a\x52\x93\x34\xc5\x7c\x4a\x38\x1f\xfd\x2a\x6d\x4b\xfd"
+    "\xbf\x14\x82\x65\x1b\x17\x2a\xa8\x83\xcc\x13\x40\x8f\xa6\x77\x58"
+    "\xa3\xe4\x75\x03\xf9\x3f\x87\x72\x0a\x31\x77\x32\x5f\x78\x23\x25"
+    "\x1b\x85\x27\x5f\x64\x63\x6a\x8f\x1d\x59\x9c\x2e\x49\x72\x2f\x42"
+    "\xe9\x38\x93", 131
+},
+{
+    16384, 1,
+    "\x9e\x9f\xc4\xeb\x7c\xf0\x81\xea\x7c\x47\xd1\x80\x77\x90\xed\x21"
+    "\x1b\xfe\xc5\x6a\xa2\x5b\xb7\x03\x77\x84\xc1\x3c\x4b\x70\x7b\x0d"
+    "\xf9\xe6\x01\xb1\x01\xe4\xcf\x63\xa4\x04\xdf\xe5\x0f\x2e\x18\x65"
+    "\xbb\x12\xed\xc8\xfc\xa1\x66\x57\x9c\xe0\xc7\x0d\xba\x5a\x5c\x0f"
+    "\xc9\x60\xad\x6f\x37\x72\x18\x34\x16\xa0\x0b\xd2\x9d\x4c\x6e\x65"
+    "\x1e\xa7\x62\x0b\xb1\x00\xc9\x44\x98\x58\xbf\x14\xe1\xdd\xc9\xec"
+    "\xd3\x57\x25\x58\x1c\xa5\xb9\x16\x0d\xe0\x40\x60\x04\x59\x93\xd9"
+    "\x72\x57\x1c\x3e\x8f\x71\xe9\xd0\x49\x6b\xfa\x74\x46\x56\x86\x1b"
+    "\x16\x9d\x65", 131
+},
+{
+    31744, 0,
+    "\x62\xb6\x96\x0e\x1a\x44\xbc\xc1\xeb\x1a\x61\x1a\x8d\x62\x35\xb6"
+    "\xb4\xb7\x8f\x32\xe7\xab\xc4\xfb\x4c\x6c\xdc\xce\x94\x89\x5c\x47"
+    "\x86\x0c\xc5\x1f\x2b\x0c\x28\xa7\xb7\x73\x04\xbd\x55\xfe\x73\xaf"
+    "\x66\x3c\x02\xd3\xf5\x2e\xa0\x53\xba\x43\x43\x1c\xa5\xba\xb7\xbf"
+    "\xea\x2f\x5e\x9d\x71\x21\x77\x0d\x88\xf7\x0a\xe9\x64\x9e\xa7\x13"
+    "\x08\x7d\x19\x14\xf7\xf3\x12\x14\x7e\x24\x7f\x87\xeb\x2d\x4f\xfe"
+    "\xf0\xac\x97\x8b\xf7\xb6\x57\x9d\x57\xd5\x33\x35\x5a\xa2\x0b\x8b"
+    "\x77\xb1\x3f\xd0\x97\x48\x72\x8a\x5c\xc3\x27\xa8\xec\x47\x0f\x40"
+    "\x13\x22\x6f", 131
+},
+{
+    31744, 1,
+    "\xef\xa5\x3b\x38\x9a\xb6\x7c\x59\x3d\xba\x62\x4d\x89\x8d\x0f\x73"
+    "\x53\xab\x99\xe4\xac\x9d\x42\x30\x2e\xe6\x4c\xbf\x99\x39\xa4\x19"
+    "\x3a\x72\x58\xdb\x2d\x9c\xd3\x2a\x7a\x3e\xcf\xce\x46\x14\x41\x14"
+    "\xb1\x5c\x2f\xcb\x68\xa6\x18\xa9\x76\xbd\x74\x51\x5d\x47\xbe\x08"
+    "\xb6\x28\xbe\x42\x0b\x5e\x83\x0f\xad\xe7\xc0\x80\xe3\x51\xa0\x76"
+    "\xfb\xc3\x86\x41\xad\x80\xc7\x36\xc8\xa1\x8f\xe3\xc6\x6c\xe1\x2f"
+    "\x95\xc6\x1c\x24\x62\xa9\x77\x0d\x60\xd0\xf7\x71\x15\xbb\xcd\x37"
+    "\x82\xb5\x93\x01\x6a\x4e\x72\x8d\x4c\x06\xce\xe4\x50\x5c\xb0\xc0"
+    "\x8a\x42\xec", 131
+},
+{
+    102400, 0,
+    "\xbc\x3e\x3d\x41\xa1\x14\x6b\x06\x9a\xbf\xfa\xd3\xc0\xd4\x48\x60"
+    "\xcf\x66\x43\x90\xaf\xce\x4d\x96\x61\xf7\x90\x2e\x79\x43\xe0\x85"
+    "\xe0\x1c\x59\xda\xb9\x08\xc0\x4c\x33\x42\xb8\x16\x94\x1a\x26\xd6"
+    "\x9c\x26\x05\xeb\xee\x5e\xc5\x29\x1c\xc5\x5e\x15\xb7\x61\x46\xe6"
+    "\x74\x5f\x06\x01\x15\x6c\x35\x96\xcb\x75\x06\x5a\x9c\x57\xf3\x55"
+    "\x85\xa5\x2e\x1a\xc7\x0f\x69\x13\x1c\x23\xd6\x11\xce\x11\xee\x4a"
+    "\xb1\xec\x2c\x00\x90\x12\xd2\x36\x64\x8e\x77\xbe\x92\x95\xdd\x04"
+    "\x26\xf2\x9b\x76\x4d\x65\xde\x58\xeb\x7d\x01\xdd\x42\x24\x82\x04"
+    "\xf4\x5f\x8e", 131
+},
+{
+    102400, 1,
+    "\x1c\x35\xd1\xa5\x81\x10\x83\xfd\x71\x19\xf5\xd5\xd1\xba\x02\x7b"
+    "\x4d\x01\xc0\xc6\xc4\x9f\xb6\xff\x2c\xf7\x53\x93\xea\x5d\xb4\xa7"
+    "\xf9\xdb\xdd\x3e\x1d\x81\xdc\xbc\xa3\xba\x24\x1b\xb1\x87\x60\xf2"
+    "\x07\x71\x0b\x75\x18\x46\xfa\xae\xb9\xdf\xf8\x26\x27\x10\x99\x9a"
+    "\x59\xb2\xaa\x1a\xca\x29\x8a\x03\x2d\x94\xea\xcf\xad\xf1\xaa\x19"
+    "\x24\x18\xeb\x54\x80\x8d\xb2\x3b\x56\xe3\x42\x13\x26\x6a\xa0\x84"
+    "\x99\xa1\x6b\x35\x4f\x01\x8f\xc4\x96\x7d\x05\xf8\xb9\xd2\xad\x87"
+    "\xa7\x27\x83\x37\xbe\x96\x93\xfc\x63\x8a\x3b\xfd\xbe\x31\x45\x74"
+    "\xee\x6f\xc4", 131
+},
+{
+    1000003, 0,
+    "\xcd\x5a\x32\x72\xe0\x1b\x1a\x2f\x47\xbb\x45\x65\xd8\xd2\x02\xdb"
+    "\x0f\x95\x70\x4d\x32\x55\x0a\x2d\xa6\x1a\x0f\xd3\x63\xd4\xc9\x0d", 32
+},
+{
+    1000003, 1,
+    "\x12\xe8\x96\x02\x38\x29\xe1\x37\x86\x22\x6a\x34\xe1\x78\x13\x06"
+    "\x0e\x63\xe1\xf2\x6b\xb4\xe7\x9f\x20\xde\xd5\x4c\x70\x92\x85\x02", 32
+}
+
+};
+
+#define MAX_IN_LEN 1000003
+#define MAX_OUT_LEN 131
+
+static const char key[] = "whats the Elvish word for friend";
+
+static unsigned char in[MAX_IN_LEN];
+
+/*===----------------------------------------------------------------------===*/
+
+static int check_hash(const struct TEST_VECTOR *test, size_t chunk,
+                      int parallel)
+{
+    struct BLAKE3_PARAMS params;
+    struct HASH_STATE state;
+    unsigned char out[32];
+    size_t pos;
+
+    params.key = key;
+    params.key_len = test->keyed ? 32 : 0;
+    params.parallel = parallel;
+
+    ASSERT_SUCCESS(hash_init(&state, HASH_BLAKE3, &params));
+
+    for (pos = 0; pos < test->in_len; pos += chunk)
+    {
+        size_t len = test->in_len - pos < chunk ? test->in_len - pos : chunk;
+        hash_update(&state, in + pos, len);
+    }
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, 32);
+
+    return 1;
+}
+
+static int check_xof(const struct TEST_VECTOR *test)
+{
+    struct BLAKE3_XOF_STATE xof;
+    struct BLAKE3_STATE state;
+    struct BLAKE3_PARAMS params;
+    unsigned char out[MAX_OUT_LEN];
+
+    params.key = key;
+    params.key_len = test->keyed ? 32 : 0;
+    params.parallel = 0;
+
+    ASSERT_SUCCESS(blake3_init(&state, &params));
+    blake3_update(&state, in, test->in_len);
+    blake3_xof_init(&xof, &state);
+
+    /* Read in pieces which straddle the output blocks. */
+    blake3_xof_read(&xof, out, 1);
+    blake3_xof_read(&xof, out + 1, 70);
+    blake3_xof_read(&xof, out + 71, test->out_len - 71);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* And backwards, seeking to each block. */
+    blake3_xof_seek(&xof, 128);
+    blake3_xof_read(&xof, out + 128, test->out_len - 128);
+    blake3_xof_seek(&xof, 64);
+    blake3_xof_read(&xof, out + 64, 64);
+    blake3_xof_seek(&xof, 0);
+    blake3_xof_read(&xof, out, 64);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_blake3(void);
+int test_vectors_blake3(void)
+{
+#if WITH_BLAKE3
+    struct BLAKE3_PARAMS params;
+    struct HASH_STATE state;
+    size_t t;
+
+    if (!prim_avail(HASH_BLAKE3))
+        return 1;
+
+    for (t = 0; t < MAX_IN_LEN; ++t)
+        in[t] = (unsigned char)(t % 251);
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+    {
+        if (!check_hash(tests + t, MAX_IN_LEN, 0)) return 0;
+        if (!check_hash(tests + t, MAX_IN_LEN, 1)) return 0;
+        if (!check_hash(tests + t, 37, 0)) return 0;
+        if (!check_hash(tests + t, 5000, 1)) return 0;
+
+        if (tests[t].out_len == MAX_OUT_LEN)
+            if (!check_xof(tests + t)) return 0;
+    }
+
+    /* Keys which are not exactly 32 bytes must be rejected. */
+
+    params.key = key;
+    params.key_len = 31;
+    params.parallel = 0;
+
+    ASSERT_FAILURE(hash_init(&state, HASH_BLAKE3, &params));
+
+    params.key_len = 33;
+
+    ASSERT_FAILURE(hash_init(&state, HASH_BLAKE3, &params));
+#endif
+
+    return 1;
+}
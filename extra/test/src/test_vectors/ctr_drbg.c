@@ -0,0 +1,159 @@
+/*===-- test_vectors/ctr_drbg.c --------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the CTR_DRBG module, for AES-256 without a derivation
+*** function and without prediction resistance. The second output of the
+*** first one is from the NIST DRBGVS (COUNT = 0). The third outputs are
+*** longer and end with a partial block.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_AES
+
+struct TEST_VECTOR
+{
+    const char *seed;
+    const char *personal;
+    size_t personal_len;
+    const char *out1;
+    const char *out2;
+    const char *out3;
+    size_t out3_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    "\xdf\x5d\x73\xfa\xa4\x68\x64\x9e\xdd\xa3\x3b\x5c\xca\x79\xb0\xb0"
+    "\x56\x00\x41\x9c\xcb\x7a\x87\x9d\xdf\xec\x9d\xb3\x2e\xe4\x94\xe5"
+    "\x53\x1b\x51\xde\x16\xa3\x0f\x76\x92\x62\x47\x4c\x73\xbe\xc0\x10",
+    0, 0,
+    "\x0b\x16\x53\x08\x17\x16\x6e\x90\xcf\x76\x3d\x08\x37\x8f\xca\x1e"
+    "\xc0\x1a\x08\x39\x14\x11\x72\x11\xa6\x9b\x1b\xf1\x35\x9f\xbe\x3e"
+    "\x6e\x48\xe5\x46\xce\x7a\xb3\x8f\xc5\xe0\x0e\xb8\x58\xd7\xe4\x5d"
+    "\x5d\x6e\x10\x12\xc5\x8a\x55\x3e\x88\xa6\x5e\xc7\x49\xde\x93\xf9",
+    "\xd1\xc0\x7c\xd9\x5a\xf8\xa7\xf1\x10\x12\xc8\x4c\xe4\x8b\xb8\xcb"
+    "\x87\x18\x9e\x99\xd4\x0f\xcc\xb1\x77\x1c\x61\x9b\xdf\x82\xab\x22"
+    "\x80\xb1\xdc\x2f\x25\x81\xf3\x91\x64\xf7\xac\x0c\x51\x04\x94\xb3"
+    "\xa4\x3c\x41\xb7\xdb\x17\x51\x4c\x87\xb1\x07\xae\x79\x3e\x01\xc5",
+    "\xcd\x66\xea\xab\xef\x90\x0f\x38\xe8\x17\xf9\x21\x1f\xbf\x52\x2a"
+    "\x23\xab\x7d\xea\xfd\x00\x3b\x30\x56\x6e\xc7\xac\x41\xac\xed\x66"
+    "\x35\xb9\x44\x4f\x38\xe0\xac\xd5\x6f\x8b\x19\x22\x36\x4b\x98\x41"
+    "\x1f\xfa\x93\x17\xc6\x98\x4d\x31\x30\xde\x0c\xb9\x7c\x85\x7c\xc2"
+    "\x67\x35\x79\x93\xa8\x53\x8e\xfd\x1a\xd4\x3c\xbd\x97\xb7\xdd\xd4"
+    "\x3e\xd7\x79\x04\x46\x80\xe7\x70\x4f\xf9\x67\x2c\xc6\x9e\x5d\x09"
+    "\x85\x84\x53\xa2\x8d\x78\xa8\x61\xab\x9d\x02\xb9\x4b\x43\xb0\xfe"
+    "\x31\xf5\x11\x4a\xe9\xd1\x29\x06\x18\x2b\xe8\x62\xf2\x19\x62\xf3"
+    "\x64\x29\xb6\x1e\x7e\x25\xd4\xdb\x6a\x83\x44\x72\x53\xd6\xea\xcb"
+    "\xb1\xaa\x5f\xf9\x84\x9e\xda\x8a\x40\x5a\x0a\xa5\x60\x59\xaf\x1f"
+    "\xd5\x29\x51\x02\xee\x51\xfe\x8b\x15\xc8\x95\x97\x5c\xdc\x6b\x96"
+    "\x44\x20\x77\xde\xba\x71\x67\xe2\x7c\x11\xaf\xad\xa0\x66\x11\x1c"
+    "\x94\xba\x88\xcd\x89\x49\x0b\xec", 200
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f",
+    0, 0,
+    "\x06\x15\x50\x23\x4d\x15\x8c\x5e\xc9\x55\x95\xfe\x04\xef\x7a\x25"
+    "\x76\x7f\x2e\x24\xcc\x2b\xc4\x79\xd0\x9d\x86\xdc\x9a\xbc\xfd\xe7"
+    "\x05\x6a\x8c\x26\x6f\x9e\xf9\x7e\xd0\x85\x41\xdb\xd2\xe1\xff\xa1"
+    "\x98\x10\xf5\x39\x2d\x07\x62\x76\xef\x41\x27\x7c\x3a\xb6\xe9\x4a",
+    "\x04\x56\x2a\xd3\x5e\x8e\xca\xfa\xaf\xda\x16\x98\x1c\xda\xa1\x47"
+    "\x60\x6b\xee\xa6\x28\x01\x34\x2a\xf1\x3c\x8b\x55\x35\xf7\x2f\x94"
+    "\x95\xb7\x43\x17\xc7\x62\xf0\xad\xab\x7a\xbe\x71\x07\x97\x61\x21"
+    "\x76\xb6\x1b\x0e\x20\x83\x98\x11\x3c\xf9\xc1\x70\x15\x7b\xc7\x5f",
+    "\x8a\xe8\x0e\x03\xd2\x37\xb8\xb1\x58\x09\x51\x1e\x08\xd9\x23\x2c"
+    "\x8d\x75\xb8\x83\x7a\x34\x24\x9d\xf9\x0b\x8e\x3d\x89\xfd\xaa\x4d"
+    "\x6f\xff\x5d\xc7\x9d\x68\xc3\xbb\x53\xbb\x4a\xcd\xfa\xc8\x4c\x72"
+    "\x6f\xff\xb4\x26\x5c\x6d\x9d\xe6\x25\x35\x21\x84\xb9\xef\x51\x96"
+    "\xb6\x5b\xe2\x11\xaa\x4f\x67\x39\x90\x4b\x21\x7a\xf7\xea\xd6\x04"
+    "\xfc\x3b\xfc\xaf\xca\x43\x9c\x39\x1b\xb6\x28\xb4\xec\x47\x79\xd0"
+    "\xbe\x4a\x17\xcb\xf8\x1b\x71\x2a\x14\xb9\xb0\x23\xa8\x06\xa5\x68"
+    "\x6e\xe3\xb5\x9b\xf6\x78\xa4\xc3\xf4\x00\x3f\x30\xb0\x61\x0f\xe0"
+    "\x43\x00\x16\x92\x90\xf4\x97\xd2\x75\xac\xe5\x26\xdf\xa8\x88\x8d"
+    "\x77\xb3\x3d\x99\xf1\xb4\x35\x96\x6d\xf0\xaf\x5c\x18\x98\x33\x3e"
+    "\x30\x5a\x2e\xaa\x40\x7d\x4a\x19\x39\x38\xa0\x2e\x22\x42\x66\xc3"
+    "\xb8\x3b\x19\xd4\xec\x01\x9d\x60\x7f\x4c\x15\x89\x3f\xf6\x40\x93"
+    "\xa2\x26\xe3\x2a\x2d\xc6\x3b\x8b", 200
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f",
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+    "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+    "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f", 48,
+    "\x5d\xe6\xaa\x50\x02\x2f\x01\xdf\x04\x5b\x3f\xda\x58\xa2\xad\x77"
+    "\x91\x32\xf6\x6f\xb0\x4c\xe0\xc2\xb0\xfa\x07\x21\xf6\x86\xd3\xe4"
+    "\x79\xb1\x88\x65\x9e\x08\xdc\x83\x10\x05\x0d\x9a\x2e\xb9\x58\xdf"
+    "\x87\x73\x0c\x9a\xe9\x46\x11\x89\xc5\xef\x73\x00\xde\x0f\x75\x2c",
+    "\x7b\xcf\x87\xb8\x64\xdd\xd8\xd7\x18\x57\x11\x2b\x43\x95\x3d\xb4"
+    "\xc0\x9f\x09\x85\xf3\xd4\x9e\x81\x5f\x04\xb7\x96\xbc\x72\x77\xdf"
+    "\xc3\x62\x51\x2a\x53\x42\x4d\x28\x76\x55\x8f\x4a\xc0\x25\x4d\x94"
+    "\x43\xc2\xe2\x72\x0d\x2b\x4a\x7a\x74\xea\x8a\x35\x70\xb0\x28\x80",
+    "\x34\x64\x91\xe4\xcf\x7d\x11\x9e\x16\xf3\xab\x1f\x82\xf1\xe6\x37"
+    "\x76\x9c\x3f\x53\xd7\x3c\x6f\x19\xd1\x91\x4c\x66\xb4\xe4\x2e\x72"
+    "\x1b\xdb\xb2\xf8\x7c\x6d\xa4\xcc\x25\x0d\x90\x95\x80\x36\xe2\xd9"
+    "\xd1\x68\x8d\x43\xf4\xd6\x3b\xc0\x1c\x02\x95\x58\x61\x8f\x5f\x08"
+    "\xbd\x52\x1a\xcb\x0b\xba\xcd\x2e\x80\xf9\xf9\x91\x0b\x81\x51\x63"
+    "\x72\x54\x67\xfb\x53\xbf\xdc\x75\xca\xcc\x86\x9c\x0b\x0d\xf9\xfa"
+    "\x21\x9e\xf1\x79\x0c\x2d\x23\x39\xfc\x92\xcb\x42\x8e\x42\xf5\x3d"
+    "\x70\x4b\xc0\x3e\x5d\x76\x57\x1a\x99\x0c\xb8\x10\x77\xbd\xd8\x1a"
+    "\x9e\x04\x5f\x1c\x38\xf5\x1c\xb5\xc7\xbe\x23\xb2\xb5\xae\x71\x6d"
+    "\xd8\x4d\xa5\xc3\x49\x7f\xe6\x65\xc5\x48\x9e\x2d\xcd\xf7\x7e\xcd"
+    "\x7d\xba\x78\xad\x40\xa2\x8a\x19\xd3\xa7\x8f\x27\x4f\x88\x6d\x5e"
+    "\x8c\xb6\xaf\x8e\x66\x8c\xfa\x19\xc6\xd1\x42\xd3\x3c\xcd\x0b\x2e"
+    "\x41\x99\x72\x0c\x97\x37\x7e\xb7", 200
+}
+};
+
+#define MAX_OUT_LEN 200
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct CTR_DRBG_CTX ctx;
+
+    if (!prim_avail(BLOCK_AES))
+        return 1;
+
+    ASSERT_SUCCESS(ctr_drbg_seed(&ctx, test->seed, CTR_DRBG_SEED_LEN,
+                                 test->personal, test->personal_len));
+
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out, 64));
+    ASSERT_BUF_EQ(out, test->out1, 64);
+
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out, 64));
+    ASSERT_BUF_EQ(out, test->out2, 64);
+
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out, test->out3_len));
+    ASSERT_BUF_EQ(out, test->out3, test->out3_len);
+
+    ctr_drbg_final(&ctx);
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_ctr_drbg(void);
+int test_vectors_ctr_drbg(void)
+{
+#if WITH_AES
+    size_t t;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+#endif
+
+    return 1;
+}
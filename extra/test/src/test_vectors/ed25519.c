@@ -0,0 +1,120 @@
+/*===-- test_vectors/ed25519.c ---------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the Ed25519 module, from RFC 8032.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_SHA512
+
+struct TEST_VECTOR
+{
+    const char *priv, *pub;
+    const char *msg;
+    size_t len;
+    const char *sig;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+    {
+        /* RFC 8032, TEST 1 */
+        "\x9d\x61\xb1\x9d\xef\xfd\x5a\x60\xba\x84\x4a\xf4\x92\xec\x2c\xc4"
+        "\x44\x49\xc5\x69\x7b\x32\x69\x19\x70\x3b\xac\x03\x1c\xae\x7f\x60",
+        "\xd7\x5a\x98\x01\x82\xb1\x0a\xb7\xd5\x4b\xfe\xd3\xc9\x64\x07\x3a"
+        "\x0e\xe1\x72\xf3\xda\xa6\x23\x25\xaf\x02\x1a\x68\xf7\x07\x51\x1a",
+        "", 0,
+        "\xe5\x56\x43\x00\xc3\x60\xac\x72\x90\x86\xe2\xcc\x80\x6e\x82\x8a"
+        "\x84\x87\x7f\x1e\xb8\xe5\xd9\x74\xd8\x73\xe0\x65\x22\x49\x01\x55"
+        "\x5f\xb8\x82\x15\x90\xa3\x3b\xac\xc6\x1e\x39\x70\x1c\xf9\xb4\x6b"
+        "\xd2\x5b\xf5\xf0\x59\x5b\xbe\x24\x65\x51\x41\x43\x8e\x7a\x10\x0b"
+    },
+    {
+        /* RFC 8032, TEST 2 */
+        "\x4c\xcd\x08\x9b\x28\xff\x96\xda\x9d\xb6\xc3\x46\xec\x11\x4e\x0f"
+        "\x5b\x8a\x31\x9f\x35\xab\xa6\x24\xda\x8c\xf6\xed\x4f\xb8\xa6\xfb",
+        "\x3d\x40\x17\xc3\xe8\x43\x89\x5a\x92\xb7\x0a\xa7\x4d\x1b\x7e\xbc"
+        "\x9c\x98\x2c\xcf\x2e\xc4\x96\x8c\xc0\xcd\x55\xf1\x2a\xf4\x66\x0c",
+        "\x72", 1,
+        "\x92\xa0\x09\xa9\xf0\xd4\xca\xb8\x72\x0e\x82\x0b\x5f\x64\x25\x40"
+        "\xa2\xb2\x7b\x54\x16\x50\x3f\x8f\xb3\x76\x22\x23\xeb\xdb\x69\xda"
+        "\x08\x5a\xc1\xe4\x3e\x15\x99\x6e\x45\x8f\x36\x13\xd0\xf1\x1d\x8c"
+        "\x38\x7b\x2e\xae\xb4\x30\x2a\xee\xb0\x0d\x29\x16\x12\xbb\x0c\x00"
+    },
+    {
+        /* RFC 8032, TEST 3 */
+        "\xc5\xaa\x8d\xf4\x3f\x9f\x83\x7b\xed\xb7\x44\x2f\x31\xdc\xb7\xb1"
+        "\x66\xd3\x85\x35\x07\x6f\x09\x4b\x85\xce\x3a\x2e\x0b\x44\x58\xf7",
+        "\xfc\x51\xcd\x8e\x62\x18\xa1\xa3\x8d\xa4\x7e\xd0\x02\x30\xf0\x58"
+        "\x08\x16\xed\x13\xba\x33\x03\xac\x5d\xeb\x91\x15\x48\x90\x80\x25",
+        "\xaf\x82", 2,
+        "\x62\x91\xd6\x57\xde\xec\x24\x02\x48\x27\xe6\x9c\x3a\xbe\x01\xa3"
+        "\x0c\xe5\x48\xa2\x84\x74\x3a\x44\x5e\x36\x80\xd7\xdb\x5a\xc3\xac"
+        "\x18\xff\x9b\x53\x8d\x16\xf2\x90\xae\x67\xf7\x60\x98\x4d\xc6\x59"
+        "\x4a\x7c\x15\xe9\x71\x6e\xd2\x8d\xc0\x27\xbe\xce\xea\x1e\xc4\x0a"
+    },
+    {
+        /* RFC 8032, TEST SHA(abc) */
+        "\x83\x3f\xe6\x24\x09\x23\x7b\x9d\x62\xec\x77\x58\x75\x20\x91\x1e"
+        "\x9a\x75\x9c\xec\x1d\x19\x75\x5b\x7d\xa9\x01\xb9\x6d\xca\x3d\x42",
+        "\xec\x17\x2b\x93\xad\x5e\x56\x3b\xf4\x93\x2c\x70\xe1\x24\x50\x34"
+        "\xc3\x54\x67\xef\x2e\xfd\x4d\x64\xeb\xf8\x19\x68\x34\x67\xe2\xbf",
+        "\xdd\xaf\x35\xa1\x93\x61\x7a\xba\xcc\x41\x73\x49\xae\x20\x41\x31"
+        "\x12\xe6\xfa\x4e\x89\xa9\x7e\xa2\x0a\x9e\xee\xe6\x4b\x55\xd3\x9a"
+        "\x21\x92\x99\x2a\x27\x4f\xc1\xa8\x36\xba\x3c\x23\xa3\xfe\xeb\xbd"
+        "\x45\x4d\x44\x23\x64\x3c\xe8\x0e\x2a\x9a\xc9\x4f\xa5\x4c\xa4\x9f", 64,
+        "\xdc\x2a\x44\x59\xe7\x36\x96\x33\xa5\x2b\x1b\xf2\x77\x83\x9a\x00"
+        "\x20\x10\x09\xa3\xef\xbf\x3e\xcb\x69\xbe\xa2\x18\x6c\x26\xb5\x89"
+        "\x09\x35\x1f\xc9\xac\x90\xb3\xec\xfd\xfb\xc7\xc6\x64\x31\xe0\x30"
+        "\x3d\xca\x17\x9c\x13\x8a\xc1\x7a\xd9\xbe\xf1\x17\x73\x31\xa7\x04"
+    }
+};
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char calc_pub[32], calc_sig[64];
+
+    ed25519_pub(calc_pub, test->priv);
+
+    ASSERT_BUF_EQ(calc_pub, test->pub, 32);
+
+    ed25519_sign(calc_sig, test->priv, test->msg, test->len);
+
+    ASSERT_BUF_EQ(calc_sig, test->sig, 64);
+
+    ASSERT_SUCCESS(ed25519_verify(test->sig, test->pub,
+                                  test->msg, test->len));
+
+    calc_sig[63] ^= 0x01;
+
+    ASSERT_FAILURE(ed25519_verify(calc_sig, test->pub,
+                                  test->msg, test->len));
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_ed25519(void);
+int test_vectors_ed25519(void)
+{
+#if WITH_SHA512
+    size_t t;
+
+    if (!prim_avail(HASH_SHA512))
+        return 1;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+#endif
+
+    return 1;
+}
@@ -20333,10 +20333,378 @@ static const struct TEST_VECTOR tests[] =
     "\xf1\x67\xce\x51\x82\x4c\xaf\x0b\x83\x63\xde\x62\x88\x55\xc8\xaa"
     "\x64\xe1\x88\x8b\x26\x13\x71\x66\xd0\xb9\x0a\xc2\x00\x0f\x7d\x6a", 32,
     HASH_SHA256
+},
+{
+    "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b"
+    "\x0b\x0b\x0b\x0b", 20,
+    "Hi There", 8,
+    "\x87\xaa\x7c\xde\xa5\xef\x61\x9d\x4f\xf0\xb4\x24\x1a\x1d\x6c\xb0"
+    "\x23\x79\xf4\xe2\xce\x4e\xc2\x78\x7a\xd0\xb3\x05\x45\xe1\x7c\xde"
+    "\xda\xa8\x33\xb7\xd6\xb8\xa7\x02\x03\x8b\x27\x4e\xae\xa3\xf4\xe4"
+    "\xbe\x9d\x91\x4e\xeb\x61\xf1\x70\x2e\x69\x6c\x20\x3a\x12\x68\x54", 64,
+    HASH_SHA512
+},
+{
+    "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b"
+    "\x0b\x0b\x0b\x0b", 20,
+    "Hi There", 8,
+    "\xaf\xd0\x39\x44\xd8\x48\x95\x62\x6b\x08\x25\xf4\xab\x46\x90\x7f"
+    "\x15\xf9\xda\xdb\xe4\x10\x1e\xc6\x82\xaa\x03\x4c\x7c\xeb\xc5\x9c"
+    "\xfa\xea\x9e\xa9\x07\x6e\xde\x7f\x4a\xf1\x52\xe8\xb2\xfa\x9c\xb6", 48,
+    HASH_SHA384
+},
+{
+    "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b"
+    "\x0b\x0b\x0b\x0b", 20,
+    "Hi There", 8,
+    "\x9f\x91\x26\xc3\xd9\xc3\xc3\x30\xd7\x60\x42\x5c\xa8\xa2\x17\xe3"
+    "\x1f\xea\xe3\x1b\xfe\x70\x19\x6f\xf8\x16\x42\xb8\x68\x40\x2e\xab", 32,
+    HASH_SHA512_256
+},
+{
+    "\x4a\x65\x66\x65", 4,
+    "what do ya want for nothing?", 28,
+    "\x16\x4b\x7a\x7b\xfc\xf8\x19\xe2\xe3\x95\xfb\xe7\x3b\x56\xe0\xa3"
+    "\x87\xbd\x64\x22\x2e\x83\x1f\xd6\x10\x27\x0c\xd7\xea\x25\x05\x54"
+    "\x97\x58\xbf\x75\xc0\x5a\x99\x4a\x6d\x03\x4f\x65\xf8\xf0\xe6\xfd"
+    "\xca\xea\xb1\xa3\x4d\x4a\x6b\x4b\x63\x6e\x07\x0a\x38\xbc\xe7\x37", 64,
+    HASH_SHA512
+},
+{
+    "\x4a\x65\x66\x65", 4,
+    "what do ya want for nothing?", 28,
+    "\xaf\x45\xd2\xe3\x76\x48\x40\x31\x61\x7f\x78\xd2\xb5\x8a\x6b\x1b"
+    "\x9c\x7e\xf4\x64\xf5\xa0\x1b\x47\xe4\x2e\xc3\x73\x63\x22\x44\x5e"
+    "\x8e\x22\x40\xca\x5e\x69\xe2\xc7\x8b\x32\x39\xec\xfa\xb2\x16\x49", 48,
+    HASH_SHA384
+},
+{
+    "\x4a\x65\x66\x65", 4,
+    "what do ya want for nothing?", 28,
+    "\x6d\xf7\xb2\x46\x30\xd5\xcc\xb2\xee\x33\x54\x07\x08\x1a\x87\x18"
+    "\x8c\x22\x14\x89\x76\x8f\xa2\x02\x05\x13\xb2\xd5\x93\x35\x94\x56", 32,
+    HASH_SHA512_256
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa", 20,
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd", 50,
+    "\xfa\x73\xb0\x08\x9d\x56\xa2\x84\xef\xb0\xf0\x75\x6c\x89\x0b\xe9"
+    "\xb1\xb5\xdb\xdd\x8e\xe8\x1a\x36\x55\xf8\x3e\x33\xb2\x27\x9d\x39"
+    "\xbf\x3e\x84\x82\x79\xa7\x22\xc8\x06\xb4\x85\xa4\x7e\x67\xc8\x07"
+    "\xb9\x46\xa3\x37\xbe\xe8\x94\x26\x74\x27\x88\x59\xe1\x32\x92\xfb", 64,
+    HASH_SHA512
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa", 20,
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd", 50,
+    "\x88\x06\x26\x08\xd3\xe6\xad\x8a\x0a\xa2\xac\xe0\x14\xc8\xa8\x6f"
+    "\x0a\xa6\x35\xd9\x47\xac\x9f\xeb\xe8\x3e\xf4\xe5\x59\x66\x14\x4b"
+    "\x2a\x5a\xb3\x9d\xc1\x38\x14\xb9\x4e\x3a\xb6\xe1\x01\xa3\x4f\x27", 48,
+    HASH_SHA384
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa", 20,
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd\xdd"
+    "\xdd\xdd", 50,
+    "\x22\x90\x06\x39\x1d\x66\xc8\xec\xdd\xf4\x3b\xa5\xcf\x8f\x83\x53"
+    "\x0e\xf2\x21\xa4\xe9\x40\x18\x40\xd1\xbe\xad\x51\x37\xc8\xa2\xea", 32,
+    HASH_SHA512_256
+},
+{
+    "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10"
+    "\x11\x12\x13\x14\x15\x16\x17\x18\x19", 25,
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd", 50,
+    "\xb0\xba\x46\x56\x37\x45\x8c\x69\x90\xe5\xa8\xc5\xf6\x1d\x4a\xf7"
+    "\xe5\x76\xd9\x7f\xf9\x4b\x87\x2d\xe7\x6f\x80\x50\x36\x1e\xe3\xdb"
+    "\xa9\x1c\xa5\xc1\x1a\xa2\x5e\xb4\xd6\x79\x27\x5c\xc5\x78\x80\x63"
+    "\xa5\xf1\x97\x41\x12\x0c\x4f\x2d\xe2\xad\xeb\xeb\x10\xa2\x98\xdd", 64,
+    HASH_SHA512
+},
+{
+    "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10"
+    "\x11\x12\x13\x14\x15\x16\x17\x18\x19", 25,
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd", 50,
+    "\x3e\x8a\x69\xb7\x78\x3c\x25\x85\x19\x33\xab\x62\x90\xaf\x6c\xa7"
+    "\x7a\x99\x81\x48\x08\x50\x00\x9c\xc5\x57\x7c\x6e\x1f\x57\x3b\x4e"
+    "\x68\x01\xdd\x23\xc4\xa7\xd6\x79\xcc\xf8\xa3\x86\xc6\x74\xcf\xfb", 48,
+    HASH_SHA384
+},
+{
+    "\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f\x10"
+    "\x11\x12\x13\x14\x15\x16\x17\x18\x19", 25,
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd\xcd"
+    "\xcd\xcd", 50,
+    "\x36\xd6\x0c\x8a\xa1\xd0\xbe\x85\x6e\x10\x80\x4c\xf8\x36\xe8\x21"
+    "\xe8\x73\x3c\xba\xfe\xae\x87\x63\x05\x89\xfd\x0b\x9b\x0a\x2f\x4c", 32,
+    HASH_SHA512_256
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+    "\x80\xb2\x42\x63\xc7\xc1\xa3\xeb\xb7\x14\x93\xc1\xdd\x7b\xe8\xb4"
+    "\x9b\x46\xd1\xf4\x1b\x4a\xee\xc1\x12\x1b\x01\x37\x83\xf8\xf3\x52"
+    "\x6b\x56\xd0\x37\xe0\x5f\x25\x98\xbd\x0f\xd2\x21\x5d\x6a\x1e\x52"
+    "\x95\xe6\x4f\x73\xf6\x3f\x0a\xec\x8b\x91\x5a\x98\x5d\x78\x65\x98", 64,
+    HASH_SHA512
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+    "\x4e\xce\x08\x44\x85\x81\x3e\x90\x88\xd2\xc6\x3a\x04\x1b\xc5\xb4"
+    "\x4f\x9e\xf1\x01\x2a\x2b\x58\x8f\x3c\xd1\x1f\x05\x03\x3a\xc4\xc6"
+    "\x0c\x2e\xf6\xab\x40\x30\xfe\x82\x96\x24\x8d\xf1\x63\xf4\x49\x52", 48,
+    HASH_SHA384
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+    "\x87\x12\x3c\x45\xf7\xc5\x37\xa4\x04\xf8\xf4\x7c\xdb\xed\xda\x1f"
+    "\xc9\xbe\xc6\x0e\xeb\x97\x19\x82\xce\x7e\xf1\x0e\x77\x4e\x65\x39", 32,
+    HASH_SHA512_256
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "This is a test using a larger than block-size key and a larger t"
+    "han block-size data. The key needs to be hashed before being use"
+    "d by the HMAC algorithm.", 152,
+    "\xe3\x7b\x6a\x77\x5d\xc8\x7d\xba\xa4\xdf\xa9\xf9\x6e\x5e\x3f\xfd"
+    "\xde\xbd\x71\xf8\x86\x72\x89\x86\x5d\xf5\xa3\x2d\x20\xcd\xc9\x44"
+    "\xb6\x02\x2c\xac\x3c\x49\x82\xb1\x0d\x5e\xeb\x55\xc3\xe4\xde\x15"
+    "\x13\x46\x76\xfb\x6d\xe0\x44\x60\x65\xc9\x74\x40\xfa\x8c\x6a\x58", 64,
+    HASH_SHA512
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "This is a test using a larger than block-size key and a larger t"
+    "han block-size data. The key needs to be hashed before being use"
+    "d by the HMAC algorithm.", 152,
+    "\x66\x17\x17\x8e\x94\x1f\x02\x0d\x35\x1e\x2f\x25\x4e\x8f\xd3\x2c"
+    "\x60\x24\x20\xfe\xb0\xb8\xfb\x9a\xdc\xce\xbb\x82\x46\x1e\x99\xc5"
+    "\xa6\x78\xcc\x31\xe7\x99\x17\x6d\x38\x60\xe6\x11\x0c\x46\x52\x3e", 48,
+    HASH_SHA384
+},
+{
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa\xaa"
+    "\xaa\xaa\xaa", 131,
+    "This is a test using a larger than block-size key and a larger t"
+    "han block-size data. The key needs to be hashed before being use"
+    "d by the HMAC algorithm.", 152,
+    "\x6e\xa8\x3f\x8e\x73\x15\x07\x2c\x0b\xda\xa3\x3b\x93\xa2\x6f\xc1"
+    "\x65\x99\x74\x63\x7a\x9d\xb8\xa8\x87\xd0\x6c\x05\xa7\xf3\x5a\x66", 32,
+    HASH_SHA512_256
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+    "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+    "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+    "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f"
+    "\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7a\x7b\x7c\x7d\x7e\x7f", 128,
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f\x3c\x49\x56\x63"
+    "\x70\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8\xe5\xf2\xff\x0c\x19\x26\x33"
+    "\x40\x4d\x5a\x67\x74\x81\x8e\x9b\xa8\xb5\xc2\xcf\xdc\xe9\xf6\x03"
+    "\x10\x1d\x2a\x37\x44\x51\x5e\x6b\x78\x85\x92\x9f\xac\xb9\xc6\xd3"
+    "\xe0\xed\xfa\x07\x14\x21\x2e\x3b\x48\x55\x62\x6f\x7c\x89\x96\xa3"
+    "\xb0\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18\x25\x32\x3f\x4c\x59\x66\x73"
+    "\x80\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8\xf5\x02\x0f\x1c\x29\x36\x43"
+    "\x50\x5d\x6a\x77\x84\x91\x9e\xab\xb8\xc5\xd2\xdf\xec\xf9\x06\x13"
+    "\x20\x2d\x3a\x47\x54\x61\x6e\x7b\x88\x95\xa2\xaf\xbc\xc9\xd6\xe3"
+    "\xf0\xfd\x0a\x17\x24\x31\x3e\x4b\x58\x65\x72\x7f\x8c\x99\xa6\xb3"
+    "\xc0\xcd\xda\xe7\xf4\x01\x0e\x1b\x28\x35\x42\x4f\x5c\x69\x76\x83"
+    "\x90\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8\x05\x12\x1f\x2c\x39\x46\x53"
+    "\x60\x6d\x7a\x87\x94\xa1\xae\xbb\xc8\xd5\xe2\xef\xfc\x09\x16\x23"
+    "\x30\x3d\x4a\x57\x64\x71\x7e\x8b\x98\xa5\xb2\xbf\xcc\xd9\xe6\xf3"
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f", 300,
+    "\xd2\x6d\x3d\x5b\x4d\xb2\xf8\xec\x08\xe0\x34\x50\x72\xab\xa6\xc8"
+    "\x2c\xd7\xc1\xde\xc1\x25\x48\x6e\xd5\x50\xd3\x47\x18\x42\x18\xdd"
+    "\x92\x3c\xcd\xca\x86\x8c\x11\xee\xe3\x4e\xac\x9b\x83\x01\xc8\x20"
+    "\xa3\x85\xb4\x66\x57\x1a\xb4\x97\x07\xa8\xa6\xbb\x94\x06\xfa\xf0", 64,
+    HASH_SHA512
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+    "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+    "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+    "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f"
+    "\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7a\x7b\x7c\x7d\x7e\x7f", 128,
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f\x3c\x49\x56\x63"
+    "\x70\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8\xe5\xf2\xff\x0c\x19\x26\x33"
+    "\x40\x4d\x5a\x67\x74\x81\x8e\x9b\xa8\xb5\xc2\xcf\xdc\xe9\xf6\x03"
+    "\x10\x1d\x2a\x37\x44\x51\x5e\x6b\x78\x85\x92\x9f\xac\xb9\xc6\xd3"
+    "\xe0\xed\xfa\x07\x14\x21\x2e\x3b\x48\x55\x62\x6f\x7c\x89\x96\xa3"
+    "\xb0\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18\x25\x32\x3f\x4c\x59\x66\x73"
+    "\x80\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8\xf5\x02\x0f\x1c\x29\x36\x43"
+    "\x50\x5d\x6a\x77\x84\x91\x9e\xab\xb8\xc5\xd2\xdf\xec\xf9\x06\x13"
+    "\x20\x2d\x3a\x47\x54\x61\x6e\x7b\x88\x95\xa2\xaf\xbc\xc9\xd6\xe3"
+    "\xf0\xfd\x0a\x17\x24\x31\x3e\x4b\x58\x65\x72\x7f\x8c\x99\xa6\xb3"
+    "\xc0\xcd\xda\xe7\xf4\x01\x0e\x1b\x28\x35\x42\x4f\x5c\x69\x76\x83"
+    "\x90\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8\x05\x12\x1f\x2c\x39\x46\x53"
+    "\x60\x6d\x7a\x87\x94\xa1\xae\xbb\xc8\xd5\xe2\xef\xfc\x09\x16\x23"
+    "\x30\x3d\x4a\x57\x64\x71\x7e\x8b\x98\xa5\xb2\xbf\xcc\xd9\xe6\xf3"
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f", 300,
+    "\x35\xb3\xc9\x56\x71\x5b\x0a\xa2\x7a\x16\xd0\x53\x80\x54\x54\x79"
+    "\x47\x74\x26\x04\x99\x9f\xd3\x76\xe7\x19\x78\x85\xe0\x50\x15\xba"
+    "\x28\x86\x66\xd6\x2a\xb1\x77\x44\xe2\x3f\xbe\x3f\x66\xd2\x09\x17", 48,
+    HASH_SHA384
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+    "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+    "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+    "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f"
+    "\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7a\x7b\x7c\x7d\x7e\x7f", 128,
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f\x3c\x49\x56\x63"
+    "\x70\x7d\x8a\x97\xa4\xb1\xbe\xcb\xd8\xe5\xf2\xff\x0c\x19\x26\x33"
+    "\x40\x4d\x5a\x67\x74\x81\x8e\x9b\xa8\xb5\xc2\xcf\xdc\xe9\xf6\x03"
+    "\x10\x1d\x2a\x37\x44\x51\x5e\x6b\x78\x85\x92\x9f\xac\xb9\xc6\xd3"
+    "\xe0\xed\xfa\x07\x14\x21\x2e\x3b\x48\x55\x62\x6f\x7c\x89\x96\xa3"
+    "\xb0\xbd\xca\xd7\xe4\xf1\xfe\x0b\x18\x25\x32\x3f\x4c\x59\x66\x73"
+    "\x80\x8d\x9a\xa7\xb4\xc1\xce\xdb\xe8\xf5\x02\x0f\x1c\x29\x36\x43"
+    "\x50\x5d\x6a\x77\x84\x91\x9e\xab\xb8\xc5\xd2\xdf\xec\xf9\x06\x13"
+    "\x20\x2d\x3a\x47\x54\x61\x6e\x7b\x88\x95\xa2\xaf\xbc\xc9\xd6\xe3"
+    "\xf0\xfd\x0a\x17\x24\x31\x3e\x4b\x58\x65\x72\x7f\x8c\x99\xa6\xb3"
+    "\xc0\xcd\xda\xe7\xf4\x01\x0e\x1b\x28\x35\x42\x4f\x5c\x69\x76\x83"
+    "\x90\x9d\xaa\xb7\xc4\xd1\xde\xeb\xf8\x05\x12\x1f\x2c\x39\x46\x53"
+    "\x60\x6d\x7a\x87\x94\xa1\xae\xbb\xc8\xd5\xe2\xef\xfc\x09\x16\x23"
+    "\x30\x3d\x4a\x57\x64\x71\x7e\x8b\x98\xa5\xb2\xbf\xcc\xd9\xe6\xf3"
+    "\x00\x0d\x1a\x27\x34\x41\x4e\x5b\x68\x75\x82\x8f\x9c\xa9\xb6\xc3"
+    "\xd0\xdd\xea\xf7\x04\x11\x1e\x2b\x38\x45\x52\x5f\x6c\x79\x86\x93"
+    "\xa0\xad\xba\xc7\xd4\xe1\xee\xfb\x08\x15\x22\x2f", 300,
+    "\x26\x63\x58\x50\x67\x69\x52\x9e\x71\x79\x2e\x97\xd3\x24\x96\x11"
+    "\xf3\x74\x50\xb8\xad\xed\x33\x48\x64\x75\x9b\xca\xe0\x17\x2f\x78", 32,
+    HASH_SHA512_256
+},
+{
+    "", 0,
+    "test string", 11,
+    "\xbb\x74\x65\x51\xc9\x7a\x90\xdb\xe0\x3c\x08\x4a\x64\xb9\x98\x9a"
+    "\xca\xbb\x41\x21\x18\x89\x4e\x92\x88\xa2\x6c\x0c", 28,
+    HASH_SHA3_224
+},
+{
+    "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b"
+    "\x0b\x0b\x0b\x0b", 20,
+    "Hi There", 8,
+    "\xba\x85\x19\x23\x10\xdf\xfa\x96\xe2\xa3\xa4\x0e\x69\x77\x43\x51"
+    "\x14\x0b\xb7\x18\x5e\x12\x02\xcd\xcc\x91\x75\x89\xf9\x5e\x16\xbb", 32,
+    HASH_SHA3_256
+},
+{
+    "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+    "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+    "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+    "\x60\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6c\x6d\x6e\x6f"
+    "\x70\x71\x72\x73\x74\x75\x76\x77\x78\x79\x7a\x7b\x7c\x7d\x7e\x7f"
+    "\x80\x81\x82\x83\x84\x85\x86\x87\x88\x89\x8a\x8b\x8c\x8d\x8e\x8f"
+    "\x90\x91\x92\x93\x94\x95\x96\x97\x98\x99\x9a\x9b\x9c\x9d\x9e\x9f"
+    "\xa0\xa1\xa2\xa3\xa4\xa5\xa6\xa7\xa8\xa9\xaa\xab\xac\xad\xae\xaf"
+    "\xb0\xb1\xb2\xb3\xb4\xb5\xb6\xb7\xb8\xb9\xba\xbb\xbc\xbd\xbe\xbf"
+    "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7", 200,
+    "test string", 11,
+    "\x9d\x36\x70\x06\x69\xc4\xc7\xe7\x55\xfa\x5a\xdb\xc8\x49\x42\xce"
+    "\x45\x64\x4e\x28\x72\xc1\xd6\x8d\x95\xe8\xf1\x9d\x07\x1d\x03\x95"
+    "\x44\x99\xfc\x14\xa2\x25\xd5\xfa\x70\xec\x40\x6f\x1d\x2f\x50\xe7", 48,
+    HASH_SHA3_384
+},
+{
+    "Jefe", 4,
+    "what do ya want for nothing?", 28,
+    "\x5a\x4b\xfe\xab\x61\x66\x42\x7c\x7a\x36\x47\xb7\x47\x29\x2b\x83"
+    "\x84\x53\x7c\xdb\x89\xaf\xb3\xbf\x56\x65\xe4\xc5\xe7\x09\x35\x0b"
+    "\x28\x7b\xae\xc9\x21\xfd\x7c\xa0\xee\x7a\x0c\x31\xd0\x22\xa9\x5e"
+    "\x1f\xc9\x2b\xa9\xd7\x7d\xf8\x83\x96\x02\x75\xbe\xb4\xe6\x20\x24", 64,
+    HASH_SHA3_512
 }
 };
 
-#define MAX_OUT_LEN 32
+#define MAX_OUT_LEN 64
 
 /*===----------------------------------------------------------------------===*/
 
@@ -20356,6 +20724,18 @@ static int check(const struct TEST_VECTOR *test)
 
     ASSERT_BUF_EQ(out, test->out, test->out_len);
 
+    /* The context must give the same result after a reset, even if some
+     * unrelated data was fed into it before resetting it. */
+    hmac_reset(&ctx);
+    hmac_update(&ctx, test->key, test->key_len);
+    hmac_reset(&ctx);
+
+    hmac_update(&ctx, test->in, test->in_len);
+
+    hmac_final(&ctx, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
     return 1;
 }
 
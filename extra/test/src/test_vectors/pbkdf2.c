@@ -17622,16 +17622,181 @@ static const struct TEST_VECTOR tests[] =
     "\xcd\xb0\x46\x27\xda\x92\xce\x60\x42\x12\xe3\x9e\xb7\x08\xf8\xa8"
     "\x3f\xdb\xdd\x60\x5e\xb0\x89\xcc\xbb\xc2\x31\x3b\xf7\x98\x6e\x4e", 128,
     HASH_SHA256
+},
+{
+    "password", 8,
+    "salt", 4,
+    1,
+    "\x86\x7f\x70\xcf\x1a\xde\x02\xcf\xf3\x75\x25\x99\xa3\xa5\x3d\xc4"
+    "\xaf\x34\xc7\xa6\x69\x81\x5a\xe5\xd5\x13\x55\x4e\x1c\x8c\xf2\x52"
+    "\xc0\x2d\x47\x0a\x28\x5a\x05\x01\xba\xd9\x99\xbf\xe9\x43\xc0\x8f"
+    "\x05\x02\x35\xd7\xd6\x8b\x1d\xa5\x5e\x63\xf7\x3b\x60\xa5\x7f\xce", 64,
+    HASH_SHA512
+},
+{
+    "password", 8,
+    "salt", 4,
+    1,
+    "\xc0\xe1\x4f\x06\xe4\x9e\x32\xd7\x3f\x9f\x52\xdd\xf1\xd0\xc5\xc7"
+    "\x19\x16\x09\x23\x36\x31\xda\xdd\x76\xa5\x67\xdb\x42\xb7\x86\x76"
+    "\xb3\x8f\xc8\x00\xcc\x53\xdd\xb6\x42\xf5\xc7\x44\x42\xe6\x2b\xe4"
+    "\x4d\x72\x77\x02\x21\x3e\x3b\xb9\x22\x3c\x53\xb7\x67\xfb\xfb\x5d", 64,
+    HASH_SHA384
+},
+{
+    "password", 8,
+    "salt", 4,
+    1,
+    "\x4b\x6a\x63\x11\x7d\x3e\xc0\x03\x26\x24\x61\x60\x82\xc1\xc1\x91"
+    "\x2f\x56\xfa\x5f\x0c\x1f\x94\x57\x4d\x51\x5e\x20\xe5\xdd\xd7\x4a"
+    "\xca\xf2\x14\xc6\xf7\x67\x4f\xcb\x96\x9a\x20\x79\xf2\xbb\xcf\x54"
+    "\x67\x60\xeb\xcc\xe1\x67\x67\x6f\x8a\x7b\xf1\x64\x22\x3e\x9f\x4f", 64,
+    HASH_SHA512_256
+},
+{
+    "password", 8,
+    "salt", 4,
+    2,
+    "\xe1\xd9\xc1\x6a\xa6\x81\x70\x8a\x45\xf5\xc7\xc4\xe2\x15\xce\xb6"
+    "\x6e\x01\x1a\x2e\x9f\x00\x40\x71\x3f\x18\xae\xfd\xb8\x66\xd5\x3c"
+    "\xf7\x6c\xab\x28\x68\xa3\x9b\x9f\x78\x40\xed\xce\x4f\xef\x5a\x82"
+    "\xbe\x67\x33\x5c\x77\xa6\x06\x8e\x04\x11\x27\x54\xf2\x7c\xcf\x4e", 64,
+    HASH_SHA512
+},
+{
+    "password", 8,
+    "salt", 4,
+    2,
+    "\x54\xf7\x75\xc6\xd7\x90\xf2\x19\x30\x45\x91\x62\xfc\x53\x5d\xbf"
+    "\x04\xa9\x39\x18\x51\x27\x01\x6a\x04\x17\x6a\x07\x30\xc6\xf1\xf4"
+    "\xfb\x48\x83\x2a\xd1\x26\x1b\xaa\xdd\x2c\xed\xd5\x08\x14\xb1\xc8"
+    "\x06\xad\x1b\xbf\x43\xeb\xdc\x9d\x04\x79\x04\xbf\x7c\xea\xfe\x1e", 64,
+    HASH_SHA384
+},
+{
+    "password", 8,
+    "salt", 4,
+    2,
+    "\xfc\xfd\x10\x8c\x99\xcc\x88\x8e\xc0\xaf\x9f\x18\x48\x85\xaf\xf5"
+    "\xf0\x2d\x19\xa9\x56\xaf\xad\x9c\xce\xa4\xd5\x6a\x48\x2b\x85\x1b"
+    "\xec\x1a\xf5\x63\x5d\x57\x4b\xc1\xbf\x1a\x5c\x16\xe2\x52\xc0\xed"
+    "\xc6\xb0\xa3\x61\xfe\x92\xdc\x8c\x49\x98\x93\x6f\x24\xf2\x78\x94", 64,
+    HASH_SHA512_256
+},
+{
+    "password", 8,
+    "salt", 4,
+    4096,
+    "\xd1\x97\xb1\xb3\x3d\xb0\x14\x3e\x01\x8b\x12\xf3\xd1\xd1\x47\x9e"
+    "\x6c\xde\xbd\xcc\x97\xc5\xc0\xf8\x7f\x69\x02\xe0\x72\xf4\x57\xb5"
+    "\x14\x3f\x30\x60\x26\x41\xb3\xd5\x5c\xd3\x35\x98\x8c\xb3\x6b\x84"
+    "\x37\x60\x60\xec\xd5\x32\xe0\x39\xb7\x42\xa2\x39\x43\x4a\xf2\xd5", 64,
+    HASH_SHA512
+},
+{
+    "password", 8,
+    "salt", 4,
+    4096,
+    "\x55\x97\x26\xbe\x38\xdb\x12\x5b\xc8\x5e\xd7\x89\x5f\x6e\x3c\xf5"
+    "\x74\xc7\xa0\x1c\x08\x0c\x34\x47\xdb\x1e\x8a\x76\x76\x4d\xeb\x3c"
+    "\x30\x7b\x94\x85\x3f\xbe\x42\x4f\x64\x88\xc5\xf4\xf1\x28\x96\x26"
+    "\x1d\x1e\xb4\x30\x35\x3c\x76\x9e\xe2\xa7\x7a\x26\xfd\x0a\x23\x47", 64,
+    HASH_SHA384
+},
+{
+    "password", 8,
+    "salt", 4,
+    4096,
+    "\xf2\xfb\xe5\xf8\xec\x36\x18\xbb\x14\x52\x79\xa8\xc6\xa8\xdf\xa4"
+    "\x76\xc2\x82\xa3\xed\x53\xd8\xc2\x57\xd5\x1c\xe0\x21\xd3\x87\x7d"
+    "\x3b\x50\xc8\x4a\x7f\x91\x58\xd4\x65\x4e\x64\xde\xb9\xb9\xa8\x5b"
+    "\xab\xeb\xcf\xd7\x14\xdd\xa6\xc0\x5d\xa4\x58\x4d\x22\x67\x24\x23", 64,
+    HASH_SHA512_256
+},
+{
+    "passwordPASSWORDpassword", 24,
+    "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36,
+    4096,
+    "\x8c\x05\x11\xf4\xc6\xe5\x97\xc6\xac\x63\x15\xd8\xf0\x36\x2e\x22"
+    "\x5f\x3c\x50\x14\x95\xba\x23\xb8\x68\xc0\x05\x17\x4d\xc4\xee\x71"
+    "\x11\x5b\x59\xf9\xe6\x0c\xd9\x53\x2f\xa3\x3e\x0f\x75\xae\xfe\x30"
+    "\x22\x5c\x58\x3a\x18\x6c\xd8\x2b\xd4\xda\xea\x97\x24\xa3\xd3\xb8"
+    "\x04\xf7\x5b\xdd\x41\x49\x4f\xa3\x24\xca\xb2\x4b\xcc\x68\x0f\xb3"
+    "\xb9\x6a\x30\xcf\x5d\x21\xfa\xc3\xc2\x87\x59\x13\x91\x9f\x33\x99"
+    "\xb1\xd9\xce\x7e\xb5\x4c\x95\xba\x49\x11\x85\x96\xcf\x74\x65\x71"
+    "\x9b\xbe\x02\xc4\xec\xab\x1b\x15\x41\x29\x8c\x32\x1d\x13\xc6\xf6"
+    "\xd4\x14\xc2", 131,
+    HASH_SHA512
+},
+{
+    "passwordPASSWORDpassword", 24,
+    "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36,
+    4096,
+    "\x81\x91\x43\xad\x66\xdf\x9a\x55\x25\x59\xb9\xe1\x31\xc5\x2a\xe6"
+    "\xc5\xc1\xb0\xee\xd1\x8f\x4d\x28\x3b\x8c\x5c\x9e\xae\xb9\x2b\x39"
+    "\x2c\x14\x7c\xc2\xd2\x86\x9d\x58\xff\xe2\xf7\xda\x13\xd1\x5f\x8d"
+    "\x92\x57\x21\xf0\xed\x1a\xfa\xfa\x24\x48\x0d\x55\xcf\x60\x60\xb1"
+    "\x7f\x11\x2a\x3d\xe7\x4c\xae\x25\xfd\xf3\x56\x9e\x24\x7f\x29\xe4"
+    "\xdb\xb8\x44\x21\x84\x78\x22\xea\x99\xbd\x20\x28\x3c\x3a\x25\xa6"
+    "\x0d\x3d\xb9\x5a\x2c\x06\xd3\x9c\xf5\xd3\x4c\xb2\xa1\x78\x11\x99"
+    "\xf6\x2f\x87\x10\x49\x82\x11\x72\x50\x62\xe6\xb0\x2f\x3f\xf2\xb6"
+    "\x6c\x0a\x03", 131,
+    HASH_SHA384
+},
+{
+    "passwordPASSWORDpassword", 24,
+    "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36,
+    4096,
+    "\x31\xcf\x94\xe3\xd8\xe3\x6a\xa1\x8d\x40\xad\x92\x65\x4a\xb8\x0f"
+    "\x50\x0e\xd7\xfb\x57\x5a\x22\x15\x54\x7d\xb6\xf8\x2d\xd2\x27\xed"
+    "\x0f\x41\x21\x5e\x8f\x9b\xb9\x76\x41\xa2\xd8\x15\x6b\x7b\x7c\x16"
+    "\xa6\x69\xa0\x47\x5d\x60\x93\x14\xd0\xfa\x8c\xc2\xac\xe4\xec\x66"
+    "\x5e\xdc\x16\x10\x13\xe1\x7d\x2d\xe1\xc8\xb8\x36\xea\x76\x2f\xa5"
+    "\xc2\x8a\x06\x51\x41\x1d\x21\xed\x56\xc7\xd5\xe0\xfc\x09\xb2\x63"
+    "\x98\x07\x9b\x5a\x07\x1d\x95\x4c\x6f\x07\x7f\xf8\x44\xab\x35\x0e"
+    "\x71\x8d\x05\xde\x43\x8b\x4d\xfb\xfe\xd3\xe1\xeb\xb6\xe3\x7f\x12"
+    "\x90\x86\x75", 131,
+    HASH_SHA512_256
+},
+{
+    "password", 8,
+    "salt", 4,
+    1024,
+    "\xf9\xd3\x9c\x57\x1d\x66\xa0\x3c\x2a\x71\xa8\x15\x35\xb0\xc2\xd0"
+    "\x39\x6b\x50\x0a\xa7\x67\x90\xb8\x56\x48\x7e\x79\xd7\xda\x18\xf0"
+    "\xf7\xab\xe1\xb9\xb2\x6a\xb3\xe4\x6b\x64\x66\xeb\xb6\xd3\x15\x8e"
+    "\xbe\xf2\xa9\x56\x3b\x29\x81\xb8\xd3\x4d\x3d\xc9\xd7\xdd\xd9\x91"
+    "\x88\xad\x19\x4a\xf2\x02\xc1\xb0\x12\x8a\x12\xda\x78\x9c\x06\xc6"
+    "\x0d\x12\xd4\x11\x77\xfd\x39\x2d\x6f\xcd\x04\x38\xbf\xa2\xdf\xf6"
+    "\x4d\xf6\x1b\x14\xdc\xab\x53\x6c\xdd\xba\x51\x58\xd1\xe9\x42\xe4"
+    "\xa1\x03\x00\xaa\xbc\x98\x67\x32\x5f\x72\x2c\x43\x7a\x05\x24\x97"
+    "\xdf\x1d\x82\x5f\x86\x44\xbd\x3e\xff\x7c\xbd\xd5\xb8\x2a\xc4\x8d"
+    "\xbe\x6b\xae\x54\x6f\x01\x83\xb4\x98\xf5\xaf\x53\xab\x5e\x4f\x76"
+    "\xb6\xe7\x7f\xa4\xb7\x0d\x54\xfa\x18\xee\x79\xb7\x10\x2e\x37\xf9"
+    "\x01\x5f\xf9\x9f\x0d\x8b\x06\x08\xbf\x61\xed\xa0\xfd\xaf\xf3\x25"
+    "\x76\x55\xf4\xdb\x6a\x10\xec\xa0\xf6\x33\xa1\xe3\xc5\x2e\x6d\x53"
+    "\x5b\xbd\x85\x6e\xe5\x50\x71\xc2\xb0\xc7\x6e\x2b\x80\x3f\x61\xea"
+    "\x6c\xf9\xef\xa3\xd9\xa3\xff\xfa\xbe\x0e\xf4\x26\xf1\x00\xbe\x55"
+    "\x1b\x20\x50\x89\xec\xe5\x33\xbd\xaa\xcf\xad\x18\x0f\xb1\x78\x49"
+    "\xca\xea\x56\x18\xea\x35\xfa\x7a\x8c\x05\x52\x1e\xb1\x38\xfc\x40"
+    "\xdb\x45\x68\xff\x02\xb3\xf2\x50\x27\xa4\xac\x7a\x24\x57\x8e\xaa"
+    "\xe7\x4e\x97\x7e\x62\xc7\xc5\x9b\x10\x82\xf0\x34\xd3\xdb\x86\x02"
+    "\x00\x79\xbd\x29\x64\x8e\x72\x79\x23\x72\x44\xd4\xd1\x12\x49\x0a"
+    "\x50\x8e\xc6\x45\x41\xf2\x85\x45\xb6\x12\x5c\xe3\xd9\xa7\x9b\x35"
+    "\xd9\x24\x28\x13", 340,
+    HASH_SHA1
 }
 };
 
-#define MAX_OUT_LEN 131
+#define MAX_OUT_LEN 340
 
 /*===----------------------------------------------------------------------===*/
 
 static int check(const struct TEST_VECTOR *test)
 {
     unsigned char out[MAX_OUT_LEN];
+    struct PBKDF2_CTX ctx;
+    int done;
 
     if (!prim_avail(test->hash))
         return 1;
@@ -17644,6 +17809,72 @@ static int check(const struct TEST_VECTOR *test)
 
     ASSERT_BUF_EQ(out, test->out, test->out_len);
 
+    memset(out, 0, sizeof(out));
+
+    ASSERT_SUCCESS(kdf_pbkdf2_parallel(test->hash, 0,
+                                       test->pwd, test->pwd_len,
+                                       test->salt, test->salt_len,
+                                       test->iterations,
+                                       out, test->out_len));
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* Slices which do not divide the iteration count, so that they straddle
+     * block boundaries, and pbkdf2_final() runs whatever is left. */
+    memset(out, 0, sizeof(out));
+
+    ASSERT_SUCCESS(pbkdf2_init(&ctx, test->hash, 0,
+                               test->pwd, test->pwd_len,
+                               test->salt, test->salt_len,
+                               test->iterations,
+                               out, test->out_len));
+
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 7, &done));
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 999, &done));
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 999, &done));
+    ASSERT_SUCCESS(pbkdf2_final(&ctx));
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 1, &done));
+    ASSERT(done);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+/* Derives the keys of all the test vectors of a hash function in a single
+ * batch, so that the lanes get refilled with blocks of every iteration count
+ * and output length. */
+static int check_batch(prim_t hash)
+{
+    static struct PBKDF2_JOB jobs[ARRAY_SIZE(tests)];
+    static unsigned char out[ARRAY_SIZE(tests)][MAX_OUT_LEN];
+    size_t t, count = 0;
+
+    if (!prim_avail(hash))
+        return 1;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (tests[t].hash == hash)
+        {
+            jobs[count].pwd = tests[t].pwd;
+            jobs[count].pwd_len = tests[t].pwd_len;
+            jobs[count].salt = tests[t].salt;
+            jobs[count].salt_len = tests[t].salt_len;
+            jobs[count].iterations = tests[t].iterations;
+            jobs[count].out = out[count];
+            jobs[count].out_len = tests[t].out_len;
+            ++count;
+        }
+
+    ASSERT_SUCCESS(kdf_pbkdf2_batch(hash, 0, jobs, count));
+
+    for (t = 0, count = 0; t < ARRAY_SIZE(tests); ++t)
+        if (tests[t].hash == hash)
+        {
+            ASSERT_BUF_EQ(out[count], tests[t].out, tests[t].out_len);
+            ++count;
+        }
+
     return 1;
 }
 
@@ -17655,5 +17886,8 @@ int test_vectors_pbkdf2(void)
     for (t = 0; t < ARRAY_SIZE(tests); ++t)
         if (!check(tests + t)) return 0;
 
+    if (!check_batch(HASH_SHA1)) return 0;
+    if (!check_batch(HASH_SHA256)) return 0;
+
     return 1;
 }
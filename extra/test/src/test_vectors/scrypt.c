@@ -0,0 +1,95 @@
+/*===-- test_vectors/scrypt.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the scrypt module, the first two from RFC 7914.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+struct TEST_VECTOR
+{
+    const char *pwd;
+    size_t pwd_len;
+    const char *salt;
+    size_t salt_len;
+    uintmax_t n;
+    size_t r, p;
+    const char *out;
+    size_t out_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    "password", 8,
+    "NaCl", 4,
+    1024, 8, 16,
+    "\xfd\xba\xbe\x1c\x9d\x34\x72\x00\x78\x56\xe7\x19\x0d\x01\xe9\xfe"
+    "\x7c\x6a\xd7\xcb\xc8\x23\x78\x30\xe7\x73\x76\x63\x4b\x37\x31\x62"
+    "\x2e\xaf\x30\xd9\x2e\x22\xa3\x88\x6f\xf1\x09\x27\x9d\x98\x30\xda"
+    "\xc7\x27\xaf\xb9\x4a\x83\xee\x6d\x83\x60\xcb\xdf\xa2\xcc\x06\x40", 64
+},
+{
+    "pleaseletmein", 13,
+    "SodiumChloride", 14,
+    16384, 8, 1,
+    "\x70\x23\xbd\xcb\x3a\xfd\x73\x48\x46\x1c\x06\xcd\x81\xfd\x38\xeb"
+    "\xfd\xa8\xfb\xba\x90\x4f\x8e\x3e\xa9\xb5\x43\xf6\x54\x5d\xa1\xf2"
+    "\xd5\x43\x29\x55\x61\x3f\x0f\xcf\x62\xd4\x97\x05\x24\x2a\x9a\xf9"
+    "\xe6\x1e\x85\xdc\x0d\x65\x1e\x40\xdf\xcf\x01\x7b\x45\x57\x58\x87", 64
+},
+{
+    "ordo", 4,
+    "", 0,
+    16, 1, 1,
+    "\x8a\xcf\x9c\xb5\xc4\x18\x59\xc2\xf8\x3f\x08\x25\xa1\xdc\x1e\xd9"
+    "\x53\x0b\x64\xe7\xeb\xcd\x44\x32\x98\x37\x96\x4e\x8d\x67\xa4\x24", 32
+},
+{
+    "correct horse battery staple", 28,
+    "salt", 4,
+    256, 3, 5,
+    "\x12\xa8\xf8\x98\xb3\x49\xf2\x45\x78\xc5\xb1\xd0\x5a\x27\xc0\x83"
+    "\xae\x4e\xfd\xbf\xe0\x96\x93\x4c\x76\x4a\x82\x7a\x18\xdc\xaa\x95"
+    "\xc9\x23\xba\x90\x3a\x66\x39\x5d\xcd\x91\x38\xd1\xa1\xdb\xef\x05"
+    "\xcc\x7a\x4c\x48\x3b\x7d\x14\x31\x1d\xd5\x04\x77\xec\x77\x0b\x0e"
+    "\x4a\xa8\x3d\x33\x95\x14\x3b\x5b\x48\x56\xa9\x11\x0c", 77
+}
+};
+
+#define MAX_OUT_LEN 77
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+
+    if (!prim_avail(HASH_SHA256))
+        return 1;
+
+    ASSERT_SUCCESS(kdf_scrypt(test->pwd, test->pwd_len,
+                              test->salt, test->salt_len,
+                              test->n, test->r, test->p,
+                              out, test->out_len));
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+int test_vectors_scrypt(void);
+int test_vectors_scrypt(void)
+{
+    size_t t;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+
+    return 1;
+}
@@ -0,0 +1,470 @@
+/*===-- test_vectors/sha3.c ------------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the SHA-3 hash functions and the SHAKE extendable-output
+*** functions, for inputs around the rate of each. The input bytes are their
+*** offsets modulo 251, and the SHAKE vectors have 300 bytes of output.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+#if WITH_SHA3
+#include "ordo/primitives/hash_functions/sha3.h"
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_SHA3
+
+struct TEST_VECTOR
+{
+    size_t in_len;
+    prim_t hash;
+    const char *out;
+    size_t out_len;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    0, HASH_SHA3_224,
+    "\x6b\x4e\x03\x42\x36\x67\xdb\xb7\x3b\x6e\x15\x45\x4f\x0e\xb1\xab"
+    "\xd4\x59\x7f\x9a\x1b\x07\x8e\x3f\x5b\x5a\x6b\xc7", 28
+},
+{
+    143, HASH_SHA3_224,
+    "\x64\xd0\xe8\xa1\xbe\x3c\xf3\x0e\xf6\x72\x7b\x30\xa6\xe4\x28\xf7"
+    "\xf0\x68\xd4\x46\x34\xc9\x43\xd2\x77\xad\x8e\x7f", 28
+},
+{
+    144, HASH_SHA3_224,
+    "\x5b\xe7\x5e\x6a\x08\xf1\x99\x13\xa1\xd8\x03\x6c\x05\x6c\xc4\x55"
+    "\x6b\x98\xdc\x90\xae\xca\x3f\x2a\x06\x64\xde\xdc", 28
+},
+{
+    1000, HASH_SHA3_224,
+    "\x51\x48\x1b\x8d\xbd\x6b\x73\xdd\x11\x0a\x96\x7f\x43\x8a\xa2\x2f"
+    "\xac\xfc\xdc\xe1\xeb\x5d\x2b\x36\xa5\xec\x02\x3f", 28
+},
+{
+    0, HASH_SHA3_256,
+    "\xa7\xff\xc6\xf8\xbf\x1e\xd7\x66\x51\xc1\x47\x56\xa0\x61\xd6\x62"
+    "\xf5\x80\xff\x4d\xe4\x3b\x49\xfa\x82\xd8\x0a\x4b\x80\xf8\x43\x4a", 32
+},
+{
+    135, HASH_SHA3_256,
+    "\xfd\xed\x8f\xd9\xd6\x55\x1c\x60\x1e\xeb\x3b\x7c\x6b\xc5\xe5\xcf"
+    "\xd8\xaa\xd1\xd0\x15\xb7\xe9\xaa\xa9\xc9\xb9\x47\x52\x31\xd5\xe2", 32
+},
+{
+    136, HASH_SHA3_256,
+    "\xcf\x3c\xcf\xf9\x24\x80\xa2\x91\x60\xc2\xd3\x83\x17\xc4\x30\xe1"
+    "\x47\x49\xbf\xee\x17\x88\x10\x69\x57\xdf\xe7\x3f\x8c\x49\x30\xe5", 32
+},
+{
+    1000, HASH_SHA3_256,
+    "\x48\xe6\x6a\x01\x86\x1d\x0e\xad\xaa\xcd\xb7\xa6\xae\x7d\xb6\xb9"
+    "\xac\x79\x24\x2e\xcc\xed\x41\x54\xa9\xfb\xb3\x3c\x4e\x3c\xc5\x71", 32
+},
+{
+    0, HASH_SHA3_384,
+    "\x0c\x63\xa7\x5b\x84\x5e\x4f\x7d\x01\x10\x7d\x85\x2e\x4c\x24\x85"
+    "\xc5\x1a\x50\xaa\xaa\x94\xfc\x61\x99\x5e\x71\xbb\xee\x98\x3a\x2a"
+    "\xc3\x71\x38\x31\x26\x4a\xdb\x47\xfb\x6b\xd1\xe0\x58\xd5\xf0\x04", 48
+},
+{
+    103, HASH_SHA3_384,
+    "\x1f\x91\xee\x55\x1a\xd1\x8f\x26\x88\x76\xd1\xfc\x26\x2f\x13\x7f"
+    "\xe1\x96\x58\x02\x16\xc5\x19\x38\x19\xa9\x5e\xc5\x22\x25\x37\xd2"
+    "\xa6\x58\xdd\x12\x9c\x3d\x80\x80\xe6\x5e\xc7\x46\x0f\x1f\x47\x04", 48
+},
+{
+    104, HASH_SHA3_384,
+    "\x5b\x8d\x0d\x5c\xf8\xb4\x1b\xe5\x07\xbe\x8f\xcb\xfc\xbd\xba\xc3"
+    "\xa2\x8e\xb3\x68\xd4\x30\xfe\xd6\x78\x0a\xaa\x78\xa9\x3a\x8d\xa4"
+    "\xa6\xc5\x04\x85\x94\x9c\xa3\x44\xf2\x28\xbe\x91\xa9\x60\x05\xa3", 48
+},
+{
+    1000, HASH_SHA3_384,
+    "\x43\xe6\x0a\x7e\xf8\x18\xa0\xe3\x67\xfc\xd4\xed\xe8\xf5\xfa\xbb"
+    "\xdb\x70\x90\xcb\x45\x97\x2b\xb7\xa8\x40\x38\xcc\x3a\xbf\x4f\xc2"
+    "\x6c\x4f\x44\xb5\x9d\x3a\x03\x06\xc9\x73\xb6\x6e\x84\xc8\x89\x0b", 48
+},
+{
+    0, HASH_SHA3_512,
+    "\xa6\x9f\x73\xcc\xa2\x3a\x9a\xc5\xc8\xb5\x67\xdc\x18\x5a\x75\x6e"
+    "\x97\xc9\x82\x16\x4f\xe2\x58\x59\xe0\xd1\xdc\xc1\x47\x5c\x80\xa6"
+    "\x15\xb2\x12\x3a\xf1\xf5\xf9\x4c\x11\xe3\xe9\x40\x2c\x3a\xc5\x58"
+    "\xf5\x00\x19\x9d\x95\xb6\xd3\xe3\x01\x75\x85\x86\x28\x1d\xcd\x26", 64
+},
+{
+    71, HASH_SHA3_512,
+    "\x3c\xcc\x85\x0d\x53\xa1\x28\x7a\xf7\xb4\x56\x0b\x2e\xf0\xd4\x3e"
+    "\xb5\xd9\xa8\x0d\x62\xa0\xe9\xcf\x1d\xbc\x04\x01\x35\x92\x11\x04"
+    "\xd4\x39\x51\x68\xe9\x0b\xfc\x87\x17\x73\xeb\xb3\x4b\xca\x1b\xd6"
+    "\x70\x56\xe1\xcc\x7d\xc7\xa4\x8f\xf7\xc3\x16\x7d\x38\x9f\x11\x7c", 64
+},
+{
+    72, HASH_SHA3_512,
+    "\x5d\x63\xf2\xbb\xe9\x71\xa9\x83\xac\x68\x47\x48\x01\x06\xe4\xe1"
+    "\x26\x4e\xe3\xa0\xbe\xfd\x79\x95\x49\x14\xe1\xd8\x6e\x79\x5b\x2e"
+    "\x18\x23\x8f\x12\xfc\x5e\x46\xcb\x9c\xc7\x8e\xfd\xec\x61\x0a\x93"
+    "\x64\x7c\xc0\x4e\x1c\x23\xd8\xca\xaa\x6a\x58\xc2\x1d\xd2\x6c\x07", 64
+},
+{
+    1000, HASH_SHA3_512,
+    "\xb8\x03\x0d\x30\x6a\xe9\x90\xbc\x79\x4b\xfb\x3a\x61\x00\xf6\x78"
+    "\x51\x88\x9d\x6c\x27\x22\x57\xaf\xac\x7d\x10\x77\xa1\x86\x60\xd6"
+    "\xea\x8d\x0d\xa5\xd2\x29\x9c\x3e\xba\xa0\xd3\x4b\xaf\x62\xcc\x58"
+    "\xac\x1f\xd4\x47\x65\x06\xcf\x51\x2a\x48\x97\xbb\x08\x3a\x6f\xc4", 64
+},
+{
+    0, HASH_SHAKE128,
+    "\x7f\x9c\x2b\xa4\xe8\x8f\x82\x7d\x61\x60\x45\x50\x76\x05\x85\x3e"
+    "\xd7\x3b\x80\x93\xf6\xef\xbc\x88\xeb\x1a\x6e\xac\xfa\x66\xef\x26"
+    "\x3c\xb1\xee\xa9\x88\x00\x4b\x93\x10\x3c\xfb\x0a\xee\xfd\x2a\x68"
+    "\x6e\x01\xfa\x4a\x58\xe8\xa3\x63\x9c\xa8\xa1\xe3\xf9\xae\x57\xe2"
+    "\x35\xb8\xcc\x87\x3c\x23\xdc\x62\xb8\xd2\x60\x16\x9a\xfa\x2f\x75"
+    "\xab\x91\x6a\x58\xd9\x74\x91\x88\x35\xd2\x5e\x6a\x43\x50\x85\xb2"
+    "\xba\xdf\xd6\xdf\xaa\xc3\x59\xa5\xef\xbb\x7b\xcc\x4b\x59\xd5\x38"
+    "\xdf\x9a\x04\x30\x2e\x10\xc8\xbc\x1c\xbf\x1a\x0b\x3a\x51\x20\xea"
+    "\x17\xcd\xa7\xcf\xad\x76\x5f\x56\x23\x47\x4d\x36\x8c\xcc\xa8\xaf"
+    "\x00\x07\xcd\x9f\x5e\x4c\x84\x9f\x16\x7a\x58\x0b\x14\xaa\xbd\xef"
+    "\xae\xe7\xee\xf4\x7c\xb0\xfc\xa9\x76\x7b\xe1\xfd\xa6\x94\x19\xdf"
+    "\xb9\x27\xe9\xdf\x07\x34\x8b\x19\x66\x91\xab\xae\xb5\x80\xb3\x2d"
+    "\xef\x58\x53\x8b\x8d\x23\xf8\x77\x32\xea\x63\xb0\x2b\x4f\xa0\xf4"
+    "\x87\x33\x60\xe2\x84\x19\x28\xcd\x60\xdd\x4c\xee\x8c\xc0\xd4\xc9"
+    "\x22\xa9\x61\x88\xd0\x32\x67\x5c\x8a\xc8\x50\x93\x3c\x7a\xff\x15"
+    "\x33\xb9\x4c\x83\x4a\xdb\xb6\x9c\x61\x15\xba\xd4\x69\x2d\x86\x19"
+    "\xf9\x0b\x0c\xdf\x8a\x7b\x9c\x26\x40\x29\xac\x18\x5b\x70\xb8\x3f"
+    "\x28\x01\xf2\xf4\xb3\xf7\x0c\x59\x3e\xa3\xae\xeb\x61\x3a\x7f\x1b"
+    "\x1d\xe3\x3f\xd7\x50\x81\xf5\x92\x30\x5f\x2e\x45", 300
+},
+{
+    167, HASH_SHAKE128,
+    "\x1e\x55\x27\x91\xcc\x4e\x93\xa0\xd4\xa8\xdc\x47\xae\x49\x22\x8c"
+    "\x2f\xaa\x86\x9e\x40\xe6\x28\xf6\xac\xe4\x77\xae\xc3\xf1\xca\x7a"
+    "\xef\xe1\xc1\x24\x5c\xf8\x2c\x26\x51\x68\xad\x29\x85\x12\x1a\xed"
+    "\xd7\x23\x35\xae\x11\x87\xa3\x67\x42\xc7\x46\xcf\x2b\x40\xcb\x30"
+    "\xb7\xc9\x94\xc5\xea\x9e\x44\xc4\x0f\x20\x14\x68\x6b\xc7\xab\x02"
+    "\x37\xad\x39\x73\xe4\x8d\xd8\x8d\x48\xc8\xbc\x8b\x28\xbe\x98\xc7"
+    "\x72\x9a\x94\x66\x70\xa0\x78\x82\x11\xc3\xb2\x39\xfd\xcb\x95\xd5"
+    "\x1b\x61\x20\x46\x3c\x63\x12\x86\x81\x7c\xda\x1d\xbc\x9f\x3e\x3c"
+    "\x37\x6e\x40\xfc\x2d\x6b\xa3\xd4\xdf\x72\xd1\x21\x77\xde\x6e\xfc"
+    "\xcb\x84\xdd\x15\xf9\xf2\x68\x70\x65\xb8\xad\x00\x21\x7c\x27\xe7"
+    "\x5b\x7d\x11\xc5\x21\x4b\x73\x1e\xd3\xfc\x45\x35\x0e\xf4\x48\x32"
+    "\xdc\x46\x3c\x1b\xdd\xf3\x34\x86\xa1\x7f\x70\x4e\x85\x84\x80\xad"
+    "\x0b\x31\x8f\xdc\x94\x1e\xf6\xc6\xc6\x8f\x66\x1c\x81\xa0\xd6\x0b"
+    "\xbe\x65\x68\x7f\x66\xfe\x5e\xd2\x93\xa6\x37\xf6\x26\x55\xa5\xff"
+    "\x15\x34\xc8\xf7\xed\xb5\xef\xfa\xb6\x10\x2b\x10\x5d\xff\xf4\x2f"
+    "\x48\x10\x22\x2b\x70\x4e\x9b\xff\x97\x8d\x30\xe7\xbd\xd8\xf7\xf9"
+    "\x8e\x95\x4b\x18\x27\x42\x40\xa7\x22\xa3\xef\x59\x48\x5c\x12\xce"
+    "\x13\xa3\x7a\x97\x10\xf9\x99\xd6\xc2\x53\xe8\x81\xb3\x9c\x7e\x6c"
+    "\xe3\xc2\x34\x4a\x4c\x64\xee\x39\x6c\x09\x14\xc5", 300
+},
+{
+    168, HASH_SHAKE128,
+    "\xf1\x52\x77\xeb\x61\xc4\x90\x8d\x44\xa2\x85\x3f\x3c\xde\x07\x1a"
+    "\xe2\xed\x7a\x23\x46\x1f\xbe\x16\x2a\x1a\x98\xcf\x68\x75\x05\x9c"
+    "\x06\xff\xee\xbf\xca\x31\xaf\xd9\x97\x6e\x55\x92\xa3\xe7\xe5\xe9"
+    "\x4a\x66\x5a\x8b\xef\xa4\xb6\x4a\x7f\x08\x9c\xc0\xf3\x57\x24\x03"
+    "\x20\xad\x26\x45\x22\x53\x2b\x17\x59\xb3\x8e\xc2\x3b\x95\x0e\x7a"
+    "\xf6\x6e\x0a\x75\x15\xa7\xd2\x33\x17\x4e\xbb\x03\x30\x0a\xd1\x06"
+    "\xb2\x5f\x54\x05\x32\x7e\xfb\x38\x45\x02\xfc\xb4\x38\xf4\x55\x53"
+    "\xe1\xfe\xd3\x38\x72\x62\xb2\x64\x18\x68\xdc\x98\x71\x90\x35\x36"
+    "\xfc\xd8\x3d\x07\x76\x55\x8a\x6e\xfb\x63\x7c\x90\x6b\x17\xa4\xbd"
+    "\xdd\x91\x68\xc1\x48\x54\xfd\x2a\xfc\x0c\xbc\x09\x01\x9d\x04\x4e"
+    "\x3a\x90\xe3\x21\x23\x1c\x3a\x61\xf4\xa0\xd4\x87\x42\xc0\x73\xbe"
+    "\x05\x22\x3d\xf1\x44\x96\x5c\xb2\xad\x9f\xb0\x25\xf0\xf1\xf7\xf5"
+    "\x68\x50\x09\x36\xcc\xce\xb4\x31\x24\xe6\x4c\x09\x99\xf7\x99\xbd"
+    "\x72\xb9\x28\x2d\x30\xfb\xe8\xe6\xf3\xeb\x4e\xe1\xb5\x3c\x97\x79"
+    "\x42\x0c\xdd\xee\x1c\x4e\x98\xb8\x8d\x5e\xec\xdc\x36\x2e\x4e\x1c"
+    "\x54\xcc\xcc\xa0\xb5\xd5\x56\x40\xbb\x02\x8b\xa3\x35\x33\x70\xa3"
+    "\xbe\xf2\xb9\x1c\x8a\x83\x0c\xa8\x0f\xa0\x69\xb7\x9f\xb9\x46\xa9"
+    "\x30\xac\xee\xf2\xd6\x61\xec\x54\x5a\xb6\x02\x9a\xb4\xba\x56\x0b"
+    "\xfc\x91\xc1\x39\x71\xb4\x3b\x17\x16\x95\x74\xe5", 300
+},
+{
+    1000, HASH_SHAKE128,
+    "\xa7\x24\x40\xf7\xf5\xaa\x7c\x14\xc8\xe0\x18\x74\x20\x61\x1d\xa7"
+    "\xe2\xba\x62\xf5\xbb\x2e\x88\xa9\x1b\x9c\x94\x48\xca\xc3\x00\x78"
+    "\xcc\x32\x1c\x13\x73\x5b\xc6\x79\x9f\x95\x5d\xea\x38\xf1\x71\x35"
+    "\x5b\x3e\xbc\xcc\x9a\x09\x63\x9b\x92\xf0\xf2\xf9\x1b\xa0\xd6\xd4"
+    "\x15\xd3\x66\xc8\x72\xdc\xfa\x18\xd7\x15\xbb\x12\x04\x11\x15\x85"
+    "\x0d\x10\x96\x48\x90\x70\xd2\xfe\xbf\x2f\xfd\x98\x6f\x53\xde\x7d"
+    "\xb3\x06\x58\x55\x67\x05\x6f\x53\x55\x3d\x68\xf7\x89\x76\x67\x11"
+    "\xd9\xa0\x58\x5d\xda\x15\xff\x0b\x8a\xde\x8f\x6d\xe3\x13\x1f\xfa"
+    "\x5b\xec\x44\xa5\x8b\xc0\x41\xe1\x81\x8b\x71\x3e\x0d\x66\x13\xab"
+    "\x40\x1d\xa4\x77\x2b\x05\xca\xc9\xba\x87\x9b\xff\x4d\x97\xe6\x8a"
+    "\x84\x71\x65\x28\xa4\xb9\xfb\x7e\x7a\xd4\x7f\xbb\x92\x98\x19\xbd"
+    "\x47\xde\xa3\xf4\x07\xa8\xd1\x42\x85\xe2\xab\x4f\x96\xa0\x7f\x13"
+    "\x31\x2d\x73\xf2\x5c\x0b\x28\xa4\xc2\xa3\x5d\x14\xaa\xf8\x6a\x50"
+    "\x63\x20\x5f\x62\x6a\xd6\x9e\x95\xea\xf2\x87\xd4\x8c\x69\x28\xaf"
+    "\x0e\x43\xac\xc9\x3d\xc9\x1e\xdf\x7e\xb4\x72\xaa\x9c\xab\x1e\xad"
+    "\x68\xdc\xf8\xeb\x0e\xcc\x51\x78\xf3\x7a\x3f\xf6\xd6\x40\x8e\xc8"
+    "\xde\x1d\x54\xfe\x35\x20\x92\x37\xa8\xcb\x0d\xf2\x3a\x94\x48\x22"
+    "\xbb\xfc\x8c\x96\x17\xbd\x7a\xab\xc9\xa2\x0d\x4e\x3b\x87\x6c\x34"
+    "\x5b\x76\x8a\x9f\x29\xc1\x95\xd8\xca\x3e\x82\x6b", 300
+},
+{
+    0, HASH_SHAKE256,
+    "\x46\xb9\xdd\x2b\x0b\xa8\x8d\x13\x23\x3b\x3f\xeb\x74\x3e\xeb\x24"
+    "\x3f\xcd\x52\xea\x62\xb8\x1b\x82\xb5\x0c\x27\x64\x6e\xd5\x76\x2f"
+    "\xd7\x5d\xc4\xdd\xd8\xc0\xf2\x00\xcb\x05\x01\x9d\x67\xb5\x92\xf6"
+    "\xfc\x82\x1c\x49\x47\x9a\xb4\x86\x40\x29\x2e\xac\xb3\xb7\xc4\xbe"
+    "\x14\x1e\x96\x61\x6f\xb1\x39\x57\x69\x2c\xc7\xed\xd0\xb4\x5a\xe3"
+    "\xdc\x07\x22\x3c\x8e\x92\x93\x7b\xef\x84\xbc\x0e\xab\x86\x28\x53"
+    "\x34\x9e\xc7\x55\x46\xf5\x8f\xb7\xc2\x77\x5c\x38\x46\x2c\x50\x10"
+    "\xd8\x46\xc1\x85\xc1\x51\x11\xe5\x95\x52\x2a\x6b\xcd\x16\xcf\x86"
+    "\xf3\xd1\x22\x10\x9e\x3b\x1f\xdd\x94\x3b\x6a\xec\x46\x8a\x2d\x62"
+    "\x1a\x7c\x06\xc6\xa9\x57\xc6\x2b\x54\xda\xfc\x3b\xe8\x75\x67\xd6"
+    "\x77\x23\x13\x95\xf6\x14\x72\x93\xb6\x8c\xea\xb7\xa9\xe0\xc5\x8d"
+    "\x86\x4e\x8e\xfd\xe4\xe1\xb9\xa4\x6c\xbe\x85\x47\x13\x67\x2f\x5c"
+    "\xaa\xae\x31\x4e\xd9\x08\x3d\xab\x4b\x09\x9f\x8e\x30\x0f\x01\xb8"
+    "\x65\x0f\x1f\x4b\x1d\x8f\xcf\x3f\x3c\xb5\x3f\xb8\xe9\xeb\x2e\xa2"
+    "\x03\xbd\xc9\x70\xf5\x0a\xe5\x54\x28\xa9\x1f\x7f\x53\xac\x26\x6b"
+    "\x28\x41\x9c\x37\x78\xa1\x5f\xd2\x48\xd3\x39\xed\xe7\x85\xfb\x7f"
+    "\x5a\x1a\xaa\x96\xd3\x13\xea\xcc\x89\x09\x36\xc1\x73\xcd\xcd\x0f"
+    "\xab\x88\x2c\x45\x75\x5f\xeb\x3a\xed\x96\xd4\x77\xff\x96\x39\x0b"
+    "\xf9\xa6\x6d\x13\x68\xb2\x08\xe2\x1f\x7c\x10\xd0", 300
+},
+{
+    135, HASH_SHAKE256,
+    "\xc4\x5d\xae\x62\x4a\xd8\xa2\xf5\xaa\x7b\xac\x9d\x75\x57\x73\x7f"
+    "\xd9\x1c\x96\xee\xdb\x70\xa6\xbe\x55\x74\xd5\x7a\x84\x4e\xad\xe0"
+    "\x7f\x40\x56\xbf\x08\x1a\x10\x98\x10\x1c\xea\x81\x32\x18\x8c\x42"
+    "\x21\x36\xfe\xb4\x68\x7d\x1e\x22\x09\xf3\xfd\x28\xbe\xdf\xb8\xf4"
+    "\x46\x8c\xba\x85\x01\x76\x35\x11\xf5\x07\xc9\xc1\x45\x37\x40\x3b"
+    "\xf7\x80\x4a\x89\x60\x7b\x4c\x3f\x5a\xfd\x48\x4e\xc0\xc4\x11\xc6"
+    "\x1e\x61\xd8\x78\x4b\x2a\x0c\xb2\x81\xef\x9f\x44\xa4\xe3\x27\x32"
+    "\xad\xab\xa1\x31\x87\x5b\x0e\x34\xd5\x87\xd1\xe6\x3f\xea\x83\xb1"
+    "\x77\xa0\x42\x30\xd0\x41\xb8\xf9\x6e\x77\xd6\xd9\xa7\xc1\x42\x81"
+    "\x7c\xbf\x4c\xed\xfa\x17\xf3\x86\xdc\x02\x06\xf4\x50\x9a\xb4\x30"
+    "\x67\x63\x51\x2d\x15\x5d\xcb\xfa\x8f\xfe\xad\xb0\xa9\x09\xda\x94"
+    "\x64\xa2\x8f\x01\xc9\xb5\x44\x1e\xc8\x5b\x53\x47\x86\xc6\xa0\xce"
+    "\x90\xec\x77\x21\xed\x0f\x5a\x03\x1b\x2c\xaf\x7a\xe4\xf0\x45\xc9"
+    "\xaa\x1f\xfd\x34\x6a\x58\x55\x50\x0d\x7c\xe8\x98\x16\x52\xa0\xd3"
+    "\x41\x00\x5a\x81\x10\xc8\xf1\x42\xb8\xe5\xc3\xf8\xfc\xfe\xd9\x6c"
+    "\x90\x74\xc4\x7e\x92\xc7\xf5\x61\xca\x73\xab\x93\x6d\x0b\x1a\x2b"
+    "\xd6\x5d\xab\xe8\x2a\x18\x70\xf3\x93\xdb\x9c\x9a\x97\xa1\x38\x19"
+    "\x46\x29\xfc\x4b\xa1\xb4\x67\xac\xb5\x33\xf5\x26\x68\x75\x90\x99"
+    "\x52\x5c\x4a\x6d\xa6\x73\x3c\x2e\xab\xb3\xbb\x4a", 300
+},
+{
+    136, HASH_SHAKE256,
+    "\xb7\xff\x40\x73\xb3\xf5\xa8\xea\xbd\x6e\x17\x70\x5c\xa7\xf6\x76"
+    "\x1a\x31\x05\x8f\x9d\xf7\x81\xa6\xa4\x7e\x3a\x30\x63\xb9\xd6\x7a"
+    "\x75\x7e\x8d\xbf\x04\x3d\xac\x48\xd2\x15\x4e\x46\xd5\x9c\x0b\x9e"
+    "\x8b\xc3\x6b\xa0\x35\x15\x36\x91\xfb\xe8\x3b\x9e\xff\x5d\xae\x4a"
+    "\x0a\xa0\x1d\x73\xc9\x84\xc4\x9a\xdc\x27\x12\x97\xaf\x1b\xaa\x96"
+    "\x93\x1f\x24\xef\x47\xa1\x17\x81\xfe\xd7\x72\x2a\x29\x3e\x22\x36"
+    "\x47\xe4\xbe\x70\x4f\xd5\xd6\x3e\xe4\xe1\x5a\x4a\x7c\xf7\xad\x58"
+    "\x6b\x56\x1b\x84\x0e\x62\x25\xe6\xaa\xe3\x44\xdb\xe9\xa1\x5f\xb1"
+    "\x55\xe4\xfa\x2a\xb7\xd7\xdf\x09\xbe\x06\xd8\x31\x95\xc8\x89\x2a"
+    "\x2e\x6c\x5b\x56\xda\xdb\xb8\xf8\x08\xac\x51\x7e\x30\x59\x57\xe7"
+    "\xe7\xcc\xa4\x07\xf3\x98\x40\xa0\x0b\xb6\x0e\x35\x63\x8b\xf0\xe2"
+    "\xd5\x51\xfb\x0e\x27\x03\xb4\xeb\x65\x4c\x53\x42\x7a\xbb\x39\x32"
+    "\xa4\x0a\xfb\x86\xb7\x63\x73\xe6\xd8\xe3\xcf\xb9\x1f\x3a\xfa\x54"
+    "\x12\xc6\xf1\xb9\x88\x28\x76\xd7\xe4\x58\x19\x9d\x28\xd6\x9f\xec"
+    "\x8f\x61\x62\xb4\x22\x43\xa8\x5f\x2d\x2f\x63\x28\x1c\x36\xf7\x76"
+    "\x62\x3f\xb8\xcb\xd9\xe0\x66\x4f\x49\x28\x87\x05\x9e\x38\xaf\xbd"
+    "\xee\x2b\x78\x61\xbb\xcb\x2a\xb0\x90\x9e\xa3\x6d\x91\x96\x2d\xfb"
+    "\xaa\x95\xeb\x70\x0c\xe1\x0e\x88\xcf\xa3\xb7\x91\x1a\x24\xd6\x48"
+    "\xb1\xbf\x2b\x78\x2c\x7c\x7a\x08\x67\xdb\xae\x51", 300
+},
+{
+    1000, HASH_SHAKE256,
+    "\x34\x83\x3f\x03\xed\x88\xbb\x5f\x08\x3c\xe5\x90\xc7\xae\x5a\xf9"
+    "\x3e\xde\x33\xe1\x1f\x53\xc7\x0e\x47\x91\x6c\x70\x44\x74\x6a\xcb"
+    "\xdc\xa1\x9a\x73\xff\x13\x90\x5e\x91\xf8\xdc\x25\xce\x6e\x41\xae"
+    "\x59\xfe\x75\x44\x1b\xd5\x48\xdd\xa9\x11\x4a\xca\x1d\xa7\x18\x02"
+    "\x31\xfc\x22\xb3\x53\x32\x7c\xd2\x5e\x00\x74\x9a\xa2\x77\xae\x0f"
+    "\xb1\x10\x3f\xfd\x45\x4d\x17\xae\x83\x34\x09\x0a\x8f\x3f\xb2\xa5"
+    "\x6d\xf1\x0e\xc6\x3f\x46\xc9\x1e\xf1\xd8\x77\xd5\x59\xb5\xa5\x7b"
+    "\x4b\xa9\xab\xbe\x4a\x38\xef\x7f\xec\xe7\xab\xff\x86\x1c\x8d\x85"
+    "\x54\xb8\x7f\xd4\x5d\xc8\x3f\x6e\x41\xc0\xe2\xb4\xdc\x62\x71\x8e"
+    "\x0d\x4c\x20\xd6\x19\x49\x49\x47\x30\x8d\x65\x2f\x47\xc6\xdb\x1c"
+    "\x79\xd2\xe8\x05\x98\x9f\x71\xcf\xa0\xe7\x9e\xbe\x54\x00\x6c\xb2"
+    "\x64\xdb\x8d\x31\x56\x26\x76\xc8\x9a\xe6\x9c\x80\x96\x68\x87\x64"
+    "\xb7\xaa\x68\x60\xd8\x9c\xd4\x03\x4f\x52\x53\x49\x66\x19\x11\xca"
+    "\xd7\x2e\x9a\x92\x4e\x55\x73\xab\x73\xcd\x2d\xf0\x7f\x46\xbb\xfe"
+    "\x64\x69\x61\xdd\x8f\x9c\xf0\x76\x17\x6a\xd6\xb1\xac\x68\x22\xac"
+    "\x63\x84\xe9\x69\xed\xd9\xde\x60\xd1\x16\xab\xf0\x5f\x0b\xab\xa3"
+    "\xc7\x9c\xe2\x76\x46\x16\x98\xb7\xec\xa1\x19\xfe\x07\x3c\x6b\xda"
+    "\xd4\x49\x2c\x1d\x44\xc3\xeb\x5c\x7d\xa9\x3d\x83\x23\xd0\xf4\x94"
+    "\x8d\x66\xaa\x50\xb2\x7e\x78\x84\x0e\x06\x37\x35", 300
+}
+};
+
+#define MAX_IN_LEN 1000
+#define MAX_OUT_LEN 300
+
+static unsigned char in[MAX_IN_LEN];
+
+/*===----------------------------------------------------------------------===*/
+
+static int check_hash(const struct TEST_VECTOR *test, size_t chunk)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct HASH_LIMITS limits;
+    struct HASH_STATE state;
+    size_t pos;
+
+    ASSERT_SUCCESS(hash_limits(test->hash, &limits));
+    ASSERT_SUCCESS(hash_init(&state, test->hash, 0));
+
+    for (pos = 0; pos < test->in_len; pos += chunk)
+    {
+        size_t len = test->in_len - pos < chunk ? test->in_len - pos : chunk;
+        hash_update(&state, in + pos, len);
+    }
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, limits.digest_len);
+
+    /* The extendable output continues after the digest. */
+
+    if (test->out_len > limits.digest_len)
+    {
+        ASSERT_SUCCESS(hash_squeeze(&state, out + limits.digest_len,
+                                    test->out_len - limits.digest_len));
+
+        ASSERT_BUF_EQ(out, test->out, test->out_len);
+    }
+    else
+        ASSERT_FAILURE(hash_squeeze(&state, out, 1));
+
+    return 1;
+}
+
+static int check_squeeze(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct SHA3_STATE state;
+
+    if (test->hash == HASH_SHAKE128)
+        ASSERT_SUCCESS(shake128_init(&state, 0));
+    else
+        ASSERT_SUCCESS(shake256_init(&state, 0));
+
+    sha3_update(&state, in, test->in_len);
+
+    /* Read in pieces which straddle the output blocks. */
+    sha3_squeeze(&state, out, 1);
+    sha3_squeeze(&state, out + 1, 135);
+    sha3_squeeze(&state, out + 136, 0);
+    sha3_squeeze(&state, out + 136, 33);
+    sha3_squeeze(&state, out + 169, test->out_len - 169);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+/* Hashes four messages at once, and checks against hashing them one by one,
+ * with the messages at different offsets, so they are not all aligned. */
+static int check_hash4(prim_t hash, size_t len, size_t out_len)
+{
+    unsigned char out[4][MAX_OUT_LEN], ref[MAX_OUT_LEN];
+    struct HASH_LIMITS limits;
+    const void *msgs[4];
+    void *outs[4];
+    size_t t;
+
+    ASSERT_SUCCESS(hash_limits(hash, &limits));
+
+    for (t = 0; t < 4; ++t)
+    {
+        msgs[t] = in + 3 * t;
+        outs[t] = out[t];
+    }
+
+    ASSERT_SUCCESS(sha3_hash4(hash, msgs, len, outs, out_len));
+
+    for (t = 0; t < 4; ++t)
+    {
+        struct HASH_STATE state;
+
+        ASSERT_SUCCESS(hash_init(&state, hash, 0));
+        hash_update(&state, msgs[t], len);
+        hash_final(&state, ref);
+
+        if (out_len > limits.digest_len)
+            ASSERT_SUCCESS(hash_squeeze(&state, ref + limits.digest_len,
+                                        out_len - limits.digest_len));
+
+        ASSERT_BUF_EQ(out[t], ref, out_len);
+    }
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_sha3(void);
+int test_vectors_sha3(void)
+{
+#if WITH_SHA3
+    static const prim_t hashes[] =
+    {
+        HASH_SHA3_224, HASH_SHA3_256, HASH_SHA3_384,
+        HASH_SHA3_512, HASH_SHAKE128, HASH_SHAKE256
+    };
+
+    static const size_t lens[] = { 0, 71, 72, 167, 168, 500, 991 };
+
+    const void *msgs[4];
+    void *outs[4];
+    size_t t, i;
+
+    if (!prim_avail(HASH_SHA3_256))
+        return 1;
+
+    for (t = 0; t < MAX_IN_LEN; ++t)
+        in[t] = (unsigned char)(t % 251);
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+    {
+        if (!check_hash(tests + t, MAX_IN_LEN)) return 0;
+        if (!check_hash(tests + t, 7)) return 0;
+        if (!check_hash(tests + t, 150)) return 0;
+
+        if (tests[t].out_len == MAX_OUT_LEN)
+            if (!check_squeeze(tests + t)) return 0;
+    }
+
+    for (t = 0; t < ARRAY_SIZE(hashes); ++t)
+    {
+        struct HASH_LIMITS limits;
+
+        ASSERT_SUCCESS(hash_limits(hashes[t], &limits));
+
+        for (i = 0; i < ARRAY_SIZE(lens); ++i)
+        {
+            if (!check_hash4(hashes[t], lens[i], limits.digest_len))
+                return 0;
+
+            if (hashes[t] == HASH_SHAKE128 || hashes[t] == HASH_SHAKE256)
+                if (!check_hash4(hashes[t], lens[i], MAX_OUT_LEN))
+                    return 0;
+        }
+    }
+
+    /* The fixed-length variants only output their digest length. */
+
+    for (t = 0; t < 4; ++t)
+    {
+        msgs[t] = in;
+        outs[t] = in;
+    }
+
+    ASSERT_FAILURE(sha3_hash4(HASH_SHA3_256, msgs, 0, outs, 31));
+    ASSERT_FAILURE(sha3_hash4(HASH_SHA512, msgs, 0, outs, 64));
+#endif
+
+    return 1;
+}
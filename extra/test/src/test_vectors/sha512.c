@@ -0,0 +1,672 @@
+/*===-- test_vectors/sha512.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the SHA-512 hash function, and for SHA-384 and SHA-512/256
+*** which share its implementation.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+struct TEST_VECTOR
+{
+    const char *in;
+    size_t in_len;
+    const char *out;
+    size_t out_len;
+    prim_t hash;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    "", 0,
+    "\xcf\x83\xe1\x35\x7e\xef\xb8\xbd\xf1\x54\x28\x50\xd6\x6d\x80\x07"
+    "\xd6\x20\xe4\x05\x0b\x57\x15\xdc\x83\xf4\xa9\x21\xd3\x6c\xe9\xce"
+    "\x47\xd0\xd1\x3c\x5d\x85\xf2\xb0\xff\x83\x18\xd2\x87\x7e\xec\x2f"
+    "\x63\xb9\x31\xbd\x47\x41\x7a\x81\xa5\x38\x32\x7a\xf9\x27\xda\x3e", 64,
+    HASH_SHA512
+},
+{
+    "", 0,
+    "\x38\xb0\x60\xa7\x51\xac\x96\x38\x4c\xd9\x32\x7e\xb1\xb1\xe3\x6a"
+    "\x21\xfd\xb7\x11\x14\xbe\x07\x43\x4c\x0c\xc7\xbf\x63\xf6\xe1\xda"
+    "\x27\x4e\xde\xbf\xe7\x6f\x65\xfb\xd5\x1a\xd2\xf1\x48\x98\xb9\x5b", 48,
+    HASH_SHA384
+},
+{
+    "", 0,
+    "\xc6\x72\xb8\xd1\xef\x56\xed\x28\xab\x87\xc3\x62\x2c\x51\x14\x06"
+    "\x9b\xdd\x3a\xd7\xb8\xf9\x73\x74\x98\xd0\xc0\x1e\xce\xf0\x96\x7a", 32,
+    HASH_SHA512_256
+},
+{
+    "abc", 3,
+    "\xdd\xaf\x35\xa1\x93\x61\x7a\xba\xcc\x41\x73\x49\xae\x20\x41\x31"
+    "\x12\xe6\xfa\x4e\x89\xa9\x7e\xa2\x0a\x9e\xee\xe6\x4b\x55\xd3\x9a"
+    "\x21\x92\x99\x2a\x27\x4f\xc1\xa8\x36\xba\x3c\x23\xa3\xfe\xeb\xbd"
+    "\x45\x4d\x44\x23\x64\x3c\xe8\x0e\x2a\x9a\xc9\x4f\xa5\x4c\xa4\x9f", 64,
+    HASH_SHA512
+},
+{
+    "abc", 3,
+    "\xcb\x00\x75\x3f\x45\xa3\x5e\x8b\xb5\xa0\x3d\x69\x9a\xc6\x50\x07"
+    "\x27\x2c\x32\xab\x0e\xde\xd1\x63\x1a\x8b\x60\x5a\x43\xff\x5b\xed"
+    "\x80\x86\x07\x2b\xa1\xe7\xcc\x23\x58\xba\xec\xa1\x34\xc8\x25\xa7", 48,
+    HASH_SHA384
+},
+{
+    "abc", 3,
+    "\x53\x04\x8e\x26\x81\x94\x1e\xf9\x9b\x2e\x29\xb7\x6b\x4c\x7d\xab"
+    "\xe4\xc2\xd0\xc6\x34\xfc\x6d\x46\xe0\xe2\xf1\x31\x07\xe7\xaf\x23", 32,
+    HASH_SHA512_256
+},
+{
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56,
+    "\x20\x4a\x8f\xc6\xdd\xa8\x2f\x0a\x0c\xed\x7b\xeb\x8e\x08\xa4\x16"
+    "\x57\xc1\x6e\xf4\x68\xb2\x28\xa8\x27\x9b\xe3\x31\xa7\x03\xc3\x35"
+    "\x96\xfd\x15\xc1\x3b\x1b\x07\xf9\xaa\x1d\x3b\xea\x57\x78\x9c\xa0"
+    "\x31\xad\x85\xc7\xa7\x1d\xd7\x03\x54\xec\x63\x12\x38\xca\x34\x45", 64,
+    HASH_SHA512
+},
+{
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56,
+    "\x33\x91\xfd\xdd\xfc\x8d\xc7\x39\x37\x07\xa6\x5b\x1b\x47\x09\x39"
+    "\x7c\xf8\xb1\xd1\x62\xaf\x05\xab\xfe\x8f\x45\x0d\xe5\xf3\x6b\xc6"
+    "\xb0\x45\x5a\x85\x20\xbc\x4e\x6f\x5f\xe9\x5b\x1f\xe3\xc8\x45\x2b", 48,
+    HASH_SHA384
+},
+{
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56,
+    "\xbd\xe8\xe1\xf9\xf1\x9b\xb9\xfd\x34\x06\xc9\x0e\xc6\xbc\x47\xbd"
+    "\x36\xd8\xad\xa9\xf1\x18\x80\xdb\xc8\xa2\x2a\x70\x78\xb6\xa4\x61", 32,
+    HASH_SHA512_256
+},
+{
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+    "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 112,
+    "\x8e\x95\x9b\x75\xda\xe3\x13\xda\x8c\xf4\xf7\x28\x14\xfc\x14\x3f"
+    "\x8f\x77\x79\xc6\xeb\x9f\x7f\xa1\x72\x99\xae\xad\xb6\x88\x90\x18"
+    "\x50\x1d\x28\x9e\x49\x00\xf7\xe4\x33\x1b\x99\xde\xc4\xb5\x43\x3a"
+    "\xc7\xd3\x29\xee\xb6\xdd\x26\x54\x5e\x96\xe5\x5b\x87\x4b\xe9\x09", 64,
+    HASH_SHA512
+},
+{
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+    "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 112,
+    "\x09\x33\x0c\x33\xf7\x11\x47\xe8\x3d\x19\x2f\xc7\x82\xcd\x1b\x47"
+    "\x53\x11\x1b\x17\x3b\x3b\x05\xd2\x2f\xa0\x80\x86\xe3\xb0\xf7\x12"
+    "\xfc\xc7\xc7\x1a\x55\x7e\x2d\xb9\x66\xc3\xe9\xfa\x91\x74\x60\x39", 48,
+    HASH_SHA384
+},
+{
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+    "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu", 112,
+    "\x39\x28\xe1\x84\xfb\x86\x90\xf8\x40\xda\x39\x88\x12\x1d\x31\xbe"
+    "\x65\xcb\x9d\x3e\xf8\x3e\xe6\x14\x6f\xea\xc8\x61\xe1\x9b\x56\x3a", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05", 111,
+    "\x68\xcf\xfa\x6d\x0d\x76\xf3\x09\xc9\xce\x0d\x35\x28\x09\x39\xf8"
+    "\xe2\x59\x90\xc4\x3b\x7b\x08\x6c\xcd\xf7\x09\xbe\x35\xb0\x7d\x4d"
+    "\xdb\xa5\x99\x54\x1f\xf2\xb1\xc1\x9d\x34\xea\x49\xae\xaf\xb9\x65"
+    "\x9a\xdb\x7a\xc3\xc0\xb0\x78\xbb\x30\xa2\x2d\x57\xfc\x66\x87\xef", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05", 111,
+    "\x34\x13\x88\xa9\xdc\x22\x75\x07\x4e\x90\xcf\x39\x43\x23\x76\x19"
+    "\x19\x76\x1c\x80\x5f\xd9\xe3\x70\x97\x7c\x99\x66\xa0\xe8\xc8\x1a"
+    "\x52\x13\x5f\x02\x57\x76\x70\xb0\x07\x16\x38\xa4\xa2\x6d\xbc\x31", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05", 111,
+    "\x32\x88\x9a\x63\xb0\x0e\x93\xa9\x1d\xf0\x9b\x42\x92\x87\x5c\x8e"
+    "\x9e\xa2\xd3\x0e\x48\x2b\x2f\x5a\xb7\x13\x39\x62\x75\xe9\x37\x8b", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c", 112,
+    "\xd0\x86\x5c\x52\x4d\x1d\xdd\xf7\xc2\x3b\x79\x9c\x41\x3f\x5a\xdc"
+    "\xd7\xca\xef\xd3\xf6\x6a\x9b\x49\x75\x0e\xc8\x10\x66\x01\x2c\x25"
+    "\xa8\xbc\xf9\x4d\xde\xa6\xdc\x52\x56\x91\x67\x30\x97\xca\x40\xe0"
+    "\x10\x1e\x89\x7f\xc9\x72\x18\xcf\xdb\x07\x04\x08\x4e\x2b\xef\x4b", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c", 112,
+    "\x61\x9c\xc5\xd0\x61\x38\x52\x6d\x70\x65\x9e\xcc\xf6\x02\xd1\x97"
+    "\xe6\x3e\x10\x50\xe2\x20\x39\xa7\xfe\xb4\x0a\x30\xa5\xb2\xb0\x8f"
+    "\xb0\x37\x29\xe2\x91\xdf\x12\xf8\xc5\x76\xe6\xf1\xcd\x8a\xf2\x2a", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c", 112,
+    "\x46\x8a\x00\xc6\xf9\x38\x06\x51\x56\xbf\xdd\xf5\x6b\x22\x59\x2f"
+    "\x56\x90\x52\x58\x72\x64\x67\x3b\xc8\x93\xe9\x2c\xd1\x95\x39\x53", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75", 127,
+    "\xe0\xb6\xa2\x0f\x1c\x0c\x88\x97\x0a\x93\x40\x15\x2c\xd5\xa1\xc1"
+    "\xec\xf3\xd3\xb8\xde\x55\x10\x27\x41\x87\x94\x38\x07\x94\x73\x54"
+    "\x01\x33\xb8\x12\x70\x6e\x5d\xbe\xc3\x22\xc8\xc9\x52\x3b\x6f\xc8"
+    "\xc6\xd1\x6e\xe6\x26\xe8\x7a\xd5\xfe\x3d\x29\x16\xaf\xed\xc3\x69", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75", 127,
+    "\xf8\x23\x4a\xb8\x1f\x5f\x96\x41\xc6\x56\x68\x08\x25\xa9\xbb\xb3"
+    "\xc2\x61\x6b\xcc\x80\xb6\x5d\x5e\x47\x9a\x4d\x96\x74\x2e\x1b\x87"
+    "\x42\x33\x0c\x9e\x82\x56\xef\x5f\x03\xca\xa9\x32\x48\x70\x44\xca", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75", 127,
+    "\xb7\xc1\xbc\xb3\xd1\xd5\x23\x36\x41\x87\xe0\x23\xee\x03\x21\x06"
+    "\x74\xee\x05\xa8\xfd\x54\xd4\x0a\xad\x07\xec\xf6\xbd\xfe\x4c\x8c", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c", 128,
+    "\x99\xb1\x6f\x17\xaa\x0b\x96\x9a\x5b\x8f\x08\xf3\x67\x71\x9d\x51"
+    "\x6e\x33\x0c\xcd\x26\x60\xb6\xf0\x68\x8e\xc0\x31\xdb\xc7\x83\xde"
+    "\x50\xa1\xcd\x18\x5a\x25\x68\xdb\xa7\x50\x70\xa2\x40\x3d\x17\xd4"
+    "\x74\x1d\x16\x35\x78\x51\x5d\xfd\x2f\xf7\x56\xdd\xfe\x4d\x47\xb1", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c", 128,
+    "\xe8\x48\x0e\x9c\x4d\xd9\x0f\x88\x10\x4a\x79\xcb\xac\xce\xc4\x8e"
+    "\xdb\xd7\x98\xa1\x42\xb4\xf2\x41\xd7\x26\xdc\x25\x2f\x15\x02\x35"
+    "\x0e\x82\x4c\x7d\x18\xda\xdd\x59\xd7\xd7\x16\x91\x9f\xb8\xf9\xbf", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c", 128,
+    "\x5e\x14\xbd\x02\x08\x39\x7b\x56\xf5\xf1\xb3\xaf\xb8\xe4\x8b\xfc"
+    "\xce\x3c\x73\x12\x68\x4a\x46\xbb\xe9\xb2\x10\x50\x36\x80\xe5\x47", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83", 129,
+    "\xa1\x55\x6e\x29\x18\x57\x78\xaa\x59\x91\xe3\x4b\x88\x84\xc8\x40"
+    "\xd5\x89\xf0\xfb\xb4\xb8\xed\x59\x0e\x51\xe9\xac\x4e\xb0\x3a\x00"
+    "\x81\x25\x00\x0d\xb2\x67\x1f\x8f\xe7\xf4\x85\xb5\x9a\x77\xb5\x18"
+    "\x67\x00\x78\xec\xb4\x1a\x54\xb4\xcd\x02\xa7\xf1\xd2\xca\x4c\x6d", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83", 129,
+    "\x43\x01\x73\x38\x77\x64\x87\x46\x61\xac\xba\x1e\x91\x4e\x50\xf6"
+    "\xd0\xfb\xac\x53\x48\x09\xe8\x59\xb1\xda\x43\x96\xfa\xd3\xd5\xf2"
+    "\x4c\x25\xc6\xa2\xd0\x24\x86\xd8\xfb\xda\x39\x94\x71\x3d\x98\x1a", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83", 129,
+    "\x6c\x92\xb5\xcd\xba\x34\xee\x81\x37\xd9\x02\xba\x15\xd4\xf6\x24"
+    "\x6b\xb2\xa0\x7c\x0f\xef\x5a\x0f\xa5\x36\xbc\x8d\x8d\xb0\x39\x0f", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85", 239,
+    "\x18\xee\x83\xf3\x02\x61\xc3\xc6\x45\xd5\x2a\xee\x6a\x20\x91\x05"
+    "\xb2\x5b\xba\x39\xd3\x38\x45\xef\x48\x98\x4c\xc2\x38\xe4\xf2\x16"
+    "\x61\xfb\x7b\xd7\xdd\x43\x36\xf7\x1c\x40\xfe\x87\xd9\x5e\x51\x15"
+    "\xd6\xc7\xbe\x52\xe0\xd3\xe7\xe7\x87\x7d\x24\x50\x0b\x5b\x58\xdf", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85", 239,
+    "\xfc\x75\xde\xd1\x5c\x60\x80\xff\x96\xac\x03\x39\x1f\xc1\x30\x2c"
+    "\xa1\x80\x12\x8e\x4b\x6a\x4a\x2f\x17\x78\x2f\x2e\xc0\x16\xfc\x3f"
+    "\x79\xb4\x8b\x5f\xed\x33\x05\xfb\x7f\xdf\xf9\xfd\x29\x43\x45\x25", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85", 239,
+    "\xa5\x32\xf5\x07\x42\xde\x4e\xeb\x13\xa3\xcf\x3f\x57\xe1\xbb\x04"
+    "\x19\xb8\x08\xf9\x8d\xab\x37\x56\x63\x37\x03\x28\xf1\x55\xa7\xdb", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c", 240,
+    "\x9d\x60\xee\x60\xd2\x9e\xc4\xfa\x0b\x96\x90\xc0\x4c\x1c\x29\x41"
+    "\x3b\xbe\x3e\xd3\x45\x63\x91\x82\xd9\xd5\x3d\xcc\x05\x92\x6b\x77"
+    "\xb0\x4f\x4f\xec\x15\x62\xfb\x85\x18\x29\x54\xc9\x6b\x7c\xbb\x5d"
+    "\x5e\x44\x10\x25\x1f\xf4\xf3\x52\xd0\x9a\x2d\xa9\x04\x19\xfb\x13", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c", 240,
+    "\x4c\x4b\xc5\xda\xe1\x74\xdd\x68\xcb\x5a\x62\xe0\x66\xe0\x1e\x33"
+    "\x9e\x49\x80\xe4\xa3\x55\x31\xb7\x32\xdc\xf8\x8e\x9c\x57\x9e\x66"
+    "\xf7\xc0\xd0\x44\x77\x9e\x2e\xda\x8a\x59\x76\x84\xca\x7c\xff\xd6", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c", 240,
+    "\x50\xbf\x28\x5d\x85\x46\x44\xfd\xb2\x3f\x95\x5a\x2f\x6b\x19\xee"
+    "\x73\x90\x82\x64\x79\x01\xb3\x35\x5c\x2f\x57\x81\x5d\x9a\x6a\xf6", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc", 256,
+    "\xe4\x9c\x20\x8e\x41\x55\x6e\x85\x9d\x1a\x52\xd1\x47\x84\xa0\x61"
+    "\xc2\xd5\xae\x2c\x86\x90\xa5\x36\x0e\x9f\x93\x44\xf6\x08\x61\xc1"
+    "\x36\x2a\x9e\xc0\x5a\x9f\x08\xa4\x16\x7b\x3d\xa4\x1b\xdd\x12\x2a"
+    "\x38\x74\x13\xdd\x06\x97\x64\x70\xe4\xbe\xff\x50\x53\xf2\xac\x71", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc", 256,
+    "\x23\xf0\x63\x45\x52\xba\x15\x28\x9f\xa0\x2c\x8a\x37\xe3\xa3\x91"
+    "\xe7\x9e\x23\x0d\xca\x05\xdb\x03\xa7\x69\x66\x30\xc5\xba\x3a\x33"
+    "\x52\xd1\x62\x4f\x52\x83\x2e\x4d\x61\x83\xc0\xeb\x70\x19\x8e\x9a", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc", 256,
+    "\x5d\x6e\x63\x5d\x08\x16\x3e\x83\x21\xc1\xd7\xfb\x56\x5f\xe1\xd4"
+    "\x22\xf1\xfd\x85\x12\x00\xf9\xad\x16\xf9\x0e\xdb\x1c\x0b\x84\xaa", 32,
+    HASH_SHA512_256
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc"
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8", 500,
+    "\x06\x1f\x26\x45\x77\x5f\x33\x68\xaf\xf4\x5a\x22\xcc\x02\x4b\x5c"
+    "\xb2\xff\x79\xe7\x6c\x43\x05\xe3\x35\xb4\x7a\x86\xd1\x0d\x43\x51"
+    "\xe8\xe7\xd7\x60\x8b\xdf\x4b\x57\xdc\xbb\x7d\xc8\x31\x24\xca\x27"
+    "\x88\x37\x36\x87\x94\x78\xc3\x69\x73\x4d\x09\xaf\x55\x49\xc3\xea", 64,
+    HASH_SHA512
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc"
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8", 500,
+    "\x0b\x9b\xb7\x5f\xa1\xc2\x6a\x37\xc1\x38\xf1\xed\xc9\x42\x6e\x8b"
+    "\xdf\xae\x50\xdd\x8f\xd0\x56\x21\xd4\x6b\x18\x3c\x58\x13\x17\xfb"
+    "\x4e\xaf\xcf\x8a\x60\xd1\xc7\x0a\x23\x9b\x96\xe2\xe5\xe0\x4f\xd7", 48,
+    HASH_SHA384
+},
+{
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8\xaf\xb6\xbd\xc4\xcb\xd2\xd9\xe0\xe7\xee\xf5\xfc"
+    "\x03\x0a\x11\x18\x1f\x26\x2d\x34\x3b\x42\x49\x50\x57\x5e\x65\x6c"
+    "\x73\x7a\x81\x88\x8f\x96\x9d\xa4\xab\xb2\xb9\xc0\xc7\xce\xd5\xdc"
+    "\xe3\xea\xf1\xf8\xff\x06\x0d\x14\x1b\x22\x29\x30\x37\x3e\x45\x4c"
+    "\x53\x5a\x61\x68\x6f\x76\x7d\x84\x8b\x92\x99\xa0\xa7\xae\xb5\xbc"
+    "\xc3\xca\xd1\xd8\xdf\xe6\xed\xf4\xfb\x02\x09\x10\x17\x1e\x25\x2c"
+    "\x33\x3a\x41\x48\x4f\x56\x5d\x64\x6b\x72\x79\x80\x87\x8e\x95\x9c"
+    "\xa3\xaa\xb1\xb8\xbf\xc6\xcd\xd4\xdb\xe2\xe9\xf0\xf7\xfe\x05\x0c"
+    "\x13\x1a\x21\x28\x2f\x36\x3d\x44\x4b\x52\x59\x60\x67\x6e\x75\x7c"
+    "\x83\x8a\x91\x98\x9f\xa6\xad\xb4\xbb\xc2\xc9\xd0\xd7\xde\xe5\xec"
+    "\xf3\xfa\x01\x08\x0f\x16\x1d\x24\x2b\x32\x39\x40\x47\x4e\x55\x5c"
+    "\x63\x6a\x71\x78\x7f\x86\x8d\x94\x9b\xa2\xa9\xb0\xb7\xbe\xc5\xcc"
+    "\xd3\xda\xe1\xe8\xef\xf6\xfd\x04\x0b\x12\x19\x20\x27\x2e\x35\x3c"
+    "\x43\x4a\x51\x58\x5f\x66\x6d\x74\x7b\x82\x89\x90\x97\x9e\xa5\xac"
+    "\xb3\xba\xc1\xc8\xcf\xd6\xdd\xe4\xeb\xf2\xf9\x00\x07\x0e\x15\x1c"
+    "\x23\x2a\x31\x38\x3f\x46\x4d\x54\x5b\x62\x69\x70\x77\x7e\x85\x8c"
+    "\x93\x9a\xa1\xa8", 500,
+    "\xb6\x07\xe1\x7a\xa7\x69\x87\xff\x7a\x60\x1a\x4a\xe3\xda\x2a\x5e"
+    "\x21\xd9\x6d\x6f\x3b\x1c\x50\x69\x71\xe6\xfd\x7a\xed\x13\x9e\xb7", 32,
+    HASH_SHA512_256
+}
+};
+
+#define MAX_OUT_LEN 64
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct HASH_STATE state;
+    size_t split = test->in_len / 3;
+
+    ASSERT_SUCCESS(hash_init(&state, test->hash, 0));
+
+    hash_update(&state, test->in, test->in_len);
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* Again, with the input fed in two uneven pieces. */
+
+    ASSERT_SUCCESS(hash_init(&state, test->hash, 0));
+
+    hash_update(&state, test->in, split);
+    hash_update(&state, test->in + split, test->in_len - split);
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+int test_vectors_sha512(void);
+int test_vectors_sha512(void)
+{
+    size_t t;
+
+    if (!prim_avail(HASH_SHA512))
+        return 1;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+
+    return 1;
+}
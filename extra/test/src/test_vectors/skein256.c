@@ -3,12 +3,19 @@
 *** @file
 *** @brief Test Vectors
 ***
-*** Test vectors for the Skein-256 hash function.
+*** Test vectors for the Skein-256 hash function,  including keyed (Skein-MAC)
+*** and tree hashing. The keyed vectors end with an empty key, which should be
+*** the same as no key at all. The tree hashing inputs are the bytes 0xff, 0xfe,
+*** 0xfd, and so on (mod 256).
 **/
 /*===----------------------------------------------------------------------===*/
 
 #include "testenv.h"
 
+#if WITH_SKEIN256
+#include "ordo/primitives/hash_functions/skein256.h"
+#endif
+
 /*===----------------------------------------------------------------------===*/
 
 struct TEST_VECTOR
@@ -72,6 +79,57 @@ static const struct TEST_VECTOR tests[] =
     "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0", 48,
     "\x8a\x48\x42\xd9\xc1\xe9\xf2\x4e\x38\x86\xfc\x0b\x10\x75\x55\xf9"
     "\xed\xa8\x19\x77\x07\x74\x9c\xec\xc7\x77\x24\x02\xb2\xfe\xa0\xc5"
+},
+{
+    "", 0,
+    "\x9c\xc5\xac\x71\x88\x67\x28\x77\xc7\x22\x6d\x08\xcd\xef\x7c\x2d"
+    "\x20\xdd\xa4\x30\xa1\x75\xc3\xc5\xae\x94\x83\x99\x1f\x25\x54\x9c", 32,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f", 32}
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0", 48,
+    "\xf6\x6b\xfa\xc7\x4d\x93\x15\xec\x8d\x85\x34\xec\x25\x84\x5a\x77"
+    "\xc6\x41\x34\x70\x3f\xc6\xe9\x88\xf5\x53\x5b\x63\x4d\xff\x83\x53", 32,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f", 32}
+},
+{
+    "\xff", 1,
+    "\xa4\xb2\x03\x05\x69\x20\x5a\xec\x48\xd1\x9c\x34\x85\x28\x84\x81"
+    "\x05\x86\xb7\x1f\xb1\x88\x8f\x07\xd4\x4b\x43\x62\xfa\xdc\x9d\xb2", 32,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 },
+        "\x01", 1}
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0"
+    "\xbf\xbe\xbd\xbc\xbb\xba\xb9\xb8\xb7\xb6\xb5\xb4\xb3\xb2\xb1\xb0"
+    "\xaf\xae\xad\xac\xab\xaa\xa9\xa8\xa7\xa6\xa5\xa4\xa3\xa2\xa1\xa0"
+    "\x9f\x9e\x9d\x9c", 100,
+    "\xe2\xaa\xb3\x92\xbc\x27\xc0\x10\x2f\x5e\x7f\xda\x51\x69\xff\x3e"
+    "\x28\xa8\xc0\x8e\x46\xa6\xa2\xce\x0c\xe8\xeb\x49\xff\x2e\x1d\x5a", 32,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+        "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+        "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+        "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+        "\x60\x61\x62\x63", 100}
+},
+{
+    "", 0,
+    "\xc8\x87\x70\x87\xda\x56\xe0\x72\x87\x0d\xaa\x84\x3f\x17\x6e\x94"
+    "\x53\x11\x59\x29\x09\x4c\x3a\x40\xc4\x63\xa1\x96\xc2\x9b\xf7\xba", 32,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 },
+        "", 0}
 }
 };
 
@@ -82,18 +140,28 @@ static const struct TEST_VECTOR tests[] =
 static int check(const struct TEST_VECTOR *test)
 {
     unsigned char out[MAX_OUT_LEN];
-    struct HASH_STATE state;
+    struct HASH_STATE state, copy;
 
     ASSERT_SUCCESS(hash_init(&state, HASH_SKEIN256, test->use_params
                                                   ? &test->params
                                                   : 0));
 
+    hash_copy(&copy, &state);
+
     hash_update(&state, test->in, test->in_len);
 
     hash_final(&state, out);
 
     ASSERT_BUF_EQ(out, test->out, test->out_len);
 
+    /* The copy must be unaffected by the original. */
+
+    hash_update(&copy, test->in, test->in_len);
+
+    hash_final(&copy, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
     return 1;
 }
 
@@ -110,3 +178,152 @@ int test_vectors_skein256(void)
 
     return 1;
 }
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_SKEIN256
+
+struct TREE_TEST_VECTOR
+{
+    uint8_t tree_leaf, tree_fan, tree_max;
+    size_t in_len;
+    const char *out;
+};
+
+static const struct TREE_TEST_VECTOR tree_tests[] =
+{
+{
+    1, 1, 2, 0,
+    "\x4c\x25\x21\xb1\xd3\xce\x21\xb8\xea\x87\xe1\x26\x04\x4c\x1d\xef"
+    "\x8b\x01\x77\x2e\x4e\x38\x38\xf7\xb1\x91\xb6\x66\x64\xaa\x19\x0c"
+},
+{
+    1, 1, 2, 32,
+    "\x64\x1d\x86\xf7\x33\xa9\xc1\xcf\x0c\x45\x2f\x43\x45\x33\xd8\x6e"
+    "\xaf\x60\x3b\xb6\x6b\x8e\x20\x3c\x19\x2f\xc7\x80\x71\x33\x37\x20"
+},
+{
+    1, 1, 2, 64,
+    "\xef\x0c\x48\xfd\xd5\xa7\x0b\x65\x30\x65\xd1\xa8\xde\x45\x70\xed"
+    "\xd3\xb1\x52\x20\x6f\x75\xfc\x88\x8c\xc5\x41\x62\x4b\x0e\x4d\x8b"
+},
+{
+    1, 1, 2, 65,
+    "\x38\xbc\x57\x48\xe4\xd5\x7c\x63\xc0\x29\x78\xb8\xbd\xe3\x49\x1c"
+    "\x71\x0c\x11\x85\xed\xac\x82\x7a\xab\x7c\x40\x85\xdd\x15\x38\xa3"
+},
+{
+    1, 1, 2, 200,
+    "\xb5\x52\x37\xaf\x8d\x9a\x21\xee\xa9\x79\x8f\xc1\x33\x39\xf2\xb8"
+    "\x90\x47\x1d\xc5\xab\xb8\x45\x3b\x4f\xef\xe9\x23\x77\xa7\xda\xa7"
+},
+{
+    1, 1, 255, 200,
+    "\x34\xde\x9b\x24\x5c\xa6\xb3\x0e\xa8\xb4\x60\x43\xa9\xe1\x37\xfd"
+    "\xfc\x63\xcd\x20\xbd\xd2\xf4\x28\x1a\xa6\xa0\x6f\xe3\x9c\x41\xb2"
+},
+{
+    1, 1, 255, 1000,
+    "\x36\x79\x8a\xe5\xf3\xf3\x98\x77\x33\x4c\x06\x8c\xd8\x9f\xfe\xf3"
+    "\x91\xd9\x24\x8b\xa4\x1f\x8b\x65\xb4\x01\x0f\xcf\x31\x65\x5c\x92"
+},
+{
+    2, 2, 3, 1000,
+    "\xe6\x84\xc8\x10\x99\x25\x0e\x9b\x10\xd9\xf6\x94\x8f\x97\x99\x47"
+    "\xac\x00\xe4\x0c\xaa\x54\xf0\x77\xd6\x84\x2f\xc3\xa6\xe0\xe2\x07"
+},
+{
+    1, 2, 255, 4097,
+    "\xdc\x42\x89\xd1\xb6\x05\x2d\x8e\x7d\xf3\x0a\xa2\xbb\x5c\x97\x2f"
+    "\xc3\x9d\xea\x4d\xa1\x3c\xd5\x04\xf2\x59\x6a\x69\xaf\xe7\x03\x08"
+},
+{
+    3, 1, 2, 4097,
+    "\x72\x68\x43\x97\x3a\x34\xb2\x0f\x9f\x08\xce\xb0\x6c\xf2\x85\x14"
+    "\x06\x99\xe5\x54\x2b\x68\x2d\x61\x5a\xb6\xc9\x0f\x1c\xc9\x56\x20"
+},
+{
+    10, 1, 255, 300000,
+    "\xd9\x47\xd0\x70\xaf\xa0\x95\x21\xef\xc7\x52\xa5\x91\x7e\x4c\xfa"
+    "\xb5\xbc\x88\xb5\x54\x08\xb1\xf2\x2b\x54\x19\xed\x5d\xb7\x48\xe0"
+},
+{
+    10, 2, 3, 300000,
+    "\x72\xe8\xf8\x03\x20\x6c\xba\x18\xe0\x3a\xec\xba\x60\x53\xbe\x3a"
+    "\xa4\x1c\x15\xd9\x54\x68\xd0\xcb\x96\x4f\x68\x72\x23\x3f\x07\xdc"
+}
+};
+
+#define MAX_TREE_IN_LEN 300000
+
+static unsigned char tree_in[MAX_TREE_IN_LEN];
+
+static int check_tree(const struct TREE_TEST_VECTOR *test, size_t chunk)
+{
+    struct SKEIN256_PARAMS params = SKEIN256_PARAMS_DEFAULT;
+    struct SKEIN256_TREE_STATE state;
+    unsigned char out[32];
+    size_t pos;
+
+    params.tree_leaf = test->tree_leaf;
+    params.tree_fan = test->tree_fan;
+    params.tree_max = test->tree_max;
+
+    ASSERT_SUCCESS(skein256_tree_init(&state, &params));
+
+    for (pos = 0; pos < test->in_len; pos += chunk)
+    {
+        size_t len = test->in_len - pos < chunk ? test->in_len - pos : chunk;
+        skein256_tree_update(&state, tree_in + pos, len);
+    }
+
+    skein256_tree_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, 32);
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_skein256_tree(void);
+int test_vectors_skein256_tree(void)
+{
+#if WITH_SKEIN256
+    struct SKEIN256_PARAMS params = SKEIN256_PARAMS_DEFAULT;
+    struct SKEIN256_TREE_STATE state;
+    struct HASH_STATE hash;
+    size_t t;
+
+    if (!prim_avail(HASH_SKEIN256))
+        return 1;
+
+    for (t = 0; t < MAX_TREE_IN_LEN; ++t)
+        tree_in[t] = (unsigned char)(0xff - t);
+
+    for (t = 0; t < ARRAY_SIZE(tree_tests); ++t)
+    {
+        if (!check_tree(tree_tests + t, MAX_TREE_IN_LEN)) return 0;
+        if (!check_tree(tree_tests + t, 1000)) return 0;
+        if (!check_tree(tree_tests + t, 33)) return 0;
+    }
+
+    /* Invalid tree parameters (failure) */
+
+    ASSERT_FAILURE(skein256_tree_init(&state, 0));
+    ASSERT_FAILURE(skein256_tree_init(&state, &params));
+
+    params.tree_leaf = 1;
+    params.tree_fan = 1;
+    params.tree_max = 1;
+    ASSERT_FAILURE(skein256_tree_init(&state, &params));
+
+    /* ... which the sequential mode also rejects (failure) */
+
+    params.tree_max = 2;
+    ASSERT_SUCCESS(skein256_tree_init(&state, &params));
+    ASSERT_FAILURE(hash_init(&hash, HASH_SKEIN256, &params));
+#endif
+
+    return 1;
+}
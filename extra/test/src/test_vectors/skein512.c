@@ -0,0 +1,240 @@
+/*===-- test_vectors/skein512.c --------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the Skein-512 hash function, including keyed (Skein-MAC)
+*** hashing. The keyed vectors end with an empty key, which should be the same
+*** as no key at all.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+struct TEST_VECTOR
+{
+    const char *in;
+    size_t in_len;
+    const char *out;
+    size_t out_len;
+    int use_params;
+    struct SKEIN512_PARAMS params;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    "", 0,
+    "\xbc\x5b\x4c\x50\x92\x55\x19\xc2\x90\xcc\x63\x42\x77\xae\x3d\x62"
+    "\x57\x21\x23\x95\xcb\xa7\x33\xbb\xad\x37\xa4\xaf\x0f\xa0\x6a\xf4"
+    "\x1f\xca\x79\x03\xd0\x65\x64\xfe\xa7\xa2\xd3\x73\x0d\xbd\xb8\x0c"
+    "\x1f\x85\x56\x2d\xfc\xc0\x70\x33\x4e\xa4\xd1\xd9\xe7\x2c\xba\x7a", 64
+},
+{
+    "", 0,
+    "\xbc\x5b\x4c\x50\x92\x55\x19\xc2\x90\xcc\x63\x42\x77\xae\x3d\x62"
+    "\x57\x21\x23\x95\xcb\xa7\x33\xbb\xad\x37\xa4\xaf\x0f\xa0\x6a\xf4"
+    "\x1f\xca\x79\x03\xd0\x65\x64\xfe\xa7\xa2\xd3\x73\x0d\xbd\xb8\x0c"
+    "\x1f\x85\x56\x2d\xfc\xc0\x70\x33\x4e\xa4\xd1\xd9\xe7\x2c\xba\x7a", 64,
+    1, SKEIN512_PARAMS_DEFAULT
+},
+{
+    "\x00", 1,
+    "\x40\x28\x5f\x43\x36\x99\xa1\xd8\xc7\x99\xb2\x76\xcc\xf1\x80\x10"
+    "\xc9\xdc\x9d\x41\x8b\x0e\x8a\x4e\xd9\x87\xb4\x4c\x61\xc0\x1c\x5c"
+    "\xcb\xcc\x09\x77\xb1\xd3\x4a\x4d\x36\x65\xd2\x0e\x12\x71\x6d\xf9"
+    "\x34\xd2\x08\xfe\xa6\x60\x7f\x74\x96\x8e\xd8\x6b\xe3\xc9\x98\x32", 64
+},
+{
+    "\xff", 1,
+    "\x71\xb7\xbc\xe6\xfe\x64\x52\x22\x7b\x9c\xed\x60\x14\x24\x9e\x5b"
+    "\xf9\xa9\x75\x4c\x3a\xd6\x18\xcc\xc4\xe0\xaa\xe1\x6b\x31\x6c\xc8"
+    "\xca\x69\x8d\x86\x43\x07\xed\x3e\x80\xb6\xef\x15\x70\x81\x2a\xc5"
+    "\x27\x2d\xc4\x09\xb5\xa0\x12\xdf\x2a\x57\x91\x02\xf3\x40\x61\x7a", 64,
+    1, SKEIN512_PARAMS_DEFAULT
+},
+{
+    "\xff\xfe\xfd\xfc", 4,
+    "\x19\xd5\x9a\xac\x61\x1c\x22\xb8\x49\xa7\x79\x00\x46\x7c\x2a\x58"
+    "\xb5\x21\x7c\x5b\x22\x07\x3c\x95\x18\x27\x88\xb4\x99\x6e\xeb\xd5"
+    "\xf9\x23\xe6\x37\xa2\x95\xa7\xad\x2b\x35\xe8\x48\x7a\x7c\xef\xf9"
+    "\x8b\x23\xce\x5a\x52\x11\xd9\x85\x54\xe6\x38\x13\xc5\x9f\x84\x06", 64
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0", 32,
+    "\x0b\x7f\xd0\x53\xae\x63\x5e\xe8\xe5\x19\x64\x6e\xb4\x1e\xa0\xcf"
+    "\x7e\xa3\x40\x15\x23\x78\x06\x2f\xb2\x44\x0a\xa0\x25\x0f\xf1\x95"
+    "\xfe\x32\xd9\xa0\x69\x1e\x68\xa0\xfe\xb1\x7d\xc2\x85\xaa\x67\x56"
+    "\xce\xf1\x94\x04\xe4\xdb\x92\xbf\x83\x6c\x4a\xe6\x53\x81\x50\x4a", 64
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0", 64,
+    "\x45\x86\x3b\xa3\xbe\x0c\x4d\xfc\x27\xe7\x5d\x35\x84\x96\xf4\xac"
+    "\x9a\x73\x6a\x50\x5d\x93\x13\xb4\x2b\x2f\x5e\xad\xa7\x9f\xc1\x7f"
+    "\x63\x86\x1e\x94\x7a\xfb\x1d\x05\x6a\xa1\x99\x57\x5a\xd3\xf8\xc9"
+    "\xa3\xcc\x17\x80\xb5\xe5\xfa\x4c\xae\x05\x0e\x98\x98\x76\x62\x5b", 64
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0"
+    "\xbf", 65,
+    "\xe5\x06\x5d\xa3\xe1\xb6\x83\xcd\x7b\x9c\xa2\xd8\xe2\xf5\x62\x3f"
+    "\xba\xdd\x3c\x45\x24\x6d\x4b\x54\xa4\x0a\xaf\xdb\x27\x7d\x75\x05"
+    "\xb4\xa9\xc4\x5b\x8c\x6d\xab\x67\x19\xf7\xa0\x1f\x65\xf8\x31\x9d"
+    "\xd8\xaa\x60\xc7\x03\x56\x84\x4f\x43\x40\xf6\x10\xa1\x97\x92\xb2", 64
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0"
+    "\xbf\xbe\xbd\xbc\xbb\xba\xb9\xb8\xb7\xb6\xb5\xb4\xb3\xb2\xb1\xb0"
+    "\xaf\xae\xad\xac\xab\xaa\xa9\xa8\xa7\xa6\xa5\xa4\xa3\xa2\xa1\xa0"
+    "\x9f\x9e\x9d\x9c\x9b\x9a\x99\x98\x97\x96\x95\x94\x93\x92\x91\x90"
+    "\x8f\x8e\x8d\x8c\x8b\x8a\x89\x88\x87\x86\x85\x84\x83\x82\x81\x80", 128,
+    "\x91\xcc\xa5\x10\xc2\x63\xc4\xdd\xd0\x10\x53\x0a\x33\x07\x33\x09"
+    "\x62\x86\x31\xf3\x08\x74\x7e\x1b\xcb\xaa\x90\xe4\x51\xca\xb9\x2e"
+    "\x51\x88\x08\x7a\xf4\x18\x87\x73\xa3\x32\x30\x3e\x66\x67\xa7\xa2"
+    "\x10\x85\x6f\x74\x21\x39\x00\x00\x71\xf4\x8e\x8b\xa2\xa5\xad\xb7", 64
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0"
+    "\xbf\xbe\xbd\xbc\xbb\xba\xb9\xb8\xb7\xb6\xb5\xb4\xb3\xb2\xb1\xb0"
+    "\xaf\xae\xad\xac\xab\xaa\xa9\xa8\xa7\xa6\xa5\xa4\xa3\xa2\xa1\xa0"
+    "\x9f\x9e\x9d\x9c\x9b\x9a\x99\x98\x97\x96\x95\x94\x93\x92\x91\x90"
+    "\x8f\x8e\x8d\x8c\x8b\x8a\x89\x88\x87\x86\x85\x84\x83\x82\x81\x80"
+    "\x7f\x7e\x7d\x7c\x7b\x7a\x79\x78\x77\x76\x75\x74\x73\x72\x71\x70"
+    "\x6f\x6e\x6d\x6c\x6b\x6a\x69\x68\x67\x66\x65\x64\x63\x62\x61\x60"
+    "\x5f\x5e\x5d\x5c\x5b\x5a\x59\x58\x57\x56\x55\x54\x53\x52\x51\x50"
+    "\x4f\x4e\x4d\x4c\x4b\x4a\x49\x48\x47\x46\x45\x44\x43\x42\x41\x40"
+    "\x3f\x3e\x3d\x3c\x3b\x3a\x39\x38", 200,
+    "\xc8\x6f\xd5\x70\xe6\xe2\x2f\x95\xa5\xaf\xbb\xda\x96\x6b\xc0\xec"
+    "\xc2\xb2\x3b\xa6\x9e\x81\x81\xa5\xe6\x1a\xc3\x90\x91\xe0\x40\x65"
+    "\x3f\x94\xf8\xf2\xc4\xde\x01\x9b\x84\x0e\x5f\x25\x8b\xfe\x8a\xc0"
+    "\x23\xb5\xe7\xd0\x2b\x5e\xf1\xc0\x79\xc7\xdf\x9e\xb8\xc0\x3d\xfd", 64,
+    1, SKEIN512_PARAMS_DEFAULT
+},
+{
+    "", 0,
+    "\x54\xf7\x51\x85\x45\x76\x2b\x10\x03\xd5\x48\xdf\xdb\xc8\x17\x25"
+    "\x89\x4b\x30\xda\x23\xbd\x8c\x3d\xc0\x45\x64\x1e\xf8\x73\x61\xa6"
+    "\x58\x5b\x7e\xc2\x42\xa3\x39\x16\x7f\x84\x64\x45\xf2\xb6\x82\xe4"
+    "\xbe\x7d\x21\x6f\xc1\x2d\x24\x73\x5c\x53\x5c\x70\x3e\x45\xfb\xaf", 64,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+        "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f", 64}
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0", 64,
+    "\x29\xf4\x38\x4f\xf4\x3b\x30\xb4\xb2\xe8\xe1\x14\xd9\x26\x9c\x37"
+    "\x01\xc5\xf5\x04\x5b\xfb\x8c\xe0\x8f\x20\x3e\xe3\x41\x10\xff\xc4"
+    "\x95\x1c\x57\xa8\xb5\xc1\x2b\x97\xbc\x58\x29\x3b\x24\x67\xdd\x10"
+    "\x80\x40\x64\x1a\x9b\x00\xcb\x76\x19\x12\x13\xe6\x95\xed\xff\xc7", 64,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+        "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f", 64}
+},
+{
+    "\xff", 1,
+    "\x01\xec\x0f\x1c\x23\xa2\xda\x82\x9b\xc8\x42\xb2\x9f\x3b\xae\xba"
+    "\xd9\xe5\x16\x89\x47\x89\x5b\x8c\x42\xa7\x05\x56\x20\xac\xf9\x6e"
+    "\x4b\x26\x35\xe1\x27\xba\xd3\xcf\x40\x58\x87\x07\x54\x8d\x22\xb9"
+    "\xb9\xb0\xad\xce\xcd\xc9\x37\x76\x99\x06\x3e\x16\x1b\x36\x02\x7c", 64,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 },
+        "\x01", 1}
+},
+{
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0"
+    "\xbf\xbe\xbd\xbc\xbb\xba\xb9\xb8\xb7\xb6\xb5\xb4\xb3\xb2\xb1\xb0"
+    "\xaf\xae\xad\xac\xab\xaa\xa9\xa8\xa7\xa6\xa5\xa4\xa3\xa2\xa1\xa0"
+    "\x9f\x9e\x9d\x9c", 100,
+    "\x76\x04\xf6\xdf\xc9\x87\x9a\x89\x3c\x29\xf0\x11\xc9\xcb\xed\x8c"
+    "\x3d\x32\x3d\xd8\x1b\x62\xc8\x95\x8d\x85\xe2\x21\x43\xb0\x93\x34"
+    "\xbe\x0b\x4e\x82\x6d\x23\x49\x3a\xce\xb2\xbd\x25\x93\xb2\xad\x82"
+    "\x74\x5c\x70\x01\x12\xfa\x62\x53\x6b\x41\xa8\xdc\xf5\x35\xe4\x23", 64,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 },
+        "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0a\x0b\x0c\x0d\x0e\x0f"
+        "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+        "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+        "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+        "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+        "\x60\x61\x62\x63", 100}
+},
+{
+    "", 0,
+    "\xbc\x5b\x4c\x50\x92\x55\x19\xc2\x90\xcc\x63\x42\x77\xae\x3d\x62"
+    "\x57\x21\x23\x95\xcb\xa7\x33\xbb\xad\x37\xa4\xaf\x0f\xa0\x6a\xf4"
+    "\x1f\xca\x79\x03\xd0\x65\x64\xfe\xa7\xa2\xd3\x73\x0d\xbd\xb8\x0c"
+    "\x1f\x85\x56\x2d\xfc\xc0\x70\x33\x4e\xa4\xd1\xd9\xe7\x2c\xba\x7a", 64,
+    1, {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 },
+        "", 0}
+}
+};
+
+#define MAX_OUT_LEN 64
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct HASH_STATE state, copy;
+
+    ASSERT_SUCCESS(hash_init(&state, HASH_SKEIN512, test->use_params
+                                                  ? &test->params
+                                                  : 0));
+
+    hash_copy(&copy, &state);
+
+    hash_update(&state, test->in, test->in_len);
+
+    hash_final(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    /* The copy must be unaffected by the original. */
+
+    hash_update(&copy, test->in, test->in_len);
+
+    hash_final(&copy, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    return 1;
+}
+
+int test_vectors_skein512(void);
+int test_vectors_skein512(void)
+{
+    size_t t;
+
+    if (!prim_avail(HASH_SKEIN512))
+        return 1;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+
+    return 1;
+}
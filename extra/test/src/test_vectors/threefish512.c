@@ -0,0 +1,187 @@
+/*===-- test_vectors/threefish512.c ----------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the Threefish-512 block cipher.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+struct TEST_VECTOR
+{
+    const char *key;
+    size_t key_len;
+    const char *in;
+    size_t in_len;
+    const char *out;
+    size_t out_len;
+    int use_params;
+    struct THREEFISH512_PARAMS params;
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 64,
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+    "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", 64,
+    "\xb1\xa2\xbb\xc6\xef\x60\x25\xbc\x40\xeb\x38\x22\x16\x1f\x36\xe3"
+    "\x75\xd1\xbb\x0a\xee\x31\x86\xfb\xd1\x9e\x47\xc5\xd4\x79\x94\x7b"
+    "\x7b\xc2\xf8\x58\x6e\x35\xf0\xcf\xf7\xe7\xf0\x30\x84\xb0\xb7\xb1"
+    "\xf1\xab\x39\x61\xa5\x80\xa3\xe9\x7e\xb4\x1e\xa1\x4a\x6d\x7b\xbe", 64
+},
+{
+    "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1a\x1b\x1c\x1d\x1e\x1f"
+    "\x20\x21\x22\x23\x24\x25\x26\x27\x28\x29\x2a\x2b\x2c\x2d\x2e\x2f"
+    "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+    "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f", 64,
+    "\xff\xfe\xfd\xfc\xfb\xfa\xf9\xf8\xf7\xf6\xf5\xf4\xf3\xf2\xf1\xf0"
+    "\xef\xee\xed\xec\xeb\xea\xe9\xe8\xe7\xe6\xe5\xe4\xe3\xe2\xe1\xe0"
+    "\xdf\xde\xdd\xdc\xdb\xda\xd9\xd8\xd7\xd6\xd5\xd4\xd3\xd2\xd1\xd0"
+    "\xcf\xce\xcd\xcc\xcb\xca\xc9\xc8\xc7\xc6\xc5\xc4\xc3\xc2\xc1\xc0", 64,
+    "\xe3\x04\x43\x96\x26\xd4\x5a\x2c\xb4\x01\xca\xd8\xd6\x36\x24\x9a"
+    "\x63\x38\x33\x0e\xb0\x6d\x45\xdd\x8b\x36\xb9\x0e\x97\x25\x47\x79"
+    "\x27\x2a\x0a\x8d\x99\x46\x35\x04\x78\x44\x20\xea\x18\xc9\xa7\x25"
+    "\xaf\x11\xdf\xfe\xa1\x01\x62\x34\x89\x27\x67\x3d\x5c\x1c\xaf\x3d", 64,
+    1, {{ UINT64_C(0x0706050403020100), UINT64_C(0x0f0e0d0c0b0a0908) }}
+},
+{
+    "\x04\xd0\x70\x24\x54\xe3\x69\x5c\xed\x9f\x67\xc8\x2b\x38\x3d\x3d"
+    "\x01\xd3\xbf\x19\x7f\x8f\x69\x1f\x85\x5b\xb6\x04\xe4\xfb\x43\xd0"
+    "\xd6\xd0\x18\x9f\xda\x99\xaa\x45\x05\x3e\x11\xaf\x35\x5c\xb7\x2d"
+    "\x73\xb5\x7e\xb2\x99\x8a\x05\x2d\xd6\x02\xd8\x24\xc5\x97\x72\x4e", 64,
+    "\xc1\x32\x85\x8e\x6c\x23\xf6\xb1\x38\x9a\x2a\xb1\x78\xe3\x13\x8e"
+    "\x13\x2f\x59\xa3\xe2\x92\xa6\x98\x28\x60\xd8\x1f\xf1\xac\xd9\x17"
+    "\x8a\xc6\x39\xc5\xa7\xf2\x18\x0e\xed\x8e\xb9\x01\xf8\x07\xcb\x0a"
+    "\xdd\x82\x9a\x05\x5f\xb5\x2d\x31\xd5\x14\x4a\x52\xea\x8f\xdf\x73", 64,
+    "\x5e\x27\xe9\x32\x80\x78\xd5\x1e\x07\xd8\xa8\xd2\x39\x35\x69\x6e"
+    "\xfe\x75\xa2\xaa\x78\x38\xe2\x50\x91\xe6\x99\xe9\x9d\x30\xa2\x50"
+    "\xdd\x10\xb4\xf0\x13\xcc\xae\x34\x93\x58\x44\x57\x60\x02\x5e\x20"
+    "\xbe\x94\xd0\x4b\xc9\x89\x17\xce\x15\x15\x8e\x42\xba\x0a\x76\xc8", 64
+},
+{
+    "\xe3\x48\xe5\x3d\x3c\x81\xaf\xf7\xc6\x08\x3a\x5c\xca\xb4\x82\x1b"
+    "\x11\x5b\x44\x96\x14\x5a\x54\x67\x8f\x7e\xe2\xb7\x3d\x07\x9e\x1f"
+    "\x93\x40\xda\x5f\x0c\x30\x1a\x78\x6d\x10\x3d\x7c\x85\x4e\x15\xea"
+    "\xce\x22\x11\x1b\x41\x0d\x7b\x95\xe3\x14\x48\x99\xeb\x34\x6c\x64", 64,
+    "\xae\xf9\xbf\x50\x71\xd6\x45\xee\xb8\x85\xfb\xd4\x96\x21\x52\xef"
+    "\xba\xa9\xd0\xde\xd3\xe0\x9a\x08\x93\xf1\xed\xdc\xfb\x4e\xae\x4c"
+    "\x45\xe5\x09\x16\xc3\xa0\xe6\x8f\x8e\xd8\x0a\xeb\x55\x49\xa1\x34"
+    "\x4b\xe1\xfd\x25\x9e\xc2\x82\x0b\xec\xfd\x73\x22\xba\x02\xe1\x59", 64,
+    "\xe8\x2a\xe3\xe7\x9c\x70\x82\x70\x9d\x60\x35\x48\xf2\x64\xf2\x9f"
+    "\x76\xa7\xfd\xf4\xa2\xf1\x30\x76\x1e\x1f\x45\x3e\xe3\x52\xc1\x21"
+    "\x88\x66\x39\xe0\x01\xcc\x88\xfd\xd5\xe7\xe1\xe7\x91\xc4\x2a\x19"
+    "\x56\xd2\xc3\x0f\x64\xc7\xfa\x72\x93\x03\x31\xa6\xbb\xd2\x8b\x61", 64,
+    1, {{ UINT64_C(0x43fbbdde5279e598), UINT64_C(0x3a3cffc67e483063) }}
+},
+{
+    "\x47\x9b\x40\x7a\x76\xac\xf0\x78\xec\xd9\xc6\x99\x92\x17\x1e\x2e"
+    "\xeb\x11\x42\xfa\xdb\x7e\x67\xb9\xdc\xbe\x97\xdc\x94\x9e\x32\xa7"
+    "\x96\xf8\x12\xcd\x0d\x38\x70\xc4\x16\x02\x04\x7d\xc7\x65\x57\x26"
+    "\x94\x33\x03\x21\xef\x15\xa5\x90\x54\x78\xdb\xcf\xe1\x02\xea\xdc", 64,
+    "\xba\xbc\x4d\x94\x04\xaa\xb0\xc0\x4c\x4a\x61\x67\xd0\x32\x81\x80"
+    "\x60\x86\x85\x7d\x88\x2c\x88\x90\x4a\xc5\x18\x56\xb0\x45\x2a\x79"
+    "\x19\xb6\xcb\xbe\x2a\xe4\x22\xac\x6c\x7a\xeb\x66\x8e\x8c\xd4\x6c"
+    "\xac\x86\x45\x17\x73\x85\x43\x43\x3e\xdb\xff\x83\x58\xa4\x0b\x32", 64,
+    "\xd9\x68\x2b\xc4\x8d\x9a\x78\xbb\x85\xc5\x34\x56\xe0\x16\x3b\x3f"
+    "\x89\x7a\x56\xfd\x55\xc3\x96\x34\xc1\x71\xa1\x66\x85\x39\x4c\x73"
+    "\xca\xd3\x36\xa1\xa3\x5f\xde\x94\xcc\x62\xa3\x23\x04\x19\xfa\x58"
+    "\x5a\xe2\x5f\x2f\x29\x0a\xc4\x1a\xbe\x20\x1b\x0f\x5d\xd1\x21\x06", 64
+},
+{
+    "\x65\xb2\x51\xc8\xf0\x58\xf7\xbf\xca\x58\x6c\x78\x17\xad\xc7\x38"
+    "\xcc\x96\x17\x3c\xbf\x7c\x16\x75\x5b\x27\x85\x84\x70\xc0\xd8\x1a"
+    "\xe4\xf8\x52\xf1\x67\xf7\xf9\x61\x45\x3c\x8e\x0f\x88\x5c\xe7\x54"
+    "\x55\x86\xb2\xde\x0f\xe8\xa4\x90\xa7\x78\xd9\xee\xfa\x30\x88\xeb", 64,
+    "\xa4\x5d\xf1\x27\x4d\xf1\xff\x95\x40\xe1\xfa\x5c\xd1\x7e\xee\x9e"
+    "\x0a\x38\xfc\x0a\x11\x2c\x8e\x26\x4e\x2f\x92\xc8\x51\xf2\x21\x73"
+    "\xa4\x65\x34\x5e\xd0\x4b\xe6\xb7\x65\xb6\xe5\xd4\x38\xbc\xe2\x85"
+    "\xb5\x31\x22\x54\x33\x05\xe9\x4c\xa4\x32\x71\x20\x45\x29\x1f\xca", 64,
+    "\xdc\x08\x48\x69\x70\xa5\x8b\xa0\x78\x5a\x6e\xd7\xed\x6d\x72\x1c"
+    "\x9d\x24\x96\x15\x3a\x09\xe0\x21\xa7\x32\xe6\x7f\x87\x36\x6b\x6b"
+    "\x5a\x78\xea\x84\x52\xe7\x24\x23\xb3\x73\xbc\xfb\xda\xca\x9d\xff"
+    "\x61\x70\x76\xfd\xee\x90\xfc\x32\xa1\xf8\x2f\x64\x3f\xf9\x49\xf5", 64,
+    1, {{ UINT64_C(0xa7260b50b9a30856), UINT64_C(0x275649a65883c1f9) }}
+},
+{
+    "\x94\x92\xd4\x73\x25\xa7\x4d\xf7\xde\x51\x4e\x05\x99\x2b\x3f\xbb"
+    "\x7c\x86\xb5\xd0\x15\x96\xf6\x42\xf5\xb2\x9b\x9f\x68\xb8\xaa\xbc"
+    "\x3b\x22\xa8\x4d\xb3\xab\x72\xda\x2b\x9f\xb1\x4a\x32\xb6\xd2\x0d"
+    "\xd8\x00\x6f\x80\xe0\x64\x6a\xda\x67\x3e\xd5\x94\x4b\xd0\x07\x74", 64,
+    "\xe8\x0c\x82\x18\x5a\x2a\xc8\x18\x84\x66\x90\x51\x88\xd9\xac\xfb"
+    "\x8c\x46\x06\x39\xa5\xee\x28\x15\x3f\x8a\x2f\x10\x4e\xc6\xfe\x44"
+    "\x70\x90\xd5\xba\xbc\xa2\xd2\x26\x0b\x4a\xec\x34\x70\x40\x4b\x39"
+    "\x0d\x39\xb6\x7f\xb7\x0a\xc3\x2c\x00\x88\x6e\x8c\x68\xf8\x6a\x2a", 64,
+    "\x74\x99\xc8\x23\x71\xb4\x8c\x74\x3d\xce\x93\x90\x85\x8b\x6c\xf1"
+    "\x1b\xc8\x93\x60\xdd\x94\x37\xe0\xc6\x43\x7f\x85\x43\x59\x77\x76"
+    "\x8f\x91\xc5\x1e\x62\x38\x9c\x87\x29\x8d\xb2\x1b\x71\xf6\x14\x36"
+    "\x9e\x72\x1d\x39\xe8\xcc\xc2\x11\x8d\xe7\x80\x65\xaa\x27\x17\x0c", 64
+},
+{
+    "\x37\xba\xea\xfc\x86\x3a\x05\xce\x1b\xc3\x2c\x01\x97\x36\x13\x0f"
+    "\x75\x14\x02\x48\xb6\x0b\xf0\x18\x45\xdb\x65\x37\xc2\x42\x75\xe8"
+    "\x4c\x88\x0b\x17\x8a\xe5\xcd\xe0\x4c\xb9\xf9\x9c\xab\xec\x31\xaa"
+    "\xa5\x27\x71\x03\x2f\xcf\x18\x7d\xbf\x7b\xa8\x61\x42\x00\x57\xd1", 64,
+    "\xf6\xa2\xc8\xf9\x32\x5d\x73\xfc\x54\x98\x42\xbf\x0a\xc6\x4b\xd8"
+    "\xa2\x41\x9e\x66\xf3\xfb\xcf\x95\x6c\x4a\x37\x09\x05\xaf\x46\x16"
+    "\xea\x52\x78\x0c\x26\xb8\x34\x45\xd1\xe1\xc1\xcd\x9d\xf8\x1d\x1b"
+    "\x78\x83\xfe\x56\x42\x92\xc1\xa8\xfb\xb5\xfb\x2a\x79\xe8\xe5\x26", 64,
+    "\x3c\xa8\x17\xae\x9c\x2a\xf7\xfb\xb0\x71\xcc\xf8\x0d\x34\x1c\xad"
+    "\x12\x84\xf3\x60\x06\x19\x39\xd7\x0b\xd4\x3b\x18\xce\x1f\x1a\x20"
+    "\xc1\xcf\x62\x55\x4e\xf0\x19\xd9\x13\x99\x0d\x6a\xea\x02\xce\xd9"
+    "\x50\x03\xf4\x44\x27\xfb\xdb\xce\x6a\xb4\x55\x82\x93\xd2\x88\x67", 64,
+    1, {{ UINT64_C(0x17c2d13ee9f1d7eb), UINT64_C(0x4ba5b950cdc0374b) }}
+}
+};
+
+#define MAX_OUT_LEN 64
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    unsigned char out[MAX_OUT_LEN];
+    struct BLOCK_STATE state;
+
+    ASSERT_SUCCESS(block_init(&state, test->key, test->key_len,
+                              BLOCK_THREEFISH512, test->use_params
+                                                ? &test->params
+                                                : 0));
+
+    memcpy(out, test->in, test->in_len);
+
+    block_forward(&state, out);
+
+    ASSERT_BUF_EQ(out, test->out, test->out_len);
+
+    block_inverse(&state, out);
+
+    ASSERT_BUF_EQ(out, test->in, test->in_len);
+
+    block_final(&state);
+
+    return 1;
+}
+
+int test_vectors_threefish512(void);
+int test_vectors_threefish512(void)
+{
+    size_t t;
+
+    if (!prim_avail(BLOCK_THREEFISH512))
+        return 1;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+
+    return 1;
+}
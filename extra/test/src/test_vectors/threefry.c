@@ -0,0 +1,158 @@
+/*===-- test_vectors/threefry.c --------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Test vectors for the Threefry module. Those for 13 and 20 rounds are from
+*** the known-answer tests of Random123, and those for 72 rounds are the same
+*** as Threefish-256 with a zero tweak, the first being from the Skein paper.
+*** Each counter is also computed among others by threefry_bulk().
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_THREEFISH256
+
+struct TEST_VECTOR
+{
+    int rounds;
+    uint64_t key[THREEFRY_WORDS];
+    uint64_t counter[THREEFRY_WORDS];
+    uint64_t out[THREEFRY_WORDS];
+};
+
+static const struct TEST_VECTOR tests[] =
+{
+{
+    13,
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x4071fabee1dc8e05), UINT64_C(0x02ed3113695c9c62),
+      UINT64_C(0x397311b5b89f9d49), UINT64_C(0xe21292c3258024bc) }
+},
+{
+    20,
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x09218ebde6c85537), UINT64_C(0x55941f5266d86105),
+      UINT64_C(0x4bd25e16282434dc), UINT64_C(0xee29ec846bd2e40b) }
+},
+{
+    72,
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000),
+      UINT64_C(0x0000000000000000), UINT64_C(0x0000000000000000) },
+    { UINT64_C(0x94eeea8b1f2ada84), UINT64_C(0xadf103313eae6670),
+      UINT64_C(0x952419a1f4b16d53), UINT64_C(0xd83f13e63c9f6b11) }
+},
+{
+    13,
+    { UINT64_C(0x452821e638d01377), UINT64_C(0xbe5466cf34e90c6c),
+      UINT64_C(0xc0ac29b7c97c50dd), UINT64_C(0x3f84d5b5b5470917) },
+    { UINT64_C(0x243f6a8885a308d3), UINT64_C(0x13198a2e03707344),
+      UINT64_C(0xa4093822299f31d0), UINT64_C(0x082efa98ec4e6c89) },
+    { UINT64_C(0x4361288ef9c1900c), UINT64_C(0x8717291521782833),
+      UINT64_C(0x0d19db18c20cf47e), UINT64_C(0xa0b41d63ac8581e5) }
+},
+{
+    20,
+    { UINT64_C(0x452821e638d01377), UINT64_C(0xbe5466cf34e90c6c),
+      UINT64_C(0xc0ac29b7c97c50dd), UINT64_C(0x3f84d5b5b5470917) },
+    { UINT64_C(0x243f6a8885a308d3), UINT64_C(0x13198a2e03707344),
+      UINT64_C(0xa4093822299f31d0), UINT64_C(0x082efa98ec4e6c89) },
+    { UINT64_C(0xbb893fd42eac50eb), UINT64_C(0x7ca8b22905f3443a),
+      UINT64_C(0xe204b8dcb4daace7), UINT64_C(0x3e1070a2327bfc09) }
+},
+{
+    72,
+    { UINT64_C(0x452821e638d01377), UINT64_C(0xbe5466cf34e90c6c),
+      UINT64_C(0xc0ac29b7c97c50dd), UINT64_C(0x3f84d5b5b5470917) },
+    { UINT64_C(0x243f6a8885a308d3), UINT64_C(0x13198a2e03707344),
+      UINT64_C(0xa4093822299f31d0), UINT64_C(0x082efa98ec4e6c89) },
+    { UINT64_C(0xaf0cd57b6160473f), UINT64_C(0x03db830d05bd1dea),
+      UINT64_C(0x4e72d5588850d160), UINT64_C(0xc825972f0d576b49) }
+},
+{
+    13,
+    { UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+      UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff) },
+    { UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+      UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff) },
+    { UINT64_C(0x7eaed935479722b5), UINT64_C(0x90994358c429f31c),
+      UINT64_C(0x496381083e07a75b), UINT64_C(0x627ed0d746821121) }
+},
+{
+    20,
+    { UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+      UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff) },
+    { UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff),
+      UINT64_C(0xffffffffffffffff), UINT64_C(0xffffffffffffffff) },
+    { UINT64_C(0x29c24097942bba1b), UINT64_C(0x0371bbfb0f6f4e11),
+      UINT64_C(0x3c231ffa33f83a1c), UINT64_C(0xcd29113fde32d168) }
+}
+};
+
+#define BULK (9)
+
+/*===----------------------------------------------------------------------===*/
+
+static int check(const struct TEST_VECTOR *test)
+{
+    uint64_t out[THREEFRY_WORDS], bulk[BULK][THREEFRY_WORDS];
+    uint64_t counter[THREEFRY_WORDS];
+    struct THREEFRY_CTX ctx;
+    size_t t;
+
+    if (!prim_avail(BLOCK_THREEFISH256))
+        return 1;
+
+    ASSERT_SUCCESS(threefry_init(&ctx, test->key, test->rounds));
+
+    threefry_eval(&ctx, test->counter, out);
+    ASSERT_BUF_EQ(out, test->out, sizeof(out));
+
+    /* The test counter is in every position of a bulk computation, so
+     * that the counters of some of them carry into the next words. */
+    for (t = 0; t < BULK; ++t)
+    {
+        size_t k;
+
+        memcpy(counter, test->counter, sizeof(counter));
+
+        for (k = 0; k < t; ++k)
+            if (!counter[0]--)
+                if (!counter[1]--)
+                    if (!counter[2]--)
+                        --counter[3];
+
+        threefry_bulk(&ctx, counter, bulk[0], BULK);
+        ASSERT_BUF_EQ(bulk[t], test->out, sizeof(out));
+    }
+
+    threefry_final(&ctx);
+
+    return 1;
+}
+
+#endif
+
+int test_vectors_threefry(void);
+int test_vectors_threefry(void)
+{
+#if WITH_THREEFISH256
+    size_t t;
+
+    for (t = 0; t < ARRAY_SIZE(tests); ++t)
+        if (!check(tests + t)) return 0;
+#endif
+
+    return 1;
+}
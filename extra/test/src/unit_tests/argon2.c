@@ -0,0 +1,76 @@
+/*===-- unit_tests/argon2.c ------------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the Argon2 module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+int test_argon2_precond(void);
+int test_argon2_precond(void)
+{
+#if WITH_BLAKE2B
+    struct ARGON2_PARAMS params = { ARGON2_ID, 1, 8, 1, 0, 0, 0, 0 };
+    unsigned char pwd[4] = {0};
+    unsigned char salt[8] = {0};
+    unsigned char out[4];
+
+    if (!prim_avail(HASH_BLAKE2B))
+        return 1;
+
+    /* Smallest parameters, zero length password (success) */
+
+    ASSERT_SUCCESS(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out)));
+
+    ASSERT_SUCCESS(kdf_argon2(&params, pwd, 0,
+                              salt, sizeof(salt), out, sizeof(out)));
+
+    /* Salt or output too short (failure) */
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt) - 1, out, sizeof(out)));
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out) - 1));
+
+    /* Invalid type (failure) */
+
+    params.type = 3;
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out)));
+
+    params.type = ARGON2_ID;
+
+    /* Zero passes (failure) */
+
+    params.passes = 0;
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out)));
+
+    params.passes = 1;
+
+    /* Less than eight blocks per lane (failure) */
+
+    params.lanes = 2;
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out)));
+
+    /* Zero lanes (failure) */
+
+    params.lanes = 0;
+
+    ASSERT_FAILURE(kdf_argon2(&params, pwd, sizeof(pwd),
+                              salt, sizeof(salt), out, sizeof(out)));
+#endif
+
+    return 1;
+}
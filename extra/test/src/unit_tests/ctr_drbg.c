@@ -0,0 +1,81 @@
+/*===-- unit_tests/ctr_drbg.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the CTR_DRBG module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+int test_ctr_drbg_precond(void);
+int test_ctr_drbg_precond(void)
+{
+#if WITH_AES
+    static unsigned char large[3 * 65536 + 5];
+    unsigned char seed[CTR_DRBG_SEED_LEN + 1] = {0};
+    unsigned char out[2][16];
+    struct CTR_DRBG_CTX ctx, same;
+
+    if (!prim_avail(BLOCK_AES))
+        return 1;
+
+    /* Wrong seed length (failure) */
+
+    ASSERT_FAILURE(ctr_drbg_seed(&ctx, seed, CTR_DRBG_SEED_LEN - 1, 0, 0));
+    ASSERT_FAILURE(ctr_drbg_seed(&ctx, seed, CTR_DRBG_SEED_LEN + 1, 0, 0));
+
+    /* Personalization string too long (failure) */
+
+    ASSERT_FAILURE(ctr_drbg_seed(&ctx, seed, CTR_DRBG_SEED_LEN,
+                                 seed, CTR_DRBG_SEED_LEN + 1));
+
+    ASSERT_FAILURE(ctr_drbg_init(&ctx, seed, CTR_DRBG_SEED_LEN + 1, 0));
+
+    /* Reseed interval too long (failure) */
+
+    ASSERT_FAILURE(ctr_drbg_init(&ctx, 0, 0, CTR_DRBG_MAX_INTERVAL + 1));
+
+    /* Seeded from the OS, outputs and reseeds (success) */
+
+    ASSERT_SUCCESS(ctr_drbg_init(&ctx, seed, CTR_DRBG_SEED_LEN, 0));
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out[0], sizeof(out[0])));
+    ASSERT_SUCCESS(ctr_drbg_reseed(&ctx, seed, CTR_DRBG_SEED_LEN));
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out[1], sizeof(out[1])));
+    ASSERT(memcmp(out[0], out[1], sizeof(out[0])));
+
+    /* Additional input too long (failure) */
+
+    ASSERT_FAILURE(ctr_drbg_reseed(&ctx, seed, CTR_DRBG_SEED_LEN + 1));
+
+    /* Outputs longer than one request (success) */
+
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, large, sizeof(large)));
+    ctr_drbg_final(&ctx);
+
+    /* Reseeding before every request (success) */
+
+    ASSERT_SUCCESS(ctr_drbg_init(&ctx, 0, 0, 1));
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out[0], sizeof(out[0])));
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out[1], sizeof(out[1])));
+    ASSERT(memcmp(out[0], out[1], sizeof(out[0])));
+    ctr_drbg_final(&ctx);
+
+    /* Contexts from the same seed give the same output (success) */
+
+    ASSERT_SUCCESS(ctr_drbg_seed(&ctx, seed, CTR_DRBG_SEED_LEN, 0, 0));
+    ASSERT_SUCCESS(ctr_drbg_seed(&same, seed, CTR_DRBG_SEED_LEN, 0, 0));
+
+    ASSERT_SUCCESS(ctr_drbg_generate(&ctx, out[0], sizeof(out[0])));
+    ASSERT_SUCCESS(ctr_drbg_generate(&same, out[1], sizeof(out[1])));
+    ASSERT_BUF_EQ(out[0], out[1], sizeof(out[0]));
+
+    ctr_drbg_final(&ctx);
+    ctr_drbg_final(&same);
+#endif
+
+    return 1;
+}
@@ -0,0 +1,128 @@
+/*===-- unit_tests/curve25519.c --------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the Curve25519 module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* The order of the base point, little-endian. */
+static const unsigned char order[32] =
+{
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+    0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/* curve25519_pub() must agree with curve25519_ecdh() on the base point. */
+static int check_pub(const unsigned char *priv)
+{
+    static const unsigned char basepoint[32] = {9};
+    unsigned char pub[32], ecdh[32];
+
+    curve25519_pub(pub, priv);
+    curve25519_ecdh(ecdh, priv, basepoint);
+
+    ASSERT_BUF_EQ(pub, ecdh, 32);
+
+    return 1;
+}
+
+int test_curve25519_precond(void);
+int test_curve25519_precond(void)
+{
+    static unsigned char batch_priv[33][32], batch_other[33][32];
+    static unsigned char batch_pub[33][32], batch_ecdh[33][32];
+    unsigned char priv[32];
+    size_t t;
+
+    /* Scalars which are not masked, or are multiples of the order (success) */
+
+    memset(priv, 0x00, 32);
+    ASSERT(check_pub(priv));
+
+    memset(priv, 0xff, 32);
+    ASSERT(check_pub(priv));
+
+    memcpy(priv, order, 32);
+    ASSERT(check_pub(priv));
+
+    priv[31] |= 0x80;
+    ASSERT(check_pub(priv));
+
+    memset(priv, 0x00, 32);
+    priv[31] = 0x80;
+    ASSERT(check_pub(priv));
+
+    /* A sequence of masked and unmasked scalars (success) */
+
+    memset(priv, 0x5a, 32);
+
+    for (t = 0; t < 64; ++t)
+    {
+        curve25519_pub(priv, priv);
+
+        if (t % 2)
+        {
+            priv[0] &= 248;
+            priv[31] &= 127;
+            priv[31] |= 64;
+        }
+
+        ASSERT(check_pub(priv));
+    }
+
+    /* Batches agree with single calls, across several inversions, and with
+     * points of small order among them (success) */
+
+    for (t = 0; t < ARRAY_SIZE(batch_priv); ++t)
+    {
+        memset(batch_priv[t], (int)(t * 37 + 1), 32);
+        batch_priv[t][t % 32] ^= 0x80;
+
+        if (t % 5 == 1)
+            memset(batch_other[t], 0x00, 32);
+        else if (t % 5 == 3)
+        {
+            memset(batch_other[t], 0x00, 32);
+            batch_other[t][0] = 1;
+        }
+        else
+            curve25519_pub(batch_other[t], batch_priv[t]);
+    }
+
+    curve25519_pub_batch(batch_pub, batch_priv, ARRAY_SIZE(batch_priv));
+    curve25519_ecdh_batch(batch_ecdh, batch_priv, batch_other,
+                          ARRAY_SIZE(batch_priv));
+
+    for (t = 0; t < ARRAY_SIZE(batch_priv); ++t)
+    {
+        unsigned char expect[32];
+
+        curve25519_pub(expect, batch_priv[t]);
+        ASSERT_BUF_EQ(batch_pub[t], expect, 32);
+
+        curve25519_ecdh(expect, batch_priv[t], batch_other[t]);
+        ASSERT_BUF_EQ(batch_ecdh[t], expect, 32);
+    }
+
+    memset(priv, 0x00, 32);
+    ASSERT_BUF_EQ(batch_ecdh[1], priv, 32);
+    ASSERT_BUF_EQ(batch_ecdh[3], priv, 32);
+
+    curve25519_pub_batch(priv, batch_priv[1], 1);
+    ASSERT_BUF_EQ(priv, batch_pub[1], 32);
+
+    /* Empty batches (success) */
+
+    curve25519_pub_batch(0, 0, 0);
+    curve25519_ecdh_batch(0, 0, 0, 0);
+
+    return 1;
+}
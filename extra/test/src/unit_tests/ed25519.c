@@ -0,0 +1,177 @@
+/*===-- unit_tests/ed25519.c -----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the Ed25519 module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_SHA512
+
+/* The private key of RFC 8032's TEST 1, which signs "Ordo" below. */
+static const char priv[] =
+    "\x9d\x61\xb1\x9d\xef\xfd\x5a\x60\xba\x84\x4a\xf4\x92\xec\x2c\xc4"
+    "\x44\x49\xc5\x69\x7b\x32\x69\x19\x70\x3b\xac\x03\x1c\xae\x7f\x60";
+
+static const char msg[] = "Ordo";
+
+/* A signature for that key whose R has a component of order 8, which only
+ * the cofactored equation accepts. */
+static const char sig_torsion_r[] =
+    "\x7d\x95\xbb\xa9\x75\x07\xd4\x28\xf7\xcf\xe5\xde\x02\xff\xb5\x25"
+    "\xad\xf8\x8b\xb4\xb4\x9e\xc1\x98\xae\x70\x5a\x67\x78\xc3\x2f\xf7"
+    "\x29\xba\x01\xd2\x0b\x11\xb8\x32\x75\x63\x14\xbc\x5f\x49\x30\x79"
+    "\xe7\x2b\xe0\x28\x3f\x79\x8f\x7a\x29\x1d\x12\x83\x72\xc2\x2d\x03";
+
+/* That key's public key plus a point of order 8, and a signature for it. */
+static const char pub_torsion[] =
+    "\x91\x58\x31\x2a\x9a\x8d\x6e\x3b\x34\xc8\x91\xd6\xd6\x14\x44\xf8"
+    "\xb8\x21\x1c\x51\x17\xeb\xad\x15\xbd\xb0\xbd\x68\xb0\x7e\x02\x45";
+
+static const char sig_torsion_a[] =
+    "\xbe\x19\xdd\x23\x62\x87\x24\xfd\x11\xcf\xf9\x9e\xcc\xec\xfe\xd4"
+    "\xba\x89\x7d\x99\x39\x49\xdb\x4c\xdd\x20\x4a\x0d\x68\x2e\x23\x1b"
+    "\x85\x07\x79\x8d\x2d\x01\xca\x10\x68\xdd\xea\x5f\x11\xcf\x3a\x3c"
+    "\xe5\xc0\x38\xe8\x54\x56\x26\xea\xc7\x7f\x81\x20\x7d\xb9\xc2\x01";
+
+/* The order of the base point, little-endian. */
+static const unsigned char order[32] =
+{
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+    0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/* Adds the order to S, which leaves the equation unchanged. */
+static void add_order(unsigned char *sig)
+{
+    unsigned int carry = 0;
+    size_t t;
+
+    for (t = 0; t < 32; ++t)
+    {
+        carry += sig[32 + t] + order[t];
+        sig[32 + t] = (unsigned char)carry;
+        carry >>= 8;
+    }
+}
+
+#endif
+
+int test_ed25519_precond(void);
+int test_ed25519_precond(void)
+{
+#if WITH_SHA512
+    static unsigned char batch_priv[70][32], batch_pub[70][32];
+    static unsigned char batch_sig[70][64];
+    static struct ED25519_JOB jobs[70];
+    unsigned char pub[32], sig[64], bad[32];
+    size_t t;
+
+    if (!prim_avail(HASH_SHA512))
+        return 1;
+
+    ed25519_pub(pub, priv);
+    ed25519_sign(sig, priv, msg, 4);
+    ASSERT_SUCCESS(ed25519_verify(sig, pub, msg, 4));
+
+    /* S which is not reduced (failure) */
+
+    add_order(sig);
+    ASSERT_FAILURE(ed25519_verify(sig, pub, msg, 4));
+    ed25519_sign(sig, priv, msg, 4);
+
+    /* Public keys which are not canonical encodings of points (failure) */
+
+    memset(bad, 0xff, 32);                  /* y = p + 1 */
+    bad[0] = 0xee;
+    bad[31] = 0x7f;
+    ASSERT_FAILURE(ed25519_verify(sig, bad, msg, 4));
+
+    memset(bad, 0x00, 32);                  /* x = 0, with the sign bit */
+    bad[0] = 0x01;
+    bad[31] = 0x80;
+    ASSERT_FAILURE(ed25519_verify(sig, bad, msg, 4));
+
+    memset(bad, 0x00, 32);                  /* y = 2, which has no x */
+    bad[0] = 0x02;
+    ASSERT_FAILURE(ed25519_verify(sig, bad, msg, 4));
+
+    /* Components of small order, and the identity (success) */
+
+    ASSERT_SUCCESS(ed25519_verify(sig_torsion_r, pub, msg, 4));
+    ASSERT_SUCCESS(ed25519_verify(sig_torsion_a, pub_torsion, msg, 4));
+
+    memset(bad, 0x00, 32);
+    bad[0] = 0x01;
+    memset(sig, 0x00, 64);
+    sig[0] = 0x01;
+    ASSERT_SUCCESS(ed25519_verify(sig, bad, msg, 4));
+
+    /* Batches agree with single calls, across two batches, and with the
+     * components of small order among them (success) */
+
+    for (t = 0; t < ARRAY_SIZE(jobs); ++t)
+    {
+        memset(batch_priv[t], (int)(t * 37 + 1), 32);
+        ed25519_pub(batch_pub[t], batch_priv[t]);
+        ed25519_sign(batch_sig[t], batch_priv[t], batch_priv[t], t % 33);
+
+        jobs[t].msg = batch_priv[t];
+        jobs[t].len = t % 33;
+        jobs[t].pub = batch_pub[t];
+        jobs[t].sig = batch_sig[t];
+    }
+
+    jobs[3].msg = msg;
+    jobs[3].len = 4;
+    jobs[3].pub = pub;
+    jobs[3].sig = sig_torsion_r;
+
+    jobs[50].msg = msg;
+    jobs[50].len = 4;
+    jobs[50].pub = pub_torsion;
+    jobs[50].sig = sig_torsion_a;
+
+    ASSERT_SUCCESS(ed25519_verify_batch(jobs, ARRAY_SIZE(jobs)));
+
+    for (t = 0; t < ARRAY_SIZE(jobs); ++t)
+        ASSERT_SUCCESS(jobs[t].err);
+
+    /* Batches with some invalid signatures, which are singled out (failure) */
+
+    batch_sig[10][40] ^= 0x01;
+    jobs[20].len -= 1;
+    add_order(batch_sig[60]);
+    batch_pub[61][31] ^= 0x80;
+
+    ASSERT_FAILURE(ed25519_verify_batch(jobs, ARRAY_SIZE(jobs)));
+
+    for (t = 0; t < ARRAY_SIZE(jobs); ++t)
+    {
+        int err = ed25519_verify(jobs[t].sig, jobs[t].pub,
+                                 jobs[t].msg, jobs[t].len);
+
+        ASSERT(jobs[t].err == err);
+        ASSERT(!err == (t != 10 && t != 20 && t != 60 && t != 61));
+    }
+
+    /* Batches too small to be combined (success and failure) */
+
+    ASSERT_SUCCESS(ed25519_verify_batch(jobs, 3));
+    ASSERT_FAILURE(ed25519_verify_batch(jobs + 8, 3));
+    ASSERT(!jobs[8].err && !jobs[9].err && jobs[10].err);
+
+    /* Empty batches (success) */
+
+    ASSERT_SUCCESS(ed25519_verify_batch(0, 0));
+#endif
+
+    return 1;
+}
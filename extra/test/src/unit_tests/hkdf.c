@@ -87,5 +87,44 @@ int test_hkdf_precond(void)
                                 out_large, digest_len * 255 + 1));
     }
 
+    {
+        static unsigned char out_large[HASH_DIGEST_LEN * 255 + 1];
+        struct HKDF_LABEL labels[2];
+        struct HKDF_CTX ctx;
+
+        /* Zero length key (failure) */
+
+        ASSERT_FAILURE(hkdf_extract(&ctx, HASH_SHA256, 0,
+                                    key, 0,
+                                    salt, sizeof(salt)));
+
+        ASSERT_SUCCESS(hkdf_extract(&ctx, HASH_SHA256, 0,
+                                    key, sizeof(key),
+                                    salt, sizeof(salt)));
+
+        /* Zero length output (failure) */
+
+        ASSERT_FAILURE(hkdf_expand(&ctx, info, sizeof(info), out, 0));
+
+        /* No labels (success) */
+
+        ASSERT_SUCCESS(hkdf_expand_many(&ctx, labels, 0));
+
+        /* One label too long, nothing written (failure) */
+
+        memset(out, 0, sizeof(out));
+
+        labels[0].info = info;
+        labels[0].info_len = sizeof(info);
+        labels[0].out = out;
+        labels[0].out_len = sizeof(out);
+        labels[1] = labels[0];
+        labels[1].out = out_large;
+        labels[1].out_len = digest_length(HASH_SHA256) * 255 + 1;
+
+        ASSERT_FAILURE(hkdf_expand_many(&ctx, labels, 2));
+        ASSERT(!out[0] && !out[1] && !out[2] && !out[3]);
+    }
+
     return 1;
 }
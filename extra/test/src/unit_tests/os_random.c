@@ -15,8 +15,14 @@ int test_os_random(void);
 int test_os_random(void)
 {
     uint8_t buffer[1024] = {0};
+    uint8_t nonce[2][16];
     size_t t;
 
+    /* Small requests come from a buffered pool, and must not repeat. */
+    ASSERT_SUCCESS(os_random(nonce[0], sizeof(nonce[0])));
+    ASSERT_SUCCESS(os_random(nonce[1], sizeof(nonce[1])));
+    ASSERT(memcmp(nonce[0], nonce[1], sizeof(nonce[0])));
+
     ASSERT_SUCCESS(os_random(&buffer, sizeof(buffer)));
 
     for (t = 0; t < sizeof(buffer); ++t)
@@ -17,6 +17,8 @@ int test_pbkdf2_precond(void)
     unsigned char pwd[4] = {0};
     unsigned char salt[4] = {0};
     unsigned char out[4];
+    struct PBKDF2_CTX ctx;
+    int done;
 
     /* Invalid hash function (failure) */
 
@@ -64,5 +66,80 @@ int test_pbkdf2_precond(void)
                               1,
                               out, sizeof(out)));
 
+    /* Same checks for the incremental API */
+
+    ASSERT_FAILURE(pbkdf2_init(&ctx, BLOCK_AES, 0,
+                               pwd, sizeof(pwd),
+                               salt, sizeof(salt),
+                               1,
+                               out, sizeof(out)));
+
+    ASSERT_FAILURE(pbkdf2_init(&ctx, HASH_SHA256, 0,
+                               pwd, sizeof(pwd),
+                               salt, sizeof(salt),
+                               0,
+                               out, sizeof(out)));
+
+    ASSERT_SUCCESS(pbkdf2_init(&ctx, HASH_SHA256, 0,
+                               pwd, sizeof(pwd),
+                               salt, 0,
+                               1,
+                               out, sizeof(out)));
+
+    ASSERT_SUCCESS(pbkdf2_final(&ctx));
+
+    /* Steps report whether the key is done (success) */
+
+    ASSERT_SUCCESS(pbkdf2_init(&ctx, HASH_SHA256, 0,
+                               pwd, sizeof(pwd),
+                               salt, sizeof(salt),
+                               2,
+                               out, sizeof(out)));
+
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 1, &done));
+    ASSERT(!done);
+    ASSERT_SUCCESS(pbkdf2_step(&ctx, 1, &done));
+    ASSERT(done);
+
+    return 1;
+}
+
+int test_pbkdf2_batch_precond(void);
+int test_pbkdf2_batch_precond(void)
+{
+    unsigned char pwd[4] = {0};
+    unsigned char salt[4] = {0};
+    unsigned char out[2][4];
+    struct PBKDF2_JOB jobs[2];
+
+    jobs[0].pwd = pwd;
+    jobs[0].pwd_len = sizeof(pwd);
+    jobs[0].salt = salt;
+    jobs[0].salt_len = sizeof(salt);
+    jobs[0].iterations = 1;
+    jobs[0].out = out[0];
+    jobs[0].out_len = sizeof(out[0]);
+
+    jobs[1] = jobs[0];
+    jobs[1].out = out[1];
+
+    /* Invalid hash function (failure) */
+
+    ASSERT_FAILURE(kdf_pbkdf2_batch(BLOCK_AES, 0, jobs, 2));
+
+    /* Valid jobs (success) */
+
+    ASSERT_SUCCESS(kdf_pbkdf2_batch(HASH_SHA256, 0, jobs, 2));
+    ASSERT_SUCCESS(jobs[0].err);
+    ASSERT_SUCCESS(jobs[1].err);
+
+    /* Zero iterations in one job only (failure, other job succeeds) */
+
+    jobs[0].iterations = 0;
+
+    ASSERT_FAILURE(kdf_pbkdf2_batch(HASH_SHA256, 0, jobs, 2));
+    ASSERT_FAILURE(jobs[0].err);
+    ASSERT_SUCCESS(jobs[1].err);
+
     return 1;
 }
@@ -0,0 +1,66 @@
+/*===-- unit_tests/scrypt.c ------------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the scrypt module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+/*===----------------------------------------------------------------------===*/
+
+int test_scrypt_precond(void);
+int test_scrypt_precond(void)
+{
+    unsigned char pwd[4] = {0};
+    unsigned char salt[4] = {0};
+    unsigned char out[4];
+
+    if (!prim_avail(HASH_SHA256))
+        return 1;
+
+    /* Zero length password (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, 0, salt, sizeof(salt),
+                              16, 1, 1, out, sizeof(out)));
+
+    /* Zero length output (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              16, 1, 1, out, 0));
+
+    /* Zero length salt (success) */
+
+    ASSERT_SUCCESS(kdf_scrypt(pwd, sizeof(pwd), salt, 0,
+                              16, 1, 1, out, sizeof(out)));
+
+    /* N not a power of two, or too small (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              24, 1, 1, out, sizeof(out)));
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              1, 1, 1, out, sizeof(out)));
+
+    /* N not less than 2^(16r) (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              65536, 1, 1, out, sizeof(out)));
+
+    /* Zero r or p (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              16, 0, 1, out, sizeof(out)));
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              16, 1, 0, out, sizeof(out)));
+
+    /* rp not less than 2^30 (failure) */
+
+    ASSERT_FAILURE(kdf_scrypt(pwd, sizeof(pwd), salt, sizeof(salt),
+                              16, 1 << 15, 1 << 15, out, sizeof(out)));
+
+    return 1;
+}
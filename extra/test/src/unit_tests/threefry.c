@@ -0,0 +1,96 @@
+/*===-- unit_tests/threefry.c ----------------------------*- TEST -*- C -*-===*/
+/**
+*** @file
+*** @brief Test Vectors
+***
+*** Unit tests for the Threefry module.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#include "testenv.h"
+
+#include "ordo/misc/endianness.h"
+#if WITH_THREEFISH256
+#include "ordo/primitives/block_ciphers/threefish256.h"
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int test_threefry_precond(void);
+int test_threefry_precond(void)
+{
+#if WITH_THREEFISH256
+    static uint64_t large[1003][THREEFRY_WORDS];
+    uint64_t key[THREEFRY_WORDS] = {1, 2, 3, 4};
+    uint64_t counter[THREEFRY_WORDS], out[THREEFRY_WORDS];
+    uint64_t block[THREEFRY_WORDS];
+    struct THREEFISH256_STATE state;
+    struct THREEFRY_CTX ctx;
+    size_t t;
+
+    if (!prim_avail(BLOCK_THREEFISH256))
+        return 1;
+
+    /* Unsupported numbers of rounds (failure) */
+
+    ASSERT_FAILURE(threefry_init(&ctx, key, 0));
+    ASSERT_FAILURE(threefry_init(&ctx, key, 12));
+    ASSERT_FAILURE(threefry_init(&ctx, key, 16));
+    ASSERT_FAILURE(threefry_init(&ctx, key, 80));
+
+    /* 72 rounds are Threefish-256 with a zero tweak (success) */
+
+    ASSERT_SUCCESS(threefry_init(&ctx, key, 72));
+
+    for (t = 0; t < THREEFRY_WORDS; ++t)
+    {
+        counter[t] = ~(uint64_t)t;
+        block[t] = tole64(key[t]);
+    }
+
+    ASSERT_SUCCESS(threefish256_init(&state, block, sizeof(block), 0));
+
+    for (t = 0; t < THREEFRY_WORDS; ++t)
+        block[t] = tole64(counter[t]);
+
+    threefish256_forward(&state, block);
+    threefish256_final(&state);
+
+    for (t = 0; t < THREEFRY_WORDS; ++t)
+        block[t] = fmle64(block[t]);
+
+    threefry_eval(&ctx, counter, out);
+    ASSERT_BUF_EQ(out, block, sizeof(out));
+    threefry_final(&ctx);
+
+    /* Bulk outputs across carries into every word (success) */
+
+    ASSERT_SUCCESS(threefry_init(&ctx, key, THREEFRY_ROUNDS));
+
+    counter[0] = counter[1] = counter[2] = ~(uint64_t)0;
+    counter[3] = 7;
+    counter[0] -= 500;
+
+    threefry_bulk(&ctx, counter, large[0], ARRAY_SIZE(large));
+
+    for (t = 0; t < ARRAY_SIZE(large); ++t)
+    {
+        threefry_eval(&ctx, counter, out);
+        ASSERT_BUF_EQ(out, large[t], sizeof(out));
+
+        if (!++counter[0])
+            if (!++counter[1])
+                if (!++counter[2])
+                    ++counter[3];
+    }
+
+    ASSERT(counter[3] == 8);
+
+    /* Empty bulk output (success) */
+
+    threefry_bulk(&ctx, counter, 0, 0);
+    threefry_final(&ctx);
+#endif
+
+    return 1;
+}
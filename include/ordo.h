@@ -42,10 +42,15 @@
 
 #include "ordo/kdf/hkdf.h"
 #include "ordo/kdf/pbkdf2.h"
+#include "ordo/kdf/scrypt.h"
+#include "ordo/kdf/argon2.h"
 
 #include "ordo/misc/utils.h"
 #include "ordo/misc/os_random.h"
+#include "ordo/misc/ctr_drbg.h"
+#include "ordo/misc/threefry.h"
 #include "ordo/misc/curve25519.h"
+#include "ordo/misc/ed25519.h"
 
 #ifdef __cplusplus
 extern "C" {
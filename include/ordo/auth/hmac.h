@@ -27,6 +27,7 @@ extern "C" {
 #define hmac_init                        ordo_hmac_init
 #define hmac_update                      ordo_hmac_update
 #define hmac_final                       ordo_hmac_final
+#define hmac_reset                       ordo_hmac_reset
 #define hmac_bsize                       ordo_hmac_bsize
 
 /*===----------------------------------------------------------------------===*/
@@ -75,6 +76,22 @@ void hmac_update(struct HMAC_CTX *ctx,
 ORDO_PUBLIC
 int hmac_final(struct HMAC_CTX *ctx, void *fingerprint);
 
+/** Resets an HMAC context, so that it can authenticate another message under
+*** the same key, without having to process the key again.
+***
+*** @param [in,out] ctx            An initialized HMAC context.
+***
+*** @remarks This may be called at any time, any message already fed into the
+***          context is discarded. It is much cheaper than \c hmac_init(), as
+***          the context keeps the hash states obtained from the masked keys.
+***
+*** @remarks A context must be reset after \c hmac_final() before it is used
+***          again. Contexts can also be copied and then reset, so as to use a
+***          single key setup from several places.
+**/
+ORDO_PUBLIC
+void hmac_reset(struct HMAC_CTX *ctx);
+
 /** Gets the size in bytes of an \c HMAC_CTX.
 ***
 *** @returns The size in bytes of the structure.
@@ -66,10 +66,26 @@ typedef int prim_t;
 #define HASH_MD5                                              ((prim_t)0x8110)
 #define HASH_SHA1                                             ((prim_t)0x8310)
 #define HASH_SHA256                                           ((prim_t)0x8010)
+#define HASH_SHA512                                           ((prim_t)0x8610)
+#define HASH_SHA384                                           ((prim_t)0x8710)
+#define HASH_SHA512_256                                       ((prim_t)0x8810)
 #define HASH_SKEIN256                                         ((prim_t)0x8210)
+#define HASH_SKEIN512                                         ((prim_t)0x8510)
+#define HASH_BLAKE2B                                          ((prim_t)0x8910)
+#define HASH_BLAKE2S                                          ((prim_t)0x8A10)
+#define HASH_BLAKE2BP                                         ((prim_t)0x8B10)
+#define HASH_BLAKE2SP                                         ((prim_t)0x8C10)
+#define HASH_BLAKE3                                           ((prim_t)0x8D10)
+#define HASH_SHA3_224                                         ((prim_t)0x8E10)
+#define HASH_SHA3_256                                         ((prim_t)0x8F10)
+#define HASH_SHA3_384                                         ((prim_t)0x9010)
+#define HASH_SHA3_512                                         ((prim_t)0x9110)
+#define HASH_SHAKE128                                         ((prim_t)0x9210)
+#define HASH_SHAKE256                                         ((prim_t)0x9310)
 
 #define BLOCK_NULLCIPHER                                      ((prim_t)0xFF20)
 #define BLOCK_THREEFISH256                                    ((prim_t)0x1A20)
+#define BLOCK_THREEFISH512                                    ((prim_t)0x1B20)
 #define BLOCK_AES                                             ((prim_t)0x0C20)
 
 #define STREAM_RC4                                            ((prim_t)0x3130)
@@ -9,6 +9,8 @@
 ***
 *** The definitions.h header is autogenerated by the build system, and depends
 *** on the architecture and the primitives built into the library.
+*** It also defines a \c WITH_<PRIMITIVE> macro for every primitive, to 1 if
+*** it is built into the library and 0 otherwise, e.g. \c WITH_SHA512.
 **/
 /*===----------------------------------------------------------------------===*/
 
@@ -0,0 +1,360 @@
+/* AUTOGENERATED - DO NOT EDIT */
+
+#ifndef ORDO_DEFINITIONS_H
+#define ORDO_DEFINITIONS_H
+
+#include "ordo/common/identification.h"
+#include "ordo/common/limits.h"
+
+#define HASH_BLOCK_LEN  168
+#define HASH_DIGEST_LEN 64
+#define BLOCK_BLOCK_LEN 64
+
+#define WITH_RC4          1
+#define WITH_MD5          1
+#define WITH_SHA1         1
+#define WITH_SHA256       1
+#define WITH_SHA512       1
+#define WITH_SKEIN256     1
+#define WITH_SKEIN512     1
+#define WITH_BLAKE2B      1
+#define WITH_BLAKE2S      1
+#define WITH_BLAKE2BP     1
+#define WITH_BLAKE2SP     1
+#define WITH_BLAKE3       1
+#define WITH_SHA3         1
+#define WITH_AES          1
+#define WITH_THREEFISH256 1
+#define WITH_THREEFISH512 1
+#define WITH_NULLCIPHER   1
+#define WITH_ECB          1
+#define WITH_CBC          1
+#define WITH_CFB          1
+#define WITH_OFB          1
+#define WITH_CTR          1
+
+struct AES_STATE
+{
+    unsigned char key[336];
+    unsigned rounds;
+};
+
+struct BLAKE2B_STATE
+{
+    uint64_t h[8];
+    uint64_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct BLAKE2S_STATE
+{
+    uint32_t h[8];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct BLAKE2BP_STATE
+{
+    uint64_t h[8][4];
+    uint64_t block[112];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t key_len;
+};
+
+struct BLAKE2SP_STATE
+{
+    uint32_t h[8][8];
+    uint32_t block[240];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t key_len;
+};
+
+struct THREEFISH256_STATE
+{
+    uint64_t subkey[19 * 4];
+};
+
+struct THREEFISH512_STATE
+{
+    uint64_t subkey[19 * 8];
+};
+
+struct RC4_STATE
+{
+    uint64_t i, j;
+    uint64_t s[256];
+};
+
+struct NULLCIPHER_STATE
+{
+    unsigned char dummy;
+};
+
+struct MD5_STATE
+{
+    /* Here block_len is used to track incomplete input blocks, whereas
+     * msg_len stores the total message length so far (for padding). */
+    uint32_t digest[4];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct SHA1_STATE
+{
+    uint32_t digest[5];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct SHA256_STATE
+{
+    uint32_t digest[8];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct SHA512_STATE
+{
+    uint64_t digest[8];
+    uint64_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct SKEIN256_STATE
+{
+    uint64_t state[4];
+    uint64_t block[4];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct SKEIN512_STATE
+{
+    uint64_t state[8];
+    uint64_t block[8];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+
+struct BLAKE3_STATE
+{
+    uint32_t key[8];
+    uint32_t cv[8];
+    uint32_t block[16];
+    uint32_t stack[55][8];
+    uint64_t stack_len;
+    uint64_t chunk_counter;
+    uint64_t chunk_len;
+    uint64_t block_len;
+    uint64_t flags;
+    uint64_t parallel;
+};
+
+struct BLAKE3_XOF_STATE
+{
+    uint32_t cv[8];
+    uint32_t block[16];
+    uint64_t counter;
+    uint64_t block_len;
+    uint64_t flags;
+    uint64_t position;
+};
+
+struct SHA3_STATE
+{
+    uint64_t lanes[25];
+    uint64_t block[21];
+    uint64_t block_len;
+    uint64_t rate;
+    uint64_t digest_len;
+    uint64_t suffix;
+    uint64_t squeezing;
+};
+
+struct ECB_STATE
+{
+    unsigned char block[BLOCK_BLOCK_LEN];
+    size_t available;
+
+    size_t block_size;
+
+    size_t padding;
+    int direction;
+};
+
+struct CBC_STATE
+{
+    unsigned char iv[BLOCK_BLOCK_LEN];
+    unsigned char block[BLOCK_BLOCK_LEN];
+    size_t available;
+
+    size_t block_size;
+
+    size_t padding;
+    int direction;
+};
+
+struct CTR_STATE
+{
+    unsigned char keystream[BLOCK_BLOCK_LEN];
+    unsigned char block[BLOCK_BLOCK_LEN];
+    size_t block_size, ctr_len;
+    size_t remaining;
+    uint64_t counter;
+};
+
+struct CFB_STATE
+{
+    unsigned char iv[BLOCK_BLOCK_LEN];
+    unsigned char tmp[BLOCK_BLOCK_LEN];
+    size_t remaining;
+    size_t block_size;
+    int direction;
+};
+
+struct OFB_STATE
+{
+    unsigned char iv[BLOCK_BLOCK_LEN];
+    size_t remaining;
+    size_t block_size;
+};
+
+struct BLOCK_STATE
+{
+    prim_t primitive;
+
+    union
+    {
+        struct AES_STATE aes;
+        struct THREEFISH256_STATE threefish256;
+        struct THREEFISH512_STATE threefish512;
+        struct NULLCIPHER_STATE nullcipher;
+    } jmp;
+};
+
+struct HASH_STATE
+{
+    prim_t primitive;
+
+    union
+    {
+        struct BLAKE2B_STATE blake2b;
+        struct BLAKE2S_STATE blake2s;
+        struct BLAKE2BP_STATE blake2bp;
+        struct BLAKE2SP_STATE blake2sp;
+        struct MD5_STATE md5;
+        struct SHA1_STATE sha1;
+        struct SHA256_STATE sha256;
+        struct SHA512_STATE sha512;
+        struct SKEIN256_STATE skein256;
+        struct SKEIN512_STATE skein512;
+        struct BLAKE3_STATE blake3;
+        struct SHA3_STATE sha3;
+    } jmp;
+};
+
+struct STREAM_STATE
+{
+    prim_t primitive;
+
+    union
+    {
+        struct RC4_STATE rc4;
+    } jmp;
+};
+
+struct BLOCK_MODE_STATE
+{
+    prim_t primitive;
+
+    union
+    {
+        struct ECB_STATE ecb;
+        struct CBC_STATE cbc;
+        struct CTR_STATE ctr;
+        struct CFB_STATE cfb;
+        struct OFB_STATE ofb;
+    } jmp;
+};
+
+#define DIGEST_CTX HASH_STATE
+
+struct ENC_BLOCK_CTX
+{
+    struct BLOCK_STATE cipher;
+    struct BLOCK_MODE_STATE mode;
+};
+
+struct HMAC_CTX
+{
+    struct DIGEST_CTX ctx;
+    struct DIGEST_CTX inner;
+    struct DIGEST_CTX outer;
+    struct HASH_LIMITS limits;
+};
+
+struct PBKDF2_CTX
+{
+    struct HMAC_CTX salted;
+    struct HMAC_CTX hmac;
+    unsigned char feedback[HASH_DIGEST_LEN];
+    unsigned char acc[HASH_DIGEST_LEN];
+    prim_t hash;
+    uintmax_t iterations;
+    uintmax_t left;
+    uint32_t counter;
+    void *out;
+    size_t out_len;
+    size_t digest_len;
+};
+
+struct HKDF_CTX
+{
+    struct HMAC_CTX prk;
+    size_t digest_len;
+};
+
+struct SKEIN256_TREE_NODE
+{
+    uint64_t state[4];
+    uint64_t block[4];
+    uint64_t children;
+    uint64_t total;
+};
+
+struct SKEIN256_TREE_STATE
+{
+    uint64_t iv[4];
+    uint64_t leaf[4];
+    uint64_t block[4];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t leaf_count;
+    uint64_t leaf_exp;
+    uint64_t fan_exp;
+    uint64_t max_height;
+    struct SKEIN256_TREE_NODE node[64];
+};
+
+struct CTR_DRBG_CTX
+{
+    struct AES_STATE key;
+    uint64_t hi, lo;
+    uint64_t requests, interval;
+};
+
+struct THREEFRY_CTX
+{
+    struct THREEFISH256_STATE key;
+    int rounds;
+};
+
+#endif
@@ -47,6 +47,7 @@ extern "C" {
 #define digest_init                      ordo_digest_init
 #define digest_update                    ordo_digest_update
 #define digest_final                     ordo_digest_final
+#define digest_copy                      ordo_digest_copy
 #define digest_length                    ordo_digest_length
 #define digest_bsize                     ordo_digest_bsize
 
@@ -104,6 +105,15 @@ extern "C" {
 **/
 #define ordo_digest_final hash_final
 
+/** Copies a digest context.
+***
+*** @param [out]    dst            The destination context.
+*** @param [in]     src            An initialized digest context.
+***
+*** @remarks See \c hash_copy().
+**/
+#define ordo_digest_copy hash_copy
+
 /** Returns the default digest length of a hash function.
 ***
 *** @param [in]     hash           A hash function primitive.
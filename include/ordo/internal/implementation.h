@@ -42,6 +42,35 @@
 #define pad_check                        ordo_pad_check_internal
 #define xor_buffer                       ordo_xor_buffer_internal
 #define inc_buffer                       ordo_inc_buffer_internal
+#define sys_parallel                     ordo_sys_parallel_internal
+#define sys_threads                      ordo_sys_threads_internal
+#define sys_alloc                        ordo_sys_alloc_internal
+#define sys_free                         ordo_sys_free_internal
+#define hmac_copy                        ordo_hmac_copy_internal
+#define md5_compress                     ordo_md5_compress_internal
+#define sha1_compress                    ordo_sha1_compress_internal
+#define sha1_compress_x8                 ordo_sha1_compress_x8_internal
+#define sha256_compress                  ordo_sha256_compress_internal
+#define sha256_compress_x8               ordo_sha256_compress_x8_internal
+#define sha512_compress                  ordo_sha512_compress_internal
+#define skein256_ubi                     ordo_skein256_ubi_internal
+#define skein256_key                     ordo_skein256_key_internal
+#define skein512_ubi                     ordo_skein512_ubi_internal
+#define blake2b_compress                 ordo_blake2b_compress_internal
+#define blake2s_compress                 ordo_blake2s_compress_internal
+#define blake3_compress                  ordo_blake3_compress_internal
+#define blake3_hash_many                 ordo_blake3_hash_many_internal
+#define keccak_f1600                     ordo_keccak_f1600_internal
+#define keccak_f1600_x4                  ordo_keccak_f1600_x4_internal
+#define scrypt_blockmix                  ordo_scrypt_blockmix_internal
+#define argon2_compress                  ordo_argon2_compress_internal
+#define aes_forward_many                 ordo_aes_forward_many_internal
+#define edwards25519_base_u              ordo_edwards25519_base_u_internal
+#define edwards25519_base                ordo_edwards25519_base_internal
+#define edwards25519_reduce              ordo_edwards25519_reduce_internal
+#define edwards25519_muladd              ordo_edwards25519_muladd_internal
+#define edwards25519_verify              ordo_edwards25519_verify_internal
+#define edwards25519_verify_many         ordo_edwards25519_verify_many_internal
 
 /*===----------------------------------------------------------------------===*/
 
@@ -92,6 +121,14 @@
     #define COLD_CODE
 #endif
 
+/* A 128-bit unsigned integer type, where the compiler has one, for the wide
+ * products of 64-bit limbs. It is an extension, hence the keyword, which is
+ * needed to compile in pedantic mode. */
+#if defined(__SIZEOF_INT128__)
+    #define HAS_UINT128
+    __extension__ typedef unsigned __int128 uint128_t;
+#endif
+
 /*===----------------------------------------------------------------------===*/
 
 #endif
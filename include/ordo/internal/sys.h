@@ -30,6 +30,67 @@ extern "C" {
     #endif
 #endif
 
+/** A unit of work for \c sys_parallel().
+***
+*** @param [in]     ctx            The context passed to \c sys_parallel().
+*** @param [in]     index          The job index, from \c 0 to \c count - 1.
+**/
+typedef void (*SYS_JOB)(void *ctx, size_t index);
+
+/** Runs a batch of independent jobs, possibly concurrently.
+***
+*** @param [in]     count          The number of jobs to run.
+*** @param [in]     job            The job function.
+*** @param [in]     ctx            An opaque context passed to every job.
+***
+*** @remarks Returns only once every job has completed. The jobs are spread
+***          over as many threads as the system has processors, but may also
+***          all run on the calling thread (e.g. on systems without threads,
+***          if threads cannot be created, or if another batch is running),
+***          so jobs must not depend on one another.
+***
+*** @remarks The worker threads are started on first use and then kept for
+***          the life of the process, so a batch costs little more than waking
+***          them up, and batches of a few tens of microseconds are worth it.
+***
+*** @warning Jobs must only write to memory that no other job touches.
+**/
+ORDO_HIDDEN
+void sys_parallel(size_t count, SYS_JOB job, void *ctx);
+
+/** Gets the number of jobs \c sys_parallel() may run at once.
+***
+*** @returns The largest number of threads \c sys_parallel() will use, which
+***          is at least one.
+***
+*** @remarks This is meant to size per-thread buffers, for batches of jobs
+***          that each need a lot of memory.
+**/
+ORDO_HIDDEN
+size_t sys_threads(void);
+
+/** Allocates a large block of memory.
+***
+*** @param [in]     len            The number of bytes to allocate.
+***
+*** @returns The memory, or nil if it could not be allocated.
+***
+*** @remarks This is meant for buffers of megabytes, such as the work area of
+***          memory-hard functions, which are accessed at random. The memory is
+***          obtained from the system directly where possible, and backed by
+***          huge pages if the system supports it, to reduce TLB misses.
+**/
+ORDO_HIDDEN
+void *sys_alloc(size_t len);
+
+/** Frees memory allocated by \c sys_alloc().
+***
+*** @param [in]     ptr            The memory, which may be nil.
+*** @param [in]     len            The length it was allocated with.
+**/
+ORDO_HIDDEN
+void sys_free(void *ptr, size_t len);
+
 /*===----------------------------------------------------------------------===*/
 
 #ifdef __cplusplus
@@ -0,0 +1,117 @@
+/*===-- kdf/argon2.h -----------------------------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Module
+***
+*** Module for the Argon2 password hashing function, as per RFC 9106, in its
+*** three variants: Argon2d, whose memory accesses depend on the password,
+*** Argon2i, whose accesses do not, and the hybrid Argon2id, which is the one
+*** recommended for password storage. Argon2 is memory-hard, like scrypt, but
+*** its time and memory costs are set independently, and its \c lanes can be
+*** filled in parallel, one thread each.
+***
+*** Just like PBKDF2, Argon2 does not require the use of contexts.
+***
+*** This module is only available if the library was built with BLAKE2b.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_ARGON2_H
+#define ORDO_ARGON2_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define kdf_argon2                       ordo_kdf_argon2
+
+/*===----------------------------------------------------------------------===*/
+
+/** @enum ARGON2_TYPE
+***
+*** The Argon2 variants, with the values of their type field in RFC 9106.
+**/
+enum ARGON2_TYPE
+{
+    ARGON2_D  = 0,
+    ARGON2_I  = 1,
+    ARGON2_ID = 2
+};
+
+/** @brief Argon2 parameters, for \c kdf_argon2().
+**/
+struct ARGON2_PARAMS
+{
+    /** The variant to use, see \c ARGON2_TYPE. **/
+    int type;
+    /** The number of passes over the memory, at least one. **/
+    uint32_t passes;
+    /** The memory to use, in KiB, at least eight per lane.
+    ***
+    *** @remarks This is rounded down to a multiple of four KiB per lane.
+    **/
+    uint32_t memory;
+    /** The number of lanes, from 1 to 2^24 - 1. **/
+    uint32_t lanes;
+    /** An optional secret key, or nil. **/
+    const void *secret;
+    /** The length in bytes of the secret key. **/
+    size_t secret_len;
+    /** Optional associated data, or nil. **/
+    const void *ad;
+    /** The length in bytes of the associated data. **/
+    size_t ad_len;
+};
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_BLAKE2B
+
+/** Derives a key using Argon2.
+***
+*** @param [in]     params         The Argon2 parameters.
+*** @param [in]     pwd            The password to derive a key from.
+*** @param [in]     pwd_len        The length in bytes of the password.
+*** @param [in]     salt           The cryptographic salt to use.
+*** @param [in]     salt_len       The length in bytes of the salt.
+*** @param [out]    out            The output buffer for the derived key.
+*** @param [in]     out_len        The required length, in bytes, of the key.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the parameters are invalid, or if the salt is shorter
+***                   than 8 bytes, or the output shorter than 4 bytes, or if
+***                   any input is 2^32 bytes or longer.
+***
+*** @retval #ORDO_FAIL if the memory could not be allocated.
+***
+*** @remarks The password may be zero-length.
+***
+*** @remarks The memory is allocated in one piece, and each of the four slices
+***          of every pass is filled with the lanes spread over as many threads
+***          as there are processors, so for a given memory size, more lanes
+***          finish sooner on multicore machines.
+***
+*** @remarks The BLAKE2b hash function must be available.
+**/
+ORDO_PUBLIC
+int kdf_argon2(const struct ARGON2_PARAMS *params,
+               const void *pwd, size_t pwd_len,
+               const void *salt, size_t salt_len,
+               void *out, size_t out_len);
+
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
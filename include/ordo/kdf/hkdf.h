@@ -8,7 +8,10 @@
 *** (\b not a password) and an optional salt, and generates a longer keystream
 *** deterministically.
 ***
-*** Just like PBKDF2, HKDF does not require the use of contexts.
+*** Just like PBKDF2, HKDF does not require the use of contexts, but its two
+*** steps are also available separately: the extract step yields a context,
+*** holding the pseudorandom key (PRK) already set up as an HMAC key, which
+*** can then be expanded into any number of keys with different info strings.
 **/
 /*===----------------------------------------------------------------------===*/
 
@@ -26,6 +29,29 @@ extern "C" {
 /*===----------------------------------------------------------------------===*/
 
 #define kdf_hkdf                         ordo_kdf_hkdf
+#define hkdf_extract                     ordo_hkdf_extract
+#define hkdf_expand                      ordo_hkdf_expand
+#define hkdf_expand_many                 ordo_hkdf_expand_many
+#define hkdf_bsize                       ordo_hkdf_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @brief A labelled HKDF output, for \c hkdf_expand_many().
+***
+*** The fields are the same as the parameters of \c hkdf_expand(), and are
+*** subject to the same constraints.
+**/
+struct HKDF_LABEL
+{
+    /** An application specific string. **/
+    const void *info;
+    /** The length in bytes of the info string. **/
+    size_t info_len;
+    /** The output buffer for the derived key. **/
+    void *out;
+    /** The required length, in bytes, of the key. **/
+    size_t out_len;
+};
 
 /*===----------------------------------------------------------------------===*/
 
@@ -67,6 +93,76 @@ int kdf_hkdf(prim_t hash, const void *params,
              const void *info, size_t info_len,
              void *out, size_t out_len);
 
+/** Runs the extract step of HKDF, giving a context to expand keys from.
+***
+*** @param [out]    ctx            An HKDF context.
+*** @param [in]     hash           The hash function to use.
+*** @param [in]     params         Hash-specific parameters.
+*** @param [in]     key            The key to derive keystreams from.
+*** @param [in]     key_len        The length in bytes of the key.
+*** @param [in]     salt           The cryptographic salt to use.
+*** @param [in]     salt_len       The length in bytes of the salt.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks The parameters are the same as for \c kdf_hkdf(), including how
+***          a missing salt is told apart from a zero-length one. The key and
+***          salt are not needed after this call.
+**/
+ORDO_PUBLIC
+int hkdf_extract(struct HKDF_CTX *ctx,
+                 prim_t hash, const void *params,
+                 const void *key, size_t key_len,
+                 const void *salt, size_t salt_len);
+
+/** Runs the expand step of HKDF on a context, deriving one key.
+***
+*** @param [in]     ctx            An HKDF context, from \c hkdf_extract().
+*** @param [in]     info           An application specific string.
+*** @param [in]     info_len       The length in bytes of the info string.
+*** @param [out]    out            The output buffer for the derived key.
+*** @param [in]     out_len        The required length, in bytes, of the key.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks The key is the same as the one \c kdf_hkdf() derives from the
+***          same inputs, but the PRK is not recomputed, and each output block
+***          only costs the hashing of its own input, as the HMAC key blocks
+***          were hashed once and for all by \c hkdf_extract().
+***
+*** @remarks The context is left unchanged, so it may be used any number of
+***          times, including from several threads at once.
+**/
+ORDO_PUBLIC
+int hkdf_expand(const struct HKDF_CTX *ctx,
+                const void *info, size_t info_len,
+                void *out, size_t out_len);
+
+/** Runs the expand step of HKDF on a context, deriving several keys.
+***
+*** @param [in]     ctx            An HKDF context, from \c hkdf_extract().
+*** @param [in,out] labels         The info strings and outputs of the keys.
+*** @param [in]     count          The number of keys to derive.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks This is the same as calling \c hkdf_expand() on each label in
+***          turn, except that all labels are checked before any key is
+***          derived, so on failure no output buffer has been written to.
+**/
+ORDO_PUBLIC
+int hkdf_expand_many(const struct HKDF_CTX *ctx,
+                     const struct HKDF_LABEL *labels, size_t count);
+
+/** Gets the size in bytes of an \c HKDF_CTX.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t hkdf_bsize(void);
+
 /*===----------------------------------------------------------------------===*/
 
 #ifdef __cplusplus
@@ -12,6 +12,10 @@
 *** the traditional  init/update/final pattern but is  a context-free function
 *** as its inputs are almost always known in advance. As such this module does
 *** not benefit from the use of contexts.
+***
+*** The exception is \c pbkdf2_step(), which lets the iterations be spread over
+*** many calls of bounded length, for callers which cannot block for the whole
+*** derivation, such as single-threaded event loops.
 **/
 /*===----------------------------------------------------------------------===*/
 
@@ -29,6 +33,39 @@ extern "C" {
 /*===----------------------------------------------------------------------===*/
 
 #define kdf_pbkdf2                       ordo_kdf_pbkdf2
+#define kdf_pbkdf2_parallel              ordo_kdf_pbkdf2_parallel
+#define kdf_pbkdf2_batch                 ordo_kdf_pbkdf2_batch
+#define pbkdf2_init                      ordo_pbkdf2_init
+#define pbkdf2_step                      ordo_pbkdf2_step
+#define pbkdf2_final                     ordo_pbkdf2_final
+#define pbkdf2_bsize                     ordo_pbkdf2_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @brief A PBKDF2 job, for \c kdf_pbkdf2_batch().
+***
+*** The fields are the same as the parameters of \c kdf_pbkdf2(), and are
+*** subject to the same constraints.
+**/
+struct PBKDF2_JOB
+{
+    /** The password to derive a key from. **/
+    const void *pwd;
+    /** The length in bytes of the password. **/
+    size_t pwd_len;
+    /** The cryptographic salt to use. **/
+    const void *salt;
+    /** The length in bytes of the salt. **/
+    size_t salt_len;
+    /** The number of PBKDF2 iterations to use. **/
+    uintmax_t iterations;
+    /** The output buffer for the derived key. **/
+    void *out;
+    /** The required length, in bytes, of the key. **/
+    size_t out_len;
+    /** Set to the job's result, \c #ORDO_SUCCESS or an error code. **/
+    int err;
+};
 
 /*===----------------------------------------------------------------------===*/
 
@@ -59,6 +96,9 @@ extern "C" {
 ***          PBKDF2 specification.
 ***
 *** @remarks The \c out buffer should be at least \c out_len bytes long.
+***
+*** @remarks Everything is done on the calling thread, see
+***          \c kdf_pbkdf2_parallel() to use more.
 **/
 ORDO_PUBLIC
 int kdf_pbkdf2(prim_t hash, const void *params,
@@ -67,6 +107,125 @@ int kdf_pbkdf2(prim_t hash, const void *params,
                uintmax_t iterations,
                void *out, size_t out_len);
 
+/** Derives a key using PBKDF2, on multiple threads.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks The parameters are the same as for \c kdf_pbkdf2(), and the key
+***          will be the same.
+***
+*** @remarks Output longer than the hash function's digest length is derived
+***          one digest-sized block at a time, and if there are 1024 iterations
+***          or more, up to 16 of these blocks are derived at once on as many
+***          threads as there are processors, taken from a pool that is kept
+***          between calls. This only helps for such long outputs.
+**/
+ORDO_PUBLIC
+int kdf_pbkdf2_parallel(prim_t hash, const void *params,
+                        const void *pwd, size_t pwd_len,
+                        const void *salt, size_t salt_len,
+                        uintmax_t iterations,
+                        void *out, size_t out_len);
+
+/** Derives many keys using PBKDF2, all with the same hash function.
+***
+*** @param [in]     hash           The hash function to use.
+*** @param [in]     params         Hash-specific parameters.
+*** @param [in,out] jobs           The jobs, see \c PBKDF2_JOB.
+*** @param [in]     count          The number of jobs.
+***
+*** @returns \c #ORDO_SUCCESS if every job succeeded, else the error code of
+***          the first job to fail (each job's own result is in its \c err
+***          field, and a failed job does not affect the others).
+***
+*** @retval #ORDO_ARG if the hash function is invalid.
+***
+*** @remarks Every job produces the same key as \c kdf_pbkdf2() would with
+***          the same arguments, but for SHA-1 and SHA-256 the iterations of
+***          eight output blocks, from any jobs, are computed in lock-step in
+***          the lanes of SIMD registers. When a block is done, its lane is
+***          refilled with the next one, so that jobs may have any iteration
+***          counts and output lengths. Other hash functions have each job go
+***          through \c kdf_pbkdf2() in turn.
+***
+*** @remarks This is meant for servers verifying many passwords at once, as
+***          it raises the throughput per processor without changing the work
+***          needed per password.
+**/
+ORDO_PUBLIC
+int kdf_pbkdf2_batch(prim_t hash, const void *params,
+                     struct PBKDF2_JOB *jobs, size_t count);
+
+/** Initializes a PBKDF2 context, to derive a key over several calls.
+***
+*** @param [out]    ctx            A PBKDF2 context.
+*** @param [in]     hash           The hash function to use.
+*** @param [in]     params         Hash-specific parameters.
+*** @param [in]     pwd            The password to derive a key from.
+*** @param [in]     pwd_len        The length in bytes of the password.
+*** @param [in]     salt           The cryptographic salt to use.
+*** @param [in]     salt_len       The length in bytes of the salt.
+*** @param [in]     iterations     The number of PBKDF2 iterations to use.
+*** @param [out]    out            The output buffer for the derived key.
+*** @param [in]     out_len        The required length, in bytes, of the key.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks The parameters are the same as for \c kdf_pbkdf2(), and the key
+***          will be the same. The password and salt are not needed after this
+***          call, but the output buffer is written to by \c pbkdf2_step() and
+***          \c pbkdf2_final(), so it must remain valid until the key is done.
+**/
+ORDO_PUBLIC
+int pbkdf2_init(struct PBKDF2_CTX *ctx,
+                prim_t hash, const void *params,
+                const void *pwd, size_t pwd_len,
+                const void *salt, size_t salt_len,
+                uintmax_t iterations,
+                void *out, size_t out_len);
+
+/** Runs some of the iterations of a PBKDF2 context.
+***
+*** @param [in,out] ctx            An initialized PBKDF2 context.
+*** @param [in]     max_iters      The most iterations to run in this call.
+*** @param [out]    done           Set to \c 1 if the key is done, or to \c 0 if
+***                                some iterations are left to run.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code, in which case
+***          \c done is not set.
+***
+*** @remarks Each iteration costs the same, so the time taken by this function
+***          is proportional to \c max_iters, which can then be chosen to fit
+***          a time slice. Iterations are counted over all output blocks, so a
+***          key of \c n blocks takes \c n times the iteration count in total.
+***
+*** @remarks The output buffer receives each output block as it is completed.
+**/
+ORDO_PUBLIC
+int pbkdf2_step(struct PBKDF2_CTX *ctx, uintmax_t max_iters, int *done);
+
+/** Finishes deriving a key with a PBKDF2 context.
+***
+*** @param [in,out] ctx            An initialized PBKDF2 context.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks Any iterations left are run, so once this returns, the whole key
+***          is in the output buffer. The context may then be initialized again
+***          for another key.
+**/
+ORDO_PUBLIC
+int pbkdf2_final(struct PBKDF2_CTX *ctx);
+
+/** Gets the size in bytes of a \c PBKDF2_CTX.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t pbkdf2_bsize(void);
+
 /*===----------------------------------------------------------------------===*/
 
 #ifdef __cplusplus
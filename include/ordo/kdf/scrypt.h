@@ -0,0 +1,81 @@
+/*===-- kdf/scrypt.h -----------------------------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Module
+***
+*** Module for the scrypt password-based key derivation function, as per RFC
+*** 7914. Unlike PBKDF2, whose cost is only a number of iterations, scrypt is
+*** memory-hard: it needs a large array, of a size chosen by the caller, which
+*** it reads at random, so that attacking it with custom hardware or GPUs is
+*** expensive in memory as well as in time. It is built on PBKDF2 with HMAC-
+*** SHA256 and the Salsa20/8 core.
+***
+*** Just like PBKDF2, scrypt does not require the use of contexts.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_SCRYPT_H
+#define ORDO_SCRYPT_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define kdf_scrypt                       ordo_kdf_scrypt
+
+/*===----------------------------------------------------------------------===*/
+
+/** Derives a key using scrypt.
+***
+*** @param [in]     pwd            The password to derive a key from.
+*** @param [in]     pwd_len        The length in bytes of the password.
+*** @param [in]     salt           The cryptographic salt to use.
+*** @param [in]     salt_len       The length in bytes of the salt.
+*** @param [in]     n              The CPU/memory cost parameter N.
+*** @param [in]     r              The block size parameter r.
+*** @param [in]     p              The parallelization parameter p.
+*** @param [out]    out            The output buffer for the derived key.
+*** @param [in]     out_len        The required length, in bytes, of the key.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the parameters are invalid, that is, if \c n is not a
+***                   power of two greater than one, or not less than 2^(16r),
+***                   if \c r or \c p is zero, or if \c rp is not less than
+***                   2^30, or if the memory needed does not fit in a \c size_t.
+***
+*** @retval #ORDO_FAIL if the memory could not be allocated.
+***
+*** @remarks The salt may be zero-length in which case the buffer may be zero.
+***
+*** @remarks The password or out buffers cannot be zero-length.
+***
+*** @remarks The memory used is \c 128rN bytes for each of the \c p lanes run
+***          at the same time. The \c p lanes are independent and are run on
+***          as many threads as there are processors, so for a given memory
+***          budget, \c p can be raised to use more processors at no extra
+***          cost in time. The memory is allocated in one piece, backed by huge
+***          pages where the system supports it.
+***
+*** @remarks Typical parameters for interactive logins are N = 2^15, r = 8 and
+***          p = 1, which take 32 MiB of memory.
+**/
+ORDO_PUBLIC
+int kdf_scrypt(const void *pwd, size_t pwd_len,
+               const void *salt, size_t salt_len,
+               uintmax_t n, size_t r, size_t p,
+               void *out, size_t out_len);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
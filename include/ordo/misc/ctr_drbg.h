@@ -0,0 +1,169 @@
+/*===-- misc/ctr_drbg.h --------------------------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Module
+***
+*** Module for CTR_DRBG, the deterministic random bit generator of NIST SP
+*** 800-90A built on AES-256 in counter mode, here without a derivation
+*** function. It is seeded from the operating system's CSPRNG and then runs
+*** entirely in user space, producing output at the speed of AES in counter
+*** mode, so it suits callers needing many random bytes, such as IVs, session
+*** tokens or seeds for simulations, without a system call for each request.
+***
+*** The generator's key is replaced after every request, so that its output
+*** up to then cannot be recovered should its state be later compromised.
+***
+*** A context is not thread-safe. Instead, each thread should have a context
+*** of its own, as they need no synchronization and are seeded independently.
+***
+*** This module is only available if the library was built with AES.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_CTR_DRBG_H
+#define ORDO_CTR_DRBG_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define ctr_drbg_init                    ordo_ctr_drbg_init
+#define ctr_drbg_seed                    ordo_ctr_drbg_seed
+#define ctr_drbg_reseed                  ordo_ctr_drbg_reseed
+#define ctr_drbg_generate                ordo_ctr_drbg_generate
+#define ctr_drbg_final                   ordo_ctr_drbg_final
+#define ctr_drbg_bsize                   ordo_ctr_drbg_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** The length in bytes of the seed of \c ctr_drbg_seed(), which is also the
+*** maximum length of personalization strings and additional input.
+**/
+#define CTR_DRBG_SEED_LEN (48)
+
+/** The maximum number of requests between two reseeds, as per SP 800-90A.
+**/
+#define CTR_DRBG_MAX_INTERVAL ((uint64_t)1 << 48)
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_AES
+
+/** Initializes a CTR_DRBG context, seeded from the operating system.
+***
+*** @param [out]    ctx            A CTR_DRBG context.
+*** @param [in]     personal       An optional personalization string, or nil.
+*** @param [in]     personal_len   The length in bytes of the string.
+*** @param [in]     interval       The number of requests after which the
+***                                context reseeds itself, or zero for the
+***                                maximum, \c #CTR_DRBG_MAX_INTERVAL.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the personalization string is longer than
+***                   \c #CTR_DRBG_SEED_LEN bytes, or if the interval is
+***                   greater than \c #CTR_DRBG_MAX_INTERVAL.
+***
+*** @retval #ORDO_FAIL if the operating system failed to provide a seed.
+***
+*** @remarks The seed is read with \c os_secure_random().
+**/
+ORDO_PUBLIC
+int ctr_drbg_init(struct CTR_DRBG_CTX *ctx,
+                  const void *personal, size_t personal_len,
+                  uint64_t interval);
+
+/** Initializes a CTR_DRBG context from a given seed.
+***
+*** @param [out]    ctx            A CTR_DRBG context.
+*** @param [in]     seed           The seed, of \c #CTR_DRBG_SEED_LEN bytes.
+*** @param [in]     seed_len       The length in bytes of the seed.
+*** @param [in]     personal       An optional personalization string, or nil.
+*** @param [in]     personal_len   The length in bytes of the string.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the seed is not \c #CTR_DRBG_SEED_LEN bytes long, or
+***                   if the personalization string is longer than that.
+***
+*** @remarks The output is then fully determined by the seed, which is useful
+***          for testing or for reproducible simulations, but the seed must be
+***          uniformly random and secret if the output is to be secure.
+***
+*** @remarks The context reseeds itself from the operating system only after
+***          \c #CTR_DRBG_MAX_INTERVAL requests.
+**/
+ORDO_PUBLIC
+int ctr_drbg_seed(struct CTR_DRBG_CTX *ctx,
+                  const void *seed, size_t seed_len,
+                  const void *personal, size_t personal_len);
+
+/** Reseeds a CTR_DRBG context from the operating system.
+***
+*** @param [in,out] ctx            An initialized CTR_DRBG context.
+*** @param [in]     additional     Optional additional input, or nil.
+*** @param [in]     additional_len The length in bytes of the input.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the additional input is longer than
+***                   \c #CTR_DRBG_SEED_LEN bytes.
+***
+*** @retval #ORDO_FAIL if the operating system failed to provide a seed.
+***
+*** @remarks A process which forks must reseed its contexts in the child, as
+***          the child would otherwise produce the same output as the parent.
+**/
+ORDO_PUBLIC
+int ctr_drbg_reseed(struct CTR_DRBG_CTX *ctx,
+                    const void *additional, size_t additional_len);
+
+/** Generates random bytes with a CTR_DRBG context.
+***
+*** @param [in,out] ctx            An initialized CTR_DRBG context.
+*** @param [out]    out            The output buffer.
+*** @param [in]     len            The number of bytes to generate.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_FAIL if the context had to reseed itself and the operating
+***                    system failed to provide a seed.
+***
+*** @remarks Outputs larger than 64 KiB, the most SP 800-90A allows for one
+***          request, are made of several requests, and each counts towards
+***          the reseed interval.
+**/
+ORDO_PUBLIC
+int ctr_drbg_generate(struct CTR_DRBG_CTX *ctx, void *out, size_t len);
+
+/** Finalizes a CTR_DRBG context, erasing its state.
+***
+*** @param [in,out] ctx            An initialized CTR_DRBG context.
+**/
+ORDO_PUBLIC
+void ctr_drbg_final(struct CTR_DRBG_CTX *ctx);
+
+/** Gets the size in bytes of a \c CTR_DRBG_CTX.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t ctr_drbg_bsize(void);
+
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -24,6 +24,8 @@ extern "C" {
 #define curve25519_gen                   ordo_curve25519_gen
 #define curve25519_pub                   ordo_curve25519_pub
 #define curve25519_ecdh                  ordo_curve25519_ecdh
+#define curve25519_pub_batch             ordo_curve25519_pub_batch
+#define curve25519_ecdh_batch            ordo_curve25519_ecdh_batch
 
 /*===----------------------------------------------------------------------===*/
 
@@ -50,6 +52,10 @@ int curve25519_gen(void *priv);
 *** @remarks The private key must be in the proper format - that is, correctly
 ***          masked according to the curve25519 specification (relating to the
 ***          first and last bytes of the private key).
+***
+*** @remarks This computes the same as \c curve25519_ecdh() with the base
+***          point as the public key, but from a table of multiples of the
+***          base point, which takes several times less time.
 **/
 ORDO_PUBLIC
 void curve25519_pub(void *pub, const void *priv);
@@ -69,6 +75,40 @@ void curve25519_pub(void *pub, const void *priv);
 ORDO_PUBLIC
 void curve25519_ecdh(void *shared, const void *priv, const void *other);
 
+/** Retrieves the public keys corresponding to many private keys.
+***
+*** @param [out]    pub            Output buffer for the public keys.
+*** @param [in]     priv           The private keys to be used.
+*** @param [in]     count          The number of private keys.
+***
+*** @remarks The keys are stored one after the other, 32 bytes each, and the
+***          output is the same as that of \c curve25519_pub() for each key.
+***
+*** @remarks The final field inversion of each key is shared with the others,
+***          by Montgomery's simultaneous inversion, which is cheaper than
+***          separate calls to \c curve25519_pub().
+**/
+ORDO_PUBLIC
+void curve25519_pub_batch(void *pub, const void *priv, size_t count);
+
+/** Computes the shared secrets between many pairs of keypairs.
+***
+*** @param [out]    shared         Output buffer for the shared secrets.
+*** @param [in]     priv           The private keys of the first keypairs.
+*** @param [in]     other          The public keys of the second keypairs.
+*** @param [in]     count          The number of pairs.
+***
+*** @remarks The keys and secrets are stored one after the other, 32 bytes
+***          each, and the output is the same as that of \c curve25519_ecdh()
+***          for each pair.
+***
+*** @remarks As with \c curve25519_pub_batch(), the final field inversions
+***          are shared, which saves most of their cost.
+**/
+ORDO_PUBLIC
+void curve25519_ecdh_batch(void *shared, const void *priv,
+                           const void *other, size_t count);
+
 /*===----------------------------------------------------------------------===*/
 
 #ifdef __cplusplus
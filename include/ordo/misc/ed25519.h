@@ -0,0 +1,153 @@
+/*===-- misc/ed25519.h ---------------------------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Module
+***
+*** Module for Ed25519, the signature scheme of RFC 8032 over the twisted
+*** Edwards curve which is equivalent to Curve25519, with SHA-512. Private
+*** keys are 32-byte seeds, public keys are 32 bytes and signatures are 64
+*** bytes. Signing takes multiples of the base point from the same table as
+*** \c curve25519_pub(), and many signatures can be verified at once.
+***
+*** Signatures are checked against the cofactored equation of RFC 8032,
+*** whether one at a time or in batches, so that both always agree, and S
+*** must be reduced, so that signatures cannot be altered into other valid
+*** ones for the same message.
+***
+*** This module is only available if the library was built with SHA-512.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_ED25519_H
+#define ORDO_ED25519_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define ed25519_gen                      ordo_ed25519_gen
+#define ed25519_pub                      ordo_ed25519_pub
+#define ed25519_sign                     ordo_ed25519_sign
+#define ed25519_verify                   ordo_ed25519_verify
+#define ed25519_verify_batch             ordo_ed25519_verify_batch
+
+/*===----------------------------------------------------------------------===*/
+
+/** @brief A signature to be checked by \c ed25519_verify_batch().
+**/
+struct ED25519_JOB
+{
+    /** The signed message. **/
+    const void *msg;
+    /** The length in bytes of the message. **/
+    size_t len;
+    /** The public key of the signer. **/
+    const void *pub;
+    /** The signature. **/
+    const void *sig;
+    /** Set to the job's result, as returned by \c ed25519_verify(). **/
+    int err;
+};
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_SHA512
+
+/** Generates a random private key.
+***
+*** @param [out]    priv           Output buffer for the private key.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @remarks The private key is exactly 32 bytes (256 bits) long.
+***
+*** @remarks This function uses \c os_secure_random().
+**/
+ORDO_PUBLIC
+int ed25519_gen(void *priv);
+
+/** Retrieves the public key corresponding to a private key.
+***
+*** @param [out]    pub            Output buffer for the public key.
+*** @param [in]     priv           The private key to be used.
+***
+*** @remarks The public key is exactly 32 bytes (256 bits) long.
+**/
+ORDO_PUBLIC
+void ed25519_pub(void *pub, const void *priv);
+
+/** Signs a message.
+***
+*** @param [out]    sig            Output buffer for the signature.
+*** @param [in]     priv           The private key to sign with.
+*** @param [in]     msg            The message to sign.
+*** @param [in]     len            The length in bytes of the message.
+***
+*** @remarks The signature is exactly 64 bytes (512 bits) long, and must not
+***          overlap the message.
+***
+*** @remarks Signatures are deterministic, the same message signed with the
+***          same key giving the same signature.
+***
+*** @remarks The public key is derived anew from the private key, so that a
+***          wrong public key can never be mixed into a signature, which would
+***          reveal the private key.
+**/
+ORDO_PUBLIC
+void ed25519_sign(void *sig, const void *priv,
+                  const void *msg, size_t len);
+
+/** Verifies the signature of a message.
+***
+*** @param [in]     sig            The signature.
+*** @param [in]     pub            The public key of the signer.
+*** @param [in]     msg            The signed message.
+*** @param [in]     len            The length in bytes of the message.
+***
+*** @returns \c #ORDO_SUCCESS if the signature is valid, else an error code.
+***
+*** @retval #ORDO_ARG if the signature is invalid, or if the signature or the
+***         public key is malformed.
+***
+*** @remarks This function runs in variable time, as it only deals with public
+***          data.
+**/
+ORDO_PUBLIC
+int ed25519_verify(const void *sig, const void *pub,
+                   const void *msg, size_t len);
+
+/** Verifies the signatures of many messages.
+***
+*** @param [in,out] jobs           The jobs, see \c ED25519_JOB.
+*** @param [in]     count          The number of jobs.
+***
+*** @returns \c #ORDO_SUCCESS if every signature is valid, else the error code
+***          of the first job to fail (each job's own result is in its \c err
+***          field, which is what \c ed25519_verify() would return).
+***
+*** @remarks The signatures are checked up to 64 at a time, by a random linear
+***          combination of their equations, which amounts to a single sum of
+***          multiples of points, computed by Pippenger's bucket method. This
+***          roughly doubles the throughput for batches of 64 or more. If the
+***          combination does not hold, or if the operating system failed to
+***          provide the random coefficients, each signature of that batch is
+***          checked on its own to find out which ones are invalid.
+**/
+ORDO_PUBLIC
+int ed25519_verify_batch(struct ED25519_JOB *jobs, size_t count);
+
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,129 @@
+/*===-- misc/threefry.h --------------------------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Module
+***
+*** Module for Threefry-4x64, the counter-based random number generator of
+*** Salmon et al. (Random123), which is Threefish-256 with a zero tweak and,
+*** optionally, fewer rounds. Its output for a given counter is a function of
+*** the key and that counter alone, so that any position in a stream can be
+*** computed directly, and streams can be split among any number of threads
+*** without communication, by giving each thread its own key or its own range
+*** of counters. This makes simulations reproducible however they are spread.
+***
+*** Threefry is not a cryptographically secure generator with fewer than 72
+*** rounds. With 13 or 20 rounds it passes the usual statistical test suites
+*** (20 being the recommended default) and is much faster.
+***
+*** A context only holds the expanded key, and is never modified once it is
+*** initialized, so a single context may be shared by any number of threads.
+***
+*** This module is only available if the library was built with Threefish-256.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_THREEFRY_H
+#define ORDO_THREEFRY_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define threefry_init                    ordo_threefry_init
+#define threefry_eval                    ordo_threefry_eval
+#define threefry_bulk                    ordo_threefry_bulk
+#define threefry_final                   ordo_threefry_final
+#define threefry_bsize                   ordo_threefry_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** The number of 64-bit words in a Threefry key, counter and output.
+**/
+#define THREEFRY_WORDS (4)
+
+/** The recommended number of rounds, as in Random123.
+**/
+#define THREEFRY_ROUNDS (20)
+
+/*===----------------------------------------------------------------------===*/
+
+#if WITH_THREEFISH256
+
+/** Initializes a Threefry context.
+***
+*** @param [out]    ctx            A Threefry context.
+*** @param [in]     key            The key, as \c #THREEFRY_WORDS words.
+*** @param [in]     rounds         The number of rounds, which is 13, 20 or
+***                                72, the latter being Threefish-256.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the number of rounds is not supported.
+**/
+ORDO_PUBLIC
+int threefry_init(struct THREEFRY_CTX *ctx,
+                  const uint64_t *key, int rounds);
+
+/** Computes the output of Threefry for a counter.
+***
+*** @param [in]     ctx            An initialized Threefry context.
+*** @param [in]     counter        The counter, as \c #THREEFRY_WORDS words.
+*** @param [out]    out            The output, as \c #THREEFRY_WORDS words.
+***
+*** @remarks The words of the key, counter and output are native integers,
+***          and the outputs match those of Random123's threefry4x64.
+**/
+ORDO_PUBLIC
+void threefry_eval(const struct THREEFRY_CTX *ctx,
+                   const uint64_t *counter, uint64_t *out);
+
+/** Computes the outputs of Threefry for consecutive counters.
+***
+*** @param [in]     ctx            An initialized Threefry context.
+*** @param [in]     counter        The first counter, as \c #THREEFRY_WORDS
+***                                words.
+*** @param [out]    out            The outputs, as \c #THREEFRY_WORDS words
+***                                for each counter.
+*** @param [in]     count          The number of counters.
+***
+*** @remarks The counters are 256-bit integers, of which the first word of
+***          \c counter is the least significant, so the output is the same
+***          as that of as many calls to \c threefry_eval() with a counter
+***          incremented by one each time. Where available, four counters are
+***          computed at a time with AVX2.
+**/
+ORDO_PUBLIC
+void threefry_bulk(const struct THREEFRY_CTX *ctx,
+                   const uint64_t *counter, uint64_t *out, size_t count);
+
+/** Finalizes a Threefry context, erasing its key.
+***
+*** @param [in,out] ctx            An initialized Threefry context.
+**/
+ORDO_PUBLIC
+void threefry_final(struct THREEFRY_CTX *ctx);
+
+/** Gets the size in bytes of a \c THREEFRY_CTX.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t threefry_bsize(void);
+
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
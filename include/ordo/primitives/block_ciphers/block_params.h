@@ -29,6 +29,15 @@ struct THREEFISH256_PARAMS
     uint64_t tweak[2];
 };
 
+/** @brief Threefish-512 block cipher parameters.
+**/
+struct THREEFISH512_PARAMS
+{
+    /** The tweak word, on a pair of 64-bit words.
+    **/
+    uint64_t tweak[2];
+};
+
 /** @brief AES block cipher parameters.
 **/
 struct AES_PARAMS
@@ -48,6 +57,7 @@ union BLOCK_PARAMS
 {
     struct AES_PARAMS                    aes;
     struct THREEFISH256_PARAMS           threefish256;
+    struct THREEFISH512_PARAMS           threefish512;
 };
 
 /*===----------------------------------------------------------------------===*/
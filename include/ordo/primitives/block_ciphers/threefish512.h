@@ -0,0 +1,85 @@
+/*===-- primitives/block_ciphers/threefish512.h --------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** Threefish-512 is  a block cipher with  a 512-bit block size  and a 512-bit
+*** key size. It also has an optional  128-bit tweak, which can be set through
+*** the cipher parameters.
+***
+*** The Threefish  ciphers were originally designed  to be used as  a building
+*** block for the Skein hash function family.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_THREEFISH512_H
+#define ORDO_THREEFISH512_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/block_ciphers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define threefish512_init                ordo_threefish512_init
+#define threefish512_forward             ordo_threefish512_forward
+#define threefish512_inverse             ordo_threefish512_inverse
+#define threefish512_final               ordo_threefish512_final
+#define threefish512_limits              ordo_threefish512_limits
+#define threefish512_bsize               ordo_threefish512_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c block_init()
+***
+*** @retval #ORDO_KEY_LEN if the key length is not 64 (bytes).
+**/
+ORDO_PUBLIC
+int threefish512_init(struct THREEFISH512_STATE *state,
+                      const void *key, size_t key_len,
+                      const struct THREEFISH512_PARAMS *params);
+
+/** @see \c block_forward()
+**/
+ORDO_PUBLIC
+void threefish512_forward(const struct THREEFISH512_STATE *state,
+                          void *block);
+
+/** @see \c block_inverse()
+**/
+ORDO_PUBLIC
+void threefish512_inverse(const struct THREEFISH512_STATE *state,
+                          void *block);
+
+/** @see \c block_final()
+**/
+ORDO_PUBLIC
+void threefish512_final(struct THREEFISH512_STATE *state);
+
+/** @see \c block_limits()
+**/
+ORDO_PUBLIC
+int threefish512_limits(struct BLOCK_LIMITS *limits);
+
+/** Gets the size in bytes of a \c THREEFISH512_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t threefish512_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
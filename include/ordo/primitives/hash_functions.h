@@ -27,6 +27,8 @@ extern "C" {
 #define hash_init                        ordo_hash_init
 #define hash_update                      ordo_hash_update
 #define hash_final                       ordo_hash_final
+#define hash_squeeze                     ordo_hash_squeeze
+#define hash_copy                        ordo_hash_copy
 #define hash_limits                      ordo_hash_limits
 #define hash_bsize                       ordo_hash_bsize
 
@@ -73,6 +75,41 @@ ORDO_PUBLIC
 void hash_final(struct HASH_STATE *state,
                 void *digest);
 
+/** Reads output from an extendable-output function, after all the message
+*** has been fed into the state.
+***
+*** @param [in,out] state          An initialized hash function state.
+*** @param [out]    out            The output buffer.
+*** @param [in]     len            The number of bytes to output.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if the hash function is not an extendable-output one.
+***
+*** @remarks Consecutive calls return consecutive parts of the output stream,
+***          and if \c hash_final() was called, the stream continues after the
+***          digest it output. No more input may be fed in afterwards.
+***
+*** @remarks This is currently supported by \c #HASH_SHAKE128 and
+***          \c #HASH_SHAKE256. BLAKE3 has its own reader in \c blake3.h.
+**/
+ORDO_PUBLIC
+int hash_squeeze(struct HASH_STATE *state,
+                 void *out, size_t len);
+
+/** Copies a hash function state.
+***
+*** @param [out]    dst            The destination state.
+*** @param [in]     src            The state to copy.
+***
+*** @remarks The copy is independent of the original, so this can be used to
+***          save the state after a common prefix (or a key, in keyed modes)
+***          and resume from it many times, without hashing it again.
+**/
+ORDO_PUBLIC
+void hash_copy(struct HASH_STATE *dst,
+               const struct HASH_STATE *src);
+
 /** Gets the limit structure for a hash function.
 ***
 *** @param [in]     primitive      A hash function primitive.
@@ -0,0 +1,132 @@
+/*===-- primitives/hash_functions/blake2b.h ------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** The BLAKE2b hash function, which produces a 512-bit digest, along with its
+*** 4-way parallel variant BLAKE2bp. BLAKE2b is  considerably faster than MD5
+*** and SHA-1 on 64-bit machines, and supports a native keyed mode, with keys
+*** of up to 64 bytes, via the key field of the parameters.
+***
+*** BLAKE2bp hashes the  input as four interleaved  BLAKE2b leaves,  which are
+*** processed side by side in the lanes of SIMD registers,  and then combines
+*** them into one  digest. It is faster than  BLAKE2b for large inputs,  but
+*** does not produce the same digest.
+***
+*** This implementation supports messages up to a length of 2^64 - 1 bytes (per
+*** leaf, for BLAKE2bp) instead of the 2^128 - 1 available.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_BLAKE2B_H
+#define ORDO_BLAKE2B_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define blake2b_init                     ordo_blake2b_init
+#define blake2b_update                   ordo_blake2b_update
+#define blake2b_final                    ordo_blake2b_final
+#define blake2b_limits                   ordo_blake2b_limits
+#define blake2b_bsize                    ordo_blake2b_bsize
+#define blake2bp_init                    ordo_blake2bp_init
+#define blake2bp_update                  ordo_blake2bp_update
+#define blake2bp_final                   ordo_blake2bp_final
+#define blake2bp_limits                  ordo_blake2bp_limits
+#define blake2bp_bsize                   ordo_blake2bp_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_KEY_LEN if the key is longer than 64 bytes.
+***
+*** @remarks The \c params parameter may be nil, for unkeyed hashing.
+**/
+ORDO_PUBLIC
+int blake2b_init(struct BLAKE2B_STATE *state,
+                 const struct BLAKE2B_PARAMS *params);
+
+/** @see \c hash_update()
+**/
+ORDO_PUBLIC
+void blake2b_update(struct BLAKE2B_STATE *state,
+                    const void *buffer,
+                    size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void blake2b_final(struct BLAKE2B_STATE *state,
+                   void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int blake2b_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c BLAKE2B_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake2b_bsize(void);
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_KEY_LEN if the key is longer than 64 bytes.
+***
+*** @remarks The \c params parameter may be nil, for unkeyed hashing.
+**/
+ORDO_PUBLIC
+int blake2bp_init(struct BLAKE2BP_STATE *state,
+                  const struct BLAKE2B_PARAMS *params);
+
+/** @see \c hash_update()
+***
+*** @remarks The leaves are only processed in parallel for whole 512-byte
+***          stripes, so feeding large buffers is faster.
+**/
+ORDO_PUBLIC
+void blake2bp_update(struct BLAKE2BP_STATE *state,
+                     const void *buffer,
+                     size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void blake2bp_final(struct BLAKE2BP_STATE *state,
+                    void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int blake2bp_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c BLAKE2BP_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake2bp_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
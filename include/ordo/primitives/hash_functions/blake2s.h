@@ -0,0 +1,132 @@
+/*===-- primitives/hash_functions/blake2s.h ------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** The BLAKE2s hash function, which produces a 256-bit digest, along with its
+*** 8-way parallel variant BLAKE2sp. BLAKE2s  is designed for 32-bit machines
+*** and small inputs, and supports a native keyed mode, with keys of up to 32
+*** bytes, via the key field of the parameters.
+***
+*** BLAKE2sp hashes the input as eight interleaved BLAKE2s leaves, which are
+*** processed side by side in the lanes of  SIMD registers, and then combines
+*** them into one  digest. It is faster than  BLAKE2s for large inputs,  but
+*** does not produce the same digest.
+***
+*** This implementation supports messages up to a length of 2^64 - 1 bytes (per
+*** leaf, for BLAKE2sp).
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_BLAKE2S_H
+#define ORDO_BLAKE2S_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define blake2s_init                     ordo_blake2s_init
+#define blake2s_update                   ordo_blake2s_update
+#define blake2s_final                    ordo_blake2s_final
+#define blake2s_limits                   ordo_blake2s_limits
+#define blake2s_bsize                    ordo_blake2s_bsize
+#define blake2sp_init                    ordo_blake2sp_init
+#define blake2sp_update                  ordo_blake2sp_update
+#define blake2sp_final                   ordo_blake2sp_final
+#define blake2sp_limits                  ordo_blake2sp_limits
+#define blake2sp_bsize                   ordo_blake2sp_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_KEY_LEN if the key is longer than 32 bytes.
+***
+*** @remarks The \c params parameter may be nil, for unkeyed hashing.
+**/
+ORDO_PUBLIC
+int blake2s_init(struct BLAKE2S_STATE *state,
+                 const struct BLAKE2S_PARAMS *params);
+
+/** @see \c hash_update()
+**/
+ORDO_PUBLIC
+void blake2s_update(struct BLAKE2S_STATE *state,
+                    const void *buffer,
+                    size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void blake2s_final(struct BLAKE2S_STATE *state,
+                   void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int blake2s_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c BLAKE2S_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake2s_bsize(void);
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_KEY_LEN if the key is longer than 32 bytes.
+***
+*** @remarks The \c params parameter may be nil, for unkeyed hashing.
+**/
+ORDO_PUBLIC
+int blake2sp_init(struct BLAKE2SP_STATE *state,
+                  const struct BLAKE2S_PARAMS *params);
+
+/** @see \c hash_update()
+***
+*** @remarks The leaves are only processed in parallel for whole 512-byte
+***          stripes, so feeding large buffers is faster.
+**/
+ORDO_PUBLIC
+void blake2sp_update(struct BLAKE2SP_STATE *state,
+                     const void *buffer,
+                     size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void blake2sp_final(struct BLAKE2SP_STATE *state,
+                    void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int blake2sp_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c BLAKE2SP_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake2sp_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
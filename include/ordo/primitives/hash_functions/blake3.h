@@ -0,0 +1,142 @@
+/*===-- primitives/hash_functions/blake3.h -------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** The BLAKE3 hash function, which produces a 256-bit digest, or any amount of
+*** output through its extendable-output reader. BLAKE3 hashes its input as a
+*** binary tree of 1024-byte chunks,  so unlike most hash functions it can be
+*** computed in parallel  on a single input,  and it also supports  a native
+*** keyed mode, with 32-byte keys, via the key field of the parameters.
+***
+*** Whole chunks fed  through \c blake3_update()  are hashed several at once in
+*** the lanes of SIMD registers (where available), and large inputs are also
+*** spread over all available processors, so feeding large buffers is faster.
+*** The digest does not depend on how the input is split between calls.
+***
+*** This implementation supports messages up to a length of 2^64 - 1 bytes.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_BLAKE3_H
+#define ORDO_BLAKE3_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define blake3_init                      ordo_blake3_init
+#define blake3_update                    ordo_blake3_update
+#define blake3_final                     ordo_blake3_final
+#define blake3_limits                    ordo_blake3_limits
+#define blake3_bsize                     ordo_blake3_bsize
+#define blake3_xof_init                  ordo_blake3_xof_init
+#define blake3_xof_read                  ordo_blake3_xof_read
+#define blake3_xof_seek                  ordo_blake3_xof_seek
+#define blake3_xof_bsize                 ordo_blake3_xof_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_KEY_LEN if the key is not 32 bytes long.
+***
+*** @remarks The \c params parameter may be nil, for unkeyed hashing.
+**/
+ORDO_PUBLIC
+int blake3_init(struct BLAKE3_STATE *state,
+                const struct BLAKE3_PARAMS *params);
+
+/** @see \c hash_update()
+***
+*** @remarks Inputs of 512 KiB or more are hashed on multiple threads, if
+***          enabled in the parameters, see \c BLAKE3_PARAMS.
+**/
+ORDO_PUBLIC
+void blake3_update(struct BLAKE3_STATE *state,
+                   const void *buffer,
+                   size_t len);
+
+/** @see \c hash_final()
+***
+*** @remarks This is the same as the first 32 bytes of extendable output.
+**/
+ORDO_PUBLIC
+void blake3_final(struct BLAKE3_STATE *state,
+                  void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int blake3_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c BLAKE3_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake3_bsize(void);
+
+/** Starts reading extendable output from a BLAKE3 hashing context.
+***
+*** @param [out]    xof            The extendable-output reader.
+*** @param [in]     state          An initialized BLAKE3 hashing context.
+***
+*** @remarks The hashing context is left unchanged, so more input may still be
+***          fed into it afterwards, and another reader started later on.
+**/
+ORDO_PUBLIC
+void blake3_xof_init(struct BLAKE3_XOF_STATE *xof,
+                     const struct BLAKE3_STATE *state);
+
+/** Reads extendable output.
+***
+*** @param [in,out] xof            An initialized extendable-output reader.
+*** @param [out]    out            The output buffer.
+*** @param [in]     len            The number of bytes to read.
+***
+*** @remarks Consecutive reads return consecutive parts of the output stream,
+***          so the way the output is split between calls does not matter.
+**/
+ORDO_PUBLIC
+void blake3_xof_read(struct BLAKE3_XOF_STATE *xof,
+                     void *out,
+                     size_t len);
+
+/** Moves an extendable-output reader to an arbitrary position.
+***
+*** @param [in,out] xof            An initialized extendable-output reader.
+*** @param [in]     position       The offset in the output stream, in bytes.
+***
+*** @remarks The output can be read in any order, at no extra cost.
+**/
+ORDO_PUBLIC
+void blake3_xof_seek(struct BLAKE3_XOF_STATE *xof,
+                     uint64_t position);
+
+/** Gets the size in bytes of a \c BLAKE3_XOF_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t blake3_xof_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -47,9 +47,123 @@ struct SKEIN256_PARAMS
     *** @warning Must be 256 or \c skein256_init() will return \c ORDO_ARG.
     **/
     uint64_t out_len;
+    /** Tree leaf size exponent, a leaf being 32 * 2^tree_leaf bytes long.
+    ***
+    *** @remarks The tree parameters  must all be  left zero  for  sequential
+    ***          hashing, and are only honoured by \c skein256_tree_init().
+    **/
+    uint8_t tree_leaf;
+    /** Tree fan-out exponent, a node having up to 2^tree_fan children.
+    **/
+    uint8_t tree_fan;
+    /** Maximum tree height, in levels (including the leaf level).
+    **/
+    uint8_t tree_max;
+    /** Unused, should be left zero according to the Skein specification.
+    **/
+    uint8_t unused[13];
+    /** An optional key, for Skein's native MAC mode (this is not part of the
+    *** configuration block, it is processed right before it).
+    ***
+    *** @remarks This is considerably cheaper than HMAC, as the key only costs
+    ***          one extra compression per key block when  initializing, and a
+    ***          keyed state can simply be copied  (for instance with  \c
+    ***          hash_copy()) to authenticate many messages under one key.
+    **/
+    const void *key;
+    /** The length of the key, in bytes, or zero for no key.
+    **/
+    size_t key_len;
+};
+
+/** @brief Skein-512 hash function parameters.
+***
+*** @remarks This is the same configuration block as for Skein-256, save for the
+***          tree parameters, which are not supported by Skein-512.
+**/
+struct SKEIN512_PARAMS
+{
+    /** The schema identifier, on four bytes.
+    **/
+    uint8_t schema[4];
+    /** The version number, on two bytes.
+    **/
+    uint8_t version[2];
+    /** Reserved, should be left zero according to the Skein specification.
+    **/
+    uint8_t reserved[2];
+    /** Hash function output length, in \b bits.
+    ***
+    *** @warning This parameter affects the hash function's digest length.
+    ***
+    *** @warning Must be 512 or \c skein512_init() will return \c ORDO_ARG.
+    **/
+    uint64_t out_len;
     /** Unused, should be left zero according to the Skein specification.
     **/
     uint8_t unused[16];
+    /** An optional key, for Skein's native MAC mode.
+    **/
+    const void *key;
+    /** The length of the key, in bytes, or zero for no key.
+    **/
+    size_t key_len;
+};
+
+/** @brief BLAKE2b (and BLAKE2bp) hash function parameters.
+**/
+struct BLAKE2B_PARAMS
+{
+    /** An optional key, for BLAKE2's native keyed mode.
+    ***
+    *** @remarks As for Skein, this is much cheaper than HMAC, as the key is
+    ***          simply hashed as a first message block.
+    **/
+    const void *key;
+    /** The length of the key, in bytes, or zero for no key.
+    ***
+    *** @warning Must be at most 64, or \c #ORDO_KEY_LEN will be returned.
+    **/
+    size_t key_len;
+};
+
+/** @brief BLAKE2s (and BLAKE2sp) hash function parameters.
+**/
+struct BLAKE2S_PARAMS
+{
+    /** An optional key, for BLAKE2's native keyed mode.
+    **/
+    const void *key;
+    /** The length of the key, in bytes, or zero for no key.
+    ***
+    *** @warning Must be at most 32, or \c #ORDO_KEY_LEN will be returned.
+    **/
+    size_t key_len;
+};
+
+/** @brief BLAKE3 hash function parameters.
+**/
+struct BLAKE3_PARAMS
+{
+    /** An optional key, for BLAKE3's keyed hashing mode.
+    ***
+    *** @remarks The key replaces the IV as every node's chaining value, so
+    ***          keyed hashing costs exactly as much as plain hashing.
+    **/
+    const void *key;
+    /** The length of the key, in bytes, or zero for no key.
+    ***
+    *** @warning Must be zero or 32, or \c #ORDO_KEY_LEN will be returned.
+    **/
+    size_t key_len;
+    /** Whether large inputs may be hashed on multiple threads.
+    ***
+    *** @remarks If nonzero, each update with 512 KiB or more of input spreads
+    ***          it over as many threads as there are processors, taken from
+    ***          a pool that is kept between updates. If zero, all hashing is
+    ***          done on the calling thread.
+    **/
+    int parallel;
 };
 
 /** @brief Polymorphic hash function parameter union.
@@ -57,12 +171,21 @@ struct SKEIN256_PARAMS
 union HASH_PARAMS
 {
     struct SKEIN256_PARAMS               skein256;
+    struct SKEIN512_PARAMS               skein512;
+    struct BLAKE2B_PARAMS                blake2b;
+    struct BLAKE2S_PARAMS                blake2s;
+    struct BLAKE3_PARAMS                 blake3;
 };
 
 /** @brief The default Skein-256 configuration block.
 **/
 #define SKEIN256_PARAMS_DEFAULT\
-    {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, { 0 }}
+    {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 256, 0, 0, 0, { 0 }, 0, 0}
+
+/** @brief The default Skein-512 configuration block.
+**/
+#define SKEIN512_PARAMS_DEFAULT\
+    {{ 0x53, 0x48, 0x41, 0x33 }, { 1, 0 }, { 0 }, 512, { 0 }, 0, 0}
 
 /*===----------------------------------------------------------------------===*/
 
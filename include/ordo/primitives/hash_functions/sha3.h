@@ -0,0 +1,209 @@
+/*===-- primitives/hash_functions/sha3.h ---------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** The SHA-3 family of hash functions, SHA3-224, SHA3-256, SHA3-384 and SHA3-
+*** 512, which produce digests of the length in their name, and the SHAKE128
+*** and SHAKE256 extendable-output functions. These are all built on the same
+*** Keccak-f[1600] sponge, differing only in the rate at which input is fed to
+*** the sponge and in a few bits of domain separation, so they share the same
+*** \c SHA3_STATE, and \c sha3_update() is used to feed data to all of them.
+***
+*** SHAKE128 and SHAKE256 produce 256-bit and 512-bit digests respectively
+*** through \c hash_final(), and any amount of output through \c sha3_squeeze()
+*** or \c hash_squeeze(). For many independent messages of the same length,
+*** \c sha3_hash4() hashes four of them at once, which is faster on machines
+*** with wide SIMD registers.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_SHA3_H
+#define ORDO_SHA3_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define sha3_224_init                    ordo_sha3_224_init
+#define sha3_256_init                    ordo_sha3_256_init
+#define sha3_384_init                    ordo_sha3_384_init
+#define sha3_512_init                    ordo_sha3_512_init
+#define shake128_init                    ordo_shake128_init
+#define shake256_init                    ordo_shake256_init
+#define sha3_update                      ordo_sha3_update
+#define sha3_final                       ordo_sha3_final
+#define sha3_squeeze                     ordo_sha3_squeeze
+#define sha3_hash4                       ordo_sha3_hash4
+#define sha3_224_limits                  ordo_sha3_224_limits
+#define sha3_256_limits                  ordo_sha3_256_limits
+#define sha3_384_limits                  ordo_sha3_384_limits
+#define sha3_512_limits                  ordo_sha3_512_limits
+#define shake128_limits                  ordo_shake128_limits
+#define shake256_limits                  ordo_shake256_limits
+#define sha3_bsize                       ordo_sha3_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha3_224_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha3_256_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha3_384_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha3_512_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int shake128_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int shake256_init(struct SHA3_STATE *state,
+                  const void *params);
+
+/** @see \c hash_update()
+***
+*** @remarks This is used for all the SHA-3 and SHAKE variants.
+**/
+ORDO_PUBLIC
+void sha3_update(struct SHA3_STATE *state,
+                 const void *buffer,
+                 size_t len);
+
+/** @see \c hash_final()
+***
+*** @remarks For SHAKE, this is the same as squeezing the digest length.
+**/
+ORDO_PUBLIC
+void sha3_final(struct SHA3_STATE *state,
+                void *digest);
+
+/** Squeezes output out of the sponge, after all the input has been fed in.
+***
+*** @param [in,out] state          An initialized hashing context.
+*** @param [out]    out            The output buffer.
+*** @param [in]     len            The number of bytes to output.
+***
+*** @remarks Consecutive calls return consecutive parts of the output stream,
+***          so the way the output is split between calls does not matter. A
+***          call to \c sha3_final() counts as squeezing the digest length.
+***
+*** @remarks This is meant for SHAKE, for the other variants, any output past
+***          the digest length is not part of the standard.
+***
+*** @warning No more input may be fed into the state after this call.
+**/
+ORDO_PUBLIC
+void sha3_squeeze(struct SHA3_STATE *state,
+                  void *out,
+                  size_t len);
+
+/** Hashes four messages of the same length at once.
+***
+*** @param [in]     hash           The SHA-3 or SHAKE primitive to use.
+*** @param [in]     in             The four messages.
+*** @param [in]     len            The length in bytes of each message.
+*** @param [out]    out            The four output buffers.
+*** @param [in]     out_len        The number of bytes to output per message.
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if \c hash is not a SHA-3 or SHAKE primitive, or if it
+***                   is a SHA-3 primitive and \c out_len is not its digest
+***                   length.
+***
+*** @remarks The output is the same as hashing each message on its own, but
+***          the four permutations are computed side by side, in the lanes of
+***          SIMD registers where available.
+**/
+ORDO_PUBLIC
+int sha3_hash4(prim_t hash,
+               const void *const in[4], size_t len,
+               void *const out[4], size_t out_len);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha3_224_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha3_256_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha3_384_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha3_512_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int shake128_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int shake256_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c SHA3_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t sha3_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
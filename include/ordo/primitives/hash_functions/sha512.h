@@ -0,0 +1,128 @@
+/*===-- primitives/hash_functions/sha512.h -------------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** The SHA-512 hash function, which produces a 512-bit digest, along with its
+*** truncated variants SHA-384 and SHA-512/256,  which produce 384-bit and 256-
+*** bit digests respectively. These  all use the  same 64-bit compression
+*** function, and so  run considerably faster  than SHA-256 on 64-bit machines
+*** for large inputs.
+***
+*** The three variants only differ in their initial state and in how much of
+*** the final state is output, so they share the same \c SHA512_STATE, and
+*** \c sha512_update() is used to feed data to all of them.
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_SHA512_H
+#define ORDO_SHA512_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define sha512_init                      ordo_sha512_init
+#define sha512_update                    ordo_sha512_update
+#define sha512_final                     ordo_sha512_final
+#define sha512_limits                    ordo_sha512_limits
+#define sha512_bsize                     ordo_sha512_bsize
+#define sha384_init                      ordo_sha384_init
+#define sha384_final                     ordo_sha384_final
+#define sha384_limits                    ordo_sha384_limits
+#define sha512_256_init                  ordo_sha512_256_init
+#define sha512_256_final                 ordo_sha512_256_final
+#define sha512_256_limits                ordo_sha512_256_limits
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha512_init(struct SHA512_STATE *state,
+                const void *params);
+
+/** @see \c hash_update()
+***
+*** @remarks This is also used for SHA-384 and SHA-512/256.
+**/
+ORDO_PUBLIC
+void sha512_update(struct SHA512_STATE *state,
+                   const void *buffer,
+                   size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void sha512_final(struct SHA512_STATE *state,
+                  void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha512_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha384_init(struct SHA512_STATE *state,
+                const void *params);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void sha384_final(struct SHA512_STATE *state,
+                  void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha384_limits(struct HASH_LIMITS *limits);
+
+/** @see \c hash_init()
+***
+*** @remarks The \c params parameter is ignored.
+**/
+ORDO_PUBLIC
+int sha512_256_init(struct SHA512_STATE *state,
+                    const void *params);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void sha512_256_final(struct SHA512_STATE *state,
+                      void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int sha512_256_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c SHA512_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t sha512_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -14,6 +14,12 @@
 ***   configuration block, and a default one is used if not provided) with the
 ***   exception of the output length which must remain 256 bits.
 ***
+*** - keyed hashing (the  native Skein-MAC mode),  via the key field of  the
+***   parameters, which is much cheaper than HMAC-Skein.
+***
+*** - tree hashing, through the separate \c skein256_tree_* functions, which
+***   hash the leaves of the tree concurrently on all available processors.
+***
 *** Note arbitrary output length used to be supported, but is no longer, since
 *** parameters should not leak through the interface, and this feature is also
 *** available in a more generic way via key stretching modules such as HKDF or
@@ -41,13 +47,17 @@ extern "C" {
 #define skein256_final                   ordo_skein256_final
 #define skein256_limits                  ordo_skein256_limits
 #define skein256_bsize                    ordo_skein256_bsize
+#define skein256_tree_init               ordo_skein256_tree_init
+#define skein256_tree_update             ordo_skein256_tree_update
+#define skein256_tree_final              ordo_skein256_tree_final
+#define skein256_tree_bsize              ordo_skein256_tree_bsize
 
 /*===----------------------------------------------------------------------===*/
 
 /** @see \c hash_init()
 ***
 *** @retval #ORDO_ARG if parameters were  provided, but  requested  an  output
-***                      length of zero bytes.
+***                      length of zero bytes, or any tree parameter is set.
 **/
 ORDO_PUBLIC
 int skein256_init(struct SKEIN256_STATE *state,
@@ -80,6 +90,63 @@ int skein256_limits(struct HASH_LIMITS *limits);
 ORDO_PUBLIC
 size_t skein256_bsize(void);
 
+/** Initializes a Skein-256 tree hashing context.
+***
+*** @param [in,out] state          An allocated tree hashing context.
+*** @param [in]     params         The configuration block to use, with its
+***                                tree parameters set (this is mandatory).
+***
+*** @returns \c #ORDO_SUCCESS on success, else an error code.
+***
+*** @retval #ORDO_ARG if no parameters were provided, if the output length is
+***                   not 256 bits, or if the tree parameters are invalid, the
+***                   leaf size and fan-out exponents must be at least 1, and
+***                   the maximum height at least 2.
+***
+*** @remarks The input is split into leaves of \c 32 \c * \c 2^tree_leaf bytes
+***          which are hashed independently, then combined by nodes of up to
+***          \c 2^tree_fan children, as described in the Skein specification.
+***          Leaves are hashed concurrently when a single call to
+***          \c skein256_tree_update() holds several whole leaves, and 32 KiB
+***          or more of them, so leaves should be a fraction of the size of
+***          the buffers that are fed to it (e.g. 1 KiB leaves for reads of
+***          64 KiB), and feeding larger buffers is faster.
+**/
+ORDO_PUBLIC
+int skein256_tree_init(struct SKEIN256_TREE_STATE *state,
+                       const struct SKEIN256_PARAMS *params);
+
+/** Feeds data into a Skein-256 tree hashing context.
+***
+*** @param [in,out] state          An initialized tree hashing context.
+*** @param [in]     buffer         The data to feed into the context.
+*** @param [in]     len            The number of bytes of data.
+**/
+ORDO_PUBLIC
+void skein256_tree_update(struct SKEIN256_TREE_STATE *state,
+                          const void *buffer,
+                          size_t len);
+
+/** Finalizes a Skein-256 tree hashing context.
+***
+*** @param [in,out] state          An initialized tree hashing context.
+*** @param [out]    digest         The buffer to write the 32-byte digest to.
+***
+*** @remarks The context must be reinitialized before being used again.
+**/
+ORDO_PUBLIC
+void skein256_tree_final(struct SKEIN256_TREE_STATE *state,
+                         void *digest);
+
+/** Gets the size in bytes of a \c SKEIN256_TREE_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t skein256_tree_bsize(void);
+
 /*===----------------------------------------------------------------------===*/
 
 #ifdef __cplusplus
@@ -0,0 +1,82 @@
+/*===-- primitives/hash_functions/skein512.h -----------*- PUBLIC -*- H -*-===*/
+/**
+*** @file
+*** @brief Primitive
+***
+*** This is  the Skein-512 hash function,  which produces a 512-bit  digest and
+*** has a 512-bit internal state, built  on the Threefish-512 block cipher. It
+*** is the primary Skein variant recommended by its designers. Like Skein-256,
+*** it supports messages up to a length of 2^64 - 1 bytes, free access to the
+*** configuration block (except for  the output length, which must remain 512
+*** bits) and keyed hashing via the key field of the parameters.
+***
+*** Tree hashing is not supported for Skein-512, see \c skein256_tree_init().
+**/
+/*===----------------------------------------------------------------------===*/
+
+#ifndef ORDO_SKEIN512_H
+#define ORDO_SKEIN512_H
+
+/** @cond **/
+#include "ordo/common/interface.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+#define skein512_init                    ordo_skein512_init
+#define skein512_update                  ordo_skein512_update
+#define skein512_final                   ordo_skein512_final
+#define skein512_limits                  ordo_skein512_limits
+#define skein512_bsize                   ordo_skein512_bsize
+
+/*===----------------------------------------------------------------------===*/
+
+/** @see \c hash_init()
+***
+*** @retval #ORDO_ARG if parameters were provided, but  requested an output
+***                   length other than 512 bits.
+**/
+ORDO_PUBLIC
+int skein512_init(struct SKEIN512_STATE *state,
+                  const struct SKEIN512_PARAMS *params);
+
+/** @see \c hash_update()
+**/
+ORDO_PUBLIC
+void skein512_update(struct SKEIN512_STATE *state,
+                     const void *buffer,
+                     size_t len);
+
+/** @see \c hash_final()
+**/
+ORDO_PUBLIC
+void skein512_final(struct SKEIN512_STATE *state,
+                    void *digest);
+
+/** @see \c hash_limits()
+**/
+ORDO_PUBLIC
+int skein512_limits(struct HASH_LIMITS *limits);
+
+/** Gets the size in bytes of a \c SKEIN512_STATE.
+***
+*** @returns The size in bytes of the structure.
+***
+*** @remarks Binary compatibility layer.
+**/
+ORDO_PUBLIC
+size_t skein512_bsize(void);
+
+/*===----------------------------------------------------------------------===*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,9 +22,18 @@ primitives = [
     Primitive('md5',               'HASH',             block_len = 64, digest_len = 16),
     Primitive('sha1',              'HASH',             block_len = 64, digest_len = 20),
     Primitive('sha256',            'HASH',             block_len = 64, digest_len = 32),
+    Primitive('sha512',            'HASH',             block_len = 128, digest_len = 64),
     Primitive('skein256',          'HASH',             block_len = 32, digest_len = 32),
+    Primitive('skein512',          'HASH',             block_len = 64, digest_len = 64),
+    Primitive('blake2b',           'HASH',             block_len = 128, digest_len = 64),
+    Primitive('blake2s',           'HASH',             block_len = 64, digest_len = 32),
+    Primitive('blake2bp',          'HASH',             block_len = 128, digest_len = 64),
+    Primitive('blake2sp',          'HASH',             block_len = 64, digest_len = 32),
+    Primitive('blake3',            'HASH',             block_len = 64, digest_len = 32),
+    Primitive('sha3',              'HASH',             block_len = 168, digest_len = 64),
     Primitive('aes',               'BLOCK',            block_len = 16                 ),
     Primitive('threefish256',      'BLOCK',            block_len = 32                 ),
+    Primitive('threefish512',      'BLOCK',            block_len = 64                 ),
     Primitive('nullcipher',        'BLOCK',            block_len = 16                 ),
     Primitive('ecb',               'BLOCK_MODE'                                       ),
     Primitive('cbc',               'BLOCK_MODE'                                       ),
@@ -120,6 +129,11 @@ if __name__ == "__main__":
     definitions += '#define HASH_DIGEST_LEN {0}\n'.format(get_digest_len(built_prims, 'HASH'))
     definitions += '#define BLOCK_BLOCK_LEN {0}\n'.format(get_block_len(built_prims,  'BLOCK'))
 
+    definitions += '\n'
+    for prim in primitives:
+        built = any(p is prim for (_, p) in built_prims)
+        definitions += '#define {0:<18}{1}\n'.format('WITH_' + prim.name.upper(), int(built))
+
     for (path, prim) in built_prims:
         with open(path, 'r') as fd:
             structs = extract_opaque_struct(fd)
@@ -22,6 +22,12 @@ static void aes_inverse_C(uint8_t * RESTRICT block,
                           unsigned rounds)
 HOT_CODE;
 
+/* Encrypts the "count" consecutive blocks at "blocks" in place, which the
+ * AES-NI implementation does several blocks at a time, for the keystream of
+ * CTR_DRBG. */
+ORDO_HIDDEN void aes_forward_many(const struct AES_STATE *state,
+                                  void *blocks, size_t count);
+
 #ifdef OPAQUE
 struct AES_STATE
 {
@@ -68,6 +74,16 @@ void aes_inverse(const struct AES_STATE *state, void *block)
     aes_inverse_C((uint8_t *)block, state->key, state->rounds);
 }
 
+void aes_forward_many(const struct AES_STATE *state,
+                      void *blocks, size_t count)
+{
+    while (count--)
+    {
+        aes_forward_C((uint8_t *)blocks, state->key, state->rounds);
+        blocks = offset(blocks, 16);
+    }
+}
+
 void aes_final(struct AES_STATE *state)
 {
     return;
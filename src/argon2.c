@@ -0,0 +1,296 @@
+/*===-- argon2.c --------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/kdf/argon2.h"
+#include "ordo/primitives/hash_functions/blake2b.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define ARGON2_BLOCK   (1024)
+#define ARGON2_WORDS   (ARGON2_BLOCK / 8)
+#define ARGON2_SLICES  (4)
+#define ARGON2_VERSION (0x13)
+
+#define BLAKE2B_DIGEST (bits(512))
+
+/* See argon2_compress.c. */
+ORDO_HIDDEN void argon2_compress(uint64_t * RESTRICT out,
+                                 const uint64_t * RESTRICT x,
+                                 const uint64_t * RESTRICT y,
+                                 int xor);
+
+static const uint64_t argon2_zero[ARGON2_WORDS] = {0};
+
+/* The memory is a single allocation of "lanes" rows of "columns" blocks, and
+ * each row is split into four slices of "segment" columns. All lanes fill a
+ * slice at the same time, each one on its own thread, and so may only refer
+ * to the slices before it, which is what makes the lanes independent. */
+struct ARGON2_FILL
+{
+    uint64_t *memory;
+    uint32_t lanes, columns, segment;
+    uint32_t pass, passes, slice;
+    int type;
+};
+
+/*===----------------------------------------------------------------------===*/
+
+/* Starts a BLAKE2b hash with a digest of "len" bytes, which the parameter
+ * block of BLAKE2b takes in, instead of truncating the full digest. */
+static void blake2b_start(struct BLAKE2B_STATE *state, size_t len)
+{
+    blake2b_init(state, 0);
+    state->h[0] ^= BLAKE2B_DIGEST ^ len;
+}
+
+static void blake2b_update32(struct BLAKE2B_STATE *state, uint64_t x)
+{
+    uint32_t word = tole32((uint32_t)x);
+    blake2b_update(state, &word, sizeof(word));
+}
+
+/* The variable-length hash H', which is BLAKE2b for outputs of up to 64
+ * bytes, and a chain of BLAKE2b hashes beyond that. This starts it, its
+ * input being then fed through blake2b_update(). */
+static void hprime_init(struct BLAKE2B_STATE *state, size_t len)
+{
+    blake2b_start(state, smin(len, BLAKE2B_DIGEST));
+    blake2b_update32(state, len);
+}
+
+static void hprime_final(struct BLAKE2B_STATE *state, void *out, size_t len)
+{
+    unsigned char v[BLAKE2B_DIGEST];
+
+    blake2b_final(state, v);
+
+    /* Every hash in the chain but the last one contributes 32 bytes. */
+    while (len > BLAKE2B_DIGEST)
+    {
+        memcpy(out, v, BLAKE2B_DIGEST / 2);
+        out = offset(out, BLAKE2B_DIGEST / 2);
+        len -= BLAKE2B_DIGEST / 2;
+
+        blake2b_start(state, smin(len, BLAKE2B_DIGEST));
+        blake2b_update(state, v, sizeof(v));
+        blake2b_final(state, v);
+    }
+
+    memcpy(out, v, len);
+    memset(v, 0, sizeof(v));
+}
+
+static uint64_t *argon2_block(const struct ARGON2_FILL *fill,
+                              uint32_t lane, uint32_t column)
+{
+    return fill->memory + ((size_t)lane * fill->columns + column)
+                        * ARGON2_WORDS;
+}
+
+/* Maps the pseudo-random value of a block to the column of the reference
+ * block within the reference lane, which has to be in the area computed so
+ * far, except for the previous block and, in other lanes, for the current
+ * segment. Values are biased towards recent blocks. */
+static uint32_t argon2_index(const struct ARGON2_FILL *fill, uint32_t index,
+                             uint64_t rand, int same_lane)
+{
+    uint64_t area, x, start = 0;
+
+    if (fill->pass == 0)
+        area = (uint64_t)fill->slice * fill->segment;
+    else
+        area = fill->columns - fill->segment;
+
+    if (same_lane) area += index;
+    if (same_lane || index == 0) area -= 1;
+
+    if (fill->pass != 0 && fill->slice != ARGON2_SLICES - 1)
+        start = (uint64_t)(fill->slice + 1) * fill->segment;
+
+    x = rand & 0xFFFFFFFF;
+    x = (x * x) >> 32;
+    x = area - 1 - ((area * x) >> 32);
+
+    return (uint32_t)((start + x) % fill->columns);
+}
+
+static void argon2_segment(void *ctx, size_t lane_index)
+{
+    const struct ARGON2_FILL *fill = (const struct ARGON2_FILL *)ctx;
+    uint32_t lane = (uint32_t)lane_index;
+
+    uint64_t input[ARGON2_WORDS], address[ARGON2_WORDS], tmp[ARGON2_WORDS];
+    uint32_t first = 0, index, column;
+    int independent;
+
+    /* Argon2i, and the first half of the first pass of Argon2id, draw the
+     * reference blocks from a stream independent of the password. */
+    independent = fill->type == ARGON2_I
+               || (fill->type == ARGON2_ID && fill->pass == 0
+                                           && fill->slice < ARGON2_SLICES / 2);
+
+    if (independent)
+    {
+        memset(input, 0, sizeof(input));
+        input[0] = fill->pass;
+        input[1] = lane;
+        input[2] = fill->slice;
+        input[3] = (uint64_t)fill->lanes * fill->columns;
+        input[4] = fill->passes;
+        input[5] = (uint64_t)fill->type;
+    }
+
+    /* The first two blocks of each lane are derived from the inputs. */
+    if (fill->pass == 0 && fill->slice == 0) first = 2;
+
+    for (index = first; index < fill->segment; ++index)
+    {
+        uint32_t ref_lane, ref_column, prev;
+        uint64_t rand;
+
+        column = fill->slice * fill->segment + index;
+        prev = column ? column - 1 : fill->columns - 1;
+
+        if (independent)
+        {
+            if (index % ARGON2_WORDS == 0 || index == first)
+            {
+                ++input[6];
+                argon2_compress(tmp, argon2_zero, input, 0);
+                argon2_compress(address, argon2_zero, tmp, 0);
+            }
+
+            rand = address[index % ARGON2_WORDS];
+        }
+        else
+            rand = argon2_block(fill, lane, prev)[0];
+
+        if (fill->pass == 0 && fill->slice == 0)
+            ref_lane = lane;
+        else
+            ref_lane = (uint32_t)((rand >> 32) % fill->lanes);
+
+        ref_column = argon2_index(fill, index, rand, ref_lane == lane);
+
+        argon2_compress(argon2_block(fill, lane, column),
+                        argon2_block(fill, lane, prev),
+                        argon2_block(fill, ref_lane, ref_column),
+                        fill->pass != 0);
+    }
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int kdf_argon2(const struct ARGON2_PARAMS *params,
+               const void *pwd, size_t pwd_len,
+               const void *salt, size_t salt_len,
+               void *out, size_t out_len)
+{
+    unsigned char h0[BLAKE2B_DIGEST + 8];
+    uint64_t block[ARGON2_WORDS];
+    struct BLAKE2B_STATE state;
+    struct ARGON2_FILL fill;
+    size_t len, t;
+
+    if (!params) return ORDO_ARG;
+
+    if (params->type != ARGON2_D && params->type != ARGON2_I
+                                 && params->type != ARGON2_ID)
+        return ORDO_ARG;
+
+    if (!params->lanes || params->lanes > UINT32_C(0xFFFFFF)) return ORDO_ARG;
+    if (!params->passes) return ORDO_ARG;
+    if (params->memory / 8 < params->lanes) return ORDO_ARG;
+
+    if (out_len < 4 || salt_len < 8) return ORDO_ARG;
+
+    if ((uint64_t)out_len  > UINT32_C(0xFFFFFFFF)
+     || (uint64_t)pwd_len  > UINT32_C(0xFFFFFFFF)
+     || (uint64_t)salt_len > UINT32_C(0xFFFFFFFF)
+     || (uint64_t)params->secret_len > UINT32_C(0xFFFFFFFF)
+     || (uint64_t)params->ad_len     > UINT32_C(0xFFFFFFFF))
+        return ORDO_ARG;
+
+    /* The memory is rounded down to a multiple of four blocks per lane. */
+    fill.lanes = params->lanes;
+    fill.segment = params->memory / (ARGON2_SLICES * params->lanes);
+    fill.columns = fill.segment * ARGON2_SLICES;
+    fill.passes = params->passes;
+    fill.type = params->type;
+
+    if ((uint64_t)fill.columns * fill.lanes > ((size_t)-1) / ARGON2_BLOCK)
+        return ORDO_ARG;
+
+    len = (size_t)fill.columns * fill.lanes * ARGON2_BLOCK;
+
+    if (!(fill.memory = (uint64_t *)sys_alloc(len))) return ORDO_FAIL;
+
+    blake2b_start(&state, BLAKE2B_DIGEST);
+    blake2b_update32(&state, params->lanes);
+    blake2b_update32(&state, out_len);
+    blake2b_update32(&state, params->memory);
+    blake2b_update32(&state, params->passes);
+    blake2b_update32(&state, ARGON2_VERSION);
+    blake2b_update32(&state, (uint64_t)params->type);
+    blake2b_update32(&state, pwd_len);
+    blake2b_update(&state, pwd, pwd_len);
+    blake2b_update32(&state, salt_len);
+    blake2b_update(&state, salt, salt_len);
+    blake2b_update32(&state, params->secret_len);
+    blake2b_update(&state, params->secret, params->secret_len);
+    blake2b_update32(&state, params->ad_len);
+    blake2b_update(&state, params->ad, params->ad_len);
+    blake2b_final(&state, h0);
+
+    for (t = 0; t < 2 * (size_t)fill.lanes; ++t)
+    {
+        uint64_t *dst = argon2_block(&fill, (uint32_t)(t / 2),
+                                     (uint32_t)(t % 2));
+        uint32_t words[2];
+        size_t k;
+
+        words[0] = tole32((uint32_t)(t % 2));
+        words[1] = tole32((uint32_t)(t / 2));
+        memcpy(h0 + BLAKE2B_DIGEST, words, sizeof(words));
+
+        hprime_init(&state, ARGON2_BLOCK);
+        blake2b_update(&state, h0, sizeof(h0));
+        hprime_final(&state, dst, ARGON2_BLOCK);
+
+        for (k = 0; k < ARGON2_WORDS; ++k) dst[k] = fmle64(dst[k]);
+    }
+
+    for (fill.pass = 0; fill.pass < fill.passes; ++fill.pass)
+        for (fill.slice = 0; fill.slice < ARGON2_SLICES; ++fill.slice)
+            sys_parallel(fill.lanes, argon2_segment, &fill);
+
+    /* The output is derived from the XOR of the last block of every lane. */
+    memcpy(block, argon2_block(&fill, 0, fill.columns - 1), ARGON2_BLOCK);
+
+    for (t = 1; t < fill.lanes; ++t)
+    {
+        const uint64_t *last = argon2_block(&fill, (uint32_t)t,
+                                            fill.columns - 1);
+        size_t k;
+
+        for (k = 0; k < ARGON2_WORDS; ++k) block[k] ^= last[k];
+    }
+
+    for (t = 0; t < ARGON2_WORDS; ++t) block[t] = tole64(block[t]);
+
+    hprime_init(&state, out_len);
+    blake2b_update(&state, block, sizeof(block));
+    hprime_final(&state, out, out_len);
+
+    memset(fill.memory, 0, len);
+    sys_free(fill.memory, len);
+
+    memset(h0, 0, sizeof(h0));
+    memset(block, 0, sizeof(block));
+    memset(&state, 0, sizeof(state));
+
+    return ORDO_SUCCESS;
+}
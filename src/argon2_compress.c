@@ -0,0 +1,70 @@
+/*===-- argon2_compress.c -----------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* Computes the Argon2 compression function G of the 1024-byte blocks "x" and
+ * "y", into "out", or XORs it into "out" if "xor" is set, as done on passes
+ * after the first. The blocks are 128 native words, and "out" may overlap
+ * with neither "x" nor "y". */
+ORDO_HIDDEN void argon2_compress(uint64_t * RESTRICT out,
+                                 const uint64_t * RESTRICT x,
+                                 const uint64_t * RESTRICT y,
+                                 int xor)
+HOT_CODE;
+
+/*===----------------------------------------------------------------------===*/
+
+/* The BLAKE2b G function, with the additions replaced by the multiplication-
+ * hardened "fBlaMka" a + b + 2 * lo(a) * lo(b) of Argon2. */
+#define FBLAMKA(a, b) ((a) + (b) + 2 * ((a) & 0xFFFFFFFF) * ((b) & 0xFFFFFFFF))
+
+#define G(a, b, c, d)                                                        \
+    do {                                                                     \
+        a = FBLAMKA(a, b); d = ror64(d ^ a, 32);                             \
+        c = FBLAMKA(c, d); b = ror64(b ^ c, 24);                             \
+        a = FBLAMKA(a, b); d = ror64(d ^ a, 16);                             \
+        c = FBLAMKA(c, d); b = ror64(b ^ c, 63);                             \
+    } while (0)
+
+/* The permutation P is one BLAKE2b round on sixteen words, which here are the
+ * eight pairs of words at "v", "stride" words apart: the rows of the block are
+ * contiguous (stride 2), and its columns are pairs of words 16 words apart. */
+static void permute(uint64_t *v, size_t stride)
+{
+    #define V(i) v[((i) / 2) * stride + ((i) & 1)]
+
+    G(V( 0), V( 4), V( 8), V(12));
+    G(V( 1), V( 5), V( 9), V(13));
+    G(V( 2), V( 6), V(10), V(14));
+    G(V( 3), V( 7), V(11), V(15));
+
+    G(V( 0), V( 5), V(10), V(15));
+    G(V( 1), V( 6), V(11), V(12));
+    G(V( 2), V( 7), V( 8), V(13));
+    G(V( 3), V( 4), V( 9), V(14));
+
+    #undef V
+}
+
+void argon2_compress(uint64_t * RESTRICT out,
+                     const uint64_t * RESTRICT x,
+                     const uint64_t * RESTRICT y,
+                     int xor)
+{
+    uint64_t r[128], q[128];
+    size_t t;
+
+    for (t = 0; t < 128; ++t) q[t] = r[t] = x[t] ^ y[t];
+
+    for (t = 0; t < 8; ++t) permute(q + 16 * t, 2);
+    for (t = 0; t < 8; ++t) permute(q +  2 * t, 16);
+
+    if (xor)
+        for (t = 0; t < 128; ++t) out[t] ^= q[t] ^ r[t];
+    else
+        for (t = 0; t < 128; ++t) out[t] = q[t] ^ r[t];
+}
@@ -0,0 +1,197 @@
+/*===-- blake2s.c -------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2s.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2S_DIGEST  (bits(256))
+#define BLAKE2S_BLOCK   (bits(512))
+#define BLAKE2S_KEY_MAX (bits(256))
+
+/* Compresses one block into the chaining value. The "tf" array holds the two
+ * counter words followed by the two finalization flags, in the order in which
+ * they are mixed into the working state. This is also used by BLAKE2sp. */
+ORDO_HIDDEN void blake2s_compress(uint32_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint32_t * RESTRICT tf)
+HOT_CODE;
+
+static const uint32_t blake2s_iv[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#ifdef OPAQUE
+struct BLAKE2S_STATE
+{
+    uint32_t h[8];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2s_init(struct BLAKE2S_STATE *state,
+                 const struct BLAKE2S_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+
+    if (key_len > BLAKE2S_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    memcpy(state->h, blake2s_iv, sizeof(blake2s_iv));
+
+    /* The parameter block, for sequential hashing with a full digest. */
+    state->h[0] ^= 0x01010000 | (uint32_t)(key_len << 8) | BLAKE2S_DIGEST;
+
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    /* A key is hashed as a first, zero-padded, message block. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2S_BLOCK);
+        memcpy(state->block, params->key, key_len);
+        state->block_len = BLAKE2S_BLOCK;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2s_update(struct BLAKE2S_STATE *state,
+                    const void *buffer, size_t len)
+{
+    uint32_t tf[4] = { 0, 0, 0, 0 };
+
+    if (!len) return;
+
+    /* The last block must be compressed with the final flag set, so a block
+     * is only compressed once it is known that more data follows it. */
+
+    if (state->block_len + len > BLAKE2S_BLOCK)
+    {
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(BLAKE2S_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->msg_len += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)state->msg_len;
+            tf[1] = (uint32_t)(state->msg_len >> 32);
+            blake2s_compress(state->h, state->block, tf);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        while (len > BLAKE2S_BLOCK)
+        {
+            state->msg_len += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)state->msg_len;
+            tf[1] = (uint32_t)(state->msg_len >> 32);
+            blake2s_compress(state->h, buffer, tf);
+
+            buffer = offset(buffer, BLAKE2S_BLOCK);
+            len -= BLAKE2S_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2s_final(struct BLAKE2S_STATE *state,
+                   void *digest)
+{
+    uint32_t tf[4] = { 0, 0, 0, 0 };
+    size_t t;
+
+    memset(offset(state->block, state->block_len), 0,
+           (size_t)(BLAKE2S_BLOCK - state->block_len));
+
+    state->msg_len += state->block_len;
+    tf[0] = (uint32_t)state->msg_len;
+    tf[1] = (uint32_t)(state->msg_len >> 32);
+    tf[2] = ~(uint32_t)0;
+    blake2s_compress(state->h, state->block, tf);
+
+    for (t = 0; t < 8; ++t)
+        state->h[t] = tole32(state->h[t]);
+
+    memcpy(digest, state->h, BLAKE2S_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+static const unsigned char blake2s_sigma[10][16] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 }
+};
+
+#define G(r, i, a, b, c, d)                                                  \
+    do {                                                                     \
+        a += b + m[blake2s_sigma[r][2 * i + 0]];                             \
+        d = ror32(d ^ a, 16);                                                \
+        c += d;                                                              \
+        b = ror32(b ^ c, 12);                                                \
+        a += b + m[blake2s_sigma[r][2 * i + 1]];                             \
+        d = ror32(d ^ a,  8);                                                \
+        c += d;                                                              \
+        b = ror32(b ^ c,  7);                                                \
+    } while (0)
+
+void blake2s_compress(uint32_t * RESTRICT h,
+                      const void * RESTRICT block,
+                      const uint32_t * RESTRICT tf)
+{
+    uint32_t m[16], v[16];
+    size_t t;
+
+    /* Unaligned-safe load of the (possibly user-provided) input block. */
+    memcpy(m, block, BLAKE2S_BLOCK);
+
+    for (t = 0; t < 16; ++t) m[t] = fmle32(m[t]);
+
+    for (t = 0; t < 8; ++t)
+    {
+        v[t + 0] = h[t];
+        v[t + 8] = blake2s_iv[t];
+    }
+
+    v[12] ^= tf[0];
+    v[13] ^= tf[1];
+    v[14] ^= tf[2];
+    v[15] ^= tf[3];
+
+    for (t = 0; t < 10; ++t)
+    {
+        G(t, 0, v[ 0], v[ 4], v[ 8], v[12]);
+        G(t, 1, v[ 1], v[ 5], v[ 9], v[13]);
+        G(t, 2, v[ 2], v[ 6], v[10], v[14]);
+        G(t, 3, v[ 3], v[ 7], v[11], v[15]);
+        G(t, 4, v[ 0], v[ 5], v[10], v[15]);
+        G(t, 5, v[ 1], v[ 6], v[11], v[12]);
+        G(t, 6, v[ 2], v[ 7], v[ 8], v[13]);
+        G(t, 7, v[ 3], v[ 4], v[ 9], v[14]);
+    }
+
+    for (t = 0; t < 8; ++t)
+        h[t] ^= v[t] ^ v[t + 8];
+}
@@ -0,0 +1,305 @@
+/*===-- blake2sp.c ------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2s.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2S_DIGEST  (bits(256))
+#define BLAKE2S_BLOCK   (bits(512))
+#define BLAKE2S_KEY_MAX (bits(256))
+
+/* The input is striped over the leaves one block at a time, so that a stripe
+ * of eight blocks gives one block to each leaf. */
+#define BLAKE2SP_LEAVES 8
+#define BLAKE2SP_STRIPE (BLAKE2SP_LEAVES * BLAKE2S_BLOCK)
+
+/* A stripe may only be compressed once every leaf is known to have more input
+ * after it, as each leaf's last block must be compressed with the final flag
+ * set, so up to this many bytes are held back. */
+#define BLAKE2SP_HOLD   (BLAKE2SP_STRIPE + (BLAKE2SP_LEAVES - 1) * BLAKE2S_BLOCK)
+
+ORDO_HIDDEN void blake2s_compress(uint32_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint32_t * RESTRICT tf);
+
+/* Compresses one stripe into all eight leaves at once, as none of them can be
+ * on their last block. The state is stored word by word, with the eight leaves
+ * next to one another, so that the compiler can map leaves to SIMD lanes. */
+static void blake2sp_stripe(uint32_t h[8][BLAKE2SP_LEAVES],
+                            const void *stripe,
+                            uint64_t counter) HOT_CODE;
+
+/* Returns the parameter block's first four words for a BLAKE2sp node. */
+static void blake2sp_param(uint32_t param[4],
+                           size_t key_len,
+                           uint32_t node_offset,
+                           uint32_t node_depth);
+
+static const uint32_t blake2s_iv[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#ifdef OPAQUE
+struct BLAKE2SP_STATE
+{
+    uint32_t h[8][8];
+    uint32_t block[240];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t key_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2sp_init(struct BLAKE2SP_STATE *state,
+                  const struct BLAKE2S_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+    size_t t, l;
+
+    if (key_len > BLAKE2S_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+    {
+        uint32_t param[4];
+
+        blake2sp_param(param, key_len, l, 0);
+
+        for (t = 0; t < 8; ++t)
+            state->h[t][l] = blake2s_iv[t] ^ (t < 4 ? param[t] : 0);
+    }
+
+    state->block_len = 0;
+    state->leaf_len = 0;
+    state->key_len = key_len;
+
+    /* Each leaf hashes the key as its first block, which amounts to prefixing
+     * the input with one stripe holding a copy of the key block per leaf. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2SP_STRIPE);
+
+        for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+            memcpy(offset(state->block, l * BLAKE2S_BLOCK),
+                   params->key, key_len);
+
+        state->block_len = BLAKE2SP_STRIPE;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2sp_update(struct BLAKE2SP_STATE *state,
+                     const void *buffer, size_t len)
+{
+    while (state->block_len + len > BLAKE2SP_HOLD)
+    {
+        if (!state->block_len)
+        {
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, buffer, state->leaf_len);
+
+            buffer = offset(buffer, BLAKE2SP_STRIPE);
+            len -= BLAKE2SP_STRIPE;
+        }
+        else if (state->block_len < BLAKE2SP_STRIPE)
+        {
+            size_t pad = (size_t)(BLAKE2SP_STRIPE - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+        else
+        {
+            /* Only happens when a small update left more than one stripe's
+             * worth of data held back, so the copy is short and rare. */
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len -= BLAKE2SP_STRIPE;
+
+            memmove(state->block, offset(state->block, BLAKE2SP_STRIPE),
+                    (size_t)state->block_len);
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2sp_final(struct BLAKE2SP_STATE *state,
+                    void *digest)
+{
+    uint32_t root[8], leaves[BLAKE2SP_LEAVES][8];
+    uint32_t block[16], param[4], tf[4];
+    uint64_t counter;
+    size_t t, l;
+
+    /* The held back data holds at most two blocks for each leaf, the second
+     * one (if any) being a stripe further than the first. */
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+    {
+        size_t pos = l * BLAKE2S_BLOCK;
+        size_t len = 0;
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = state->h[t][l];
+
+        counter = state->leaf_len;
+        tf[0] = (uint32_t)counter;
+        tf[1] = (uint32_t)(counter >> 32);
+        tf[2] = tf[3] = 0;
+
+        if (state->block_len > pos + BLAKE2SP_STRIPE)
+        {
+            counter += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)counter;
+            tf[1] = (uint32_t)(counter >> 32);
+            blake2s_compress(leaves[l], offset(state->block, pos), tf);
+            pos += BLAKE2SP_STRIPE;
+        }
+
+        if (state->block_len > pos)
+            len = smin((size_t)state->block_len - pos, BLAKE2S_BLOCK);
+
+        memset(block, 0, BLAKE2S_BLOCK);
+        memcpy(block, offset(state->block, pos), len);
+
+        /* The last leaf is also the last node of its level. */
+        counter += len;
+        tf[0] = (uint32_t)counter;
+        tf[1] = (uint32_t)(counter >> 32);
+        tf[2] = ~(uint32_t)0;
+        tf[3] = (l == BLAKE2SP_LEAVES - 1) ? ~(uint32_t)0 : 0;
+        blake2s_compress(leaves[l], block, tf);
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = tole32(leaves[l][t]);
+    }
+
+    /* The root node hashes the eight leaf digests, which are four blocks. */
+    blake2sp_param(param, (size_t)state->key_len, 0, 1);
+
+    for (t = 0; t < 8; ++t)
+        root[t] = blake2s_iv[t] ^ (t < 4 ? param[t] : 0);
+
+    tf[1] = tf[2] = tf[3] = 0;
+
+    for (l = 0; l < BLAKE2SP_LEAVES; l += 2)
+    {
+        tf[0] = (uint32_t)((l / 2 + 1) * BLAKE2S_BLOCK);
+
+        if (l == BLAKE2SP_LEAVES - 2)
+            tf[2] = tf[3] = ~(uint32_t)0;
+
+        blake2s_compress(root, leaves[l], tf);
+    }
+
+    for (t = 0; t < 8; ++t)
+        root[t] = tole32(root[t]);
+
+    memcpy(digest, root, BLAKE2S_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void blake2sp_param(uint32_t param[4],
+                    size_t key_len,
+                    uint32_t node_offset,
+                    uint32_t node_depth)
+{
+    /* Digest length, key length, a fan-out of eight and a depth of two. */
+    param[0] = 0x02080000 | (uint32_t)(key_len << 8) | BLAKE2S_DIGEST;
+    param[1] = 0;
+    param[2] = node_offset;
+    param[3] = (node_depth << 16) | ((uint32_t)BLAKE2S_DIGEST << 24);
+}
+
+static const unsigned char blake2s_sigma[10][16] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+    { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+    {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+    {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+    {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+    { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+    { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+    {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+    { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 }
+};
+
+/* The rotations are written out, rather than calling ror32(), so that every
+ * step of G is a plain loop over the lanes which the compiler vectorizes. */
+#define ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define G(r, i, a, b, c, d)                                                  \
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)                                    \
+    {                                                                        \
+        v[a][l] += v[b][l] + m[blake2s_sigma[r][2 * i + 0]][l];              \
+        v[d][l] = ROR(v[d][l] ^ v[a][l], 16);                                \
+        v[c][l] += v[d][l];                                                  \
+        v[b][l] = ROR(v[b][l] ^ v[c][l], 12);                                \
+        v[a][l] += v[b][l] + m[blake2s_sigma[r][2 * i + 1]][l];              \
+        v[d][l] = ROR(v[d][l] ^ v[a][l],  8);                                \
+        v[c][l] += v[d][l];                                                  \
+        v[b][l] = ROR(v[b][l] ^ v[c][l],  7);                                \
+    }
+
+void blake2sp_stripe(uint32_t h[8][BLAKE2SP_LEAVES],
+                     const void *stripe,
+                     uint64_t counter)
+{
+    uint32_t in[BLAKE2SP_LEAVES][16];
+    uint32_t m[16][BLAKE2SP_LEAVES];
+    uint32_t v[16][BLAKE2SP_LEAVES];
+    size_t t, l;
+
+    /* Unaligned-safe load of the stripe, then transpose it into lanes. */
+    memcpy(in, stripe, BLAKE2SP_STRIPE);
+
+    for (t = 0; t < 16; ++t)
+        for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+            m[t][l] = fmle32(in[l][t]);
+
+    for (t = 0; t < 8; ++t)
+        for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+        {
+            v[t + 0][l] = h[t][l];
+            v[t + 8][l] = blake2s_iv[t];
+        }
+
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+    {
+        v[12][l] ^= (uint32_t)counter;
+        v[13][l] ^= (uint32_t)(counter >> 32);
+    }
+
+    for (t = 0; t < 10; ++t)
+    {
+        G(t, 0,  0,  4,  8, 12);
+        G(t, 1,  1,  5,  9, 13);
+        G(t, 2,  2,  6, 10, 14);
+        G(t, 3,  3,  7, 11, 15);
+        G(t, 4,  0,  5, 10, 15);
+        G(t, 5,  1,  6, 11, 12);
+        G(t, 6,  2,  7,  8, 13);
+        G(t, 7,  3,  4,  9, 14);
+    }
+
+    for (t = 0; t < 8; ++t)
+        for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+            h[t][l] ^= v[t][l] ^ v[t + 8][l];
+}
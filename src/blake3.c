@@ -0,0 +1,430 @@
+/*===-- blake3.c --------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake3.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE3_DIGEST  (bits(256))
+#define BLAKE3_BLOCK   (bits(512))
+#define BLAKE3_CHUNK   (1024)
+#define BLAKE3_KEY_LEN (bits(256))
+
+/* Domain separation flags. */
+#define BLAKE3_CHUNK_START 1
+#define BLAKE3_CHUNK_END   2
+#define BLAKE3_PARENT      4
+#define BLAKE3_ROOT        8
+#define BLAKE3_KEYED_HASH  16
+
+/* Whole chunks are hashed straight from the input in aligned subtrees of up
+ * to this many chunks, each one reduced to a single chaining value. Up to a
+ * batch of such subtrees are hashed at once, spread over multiple threads if
+ * the parameters allow it and there is enough input in the batch to make it
+ * worthwhile. */
+#define BLAKE3_SUBTREE  64
+#define BLAKE3_BATCH    256
+#define BLAKE3_PARALLEL (512 * 1024)
+
+/* See blake3_compress.c. Chaining values passed to or returned by these are
+ * native words, while the ones stored in the stack are little-endian bytes,
+ * so that two of them can be directly used as a parent node's block. */
+ORDO_HIDDEN void blake3_compress(const uint32_t cv[8],
+                                 const void *block,
+                                 uint32_t block_len,
+                                 uint64_t counter,
+                                 uint32_t flags,
+                                 uint32_t out[16]);
+
+ORDO_HIDDEN void blake3_hash_many(const void *input,
+                                  size_t stride,
+                                  size_t count,
+                                  size_t blocks,
+                                  const uint32_t key[8],
+                                  uint64_t counter,
+                                  int increment,
+                                  uint32_t flags,
+                                  uint32_t flags_start,
+                                  uint32_t flags_end,
+                                  void *out);
+
+static const uint32_t blake3_iv[8] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+/* The chunk currently being hashed is kept in "cv" and "block", the latter
+ * always holding back the last block received until it is known whether it
+ * ends the chunk. The stack holds the chaining values of the subtrees which
+ * are complete but not yet merged. It is merged lazily, as the most recent
+ * subtree may turn out to be the root's child, so it can have one entry per
+ * bit of the chunk counter, plus one, which makes 55 enough below 2^64. */
+#ifdef OPAQUE
+struct BLAKE3_STATE
+{
+    uint32_t key[8];
+    uint32_t cv[8];
+    uint32_t block[16];
+    uint32_t stack[55][8];
+    uint64_t stack_len;
+    uint64_t chunk_counter;
+    uint64_t chunk_len;
+    uint64_t block_len;
+    uint64_t flags;
+    uint64_t parallel;
+};
+
+struct BLAKE3_XOF_STATE
+{
+    uint32_t cv[8];
+    uint32_t block[16];
+    uint64_t counter;
+    uint64_t block_len;
+    uint64_t flags;
+    uint64_t position;
+};
+#endif
+
+struct SUBTREE_BATCH
+{
+    const uint32_t *key;
+    const void *buffer;
+    uint32_t flags;
+    size_t chunks;
+    uint64_t counter;
+    uint32_t (*out)[8];
+};
+
+/*===----------------------------------------------------------------------===*/
+
+/* Hashes an aligned subtree of "chunks" whole chunks (a power of two) down to
+ * its chaining value, as little-endian bytes. It must not be the root. */
+static void hash_subtree(const uint32_t key[8], uint32_t flags,
+                         const void *input, size_t chunks,
+                         uint64_t counter, uint32_t out[8])
+{
+    uint32_t cvs[BLAKE3_SUBTREE][8];
+
+    blake3_hash_many(input, BLAKE3_CHUNK, chunks, BLAKE3_CHUNK / BLAKE3_BLOCK,
+                     key, counter, 1, flags,
+                     BLAKE3_CHUNK_START, BLAKE3_CHUNK_END, cvs);
+
+    /* Each parent only overwrites chaining values already consumed. */
+    while (chunks > 1)
+    {
+        chunks /= 2;
+
+        blake3_hash_many(cvs, BLAKE3_BLOCK, chunks, 1,
+                         key, 0, 0, flags | BLAKE3_PARENT, 0, 0, cvs);
+    }
+
+    memcpy(out, cvs[0], BLAKE3_DIGEST);
+}
+
+static void subtree_job(void *ctx, size_t index)
+{
+    const struct SUBTREE_BATCH *batch = (const struct SUBTREE_BATCH *)ctx;
+
+    hash_subtree(batch->key, batch->flags,
+                 offset(batch->buffer, index * batch->chunks * BLAKE3_CHUNK),
+                 batch->chunks,
+                 batch->counter + (uint64_t)index * batch->chunks,
+                 batch->out[index]);
+}
+
+/* Computes the (little-endian) chaining value of a parent node. */
+static void parent_cv(const struct BLAKE3_STATE *state,
+                      const uint32_t left[8], const uint32_t right[8],
+                      uint32_t out[8])
+{
+    uint32_t block[16], words[16];
+    size_t t;
+
+    memcpy(block + 0, left,  BLAKE3_DIGEST);
+    memcpy(block + 8, right, BLAKE3_DIGEST);
+
+    blake3_compress(state->key, block, BLAKE3_BLOCK, 0,
+                    (uint32_t)state->flags | BLAKE3_PARENT, words);
+
+    for (t = 0; t < 8; ++t) out[t] = tole32(words[t]);
+}
+
+/* Merges the stack down to one entry per bit of "total", the number of chunks
+ * which come before whatever will be pushed onto the stack next. */
+static void merge_stack(struct BLAKE3_STATE *state, uint64_t total)
+{
+    size_t target = 0;
+
+    while (total)
+    {
+        target += (size_t)(total & 1);
+        total >>= 1;
+    }
+
+    while (state->stack_len > target)
+    {
+        uint32_t *left = state->stack[state->stack_len - 2];
+
+        parent_cv(state, left, state->stack[state->stack_len - 1], left);
+        --state->stack_len;
+    }
+}
+
+/* Pushes the chaining value of a subtree starting at chunk "counter". */
+static void push_cv(struct BLAKE3_STATE *state,
+                    const uint32_t cv[8], uint64_t counter)
+{
+    merge_stack(state, counter);
+    memcpy(state->stack[state->stack_len++], cv, BLAKE3_DIGEST);
+}
+
+static uint32_t chunk_flags(const struct BLAKE3_STATE *state)
+{
+    uint32_t flags = (uint32_t)state->flags;
+
+    if (state->chunk_len <= BLAKE3_BLOCK)
+        flags |= BLAKE3_CHUNK_START;
+
+    return flags;
+}
+
+/* Feeds data into the current chunk, which must have room for all of it. */
+static void chunk_update(struct BLAKE3_STATE *state,
+                         const void *buffer, size_t len)
+{
+    while (len)
+    {
+        size_t take;
+
+        if (state->block_len == BLAKE3_BLOCK)
+        {
+            uint32_t out[16];
+
+            blake3_compress(state->cv, state->block, BLAKE3_BLOCK,
+                            state->chunk_counter, chunk_flags(state), out);
+
+            memcpy(state->cv, out, BLAKE3_DIGEST);
+            state->block_len = 0;
+        }
+
+        take = smin(len, (size_t)(BLAKE3_BLOCK - state->block_len));
+        memcpy(offset(state->block, state->block_len), buffer, take);
+        state->block_len += take;
+        state->chunk_len += take;
+
+        buffer = offset(buffer, take);
+        len -= take;
+    }
+}
+
+/* Sets up the output of the current chunk, without the root flag. */
+static void chunk_output(const struct BLAKE3_STATE *state,
+                         struct BLAKE3_XOF_STATE *xof)
+{
+    memcpy(xof->cv, state->cv, BLAKE3_DIGEST);
+    memcpy(xof->block, state->block, BLAKE3_BLOCK);
+
+    memset(offset(xof->block, state->block_len), 0,
+           (size_t)(BLAKE3_BLOCK - state->block_len));
+
+    xof->counter = state->chunk_counter;
+    xof->block_len = state->block_len;
+    xof->flags = chunk_flags(state) | BLAKE3_CHUNK_END;
+}
+
+/* Computes the (little-endian) chaining value of a node's output. */
+static void output_cv(const struct BLAKE3_XOF_STATE *xof, uint32_t cv[8])
+{
+    uint32_t words[16];
+    size_t t;
+
+    blake3_compress(xof->cv, xof->block, (uint32_t)xof->block_len,
+                    xof->counter, (uint32_t)xof->flags, words);
+
+    for (t = 0; t < 8; ++t) cv[t] = tole32(words[t]);
+}
+
+/* Completes the current chunk and starts a new one. */
+static void finish_chunk(struct BLAKE3_STATE *state)
+{
+    struct BLAKE3_XOF_STATE output;
+    uint32_t cv[8];
+
+    chunk_output(state, &output);
+    output_cv(&output, cv);
+    push_cv(state, cv, state->chunk_counter);
+
+    memcpy(state->cv, state->key, BLAKE3_DIGEST);
+    state->chunk_len = 0;
+    state->block_len = 0;
+    ++state->chunk_counter;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int blake3_init(struct BLAKE3_STATE *state,
+                const struct BLAKE3_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+
+    state->parallel = params ? (params->parallel != 0) : 0;
+
+    if (key_len)
+    {
+        size_t t;
+
+        if (key_len != BLAKE3_KEY_LEN)
+            return ORDO_KEY_LEN;
+
+        memcpy(state->key, params->key, BLAKE3_KEY_LEN);
+
+        for (t = 0; t < 8; ++t)
+            state->key[t] = fmle32(state->key[t]);
+
+        state->flags = BLAKE3_KEYED_HASH;
+    }
+    else
+    {
+        memcpy(state->key, blake3_iv, sizeof(blake3_iv));
+        state->flags = 0;
+    }
+
+    memcpy(state->cv, state->key, BLAKE3_DIGEST);
+    state->stack_len = 0;
+    state->chunk_counter = 0;
+    state->chunk_len = 0;
+    state->block_len = 0;
+
+    return ORDO_SUCCESS;
+}
+
+void blake3_update(struct BLAKE3_STATE *state,
+                   const void *buffer, size_t len)
+{
+    if (!len) return;
+
+    while (len)
+    {
+        if (state->chunk_len == BLAKE3_CHUNK)
+            finish_chunk(state);
+
+        /* Whole chunks can be hashed straight from the input, in subtrees
+         * aligned on their size, but always keep the last chunk, in case it
+         * ends the message, as it could then be the root. */
+        if (!state->chunk_len && (len > BLAKE3_CHUNK))
+        {
+            uint32_t out[BLAKE3_BATCH][8];
+            struct SUBTREE_BATCH batch;
+            size_t avail = (len - 1) / BLAKE3_CHUNK;
+            size_t chunks = 1, count = 1, t;
+
+            while ((chunks < BLAKE3_SUBTREE) && (chunks * 2 <= avail)
+                && !(state->chunk_counter & (chunks * 2 - 1)))
+                chunks *= 2;
+
+            if (chunks == BLAKE3_SUBTREE)
+                count = smin(avail / BLAKE3_SUBTREE, BLAKE3_BATCH);
+
+            batch.key = state->key;
+            batch.buffer = buffer;
+            batch.flags = (uint32_t)state->flags;
+            batch.chunks = chunks;
+            batch.counter = state->chunk_counter;
+            batch.out = out;
+
+            if (state->parallel
+                && (count * chunks * BLAKE3_CHUNK >= BLAKE3_PARALLEL))
+                sys_parallel(count, subtree_job, &batch);
+            else
+                for (t = 0; t < count; ++t) subtree_job(&batch, t);
+
+            for (t = 0; t < count; ++t)
+                push_cv(state, out[t], state->chunk_counter + t * chunks);
+
+            state->chunk_counter += count * chunks;
+            buffer = offset(buffer, count * chunks * BLAKE3_CHUNK);
+            len -= count * chunks * BLAKE3_CHUNK;
+        }
+        else
+        {
+            size_t take = smin(len, (size_t)(BLAKE3_CHUNK - state->chunk_len));
+
+            chunk_update(state, buffer, take);
+            buffer = offset(buffer, take);
+            len -= take;
+        }
+    }
+
+    /* There is more input after the stack, so it can be merged. */
+    merge_stack(state, state->chunk_counter);
+}
+
+void blake3_final(struct BLAKE3_STATE *state,
+                  void *digest)
+{
+    struct BLAKE3_XOF_STATE xof;
+
+    blake3_xof_init(&xof, state);
+    blake3_xof_read(&xof, digest, BLAKE3_DIGEST);
+}
+
+void blake3_xof_init(struct BLAKE3_XOF_STATE *xof,
+                     const struct BLAKE3_STATE *state)
+{
+    size_t t = (size_t)state->stack_len;
+
+    chunk_output(state, xof);
+
+    /* Fold the stack into the root node, from the most recent subtree. */
+    while (t--)
+    {
+        uint32_t cv[8];
+
+        output_cv(xof, cv);
+
+        memcpy(xof->cv, state->key, BLAKE3_DIGEST);
+        memcpy(xof->block + 0, state->stack[t], BLAKE3_DIGEST);
+        memcpy(xof->block + 8, cv, BLAKE3_DIGEST);
+        xof->counter = 0;
+        xof->block_len = BLAKE3_BLOCK;
+        xof->flags = state->flags | BLAKE3_PARENT;
+    }
+
+    xof->flags |= BLAKE3_ROOT;
+    xof->position = 0;
+}
+
+void blake3_xof_read(struct BLAKE3_XOF_STATE *xof,
+                     void *out, size_t len)
+{
+    while (len)
+    {
+        size_t pos = (size_t)(xof->position % BLAKE3_BLOCK);
+        size_t take = smin(len, BLAKE3_BLOCK - pos);
+        uint32_t words[16];
+        size_t t;
+
+        /* The output blocks are numbered by the counter of the root node. */
+        blake3_compress(xof->cv, xof->block, (uint32_t)xof->block_len,
+                        xof->position / BLAKE3_BLOCK,
+                        (uint32_t)xof->flags, words);
+
+        for (t = 0; t < 16; ++t) words[t] = tole32(words[t]);
+
+        memcpy(out, (unsigned char *)words + pos, take);
+        xof->position += take;
+
+        out = offset(out, take);
+        len -= take;
+    }
+}
+
+void blake3_xof_seek(struct BLAKE3_XOF_STATE *xof,
+                     uint64_t position)
+{
+    xof->position = position;
+}
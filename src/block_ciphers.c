@@ -17,6 +17,9 @@
 #if WITH_THREEFISH256
 #include "ordo/primitives/block_ciphers/threefish256.h"
 #endif
+#if WITH_THREEFISH512
+#include "ordo/primitives/block_ciphers/threefish512.h"
+#endif
 
 int block_init(struct BLOCK_STATE *state,
                const void *key, size_t key_len,
@@ -36,6 +39,10 @@ int block_init(struct BLOCK_STATE *state,
         case BLOCK_THREEFISH256:
             return threefish256_init(&state->jmp.threefish256, key, key_len, params);
         #endif
+        #if WITH_THREEFISH512
+        case BLOCK_THREEFISH512:
+            return threefish512_init(&state->jmp.threefish512, key, key_len, params);
+        #endif
     }
 
     return ORDO_ARG;
@@ -61,6 +68,11 @@ void block_forward(const struct BLOCK_STATE *state,
             threefish256_forward(&state->jmp.threefish256, block);
             break;
         #endif
+        #if WITH_THREEFISH512
+        case BLOCK_THREEFISH512:
+            threefish512_forward(&state->jmp.threefish512, block);
+            break;
+        #endif
     }
 }
 
@@ -84,6 +96,11 @@ void block_inverse(const struct BLOCK_STATE *state,
             threefish256_inverse(&state->jmp.threefish256, block);
             break;
         #endif
+        #if WITH_THREEFISH512
+        case BLOCK_THREEFISH512:
+            threefish512_inverse(&state->jmp.threefish512, block);
+            break;
+        #endif
     }
 }
 
@@ -106,6 +123,11 @@ void block_final(struct BLOCK_STATE *state)
             threefish256_final(&state->jmp.threefish256);
             break;
         #endif
+        #if WITH_THREEFISH512
+        case BLOCK_THREEFISH512:
+            threefish512_final(&state->jmp.threefish512);
+            break;
+        #endif
     }
 }
 
@@ -125,6 +147,10 @@ int block_limits(prim_t primitive, struct BLOCK_LIMITS *limits)
         case BLOCK_THREEFISH256:
             return threefish256_limits(limits);
         #endif
+        #if WITH_THREEFISH512
+        case BLOCK_THREEFISH512:
+            return threefish512_limits(limits);
+        #endif
     }
 
     return ORDO_ARG;
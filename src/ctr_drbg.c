@@ -0,0 +1,226 @@
+/*===-- ctr_drbg.c ------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/misc/ctr_drbg.h"
+#include "ordo/misc/os_random.h"
+#include "ordo/primitives/block_ciphers/aes.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* See aes.c. */
+ORDO_HIDDEN void aes_forward_many(const struct AES_STATE *state,
+                                  void *blocks, size_t count);
+
+#define CTR_DRBG_KEY_LEN    (32)
+#define CTR_DRBG_MAX_BLOCKS (4096) /* 2^19 bits per request. */
+#define CTR_DRBG_CHUNK      (64)
+#define CTR_DRBG_TAIL       (8)
+
+/* The counter V is kept as two native words, holding V + 1 rather than V,
+ * which is the next counter block to be encrypted. "requests" is the reseed
+ * counter of SP 800-90A, the number of requests since the last (re)seed. */
+#ifdef OPAQUE
+struct CTR_DRBG_CTX
+{
+    struct AES_STATE key;
+    uint64_t hi, lo;
+    uint64_t requests, interval;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+/* Writes "count" blocks of keystream to "out", advancing the counter. The
+ * counter blocks are written out and then encrypted in place, a chunk at a
+ * time so that they are still in the cache when they are encrypted. */
+static void ctr_drbg_keystream(struct CTR_DRBG_CTX *ctx,
+                               void *out, size_t count)
+{
+    while (count)
+    {
+        size_t n = smin(count, CTR_DRBG_CHUNK), t;
+        unsigned char *block = out;
+
+        for (t = 0; t < n; ++t)
+        {
+            uint64_t hi = tobe64(ctx->hi), lo = tobe64(ctx->lo);
+
+            memcpy(block + 16 * t + 0, &hi, 8);
+            memcpy(block + 16 * t + 8, &lo, 8);
+
+            if (!++ctx->lo) ++ctx->hi;
+        }
+
+        aes_forward_many(&ctx->key, out, n);
+
+        out = offset(out, 16 * n);
+        count -= n;
+    }
+}
+
+/* The end of the CTR_DRBG_Update function, which derives a new key and
+ * counter from the three keystream blocks at "temp", XORed with "data"
+ * unless it is nil. The keystream blocks are then erased. */
+static void ctr_drbg_rekey(struct CTR_DRBG_CTX *ctx, unsigned char *temp,
+                           const unsigned char *data)
+{
+    uint64_t hi, lo;
+
+    if (data) xor_buffer(temp, data, CTR_DRBG_SEED_LEN);
+
+    aes_init(&ctx->key, temp, CTR_DRBG_KEY_LEN, 0);
+
+    memcpy(&hi, temp + CTR_DRBG_KEY_LEN + 0, 8);
+    memcpy(&lo, temp + CTR_DRBG_KEY_LEN + 8, 8);
+    ctx->hi = fmbe64(hi);
+    ctx->lo = fmbe64(lo);
+
+    if (!++ctx->lo) ++ctx->hi;
+
+    memset(temp, 0, CTR_DRBG_SEED_LEN);
+}
+
+static void ctr_drbg_update(struct CTR_DRBG_CTX *ctx,
+                            const unsigned char *data)
+{
+    unsigned char temp[CTR_DRBG_SEED_LEN];
+
+    ctr_drbg_keystream(ctx, temp, CTR_DRBG_SEED_LEN / 16);
+    ctr_drbg_rekey(ctx, temp, data);
+}
+
+/* Combines a seed with an optional string, as a seed material. */
+static int ctr_drbg_material(unsigned char *material,
+                             const void *str, size_t len)
+{
+    if (len > CTR_DRBG_SEED_LEN) return ORDO_ARG;
+
+    if (len) xor_buffer(material, str, len);
+
+    return ORDO_SUCCESS;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int ctr_drbg_init(struct CTR_DRBG_CTX *ctx,
+                  const void *personal, size_t personal_len,
+                  uint64_t interval)
+{
+    int err;
+
+    unsigned char seed[CTR_DRBG_SEED_LEN];
+
+    if (interval > CTR_DRBG_MAX_INTERVAL) return ORDO_ARG;
+    if (personal_len > CTR_DRBG_SEED_LEN) return ORDO_ARG;
+
+    if ((err = os_secure_random(seed, sizeof(seed))))
+        return err;
+
+    err = ctr_drbg_seed(ctx, seed, sizeof(seed), personal, personal_len);
+
+    if (!err && interval) ctx->interval = interval;
+
+    memset(seed, 0, sizeof(seed));
+
+    return err;
+}
+
+int ctr_drbg_seed(struct CTR_DRBG_CTX *ctx,
+                  const void *seed, size_t seed_len,
+                  const void *personal, size_t personal_len)
+{
+    int err;
+
+    unsigned char material[CTR_DRBG_SEED_LEN];
+    unsigned char zero[CTR_DRBG_KEY_LEN] = {0};
+
+    if (seed_len != CTR_DRBG_SEED_LEN) return ORDO_ARG;
+
+    memcpy(material, seed, CTR_DRBG_SEED_LEN);
+
+    if (!(err = ctr_drbg_material(material, personal, personal_len)))
+    {
+        /* The initial key and counter are all zeroes. */
+        aes_init(&ctx->key, zero, CTR_DRBG_KEY_LEN, 0);
+        ctx->hi = 0;
+        ctx->lo = 1;
+
+        ctr_drbg_update(ctx, material);
+
+        ctx->requests = 1;
+        ctx->interval = CTR_DRBG_MAX_INTERVAL;
+    }
+
+    memset(material, 0, sizeof(material));
+
+    return err;
+}
+
+int ctr_drbg_reseed(struct CTR_DRBG_CTX *ctx,
+                    const void *additional, size_t additional_len)
+{
+    int err;
+
+    unsigned char material[CTR_DRBG_SEED_LEN];
+
+    if (additional_len > CTR_DRBG_SEED_LEN) return ORDO_ARG;
+
+    if ((err = os_secure_random(material, sizeof(material))))
+        return err;
+
+    if (!(err = ctr_drbg_material(material, additional, additional_len)))
+    {
+        ctr_drbg_update(ctx, material);
+        ctx->requests = 1;
+    }
+
+    memset(material, 0, sizeof(material));
+
+    return err;
+}
+
+int ctr_drbg_generate(struct CTR_DRBG_CTX *ctx, void *out, size_t len)
+{
+    int err;
+
+    unsigned char tail[CTR_DRBG_TAIL * 16];
+
+    while (len)
+    {
+        size_t n = smin(len, CTR_DRBG_MAX_BLOCKS * 16), direct, rest;
+
+        if (ctx->requests > ctx->interval)
+            if ((err = ctr_drbg_reseed(ctx, 0, 0)))
+                return err;
+
+        /* The last few blocks of the request, the last of which may only be
+         * partly used, are generated along with the three blocks that the
+         * update then needs, so that small requests take a single batch. */
+        rest = (n + 15) / 16;
+        direct = (rest > CTR_DRBG_TAIL - 3) ? rest - (CTR_DRBG_TAIL - 3) : 0;
+        rest -= direct;
+
+        ctr_drbg_keystream(ctx, out, direct);
+        ctr_drbg_keystream(ctx, tail, rest + 3);
+
+        memcpy(offset(out, direct * 16), tail, n - direct * 16);
+        ctr_drbg_rekey(ctx, tail + rest * 16, 0);
+        memset(tail, 0, rest * 16);
+
+        ++ctx->requests;
+
+        out = offset(out, n);
+        len -= n;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void ctr_drbg_final(struct CTR_DRBG_CTX *ctx)
+{
+    aes_final(&ctx->key);
+    memset(ctx, 0, sizeof(*ctx));
+}
@@ -9,47 +9,19 @@
 
 /*===----------------------------------------------------------------------===*/
 
+/* See edwards25519.c. */
+ORDO_HIDDEN void edwards25519_base_u(uint8_t *u, const uint8_t *scalar,
+                                     size_t count);
+
+/* The largest number of scalar multiplications done by curve25519_many. */
+#define CURVE25519_BATCH (16)
+
 /** Code from curve25519-donna - see license above implementation below. **/
 
 typedef uint8_t u8;
-typedef int64_t felem;
 
-static void fsum(felem *output, const felem *in)
-HOT_CODE;
-static void fdifference(felem *output, const felem *in)
-HOT_CODE;
-static void fscalar_product(felem *output, const felem *in,
-                            const felem scalar)
-HOT_CODE;
-static void fproduct(felem *output, const felem *in2, const felem *in)
-HOT_CODE;
-static void freduce_degree(felem *output)
-HOT_CODE;
-static void freduce_coefficients(felem *output)
-HOT_CODE;
-static void fmul(felem *output, const felem *in, const felem *in2)
-HOT_CODE;
-static void fsquare_inner(felem *output, const felem *in)
-HOT_CODE;
-static void fsquare(felem *output, const felem *in)
-HOT_CODE;
-static void fexpand(felem *output, const u8 *input)
-HOT_CODE;
-static void fcontract(u8 *output, felem *input)
-HOT_CODE;
-static void fmonty(felem *x2, felem *z2,
-                   felem *x3, felem *z3,
-                   felem *x, felem *z,
-                   felem *xprime, felem *zprime,
-                   const felem *qmqp)
-HOT_CODE;
-static void cmult(felem *resultx, felem *resultz,
-                  const u8 *n, const felem *q)
-HOT_CODE;
-static void crecip(felem *out, const felem *z)
-HOT_CODE;
-static void curve25519_donna(u8 *mypublic, const u8 *secret,
-                             const u8 *basepoint)
+static void curve25519_many(u8 *out, const u8 *secret, const u8 *point,
+                            size_t count)
 HOT_CODE;
 
 /*===----------------------------------------------------------------------===*/
@@ -57,7 +29,7 @@ HOT_CODE;
 int curve25519_gen(void *priv)
 {
     int err = os_secure_random(priv, bits(256));
-    if (!err) return err;
+    if (err) return err;
     *((uint8_t *)priv +  0) &= 248;
     *((uint8_t *)priv + 31) &= 127;
     *((uint8_t *)priv + 31) |=  64;
@@ -66,13 +38,33 @@ int curve25519_gen(void *priv)
 
 void curve25519_pub(void *pub, const void *priv)
 {
-    static const uint8_t basepoint[32] = { 9 };
-    curve25519_donna(pub, priv, basepoint);
+    edwards25519_base_u(pub, priv, 1);
 }
 
 void curve25519_ecdh(void *shared, const void *priv, const void *other)
 {
-    curve25519_donna(shared, priv, other);
+    curve25519_many(shared, priv, other, 1);
+}
+
+void curve25519_pub_batch(void *pub, const void *priv, size_t count)
+{
+    edwards25519_base_u(pub, priv, count);
+}
+
+void curve25519_ecdh_batch(void *shared, const void *priv,
+                           const void *other, size_t count)
+{
+    while (count)
+    {
+        size_t n = smin(count, CURVE25519_BATCH);
+
+        curve25519_many(shared, priv, other, n);
+
+        shared = offset(shared, bits(256) * n);
+        priv = offset(priv, bits(256) * n);
+        other = offset(other, bits(256) * n);
+        count -= n;
+    }
 }
 
 /*===----------------------------------------------------------------------===*/
@@ -127,6 +119,518 @@ void curve25519_ecdh(void *shared, const void *priv, const void *other)
  * from the sample implementation.
  */
 
+/* With a 128-bit integer type, the 64-bit variant of curve25519-donna is
+ * used instead, which is also by Adam Langley, and was released into the
+ * public domain. Field elements are five unsigned limbs of 51 bits, as in
+ * the AMD64 assembly, so products of limbs take a single 64x64->128 bit
+ * multiplication, and there are 25 of them per field multiplication rather
+ * than the 100 of the 10-limb representation below. */
+
+#if defined(HAS_UINT128)
+
+typedef uint64_t limb;
+typedef limb felem[5];
+
+#define LOW51 (UINT64_C(0x7ffffffffffff))
+
+static void fsum(limb *output, const limb *in)
+HOT_CODE;
+static void fdifference_backwards(felem out, const felem in)
+HOT_CODE;
+static void fscalar_product(felem output, const felem in, const limb scalar)
+HOT_CODE;
+static void fmul(felem output, const felem in2, const felem in)
+HOT_CODE;
+static void fsquare_times(felem output, const felem in, limb count)
+HOT_CODE;
+static void fexpand(limb *output, const u8 *in)
+HOT_CODE;
+static void fcontract(u8 *output, const felem input)
+HOT_CODE;
+static void fmonty(limb *x2, limb *z2,
+                   limb *x3, limb *z3,
+                   limb *x, limb *z,
+                   limb *xprime, limb *zprime,
+                   const limb *qmqp)
+HOT_CODE;
+static void swap_conditional(limb a[5], limb b[5], limb iswap)
+HOT_CODE;
+static void cmult(limb *resultx, limb *resultz, const u8 *n, const limb *q)
+HOT_CODE;
+static void crecip(felem out, const felem z)
+HOT_CODE;
+
+/* Sum two numbers: output += in */
+void fsum(limb *output, const limb *in) {
+  output[0] += in[0];
+  output[1] += in[1];
+  output[2] += in[2];
+  output[3] += in[3];
+  output[4] += in[4];
+}
+
+/* Find the difference of two numbers: output = in - output
+ * (note the order of the arguments!)
+ *
+ * Assumes that out[i] < 2**52
+ * On return, out[i] < 2**55
+ */
+void fdifference_backwards(felem out, const felem in) {
+  /* 152 is 19 << 3 */
+  static const limb two54m152 = (((limb)1) << 54) - 152;
+  static const limb two54m8 = (((limb)1) << 54) - 8;
+
+  out[0] = in[0] + two54m152 - out[0];
+  out[1] = in[1] + two54m8 - out[1];
+  out[2] = in[2] + two54m8 - out[2];
+  out[3] = in[3] + two54m8 - out[3];
+  out[4] = in[4] + two54m8 - out[4];
+}
+
+/* Multiply a number by a scalar: output = in * scalar */
+void fscalar_product(felem output, const felem in, const limb scalar) {
+  uint128_t a;
+
+  a = ((uint128_t) in[0]) * scalar;
+  output[0] = ((limb)a) & LOW51;
+
+  a = ((uint128_t) in[1]) * scalar + ((limb) (a >> 51));
+  output[1] = ((limb)a) & LOW51;
+
+  a = ((uint128_t) in[2]) * scalar + ((limb) (a >> 51));
+  output[2] = ((limb)a) & LOW51;
+
+  a = ((uint128_t) in[3]) * scalar + ((limb) (a >> 51));
+  output[3] = ((limb)a) & LOW51;
+
+  a = ((uint128_t) in[4]) * scalar + ((limb) (a >> 51));
+  output[4] = ((limb)a) & LOW51;
+
+  output[0] += (limb)(a >> 51) * 19;
+}
+
+/* Multiply two numbers: output = in2 * in
+ *
+ * output may alias either input, as both are read before it is written.
+ *
+ * Assumes that in[i] < 2**55 and likewise for in2.
+ * On return, output[i] < 2**52
+ */
+void fmul(felem output, const felem in2, const felem in) {
+  uint128_t t[5];
+  limb r0,r1,r2,r3,r4,s0,s1,s2,s3,s4,c;
+
+  r0 = in[0];
+  r1 = in[1];
+  r2 = in[2];
+  r3 = in[3];
+  r4 = in[4];
+
+  s0 = in2[0];
+  s1 = in2[1];
+  s2 = in2[2];
+  s3 = in2[3];
+  s4 = in2[4];
+
+  t[0]  =  ((uint128_t) r0) * s0;
+  t[1]  =  ((uint128_t) r0) * s1 + ((uint128_t) r1) * s0;
+  t[2]  =  ((uint128_t) r0) * s2 + ((uint128_t) r2) * s0 + ((uint128_t) r1) * s1;
+  t[3]  =  ((uint128_t) r0) * s3 + ((uint128_t) r3) * s0 + ((uint128_t) r1) * s2 + ((uint128_t) r2) * s1;
+  t[4]  =  ((uint128_t) r0) * s4 + ((uint128_t) r4) * s0 + ((uint128_t) r3) * s1 + ((uint128_t) r1) * s3 + ((uint128_t) r2) * s2;
+
+  r4 *= 19;
+  r1 *= 19;
+  r2 *= 19;
+  r3 *= 19;
+
+  t[0] += ((uint128_t) r4) * s1 + ((uint128_t) r1) * s4 + ((uint128_t) r2) * s3 + ((uint128_t) r3) * s2;
+  t[1] += ((uint128_t) r4) * s2 + ((uint128_t) r2) * s4 + ((uint128_t) r3) * s3;
+  t[2] += ((uint128_t) r4) * s3 + ((uint128_t) r3) * s4;
+  t[3] += ((uint128_t) r4) * s4;
+
+                  r0 = (limb)t[0] & LOW51; c = (limb)(t[0] >> 51);
+  t[1] += c;      r1 = (limb)t[1] & LOW51; c = (limb)(t[1] >> 51);
+  t[2] += c;      r2 = (limb)t[2] & LOW51; c = (limb)(t[2] >> 51);
+  t[3] += c;      r3 = (limb)t[3] & LOW51; c = (limb)(t[3] >> 51);
+  t[4] += c;      r4 = (limb)t[4] & LOW51; c = (limb)(t[4] >> 51);
+  r0 +=   c * 19; c = r0 >> 51; r0 = r0 & LOW51;
+  r1 +=   c;      c = r1 >> 51; r1 = r1 & LOW51;
+  r2 +=   c;
+
+  output[0] = r0;
+  output[1] = r1;
+  output[2] = r2;
+  output[3] = r3;
+  output[4] = r4;
+}
+
+/* Square a number "count" times: output = in ** (2 ** count)
+ *
+ * output may alias the input. The same bounds as for fmul apply.
+ */
+void fsquare_times(felem output, const felem in, limb count) {
+  uint128_t t[5];
+  limb r0,r1,r2,r3,r4,c;
+  limb d0,d1,d2,d4,d419;
+
+  r0 = in[0];
+  r1 = in[1];
+  r2 = in[2];
+  r3 = in[3];
+  r4 = in[4];
+
+  do {
+    d0 = r0 * 2;
+    d1 = r1 * 2;
+    d2 = r2 * 2 * 19;
+    d419 = r4 * 19;
+    d4 = d419 * 2;
+
+    t[0] = ((uint128_t) r0) * r0 + ((uint128_t) d4) * r1 + (((uint128_t) d2) * (r3     ));
+    t[1] = ((uint128_t) d0) * r1 + ((uint128_t) d4) * r2 + (((uint128_t) r3) * (r3 * 19));
+    t[2] = ((uint128_t) d0) * r2 + ((uint128_t) r1) * r1 + (((uint128_t) d4) * (r3     ));
+    t[3] = ((uint128_t) d0) * r3 + ((uint128_t) d1) * r2 + (((uint128_t) r4) * (d419   ));
+    t[4] = ((uint128_t) d0) * r4 + ((uint128_t) d1) * r3 + (((uint128_t) r2) * (r2     ));
+
+                    r0 = (limb)t[0] & LOW51; c = (limb)(t[0] >> 51);
+    t[1] += c;      r1 = (limb)t[1] & LOW51; c = (limb)(t[1] >> 51);
+    t[2] += c;      r2 = (limb)t[2] & LOW51; c = (limb)(t[2] >> 51);
+    t[3] += c;      r3 = (limb)t[3] & LOW51; c = (limb)(t[3] >> 51);
+    t[4] += c;      r4 = (limb)t[4] & LOW51; c = (limb)(t[4] >> 51);
+    r0 +=   c * 19; c = r0 >> 51; r0 = r0 & LOW51;
+    r1 +=   c;      c = r1 >> 51; r1 = r1 & LOW51;
+    r2 +=   c;
+  } while(--count);
+
+  output[0] = r0;
+  output[1] = r1;
+  output[2] = r2;
+  output[3] = r3;
+  output[4] = r4;
+}
+
+/* Load a little-endian 64-bit number */
+static limb load_limb(const u8 *in) {
+  limb out;
+  memcpy(&out, in, sizeof(out));
+  return fmle64(out);
+}
+
+static void store_limb(u8 *out, limb in) {
+  in = tole64(in);
+  memcpy(out, &in, sizeof(in));
+}
+
+/* Take a little-endian, 32-byte number and expand it into polynomial form */
+void fexpand(limb *output, const u8 *in) {
+  output[0] = load_limb(in) & LOW51;
+  output[1] = (load_limb(in+6) >> 3) & LOW51;
+  output[2] = (load_limb(in+12) >> 6) & LOW51;
+  output[3] = (load_limb(in+19) >> 1) & LOW51;
+  output[4] = (load_limb(in+24) >> 12) & LOW51;
+}
+
+/* Take a fully reduced polynomial form number and contract it into a
+ * little-endian, 32-byte array
+ */
+void fcontract(u8 *output, const felem input) {
+  limb t[5];
+
+  t[0] = input[0];
+  t[1] = input[1];
+  t[2] = input[2];
+  t[3] = input[3];
+  t[4] = input[4];
+
+  t[1] += t[0] >> 51; t[0] &= LOW51;
+  t[2] += t[1] >> 51; t[1] &= LOW51;
+  t[3] += t[2] >> 51; t[2] &= LOW51;
+  t[4] += t[3] >> 51; t[3] &= LOW51;
+  t[0] += 19 * (t[4] >> 51); t[4] &= LOW51;
+
+  t[1] += t[0] >> 51; t[0] &= LOW51;
+  t[2] += t[1] >> 51; t[1] &= LOW51;
+  t[3] += t[2] >> 51; t[2] &= LOW51;
+  t[4] += t[3] >> 51; t[3] &= LOW51;
+  t[0] += 19 * (t[4] >> 51); t[4] &= LOW51;
+
+  /* now t is between 0 and 2^255-1, properly carried. */
+  /* case 1: between 0 and 2^255-20. case 2: between 2^255-19 and 2^255-1. */
+
+  t[0] += 19;
+
+  t[1] += t[0] >> 51; t[0] &= LOW51;
+  t[2] += t[1] >> 51; t[1] &= LOW51;
+  t[3] += t[2] >> 51; t[2] &= LOW51;
+  t[4] += t[3] >> 51; t[3] &= LOW51;
+  t[0] += 19 * (t[4] >> 51); t[4] &= LOW51;
+
+  /* now between 19 and 2^255-1 in both cases, and offset by 19. */
+
+  t[0] += 0x8000000000000 - 19;
+  t[1] += 0x8000000000000 - 1;
+  t[2] += 0x8000000000000 - 1;
+  t[3] += 0x8000000000000 - 1;
+  t[4] += 0x8000000000000 - 1;
+
+  /* now between 2^255 and 2^256-20, and offset by 2^255. */
+
+  t[1] += t[0] >> 51; t[0] &= LOW51;
+  t[2] += t[1] >> 51; t[1] &= LOW51;
+  t[3] += t[2] >> 51; t[2] &= LOW51;
+  t[4] += t[3] >> 51; t[3] &= LOW51;
+  t[4] &= LOW51;
+
+  store_limb(output,    t[0] | (t[1] << 51));
+  store_limb(output+8,  (t[1] >> 13) | (t[2] << 38));
+  store_limb(output+16, (t[2] >> 26) | (t[3] << 25));
+  store_limb(output+24, (t[3] >> 39) | (t[4] << 12));
+}
+
+/* Input: Q, Q', Q-Q'
+ * Output: 2Q, Q+Q'
+ *
+ *   x2 z3: long form
+ *   x3 z3: long form
+ *   x z: short form, destroyed
+ *   xprime zprime: short form, destroyed
+ *   qmqp: short form, preserved
+ */
+void fmonty(limb *x2, limb *z2, /* output 2Q */
+            limb *x3, limb *z3, /* output Q + Q' */
+            limb *x, limb *z,   /* input Q */
+            limb *xprime, limb *zprime, /* input Q' */
+            const limb *qmqp /* input Q - Q' */) {
+  limb origx[5], origxprime[5], zzz[5], xx[5], zz[5], xxprime[5],
+        zzprime[5], zzzprime[5];
+
+  memcpy(origx, x, 5 * sizeof(limb));
+  fsum(x, z);
+  fdifference_backwards(z, origx);  /* does x - z */
+
+  memcpy(origxprime, xprime, sizeof(limb) * 5);
+  fsum(xprime, zprime);
+  fdifference_backwards(zprime, origxprime);
+  fmul(xxprime, xprime, z);
+  fmul(zzprime, x, zprime);
+  memcpy(origxprime, xxprime, sizeof(limb) * 5);
+  fsum(xxprime, zzprime);
+  fdifference_backwards(zzprime, origxprime);
+  fsquare_times(x3, xxprime, 1);
+  fsquare_times(zzzprime, zzprime, 1);
+  fmul(z3, zzzprime, qmqp);
+
+  fsquare_times(xx, x, 1);
+  fsquare_times(zz, z, 1);
+  fmul(x2, xx, zz);
+  fdifference_backwards(zz, xx);  /* does zz = xx - zz */
+  fscalar_product(zzz, zz, 121665);
+  fsum(zzz, xx);
+  fmul(z2, zz, zzz);
+}
+
+/* Maybe swap the contents of two limb arrays (@a and @b), each 5 elements
+ * long. Perform the swap iff @iswap is non-zero.
+ *
+ * This function performs the swap without leaking any side-channel
+ * information.
+ */
+void swap_conditional(limb a[5], limb b[5], limb iswap) {
+  unsigned i;
+  const limb swap = 0 - iswap;
+
+  for (i = 0; i < 5; ++i) {
+    const limb x = swap & (a[i] ^ b[i]);
+    a[i] ^= x;
+    b[i] ^= x;
+  }
+}
+
+/* Calculates nQ where Q is the x-coordinate of a point on the curve
+ *
+ *   resultx/resultz: the x coordinate of the resulting curve point (short form)
+ *   n: a little endian, 32-byte number
+ *   q: a point of the curve (short form)
+ */
+void cmult(limb *resultx, limb *resultz, const u8 *n, const limb *q) {
+  limb a[5] = {0}, b[5] = {1}, c[5] = {1}, d[5] = {0};
+  limb *nqpqx = a, *nqpqz = b, *nqx = c, *nqz = d, *t;
+  limb e[5] = {0}, f[5] = {1}, g[5] = {0}, h[5] = {1};
+  limb *nqpqx2 = e, *nqpqz2 = f, *nqx2 = g, *nqz2 = h;
+
+  unsigned i, j;
+
+  memcpy(nqpqx, q, sizeof(limb) * 5);
+
+  for (i = 0; i < 32; ++i) {
+    u8 byte = n[31 - i];
+    for (j = 0; j < 8; ++j) {
+      const limb bit = byte >> 7;
+
+      swap_conditional(nqx, nqpqx, bit);
+      swap_conditional(nqz, nqpqz, bit);
+      fmonty(nqx2, nqz2,
+             nqpqx2, nqpqz2,
+             nqx, nqz,
+             nqpqx, nqpqz,
+             q);
+      swap_conditional(nqx2, nqpqx2, bit);
+      swap_conditional(nqz2, nqpqz2, bit);
+
+      t = nqx;
+      nqx = nqx2;
+      nqx2 = t;
+      t = nqz;
+      nqz = nqz2;
+      nqz2 = t;
+      t = nqpqx;
+      nqpqx = nqpqx2;
+      nqpqx2 = t;
+      t = nqpqz;
+      nqpqz = nqpqz2;
+      nqpqz2 = t;
+
+      byte <<= 1;
+    }
+  }
+
+  memcpy(resultx, nqx, sizeof(limb) * 5);
+  memcpy(resultz, nqz, sizeof(limb) * 5);
+}
+
+/* -----------------------------------------------------------------------------
+** Shamelessly copied from djb's code, tightened a little
+** ---------------------------------------------------------------------------*/
+void crecip(felem out, const felem z) {
+  felem a, t0, b, c;
+
+  /* 2 */ fsquare_times(a, z, 1); /* a = 2 */
+  /* 8 */ fsquare_times(t0, a, 2);
+  /* 9 */ fmul(b, t0, z); /* b = 9 */
+  /* 11 */ fmul(a, b, a); /* a = 11 */
+  /* 22 */ fsquare_times(t0, a, 1);
+  /* 2^5 - 2^0 = 31 */ fmul(b, t0, b);
+  /* 2^10 - 2^5 */ fsquare_times(t0, b, 5);
+  /* 2^10 - 2^0 */ fmul(b, t0, b);
+  /* 2^20 - 2^10 */ fsquare_times(t0, b, 10);
+  /* 2^20 - 2^0 */ fmul(c, t0, b);
+  /* 2^40 - 2^20 */ fsquare_times(t0, c, 20);
+  /* 2^40 - 2^0 */ fmul(t0, t0, c);
+  /* 2^50 - 2^10 */ fsquare_times(t0, t0, 10);
+  /* 2^50 - 2^0 */ fmul(b, t0, b);
+  /* 2^100 - 2^50 */ fsquare_times(t0, b, 50);
+  /* 2^100 - 2^0 */ fmul(c, t0, b);
+  /* 2^200 - 2^100 */ fsquare_times(t0, c, 100);
+  /* 2^200 - 2^0 */ fmul(t0, t0, c);
+  /* 2^250 - 2^50 */ fsquare_times(t0, t0, 50);
+  /* 2^250 - 2^0 */ fmul(t0, t0, b);
+  /* 2^255 - 2^5 */ fsquare_times(t0, t0, 5);
+  /* 2^255 - 21 */ fmul(out, t0, a);
+}
+
+/* A point of small order gives z = 0, which would make the product of all
+ * the z coordinates zero, so z is replaced by 1 and x by 0, which leaves the
+ * result at 0, as it would be with the inverse of 0. */
+static void fzero_fixup(limb *x, limb *z) {
+  limb one[5] = {1}, zero[5] = {0}, iszero;
+  unsigned i, acc = 0;
+  u8 bytes[32];
+
+  fcontract(bytes, z);
+  for (i = 0; i < 32; ++i) acc |= bytes[i];
+  iszero = ((acc - 1) >> 8) & 1;
+
+  swap_conditional(z, one, iszero);
+  swap_conditional(x, zero, iszero);
+
+  memset(bytes, 0, sizeof(bytes));
+}
+
+/* Computes "count" scalar multiplications, at most CURVE25519_BATCH, with
+ * a single inversion by Montgomery's trick: the product of all the z is
+ * inverted, and each inverse is then recovered with two multiplications,
+ * working back from the last one, acc[i] being the product of the z before
+ * the i-th. */
+void curve25519_many(u8 *out, const u8 *secret, const u8 *point,
+                     size_t count) {
+  limb x[CURVE25519_BATCH][5], z[CURVE25519_BATCH][5];
+  limb acc[CURVE25519_BATCH][5];
+  limb bp[5], prod[5], inv[5], t[5];
+  size_t i;
+
+  if (!count) return;
+
+  for (i = 0; i < count; ++i) {
+    fexpand(bp, point + 32 * i);
+    cmult(x[i], z[i], secret + 32 * i, bp);
+    fzero_fixup(x[i], z[i]);
+
+    if (i) {
+      memcpy(acc[i], prod, sizeof(prod));
+      fmul(prod, prod, z[i]);
+    } else
+      memcpy(prod, z[0], sizeof(prod));
+  }
+
+  crecip(inv, prod);
+
+  for (i = count - 1; i > 0; --i) {
+    fmul(t, inv, acc[i]);
+    fmul(inv, inv, z[i]);
+    fmul(t, t, x[i]);
+    fcontract(out + 32 * i, t);
+  }
+
+  fmul(t, inv, x[0]);
+  fcontract(out, t);
+
+  memset(x, 0, sizeof(x));
+  memset(z, 0, sizeof(z));
+  memset(acc, 0, sizeof(acc));
+  memset(prod, 0, sizeof(prod));
+  memset(inv, 0, sizeof(inv));
+  memset(t, 0, sizeof(t));
+}
+
+#else
+
+typedef int64_t felem;
+
+static void fsum(felem *output, const felem *in)
+HOT_CODE;
+static void fdifference(felem *output, const felem *in)
+HOT_CODE;
+static void fscalar_product(felem *output, const felem *in,
+                            const felem scalar)
+HOT_CODE;
+static void fproduct(felem *output, const felem *in2, const felem *in)
+HOT_CODE;
+static void freduce_degree(felem *output)
+HOT_CODE;
+static void freduce_coefficients(felem *output)
+HOT_CODE;
+static void fmul(felem *output, const felem *in, const felem *in2)
+HOT_CODE;
+static void fsquare_inner(felem *output, const felem *in)
+HOT_CODE;
+static void fsquare(felem *output, const felem *in)
+HOT_CODE;
+static void fexpand(felem *output, const u8 *input)
+HOT_CODE;
+static void fcontract(u8 *output, felem *input)
+HOT_CODE;
+static void fmonty(felem *x2, felem *z2,
+                   felem *x3, felem *z3,
+                   felem *x, felem *z,
+                   felem *xprime, felem *zprime,
+                   const felem *qmqp)
+HOT_CODE;
+static void cmult(felem *resultx, felem *resultz,
+                  const u8 *n, const felem *q)
+HOT_CODE;
+static void crecip(felem *out, const felem *z)
+HOT_CODE;
+
 /* Sum two numbers: output += in */
 void fsum(felem *output, const felem *in) {
   unsigned i;
@@ -629,11 +1133,67 @@ void crecip(felem *out, const felem *z) {
   /* 2^255 - 21 */ fmul(out,t1,z11);
 }
 
-void curve25519_donna(u8 *mypublic, const u8 *secret, const u8 *basepoint) {
-  felem bp[10], x[10], z[10], zmone[10];
-  fexpand(bp, basepoint);
-  cmult(x, z, secret, bp);
-  crecip(zmone, z);
-  fmul(z, x, zmone);
-  fcontract(mypublic, z);
+/* See the 64-bit variant above. */
+static void fzero_fixup(felem *x, felem *z) {
+  felem t[10], mask;
+  unsigned i, acc = 0;
+  u8 bytes[32];
+
+  memcpy(t, z, sizeof(t));
+  fcontract(bytes, t);
+  for (i = 0; i < 32; ++i) acc |= bytes[i];
+
+  mask = -(felem)(((acc - 1) >> 8) & 1);
+
+  for (i = 0; i < 10; ++i) {
+    z[i] ^= mask & (z[i] ^ (i == 0));
+    x[i] &= ~mask;
+  }
+
+  memset(t, 0, sizeof(t));
+  memset(bytes, 0, sizeof(bytes));
+}
+
+/* See the 64-bit variant above. */
+void curve25519_many(u8 *out, const u8 *secret, const u8 *point,
+                     size_t count) {
+  felem x[CURVE25519_BATCH][10], z[CURVE25519_BATCH][10];
+  felem acc[CURVE25519_BATCH][10];
+  felem bp[10], prod[10], inv[10], t[10];
+  size_t i;
+
+  if (!count) return;
+
+  for (i = 0; i < count; ++i) {
+    fexpand(bp, point + 32 * i);
+    cmult(x[i], z[i], secret + 32 * i, bp);
+    fzero_fixup(x[i], z[i]);
+
+    if (i) {
+      memcpy(acc[i], prod, sizeof(prod));
+      fmul(prod, prod, z[i]);
+    } else
+      memcpy(prod, z[0], sizeof(prod));
+  }
+
+  crecip(inv, prod);
+
+  for (i = count - 1; i > 0; --i) {
+    fmul(t, inv, acc[i]);
+    fmul(inv, inv, z[i]);
+    fmul(t, t, x[i]);
+    fcontract(out + 32 * i, t);
+  }
+
+  fmul(t, inv, x[0]);
+  fcontract(out, t);
+
+  memset(x, 0, sizeof(x));
+  memset(z, 0, sizeof(z));
+  memset(acc, 0, sizeof(acc));
+  memset(prod, 0, sizeof(prod));
+  memset(inv, 0, sizeof(inv));
+  memset(t, 0, sizeof(t));
 }
+
+#endif
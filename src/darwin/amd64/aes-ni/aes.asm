@@ -8,6 +8,7 @@ BITS 64
 
 global _aes_forward_ASM
 global _aes_inverse_ASM
+global _aes_forward_many_ASM
 
 section .text
 
@@ -64,3 +65,166 @@ _aes_inverse_ASM:
     AESDECLAST XMM0, XMM1
     MOVDQU [RDI], XMM0
     ret
+
+; Encrypts "count" consecutive blocks in place, eight at a time so that
+; the AESENC instructions of independent blocks overlap in the pipeline,
+; then four at a time, then one at a time.
+
+_aes_forward_many_ASM:
+    cmp RCX, 8
+    jb .half_test
+
+    .wide:
+        MOV R8, RSI
+        MOV R9, RDX
+
+        MOVDQU XMM8, [R8]
+        ADD R8, 0x10
+
+        MOVDQU XMM0, [RDI + 0x00]
+        MOVDQU XMM1, [RDI + 0x10]
+        MOVDQU XMM2, [RDI + 0x20]
+        MOVDQU XMM3, [RDI + 0x30]
+        MOVDQU XMM4, [RDI + 0x40]
+        MOVDQU XMM5, [RDI + 0x50]
+        MOVDQU XMM6, [RDI + 0x60]
+        MOVDQU XMM7, [RDI + 0x70]
+        PXOR XMM0, XMM8
+        PXOR XMM1, XMM8
+        PXOR XMM2, XMM8
+        PXOR XMM3, XMM8
+        PXOR XMM4, XMM8
+        PXOR XMM5, XMM8
+        PXOR XMM6, XMM8
+        PXOR XMM7, XMM8
+
+        .wide_loop:
+            dec R9
+            jz .wide_last
+
+            MOVDQU XMM8, [R8]
+            ADD R8, 0x10
+
+            AESENC XMM0, XMM8
+            AESENC XMM1, XMM8
+            AESENC XMM2, XMM8
+            AESENC XMM3, XMM8
+            AESENC XMM4, XMM8
+            AESENC XMM5, XMM8
+            AESENC XMM6, XMM8
+            AESENC XMM7, XMM8
+
+            jmp .wide_loop
+
+        .wide_last:
+        MOVDQU XMM8, [R8]
+
+        AESENCLAST XMM0, XMM8
+        AESENCLAST XMM1, XMM8
+        AESENCLAST XMM2, XMM8
+        AESENCLAST XMM3, XMM8
+        AESENCLAST XMM4, XMM8
+        AESENCLAST XMM5, XMM8
+        AESENCLAST XMM6, XMM8
+        AESENCLAST XMM7, XMM8
+        MOVDQU [RDI + 0x00], XMM0
+        MOVDQU [RDI + 0x10], XMM1
+        MOVDQU [RDI + 0x20], XMM2
+        MOVDQU [RDI + 0x30], XMM3
+        MOVDQU [RDI + 0x40], XMM4
+        MOVDQU [RDI + 0x50], XMM5
+        MOVDQU [RDI + 0x60], XMM6
+        MOVDQU [RDI + 0x70], XMM7
+
+        ADD RDI, 0x80
+        SUB RCX, 8
+        cmp RCX, 8
+        jae .wide
+
+    .half_test:
+    cmp RCX, 4
+    jb .single
+
+    .half:
+        MOV R8, RSI
+        MOV R9, RDX
+
+        MOVDQU XMM8, [R8]
+        ADD R8, 0x10
+
+        MOVDQU XMM0, [RDI + 0x00]
+        MOVDQU XMM1, [RDI + 0x10]
+        MOVDQU XMM2, [RDI + 0x20]
+        MOVDQU XMM3, [RDI + 0x30]
+        PXOR XMM0, XMM8
+        PXOR XMM1, XMM8
+        PXOR XMM2, XMM8
+        PXOR XMM3, XMM8
+
+        .half_loop:
+            dec R9
+            jz .half_last
+
+            MOVDQU XMM8, [R8]
+            ADD R8, 0x10
+
+            AESENC XMM0, XMM8
+            AESENC XMM1, XMM8
+            AESENC XMM2, XMM8
+            AESENC XMM3, XMM8
+
+            jmp .half_loop
+
+        .half_last:
+        MOVDQU XMM8, [R8]
+
+        AESENCLAST XMM0, XMM8
+        AESENCLAST XMM1, XMM8
+        AESENCLAST XMM2, XMM8
+        AESENCLAST XMM3, XMM8
+        MOVDQU [RDI + 0x00], XMM0
+        MOVDQU [RDI + 0x10], XMM1
+        MOVDQU [RDI + 0x20], XMM2
+        MOVDQU [RDI + 0x30], XMM3
+
+        ADD RDI, 0x40
+        SUB RCX, 4
+
+    .single:
+    test RCX, RCX
+    jz .done
+
+    .one:
+        MOV R8, RSI
+        MOV R9, RDX
+
+        MOVDQU XMM0, [RDI]
+
+        MOVDQU XMM8, [R8]
+        ADD R8, 0x10
+
+        PXOR XMM0, XMM8
+
+        .loopo:
+            dec R9
+            jz .lasto
+
+            MOVDQU XMM8, [R8]
+            ADD R8, 0x10
+
+            AESENC XMM0, XMM8
+
+            jmp .loopo
+
+        .lasto:
+        MOVDQU XMM8, [R8]
+
+        AESENCLAST XMM0, XMM8
+        MOVDQU [RDI], XMM0
+
+        ADD RDI, 0x10
+        dec RCX
+        jnz .one
+
+    .done:
+    ret
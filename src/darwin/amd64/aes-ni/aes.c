@@ -13,6 +13,14 @@ static void ExpandKey(const uint8_t *key, uint8_t *ext,
 
 extern void aes_forward_ASM(void *block, const void *key, uint64_t rounds);
 extern void aes_inverse_ASM(void *block, const void *key, uint64_t rounds);
+extern void aes_forward_many_ASM(void *blocks, const void *key,
+                                 uint64_t rounds, uint64_t count);
+
+/* Encrypts the "count" consecutive blocks at "blocks" in place. This is much
+ * faster than encrypting them one at a time where the blocks can be done in
+ * parallel, as for the keystream of CTR_DRBG. */
+ORDO_HIDDEN void aes_forward_many(const struct AES_STATE *state,
+                                  void *blocks, size_t count);
 
 #ifdef OPAQUE
 struct AES_STATE
@@ -60,6 +68,12 @@ void aes_inverse(const struct AES_STATE *state, void *block)
     aes_inverse_ASM((uint8_t *)block, state->key, state->rounds);
 }
 
+void aes_forward_many(const struct AES_STATE *state,
+                      void *blocks, size_t count)
+{
+    aes_forward_many_ASM(blocks, state->key, state->rounds, count);
+}
+
 void aes_final(struct AES_STATE *state)
 {
     return;
@@ -0,0 +1,31 @@
+/*===-- argon2_compress.c -------------------*- darwin/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic argon2_compress.c. */
+ORDO_HIDDEN void argon2_compress(uint64_t * RESTRICT out,
+                                 const uint64_t * RESTRICT x,
+                                 const uint64_t * RESTRICT y,
+                                 int xor)
+HOT_CODE;
+
+/* Runs the whole compression with AVX2, on four words of the BLAKE2b state,
+ * that is, a whole row, per YMM register. */
+extern void argon2_compress_ASM(uint64_t * RESTRICT out,
+                                const uint64_t * RESTRICT x,
+                                const uint64_t * RESTRICT y,
+                                int xor);
+
+/*===----------------------------------------------------------------------===*/
+
+void argon2_compress(uint64_t * RESTRICT out,
+                     const uint64_t * RESTRICT x,
+                     const uint64_t * RESTRICT y,
+                     int xor)
+{
+    argon2_compress_ASM(out, x, y, xor);
+}
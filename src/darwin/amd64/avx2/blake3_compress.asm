@@ -0,0 +1,1258 @@
+;/===-- blake3_compress.asm ---------------*- darwin/amd64/avx2 -*- ASM -*-===*/
+
+; BLAKE3 8-way chunk compression for AMD64 with AVX2
+;
+; Hashes eight inputs of the same number of blocks at once, with one input
+; per lane: each of the sixteen words of the working state has its own YMM
+; register, so the G functions need no shuffling at all. Each block of the
+; eight inputs is first transposed into lanes on the stack, and a working
+; register is spilled whenever a rotation needs a scratch register. The
+; chaining values are kept transposed in memory, the caller transposes
+; them back, and the other parameters are passed in a parameter block.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global _blake3_hash8_ASM
+
+section .text
+
+_blake3_hash8_ASM:
+    sub RSP, 0x260
+
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x200], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x208], RAX
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x210], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x218], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x220], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x228], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x230], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x238], RAX
+
+    lea R8, [RDX + RDX*2]
+    lea R9, [RSI + RDX*4]
+    mov R10d, [RCX + 0x40]
+    mov R11d, [RCX + 0x44]
+    or R11d, [RCX + 0x48]
+
+.block:
+    cmp R10, 1
+    jne .middle
+    or R11d, [RCX + 0x4C]
+
+.middle:
+    vmovdqu ymm0, [RSI + 0x00]
+    vmovdqu ymm1, [RSI + RDX + 0x00]
+    vmovdqu ymm2, [RSI + RDX*2 + 0x00]
+    vmovdqu ymm3, [RSI + R8 + 0x00]
+    vmovdqu ymm4, [R9 + 0x00]
+    vmovdqu ymm5, [R9 + RDX + 0x00]
+    vmovdqu ymm6, [R9 + RDX*2 + 0x00]
+    vmovdqu ymm7, [R9 + R8 + 0x00]
+    vpunpckldq ymm8, ymm0, ymm1
+    vpunpckhdq ymm9, ymm0, ymm1
+    vpunpckldq ymm10, ymm2, ymm3
+    vpunpckhdq ymm11, ymm2, ymm3
+    vpunpckldq ymm12, ymm4, ymm5
+    vpunpckhdq ymm13, ymm4, ymm5
+    vpunpckldq ymm14, ymm6, ymm7
+    vpunpckhdq ymm15, ymm6, ymm7
+    vpunpcklqdq ymm0, ymm8, ymm10
+    vpunpckhqdq ymm1, ymm8, ymm10
+    vpunpcklqdq ymm2, ymm9, ymm11
+    vpunpckhqdq ymm3, ymm9, ymm11
+    vpunpcklqdq ymm4, ymm12, ymm14
+    vpunpckhqdq ymm5, ymm12, ymm14
+    vpunpcklqdq ymm6, ymm13, ymm15
+    vpunpckhqdq ymm7, ymm13, ymm15
+    vperm2i128 ymm8, ymm0, ymm4, 0x20
+    vperm2i128 ymm12, ymm0, ymm4, 0x31
+    vperm2i128 ymm9, ymm1, ymm5, 0x20
+    vperm2i128 ymm13, ymm1, ymm5, 0x31
+    vperm2i128 ymm10, ymm2, ymm6, 0x20
+    vperm2i128 ymm14, ymm2, ymm6, 0x31
+    vperm2i128 ymm11, ymm3, ymm7, 0x20
+    vperm2i128 ymm15, ymm3, ymm7, 0x31
+    vmovdqu [RSP + 0x000], ymm8
+    vmovdqu [RSP + 0x020], ymm9
+    vmovdqu [RSP + 0x040], ymm10
+    vmovdqu [RSP + 0x060], ymm11
+    vmovdqu [RSP + 0x080], ymm12
+    vmovdqu [RSP + 0x0A0], ymm13
+    vmovdqu [RSP + 0x0C0], ymm14
+    vmovdqu [RSP + 0x0E0], ymm15
+
+    vmovdqu ymm0, [RSI + 0x20]
+    vmovdqu ymm1, [RSI + RDX + 0x20]
+    vmovdqu ymm2, [RSI + RDX*2 + 0x20]
+    vmovdqu ymm3, [RSI + R8 + 0x20]
+    vmovdqu ymm4, [R9 + 0x20]
+    vmovdqu ymm5, [R9 + RDX + 0x20]
+    vmovdqu ymm6, [R9 + RDX*2 + 0x20]
+    vmovdqu ymm7, [R9 + R8 + 0x20]
+    vpunpckldq ymm8, ymm0, ymm1
+    vpunpckhdq ymm9, ymm0, ymm1
+    vpunpckldq ymm10, ymm2, ymm3
+    vpunpckhdq ymm11, ymm2, ymm3
+    vpunpckldq ymm12, ymm4, ymm5
+    vpunpckhdq ymm13, ymm4, ymm5
+    vpunpckldq ymm14, ymm6, ymm7
+    vpunpckhdq ymm15, ymm6, ymm7
+    vpunpcklqdq ymm0, ymm8, ymm10
+    vpunpckhqdq ymm1, ymm8, ymm10
+    vpunpcklqdq ymm2, ymm9, ymm11
+    vpunpckhqdq ymm3, ymm9, ymm11
+    vpunpcklqdq ymm4, ymm12, ymm14
+    vpunpckhqdq ymm5, ymm12, ymm14
+    vpunpcklqdq ymm6, ymm13, ymm15
+    vpunpckhqdq ymm7, ymm13, ymm15
+    vperm2i128 ymm8, ymm0, ymm4, 0x20
+    vperm2i128 ymm12, ymm0, ymm4, 0x31
+    vperm2i128 ymm9, ymm1, ymm5, 0x20
+    vperm2i128 ymm13, ymm1, ymm5, 0x31
+    vperm2i128 ymm10, ymm2, ymm6, 0x20
+    vperm2i128 ymm14, ymm2, ymm6, 0x31
+    vperm2i128 ymm11, ymm3, ymm7, 0x20
+    vperm2i128 ymm15, ymm3, ymm7, 0x31
+    vmovdqu [RSP + 0x100], ymm8
+    vmovdqu [RSP + 0x120], ymm9
+    vmovdqu [RSP + 0x140], ymm10
+    vmovdqu [RSP + 0x160], ymm11
+    vmovdqu [RSP + 0x180], ymm12
+    vmovdqu [RSP + 0x1A0], ymm13
+    vmovdqu [RSP + 0x1C0], ymm14
+    vmovdqu [RSP + 0x1E0], ymm15
+
+    ; the working state, one word of every input per register
+    vmovdqu ymm0, [RDI + 0x00]
+    vmovdqu ymm1, [RDI + 0x20]
+    vmovdqu ymm2, [RDI + 0x40]
+    vmovdqu ymm3, [RDI + 0x60]
+    vmovdqu ymm4, [RDI + 0x80]
+    vmovdqu ymm5, [RDI + 0xA0]
+    vmovdqu ymm6, [RDI + 0xC0]
+    vmovdqu ymm7, [RDI + 0xE0]
+    vpbroadcastd ymm8, [RCX + 0x60]
+    vpbroadcastd ymm9, [RCX + 0x64]
+    vpbroadcastd ymm10, [RCX + 0x68]
+    vpbroadcastd ymm11, [RCX + 0x6C]
+    vmovdqu ymm12, [RCX + 0x00]
+    vmovdqu ymm13, [RCX + 0x20]
+    vpbroadcastd ymm14, [RCX + 0x50]
+    vmovd xmm15, R11d
+    vpbroadcastd ymm15, xmm15
+
+    ; round 0
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x000]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x040]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x080]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x020]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x060]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x0A0]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x100]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x140]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x180]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x120]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x160]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x1A0]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 1
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x040]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x060]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x0E0]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x080]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x0C0]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x140]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x000]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x020]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x180]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x120]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x160]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x0A0]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x1C0]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 2
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x060]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x140]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x1A0]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x080]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x180]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x040]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x0C0]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x120]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x160]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x0A0]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x000]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x1E0]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x020]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 3
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x140]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x180]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x1C0]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x0E0]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x120]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x060]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x080]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x160]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x0A0]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x020]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x000]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x040]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x100]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 4
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x180]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x120]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x1E0]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x1A0]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x160]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x140]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x0E0]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x0A0]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x000]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x040]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x060]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x020]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x080]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 5
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x120]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x160]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x100]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x1C0]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x0A0]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x180]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x020]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x1A0]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x000]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x040]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x080]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x060]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x140]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x0C0]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 6
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x160]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x0A0]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x020]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm4
+    vpaddd ymm0, ymm0, [RSP + 0x1E0]
+    vpaddd ymm1, ymm1, ymm5
+    vpaddd ymm1, ymm1, [RSP + 0x000]
+    vpaddd ymm2, ymm2, ymm6
+    vpaddd ymm2, ymm2, [RSP + 0x120]
+    vpaddd ymm3, ymm3, ymm7
+    vpaddd ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddd ymm8, ymm8, ymm12
+    vpaddd ymm9, ymm9, ymm13
+    vpaddd ymm10, ymm10, ymm14
+    vpaddd ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x1C0]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x040]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x060]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x200]
+    vpshufb ymm12, ymm12, [RSP + 0x200]
+    vpshufb ymm13, ymm13, [RSP + 0x200]
+    vpshufb ymm14, ymm14, [RSP + 0x200]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 12
+    vpslld ymm5, ymm5, 20
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 12
+    vpslld ymm6, ymm6, 20
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 12
+    vpslld ymm7, ymm7, 20
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 12
+    vpslld ymm4, ymm4, 20
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddd ymm0, ymm0, ymm5
+    vpaddd ymm0, ymm0, [RSP + 0x140]
+    vpaddd ymm1, ymm1, ymm6
+    vpaddd ymm1, ymm1, [RSP + 0x180]
+    vpaddd ymm2, ymm2, ymm7
+    vpaddd ymm2, ymm2, [RSP + 0x080]
+    vpaddd ymm3, ymm3, ymm4
+    vpaddd ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddd ymm10, ymm10, ymm15
+    vpaddd ymm11, ymm11, ymm12
+    vpaddd ymm8, ymm8, ymm13
+    vpaddd ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrld ymm8, ymm5, 7
+    vpslld ymm5, ymm5, 25
+    vpor ymm5, ymm5, ymm8
+    vpsrld ymm8, ymm6, 7
+    vpslld ymm6, ymm6, 25
+    vpor ymm6, ymm6, ymm8
+    vpsrld ymm8, ymm7, 7
+    vpslld ymm7, ymm7, 25
+    vpor ymm7, ymm7, ymm8
+    vpsrld ymm8, ymm4, 7
+    vpslld ymm4, ymm4, 25
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    vpxor ymm0, ymm0, ymm8
+    vmovdqu [RDI + 0x00], ymm0
+    vpxor ymm1, ymm1, ymm9
+    vmovdqu [RDI + 0x20], ymm1
+    vpxor ymm2, ymm2, ymm10
+    vmovdqu [RDI + 0x40], ymm2
+    vpxor ymm3, ymm3, ymm11
+    vmovdqu [RDI + 0x60], ymm3
+    vpxor ymm4, ymm4, ymm12
+    vmovdqu [RDI + 0x80], ymm4
+    vpxor ymm5, ymm5, ymm13
+    vmovdqu [RDI + 0xA0], ymm5
+    vpxor ymm6, ymm6, ymm14
+    vmovdqu [RDI + 0xC0], ymm6
+    vpxor ymm7, ymm7, ymm15
+    vmovdqu [RDI + 0xE0], ymm7
+
+    add RSI, 0x40
+    add R9, 0x40
+    mov R11d, [RCX + 0x44]
+    dec R10
+    jnz .block
+
+    add RSP, 0x260
+
+    vzeroupper
+    ret
@@ -0,0 +1,498 @@
+;/===-- keccak.asm ------------------------*- darwin/amd64/avx2 -*- ASM -*-===*/
+
+; Keccak-f[1600] 4-way permutation for AMD64 with AVX2
+;
+; Permutes four independent states at once, with one state per lane, so
+; each YMM register holds the same lane of all four states. The states are
+; interleaved in memory by the caller, and each round reads them from one
+; buffer and writes them to another, alternating between the caller's
+; buffer and one on the stack, as the 25 lanes do not fit in registers.
+; The five theta column parities are turned into the D values, which stay
+; in registers for the round, and the rho, pi and chi steps are then done
+; one plane at a time. Rotations by 8 and 56 bits are done with a shuffle.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global _keccak_f1600_x4_ASM
+
+section .text
+
+_keccak_f1600_x4_ASM:
+    sub RSP, 0x360
+
+    mov RAX, 0x0605040302010007
+    mov [RSP + 0x320], RAX
+    mov RAX, 0x0E0D0C0B0A09080F
+    mov [RSP + 0x328], RAX
+    mov RAX, 0x0605040302010007
+    mov [RSP + 0x330], RAX
+    mov RAX, 0x0E0D0C0B0A09080F
+    mov [RSP + 0x338], RAX
+    mov RAX, 0x0007060504030201
+    mov [RSP + 0x340], RAX
+    mov RAX, 0x080F0E0D0C0B0A09
+    mov [RSP + 0x348], RAX
+    mov RAX, 0x0007060504030201
+    mov [RSP + 0x350], RAX
+    mov RAX, 0x080F0E0D0C0B0A09
+    mov [RSP + 0x358], RAX
+
+    vmovdqu ymm14, [RSP + 0x320]
+    vmovdqu ymm15, [RSP + 0x340]
+    mov EAX, 12
+
+.round:
+    ; theta: the column parities, then D
+    vmovdqu ymm0, [RDI + 0x000]
+    vpxor ymm0, ymm0, [RDI + 0x0A0]
+    vpxor ymm0, ymm0, [RDI + 0x140]
+    vpxor ymm0, ymm0, [RDI + 0x1E0]
+    vpxor ymm0, ymm0, [RDI + 0x280]
+    vmovdqu ymm1, [RDI + 0x020]
+    vpxor ymm1, ymm1, [RDI + 0x0C0]
+    vpxor ymm1, ymm1, [RDI + 0x160]
+    vpxor ymm1, ymm1, [RDI + 0x200]
+    vpxor ymm1, ymm1, [RDI + 0x2A0]
+    vmovdqu ymm2, [RDI + 0x040]
+    vpxor ymm2, ymm2, [RDI + 0x0E0]
+    vpxor ymm2, ymm2, [RDI + 0x180]
+    vpxor ymm2, ymm2, [RDI + 0x220]
+    vpxor ymm2, ymm2, [RDI + 0x2C0]
+    vmovdqu ymm3, [RDI + 0x060]
+    vpxor ymm3, ymm3, [RDI + 0x100]
+    vpxor ymm3, ymm3, [RDI + 0x1A0]
+    vpxor ymm3, ymm3, [RDI + 0x240]
+    vpxor ymm3, ymm3, [RDI + 0x2E0]
+    vmovdqu ymm4, [RDI + 0x080]
+    vpxor ymm4, ymm4, [RDI + 0x120]
+    vpxor ymm4, ymm4, [RDI + 0x1C0]
+    vpxor ymm4, ymm4, [RDI + 0x260]
+    vpxor ymm4, ymm4, [RDI + 0x300]
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm5, ymm1, ymm1
+    vpor ymm5, ymm5, ymm10
+    vpxor ymm5, ymm5, ymm4
+    vpsrlq ymm10, ymm2, 63
+    vpaddq ymm6, ymm2, ymm2
+    vpor ymm6, ymm6, ymm10
+    vpxor ymm6, ymm6, ymm0
+    vpsrlq ymm10, ymm3, 63
+    vpaddq ymm7, ymm3, ymm3
+    vpor ymm7, ymm7, ymm10
+    vpxor ymm7, ymm7, ymm1
+    vpsrlq ymm10, ymm4, 63
+    vpaddq ymm8, ymm4, ymm4
+    vpor ymm8, ymm8, ymm10
+    vpxor ymm8, ymm8, ymm2
+    vpsrlq ymm10, ymm0, 63
+    vpaddq ymm9, ymm0, ymm0
+    vpor ymm9, ymm9, ymm10
+    vpxor ymm9, ymm9, ymm3
+    ; rho, pi and chi for plane 0
+    vpxor ymm0, ymm5, [RDI + 0x000]
+    vpxor ymm1, ymm6, [RDI + 0x0C0]
+    vpsrlq ymm10, ymm1, 20
+    vpsllq ymm1, ymm1, 44
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm7, [RDI + 0x180]
+    vpsrlq ymm10, ymm2, 21
+    vpsllq ymm2, ymm2, 43
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm8, [RDI + 0x240]
+    vpsrlq ymm10, ymm3, 43
+    vpsllq ymm3, ymm3, 21
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm9, [RDI + 0x300]
+    vpsrlq ymm10, ymm4, 50
+    vpsllq ymm4, ymm4, 14
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vpbroadcastq ymm11, [RSI + 0x00]
+    vpxor ymm10, ymm10, ymm11
+    vmovdqu [RSP + 0x000], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RSP + 0x020], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RSP + 0x040], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RSP + 0x060], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RSP + 0x080], ymm10
+    ; rho, pi and chi for plane 1
+    vpxor ymm0, ymm8, [RDI + 0x060]
+    vpsrlq ymm10, ymm0, 36
+    vpsllq ymm0, ymm0, 28
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm9, [RDI + 0x120]
+    vpsrlq ymm10, ymm1, 44
+    vpsllq ymm1, ymm1, 20
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm5, [RDI + 0x140]
+    vpsrlq ymm10, ymm2, 61
+    vpsllq ymm2, ymm2, 3
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm6, [RDI + 0x200]
+    vpsrlq ymm10, ymm3, 19
+    vpsllq ymm3, ymm3, 45
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm7, [RDI + 0x2C0]
+    vpsrlq ymm10, ymm4, 3
+    vpsllq ymm4, ymm4, 61
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RSP + 0x0A0], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RSP + 0x0C0], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RSP + 0x0E0], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RSP + 0x100], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RSP + 0x120], ymm10
+    ; rho, pi and chi for plane 2
+    vpxor ymm0, ymm6, [RDI + 0x020]
+    vpsrlq ymm10, ymm0, 63
+    vpaddq ymm0, ymm0, ymm0
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm7, [RDI + 0x0E0]
+    vpsrlq ymm10, ymm1, 58
+    vpsllq ymm1, ymm1, 6
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm8, [RDI + 0x1A0]
+    vpsrlq ymm10, ymm2, 39
+    vpsllq ymm2, ymm2, 25
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm9, [RDI + 0x260]
+    vpshufb ymm3, ymm3, ymm14
+    vpxor ymm4, ymm5, [RDI + 0x280]
+    vpsrlq ymm10, ymm4, 46
+    vpsllq ymm4, ymm4, 18
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RSP + 0x140], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RSP + 0x160], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RSP + 0x180], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RSP + 0x1A0], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RSP + 0x1C0], ymm10
+    ; rho, pi and chi for plane 3
+    vpxor ymm0, ymm9, [RDI + 0x080]
+    vpsrlq ymm10, ymm0, 37
+    vpsllq ymm0, ymm0, 27
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm5, [RDI + 0x0A0]
+    vpsrlq ymm10, ymm1, 28
+    vpsllq ymm1, ymm1, 36
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm6, [RDI + 0x160]
+    vpsrlq ymm10, ymm2, 54
+    vpsllq ymm2, ymm2, 10
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm7, [RDI + 0x220]
+    vpsrlq ymm10, ymm3, 49
+    vpsllq ymm3, ymm3, 15
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm8, [RDI + 0x2E0]
+    vpshufb ymm4, ymm4, ymm15
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RSP + 0x1E0], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RSP + 0x200], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RSP + 0x220], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RSP + 0x240], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RSP + 0x260], ymm10
+    ; rho, pi and chi for plane 4
+    vpxor ymm0, ymm7, [RDI + 0x040]
+    vpsrlq ymm10, ymm0, 2
+    vpsllq ymm0, ymm0, 62
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm8, [RDI + 0x100]
+    vpsrlq ymm10, ymm1, 9
+    vpsllq ymm1, ymm1, 55
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm9, [RDI + 0x1C0]
+    vpsrlq ymm10, ymm2, 25
+    vpsllq ymm2, ymm2, 39
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm5, [RDI + 0x1E0]
+    vpsrlq ymm10, ymm3, 23
+    vpsllq ymm3, ymm3, 41
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm6, [RDI + 0x2A0]
+    vpsrlq ymm10, ymm4, 62
+    vpsllq ymm4, ymm4, 2
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RSP + 0x280], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RSP + 0x2A0], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RSP + 0x2C0], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RSP + 0x2E0], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RSP + 0x300], ymm10
+
+    ; theta: the column parities, then D
+    vmovdqu ymm0, [RSP + 0x000]
+    vpxor ymm0, ymm0, [RSP + 0x0A0]
+    vpxor ymm0, ymm0, [RSP + 0x140]
+    vpxor ymm0, ymm0, [RSP + 0x1E0]
+    vpxor ymm0, ymm0, [RSP + 0x280]
+    vmovdqu ymm1, [RSP + 0x020]
+    vpxor ymm1, ymm1, [RSP + 0x0C0]
+    vpxor ymm1, ymm1, [RSP + 0x160]
+    vpxor ymm1, ymm1, [RSP + 0x200]
+    vpxor ymm1, ymm1, [RSP + 0x2A0]
+    vmovdqu ymm2, [RSP + 0x040]
+    vpxor ymm2, ymm2, [RSP + 0x0E0]
+    vpxor ymm2, ymm2, [RSP + 0x180]
+    vpxor ymm2, ymm2, [RSP + 0x220]
+    vpxor ymm2, ymm2, [RSP + 0x2C0]
+    vmovdqu ymm3, [RSP + 0x060]
+    vpxor ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm3, ymm3, [RSP + 0x240]
+    vpxor ymm3, ymm3, [RSP + 0x2E0]
+    vmovdqu ymm4, [RSP + 0x080]
+    vpxor ymm4, ymm4, [RSP + 0x120]
+    vpxor ymm4, ymm4, [RSP + 0x1C0]
+    vpxor ymm4, ymm4, [RSP + 0x260]
+    vpxor ymm4, ymm4, [RSP + 0x300]
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm5, ymm1, ymm1
+    vpor ymm5, ymm5, ymm10
+    vpxor ymm5, ymm5, ymm4
+    vpsrlq ymm10, ymm2, 63
+    vpaddq ymm6, ymm2, ymm2
+    vpor ymm6, ymm6, ymm10
+    vpxor ymm6, ymm6, ymm0
+    vpsrlq ymm10, ymm3, 63
+    vpaddq ymm7, ymm3, ymm3
+    vpor ymm7, ymm7, ymm10
+    vpxor ymm7, ymm7, ymm1
+    vpsrlq ymm10, ymm4, 63
+    vpaddq ymm8, ymm4, ymm4
+    vpor ymm8, ymm8, ymm10
+    vpxor ymm8, ymm8, ymm2
+    vpsrlq ymm10, ymm0, 63
+    vpaddq ymm9, ymm0, ymm0
+    vpor ymm9, ymm9, ymm10
+    vpxor ymm9, ymm9, ymm3
+    ; rho, pi and chi for plane 0
+    vpxor ymm0, ymm5, [RSP + 0x000]
+    vpxor ymm1, ymm6, [RSP + 0x0C0]
+    vpsrlq ymm10, ymm1, 20
+    vpsllq ymm1, ymm1, 44
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm7, [RSP + 0x180]
+    vpsrlq ymm10, ymm2, 21
+    vpsllq ymm2, ymm2, 43
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm8, [RSP + 0x240]
+    vpsrlq ymm10, ymm3, 43
+    vpsllq ymm3, ymm3, 21
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm9, [RSP + 0x300]
+    vpsrlq ymm10, ymm4, 50
+    vpsllq ymm4, ymm4, 14
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vpbroadcastq ymm11, [RSI + 0x08]
+    vpxor ymm10, ymm10, ymm11
+    vmovdqu [RDI + 0x000], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RDI + 0x020], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RDI + 0x040], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RDI + 0x060], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RDI + 0x080], ymm10
+    ; rho, pi and chi for plane 1
+    vpxor ymm0, ymm8, [RSP + 0x060]
+    vpsrlq ymm10, ymm0, 36
+    vpsllq ymm0, ymm0, 28
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm9, [RSP + 0x120]
+    vpsrlq ymm10, ymm1, 44
+    vpsllq ymm1, ymm1, 20
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm5, [RSP + 0x140]
+    vpsrlq ymm10, ymm2, 61
+    vpsllq ymm2, ymm2, 3
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm6, [RSP + 0x200]
+    vpsrlq ymm10, ymm3, 19
+    vpsllq ymm3, ymm3, 45
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm7, [RSP + 0x2C0]
+    vpsrlq ymm10, ymm4, 3
+    vpsllq ymm4, ymm4, 61
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RDI + 0x0A0], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RDI + 0x0C0], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RDI + 0x0E0], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RDI + 0x100], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RDI + 0x120], ymm10
+    ; rho, pi and chi for plane 2
+    vpxor ymm0, ymm6, [RSP + 0x020]
+    vpsrlq ymm10, ymm0, 63
+    vpaddq ymm0, ymm0, ymm0
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm7, [RSP + 0x0E0]
+    vpsrlq ymm10, ymm1, 58
+    vpsllq ymm1, ymm1, 6
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm8, [RSP + 0x1A0]
+    vpsrlq ymm10, ymm2, 39
+    vpsllq ymm2, ymm2, 25
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm9, [RSP + 0x260]
+    vpshufb ymm3, ymm3, ymm14
+    vpxor ymm4, ymm5, [RSP + 0x280]
+    vpsrlq ymm10, ymm4, 46
+    vpsllq ymm4, ymm4, 18
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RDI + 0x140], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RDI + 0x160], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RDI + 0x180], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RDI + 0x1A0], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RDI + 0x1C0], ymm10
+    ; rho, pi and chi for plane 3
+    vpxor ymm0, ymm9, [RSP + 0x080]
+    vpsrlq ymm10, ymm0, 37
+    vpsllq ymm0, ymm0, 27
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm5, [RSP + 0x0A0]
+    vpsrlq ymm10, ymm1, 28
+    vpsllq ymm1, ymm1, 36
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm6, [RSP + 0x160]
+    vpsrlq ymm10, ymm2, 54
+    vpsllq ymm2, ymm2, 10
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm7, [RSP + 0x220]
+    vpsrlq ymm10, ymm3, 49
+    vpsllq ymm3, ymm3, 15
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm8, [RSP + 0x2E0]
+    vpshufb ymm4, ymm4, ymm15
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RDI + 0x1E0], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RDI + 0x200], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RDI + 0x220], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RDI + 0x240], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RDI + 0x260], ymm10
+    ; rho, pi and chi for plane 4
+    vpxor ymm0, ymm7, [RSP + 0x040]
+    vpsrlq ymm10, ymm0, 2
+    vpsllq ymm0, ymm0, 62
+    vpor ymm0, ymm0, ymm10
+    vpxor ymm1, ymm8, [RSP + 0x100]
+    vpsrlq ymm10, ymm1, 9
+    vpsllq ymm1, ymm1, 55
+    vpor ymm1, ymm1, ymm10
+    vpxor ymm2, ymm9, [RSP + 0x1C0]
+    vpsrlq ymm10, ymm2, 25
+    vpsllq ymm2, ymm2, 39
+    vpor ymm2, ymm2, ymm10
+    vpxor ymm3, ymm5, [RSP + 0x1E0]
+    vpsrlq ymm10, ymm3, 23
+    vpsllq ymm3, ymm3, 41
+    vpor ymm3, ymm3, ymm10
+    vpxor ymm4, ymm6, [RSP + 0x2A0]
+    vpsrlq ymm10, ymm4, 62
+    vpsllq ymm4, ymm4, 2
+    vpor ymm4, ymm4, ymm10
+    vpandn ymm10, ymm1, ymm2
+    vpxor ymm10, ymm10, ymm0
+    vmovdqu [RDI + 0x280], ymm10
+    vpandn ymm10, ymm2, ymm3
+    vpxor ymm10, ymm10, ymm1
+    vmovdqu [RDI + 0x2A0], ymm10
+    vpandn ymm10, ymm3, ymm4
+    vpxor ymm10, ymm10, ymm2
+    vmovdqu [RDI + 0x2C0], ymm10
+    vpandn ymm10, ymm4, ymm0
+    vpxor ymm10, ymm10, ymm3
+    vmovdqu [RDI + 0x2E0], ymm10
+    vpandn ymm10, ymm0, ymm1
+    vpxor ymm10, ymm10, ymm4
+    vmovdqu [RDI + 0x300], ymm10
+
+    add RSI, 0x10
+    dec EAX
+    jnz .round
+
+    add RSP, 0x360
+
+    vzeroupper
+    ret
@@ -0,0 +1,36 @@
+/*===-- threefry_many.c ---------------------*- darwin/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic threefry_many.c. */
+ORDO_HIDDEN size_t threefry_many(const uint64_t * RESTRICT subkeys,
+                                 int rounds,
+                                 const uint64_t * RESTRICT counter,
+                                 uint64_t * RESTRICT out, size_t count)
+HOT_CODE;
+
+/* Computes "groups" groups of four counters with AVX2, one counter per word
+ * of the YMM registers. */
+extern void threefry_many_ASM(uint64_t * RESTRICT out,
+                              const uint64_t * RESTRICT subkeys,
+                              const uint64_t * RESTRICT counter,
+                              size_t groups, int rounds);
+
+/*===----------------------------------------------------------------------===*/
+
+/* Fewer than four counters are left to the single-block code, which is about
+ * as fast per counter, and has a lower latency. */
+size_t threefry_many(const uint64_t * RESTRICT subkeys, int rounds,
+                     const uint64_t * RESTRICT counter,
+                     uint64_t * RESTRICT out, size_t count)
+{
+    size_t groups = count / 4;
+
+    if (groups) threefry_many_ASM(out, subkeys, counter, groups, rounds);
+
+    return groups * 4;
+}
@@ -33,6 +33,12 @@ global _freduce_coefficients
 global _fscalar
 global _fdifference_backwards
 global _cmult
+global _fe64_adx_ASM
+global _fe64_mul_ASM
+global _fe64_sqr_ASM
+global _fe64_mul121666_ASM
+global _fe64_add_ASM
+global _fe64_sub_ASM
 
 section .text
 
@@ -696,3 +702,319 @@ _cmult:
     pop    r13
     pop    rbp
     ret
+
+;/===----------------------------------------------------------------------===*/
+
+; Field arithmetic modulo 2^255 - 19 with MULX/ADCX/ADOX (BMI2 and ADX),
+; for the ladder in curve25519.c, which only uses it if fe64_adx_ASM says
+; the processor has both extensions.
+;
+; Field elements are four 64-bit words, only partially reduced: they are
+; any 256-bit value congruent to the element, and 2^256 = 38 is used to
+; fold carries back in. MULX does not touch the flags, so that the two
+; carry chains of each row of a product, through ADCX (CF) and ADOX (OF),
+; can be interleaved with the multiplications.
+
+;/===----------------------------------------------------------------------===*/
+
+_fe64_adx_ASM:
+    push RBX
+    xor R8D, R8D
+
+    xor EAX, EAX
+    cpuid
+    cmp EAX, 7
+    jb .done
+
+    mov EAX, 7
+    xor ECX, ECX
+    cpuid
+    and EBX, 0x80100 ; ADX (bit 19) and BMI2 (bit 8)
+    cmp EBX, 0x80100
+    sete R8B
+
+.done:
+    mov EAX, R8D
+    pop RBX
+    ret
+
+_fe64_mul_ASM:
+    push RBX
+    push RBP
+    push R12
+    push R13
+    push R14
+    push R15
+
+    mov RCX, RDX
+    xor EBP, EBP
+
+    mov RDX, [RSI + 0x00]
+    mulx R9, R8, [RCX + 0x00]
+    mulx R10, RAX, [RCX + 0x08]
+    add R9, RAX
+    mulx R11, RAX, [RCX + 0x10]
+    adc R10, RAX
+    mulx R12, RAX, [RCX + 0x18]
+    adc R11, RAX
+    adc R12, RBP
+
+    mov RDX, [RSI + 0x08]
+    xor EAX, EAX
+    mulx RBX, RAX, [RCX + 0x00]
+    adcx R9, RAX
+    adox R10, RBX
+    mulx RBX, RAX, [RCX + 0x08]
+    adcx R10, RAX
+    adox R11, RBX
+    mulx RBX, RAX, [RCX + 0x10]
+    adcx R11, RAX
+    adox R12, RBX
+    mulx R13, RAX, [RCX + 0x18]
+    adcx R12, RAX
+    adox R13, RBP
+    adcx R13, RBP
+
+    mov RDX, [RSI + 0x10]
+    xor EAX, EAX
+    mulx RBX, RAX, [RCX + 0x00]
+    adcx R10, RAX
+    adox R11, RBX
+    mulx RBX, RAX, [RCX + 0x08]
+    adcx R11, RAX
+    adox R12, RBX
+    mulx RBX, RAX, [RCX + 0x10]
+    adcx R12, RAX
+    adox R13, RBX
+    mulx R14, RAX, [RCX + 0x18]
+    adcx R13, RAX
+    adox R14, RBP
+    adcx R14, RBP
+
+    mov RDX, [RSI + 0x18]
+    xor EAX, EAX
+    mulx RBX, RAX, [RCX + 0x00]
+    adcx R11, RAX
+    adox R12, RBX
+    mulx RBX, RAX, [RCX + 0x08]
+    adcx R12, RAX
+    adox R13, RBX
+    mulx RBX, RAX, [RCX + 0x10]
+    adcx R13, RAX
+    adox R14, RBX
+    mulx R15, RAX, [RCX + 0x18]
+    adcx R14, RAX
+    adox R15, RBP
+    adcx R15, RBP
+
+    mov EDX, 38
+    xor EAX, EAX
+    mulx RBX, RAX, R12
+    adcx R8, RAX
+    adox R9, RBX
+    mulx RBX, RAX, R13
+    adcx R9, RAX
+    adox R10, RBX
+    mulx RBX, RAX, R14
+    adcx R10, RAX
+    adox R11, RBX
+    mulx R12, RAX, R15
+    adcx R11, RAX
+    adox R12, RBP
+    adcx R12, RBP
+
+    imul R12, R12, 38
+    add R8, R12
+    adc R9, 0
+    adc R10, 0
+    adc R11, 0
+    sbb RAX, RAX
+    and RAX, 38
+    add R8, RAX
+
+    mov [RDI + 0x00], R8
+    mov [RDI + 0x08], R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+    pop RBP
+    pop RBX
+    ret
+
+_fe64_sqr_ASM:
+    push RBX
+    push RBP
+    push R12
+    push R13
+    push R14
+    push R15
+
+    xor EBP, EBP
+
+    mov RDX, [RSI + 0x00]
+    mulx R10, R9, [RSI + 0x08]
+    mulx R11, RAX, [RSI + 0x10]
+    add R10, RAX
+    mulx R12, RAX, [RSI + 0x18]
+    adc R11, RAX
+    adc R12, RBP
+
+    mov RDX, [RSI + 0x08]
+    xor EAX, EAX
+    mulx RBX, RAX, [RSI + 0x10]
+    adcx R11, RAX
+    adox R12, RBX
+    mulx R13, RAX, [RSI + 0x18]
+    adcx R12, RAX
+    adox R13, RBP
+    adcx R13, RBP
+
+    mov RDX, [RSI + 0x10]
+    mulx R14, RAX, [RSI + 0x18]
+    add R13, RAX
+    adc R14, RBP
+
+    xor R15D, R15D
+    add R9, R9
+    adc R10, R10
+    adc R11, R11
+    adc R12, R12
+    adc R13, R13
+    adc R14, R14
+    adc R15, R15
+
+    mov RDX, [RSI + 0x00]
+    mulx RBX, R8, RDX
+    add R9, RBX
+    mov RDX, [RSI + 0x08]
+    mulx RBX, RAX, RDX
+    adc R10, RAX
+    adc R11, RBX
+    mov RDX, [RSI + 0x10]
+    mulx RBX, RAX, RDX
+    adc R12, RAX
+    adc R13, RBX
+    mov RDX, [RSI + 0x18]
+    mulx RBX, RAX, RDX
+    adc R14, RAX
+    adc R15, RBX
+
+    mov EDX, 38
+    xor EAX, EAX
+    mulx RBX, RAX, R12
+    adcx R8, RAX
+    adox R9, RBX
+    mulx RBX, RAX, R13
+    adcx R9, RAX
+    adox R10, RBX
+    mulx RBX, RAX, R14
+    adcx R10, RAX
+    adox R11, RBX
+    mulx R12, RAX, R15
+    adcx R11, RAX
+    adox R12, RBP
+    adcx R12, RBP
+
+    imul R12, R12, 38
+    add R8, R12
+    adc R9, 0
+    adc R10, 0
+    adc R11, 0
+    sbb RAX, RAX
+    and RAX, 38
+    add R8, RAX
+
+    mov [RDI + 0x00], R8
+    mov [RDI + 0x08], R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+    pop RBP
+    pop RBX
+    ret
+
+_fe64_mul121666_ASM:
+    mov EDX, 121666
+    mulx RAX, R8, [RSI + 0x00]
+    mulx RCX, R9, [RSI + 0x08]
+    add R9, RAX
+    mulx RAX, R10, [RSI + 0x10]
+    adc R10, RCX
+    mulx RCX, R11, [RSI + 0x18]
+    adc R11, RAX
+    adc RCX, 0
+
+    imul RCX, RCX, 38
+    add R8, RCX
+    adc R9, 0
+    adc R10, 0
+    adc R11, 0
+    sbb RAX, RAX
+    and RAX, 38
+    add R8, RAX
+
+    mov [RDI + 0x00], R8
+    mov [RDI + 0x08], R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+    ret
+
+_fe64_add_ASM:
+    mov R8, [RSI + 0x00]
+    add R8, [RDX + 0x00]
+    mov R9, [RSI + 0x08]
+    adc R9, [RDX + 0x08]
+    mov R10, [RSI + 0x10]
+    adc R10, [RDX + 0x10]
+    mov R11, [RSI + 0x18]
+    adc R11, [RDX + 0x18]
+    sbb RCX, RCX
+    and RCX, 38
+
+    add R8, RCX
+    adc R9, 0
+    adc R10, 0
+    adc R11, 0
+    sbb RAX, RAX
+    and RAX, 38
+    add R8, RAX
+
+    mov [RDI + 0x00], R8
+    mov [RDI + 0x08], R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+    ret
+
+_fe64_sub_ASM:
+    mov R8, [RSI + 0x00]
+    sub R8, [RDX + 0x00]
+    mov R9, [RSI + 0x08]
+    sbb R9, [RDX + 0x08]
+    mov R10, [RSI + 0x10]
+    sbb R10, [RDX + 0x10]
+    mov R11, [RSI + 0x18]
+    sbb R11, [RDX + 0x18]
+    sbb RCX, RCX
+    and RCX, 38
+
+    sub R8, RCX
+    sbb R9, 0
+    sbb R10, 0
+    sbb R11, 0
+    sbb RAX, RAX
+    and RAX, 38
+    sub R8, RAX
+
+    mov [RDI + 0x00], R8
+    mov [RDI + 0x08], R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+    ret
@@ -0,0 +1,750 @@
+;/===-- skein256_ubi.asm -----------------------*- darwin/amd64 -*- ASM -*-===*/
+
+; Skein-256 UBI compression for AMD64
+;
+; Processes a run of 32-byte message blocks in one call. The chaining value,
+; the Threefish-256 key words and the tweak stay in registers throughout, and
+; the subkeys are injected on the fly instead of being scheduled in memory.
+;
+;     void skein256_ubi_ASM(uint64_t *state, const void *blocks,
+;                           size_t count, uint64_t *tweak);
+;
+; The tweak is used as-is for the first block, after which its position is
+; advanced by 32 bytes and its "first" flag is cleared for every block.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global _skein256_ubi_ASM
+
+section .text
+
+_skein256_ubi_ASM:
+    push RBX
+    push RBP
+    push R12
+    push R13
+    push R14
+    push R15
+
+    push RCX
+
+    test RDX, RDX
+    jz .done
+
+    mov RBX, [RDI + 0x00]
+    mov RBP, [RDI + 0x08]
+    mov R12, [RDI + 0x10]
+    mov R13, [RDI + 0x18]
+
+    mov R15, [RCX + 0x00]
+    mov RAX, [RCX + 0x08]
+
+    .block:
+        mov R14, 0x1BD11BDAA9FC1A22
+        xor R14, RBX
+        xor R14, RBP
+        xor R14, R12
+        xor R14, R13
+
+        mov RCX, R15
+        xor RCX, RAX
+
+        mov  R8, [RSI + 0x00]
+        mov  R9, [RSI + 0x08]
+        mov R10, [RSI + 0x10]
+        mov R11, [RSI + 0x18]
+
+        add  R8, RBX
+        add  R9, RBP
+        add  R9, R15
+        add R10, R12
+        add R10, RAX
+        add R11, R13
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, RBP
+        add  R9, R12
+        add  R9, RAX
+        add R10, R13
+        add R10, RCX
+        add R11, R14
+        add R11, 1
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R12
+        add  R9, R13
+        add  R9, RCX
+        add R10, R14
+        add R10, R15
+        add R11, RBX
+        add R11, 2
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, R13
+        add  R9, R14
+        add  R9, R15
+        add R10, RBX
+        add R10, RAX
+        add R11, RBP
+        add R11, 3
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R14
+        add  R9, RBX
+        add  R9, RAX
+        add R10, RBP
+        add R10, RCX
+        add R11, R12
+        add R11, 4
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, RBX
+        add  R9, RBP
+        add  R9, RCX
+        add R10, R12
+        add R10, R15
+        add R11, R13
+        add R11, 5
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, RBP
+        add  R9, R12
+        add  R9, R15
+        add R10, R13
+        add R10, RAX
+        add R11, R14
+        add R11, 6
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, R12
+        add  R9, R13
+        add  R9, RAX
+        add R10, R14
+        add R10, RCX
+        add R11, RBX
+        add R11, 7
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R13
+        add  R9, R14
+        add  R9, RCX
+        add R10, RBX
+        add R10, R15
+        add R11, RBP
+        add R11, 8
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, R14
+        add  R9, RBX
+        add  R9, R15
+        add R10, RBP
+        add R10, RAX
+        add R11, R12
+        add R11, 9
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, RBX
+        add  R9, RBP
+        add  R9, RAX
+        add R10, R12
+        add R10, RCX
+        add R11, R13
+        add R11, 10
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, RBP
+        add  R9, R12
+        add  R9, RCX
+        add R10, R13
+        add R10, R15
+        add R11, R14
+        add R11, 11
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R12
+        add  R9, R13
+        add  R9, R15
+        add R10, R14
+        add R10, RAX
+        add R11, RBX
+        add R11, 12
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, R13
+        add  R9, R14
+        add  R9, RAX
+        add R10, RBX
+        add R10, RCX
+        add R11, RBP
+        add R11, 13
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R14
+        add  R9, RBX
+        add  R9, RCX
+        add R10, RBP
+        add R10, R15
+        add R11, R12
+        add R11, 14
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, RBX
+        add  R9, RBP
+        add  R9, R15
+        add R10, R12
+        add R10, RAX
+        add R11, R13
+        add R11, 15
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, RBP
+        add  R9, R12
+        add  R9, RAX
+        add R10, R13
+        add R10, RCX
+        add R11, R14
+        add R11, 16
+
+        add  R8,  R9
+        rol  R9,   14
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   16
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   52
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   57
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   23
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   40
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,    5
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   37
+        xor  R9, R10
+
+        add  R8, R12
+        add  R9, R13
+        add  R9, RCX
+        add R10, R14
+        add R10, R15
+        add R11, RBX
+        add R11, 17
+
+        add  R8,  R9
+        rol  R9,   25
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   33
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   46
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   12
+        xor  R9, R10
+
+        add  R8,  R9
+        rol  R9,   58
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   22
+        xor R11, R10
+
+        add  R8, R11
+        rol R11,   32
+        xor R11,  R8
+        add R10,  R9
+        rol  R9,   32
+        xor  R9, R10
+
+        add  R8, R13
+        add  R9, R14
+        add  R9, R15
+        add R10, RBX
+        add R10, RAX
+        add R11, RBP
+        add R11, 18
+
+        xor  R8, [RSI + 0x00]
+        xor  R9, [RSI + 0x08]
+        xor R10, [RSI + 0x10]
+        xor R11, [RSI + 0x18]
+
+        mov RBX,  R8
+        mov RBP,  R9
+        mov R12, R10
+        mov R13, R11
+
+        add R15, 0x20
+        btr RAX, 62
+
+        add RSI, 0x20
+        dec RDX
+        jnz .block
+
+    mov [RDI + 0x00], RBX
+    mov [RDI + 0x08], RBP
+    mov [RDI + 0x10], R12
+    mov [RDI + 0x18], R13
+
+    mov RCX, [RSP]
+    mov [RCX + 0x00], R15
+    mov [RCX + 0x08], RAX
+
+    .done:
+    pop RCX
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+    pop RBP
+    pop RBX
+
+    ret
@@ -0,0 +1,31 @@
+/*===-- skein256_ubi.c ---------------------------*- darwin/amd64 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic skein256_ubi.c. */
+ORDO_HIDDEN void skein256_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/* Runs the whole UBI chain over all blocks in one call, keeping the chaining
+ * value, key words and tweak in registers, see skein256_ubi.asm. */
+extern void skein256_ubi_ASM(uint64_t * RESTRICT state,
+                             const void * RESTRICT blocks,
+                             size_t count,
+                             uint64_t * RESTRICT tweak);
+
+/*===----------------------------------------------------------------------===*/
+
+void skein256_ubi(uint64_t * RESTRICT state,
+                  const void * RESTRICT blocks,
+                  size_t count,
+                  uint64_t * RESTRICT tweak)
+{
+    skein256_ubi_ASM(state, blocks, count, tweak);
+}
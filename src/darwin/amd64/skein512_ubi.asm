@@ -0,0 +1,348 @@
+;/===-- skein512_ubi.asm -----------------------*- darwin/amd64 -*- ASM -*-===*/
+
+; Skein-512 UBI compression for AMD64
+;
+; Processes a run of 64-byte message blocks in one call, with the round loop
+; of threefish512.asm. The chaining value is kept on the stack as the eight
+; Threefish-512 key words, and the subkeys are injected on the fly instead of
+; being scheduled for every block: the key words (with their parity word) and
+; the tweak words are laid out repeatedly, so that subkey n is read at offset
+; n from each, as key words n to n + 7 and tweak words n and n + 1.
+;
+;     void skein512_ubi_ASM(uint64_t *state, const void *blocks,
+;                           size_t count, uint64_t *tweak);
+;
+; The tweak is used as-is for the first block, after which its position is
+; advanced by 64 bytes and its "first" flag is cleared for every block.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global _skein512_ubi_ASM
+
+; The 26 key words, then the 21 tweak words.
+%define KEY   0x000
+%define TWEAK 0x0D0
+%define FRAME 0x180
+
+section .text
+
+_skein512_ubi_ASM:
+    push RBX
+    push RBP
+    push R12
+    push R13
+    push R14
+    push R15
+
+    sub RSP, FRAME
+
+    test RDX, RDX
+    jz .done
+
+    mov RAX, [RDI + 0x00]
+    mov [RSP + KEY + 0x00], RAX
+    mov RAX, [RDI + 0x08]
+    mov [RSP + KEY + 0x08], RAX
+    mov RAX, [RDI + 0x10]
+    mov [RSP + KEY + 0x10], RAX
+    mov RAX, [RDI + 0x18]
+    mov [RSP + KEY + 0x18], RAX
+    mov RAX, [RDI + 0x20]
+    mov [RSP + KEY + 0x20], RAX
+    mov RAX, [RDI + 0x28]
+    mov [RSP + KEY + 0x28], RAX
+    mov RAX, [RDI + 0x30]
+    mov [RSP + KEY + 0x30], RAX
+    mov RAX, [RDI + 0x38]
+    mov [RSP + KEY + 0x38], RAX
+
+    .block:
+        mov RAX, 0x1BD11BDAA9FC1A22
+        xor RAX, [RSP + KEY + 0x00]
+        xor RAX, [RSP + KEY + 0x08]
+        xor RAX, [RSP + KEY + 0x10]
+        xor RAX, [RSP + KEY + 0x18]
+        xor RAX, [RSP + KEY + 0x20]
+        xor RAX, [RSP + KEY + 0x28]
+        xor RAX, [RSP + KEY + 0x30]
+        xor RAX, [RSP + KEY + 0x38]
+        mov [RSP + KEY + 0x40], RAX
+
+        mov RAX, [RSP + KEY + 0x00]
+        mov [RSP + KEY + 0x48], RAX
+        mov RAX, [RSP + KEY + 0x08]
+        mov [RSP + KEY + 0x50], RAX
+        mov RAX, [RSP + KEY + 0x10]
+        mov [RSP + KEY + 0x58], RAX
+        mov RAX, [RSP + KEY + 0x18]
+        mov [RSP + KEY + 0x60], RAX
+        mov RAX, [RSP + KEY + 0x20]
+        mov [RSP + KEY + 0x68], RAX
+        mov RAX, [RSP + KEY + 0x28]
+        mov [RSP + KEY + 0x70], RAX
+        mov RAX, [RSP + KEY + 0x30]
+        mov [RSP + KEY + 0x78], RAX
+        mov RAX, [RSP + KEY + 0x38]
+        mov [RSP + KEY + 0x80], RAX
+        mov RAX, [RSP + KEY + 0x40]
+        mov [RSP + KEY + 0x88], RAX
+        mov RAX, [RSP + KEY + 0x48]
+        mov [RSP + KEY + 0x90], RAX
+        mov RAX, [RSP + KEY + 0x50]
+        mov [RSP + KEY + 0x98], RAX
+        mov RAX, [RSP + KEY + 0x58]
+        mov [RSP + KEY + 0xA0], RAX
+        mov RAX, [RSP + KEY + 0x60]
+        mov [RSP + KEY + 0xA8], RAX
+        mov RAX, [RSP + KEY + 0x68]
+        mov [RSP + KEY + 0xB0], RAX
+        mov RAX, [RSP + KEY + 0x70]
+        mov [RSP + KEY + 0xB8], RAX
+        mov RAX, [RSP + KEY + 0x78]
+        mov [RSP + KEY + 0xC0], RAX
+        mov RAX, [RSP + KEY + 0x80]
+        mov [RSP + KEY + 0xC8], RAX
+
+        mov RAX, [RCX + 0x00]
+        mov RBX, [RCX + 0x08]
+        mov RBP, RAX
+        xor RBP, RBX
+
+        mov [RSP + TWEAK + 0x00], RAX
+        mov [RSP + TWEAK + 0x08], RBX
+        mov [RSP + TWEAK + 0x10], RBP
+        mov [RSP + TWEAK + 0x18], RAX
+        mov [RSP + TWEAK + 0x20], RBX
+        mov [RSP + TWEAK + 0x28], RBP
+        mov [RSP + TWEAK + 0x30], RAX
+        mov [RSP + TWEAK + 0x38], RBX
+        mov [RSP + TWEAK + 0x40], RBP
+        mov [RSP + TWEAK + 0x48], RAX
+        mov [RSP + TWEAK + 0x50], RBX
+        mov [RSP + TWEAK + 0x58], RBP
+        mov [RSP + TWEAK + 0x60], RAX
+        mov [RSP + TWEAK + 0x68], RBX
+        mov [RSP + TWEAK + 0x70], RBP
+        mov [RSP + TWEAK + 0x78], RAX
+        mov [RSP + TWEAK + 0x80], RBX
+        mov [RSP + TWEAK + 0x88], RBP
+        mov [RSP + TWEAK + 0x90], RAX
+        mov [RSP + TWEAK + 0x98], RBX
+        mov [RSP + TWEAK + 0xA0], RBP
+
+        mov  R8, [RSI + 0x00]
+        mov  R9, [RSI + 0x08]
+        mov R10, [RSI + 0x10]
+        mov R11, [RSI + 0x18]
+        mov R12, [RSI + 0x20]
+        mov R13, [RSI + 0x28]
+        mov R14, [RSI + 0x30]
+        mov R15, [RSI + 0x38]
+
+        add  R8, [RSP + KEY + 0x00]
+        add  R9, [RSP + KEY + 0x08]
+        add R10, [RSP + KEY + 0x10]
+        add R11, [RSP + KEY + 0x18]
+        add R12, [RSP + KEY + 0x20]
+        add R13, [RSP + KEY + 0x28]
+        add R14, [RSP + KEY + 0x30]
+        add R15, [RSP + KEY + 0x38]
+        add R13, [RSP + TWEAK + 0x00]
+        add R14, [RSP + TWEAK + 0x08]
+
+        lea RBX, [RSP + KEY]
+        lea RBP, [RSP + TWEAK]
+        xor RAX, RAX
+
+        .loop:
+            add  R8,  R9
+            rol  R9,   46
+            xor  R9,  R8
+            add R10, R11
+            rol R11,   36
+            xor R11, R10
+            add R12, R13
+            rol R13,   19
+            xor R13, R12
+            add R14, R15
+            rol R15,   37
+            xor R15, R14
+
+            add R10,  R9
+            rol  R9,   33
+            xor  R9, R10
+            add R12, R15
+            rol R15,   27
+            xor R15, R12
+            add R14, R13
+            rol R13,   14
+            xor R13, R14
+            add  R8, R11
+            rol R11,   42
+            xor R11,  R8
+
+            add R12,  R9
+            rol  R9,   17
+            xor  R9, R12
+            add R14, R11
+            rol R11,   49
+            xor R11, R14
+            add  R8, R13
+            rol R13,   36
+            xor R13,  R8
+            add R10, R15
+            rol R15,   39
+            xor R15, R10
+
+            add R14,  R9
+            rol  R9,   44
+            xor  R9, R14
+            add  R8, R15
+            rol R15,    9
+            xor R15,  R8
+            add R10, R13
+            rol R13,   54
+            xor R13, R10
+            add R12, R11
+            rol R11,   56
+            xor R11, R12
+
+            inc RAX
+            add  R8, [RBX + 0x08]
+            add  R9, [RBX + 0x10]
+            add R10, [RBX + 0x18]
+            add R11, [RBX + 0x20]
+            add R12, [RBX + 0x28]
+            add R13, [RBX + 0x30]
+            add R14, [RBX + 0x38]
+            add R15, [RBX + 0x40]
+            add R13, [RBP + 0x08]
+            add R14, [RBP + 0x10]
+            add R15, RAX
+
+            add  R8,  R9
+            rol  R9,   39
+            xor  R9,  R8
+            add R10, R11
+            rol R11,   30
+            xor R11, R10
+            add R12, R13
+            rol R13,   34
+            xor R13, R12
+            add R14, R15
+            rol R15,   24
+            xor R15, R14
+
+            add R10,  R9
+            rol  R9,   13
+            xor  R9, R10
+            add R12, R15
+            rol R15,   50
+            xor R15, R12
+            add R14, R13
+            rol R13,   10
+            xor R13, R14
+            add  R8, R11
+            rol R11,   17
+            xor R11,  R8
+
+            add R12,  R9
+            rol  R9,   25
+            xor  R9, R12
+            add R14, R11
+            rol R11,   29
+            xor R11, R14
+            add  R8, R13
+            rol R13,   39
+            xor R13,  R8
+            add R10, R15
+            rol R15,   43
+            xor R15, R10
+
+            add R14,  R9
+            rol  R9,    8
+            xor  R9, R14
+            add  R8, R15
+            rol R15,   35
+            xor R15,  R8
+            add R10, R13
+            rol R13,   56
+            xor R13, R10
+            add R12, R11
+            rol R11,   22
+            xor R11, R12
+
+            inc RAX
+            add  R8, [RBX + 0x10]
+            add  R9, [RBX + 0x18]
+            add R10, [RBX + 0x20]
+            add R11, [RBX + 0x28]
+            add R12, [RBX + 0x30]
+            add R13, [RBX + 0x38]
+            add R14, [RBX + 0x40]
+            add R15, [RBX + 0x48]
+            add R13, [RBP + 0x10]
+            add R14, [RBP + 0x18]
+            add R15, RAX
+
+            add RBX, 0x10
+            add RBP, 0x10
+
+            cmp RAX, 18
+            jne .loop
+
+        xor  R8, [RSI + 0x00]
+        xor  R9, [RSI + 0x08]
+        xor R10, [RSI + 0x10]
+        xor R11, [RSI + 0x18]
+        xor R12, [RSI + 0x20]
+        xor R13, [RSI + 0x28]
+        xor R14, [RSI + 0x30]
+        xor R15, [RSI + 0x38]
+
+        mov [RSP + KEY + 0x00], R8
+        mov [RSP + KEY + 0x08], R9
+        mov [RSP + KEY + 0x10], R10
+        mov [RSP + KEY + 0x18], R11
+        mov [RSP + KEY + 0x20], R12
+        mov [RSP + KEY + 0x28], R13
+        mov [RSP + KEY + 0x30], R14
+        mov [RSP + KEY + 0x38], R15
+
+        add QWORD [RCX + 0x00], 0x40
+        btr QWORD [RCX + 0x08], 62
+
+        add RSI, 0x40
+        dec RDX
+        jnz .block
+
+    mov RAX, [RSP + KEY + 0x00]
+    mov [RDI + 0x00], RAX
+    mov RAX, [RSP + KEY + 0x08]
+    mov [RDI + 0x08], RAX
+    mov RAX, [RSP + KEY + 0x10]
+    mov [RDI + 0x10], RAX
+    mov RAX, [RSP + KEY + 0x18]
+    mov [RDI + 0x18], RAX
+    mov RAX, [RSP + KEY + 0x20]
+    mov [RDI + 0x20], RAX
+    mov RAX, [RSP + KEY + 0x28]
+    mov [RDI + 0x28], RAX
+    mov RAX, [RSP + KEY + 0x30]
+    mov [RDI + 0x30], RAX
+    mov RAX, [RSP + KEY + 0x38]
+    mov [RDI + 0x38], RAX
+
+    .done:
+    add RSP, FRAME
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+    pop RBP
+    pop RBX
+
+    ret
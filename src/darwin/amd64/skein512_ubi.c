@@ -0,0 +1,31 @@
+/*===-- skein512_ubi.c ---------------------------*- darwin/amd64 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic skein512_ubi.c. */
+ORDO_HIDDEN void skein512_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/* Runs the whole UBI chain over all blocks in one call, injecting the subkeys
+ * on the fly, see skein512_ubi.asm. */
+extern void skein512_ubi_ASM(uint64_t * RESTRICT state,
+                             const void * RESTRICT blocks,
+                             size_t count,
+                             uint64_t * RESTRICT tweak);
+
+/*===----------------------------------------------------------------------===*/
+
+void skein512_ubi(uint64_t * RESTRICT state,
+                  const void * RESTRICT blocks,
+                  size_t count,
+                  uint64_t * RESTRICT tweak)
+{
+    skein512_ubi_ASM(state, blocks, count, tweak);
+}
@@ -0,0 +1,739 @@
+;/===-- blake2s.asm ---------------------*- darwin/amd64/sse4.1 -*- ASM -*-===*/
+
+; BLAKE2s compression for AMD64 with SSE4.1
+;
+; Each row of the working state is held in one XMM register, so that the
+; four G functions of a column or diagonal step run side by side, the
+; diagonal steps being done by rotating the rows. The message words for
+; each step are gathered with PINSRD, as they are not contiguous.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global _blake2s_compress_ASM
+
+section .text
+
+_blake2s_compress_ASM:
+    sub RSP, 0x40
+
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x000], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x008], RAX
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x010], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x018], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x020], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x028], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x030], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x038], RAX
+
+    movdqu xmm8, [RSP + 0x00]
+    movdqu xmm9, [RSP + 0x20]
+
+    movdqu xmm0, [RDI + 0x00]
+    movdqu xmm1, [RDI + 0x10]
+    movdqu xmm2, [RCX + 0x00]
+    movdqu xmm3, [RCX + 0x10]
+    movdqu xmm10, [RDX]
+    pxor xmm3, xmm10
+
+    ; round 0
+    movd xmm4, [RSI + 0x00]
+    pinsrd xmm4, [RSI + 0x08], 1
+    pinsrd xmm4, [RSI + 0x10], 2
+    pinsrd xmm4, [RSI + 0x18], 3
+    movd xmm5, [RSI + 0x04]
+    pinsrd xmm5, [RSI + 0x0C], 1
+    pinsrd xmm5, [RSI + 0x14], 2
+    pinsrd xmm5, [RSI + 0x1C], 3
+    movd xmm6, [RSI + 0x20]
+    pinsrd xmm6, [RSI + 0x28], 1
+    pinsrd xmm6, [RSI + 0x30], 2
+    pinsrd xmm6, [RSI + 0x38], 3
+    movd xmm7, [RSI + 0x24]
+    pinsrd xmm7, [RSI + 0x2C], 1
+    pinsrd xmm7, [RSI + 0x34], 2
+    pinsrd xmm7, [RSI + 0x3C], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 1
+    movd xmm4, [RSI + 0x38]
+    pinsrd xmm4, [RSI + 0x10], 1
+    pinsrd xmm4, [RSI + 0x24], 2
+    pinsrd xmm4, [RSI + 0x34], 3
+    movd xmm5, [RSI + 0x28]
+    pinsrd xmm5, [RSI + 0x20], 1
+    pinsrd xmm5, [RSI + 0x3C], 2
+    pinsrd xmm5, [RSI + 0x18], 3
+    movd xmm6, [RSI + 0x04]
+    pinsrd xmm6, [RSI + 0x00], 1
+    pinsrd xmm6, [RSI + 0x2C], 2
+    pinsrd xmm6, [RSI + 0x14], 3
+    movd xmm7, [RSI + 0x30]
+    pinsrd xmm7, [RSI + 0x08], 1
+    pinsrd xmm7, [RSI + 0x1C], 2
+    pinsrd xmm7, [RSI + 0x0C], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 2
+    movd xmm4, [RSI + 0x2C]
+    pinsrd xmm4, [RSI + 0x30], 1
+    pinsrd xmm4, [RSI + 0x14], 2
+    pinsrd xmm4, [RSI + 0x3C], 3
+    movd xmm5, [RSI + 0x20]
+    pinsrd xmm5, [RSI + 0x00], 1
+    pinsrd xmm5, [RSI + 0x08], 2
+    pinsrd xmm5, [RSI + 0x34], 3
+    movd xmm6, [RSI + 0x28]
+    pinsrd xmm6, [RSI + 0x0C], 1
+    pinsrd xmm6, [RSI + 0x1C], 2
+    pinsrd xmm6, [RSI + 0x24], 3
+    movd xmm7, [RSI + 0x38]
+    pinsrd xmm7, [RSI + 0x18], 1
+    pinsrd xmm7, [RSI + 0x04], 2
+    pinsrd xmm7, [RSI + 0x10], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 3
+    movd xmm4, [RSI + 0x1C]
+    pinsrd xmm4, [RSI + 0x0C], 1
+    pinsrd xmm4, [RSI + 0x34], 2
+    pinsrd xmm4, [RSI + 0x2C], 3
+    movd xmm5, [RSI + 0x24]
+    pinsrd xmm5, [RSI + 0x04], 1
+    pinsrd xmm5, [RSI + 0x30], 2
+    pinsrd xmm5, [RSI + 0x38], 3
+    movd xmm6, [RSI + 0x08]
+    pinsrd xmm6, [RSI + 0x14], 1
+    pinsrd xmm6, [RSI + 0x10], 2
+    pinsrd xmm6, [RSI + 0x3C], 3
+    movd xmm7, [RSI + 0x18]
+    pinsrd xmm7, [RSI + 0x28], 1
+    pinsrd xmm7, [RSI + 0x00], 2
+    pinsrd xmm7, [RSI + 0x20], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 4
+    movd xmm4, [RSI + 0x24]
+    pinsrd xmm4, [RSI + 0x14], 1
+    pinsrd xmm4, [RSI + 0x08], 2
+    pinsrd xmm4, [RSI + 0x28], 3
+    movd xmm5, [RSI + 0x00]
+    pinsrd xmm5, [RSI + 0x1C], 1
+    pinsrd xmm5, [RSI + 0x10], 2
+    pinsrd xmm5, [RSI + 0x3C], 3
+    movd xmm6, [RSI + 0x38]
+    pinsrd xmm6, [RSI + 0x2C], 1
+    pinsrd xmm6, [RSI + 0x18], 2
+    pinsrd xmm6, [RSI + 0x0C], 3
+    movd xmm7, [RSI + 0x04]
+    pinsrd xmm7, [RSI + 0x30], 1
+    pinsrd xmm7, [RSI + 0x20], 2
+    pinsrd xmm7, [RSI + 0x34], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 5
+    movd xmm4, [RSI + 0x08]
+    pinsrd xmm4, [RSI + 0x18], 1
+    pinsrd xmm4, [RSI + 0x00], 2
+    pinsrd xmm4, [RSI + 0x20], 3
+    movd xmm5, [RSI + 0x30]
+    pinsrd xmm5, [RSI + 0x28], 1
+    pinsrd xmm5, [RSI + 0x2C], 2
+    pinsrd xmm5, [RSI + 0x0C], 3
+    movd xmm6, [RSI + 0x10]
+    pinsrd xmm6, [RSI + 0x1C], 1
+    pinsrd xmm6, [RSI + 0x3C], 2
+    pinsrd xmm6, [RSI + 0x04], 3
+    movd xmm7, [RSI + 0x34]
+    pinsrd xmm7, [RSI + 0x14], 1
+    pinsrd xmm7, [RSI + 0x38], 2
+    pinsrd xmm7, [RSI + 0x24], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 6
+    movd xmm4, [RSI + 0x30]
+    pinsrd xmm4, [RSI + 0x04], 1
+    pinsrd xmm4, [RSI + 0x38], 2
+    pinsrd xmm4, [RSI + 0x10], 3
+    movd xmm5, [RSI + 0x14]
+    pinsrd xmm5, [RSI + 0x3C], 1
+    pinsrd xmm5, [RSI + 0x34], 2
+    pinsrd xmm5, [RSI + 0x28], 3
+    movd xmm6, [RSI + 0x00]
+    pinsrd xmm6, [RSI + 0x18], 1
+    pinsrd xmm6, [RSI + 0x24], 2
+    pinsrd xmm6, [RSI + 0x20], 3
+    movd xmm7, [RSI + 0x1C]
+    pinsrd xmm7, [RSI + 0x0C], 1
+    pinsrd xmm7, [RSI + 0x08], 2
+    pinsrd xmm7, [RSI + 0x2C], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 7
+    movd xmm4, [RSI + 0x34]
+    pinsrd xmm4, [RSI + 0x1C], 1
+    pinsrd xmm4, [RSI + 0x30], 2
+    pinsrd xmm4, [RSI + 0x0C], 3
+    movd xmm5, [RSI + 0x2C]
+    pinsrd xmm5, [RSI + 0x38], 1
+    pinsrd xmm5, [RSI + 0x04], 2
+    pinsrd xmm5, [RSI + 0x24], 3
+    movd xmm6, [RSI + 0x14]
+    pinsrd xmm6, [RSI + 0x3C], 1
+    pinsrd xmm6, [RSI + 0x20], 2
+    pinsrd xmm6, [RSI + 0x08], 3
+    movd xmm7, [RSI + 0x00]
+    pinsrd xmm7, [RSI + 0x10], 1
+    pinsrd xmm7, [RSI + 0x18], 2
+    pinsrd xmm7, [RSI + 0x28], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 8
+    movd xmm4, [RSI + 0x18]
+    pinsrd xmm4, [RSI + 0x38], 1
+    pinsrd xmm4, [RSI + 0x2C], 2
+    pinsrd xmm4, [RSI + 0x00], 3
+    movd xmm5, [RSI + 0x3C]
+    pinsrd xmm5, [RSI + 0x24], 1
+    pinsrd xmm5, [RSI + 0x0C], 2
+    pinsrd xmm5, [RSI + 0x20], 3
+    movd xmm6, [RSI + 0x30]
+    pinsrd xmm6, [RSI + 0x34], 1
+    pinsrd xmm6, [RSI + 0x04], 2
+    pinsrd xmm6, [RSI + 0x28], 3
+    movd xmm7, [RSI + 0x08]
+    pinsrd xmm7, [RSI + 0x1C], 1
+    pinsrd xmm7, [RSI + 0x10], 2
+    pinsrd xmm7, [RSI + 0x14], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    ; round 9
+    movd xmm4, [RSI + 0x28]
+    pinsrd xmm4, [RSI + 0x20], 1
+    pinsrd xmm4, [RSI + 0x1C], 2
+    pinsrd xmm4, [RSI + 0x04], 3
+    movd xmm5, [RSI + 0x08]
+    pinsrd xmm5, [RSI + 0x10], 1
+    pinsrd xmm5, [RSI + 0x18], 2
+    pinsrd xmm5, [RSI + 0x14], 3
+    movd xmm6, [RSI + 0x3C]
+    pinsrd xmm6, [RSI + 0x24], 1
+    pinsrd xmm6, [RSI + 0x0C], 2
+    pinsrd xmm6, [RSI + 0x34], 3
+    movd xmm7, [RSI + 0x2C]
+    pinsrd xmm7, [RSI + 0x38], 1
+    pinsrd xmm7, [RSI + 0x30], 2
+    pinsrd xmm7, [RSI + 0x00], 3
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm4
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm5
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm1
+    paddd xmm0, xmm6
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm8
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 12
+    pslld xmm1, 20
+    por xmm1, xmm10
+    paddd xmm0, xmm1
+    paddd xmm0, xmm7
+    pxor xmm3, xmm0
+    pshufb xmm3, xmm9
+    paddd xmm2, xmm3
+    pxor xmm1, xmm2
+    movdqa xmm10, xmm1
+    psrld xmm10, 7
+    pslld xmm1, 25
+    por xmm1, xmm10
+
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+
+    movdqu xmm4, [RDI + 0x00]
+    movdqu xmm5, [RDI + 0x10]
+    pxor xmm0, xmm2
+    pxor xmm1, xmm3
+    pxor xmm0, xmm4
+    pxor xmm1, xmm5
+    movdqu [RDI + 0x00], xmm0
+    movdqu [RDI + 0x10], xmm1
+
+    add RSP, 0x40
+
+    ret
@@ -0,0 +1,147 @@
+/*===-- blake2s.c -------------------------*- darwin/amd64/sse4.1 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2s.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2S_DIGEST  (bits(256))
+#define BLAKE2S_BLOCK   (bits(512))
+#define BLAKE2S_KEY_MAX (bits(256))
+
+/* Compresses one block into the chaining value. The "tf" array holds the two
+ * counter words followed by the two finalization flags, in the order in which
+ * they are mixed into the working state. This is also used by BLAKE2sp. */
+ORDO_HIDDEN void blake2s_compress(uint32_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint32_t * RESTRICT tf)
+HOT_CODE;
+
+/* Compresses one block with SSE4.1, with each row of the working state held in
+ * an XMM register. The IV is passed in to keep the assembly free of data. */
+extern void blake2s_compress_ASM(uint32_t * RESTRICT h,
+                                 const void * RESTRICT block,
+                                 const uint32_t * RESTRICT tf,
+                                 const uint32_t * RESTRICT iv);
+
+static const uint32_t blake2s_iv[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#ifdef OPAQUE
+struct BLAKE2S_STATE
+{
+    uint32_t h[8];
+    uint32_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2s_init(struct BLAKE2S_STATE *state,
+                 const struct BLAKE2S_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+
+    if (key_len > BLAKE2S_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    memcpy(state->h, blake2s_iv, sizeof(blake2s_iv));
+
+    /* The parameter block, for sequential hashing with a full digest. */
+    state->h[0] ^= 0x01010000 | (uint32_t)(key_len << 8) | BLAKE2S_DIGEST;
+
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    /* A key is hashed as a first, zero-padded, message block. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2S_BLOCK);
+        memcpy(state->block, params->key, key_len);
+        state->block_len = BLAKE2S_BLOCK;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2s_update(struct BLAKE2S_STATE *state,
+                    const void *buffer, size_t len)
+{
+    uint32_t tf[4] = { 0, 0, 0, 0 };
+
+    if (!len) return;
+
+    /* The last block must be compressed with the final flag set, so a block
+     * is only compressed once it is known that more data follows it. */
+
+    if (state->block_len + len > BLAKE2S_BLOCK)
+    {
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(BLAKE2S_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->msg_len += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)state->msg_len;
+            tf[1] = (uint32_t)(state->msg_len >> 32);
+            blake2s_compress(state->h, state->block, tf);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        while (len > BLAKE2S_BLOCK)
+        {
+            state->msg_len += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)state->msg_len;
+            tf[1] = (uint32_t)(state->msg_len >> 32);
+            blake2s_compress(state->h, buffer, tf);
+
+            buffer = offset(buffer, BLAKE2S_BLOCK);
+            len -= BLAKE2S_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2s_final(struct BLAKE2S_STATE *state,
+                   void *digest)
+{
+    uint32_t tf[4] = { 0, 0, 0, 0 };
+    size_t t;
+
+    memset(offset(state->block, state->block_len), 0,
+           (size_t)(BLAKE2S_BLOCK - state->block_len));
+
+    state->msg_len += state->block_len;
+    tf[0] = (uint32_t)state->msg_len;
+    tf[1] = (uint32_t)(state->msg_len >> 32);
+    tf[2] = ~(uint32_t)0;
+    blake2s_compress(state->h, state->block, tf);
+
+    for (t = 0; t < 8; ++t)
+        state->h[t] = tole32(state->h[t]);
+
+    memcpy(digest, state->h, BLAKE2S_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void blake2s_compress(uint32_t * RESTRICT h,
+                      const void * RESTRICT block,
+                      const uint32_t * RESTRICT tf)
+{
+    /* This handles unaligned input blocks just fine. */
+    blake2s_compress_ASM(h, block, tf, blake2s_iv);
+}
@@ -0,0 +1,209 @@
+/*===-- sys.c ------------------------------------------*- darwin -*- C -*-===*/
+
+/* Needed for _SC_NPROCESSORS_ONLN and MAP_ANON in strict C89 mode. */
+#define _DARWIN_C_SOURCE
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include <sys/mman.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/*===----------------------------------------------------------------------===*/
+
+#define MAX_THREADS 64
+
+/* The workers are started the first time they are needed and then kept for
+ * the life of the process, waiting on "wake" for a batch to be posted. The
+ * batch is split into "stride" shares, the calling thread running share 0
+ * and each of the others being claimed by whichever worker gets to it first
+ * ("next" being the next unclaimed share), "pending" counting the claimed or
+ * unclaimed shares which have not completed yet. Only one batch is run at a
+ * time, and a batch posted while another one runs is run by its caller. */
+struct POOL
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake, done;
+    size_t workers;
+    int busy;
+
+    SYS_JOB job;
+    void *ctx;
+    size_t count, stride;
+    size_t next, pending;
+};
+
+static struct POOL pool =
+{
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static void run_share(SYS_JOB job, void *ctx,
+                      size_t first, size_t count, size_t stride)
+{
+    size_t t;
+
+    for (t = first; t < count; t += stride)
+        job(ctx, t);
+}
+
+static void *worker_main(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&pool.lock);
+
+    while (1)
+    {
+        SYS_JOB job;
+        void *ctx;
+        size_t first, count, stride;
+
+        while (pool.next == pool.stride)
+            pthread_cond_wait(&pool.wake, &pool.lock);
+
+        job = pool.job;
+        ctx = pool.ctx;
+        count = pool.count;
+        stride = pool.stride;
+        first = pool.next++;
+
+        pthread_mutex_unlock(&pool.lock);
+        run_share(job, ctx, first, count, stride);
+        pthread_mutex_lock(&pool.lock);
+
+        if (!--pool.pending)
+            pthread_cond_signal(&pool.done);
+    }
+
+    return 0;
+}
+
+/* A child process only has the thread which forked, so it starts over with
+ * no workers, and with the lock, which the fork held, released. */
+static void pool_prepare(void)
+{
+    pthread_mutex_lock(&pool.lock);
+}
+
+static void pool_parent(void)
+{
+    pthread_mutex_unlock(&pool.lock);
+}
+
+static void pool_child(void)
+{
+    pool.workers = 0;
+    pool.busy = 0;
+    pool.next = pool.stride = pool.pending = 0;
+
+    pthread_cond_init(&pool.wake, 0);
+    pthread_cond_init(&pool.done, 0);
+    pthread_mutex_unlock(&pool.lock);
+}
+
+/* Starts workers until there are "want" of them, if possible. This is done
+ * with the lock held. */
+static void pool_grow(size_t want)
+{
+    if (!pool.workers)
+        if (pthread_atfork(pool_prepare, pool_parent, pool_child))
+            return;
+
+    while (pool.workers < want)
+    {
+        pthread_attr_t attr;
+        pthread_t thread;
+        int err;
+
+        if (pthread_attr_init(&attr))
+            return;
+
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        err = pthread_create(&thread, &attr, worker_main, 0);
+        pthread_attr_destroy(&attr);
+
+        if (err) return;
+
+        ++pool.workers;
+    }
+}
+
+static size_t cpu_count(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n < 1) ? 1 : (size_t)n;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void sys_parallel(size_t count, SYS_JOB job, void *ctx)
+{
+    size_t threads = smin(smin(cpu_count(), count), MAX_THREADS);
+
+    if (threads > 1)
+    {
+        pthread_mutex_lock(&pool.lock);
+
+        /* If another batch is running, possibly the one whose job is making
+         * this call, this one is run here instead of waiting for it. */
+        if (pool.busy)
+            threads = 1;
+        else
+        {
+            pool_grow(threads - 1);
+            threads = smin(threads, pool.workers + 1);
+        }
+
+        if (threads > 1)
+        {
+            pool.busy = 1;
+            pool.job = job;
+            pool.ctx = ctx;
+            pool.count = count;
+            pool.stride = threads;
+            pool.next = 1;
+            pool.pending = threads - 1;
+
+            pthread_cond_broadcast(&pool.wake);
+            pthread_mutex_unlock(&pool.lock);
+
+            run_share(job, ctx, 0, count, threads);
+
+            pthread_mutex_lock(&pool.lock);
+
+            while (pool.pending)
+                pthread_cond_wait(&pool.done, &pool.lock);
+
+            pool.busy = 0;
+        }
+
+        pthread_mutex_unlock(&pool.lock);
+    }
+
+    if (threads <= 1)
+        run_share(job, ctx, 0, count, 1);
+}
+
+size_t sys_threads(void)
+{
+    return smin(cpu_count(), MAX_THREADS);
+}
+
+void *sys_alloc(size_t len)
+{
+    void *ptr = mmap(0, len, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANON, -1, 0);
+
+    return (ptr == MAP_FAILED) ? 0 : ptr;
+}
+
+void sys_free(void *ptr, size_t len)
+{
+    if (ptr) munmap(ptr, len);
+}
@@ -0,0 +1,163 @@
+/*===-- ed25519.c -------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/misc/ed25519.h"
+#include "ordo/misc/os_random.h"
+#include "ordo/primitives/hash_functions/sha512.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* See edwards25519.c. */
+ORDO_HIDDEN void edwards25519_base(uint8_t *out, const uint8_t *scalar);
+
+/* See edwards25519.c. */
+ORDO_HIDDEN void edwards25519_reduce(uint8_t *out, const uint8_t *in);
+
+/* See edwards25519.c. */
+ORDO_HIDDEN void edwards25519_muladd(uint8_t *s, const uint8_t *a,
+                                     const uint8_t *b, const uint8_t *c);
+
+/* See edwards25519.c. */
+ORDO_HIDDEN int edwards25519_verify(const uint8_t *sig, const uint8_t *h,
+                                    const uint8_t *pub);
+
+/* See edwards25519.c. */
+ORDO_HIDDEN int edwards25519_verify_many(const uint8_t *const *sig,
+                                         const uint8_t *h,
+                                         const uint8_t *const *pub,
+                                         const uint8_t *z, size_t count);
+
+/* The largest number of signatures checked together, which is that of
+ * edwards25519_verify_many, and the smallest, below which checking them one
+ * at a time is faster. */
+#define ED25519_BATCH     (64)
+#define ED25519_MIN_BATCH (8)
+
+/*===----------------------------------------------------------------------===*/
+
+/* Computes SHA-512(a || b || msg) modulo L, into the 32 bytes of "out",
+ * where a and b are 32 bytes, and b may be nil. */
+static void ed25519_hash(uint8_t *out, const void *a, const void *b,
+                         const void *msg, size_t len)
+{
+    struct SHA512_STATE state;
+    uint8_t digest[64];
+
+    sha512_init(&state, 0);
+    sha512_update(&state, a, 32);
+    if (b) sha512_update(&state, b, 32);
+    sha512_update(&state, msg, len);
+    sha512_final(&state, digest);
+
+    edwards25519_reduce(out, digest);
+
+    memset(digest, 0, sizeof(digest));
+}
+
+/* Hashes the private key into the secret scalar a, which is clamped, and
+ * the 32-byte prefix from which the nonces are derived. */
+static void ed25519_expand(uint8_t *az, const void *priv)
+{
+    struct SHA512_STATE state;
+
+    sha512_init(&state, 0);
+    sha512_update(&state, priv, 32);
+    sha512_final(&state, az);
+
+    az[0] &= 248;
+    az[31] &= 127;
+    az[31] |= 64;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int ed25519_gen(void *priv)
+{
+    return os_secure_random(priv, bits(256));
+}
+
+void ed25519_pub(void *pub, const void *priv)
+{
+    uint8_t az[64];
+
+    ed25519_expand(az, priv);
+    edwards25519_base(pub, az);
+
+    memset(az, 0, sizeof(az));
+}
+
+void ed25519_sign(void *sig, const void *priv,
+                  const void *msg, size_t len)
+{
+    uint8_t az[64], pub[32], r[32], h[32];
+
+    ed25519_expand(az, priv);
+    edwards25519_base(pub, az);
+
+    /* The nonce r is derived from the prefix and the message, and R = rB
+     * is the first half of the signature. */
+    ed25519_hash(r, az + 32, 0, msg, len);
+    edwards25519_base(sig, r);
+
+    ed25519_hash(h, sig, pub, msg, len);
+    edwards25519_muladd(offset(sig, 32), h, az, r);
+
+    memset(az, 0, sizeof(az));
+    memset(r, 0, sizeof(r));
+}
+
+int ed25519_verify(const void *sig, const void *pub,
+                   const void *msg, size_t len)
+{
+    uint8_t h[32];
+
+    ed25519_hash(h, sig, pub, msg, len);
+
+    return edwards25519_verify(sig, h, pub) ? ORDO_SUCCESS : ORDO_ARG;
+}
+
+int ed25519_verify_batch(struct ED25519_JOB *jobs, size_t count)
+{
+    const uint8_t *sig[ED25519_BATCH], *pub[ED25519_BATCH];
+    uint8_t h[ED25519_BATCH][32], z[ED25519_BATCH][16];
+    int err = ORDO_SUCCESS;
+
+    /* The jobs are split into batches of about the same size, so that the
+     * last one is not left with only a few signatures. */
+    size_t batches = (count + ED25519_BATCH - 1) / ED25519_BATCH;
+
+    while (count)
+    {
+        size_t n = (count + batches - 1) / batches, t;
+        int valid = 0;
+
+        for (t = 0; t < n; ++t)
+        {
+            sig[t] = jobs[t].sig;
+            pub[t] = jobs[t].pub;
+            ed25519_hash(h[t], sig[t], pub[t], jobs[t].msg, jobs[t].len);
+        }
+
+        if (n >= ED25519_MIN_BATCH && !os_secure_random(z, 16 * n))
+            valid = edwards25519_verify_many(sig, h[0], pub, z[0], n);
+
+        for (t = 0; t < n; ++t)
+        {
+            if (valid || edwards25519_verify(sig[t], h[t], pub[t]))
+                jobs[t].err = ORDO_SUCCESS;
+            else
+                jobs[t].err = ORDO_ARG;
+
+            if (!err) err = jobs[t].err;
+        }
+
+        jobs += n;
+        count -= n;
+        --batches;
+    }
+
+    return err;
+}
@@ -0,0 +1,4807 @@
+/*===-- edwards25519.c --------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* Arithmetic on edwards25519, the twisted Edwards curve -x^2 + y^2 = 1 +
+ * d x^2 y^2 which is birationally equivalent to Curve25519, following the
+ * ref10 code of Bernstein, Duif, Lange, Schwabe and Yang (public domain).
+ * Its addition formulas are complete and much cheaper than a ladder step,
+ * so that multiples of the base point are best computed on it, from a table
+ * of precomputed multiples, and then mapped to the Montgomery curve. */
+
+/* Computes the Curve25519 public keys for "count" secret scalars, that is,
+ * the u coordinate of each scalar times the base point, the same as the
+ * ladder does for the point u = 9, in constant time. All 256 bits of each
+ * scalar are used, and the scalars and results are 32 bytes each. */
+ORDO_HIDDEN void edwards25519_base_u(uint8_t *u, const uint8_t *scalar,
+                                     size_t count);
+
+/* The number of results which share an inversion. */
+#define EDWARDS25519_BATCH (16)
+
+/* Writes the encoding of "scalar" times the base point, as in RFC 8032, in
+ * constant time. All 256 bits of the scalar are used. */
+ORDO_HIDDEN void edwards25519_base(uint8_t *out, const uint8_t *scalar);
+
+/* Reduces the 64-byte "in" modulo the order L of the base point. */
+ORDO_HIDDEN void edwards25519_reduce(uint8_t *out, const uint8_t *in);
+
+/* Computes s = ab + c modulo L, in constant time, for 32-byte a, b and c. */
+ORDO_HIDDEN void edwards25519_muladd(uint8_t *s, const uint8_t *a,
+                                     const uint8_t *b, const uint8_t *c);
+
+/* Returns 1 if the 64-byte signature (R, S) is valid for the public key
+ * "pub", where h is the hash of R, "pub" and the message modulo L, and 0 if
+ * it is not, or if R or "pub" cannot be decoded or S is not below L. */
+ORDO_HIDDEN int edwards25519_verify(const uint8_t *sig, const uint8_t *h,
+                                    const uint8_t *pub);
+
+/* Returns 1 if the "count" signatures, at most EDWARDS25519_MANY, pass the
+ * random linear combination of their equations with the 16-byte z, where h
+ * has the 32-byte hashes one after the other, and 0 otherwise, including
+ * if edwards25519_verify would have rejected any of them before checking
+ * its equation. Only then may the caller check them one at a time. */
+ORDO_HIDDEN int edwards25519_verify_many(const uint8_t *const *sig,
+                                         const uint8_t *h,
+                                         const uint8_t *const *pub,
+                                         const uint8_t *z, size_t count);
+
+#define EDWARDS25519_MANY (64)
+
+/* The bounds of the bucket method, for at most two points per signature and
+ * for digits of 4 to 5 bits. */
+#define EDWARDS25519_POINTS  (2 * EDWARDS25519_MANY)
+#define EDWARDS25519_BITS    (5)
+#define EDWARDS25519_WINDOWS (256 / 4 + 1)
+
+/*===----------------------------------------------------------------------===*/
+
+/* Field elements, with the same two representations as in curve25519.c.
+ * Each provides fe_frombytes, fe_tobytes (fully reduced), fe_add, fe_sub,
+ * fe_mul, fe_sq and fe_sq_times, which may all alias their inputs, fe_cmov,
+ * the constants d, 2d and sqrt(-1), and the table of multiples of the base
+ * point. */
+
+/* Loads 255 bits, ignoring the top bit, which callers deal with. */
+static void load_words(uint64_t *w, const uint8_t *in)
+{
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        memcpy(w + t, in + 8 * t, 8);
+        w[t] = fmle64(w[t]);
+    }
+
+    w[3] &= UINT64_C(0x7fffffffffffffff);
+}
+
+static void store_words(uint8_t *out, uint64_t *w)
+{
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        w[t] = tole64(w[t]);
+        memcpy(out + 8 * t, w + t, 8);
+    }
+}
+
+#if defined(HAS_UINT128)
+
+/* Five unsigned limbs of 51 bits, only partially reduced. */
+typedef uint64_t fe[5];
+
+#define LOW51 (UINT64_C(0x7ffffffffffff))
+
+/* d = -121665/121666, the curve constant, 2d, and a square root of -1. */
+static const fe fe_d = {
+    UINT64_C(0x34dca135978a3), UINT64_C(0x1a8283b156ebd),
+    UINT64_C(0x5e7a26001c029), UINT64_C(0x739c663a03cbb),
+    UINT64_C(0x52036cee2b6ff)
+};
+
+static const fe fe_d2 = {
+    UINT64_C(0x69b9426b2f159), UINT64_C(0x35050762add7a),
+    UINT64_C(0x3cf44c0038052), UINT64_C(0x6738cc7407977),
+    UINT64_C(0x2406d9dc56dff)
+};
+
+static const fe fe_sqrtm1 = {
+    UINT64_C(0x61b274a0ea0b0), UINT64_C(0x0d5a5fc8f189d),
+    UINT64_C(0x7ef5e9cbd0c60), UINT64_C(0x78595a6804c9e),
+    UINT64_C(0x2b8324804fc1d)
+};
+
+static void fe_mul(fe h, const fe f, const fe g)
+HOT_CODE;
+static void fe_sq_times(fe h, const fe f, int n)
+HOT_CODE;
+
+static void fe_frombytes(fe h, const uint8_t *s)
+{
+    uint64_t w[4];
+
+    load_words(w, s);
+
+    h[0] = w[0] & LOW51;
+    h[1] = ((w[0] >> 51) | (w[1] << 13)) & LOW51;
+    h[2] = ((w[1] >> 38) | (w[2] << 26)) & LOW51;
+    h[3] = ((w[2] >> 25) | (w[3] << 39)) & LOW51;
+    h[4] = w[3] >> 12;
+}
+
+/* Leaves every limb below 2^51, except h[0] which may exceed it a little. */
+static void fe_carry(fe h)
+{
+    uint64_t c;
+
+    c = h[0] >> 51; h[0] &= LOW51; h[1] += c;
+    c = h[1] >> 51; h[1] &= LOW51; h[2] += c;
+    c = h[2] >> 51; h[2] &= LOW51; h[3] += c;
+    c = h[3] >> 51; h[3] &= LOW51; h[4] += c;
+    c = h[4] >> 51; h[4] &= LOW51; h[0] += 19 * c;
+}
+
+static void fe_tobytes(uint8_t *s, const fe f)
+{
+    uint64_t h[5], w[4], q;
+
+    memcpy(h, f, sizeof(h));
+    fe_carry(h);
+    fe_carry(h);
+
+    /* Now h < 2^255 + 19, and q is 1 if h >= p, that is, if h + 19 has bit
+     * 255 set, in which case h - p = h + 19 - 2^255 is taken instead. */
+    q = (h[0] + 19) >> 51;
+    q = (h[1] + q) >> 51;
+    q = (h[2] + q) >> 51;
+    q = (h[3] + q) >> 51;
+    q = (h[4] + q) >> 51;
+
+    h[0] += 19 * q;
+
+    h[1] += h[0] >> 51; h[0] &= LOW51;
+    h[2] += h[1] >> 51; h[1] &= LOW51;
+    h[3] += h[2] >> 51; h[2] &= LOW51;
+    h[4] += h[3] >> 51; h[3] &= LOW51;
+                        h[4] &= LOW51;
+
+    w[0] = (h[0] >>  0) | (h[1] << 51);
+    w[1] = (h[1] >> 13) | (h[2] << 38);
+    w[2] = (h[2] >> 26) | (h[3] << 25);
+    w[3] = (h[3] >> 39) | (h[4] << 12);
+
+    store_words(s, w);
+}
+
+/* The sum is not carried, which the formulas below allow: its limbs are
+ * below 2^53 when those of f and g are below 2^52, as for any other result,
+ * which is small enough for it to be multiplied, to be either side of a
+ * subtraction, or to be added to once more before being multiplied. */
+static void fe_add(fe h, const fe f, const fe g)
+{
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+}
+
+/* Adds 4p before subtracting, which is more than any limb of a sum. */
+static void fe_sub(fe h, const fe f, const fe g)
+{
+    h[0] = f[0] + UINT64_C(0x1fffffffffffb4) - g[0];
+    h[1] = f[1] + UINT64_C(0x1ffffffffffffc) - g[1];
+    h[2] = f[2] + UINT64_C(0x1ffffffffffffc) - g[2];
+    h[3] = f[3] + UINT64_C(0x1ffffffffffffc) - g[3];
+    h[4] = f[4] + UINT64_C(0x1ffffffffffffc) - g[4];
+
+    fe_carry(h);
+}
+
+void fe_mul(fe h, const fe f, const fe g)
+{
+    uint128_t t0, t1, t2, t3, t4;
+    uint64_t f0, f1, f2, f3, f4, g0, g1, g2, g3, g4, c;
+
+    f0 = f[0]; f1 = f[1]; f2 = f[2]; f3 = f[3]; f4 = f[4];
+    g0 = g[0]; g1 = g[1]; g2 = g[2]; g3 = g[3]; g4 = g[4];
+
+    t0 = (uint128_t)f0 * g0;
+    t1 = (uint128_t)f0 * g1 + (uint128_t)f1 * g0;
+    t2 = (uint128_t)f0 * g2 + (uint128_t)f1 * g1 + (uint128_t)f2 * g0;
+    t3 = (uint128_t)f0 * g3 + (uint128_t)f1 * g2 + (uint128_t)f2 * g1
+       + (uint128_t)f3 * g0;
+    t4 = (uint128_t)f0 * g4 + (uint128_t)f1 * g3 + (uint128_t)f2 * g2
+       + (uint128_t)f3 * g1 + (uint128_t)f4 * g0;
+
+    f1 *= 19; f2 *= 19; f3 *= 19; f4 *= 19;
+
+    t0 += (uint128_t)f1 * g4 + (uint128_t)f2 * g3 + (uint128_t)f3 * g2
+        + (uint128_t)f4 * g1;
+    t1 += (uint128_t)f2 * g4 + (uint128_t)f3 * g3 + (uint128_t)f4 * g2;
+    t2 += (uint128_t)f3 * g4 + (uint128_t)f4 * g3;
+    t3 += (uint128_t)f4 * g4;
+
+                   h[0] = (uint64_t)t0 & LOW51; c = (uint64_t)(t0 >> 51);
+    t1 += c;       h[1] = (uint64_t)t1 & LOW51; c = (uint64_t)(t1 >> 51);
+    t2 += c;       h[2] = (uint64_t)t2 & LOW51; c = (uint64_t)(t2 >> 51);
+    t3 += c;       h[3] = (uint64_t)t3 & LOW51; c = (uint64_t)(t3 >> 51);
+    t4 += c;       h[4] = (uint64_t)t4 & LOW51; c = (uint64_t)(t4 >> 51);
+    h[0] += c * 19; c = h[0] >> 51; h[0] &= LOW51;
+    h[1] += c;
+}
+
+/* h = f^(2^n), for n > 0, keeping the limbs in registers in between. */
+void fe_sq_times(fe h, const fe f, int n)
+{
+    uint128_t t0, t1, t2, t3, t4;
+    uint64_t f0, f1, f2, f3, f4, d0, d1, d2, d4, d419, c;
+
+    f0 = f[0]; f1 = f[1]; f2 = f[2]; f3 = f[3]; f4 = f[4];
+
+    do
+    {
+        d0 = f0 * 2;
+        d1 = f1 * 2;
+        d2 = f2 * 2 * 19;
+        d419 = f4 * 19;
+        d4 = d419 * 2;
+
+        t0 = (uint128_t)f0 * f0 + (uint128_t)d4 * f1 + (uint128_t)d2 * f3;
+        t1 = (uint128_t)d0 * f1 + (uint128_t)d4 * f2
+           + (uint128_t)f3 * (f3 * 19);
+        t2 = (uint128_t)d0 * f2 + (uint128_t)f1 * f1 + (uint128_t)d4 * f3;
+        t3 = (uint128_t)d0 * f3 + (uint128_t)d1 * f2 + (uint128_t)f4 * d419;
+        t4 = (uint128_t)d0 * f4 + (uint128_t)d1 * f3 + (uint128_t)f2 * f2;
+
+                    f0 = (uint64_t)t0 & LOW51; c = (uint64_t)(t0 >> 51);
+        t1 += c;    f1 = (uint64_t)t1 & LOW51; c = (uint64_t)(t1 >> 51);
+        t2 += c;    f2 = (uint64_t)t2 & LOW51; c = (uint64_t)(t2 >> 51);
+        t3 += c;    f3 = (uint64_t)t3 & LOW51; c = (uint64_t)(t3 >> 51);
+        t4 += c;    f4 = (uint64_t)t4 & LOW51; c = (uint64_t)(t4 >> 51);
+        f0 += c * 19; c = f0 >> 51; f0 &= LOW51;
+        f1 += c;
+    }
+    while (--n);
+
+    h[0] = f0; h[1] = f1; h[2] = f2; h[3] = f3; h[4] = f4;
+}
+
+static void fe_sq(fe h, const fe f)
+{
+    fe_sq_times(h, f, 1);
+}
+
+/* Replaces f with g if b is 1, and leaves it alone if b is 0. */
+static void fe_cmov(fe f, const fe g, unsigned int b)
+{
+    uint64_t mask = 0 - (uint64_t)b;
+    size_t t;
+
+    for (t = 0; t < 5; ++t) f[t] ^= mask & (f[t] ^ g[t]);
+}
+
+#else
+
+/* Ten signed limbs of alternately 26 and 25 bits, as in ref10, for which
+ * products of limbs fit in 64 bits. Sums and differences are carried. */
+typedef int32_t fe[10];
+
+static const fe fe_d = {
+    56195235, 13857412, 51736253, 6949390, 114729,
+    24766616, 60832955, 30306712, 48412415, 21499315
+};
+
+static const fe fe_d2 = {
+    45281625, 27714825, 36363642, 13898781, 229458,
+    15978800, 54557047, 27058993, 29715967, 9444199
+};
+
+static const fe fe_sqrtm1 = {
+    34513072, 25610706, 9377949, 3500415, 12389472,
+    33281959, 41962654, 31548777, 326685, 11406482
+};
+
+static void fe_mul(fe h, const fe f, const fe g)
+HOT_CODE;
+
+static int fe_width(int i)
+{
+    return 26 - (i & 1);
+}
+
+static void fe_frombytes(fe h, const uint8_t *s)
+{
+    uint64_t w[4];
+    int i, pos;
+
+    load_words(w, s);
+
+    for (i = 0, pos = 0; i < 10; pos += fe_width(i++))
+    {
+        uint64_t x = w[pos / 64] >> (pos % 64);
+
+        if (pos % 64 + fe_width(i) > 64)
+            x |= w[pos / 64 + 1] << (64 - pos % 64);
+
+        h[i] = (int32_t)(x & ((UINT64_C(1) << fe_width(i)) - 1));
+    }
+}
+
+/* Carries the limbs of h into f, using floor division so that every limb
+ * ends up in [0, 2^26), except f[1] which may be off by one. */
+static void fe_carry(fe f, const int64_t *t)
+{
+    int64_t h[10], c;
+    int i;
+
+    memcpy(h, t, sizeof(h));
+
+    c = h[0] >> 26; h[0] -= c * ((int64_t)1 << 26); h[1] += c;
+    c = h[1] >> 25; h[1] -= c * ((int64_t)1 << 25); h[2] += c;
+    c = h[2] >> 26; h[2] -= c * ((int64_t)1 << 26); h[3] += c;
+    c = h[3] >> 25; h[3] -= c * ((int64_t)1 << 25); h[4] += c;
+    c = h[4] >> 26; h[4] -= c * ((int64_t)1 << 26); h[5] += c;
+    c = h[5] >> 25; h[5] -= c * ((int64_t)1 << 25); h[6] += c;
+    c = h[6] >> 26; h[6] -= c * ((int64_t)1 << 26); h[7] += c;
+    c = h[7] >> 25; h[7] -= c * ((int64_t)1 << 25); h[8] += c;
+    c = h[8] >> 26; h[8] -= c * ((int64_t)1 << 26); h[9] += c;
+    c = h[9] >> 25; h[9] -= c * ((int64_t)1 << 25); h[0] += 19 * c;
+    c = h[0] >> 26; h[0] -= c * ((int64_t)1 << 26); h[1] += c;
+
+    for (i = 0; i < 10; ++i) f[i] = (int32_t)h[i];
+}
+
+static void fe_tobytes(uint8_t *s, const fe f)
+{
+    int64_t h[10], q;
+    uint64_t w[4] = {0};
+    int i, pos;
+
+    for (i = 0; i < 10; ++i) h[i] = f[i];
+
+    /* q is 1 if the value is at least p, and 0 otherwise, see ref10. */
+    q = (19 * h[9] + ((int64_t)1 << 24)) >> 25;
+    for (i = 0; i < 10; ++i) q = (h[i] + q) >> fe_width(i);
+
+    h[0] += 19 * q;
+
+    for (i = 0; i < 9; ++i)
+    {
+        int64_t c = h[i] >> fe_width(i);
+        h[i] -= c * ((int64_t)1 << fe_width(i));
+        h[i + 1] += c;
+    }
+
+    h[9] &= ((int64_t)1 << 25) - 1;
+
+    for (i = 0, pos = 0; i < 10; pos += fe_width(i++))
+    {
+        w[pos / 64] |= (uint64_t)h[i] << (pos % 64);
+
+        if (pos % 64 + fe_width(i) > 64)
+            w[pos / 64 + 1] |= (uint64_t)h[i] >> (64 - pos % 64);
+    }
+
+    store_words(s, w);
+}
+
+static void fe_add(fe h, const fe f, const fe g)
+{
+    int64_t t[10];
+    int i;
+
+    for (i = 0; i < 10; ++i) t[i] = (int64_t)f[i] + g[i];
+
+    fe_carry(h, t);
+}
+
+static void fe_sub(fe h, const fe f, const fe g)
+{
+    int64_t t[10];
+    int i;
+
+    for (i = 0; i < 10; ++i) t[i] = (int64_t)f[i] - g[i];
+
+    fe_carry(h, t);
+}
+
+/* Products of two odd limbs are doubled, as their positions add up to one
+ * bit more than their sum, and those past the top are folded in times 19. */
+void fe_mul(fe h, const fe x, const fe y)
+{
+    int64_t f[10], f2[10], g[10], g19[10], t[10];
+    int i;
+
+    for (i = 0; i < 10; ++i)
+    {
+        f[i] = x[i];
+        f2[i] = 2 * f[i];
+        g[i] = y[i];
+        g19[i] = 19 * g[i];
+    }
+
+    t[0] = f[0] * g[0] + f2[1] * g19[9] + f[2] * g19[8] + f2[3] * g19[7]
+           + f[4] * g19[6] + f2[5] * g19[5] + f[6] * g19[4] + f2[7] * g19[3]
+           + f[8] * g19[2] + f2[9] * g19[1];
+    t[1] = f[0] * g[1] + f[1] * g[0] + f[2] * g19[9] + f[3] * g19[8]
+           + f[4] * g19[7] + f[5] * g19[6] + f[6] * g19[5] + f[7] * g19[4]
+           + f[8] * g19[3] + f[9] * g19[2];
+    t[2] = f[0] * g[2] + f2[1] * g[1] + f[2] * g[0] + f2[3] * g19[9]
+           + f[4] * g19[8] + f2[5] * g19[7] + f[6] * g19[6] + f2[7] * g19[5]
+           + f[8] * g19[4] + f2[9] * g19[3];
+    t[3] = f[0] * g[3] + f[1] * g[2] + f[2] * g[1] + f[3] * g[0]
+           + f[4] * g19[9] + f[5] * g19[8] + f[6] * g19[7] + f[7] * g19[6]
+           + f[8] * g19[5] + f[9] * g19[4];
+    t[4] = f[0] * g[4] + f2[1] * g[3] + f[2] * g[2] + f2[3] * g[1]
+           + f[4] * g[0] + f2[5] * g19[9] + f[6] * g19[8] + f2[7] * g19[7]
+           + f[8] * g19[6] + f2[9] * g19[5];
+    t[5] = f[0] * g[5] + f[1] * g[4] + f[2] * g[3] + f[3] * g[2] + f[4] * g[1]
+           + f[5] * g[0] + f[6] * g19[9] + f[7] * g19[8] + f[8] * g19[7]
+           + f[9] * g19[6];
+    t[6] = f[0] * g[6] + f2[1] * g[5] + f[2] * g[4] + f2[3] * g[3]
+           + f[4] * g[2] + f2[5] * g[1] + f[6] * g[0] + f2[7] * g19[9]
+           + f[8] * g19[8] + f2[9] * g19[7];
+    t[7] = f[0] * g[7] + f[1] * g[6] + f[2] * g[5] + f[3] * g[4] + f[4] * g[3]
+           + f[5] * g[2] + f[6] * g[1] + f[7] * g[0] + f[8] * g19[9]
+           + f[9] * g19[8];
+    t[8] = f[0] * g[8] + f2[1] * g[7] + f[2] * g[6] + f2[3] * g[5]
+           + f[4] * g[4] + f2[5] * g[3] + f[6] * g[2] + f2[7] * g[1]
+           + f[8] * g[0] + f2[9] * g19[9];
+    t[9] = f[0] * g[9] + f[1] * g[8] + f[2] * g[7] + f[3] * g[6] + f[4] * g[5]
+           + f[5] * g[4] + f[6] * g[3] + f[7] * g[2] + f[8] * g[1]
+           + f[9] * g[0];
+
+    fe_carry(h, t);
+}
+
+static void fe_sq(fe h, const fe f)
+{
+    fe_mul(h, f, f);
+}
+
+static void fe_sq_times(fe h, const fe f, int n)
+{
+    fe_mul(h, f, f);
+    while (--n) fe_mul(h, h, h);
+}
+
+static void fe_cmov(fe f, const fe g, unsigned int b)
+{
+    int32_t mask = -(int32_t)b;
+    size_t t;
+
+    for (t = 0; t < 10; ++t) f[t] ^= mask & (f[t] ^ g[t]);
+}
+
+#endif
+
+static void fe_0(fe h)
+{
+    memset(h, 0, sizeof(fe));
+}
+
+static void fe_1(fe h)
+{
+    memset(h, 0, sizeof(fe));
+    h[0] = 1;
+}
+
+/* Returns 1 if f is zero (modulo p), and 0 otherwise. */
+static unsigned int fe_iszero(const fe f)
+{
+    unsigned int acc = 0;
+    uint8_t s[32];
+    size_t t;
+
+    fe_tobytes(s, f);
+    for (t = 0; t < 32; ++t) acc |= s[t];
+
+    return ((acc - 1) >> 8) & 1;
+}
+
+static void fe_neg(fe h, const fe f)
+{
+    fe zero;
+
+    fe_0(zero);
+    fe_sub(h, zero, f);
+}
+
+/* Computes z^(p - 2), with the same addition chain as crecip. */
+static void fe_invert(fe out, const fe z)
+{
+    fe z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t0, t1;
+
+    fe_sq(z2, z);
+    fe_sq_times(t0, z2, 2);
+    fe_mul(z9, t0, z);
+    fe_mul(z11, z9, z2);
+    fe_sq(t0, z11);
+    fe_mul(z2_5_0, t0, z9);
+
+    fe_sq_times(t0, z2_5_0, 5);
+    fe_mul(z2_10_0, t0, z2_5_0);
+    fe_sq_times(t0, z2_10_0, 10);
+    fe_mul(z2_20_0, t0, z2_10_0);
+    fe_sq_times(t0, z2_20_0, 20);
+    fe_mul(t1, t0, z2_20_0);
+    fe_sq_times(t0, t1, 10);
+    fe_mul(z2_50_0, t0, z2_10_0);
+    fe_sq_times(t0, z2_50_0, 50);
+    fe_mul(z2_100_0, t0, z2_50_0);
+    fe_sq_times(t0, z2_100_0, 100);
+    fe_mul(t1, t0, z2_100_0);
+    fe_sq_times(t0, t1, 50);
+    fe_mul(t1, t0, z2_50_0);
+    fe_sq_times(t0, t1, 5);
+    fe_mul(out, t0, z11);
+}
+
+/* Computes z^((p - 5) / 8) = z^(2^252 - 3), for square roots. */
+static void fe_pow22523(fe out, const fe z)
+{
+    fe z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t0, t1;
+
+    fe_sq(z2, z);
+    fe_sq_times(t0, z2, 2);
+    fe_mul(z9, t0, z);
+    fe_mul(z11, z9, z2);
+    fe_sq(t0, z11);
+    fe_mul(z2_5_0, t0, z9);
+
+    fe_sq_times(t0, z2_5_0, 5);
+    fe_mul(z2_10_0, t0, z2_5_0);
+    fe_sq_times(t0, z2_10_0, 10);
+    fe_mul(z2_20_0, t0, z2_10_0);
+    fe_sq_times(t0, z2_20_0, 20);
+    fe_mul(t1, t0, z2_20_0);
+    fe_sq_times(t0, t1, 10);
+    fe_mul(z2_50_0, t0, z2_10_0);
+    fe_sq_times(t0, z2_50_0, 50);
+    fe_mul(z2_100_0, t0, z2_50_0);
+    fe_sq_times(t0, z2_100_0, 100);
+    fe_mul(t1, t0, z2_100_0);
+    fe_sq_times(t0, t1, 50);
+    fe_mul(t1, t0, z2_50_0);
+    fe_sq_times(t0, t1, 2);
+    fe_mul(out, t0, z);
+}
+
+/* Returns the low bit of f (modulo p), which is its "sign" in encodings. */
+static unsigned int fe_isnegative(const fe f)
+{
+    uint8_t s[32];
+
+    fe_tobytes(s, f);
+
+    return s[0] & 1;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* Points, in the coordinate systems of ref10:
+ *
+ *   ge_p2      projective (X:Y:Z), with x = X/Z and y = Y/Z
+ *   ge_p3      extended (X:Y:Z:T), with also XY = ZT
+ *   ge_p1p1    completed ((X:Z),(Y:T)), with x = X/Z and y = Y/T
+ *   ge_precomp affine (y + x, y - x, 2dxy), for the table
+ *   ge_cached  (Y + X, Y - X, Z, 2dT), for additions of other points
+ */
+
+typedef struct { fe X, Y, Z; } ge_p2;
+typedef struct { fe X, Y, Z, T; } ge_p3;
+typedef struct { fe X, Y, Z, T; } ge_p1p1;
+typedef struct { fe yplusx, yminusx, xy2d; } ge_precomp;
+typedef struct { fe YplusX, YminusX, Z, T2d; } ge_cached;
+
+static void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q)
+HOT_CODE;
+static void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q)
+HOT_CODE;
+static void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p)
+HOT_CODE;
+static void ge_select(ge_precomp *t, int pos, signed char b)
+HOT_CODE;
+static void ge_scalarmult_base(ge_p3 *h, const uint8_t *a)
+HOT_CODE;
+
+/* The table of multiples of the base point B, where base[i][j] is
+ * (j + 1) 256^i B, for eight multiples per row, from which any multiple
+ * is the sum of 65 of them (one from each row, twice over, with negative
+ * ones obtained by swapping y + x and y - x and negating 2dxy), and of
+ * four doublings, so that the table is 33 rows of 8 entries of 3 field
+ * elements. The extra 33rd row covers scalars of 2^255 and more. */
+static const ge_precomp base[33][8] =
+{
+#if defined(HAS_UINT128)
+    { /* 256^0 B */
+        {{0x493c6f58c3b85, 0x0df7181c325f7, 0x0f50b0b3e4cb7,
+          0x5329385a44c32, 0x07cf9d3a33d4b},
+         {0x03905d740913e, 0x0ba2817d673a2, 0x23e2827f4e67c,
+          0x133d2e0c21a34, 0x44fd2f9298f81},
+         {0x11205877aaa68, 0x479955893d579, 0x50d66309b67a0,
+          0x2d42d0dbee5ee, 0x6f117b689f0c6}},
+        {{0x4e7fc933c71d7, 0x2cf41feb6b244, 0x7581c0a7d1a76,
+          0x7172d534d32f0, 0x590c063fa87d2},
+         {0x1a56042b4d5a8, 0x189cc159ed153, 0x5b8deaa3cae04,
+          0x2aaf04f11b5d8, 0x6bb595a669c92},
+         {0x2a8b3a59b7a5f, 0x3abb359ef087f, 0x4f5a8c4db05af,
+          0x5b9a807d04205, 0x701af5b13ea50}},
+        {{0x5b0a84cee9730, 0x61d10c97155e4, 0x4059cc8096a10,
+          0x47a608da8014f, 0x7a164e1b9a80f},
+         {0x11fe8a4fcd265, 0x7bcb8374faacc, 0x52f5af4ef4d4f,
+          0x5314098f98d10, 0x2ab91587555bd},
+         {0x6933f0dd0d889, 0x44386bb4c4295, 0x3cb6d3162508c,
+          0x26368b872a2c6, 0x5a2826af12b9b}},
+        {{0x351b98efc099f, 0x68fbfa4a7050e, 0x42a49959d971b,
+          0x393e51a469efd, 0x680e910321e58},
+         {0x6050a056818bf, 0x62acc1f5532bf, 0x28141ccc9fa25,
+          0x24d61f471e683, 0x27933f4c7445a},
+         {0x3fbe9c476ff09, 0x0af6b982e4b42, 0x0ad1251ba78e5,
+          0x715aeedee7c88, 0x7f9d0cbf63553}},
+        {{0x2bc4408a5bb33, 0x078ebdda05442, 0x2ffb112354123,
+          0x375ee8df5862d, 0x2945ccf146e20},
+         {0x182c3a447d6ba, 0x22964e536eff2, 0x192821f540053,
+          0x2f9f19e788e5c, 0x154a7e73eb1b5},
+         {0x3dbf1812a8285, 0x0fa17ba3f9797, 0x6f69cb49c3820,
+          0x34d5a0db3858d, 0x43aabe696b3bb}},
+        {{0x4eeeb77157131, 0x1201915f10741, 0x1669cda6c9c56,
+          0x45ec032db346d, 0x51e57bb6a2cc3},
+         {0x006b67b7d8ca4, 0x084fa44e72933, 0x1154ee55d6f8a,
+          0x4425d842e7390, 0x38b64c41ae417},
+         {0x4326702ea4b71, 0x06834376030b5, 0x0ef0512f9c380,
+          0x0f1a9f2512584, 0x10b8e91a9f0d6}},
+        {{0x25cd0944ea3bf, 0x75673b81a4d63, 0x150b925d1c0d4,
+          0x13f38d9294114, 0x461bea69283c9},
+         {0x72c9aaa3221b1, 0x267774474f74d, 0x064b0e9b28085,
+          0x3f04ef53b27c9, 0x1d6edd5d2e531},
+         {0x36dc801b8b3a2, 0x0e0a7d4935e30, 0x1deb7cecc0d7d,
+          0x053a94e20dd2c, 0x7a9fbb1c6a0f9}},
+        {{0x7596604dd3e8f, 0x6fc510e058b36, 0x3670c8db2cc0d,
+          0x297d899ce332f, 0x0915e76061bce},
+         {0x75dedf39234d9, 0x01c36ab1f3c54, 0x0f08fee58f5da,
+          0x0e19613a0d637, 0x3a9024a1320e0},
+         {0x1f5d9c9a2911a, 0x7117994fafcf8, 0x2d8a8cae28dc5,
+          0x74ab1b2090c87, 0x26907c5c2ecc4}}
+    },
+    { /* 256^1 B */
+        {{0x4dd0e632f9c1d, 0x2ced12622a5d9, 0x18de9614742da,
+          0x79ca96fdbb5d4, 0x6dd37d49a00ee},
+         {0x3635449aa515e, 0x3e178d0475dab, 0x50b4712a19712,
+          0x2dcc2860ff4ad, 0x30d76d6f03d31},
+         {0x444172106e4c7, 0x01251afed2d88, 0x534fc9bed4f5a,
+          0x5d85a39cf5234, 0x10c697112e864}},
+        {{0x62aa08358c805, 0x46f440848e194, 0x447b771a8f52b,
+          0x377ba3269d31d, 0x03bf9baf55080},
+         {0x3c4277dbe5fde, 0x5a335afd44c92, 0x0c1164099753e,
+          0x70487006fe423, 0x25e61cabed66f},
+         {0x3e128cc586604, 0x5968b2e8fc7e2, 0x049a3d5bd61cf,
+          0x116505b1ef6e6, 0x566d78634586e}},
+        {{0x54285c65a2fd0, 0x55e62ccf87420, 0x46bb961b19044,
+          0x1153405712039, 0x14fba5f34793b},
+         {0x7a49f9cc10834, 0x2b513788a22c6, 0x5ff4b6ef2395b,
+          0x2ec8e5af607bf, 0x33975bca5ecc3},
+         {0x746166985f7d4, 0x09939000ae79a, 0x5844c7964f97a,
+          0x13617e1f95b3d, 0x14829cea83fc5}},
+        {{0x70b2f4e71ecb8, 0x728148efc643c, 0x0753e03995b76,
+          0x5bf5fb2ab6767, 0x05fc3bc4535d7},
+         {0x37b8497dd95c2, 0x61549d6b4ffe8, 0x217a22db1d138,
+          0x0b9cf062eb09e, 0x2fd9c71e5f758},
+         {0x0b3ae52afdedd, 0x19da76619e497, 0x6fa0654d2558e,
+          0x78219d25e41d4, 0x373767475c651}},
+        {{0x095cb14246590, 0x002d82aa6ac68, 0x442f183bc4851,
+          0x6464f1c0a0644, 0x6bf5905730907},
+         {0x299fd40d1add9, 0x5f2de9a04e5f7, 0x7c0eebacc1c59,
+          0x4cca1b1f8290a, 0x1fbea56c3b18f},
+         {0x778f1e1415b8a, 0x6f75874efc1f4, 0x28a694019027f,
+          0x52b37a96bdc4d, 0x02521cf67a635}},
+        {{0x46720772f5ee4, 0x632c0f359d622, 0x2b2092ba3e252,
+          0x662257c112680, 0x001753d9f7cd6},
+         {0x7ee0b0a9d5294, 0x381fbeb4cca27, 0x7841f3a3e639d,
+          0x676ea30c3445f, 0x3fa00a7e71382},
+         {0x1232d963ddb34, 0x35692e70b078d, 0x247ca14777a1f,
+          0x6db556be8fcd0, 0x12b5fe2fa048e}},
+        {{0x37c26ad6f1e92, 0x46a0971227be5, 0x4722f0d2d9b4c,
+          0x3dc46204ee03a, 0x6f7e93c20796c},
+         {0x0fbc496fce34d, 0x575be6b7dae3e, 0x4a31585cee609,
+          0x037e9023930ff, 0x749b76f96fb12},
+         {0x2f604aea6ae05, 0x637dc939323eb, 0x3fdad9b048d47,
+          0x0a8b0d4045af7, 0x0fcec10f01e02}},
+        {{0x2d29dc4244e45, 0x6927b1bc147be, 0x0308534ac0839,
+          0x4853664033f41, 0x413779166feab},
+         {0x558a649fe1e44, 0x44635aeefcc89, 0x1ff434887f2ba,
+          0x0f981220e2d44, 0x4901aa7183c51},
+         {0x1b7548c1af8f0, 0x7848c53368116, 0x01b64e7383de9,
+          0x109fbb0587c8f, 0x41bb887b726d1}}
+    },
+    { /* 256^2 B */
+        {{0x34c597c6691ae, 0x7a150b6990fc4, 0x52beb9d922274,
+          0x70eed7164861a, 0x0a871e070c6a9},
+         {0x07d44744346be, 0x282b6a564a81d, 0x4ed80f875236b,
+          0x6fbbe1d450c50, 0x4eb728c12fcdb},
+         {0x1b5994bbc8989, 0x74b7ba84c0660, 0x75678f1cdaeb8,
+          0x23206b0d6f10c, 0x3ee7300f2685d}},
+        {{0x27947841e7518, 0x32c7388dae87f, 0x414add3971be9,
+          0x01850832f0ef1, 0x7d47c6a2cfb89},
+         {0x255e49e7dd6b7, 0x38c2163d59eba, 0x3861f2a005845,
+          0x2e11e4ccbaec9, 0x1381576297912},
+         {0x2d0148ef0d6e0, 0x3522a8de787fb, 0x2ee055e74f9d2,
+          0x64038f6310813, 0x148cf58d34c9e}},
+        {{0x72f7d9ae4756d, 0x7711e690ffc4a, 0x582a2355b0d16,
+          0x0dccfe885b6b4, 0x278febad4eaea},
+         {0x492f67934f027, 0x7ded0815528d4, 0x58461511a6612,
+          0x5ea2e50de1544, 0x3ff2fa1ebd5db},
+         {0x2681f8c933966, 0x3840521931635, 0x674f14a308652,
+          0x3bd9c88a94890, 0x4104dd02fe9c6}},
+        {{0x14e06db096ab8, 0x1219c89e6b024, 0x278abd486a2db,
+          0x240b292609520, 0x0165b5a48efca},
+         {0x2bf5e1124422a, 0x673146756ae56, 0x14ad99a87e830,
+          0x1eaca65b080fd, 0x2c863b00afaf5},
+         {0x0a474a0846a76, 0x099a5ef981e32, 0x2a8ae3c4bbfe6,
+          0x45c34af14832c, 0x591b67d9bffec}},
+        {{0x1b3719f18b55d, 0x754318c83d337, 0x27c17b7919797,
+          0x145b084089b61, 0x489b4f8670301},
+         {0x70d1c80b49bfa, 0x3d57e7d914625, 0x3c0722165e545,
+          0x5e5b93819e04f, 0x3de02ec7ca8f7},
+         {0x2102d3aeb92ef, 0x68c22d50c3a46, 0x42ea89385894e,
+          0x75f9ebf55f38c, 0x49f5fbba496cb}},
+        {{0x5628c1e9c572e, 0x598b108e822ab, 0x55d8fae29361a,
+          0x0adc8d1a97b28, 0x06a1a6c288675},
+         {0x49a108a5bcfd4, 0x6178c8e7d6612, 0x1f03473710375,
+          0x73a49614a6098, 0x5604a86dcbfa6},
+         {0x0d1d47c1764b6, 0x01c08316a2e51, 0x2b3db45c95045,
+          0x1634f818d300c, 0x20989e89fe274}},
+        {{0x4278b85eaec2e, 0x0ef59657be2ce, 0x72fd169588770,
+          0x2e9b205260b30, 0x730b9950f7059},
+         {0x777fd3a2dcc7f, 0x594a9fb124932, 0x01f8e80ca15f0,
+          0x714d13cec3269, 0x0403ed1d0ca67},
+         {0x32d35874ec552, 0x1f3048df1b929, 0x300d73b179b23,
+          0x6e67be5a37d0b, 0x5bd7454308303}},
+        {{0x4932115e7792a, 0x457b9bbb930b8, 0x68f5d8b193226,
+          0x4164e8f1ed456, 0x5bb7db123067f},
+         {0x2d19528b24cc2, 0x4ac66b8302ff3, 0x701c8d9fdad51,
+          0x6c1b35c5b3727, 0x133a78007380a},
+         {0x1f467c6ca62be, 0x2c4232a5dc12c, 0x7551dc013b087,
+          0x0690c11b03bcd, 0x740dca6d58f0e}}
+    },
+    { /* 256^3 B */
+        {{0x28c570478433c, 0x1d8502873a463, 0x7641e7eded49c,
+          0x1ecedd54cf571, 0x2c03f5256c2b0},
+         {0x0ee0752cfce4e, 0x660dd8116fbe9, 0x55167130fffeb,
+          0x1c682b885955c, 0x161d25fa963ea},
+         {0x718757b53a47d, 0x619e18b0f2f21, 0x5fbdfe4c1ec04,
+          0x5d798c81ebb92, 0x699468bdbd96b}},
+        {{0x53de66aa91948, 0x045f81a599b1b, 0x3f7a8bd214193,
+          0x71d4da412331a, 0x293e1c4e6c4a2},
+         {0x72f46f4dafecf, 0x2948ffadef7a3, 0x11ecdfdf3bc04,
+          0x3c2e98ffeed25, 0x525219a473905},
+         {0x6134b925112e1, 0x6bb942bb406ed, 0x070c445c0dde2,
+          0x411d822c4d7a3, 0x5b605c447f032}},
+        {{0x1fec6f0e7f04c, 0x3cebc692c477d, 0x077986a19a95e,
+          0x6eaaaa1778b0f, 0x2f12fef4cc5ab},
+         {0x5805920c47c89, 0x1924771f9972c, 0x38bbddf9fc040,
+          0x1f7000092b281, 0x24a76dcea8aeb},
+         {0x522b2dfc0c740, 0x7e8193480e148, 0x33fd9a04341b9,
+          0x3c863678a20bc, 0x5e607b2518a43}},
+        {{0x4431ca596cf14, 0x015da7c801405, 0x03c9b6f8f10b5,
+          0x0346922934017, 0x201f33139e457},
+         {0x31d8f6cdf1818, 0x1f86c4b144b16, 0x39875b8d73e9d,
+          0x2fbf0d9ffa7b3, 0x5067acab6ccdd},
+         {0x27f6b08039d51, 0x4802f8000dfaa, 0x09692a062c525,
+          0x1baea91075817, 0x397cba8862460}},
+        {{0x5c3fbc81379e7, 0x41bbc255e2f02, 0x6a3f756998650,
+          0x1297fd4e07c42, 0x771b4022c1e1c},
+         {0x13093f05959b2, 0x1bd352f2ec618, 0x075789b88ea86,
+          0x61d1117ea48b9, 0x2339d320766e6},
+         {0x5d986513a2fa7, 0x63f3a99e11b0f, 0x28a0ecfd6b26d,
+          0x53b6835e18d8f, 0x331a189219971}},
+        {{0x12f3a9d7572af, 0x10d00e953c4ca, 0x603df116f2f8a,
+          0x33dc276e0e088, 0x1ac9619ff649a},
+         {0x66f45fb4f80c6, 0x3cc38eeb9fea2, 0x107647270db1f,
+          0x710f1ea740dc8, 0x31167c6b83bdf},
+         {0x33842524b1068, 0x77dd39d30fe45, 0x189432141a0d0,
+          0x088fe4eb8c225, 0x612436341f08b}},
+        {{0x349e31a2d2638, 0x0137a7fa6b16c, 0x681ae92777edc,
+          0x222bfc5f8dc51, 0x1522aa3178d90},
+         {0x541db874e898d, 0x62d80fb841b33, 0x03e6ef027fa97,
+          0x7a03c9e9633e8, 0x46ebe2309e5ef},
+         {0x02f5369614938, 0x356e5ada20587, 0x11bc89f6bf902,
+          0x036746419c8db, 0x45fe70f505243}},
+        {{0x24920c8951491, 0x107ec61944c5e, 0x72752e017c01f,
+          0x122b7dda2e97a, 0x16619f6db57a2},
+         {0x075a6960c0b8c, 0x6dde1c5e41b49, 0x42e3f516da341,
+          0x16a03fda8e79e, 0x428d1623a0e39},
+         {0x74a4401a308fd, 0x06ed4b9558109, 0x746f1f6a08867,
+          0x4636f5c6f2321, 0x1d81592d60bd3}}
+    },
+    { /* 256^4 B */
+        {{0x5b69f7b85c5e8, 0x17a2d175650ec, 0x4cc3e6dbfc19e,
+          0x73e1d3873be0e, 0x3a5f6d51b0af8},
+         {0x68756a60dac5f, 0x55d757b8aec26, 0x3383df45f80bd,
+          0x6783f8c9f96a6, 0x20234a7789ecd},
+         {0x20db67178b252, 0x73aa3da2c0eda, 0x79045c01c70d3,
+          0x1b37b15251059, 0x7cd682353cffe}},
+        {{0x5cd6068acf4f3, 0x3079afc7a74cc, 0x58097650b64b4,
+          0x47fabac9c4e99, 0x3ef0253b2b2cd},
+         {0x1a45bd887fab6, 0x65748076dc17c, 0x5b98000aa11a8,
+          0x4a1ecc9080974, 0x2838c8863bdc0},
+         {0x3b0cf4a465030, 0x022b8aef57a2d, 0x2ad0677e925ad,
+          0x4094167d7457a, 0x21dcb8a606a82}},
+        {{0x500fabe7731ba, 0x7cc53c3113351, 0x7cf65fe080d81,
+          0x3c5d966011ba1, 0x5d840dbf6c6f6},
+         {0x004468c9d9fc8, 0x5da8554796b8c, 0x3b8be70950025,
+          0x6d5892da6a609, 0x0bc3d08194a31},
+         {0x6380d309fe18b, 0x4d73c2cb8ee0d, 0x6b882adbac0b6,
+          0x36eabdddd4cbe, 0x3a4276232ac19}},
+        {{0x0c172db447ecb, 0x3f8c505b7a77f, 0x6a857f97f3f10,
+          0x4fcc0567fe03a, 0x0770c9e824e1a},
+         {0x2432c8a7084fa, 0x47bf73ca8a968, 0x1639176262867,
+          0x5e8df4f8010ce, 0x1ff177cea16de},
+         {0x1d99a45b5b5fd, 0x523674f2499ec, 0x0f8fa26182613,
+          0x58f7398048c98, 0x39f264fd41500}},
+        {{0x34aabfe097be1, 0x43bfc03253a33, 0x29bc7fe91b7f3,
+          0x0a761e4844a16, 0x65c621272c35f},
+         {0x53417dbe7e29c, 0x54573827394f5, 0x565eea6f650dd,
+          0x42050748dc749, 0x1712d73468889},
+         {0x389f8ce3193dd, 0x2d424b8177ce5, 0x073fa0d3440cd,
+          0x139020cd49e97, 0x22f9800ab19ce}},
+        {{0x29fdd9a6efdac, 0x7c694a9282840, 0x6f7cdeee44b3a,
+          0x55a3207b25cc3, 0x4171a4d38598c},
+         {0x2368a3e9ef8cb, 0x454aa08e2ac0b, 0x490923f8fa700,
+          0x372aa9ea4582f, 0x13f416cd64762},
+         {0x758aa99c94c8c, 0x5f6001700ff44, 0x7694e488c01bd,
+          0x0d5fde948eed6, 0x508214fa574bd}},
+        {{0x215bb53d003d6, 0x1179e792ca8c3, 0x1a0e96ac840a2,
+          0x22393e2bb3ab6, 0x3a7758a4c86cb},
+         {0x269153ed6fe4b, 0x72a23aef89840, 0x052be5299699c,
+          0x3a5e5ef132316, 0x22f960ec6faba},
+         {0x111f693ae5076, 0x3e3bfaa94ca90, 0x445799476b887,
+          0x24a0912464879, 0x5d9fd15f8de7f}},
+        {{0x44d2aeed7521e, 0x50865d2c2a7e4, 0x2705b5238ea40,
+          0x46c70b25d3b97, 0x3bc187fa47eb9},
+         {0x408d36d63727f, 0x5faf8f6a66062, 0x2bb892da8de6b,
+          0x769d4f0c7e2e6, 0x332f35914f8fb},
+         {0x70115ea86c20c, 0x16d88da24ada8, 0x1980622662adf,
+          0x501ebbc195a9d, 0x450d81ce906fb}}
+    },
+    { /* 256^5 B */
+        {{0x4d8961cae743f, 0x6bdc38c7dba0e, 0x7d3b4a7e1b463,
+          0x0844bdee2adf3, 0x4cbad279663ab},
+         {0x3b6a1a6205275, 0x2e82791d06dcf, 0x23d72caa93c87,
+          0x5f0b7ab68aaf4, 0x2de25d4ba6345},
+         {0x19024a0d71fcd, 0x15f65115f101a, 0x4e99067149708,
+          0x119d8d1cba5af, 0x7d7fbcefe2007}},
+        {{0x45dc5f3c29094, 0x3455220b579af, 0x070c1631e068a,
+          0x26bc0630e9b21, 0x4f9cd196dcd8d},
+         {0x71e6a266b2801, 0x09aae73e2df5d, 0x40dd8b219b1a3,
+          0x546fb4517de0d, 0x5975435e87b75},
+         {0x297d86a7b3768, 0x4835a2f4c6332, 0x070305f434160,
+          0x183dd014e56ae, 0x7ccdd084387a0}},
+        {{0x484186760cc93, 0x7435665533361, 0x02f686336b801,
+          0x5225446f64331, 0x3593ca848190c},
+         {0x6422c6d260417, 0x212904817bb94, 0x5a319deb854f5,
+          0x7a9d4e060da7d, 0x428bd0ed61d0c},
+         {0x3189a5e849aa7, 0x6acbb1f59b242, 0x7f6ef4753630c,
+          0x1f346292a2da9, 0x27398308da2d6}},
+        {{0x10e4c0a702453, 0x4daafa37bd734, 0x49f6bdc3e8961,
+          0x1feffdcecdae6, 0x572c2945492c3},
+         {0x38d28435ed413, 0x4064f19992858, 0x7680fbef543cd,
+          0x1aadd83d58d3c, 0x269597aebe8c3},
+         {0x7c745d6cd30be, 0x27c7755df78ef, 0x1776833937fa3,
+          0x5405116441855, 0x7f985498c05bc}},
+        {{0x615520fbf6363, 0x0b9e9bf74da6a, 0x4fe8308201169,
+          0x173f76127de43, 0x30f2653cd69b1},
+         {0x1ce889f0be117, 0x36f6a94510709, 0x7f248720016b4,
+          0x1821ed1e1cf91, 0x76c2ec470a31f},
+         {0x0c938aac10c85, 0x41b64ed797141, 0x1beb1c1185e6d,
+          0x1ed5490600f07, 0x2f1273f159647}},
+        {{0x08bd755a70bc0, 0x49e3a885ce609, 0x16585881b5ad6,
+          0x3c27568d34f5e, 0x38ac1997edc5f},
+         {0x1fc7c8ae01e11, 0x2094d5573e8e7, 0x5ca3cbbf549d2,
+          0x4f920ecc54143, 0x5d9e572ad85b6},
+         {0x6b517a751b13b, 0x0cfd370b180cc, 0x5377925d1f41a,
+          0x34e56566008a2, 0x22dfcd9cbfe9e}},
+        {{0x459b4103be0a1, 0x59a4b3f2d2add, 0x7d734c8bb8eeb,
+          0x2393cbe594a09, 0x0fe9877824cde},
+         {0x3d2e0c30d0cd9, 0x3f597686671bb, 0x0aa587eb63999,
+          0x0e3c7b592c619, 0x6b2916c05448c},
+         {0x334d10aba913b, 0x045cdb581cfdb, 0x5e3e0553a8f36,
+          0x50bb3041effb2, 0x4c303f307ff00}},
+        {{0x403580dd94500, 0x48df77d92653f, 0x38a9fe3b349ea,
+          0x0ea89850aafe1, 0x416b151ab706a},
+         {0x23bd617b28c85, 0x6e72ee77d5a61, 0x1a972ff174dde,
+          0x3e2636373c60f, 0x0d61b8f78b2ab},
+         {0x0d7efe9c136b0, 0x1ab1c89640ad5, 0x55f82aef41f97,
+          0x46957f317ed0d, 0x191a2af74277e}}
+    },
+    { /* 256^6 B */
+        {{0x62b434f460efb, 0x294c6c0fad3fc, 0x68368937b4c0f,
+          0x5c9f82910875b, 0x237e7dbe00545},
+         {0x6f74bc53c1431, 0x1c40e5dbbd9c2, 0x6c8fb9cae5c97,
+          0x4845c5ce1b7da, 0x7e2e0e450b5cc},
+         {0x575ed6701b430, 0x4d3e17fa20026, 0x791fc888c4253,
+          0x2f1ba99078ac1, 0x71afa699b1115}},
+        {{0x23c1c473b50d6, 0x3e7671de21d48, 0x326fa5547a1e8,
+          0x50e4dc25fafd9, 0x00731fbc78f89},
+         {0x66f9b3953b61d, 0x555f4283cccb9, 0x7dd67fb1960e7,
+          0x14707a1affed4, 0x021142e9c2b1c},
+         {0x0c71848f81880, 0x44bd9d8233c86, 0x6e8578efe5830,
+          0x4045b6d7041b5, 0x4c4d6f3347e15}},
+        {{0x4ddfc988f1970, 0x4f6173ea365e1, 0x645daf9ae4588,
+          0x7d43763db623b, 0x38bf9500a88f9},
+         {0x7eccfc17d1fc9, 0x4ca280782831e, 0x7b8337db1d7d6,
+          0x5116def3895fb, 0x193fddaaa7e47},
+         {0x2c93c37e8876f, 0x3431a28c583fa, 0x49049da8bd879,
+          0x4b4a8407ac11c, 0x6a6fb99ebf0d4}},
+        {{0x122b5b6e423c6, 0x21e50dff1ddd6, 0x73d76324e75c0,
+          0x588485495418e, 0x136fda9f42c5e},
+         {0x6c1bb560855eb, 0x71f127e13ad48, 0x5c6b304905aec,
+          0x3756b8e889bc7, 0x75f76914a3189},
+         {0x4dfb1a305bdd1, 0x3b3ff05811f29, 0x6ed62283cd92e,
+          0x65d1543ec52e1, 0x022183510be8d}},
+        {{0x2710143307a7f, 0x3d88fb48bf3ab, 0x249eb4ec18f7a,
+          0x136115dff295f, 0x1387c441fd404},
+         {0x766385ead2d14, 0x0194f8b06095e, 0x08478f6823b62,
+          0x6018689d37308, 0x6a071ce17b806},
+         {0x3c3d187978af8, 0x7afe1c88276ba, 0x51df281c8ad68,
+          0x64906bda4245d, 0x3171b26aaf1ed}},
+        {{0x5b7d8b28a47d1, 0x2c2ee149e34c1, 0x776f5629afc53,
+          0x1f4ea50fc49a9, 0x6c514a6334424},
+         {0x7319097564ca8, 0x1844ebc233525, 0x21d4543fdeee1,
+          0x1ad27aaff1bd2, 0x221fd4873cf08},
+         {0x2204f3a156341, 0x537414065a464, 0x43c0c3bedcf83,
+          0x5557e706ea620, 0x48daa596fb924}},
+        {{0x61d5dc84c9793, 0x47de83040c29e, 0x189deb26507e7,
+          0x4d4e6fadc479a, 0x58c837fa0e8a7},
+         {0x28e665ca59cc7, 0x165c715940dd9, 0x0785f3aa11c95,
+          0x57b98d7e38469, 0x676dd6fccad84},
+         {0x1688596fc9058, 0x66f6ad403619f, 0x4d759a87772ef,
+          0x7856e6173bea4, 0x1c4f73f2c6a57}},
+        {{0x6706efc7c3484, 0x6987839ec366d, 0x0731f95cf7f26,
+          0x3ae758ebce4bc, 0x70459adb7daf6},
+         {0x24fbd305fa0bb, 0x40a98cc75a1cf, 0x78ce1220a7533,
+          0x6217a10e1c197, 0x795ac80d1bf64},
+         {0x1db4991b42bb3, 0x469605b994372, 0x631e3715c9a58,
+          0x7e9cfefcf728f, 0x5fe162848ce21}}
+    },
+    { /* 256^7 B */
+        {{0x1852d5d7cb208, 0x60d0fbe5ce50f, 0x5a1e246e37b75,
+          0x51aee05ffd590, 0x2b44c043677da},
+         {0x1214fe194961a, 0x0e1ae39a9e9cb, 0x543c8b526f9f7,
+          0x119498067e91d, 0x4789d446fc917},
+         {0x487ab074eb78e, 0x1d33b5e8ce343, 0x13e419feb1b46,
+          0x2721f565de6a4, 0x60c52eef2bb9a}},
+        {{0x3c5c27cae6d11, 0x36a9491956e05, 0x124bac9131da6,
+          0x3b6f7de202b5d, 0x70d77248d9b66},
+         {0x589bc3bfd8bf1, 0x6f93e6aa3416b, 0x4c0a3d6c1ae48,
+          0x55587260b586a, 0x10bc9c312ccfc},
+         {0x2e84b3ec2a05b, 0x69da2f03c1551, 0x23a174661a67b,
+          0x209bca289f238, 0x63755bd3a976f}},
+        {{0x7101897f1acb7, 0x3d82cb77b07b8, 0x684083d7769f5,
+          0x52b28472dce07, 0x2763751737c52},
+         {0x7a03e2ad10853, 0x213dcc6ad36ab, 0x1a6e240d5bdd6,
+          0x7c24ffcf8fedf, 0x0d8cc1c48bc16},
+         {0x402d36eb419a9, 0x7cef68c14a052, 0x0f1255bc2d139,
+          0x373e7d431186a, 0x70c2dd8a7ad16}},
+        {{0x4967db8ed7e13, 0x15aeed02f523a, 0x6149591d094bc,
+          0x672f204c17006, 0x32b8613816a53},
+         {0x194509f6fec0e, 0x528d8ca31acac, 0x7826d73b8b9fa,
+          0x24acb99e0f9b3, 0x2e0fac6363948},
+         {0x7f7bee448cd64, 0x4e10f10da0f3c, 0x3936cb9ab20e9,
+          0x7a0fc4fea6cd0, 0x4179215c735a4}},
+        {{0x633b9286bcd34, 0x6cab3badb9c95, 0x74e387edfbdfa,
+          0x14313c58a0fd9, 0x31fa85662241c},
+         {0x094e7d7dced2a, 0x068fa738e118e, 0x41b640a5fee2b,
+          0x6bb709df019d4, 0x700344a30cd99},
+         {0x26c422e3622f4, 0x0f3066a05b5f0, 0x4e2448f0480a6,
+          0x244cde0dbf095, 0x24bb2312a9952}},
+        {{0x00c2af5f85c6b, 0x0609f4cf2883f, 0x6e86eb5a1ca13,
+          0x68b44a2efccd1, 0x0d1d2af9ffeb5},
+         {0x0ed1732de67c3, 0x308c369291635, 0x33ef348f2d250,
+          0x004475ea1a1bb, 0x0fee3e871e188},
+         {0x28aa132621edf, 0x42b244caf353b, 0x66b064cc2e08a,
+          0x6bb20020cbdd3, 0x16acd79718531}},
+        {{0x1c6c57887b6ad, 0x5abf21fd7592b, 0x50bd41253867a,
+          0x3800b71273151, 0x164ed34b18161},
+         {0x772af2d9b1d3d, 0x6d486448b4e5b, 0x2ce58dd8d18a8,
+          0x1849f67503c8b, 0x123e0ef6b9302},
+         {0x6d94c192fe69a, 0x5475222a2690f, 0x693789d86b8b3,
+          0x1f5c3bdfb69dc, 0x78da0fc61073f}},
+        {{0x780f1680c3a94, 0x2a35d3cfcd453, 0x005e5cdc7ddf8,
+          0x6ee888078ac24, 0x054aa4b316b38},
+         {0x15d28e52bc66a, 0x30e1e0351cb7e, 0x30a2f74b11f8c,
+          0x39d120cd7de03, 0x2d25deeb256b1},
+         {0x0468d19267cb8, 0x38cdca9b5fbf9, 0x1bbb05c2ca1e2,
+          0x3b015758e9533, 0x134610a6ab7da}}
+    },
+    { /* 256^8 B */
+        {{0x265e777d1f515, 0x0f1f54c1e39a5, 0x2f01b95522646,
+          0x4fdd8db9dde6d, 0x654878cba97cc},
+         {0x38ec78df6b0fe, 0x13caebea36a22, 0x5ebc6e54e5f6a,
+          0x32804903d0eb8, 0x2102fdba2b20d},
+         {0x6e405055ce6a1, 0x5024a35a532d3, 0x1f69054daf29d,
+          0x15d1d0d7a8bd5, 0x0ad725db29ecb}},
+        {{0x7bc0c9b056f85, 0x51cfebffaffd8, 0x44abbe94df549,
+          0x7ecbbd7e33121, 0x4f675f5302399},
+         {0x267b1834e2457, 0x6ae19c378bb88, 0x7457b5ed9d512,
+          0x3280d783d05fb, 0x4aefcffb71a03},
+         {0x536360415171e, 0x2313309077865, 0x251444334afbc,
+          0x2b0c3853756e8, 0x0bccbb72a2a86}},
+        {{0x55e4c50fe1296, 0x05fdd13efc30d, 0x1c0c6c380e5ee,
+          0x3e11de3fb62a8, 0x6678fd69108f3},
+         {0x6962feab1a9c8, 0x6aca28fb9a30b, 0x56db7ca1b9f98,
+          0x39f58497018dd, 0x4024f0ab59d6b},
+         {0x6fa31636863c2, 0x10ae5a67e42b0, 0x27abbf01fda31,
+          0x380a7b9e64fbc, 0x2d42e2108ead4}},
+        {{0x17b0d0f537593, 0x16263c0c9842e, 0x4ab827e4539a4,
+          0x6370ddb43d73a, 0x420bf3a79b423},
+         {0x5131594dfd29b, 0x3a627e98d52fe, 0x1154041855661,
+          0x19175d09f8384, 0x676b2608b8d2d},
+         {0x0ba651c5b2b47, 0x5862363701027, 0x0c4d6c219c6db,
+          0x0f03dff8658de, 0x745d2ffa9c0cf}},
+        {{0x6df5721d34e6a, 0x4f32f767a0c06, 0x1d5abeac76e20,
+          0x41ce9e104e1e4, 0x06e15be54c1dc},
+         {0x25a1e2bc9c8bd, 0x104c8f3b037ea, 0x405576fa96c98,
+          0x2e86a88e3876f, 0x1ae23ceb960cf},
+         {0x25d871932994a, 0x6b9d63b560b6e, 0x2df2814c8d472,
+          0x0fbbee20aa4ed, 0x58ded861278ec}},
+        {{0x35ba8b6c2c9a8, 0x1dea58b3185bf, 0x4b455cd23bbbe,
+          0x5ec19c04883f8, 0x08ba696b531d5},
+         {0x73793f266c55c, 0x0b988a9c93b02, 0x09b0ea32325db,
+          0x37cae71c17c5e, 0x2ff39de85485f},
+         {0x53eeec3efc57a, 0x2fa9fe9022efd, 0x699c72c138154,
+          0x72a751ebd1ff8, 0x120633b4947cf}},
+        {{0x531474912100a, 0x5afcdf7c0d057, 0x7a9e71b788ded,
+          0x5ef708f3b0c88, 0x07433be3cb393},
+         {0x4987891610042, 0x79d9d7f5d0172, 0x3c293013b9ec4,
+          0x0c2b85f39caca, 0x35d30a99b4d59},
+         {0x144c05ce997f4, 0x4960b8a347fef, 0x1da11f15d74f7,
+          0x54fac19c0fead, 0x2d873ede7af6d}},
+        {{0x202e14e5df981, 0x2ea02bc3eb54c, 0x38875b2883564,
+          0x1298c513ae9dd, 0x0543618a01600},
+         {0x2316443373409, 0x5de95503b22af, 0x699201beae2df,
+          0x3db5849ff737a, 0x2e773654707fa},
+         {0x2bdf4974c23c1, 0x4b3b9c8d261bd, 0x26ae8b2a9bc28,
+          0x3068210165c51, 0x4b1443362d079}}
+    },
+    { /* 256^9 B */
+        {{0x454e91c529ccb, 0x24c98c6bf72cf, 0x0486594c3d89a,
+          0x7ae13a3d7fa3c, 0x17038418eaf66},
+         {0x4b7c7b66e1f7a, 0x4bea185efd998, 0x4fabc711055f8,
+          0x1fb9f7836fe38, 0x582f446752da6},
+         {0x17bd320324ce4, 0x51489117898c6, 0x1684d92a0410b,
+          0x6e4d90f78c5a7, 0x0c2a1c4bcda28}},
+        {{0x4814869bd6945, 0x7b7c391a45db8, 0x57316ac35b641,
+          0x641e31de9096a, 0x5a6a9b30a314d},
+         {0x5c7d06f1f0447, 0x7db70f80b3a49, 0x6cb4a3ec89a78,
+          0x43be8ad81397d, 0x7c558bd1c6f64},
+         {0x41524d396463d, 0x1586b449e1a1d, 0x2f17e904aed8a,
+          0x7e1d2861d3c8e, 0x0404a5ca0afba}},
+        {{0x49e1b2a416fd1, 0x51c6a0b316c57, 0x575a59ed71bdc,
+          0x74c021a1fec1e, 0x39527516e7f8e},
+         {0x740070aa743d6, 0x16b64cbdd1183, 0x23f4b7b32eb43,
+          0x319aba58235b3, 0x46395bfdcadd9},
+         {0x7db2d1a5d9a9c, 0x79a200b85422f, 0x355bfaa71dd16,
+          0x00b77ea5f78aa, 0x76579a29e822d}},
+        {{0x4b51352b434f2, 0x1327bd01c2667, 0x434d73b60c8a1,
+          0x3e0daa89443ba, 0x02c514bb2a277},
+         {0x68e7e49c02a17, 0x45795346fe8b6, 0x089306c8f3546,
+          0x6d89f6b2f88f6, 0x43a384dc9e05b},
+         {0x3d5da8bf1b645, 0x7ded6a96a6d09, 0x6c3494fee2f4d,
+          0x02c989c8b6bd4, 0x1160920961548}},
+        {{0x05616369b4dcd, 0x4ecab86ac6f47, 0x3c60085d700b2,
+          0x0213ee10dfcea, 0x2f637d7491e6e},
+         {0x5166929dacfaa, 0x190826b31f689, 0x4f55567694a7d,
+          0x705f4f7b1e522, 0x351e125bc5698},
+         {0x49b461af67bbe, 0x75915712c3a96, 0x69a67ef580c0d,
+          0x54d38ef70cffc, 0x7f182d06e7ce2}},
+        {{0x54b728e217522, 0x69a90971b0128, 0x51a40f2a963a3,
+          0x10be9ac12a6bf, 0x44acc043241c5},
+         {0x48e64ab0168ec, 0x2a2bdb8a86f4f, 0x7343b6b2d6929,
+          0x1d804aa8ce9a3, 0x67d4ac8c343e9},
+         {0x56bbb4f7a5777, 0x29230627c238f, 0x5ad1a122cd7fb,
+          0x0dea56e50e364, 0x556d1c8312ad7}},
+        {{0x06756b11be821, 0x462147e7bb03e, 0x26519743ebfe0,
+          0x782fc59682ab5, 0x097abe38cc8c7},
+         {0x740e30c8d3982, 0x7c2b47f4682fd, 0x5cd91b8c7dc1c,
+          0x77fa790f9e583, 0x746c6c6d1d824},
+         {0x1c9877ea52da4, 0x2b37b83a86189, 0x733af49310da5,
+          0x25e81161c04fb, 0x577e14a34bee8}},
+        {{0x6cebebd4dd72b, 0x340c1e442329f, 0x32347ffd1a93f,
+          0x14a89252cbbe0, 0x705304b8fb009},
+         {0x268ac61a73b0a, 0x206f234bebe1c, 0x5b403a7cbebe8,
+          0x7a160f09f4135, 0x60fa7ee96fd78},
+         {0x51d354d296ec6, 0x7cbf5a63b16c7, 0x2f50bb3cf0c14,
+          0x1feb385cac65a, 0x21398e0ca1635}}
+    },
+    { /* 256^10 B */
+        {{0x0aaf9b4b75601, 0x26b91b5ae44f3, 0x6de808d7ab1c8,
+          0x6a769675530b0, 0x1bbfb284e98f7},
+         {0x5058a382b33f3, 0x175a91816913e, 0x4f6cdb96b8ae8,
+          0x17347c9da81d2, 0x5aa3ed9d95a23},
+         {0x777e9c7d96561, 0x28e58f006ccac, 0x541bbbb2cac49,
+          0x3e63282994cec, 0x4a07e14e5e895}},
+        {{0x358cdc477a49b, 0x3cc88fe02e481, 0x721aab7f4e36b,
+          0x0408cc9469953, 0x50af7aed84afa},
+         {0x412cb980df999, 0x5e78dd8ee29dc, 0x171dff68c575d,
+          0x2015dd2f6ef49, 0x3f0bac391d313},
+         {0x7de0115f65be5, 0x4242c21364dc9, 0x6b75b64a66098,
+          0x0033c0102c085, 0x1921a316baebd}},
+        {{0x2ad9ad9f3c18b, 0x5ec1638339aeb, 0x5703b6559a83b,
+          0x3fa9f4d05d612, 0x7b049deca062c},
+         {0x22f7edfb870fc, 0x569eed677b128, 0x30937dcb0a5af,
+          0x758039c78ea1b, 0x6458df41e273a},
+         {0x3e37a35444483, 0x661fdb7d27b99, 0x317761dd621e4,
+          0x7323c30026189, 0x6093dccbc2950}},
+        {{0x6eebe6084034b, 0x6cf01f70a8d7b, 0x0b41a54c6670a,
+          0x6c84b99bb55db, 0x6e3180c98b647},
+         {0x39a8585e0706d, 0x3167ce72663fe, 0x63d14ecdb4297,
+          0x4be21dcf970b8, 0x57d1ea084827a},
+         {0x2b6e7a128b071, 0x5b27511755dcf, 0x08584c2930565,
+          0x68c7bda6f4159, 0x363e999ddd97b}},
+        {{0x048dce24baec6, 0x2b75795ec05e3, 0x3bfa4c5da6dc9,
+          0x1aac8659e371e, 0x231f979bc6f9b},
+         {0x043c135ee1fc4, 0x2a11c9919f2d5, 0x6334cc25dbacd,
+          0x295da17b400da, 0x48ee9b78693a0},
+         {0x1de4bcc2af3c6, 0x61fc411a3eb86, 0x53ed19ac12ec0,
+          0x209dbc6b804e0, 0x079bfa9b08792}},
+        {{0x1ed80a2d54245, 0x70efec72a5e79, 0x42151d42a822d,
+          0x1b5ebb6d631e8, 0x1ef4fb1594706},
+         {0x03a51da300df4, 0x467b52b561c72, 0x4d5920210e590,
+          0x0ca769e789685, 0x038c77f684817},
+         {0x65ee65b167bec, 0x052da19b850a9, 0x0408665656429,
+          0x7ab39596f9a4c, 0x575ee92a4a0bf}},
+        {{0x6bc450aa4d801, 0x4f4a6773b0ba8, 0x6241b0b0ebc48,
+          0x40d9c4f1d9315, 0x200a1e7e382f5},
+         {0x080908a182fcf, 0x0532913b7ba98, 0x3dccf78c385c3,
+          0x68002dd5eaba9, 0x43d4e7112cd3f},
+         {0x5b967eaf93ac5, 0x360acca580a31, 0x1c65fd5c6f262,
+          0x71c7f15c2ecab, 0x050eca52651e4}},
+        {{0x4397660e668ea, 0x7c2a75692f2f5, 0x3b29e7e6c66ef,
+          0x72ba658bcda9a, 0x6151c09fa131a},
+         {0x31ade453f0c9c, 0x3dfee07737868, 0x611ecf7a7d411,
+          0x2637e6cbd64f6, 0x4b0ee6c21c58f},
+         {0x55c0dfdf05d96, 0x405569dcf475e, 0x05c5c277498bb,
+          0x18588d95dc389, 0x1fef24fa800f0}}
+    },
+    { /* 256^11 B */
+        {{0x2aff530976b86, 0x0d85a48c0845a, 0x796eb963642e0,
+          0x60bee50c4b626, 0x28005fe6c8340},
+         {0x653fb1aa73196, 0x607faec8306fa, 0x4e85ec83e5254,
+          0x09f56900584fd, 0x544d49292fc86},
+         {0x7ba9f34528688, 0x284a20fb42d5d, 0x3652cd9706ffe,
+          0x6fd7baddde6b3, 0x72e472930f316}},
+        {{0x3f635d32a7627, 0x0cbecacde00fe, 0x3411141eaa936,
+          0x21c1e42f3cb94, 0x1fee7f000fe06},
+         {0x5208c9781084f, 0x16468a1dc24d2, 0x7bf780ac540a8,
+          0x1a67eced75301, 0x5a9d2e8c2733a},
+         {0x305da03dbf7e5, 0x1228699b7aeca, 0x12a23b2936bc9,
+          0x2a1bda56ae6e9, 0x00f94051ee040}},
+        {{0x793bb07af9753, 0x1e7b6ecd4fafd, 0x02c7b1560fb43,
+          0x2296734cc5fb7, 0x47b7ffd25dd40},
+         {0x56b23c3d330b2, 0x37608e360d1a6, 0x10ae0f3c8722e,
+          0x086d9b618b637, 0x07d79c7e8beab},
+         {0x3fb9cbc08dd12, 0x75c3dd85370ff, 0x47f06fe2819ac,
+          0x5db06ab9215ed, 0x1c3520a35ea64}},
+        {{0x06f40216bc059, 0x3a2579b0fd9b5, 0x71c26407eec8c,
+          0x72ada4ab54f0b, 0x38750c3b66d12},
+         {0x253a6bccba34a, 0x427070433701a, 0x20b8e58f9870e,
+          0x337c861db00cc, 0x1c3d05775d0ee},
+         {0x6f1409422e51a, 0x7856bbece2d25, 0x13380a72f031c,
+          0x43e1080a7f3ba, 0x0621e2c7d3304}},
+        {{0x61796b0dbf0f3, 0x73c2f9c32d6f5, 0x6aa8ed1537ebe,
+          0x74e92c91838f4, 0x5d8e589ca1002},
+         {0x060cc8259838d, 0x038d3f35b95f3, 0x56078c243a923,
+          0x2de3293241bb2, 0x0007d6097bd3a},
+         {0x71d950842a94b, 0x46b11e5c7d817, 0x5478bbecb4f0d,
+          0x7c3054b0a1c5d, 0x1583d7783c1cb}},
+        {{0x34704cc9d28c7, 0x3dee598b1f200, 0x16e1c98746d9e,
+          0x4050b7095afdf, 0x4958064e83c55},
+         {0x6a2ef5da27ae1, 0x28aace02e9d9d, 0x02459e965f0e8,
+          0x7b864d3150933, 0x252a5f2e81ed8},
+         {0x094265066e80d, 0x0a60f918d61a5, 0x0444bf7f30fde,
+          0x1c40da9ed3c06, 0x079c170bd843b}},
+        {{0x6cd50c0d5d056, 0x5b7606ae779ba, 0x70fbd226bdda1,
+          0x5661e53391ff9, 0x6768c0d7317b8},
+         {0x6ece464fa6fff, 0x3cc40bca460a0, 0x6e3a90afb8d0c,
+          0x5801abca11228, 0x6dec05e34ac9f},
+         {0x625e5f155c1b3, 0x4f32f6f723296, 0x5ac980105efce,
+          0x17a61165eee36, 0x51445e14ddcd5}},
+        {{0x147ab2bbea455, 0x1f240f2253126, 0x0c3de9e314e89,
+          0x21ea5a4fca45f, 0x12e990086e4fd},
+         {0x02b4b3b144951, 0x5688977966aea, 0x18e176e399ffd,
+          0x2e45c5eb4938b, 0x13186f31e3929},
+         {0x496b37fdfbb2e, 0x3c2439d5f3e21, 0x16e60fe7e6a4d,
+          0x4d7ef889b621d, 0x77b2e3f05d3e9}}
+    },
+    { /* 256^12 B */
+        {{0x0639c12ddb0a4, 0x6180490cd7ab3, 0x3f3918297467c,
+          0x74568be1781ac, 0x07a195152e095},
+         {0x7a9c59c2ec4de, 0x7e9f09e79652d, 0x6a3e422f22d86,
+          0x2ae8e3b836c8b, 0x63b795fc7ad32},
+         {0x68f02389e5fc8, 0x059f1bc877506, 0x504990e410cec,
+          0x09bd7d0feaee2, 0x3e8fe83d032f0}},
+        {{0x04c8de8efd13c, 0x1c67c06e6210e, 0x183378f7f146a,
+          0x64352ceaed289, 0x22d60899a6258},
+         {0x315b90570a294, 0x60ce108a925f1, 0x6eff61253c909,
+          0x003ef0e2d70b0, 0x75ba3b797fac4},
+         {0x1dbc070cdd196, 0x16d8fb1534c47, 0x500498183fa2a,
+          0x72f59c423de75, 0x0904d07b87779}},
+        {{0x22d6648f940b9, 0x197a5a1873e86, 0x207e4c41a54bc,
+          0x5360b3b4bd6d0, 0x6240aacebaf72},
+         {0x61fd4ddba919c, 0x7d8e991b55699, 0x61b31473cc76c,
+          0x7039631e631d6, 0x43e2143fbc1dd},
+         {0x4749c5ba295a0, 0x37946fa4b5f06, 0x724c5ab5a51f1,
+          0x65633789dd3f3, 0x56bdaf238db40}},
+        {{0x0d36cc19d3bb2, 0x6ec4470d72262, 0x6853d7018a9ae,
+          0x3aa3e4dc2c8eb, 0x03aa31507e1e5},
+         {0x2b9e3f53533eb, 0x2add727a806c5, 0x56955c8ce15a3,
+          0x18c4f070a290e, 0x1d24a86d83741},
+         {0x47648ffd4ce1f, 0x60a9591839e9d, 0x424d5f38117ab,
+          0x42cc46912c10e, 0x43b261dc9aeb4}},
+        {{0x13d8b6c951364, 0x4c0017e8f632a, 0x53e559e53f9c4,
+          0x4b20146886eea, 0x02b4d5e242940},
+         {0x31e1988bb79bb, 0x7b82f46b3bcab, 0x0f7a8ce827b41,
+          0x5e15816177130, 0x326055cf5b276},
+         {0x155cb28d18df2, 0x0c30d9ca11694, 0x2090e27ab3119,
+          0x208624e7a49b6, 0x27a6c809ae5d3}},
+        {{0x4270ac43d6954, 0x2ed4cd95659a5, 0x75c0db37528f9,
+          0x2ccbcfd2c9234, 0x221503603d8c2},
+         {0x6ebcd1f0db188, 0x74ceb4b7d1174, 0x7d56168df4f5c,
+          0x0bf79176fd18a, 0x2cb67174ff60a},
+         {0x6cdf9390be1d0, 0x08e519c7e2b3d, 0x253c3d2a50881,
+          0x21b41448e333d, 0x7b1df4b73890f}},
+        {{0x6221807f8f58c, 0x3fa92813a8be5, 0x6da98c38d5572,
+          0x01ed95554468f, 0x68698245d352e},
+         {0x2f2e0b3b2a224, 0x0c56aa22c1c92, 0x5fdec39f1b278,
+          0x4c90af5c7f106, 0x61fcef2658fc5},
+         {0x15d852a18187a, 0x270dbb59afb76, 0x7db120bcf92ab,
+          0x0e7a25d714087, 0x46cf4c473daf0}},
+        {{0x46ea7f1498140, 0x70725690a8427, 0x0a73ae9f079fb,
+          0x2dd924461c62b, 0x1065aae50d8cc},
+         {0x525ed9ec4e5f9, 0x022d20660684c, 0x7972b70397b68,
+          0x7a03958d3f965, 0x29387bcd14eb5},
+         {0x44525df200d57, 0x2d7f94ce94385, 0x60d00c170ecb7,
+          0x38b0503f3d8f0, 0x69a198e64f1ce}}
+    },
+    { /* 256^13 B */
+        {{0x14434dcc5caed, 0x2c7909f667c20, 0x61a839d1fb576,
+          0x4f23800cabb76, 0x25b2697bd267f},
+         {0x2b2e0d91a78bc, 0x3990a12ccf20c, 0x141c2e11f2622,
+          0x0dfcefaa53320, 0x7369e6a92493a},
+         {0x73ffb13986864, 0x3282bb8f713ac, 0x49ced78f297ef,
+          0x6697027661def, 0x1420683db54e4}},
+        {{0x6bb6fc1cc5ad0, 0x532c8d591669d, 0x1af794da86c33,
+          0x0e0e9d86d24d3, 0x31e83b4161d08},
+         {0x0bd1e249dd197, 0x00bcb1820568f, 0x2eab1718830d4,
+          0x396fd816997e6, 0x60b63bebf508a},
+         {0x0c7129e062b4f, 0x1e526415b12fd, 0x461a0fd27923d,
+          0x18badf670a5b7, 0x55cf1eb62d550}},
+        {{0x6b5e37df58c52, 0x3bcf33986c60e, 0x44fb8835ceae7,
+          0x099dec18e71a4, 0x1a56fbaa62ba0},
+         {0x1101065c23d58, 0x5aa1290338b0f, 0x3157e9e2e7421,
+          0x0ea712017d489, 0x669a656457089},
+         {0x66b505c9dc9ec, 0x774ef86e35287, 0x4d1d944c0955e,
+          0x52e4c39d72b20, 0x13c4836799c58}},
+        {{0x4fb6a5d8bd080, 0x58ae34908589b, 0x3954d977baf13,
+          0x413ea597441dc, 0x50bdc87dc8e5b},
+         {0x25d465ab3e1b9, 0x0f8fe27ec2847, 0x2d6e6dbf04f06,
+          0x3038cfc1b3276, 0x66f80c93a637b},
+         {0x537836edfe111, 0x2be02357b2c0d, 0x6dcee58c8d4f8,
+          0x2d732581d6192, 0x1dd56444725fd}},
+        {{0x7e60008bac89a, 0x23d5c387c1852, 0x79e5df1f533a8,
+          0x2e6f9f1c5f0cf, 0x3a3a450f63a30},
+         {0x47ff83362127d, 0x08e39af82b1f4, 0x488322ef27dab,
+          0x1973738a2a1a4, 0x0e645912219f7},
+         {0x72f31d8394627, 0x07bd294a200f1, 0x665be00e274c6,
+          0x43de8f1b6368b, 0x318c8d9393a9a}},
+        {{0x69e29ab1dd398, 0x30685b3c76bac, 0x565cf37f24859,
+          0x57b2ac28efef9, 0x509a41c325950},
+         {0x45d032afffe19, 0x12fe49b6cde4e, 0x21663bc327cf1,
+          0x18a5e4c69f1dd, 0x224c7c679a1d5},
+         {0x06edca6f925e9, 0x68c8363e677b8, 0x60cfa25e4fbcf,
+          0x1c4c17609404e, 0x05bff02328a11}},
+        {{0x1a0dd0dc512e4, 0x10894bf5fcd10, 0x52949013f9c37,
+          0x1f50fba4735c7, 0x576277cdee01a},
+         {0x2137023cae00b, 0x15a3599eb26c6, 0x0687221512b3c,
+          0x253cb3a0824e9, 0x780b8cc3fa2a4},
+         {0x38abc234f305f, 0x7a280bbc103de, 0x398a836695dfe,
+          0x3d0af41528a1a, 0x5ff418726271b}},
+        {{0x347e813b69540, 0x76864c21c3cbb, 0x1e049dbcd74a8,
+          0x5b4d60f93749c, 0x29d4db8ca0a0c},
+         {0x6080c1789db9d, 0x4be7cef1ea731, 0x2f40d769d8080,
+          0x35f7d4c44a603, 0x106a03dc25a96},
+         {0x50aaf333353d0, 0x4b59a613cbb35, 0x223dfc0e19a76,
+          0x77d1e2bb2c564, 0x4ab38a51052cb}}
+    },
+    { /* 256^14 B */
+        {{0x7d1ef5fddc09c, 0x7beeaebb9dad9, 0x058d30ba0acfb,
+          0x5cd92eab5ae90, 0x3041c6bb04ed2},
+         {0x42b256768d593, 0x2e88459427b4f, 0x02b3876630701,
+          0x34878d405eae5, 0x29cdd1adc088a},
+         {0x2f2f9d956e148, 0x6b3e6ad65c1fe, 0x5b00972b79e5d,
+          0x53d8d234c5daf, 0x104bbd6814049}},
+        {{0x59a5fd67ff163, 0x3a998ead0352b, 0x083c95fa4af9a,
+          0x6fadbfc01266f, 0x204f2a20fb072},
+         {0x0fd3168f1ed67, 0x1bb0de7784a3e, 0x34bcb78b20477,
+          0x0a4a26e2e2182, 0x5be8cc57092a7},
+         {0x43b3d30ebb079, 0x357aca5c61902, 0x5b570c5d62455,
+          0x30fb29e1e18c7, 0x2570fb17c2791}},
+        {{0x6a9550bb8245a, 0x511f20a1a2325, 0x29324d7239bee,
+          0x3343cc37516c4, 0x241c5f91de018},
+         {0x2367f2cb61575, 0x6c39ac04d87df, 0x6d4958bd7e5bd,
+          0x566f4638a1532, 0x3dcb65ea53030},
+         {0x0172940de6caa, 0x6045b2e67451b, 0x56c07463efcb3,
+          0x0728b6bfe6e91, 0x08420edd5fcdf}},
+        {{0x0c34e04f410ce, 0x344edc0d0a06b, 0x6e45486d84d6d,
+          0x44e2ecb3863f5, 0x04d654f321db8},
+         {0x720ab8362fa4a, 0x29c4347cdd9bf, 0x0e798ad5f8463,
+          0x4fef18bcb0bfe, 0x0d9a53efbc176},
+         {0x5c116ddbdb5d5, 0x6d1b4bba5abcf, 0x4d28a48a5537a,
+          0x56b8e5b040b99, 0x4a7a4f2618991}},
+        {{0x3b291af372a4b, 0x60e3028fe4498, 0x2267bca4f6a09,
+          0x719eec242b243, 0x4a96314223e0e},
+         {0x718025fb15f95, 0x68d6b8371fe94, 0x3804448f7d97c,
+          0x42466fe784280, 0x11b50c4cddd31},
+         {0x0274408a4ffd6, 0x7d382aedb34dd, 0x40acfc9ce385d,
+          0x628bb99a45b1e, 0x4f4bce4dce6bc}},
+        {{0x2616ec49d0b6f, 0x1f95d8462e61c, 0x1ad3e9b9159c6,
+          0x79ba475a04df9, 0x3042cee561595},
+         {0x7ce5ae2242584, 0x2d25eb153d4e3, 0x3a8f3d09ba9c9,
+          0x0f3690d04eb8e, 0x73fcdd14b71c0},
+         {0x67079449bac41, 0x5b79c4621484f, 0x61069f2156b8d,
+          0x0eb26573b10af, 0x389e740c9a9ce}},
+        {{0x578f6570eac28, 0x644f2339c3937, 0x66e47b7956c2c,
+          0x34832fe1f55d0, 0x25c425e5d6263},
+         {0x4b3ae34dcb9ce, 0x47c691a15ac9f, 0x318e06e5d400c,
+          0x3c422d9f83eb1, 0x61545379465a6},
+         {0x606a6f1d7de6e, 0x4f1c0c46107e7, 0x229b1dcfbe5d8,
+          0x3acc60a7b1327, 0x6539a08915484}},
+        {{0x4dbd414bb4a19, 0x7930849f1dbb8, 0x329c5a466caf0,
+          0x6c824544feb9b, 0x0f65320ef019b},
+         {0x21f74c3d2f773, 0x024b88d08bd3a, 0x6e678cf054151,
+          0x43631272e747c, 0x11c5e4aac5cd1},
+         {0x6d1b1cafde0c6, 0x462c76a303a90, 0x3ca4e693cff9b,
+          0x3952cd45786fd, 0x4cabc7bdec330}}
+    },
+    { /* 256^15 B */
+        {{0x7788f3f78d289, 0x5942809b3f811, 0x5973277f8c29c,
+          0x010f93bc5fe67, 0x7ee498165acb2},
+         {0x69624089c0a2e, 0x0075fc8e70473, 0x13e84ab1d2313,
+          0x2c10bedf6953b, 0x639b93f0321c8},
+         {0x508e39111a1c3, 0x290120e912f7a, 0x1cbf464acae43,
+          0x15373e9576157, 0x0edf493c85b60}},
+        {{0x7c4d284764113, 0x7fefebf06acec, 0x39afb7a824100,
+          0x1b48e47e7fd65, 0x04c00c54d1dfa},
+         {0x48158599b5a68, 0x1fd75bc41d5d9, 0x2d9fc1fa95d3c,
+          0x7da27f20eba11, 0x403b92e3019d4},
+         {0x22f818b465cf8, 0x342901dff09b8, 0x31f595dc683cd,
+          0x37a57745fd682, 0x355bb12ab2617}},
+        {{0x1dac75a8c7318, 0x3b679d5423460, 0x6b8fcb7b6400e,
+          0x6c73783be5f9d, 0x7518eaf8e052a},
+         {0x664cc7493bbf4, 0x33d94761874e3, 0x0179e1796f613,
+          0x1890535e2867d, 0x0f9b8132182ec},
+         {0x059c41b7f6c32, 0x79e8706531491, 0x6c747643cb582,
+          0x2e20c0ad494e4, 0x47c3871bbb175}},
+        {{0x65d50c85066b0, 0x6167453361f7c, 0x06ba3818bb312,
+          0x6aff29baa7522, 0x08fea02ce8d48},
+         {0x4539771ec4f48, 0x7b9318badca28, 0x70f19afe016c5,
+          0x4ee7bb1608d23, 0x00b89b8576469},
+         {0x5dd7668deead0, 0x4096d0ba47049, 0x6275997219114,
+          0x29bda8a67e6ae, 0x473829a74f75d}},
+        {{0x1533aad3902c9, 0x1dde06b11e47b, 0x784bed1930b77,
+          0x1c80a92b9c867, 0x6c668b4d44e4d},
+         {0x2da754679c418, 0x3164c31be105a, 0x11fac2b98ef5f,
+          0x35a1aaf779256, 0x2078684c4833c},
+         {0x0cf217a78820c, 0x65024e7d2e769, 0x23bb5efdda82a,
+          0x19fd4b632d3c6, 0x7411a6054f8a4}},
+        {{0x2e53d18b175b4, 0x33e7254204af3, 0x3bcd7d5a1c4c5,
+          0x4c7c22af65d0f, 0x1ec9a872458c3},
+         {0x59d32b99dc86d, 0x6ac075e22a9ac, 0x30b9220113371,
+          0x27fd9a638966e, 0x7c136574fb813},
+         {0x6a4d400a2509b, 0x041791056971c, 0x655d5866e075c,
+          0x2302bf3e64df8, 0x3add88a5c7cd6}},
+        {{0x298d459393046, 0x30bfecb3d90b8, 0x3d9b8ea3df8d6,
+          0x3900e96511579, 0x61ba1131a406a},
+         {0x15770b635dcf2, 0x59ecd83f79571, 0x2db461c0b7fbd,
+          0x73a42a981345f, 0x249929fccc879},
+         {0x0a0f116959029, 0x5974fd7b1347a, 0x1e0cc1c08edad,
+          0x673bdf8ad1f13, 0x5620310cbbd8e}},
+        {{0x6b5f477e285d6, 0x4ed91ec326cc8, 0x6d6537503a3fd,
+          0x626d3763988d5, 0x7ec846f3658ce},
+         {0x193434934d643, 0x0d4a2445eaa51, 0x7d0708ae76fe0,
+          0x39847b6c3c7e1, 0x37676a2a4d9d9},
+         {0x68f3f1da22ec7, 0x6ed8039a2736b, 0x2627ee04c3c75,
+          0x6ea90a647e7d1, 0x6daaf723399b9}}
+    },
+    { /* 256^16 B */
+        {{0x304bfacad8ea2, 0x502917d108b07, 0x043176ca6dd0f,
+          0x5d5158f2c1d84, 0x2b5449e58eb3b},
+         {0x27562eb3dbe47, 0x291d7b4170be7, 0x5d1ca67dfa8e1,
+          0x2a88061f298a2, 0x1304e9e71627d},
+         {0x014d26adc9cfe, 0x7f1691ba16f13, 0x5e71828f06eac,
+          0x349ed07f0fffc, 0x4468de2d7c2dd}},
+        {{0x2d8c6f86307ce, 0x6286ba1850973, 0x5e9dcb08444d4,
+          0x1a96a543362b2, 0x5da6427e63247},
+         {0x3355e9419469e, 0x1847bb8ea8a37, 0x1fe6588cf9b71,
+          0x6b1c9d2db6b22, 0x6cce7c6ffb44b},
+         {0x4c688deac22ca, 0x6f775c3ff0352, 0x565603ee419bb,
+          0x6544456c61c46, 0x58f29abfe79f2}},
+        {{0x264bf710ecdf6, 0x708c58527896b, 0x42ceae6c53394,
+          0x4381b21e82b6a, 0x6af93724185b4},
+         {0x6cfab8de73e68, 0x3e6efced4bd21, 0x0056609500dbe,
+          0x71b7824ad85df, 0x577629c4a7f41},
+         {0x0024509c6a888, 0x2696ab12e6644, 0x0cca27f4b80d8,
+          0x0c7c1f11b119e, 0x701f25bb0caec}},
+        {{0x0f6d97cbec113, 0x4ce97fb7c93a3, 0x139835a11281b,
+          0x728907ada9156, 0x720a5bc050955},
+         {0x0b0f8e4616ced, 0x1d3c4b50fb875, 0x2f29673dc0198,
+          0x5f4b0f1830ffa, 0x2e0c92bfbdc40},
+         {0x709439b805a35, 0x6ec48557f8187, 0x08a4d1ba13a2c,
+          0x076348a0bf9ae, 0x0e9b9cbb144ef}},
+        {{0x69bd55db1beee, 0x6e14e47f731bd, 0x1a35e47270eac,
+          0x66f225478df8e, 0x366d44191cfd3},
+         {0x2d48ffb5720ad, 0x57b7f21a1df77, 0x5550effba0645,
+          0x5ec6a4098a931, 0x221104eb3f337},
+         {0x41743f2bc8c14, 0x796b0ad8773c7, 0x29fee5cbb689b,
+          0x122665c178734, 0x4167a4e6bc593}},
+        {{0x62665f8ce8fee, 0x29d101ac59857, 0x4d93bbba59ffc,
+          0x17b7897373f17, 0x34b33370cb7ed},
+         {0x39d2876f62700, 0x001cecd1d6c87, 0x7f01a11747675,
+          0x2350da5a18190, 0x7938bb7e22552},
+         {0x591ee8681d6cc, 0x39db0b4ea79b8, 0x202220f380842,
+          0x2f276ba42e0ac, 0x1176fc6e2dfe6}},
+        {{0x0e28949770eb8, 0x5559e88147b72, 0x35e1e6e63ef30,
+          0x35b109aa7ff6f, 0x1f6a3e54f2690},
+         {0x76cd05b9c619b, 0x69654b0901695, 0x7a53710b77f27,
+          0x79a1ea7d28175, 0x08fc3a4c677d5},
+         {0x4c199d30734ea, 0x6c622cb9acc14, 0x5660a55030216,
+          0x068f1199f11fb, 0x4f2fad0116b90}},
+        {{0x4d91db73bb638, 0x55f82538112c5, 0x6d85a279815de,
+          0x740b7b0cd9cf9, 0x3451995f2944e},
+         {0x6b24194ae4e54, 0x2230afded8897, 0x23412617d5071,
+          0x3d5d30f35969b, 0x445484a4972ef},
+         {0x2fcd09fea7d7c, 0x296126b9ed22a, 0x4a171012a05b2,
+          0x1db92c74d5523, 0x10b89ca604289}}
+    },
+    { /* 256^17 B */
+        {{0x141be5a45f06e, 0x5adb38becaea7, 0x3fd46db41f2bb,
+          0x6d488bbb5ce39, 0x17d2d1d9ef0d4},
+         {0x147499718289c, 0x0a48a67e4c7ab, 0x30fbc544bafe3,
+          0x0c701315fe58a, 0x20b878d577b75},
+         {0x2af18073f3e6a, 0x33aea420d24fe, 0x298008bf4ff94,
+          0x3539171db961e, 0x72214f63cc65c}},
+        {{0x5b7b9f43b29c9, 0x149ea31eea3b3, 0x4be7713581609,
+          0x2d87960395e98, 0x1f24ac855a154},
+         {0x37f405307a693, 0x2e5e66cf2b69c, 0x5d84266ae9c53,
+          0x5e4eb7de853b9, 0x5fdf48c58171c},
+         {0x608328e9505aa, 0x22182841dc49a, 0x3ec96891d2307,
+          0x2f363fff22e03, 0x00ba739e2ae39}},
+        {{0x426f5ea88bb26, 0x33092e77f75c8, 0x1a53940d819e7,
+          0x1132e4f818613, 0x72297de7d518d},
+         {0x698de5c8790d6, 0x268b8545beb25, 0x6d2648b96fedf,
+          0x47988ad1db07c, 0x03283a3e67ad7},
+         {0x41dc7be0cb939, 0x1b16c66100904, 0x0a24c20cbc66d,
+          0x4a2e9efe48681, 0x05e1296846271}},
+        {{0x7bbc8242c4550, 0x59a06103b35b7, 0x7237e4af32033,
+          0x726421ab3537a, 0x78cf25d38258c},
+         {0x2eeb32d9c495a, 0x79e25772f9750, 0x6d747833bbf23,
+          0x6cdd816d5d749, 0x39c00c9c13698},
+         {0x66b8e31489d68, 0x573857e10e2b5, 0x13be816aa1472,
+          0x41964d3ad4bf8, 0x006b52076b3ff}},
+        {{0x37e16b9ce082d, 0x1882f57853eb9, 0x7d29eacd01fc5,
+          0x2e76a59b5e715, 0x7de2e9561a9f7},
+         {0x0cfe19d95781c, 0x312cc621c453c, 0x145ace6da077c,
+          0x0912bef9ce9b8, 0x4d57e3443bc76},
+         {0x0d4f4b6a55ecb, 0x7ebb0bb733bce, 0x7ba6a05200549,
+          0x4f6ede4e22069, 0x6b2a90af1a602}},
+        {{0x3f3245bb2d80a, 0x0e5f720f36efd, 0x3b9cccf60c06d,
+          0x084e323f37926, 0x465812c8276c2},
+         {0x3f4fc9ae61e97, 0x3bc07ebfa2d24, 0x3b744b55cd4a0,
+          0x72553b25721f3, 0x5fd8f4e9d12d3},
+         {0x3beb22a1062d9, 0x6a7063b82c9a8, 0x0a5a35dc197ed,
+          0x3c80c06a53def, 0x05b32c2b1cb16}},
+        {{0x4a42c7ad58195, 0x5c8667e799eff, 0x02e5e74c850a1,
+          0x3f0db614e869a, 0x31771a4856730},
+         {0x05eccd24da8fd, 0x580bbfdf07918, 0x7e73586873c6a,
+          0x74ceddf77f93e, 0x3b5556a37b471},
+         {0x0c524e14dd482, 0x283457496c656, 0x0ad6bcfb6cd45,
+          0x375d1e8b02414, 0x4fc079d27a733}},
+        {{0x48b440c86c50d, 0x139929cca3b86, 0x0f8f2e44cdf2f,
+          0x68432117ba6b2, 0x241170c2bae3c},
+         {0x138b089bf2f7f, 0x4a05bfd34ea39, 0x203914c925ef5,
+          0x7497fffe04e3c, 0x124567cecaf98},
+         {0x1ab860ac473b4, 0x5c0227c86a7ff, 0x71b12bfc24477,
+          0x006a573a83075, 0x3f8612966c870}}
+    },
+    { /* 256^18 B */
+        {{0x0fcfa36048d13, 0x66e7133bbb383, 0x64b42a8a45676,
+          0x4ea6e4f9a85cf, 0x26f57eee878a1},
+         {0x20cc9782a0dde, 0x65d4e3070aab3, 0x7bc8e31547736,
+          0x09ebfb1432d98, 0x504aa77679736},
+         {0x32cd55687efb1, 0x4448f5e2f6195, 0x568919d460345,
+          0x034c2e0ad1a27, 0x4041943d9dba3}},
+        {{0x17743a26caadd, 0x48c9156f9c964, 0x7ef278d1e9ad0,
+          0x00ce58ea7bd01, 0x12d931429800d},
+         {0x0eeba43ebcc96, 0x384dd5395f878, 0x1df331a35d272,
+          0x207ecfd4af70e, 0x1420a1d976843},
+         {0x67799d337594f, 0x01647548f6018, 0x57fce5578f145,
+          0x009220c142a71, 0x1b4f92314359a}},
+        {{0x73030a49866b1, 0x2442be90b2679, 0x77bd3d8947dcf,
+          0x1fb55c1552028, 0x5ff191d56f9a2},
+         {0x4109d89150951, 0x225bd2d2d47cb, 0x57cc080e73bea,
+          0x6d71075721fcb, 0x239b572a7f132},
+         {0x6d433ac2d9068, 0x72bf930a47033, 0x64facf4a20ead,
+          0x365f7a2b9402a, 0x020c526a758f3}},
+        {{0x1ef59f042cc89, 0x3b1c24976dd26, 0x31d665cb16272,
+          0x28656e470c557, 0x452cfe0a5602c},
+         {0x034f89ed8dbbc, 0x73b8f948d8ef3, 0x786c1d323caab,
+          0x43bd4a9266e51, 0x02aacc4615313},
+         {0x0f7a0647877df, 0x4e1cc0f93f0d4, 0x7ec4726ef1190,
+          0x3bdd58bf512f8, 0x4cfb7d7b304b8}},
+        {{0x699c29789ef12, 0x63beae321bc50, 0x325c340adbb35,
+          0x562e1a1e42bf6, 0x5b1d4cbc434d3},
+         {0x43d6cb89b75fe, 0x3338d5b900e56, 0x38d327d531a53,
+          0x1b25c61d51b9f, 0x14b4622b39075},
+         {0x32615cc0a9f26, 0x57711b99cb6df, 0x5a69c14e93c38,
+          0x6e88980a4c599, 0x2f98f71258592}},
+        {{0x2ae444f54a701, 0x615397afbc5c2, 0x60d7783f3f8fb,
+          0x2aa675fc486ba, 0x1d8062e9e7614},
+         {0x4a74cb50f9e56, 0x531d1c2640192, 0x0c03d9d6c7fd2,
+          0x57ccd156610c1, 0x3a6ae249d806a},
+         {0x2da85a9907c5a, 0x6b23721ec4caf, 0x4d2d3a4683aa2,
+          0x7f9c6870efdef, 0x298b8ce8aef25}},
+        {{0x272ea0a2165de, 0x68179ef3ed06f, 0x4e2b9c0feac1e,
+          0x3ee290b1b63bb, 0x6ba6271803a7d},
+         {0x27953eff70cb2, 0x54f22ae0ec552, 0x29f3da92e2724,
+          0x242ca0c22bd18, 0x34b8a8404d5ce},
+         {0x6ecb583693335, 0x3ec76bfdfb84d, 0x2c895cf56a04f,
+          0x6355149d54d52, 0x71d62bdd465e1}},
+        {{0x5b5dab1f75ef5, 0x1e2d60cbeb9a5, 0x527c2175dfe57,
+          0x59e8a2b8ff51f, 0x1c333621262b2},
+         {0x3cc28d378df80, 0x72141f4968ca6, 0x407696bdb6d0d,
+          0x5d271b22ffcfb, 0x74d5f317f3172},
+         {0x7e55467d9ca81, 0x6a5653186f50d, 0x6b188ece62df1,
+          0x4c66d36844971, 0x4aebcc4547e9d}}
+    },
+    { /* 256^19 B */
+        {{0x08d9e7354b610, 0x26b750b6dc168, 0x162881e01acc9,
+          0x7966df31d01a5, 0x173bd9ddc9a1d},
+         {0x0071b276d01c9, 0x0b0d8918e025e, 0x75beea79ee2eb,
+          0x3c92984094db8, 0x5d88fbf95a3db},
+         {0x00f1efe5872df, 0x5da872318256a, 0x59ceb81635960,
+          0x18cf37693c764, 0x06e1cd13b19ea}},
+        {{0x3af629e5b0353, 0x204f1a088e8e5, 0x10efc9ceea82e,
+          0x589863c2fa34b, 0x7f3a6a1a8d837},
+         {0x0ad516f166f23, 0x263f56d57c81a, 0x13422384638ca,
+          0x1331ff1af0a50, 0x3080603526e16},
+         {0x644395d3d800b, 0x2b9203dbedefc, 0x4b18ce656a355,
+          0x03f3466bc182c, 0x30d0fded2e513}},
+        {{0x4971e68b84750, 0x52ccc9779f396, 0x3e904ae8255c8,
+          0x4ecae46f39339, 0x4615084351c58},
+         {0x14d1af21233b3, 0x1de1989b39c0b, 0x52669dc6f6f9e,
+          0x43434b28c3fc7, 0x0a9214202c099},
+         {0x019c0aeb9a02e, 0x1a2c06995d792, 0x664cbb1571c44,
+          0x6ff0736fa80b2, 0x3bca0d2895ca5}},
+        {{0x08eb69ecc01bf, 0x5b4c8912df38d, 0x5ea7f8bc2f20e,
+          0x120e516caafaf, 0x4ea8b4038df28},
+         {0x031bc3c5d62a4, 0x7d9fe0f4c081e, 0x43ed51467f22c,
+          0x1e6cc0c1ed109, 0x5631deddae8f1},
+         {0x5460af1cad202, 0x0b4919dd0655d, 0x7c4697d18c14c,
+          0x231c890bba2a4, 0x24ce0930542ca}},
+        {{0x7a155fdf30b85, 0x1c6c6e5d487f9, 0x24be1134bdc5a,
+          0x1405970326f32, 0x549928a7324f4},
+         {0x090f5fd06c106, 0x6abb1021e43fd, 0x232bcfad711a0,
+          0x3a5c13c047f37, 0x41d4e3c28a06d},
+         {0x632a763ee1a2e, 0x6fa4bffbd5e4d, 0x5fd35a6ba4792,
+          0x7b55e1de99de8, 0x491b66dec0dcf}},
+        {{0x04a8ed0da64a1, 0x5ecfc45096ebe, 0x5edee93b488b2,
+          0x5b3c11a51bc8f, 0x4cf6b8b0b7018},
+         {0x5b13dc7ea32a7, 0x18fc2db73131e, 0x7e3651f8f57e3,
+          0x25656055fa965, 0x08f338d0c85ee},
+         {0x3a821991a73bd, 0x03be6418f5870, 0x1ddc18eac9ef0,
+          0x54ce09e998dc2, 0x530d4a82eb078}},
+        {{0x173456c9abf9e, 0x7892015100dad, 0x33ee14095fecb,
+          0x6ad95d67a0964, 0x0db3e7e00cbfb},
+         {0x43630e1f94825, 0x4d1956a6b4009, 0x213fe2df8b5e0,
+          0x05ce3a41191e6, 0x65ea753f10177},
+         {0x6fc3ee2096363, 0x7ec36b96d67ac, 0x510ec6a0758b1,
+          0x0ed87df022109, 0x02a4ec1921e1a}},
+        {{0x06162f1cf795f, 0x324ddcafe5eb9, 0x018d5e0463218,
+          0x7e78b9092428e, 0x36d12b5dec067},
+         {0x6259a3b24b8a2, 0x188b5f4170b9c, 0x681c0dee15deb,
+          0x4dfe665f37445, 0x3d143c5112780},
+         {0x5279179154557, 0x39f8f0741424d, 0x45e6eb357923d,
+          0x42c9b5edb746f, 0x2ef517885ba82}}
+    },
+    { /* 256^20 B */
+        {{0x6bffb305b2f51, 0x5b112b2d712dd, 0x35774974fe4e2,
+          0x04af87a96e3a3, 0x57968290bb3a0},
+         {0x7974e8c58aedc, 0x7757e083488c6, 0x601c62ae7bc8b,
+          0x45370c2ecab74, 0x2f1b78fab143a},
+         {0x2b8430a20e101, 0x1a49e1d88fee3, 0x38bbb47ce4d96,
+          0x1f0e7ba84d437, 0x7dc43e35dc2aa}},
+        {{0x02a5c273e9718, 0x32bc9dfb28b4f, 0x48df4f8d5db1a,
+          0x54c87976c028f, 0x044fb81d82d50},
+         {0x66665887dd9c3, 0x629760a6ab0b2, 0x481e6c7243e6c,
+          0x097e37046fc77, 0x7ef72016758cc},
+         {0x718c5a907e3d9, 0x3b9c98c6b383b, 0x006ed255eccdc,
+          0x6976538229a59, 0x7f79823f9c30d}},
+        {{0x41ff068f587ba, 0x1c00a191bcd53, 0x7b56f9c209e25,
+          0x3781e5fccaabe, 0x64a9b0431c06d},
+         {0x4d239a3b513e8, 0x29723f51b1066, 0x642f4cf04d9c3,
+          0x4da095aa09b7a, 0x0a4e0373d784d},
+         {0x3d6a15b7d2919, 0x41aa75046a5d6, 0x691751ec2d3da,
+          0x23638ab6721c4, 0x071a7d0ace183}},
+        {{0x4355220e14431, 0x0e1362a283981, 0x2757cd8359654,
+          0x2e9cd7ab10d90, 0x7c69bcf761775},
+         {0x72daac887ba0b, 0x0b7f4ac5dda60, 0x3bdda2c0498a4,
+          0x74e67aa180160, 0x2c3bcc7146ea7},
+         {0x0d7eb04e8295f, 0x4a5ea1e6fa0fe, 0x45e635c436c60,
+          0x28ef4a8d4d18b, 0x6f5a9a7322aca}},
+        {{0x1d4eba3d944be, 0x0100f15f3dce5, 0x61a700e367825,
+          0x5922292ab3d23, 0x02ab9680ee8d3},
+         {0x1000c2f41c6c5, 0x0219fdf737174, 0x314727f127de7,
+          0x7e5277d23b81e, 0x494e21a2e147a},
+         {0x48a85dde50d9a, 0x1c1f734493df4, 0x47bdb64866889,
+          0x59a7d048f8eec, 0x6b5d76cbea46b}},
+        {{0x141171e782522, 0x6806d26da7c1f, 0x3f31d1bc79ab9,
+          0x09f20459f5168, 0x16fb869c03dd3},
+         {0x7556cec0cd994, 0x5eb9a03b7510a, 0x50ad1dd91cb71,
+          0x1aa5780b48a47, 0x0ae333f685277},
+         {0x6199733b60962, 0x69b157c266511, 0x64740f893f1ca,
+          0x03aa408fbf684, 0x3f81e38b8f70d}},
+        {{0x37f355f17c824, 0x07ae85334815b, 0x7e3abddd2e48f,
+          0x61eeabe1f45e5, 0x0ad3e2d34cded},
+         {0x10fcc7ed9affe, 0x4248cb0e96ff2, 0x4311c115172e2,
+          0x4c9d41cbf6925, 0x50510fc104f50},
+         {0x40fc5336e249d, 0x3386639fb2de1, 0x7bbf871d17b78,
+          0x75f796b7e8004, 0x127c158bf0fa1}},
+        {{0x28fc4ae51b974, 0x26e89bfd2dbd4, 0x4e122a07665cf,
+          0x7cab1203405c3, 0x4ed82479d167d},
+         {0x17c422e9879a2, 0x28a5946c8fec3, 0x53ab32e912b77,
+          0x7b44da09fe0a5, 0x354ef87d07ef4},
+         {0x3b52260c5d975, 0x79d6836171fdc, 0x7d994f140d4bb,
+          0x1b6c404561854, 0x302d92d205392}}
+    },
+    { /* 256^21 B */
+        {{0x46fb6e4e0f177, 0x53497ad5265b7, 0x1ebdba01386fc,
+          0x0302f0cb36a3c, 0x0edc5f5eb426d},
+         {0x3c1a2bca4283d, 0x23430c7bb2f02, 0x1a3ea1bb58bc2,
+          0x7265763de5c61, 0x10e5d3b76f1ca},
+         {0x3bfd653da8e67, 0x584953ec82a8a, 0x55e288fa7707b,
+          0x5395fc3931d81, 0x45b46c51361cb}},
+        {{0x54ddd8a7fe3e4, 0x2cecc41c619d3, 0x43a6562ac4d91,
+          0x4efa5aca7bdd9, 0x5c1c0aef32122},
+         {0x02abf314f7fa1, 0x391d19e8a1528, 0x6a2fa13895fc7,
+          0x09d8eddeaa591, 0x2177bfa36dcb7},
+         {0x01bbcfa79db8f, 0x3d84beb3666e1, 0x20c921d812204,
+          0x2dd843d3b32ce, 0x4ae619387d8ab}},
+        {{0x17e44985bfb83, 0x54e32c626cc22, 0x096412ff38118,
+          0x6b241d61a246a, 0x75685abe5ba43},
+         {0x3f6aa5344a32e, 0x69683680f11bb, 0x04c3581f623aa,
+          0x701af5875cba5, 0x1a00d91b17bf3},
+         {0x60933eb61f2b2, 0x5193fe92a4dd2, 0x3d995a550f43e,
+          0x3556fb93a883d, 0x135529b623b0e}},
+        {{0x716bce22e83fe, 0x33d0130b83eb8, 0x0952abad0afac,
+          0x309f64ed31b8a, 0x5972ea051590a},
+         {0x0dbd7add1d518, 0x119f823e2231e, 0x451d66e5e7de2,
+          0x500c39970f838, 0x79b5b81a65ca3},
+         {0x4ac20dc8f7811, 0x29589a9f501fa, 0x4d810d26a6b4a,
+          0x5ede00d96b259, 0x4f7e9c95905f3}},
+        {{0x0443d355299fe, 0x39b7d7d5aee39, 0x692519a2f34ec,
+          0x6e4404924cf78, 0x1942eec4a144a},
+         {0x74bbc5781302e, 0x73135bb81ec4c, 0x7ef671b61483c,
+          0x7264614ccd729, 0x31993ad92e638},
+         {0x45319ae234992, 0x2219d47d24fb5, 0x4f04488b06cf6,
+          0x53aaa9e724a12, 0x2a0a65314ef9c}},
+        {{0x61acd3c1c793a, 0x58b46b78779e6, 0x3369aacbe7af2,
+          0x509b0743074d4, 0x055dc39b6dea1},
+         {0x7937ff7f927c2, 0x0c2fa14c6a5b6, 0x556bddb6dd07c,
+          0x6f6acc179d108, 0x4cf6e218647c2},
+         {0x1227cc28d5bb6, 0x78ee9bff57623, 0x28cb2241f893a,
+          0x25b541e3c6772, 0x121a307710aa2}},
+        {{0x1713ec77483c9, 0x6f70572d5facb, 0x25ef34e22ff81,
+          0x54d944f141188, 0x527bb94a6ced3},
+         {0x35d5e9f034a97, 0x126069785bc9b, 0x5474ec7854ff0,
+          0x296a302a348ca, 0x333fc76c7a40e},
+         {0x5992a995b482e, 0x78dc707002ac7, 0x5936394d01741,
+          0x4fba4281aef17, 0x6b89069b20a7a}},
+        {{0x2fa8cb5c7db77, 0x718e6982aa810, 0x39e95f81a1a1b,
+          0x5e794f3646cfb, 0x0473d308a7639},
+         {0x2a0416270220d, 0x75f248b69d025, 0x1cbbc16656a27,
+          0x5b9ffd6e26728, 0x23bc2103aa73e},
+         {0x6792603589e05, 0x248db9892595d, 0x006a53cad2d08,
+          0x20d0150f7ba73, 0x102f73bfde043}}
+    },
+    { /* 256^22 B */
+        {{0x4dae0b5511c9a, 0x5257fffe0d456, 0x54108d1eb2180,
+          0x096cc0f9baefa, 0x3f6bd725da4ea},
+         {0x0b9ab7f5745c6, 0x5caf0f8d21d63, 0x7debea408ea2b,
+          0x09edb93896d16, 0x36597d25ea5c0},
+         {0x58d7b106058ac, 0x3cdf8d20bee69, 0x00a4cb765015e,
+          0x36832337c7cc9, 0x7b7ecc19da60d}},
+        {{0x64a51a77cfa9b, 0x29cf470ca0db5, 0x4b60b6e0898d9,
+          0x55d04ddffe6c7, 0x03bedc661bf5c},
+         {0x2373c695c690d, 0x4c0c8520dcf18, 0x384af4b7494b9,
+          0x4ab4a8ea22225, 0x4235ad7601743},
+         {0x0cb0d078975f5, 0x292313e530c4b, 0x38dbb9124a509,
+          0x350d0655a11f1, 0x0e7ce2b0cdf06}},
+        {{0x6fedfd94b70f9, 0x2383f9745bfd4, 0x4beae27c4c301,
+          0x75aa4416a3f3f, 0x615256138aece},
+         {0x4643ac48c85a3, 0x6878c2735b892, 0x3a53523f4d877,
+          0x3a504ed8bee9d, 0x666e0a5d8fb46},
+         {0x3f64e4870cb0d, 0x61548b16d6557, 0x7a261773596f3,
+          0x7724d5f275d3a, 0x7f0bc810d514d}},
+        {{0x49dad737213a0, 0x745dee5d31075, 0x7b1a55e7fdbe2,
+          0x5ba988f176ea1, 0x1d3a907ddec5a},
+         {0x06ba426f4136f, 0x3cafc0606b720, 0x518f0a2359cda,
+          0x5fae5e46feca7, 0x0d1f8dbcf8eed},
+         {0x693313ed081dc, 0x5b0a366901742, 0x40c872ca4ca7e,
+          0x6f18094009e01, 0x00011b44a31bf}},
+        {{0x61f696a0aa75c, 0x38b0a57ad42ca, 0x1e59ab706fdc9,
+          0x01308d46ebfcd, 0x63d988a2d2851},
+         {0x7a06c3fc66c0c, 0x1c9bac1ba47fb, 0x23935c575038e,
+          0x3f0bd71c59c13, 0x3ac48d916e835},
+         {0x20753afbd232e, 0x71fbb1ed06002, 0x39cae47a4af3a,
+          0x0337c0b34d9c2, 0x33fad52b2368a}},
+        {{0x4c8d0c422cfe8, 0x760b4275971a5, 0x3da95bc1cad3d,
+          0x0f151ff5b7376, 0x3cc355ccb90a7},
+         {0x649c6c5e41e16, 0x60667eee6aa80, 0x4179d182be190,
+          0x653d9567e6979, 0x16c0f429a256d},
+         {0x69443903e9131, 0x16f4ac6f9dd36, 0x2ea4912e29253,
+          0x2b4643e68d25d, 0x631eaf426bae7}},
+        {{0x175b9a3700de8, 0x77c5f00aa48fb, 0x3917785ca0317,
+          0x05aa9b2c79399, 0x431f2c7f665f8},
+         {0x10410da66fe9f, 0x24d82dcb4d67d, 0x3e6fe0e17752d,
+          0x4dade1ecbb08f, 0x5599648b1ea91},
+         {0x26344858f7b19, 0x5f43d4a295ac0, 0x242a75c52acd4,
+          0x5934480220d10, 0x7b04715f91253}},
+        {{0x6c280c4e6bac6, 0x3ada3b361766e, 0x42fe5125c3b4f,
+          0x111d84d4aac22, 0x48d0acfa57cde},
+         {0x5bd28acf6ae43, 0x16fab8f56907d, 0x7acb11218d5f2,
+          0x41fe02023b4db, 0x59b37bf5c2f65},
+         {0x726e47dabe671, 0x2ec45e746f6c1, 0x6580e53c74686,
+          0x5eda104673f74, 0x16234191336d3}}
+    },
+    { /* 256^23 B */
+        {{0x19cd61ff38640, 0x060c6c4b41ba9, 0x75cf70ca7366f,
+          0x118a8f16c011e, 0x4a25707a203b9},
+         {0x499def6267ff6, 0x76e858108773c, 0x693cac5ddcb29,
+          0x00311d00a9ff4, 0x2cdfdfecd5d05},
+         {0x7668a53f6ed6a, 0x303ba2e142556, 0x3880584c10909,
+          0x4fe20000a261d, 0x5721896d248e4}},
+        {{0x55091a1d0da4e, 0x4f6bfc7c1050b, 0x64e4ecd2ea9be,
+          0x07eb1f28bbe70, 0x03c935afc4b03},
+         {0x65517fd181bae, 0x3e5772c76816d, 0x019189640898a,
+          0x1ed2a84de7499, 0x578edd74f63c1},
+         {0x276c6492b0c3d, 0x09bfc40bf932e, 0x588e8f11f330b,
+          0x3d16e694dc26e, 0x3ec2ab590288c}},
+        {{0x13a09ae32d1cb, 0x3e81eb85ab4e4, 0x07aaca43cae1f,
+          0x62f05d7526374, 0x0e1bf66c6adba},
+         {0x0d27be4d87bb9, 0x56c27235db434, 0x72e6e0ea62d37,
+          0x5674cd06ee839, 0x2dd5c25a200fc},
+         {0x3d5e9792c887e, 0x319724dabbc55, 0x2b97c78680800,
+          0x7afdfdd34e6dd, 0x730548b35ae88}},
+        {{0x3094ba1d6e334, 0x6e126a7e3300b, 0x089c0aefcfbc5,
+          0x2eea11f836583, 0x585a2277d8784},
+         {0x551a3cba8b8ee, 0x3b6422be2d886, 0x630e1419689bc,
+          0x4653b07a7a955, 0x3043443b411db},
+         {0x25f8233d48962, 0x6bd8f04aff431, 0x4f907fd9a6312,
+          0x40fd3c737d29b, 0x7656278950ef9}},
+        {{0x073a3ea86cf9d, 0x6e0e2abfb9c2e, 0x60e2a38ea33ee,
+          0x30b2429f3fe18, 0x28bbf484b613f},
+         {0x3cf59d51fc8c0, 0x7a0a0d6de4718, 0x55c3a3e6fb74b,
+          0x353135f884fd5, 0x3f4160a8c1b84},
+         {0x12f5c6f136c7c, 0x0fedba237de4c, 0x779bccebfab44,
+          0x3aea93f4d6909, 0x1e79cb358188f}},
+        {{0x153d8f5e08181, 0x08533bbdb2efd, 0x1149796129431,
+          0x17a6e36168643, 0x478ab52d39d1f},
+         {0x436c3eef7e3f1, 0x7ffd3c21f0026, 0x3e77bf20a2da9,
+          0x418bffc8472de, 0x65d7951b3a3b3},
+         {0x6a4d39252d159, 0x790e35900ecd4, 0x30725bf977786,
+          0x10a5c1635a053, 0x16d87a411a212}},
+        {{0x4d5e2d54e0583, 0x2e5d7b33f5f74, 0x3a5de3f887ebf,
+          0x6ef24bd6139b7, 0x1f990b577a5a6},
+         {0x57e5a42066215, 0x1a18b44983677, 0x3e652de1e6f8f,
+          0x6532be02ed8eb, 0x28f87c8165f38},
+         {0x44ead1be8f7d6, 0x5759d4f31f466, 0x0378149f47943,
+          0x69f3be32b4f29, 0x45882fe1534d6}},
+        {{0x49929943c6fe4, 0x4347072545b15, 0x3226bced7e7c5,
+          0x03a134ced89df, 0x7dcf843ce405f},
+         {0x1345d757983d6, 0x222f54234cccd, 0x1784a3d8adbb4,
+          0x36ebeee8c2bcc, 0x688fe5b8f626f},
+         {0x0d6484a4732c0, 0x7b94ac6532d92, 0x5771b8754850f,
+          0x48dd9df1461c8, 0x6739687e73271}}
+    },
+    { /* 256^24 B */
+        {{0x5cc9dc80c1ac0, 0x683671486d4cd, 0x76f5f1a5e8173,
+          0x6d5d3f5f9df4a, 0x7da0b8f68d7e7},
+         {0x02014385675a6, 0x6155fb53d1def, 0x37ea32e89927c,
+          0x059a668f5a82e, 0x46115aba1d4dc},
+         {0x71953c3b5da76, 0x6642233d37a81, 0x2c9658076b1bd,
+          0x5a581e63010ff, 0x5a5f887e83674}},
+        {{0x628d3a0a643b9, 0x01cd8640c93d2, 0x0b7b0cad70f2c,
+          0x3864da98144be, 0x43e37ae2d5d1c},
+         {0x301cf70a13d11, 0x2a6a1ba1891ec, 0x2f291fb3f3ae0,
+          0x21a7b814bea52, 0x3669b656e44d1},
+         {0x63f06eda6e133, 0x233342758070f, 0x098e0459cc075,
+          0x4df5ead6c7c1b, 0x6a21e6cd4fd5e}},
+        {{0x129126699b2e3, 0x0ee11a2603de8, 0x60ac2f5c74c21,
+          0x59b192a196808, 0x45371b07001e8},
+         {0x6170a3046e65f, 0x5401a46a49e38, 0x20add5561c4a8,
+          0x7abb4edde9e46, 0x586bf9f1a195f},
+         {0x3088d5ef8790b, 0x38c2126fcb4db, 0x685bae149e3c3,
+          0x0bcd601a4e930, 0x0eafb03790e52}},
+        {{0x0805e0f75ae1d, 0x464cc59860a28, 0x248e5b7b00bef,
+          0x5d99675ef8f75, 0x44ae3344c5435},
+         {0x555c13748042f, 0x4d041754232c0, 0x521b430866907,
+          0x3308e40fb9c39, 0x309acc675a02c},
+         {0x289b9bba543ee, 0x3ab592e28539e, 0x64d82abcdd83a,
+          0x3c78ec172e327, 0x62d5221b7f946}},
+        {{0x5d4263af77a3c, 0x23fdd2289aeb0, 0x7dc64f77eb9ec,
+          0x01bd28338402c, 0x14f29a5383922},
+         {0x4299c18d0936d, 0x5914183418a49, 0x52a18c721aed5,
+          0x2b151ba82976d, 0x5c0efde4bc754},
+         {0x17edc25b2d7f5, 0x37336a6081bee, 0x7b5318887e5c3,
+          0x49f6d491a5be1, 0x5e72365c7bee0}},
+        {{0x339062f08b33e, 0x4bbf3e657cfb2, 0x67af7f56e5967,
+          0x4dbd67f9ed68f, 0x70b20555cb734},
+         {0x3fc074571217f, 0x3a0d29b2b6aeb, 0x06478ccdde59d,
+          0x55e4d051bddfa, 0x77f1104c47b4e},
+         {0x113c555112c4c, 0x7535103f9b7ca, 0x140ed1d9a2108,
+          0x02522333bc2af, 0x0e34398f4a064}},
+        {{0x30b093e4b1928, 0x1ce7e7ec80312, 0x4e575bdf78f84,
+          0x61f7a190bed39, 0x6f8aded6ca379},
+         {0x522d93ecebde8, 0x024f045e0f6cf, 0x16db63426cfa1,
+          0x1b93a1fd30fd8, 0x5e5405368a362},
+         {0x0123dfdb7b29a, 0x4344356523c68, 0x79a527921ee5f,
+          0x74bfccb3e817e, 0x780de72ec8d3d}},
+        {{0x7eaf300f42772, 0x5455188354ce3, 0x4dcca4a3dcbac,
+          0x3d314d0bfebcb, 0x1defc6ad32b58},
+         {0x28545089ae7bc, 0x1e38fe9a0c15c, 0x12046e0e2377b,
+          0x6721c560aa885, 0x0eb28bf671928},
+         {0x3be1aef5195a7, 0x6f22f62bdb5eb, 0x39768b8523049,
+          0x43394c8fbfdbd, 0x467d201bf8dd2}}
+    },
+    { /* 256^25 B */
+        {{0x6f4bd567ae7a9, 0x65ac89317b783, 0x07d3b20fd8932,
+          0x000f208326916, 0x2ef9c5a5ba384},
+         {0x6919a74ef4fad, 0x59ed4611452bf, 0x691ec04ea09ef,
+          0x3cbcb2700e984, 0x71c43c4f5ba3c},
+         {0x56df6fa9e74cd, 0x79c95e4cf56df, 0x7be643bc609e2,
+          0x149c12ad9e878, 0x5a758ca390c5f}},
+        {{0x0918b1d61dc94, 0x0d350260cd19c, 0x7a2ab4e37b4d9,
+          0x21fea735414d7, 0x0a738027f639d},
+         {0x72710d9462495, 0x25aafaa007456, 0x2d21f28eaa31b,
+          0x17671ea005fd0, 0x2dbae244b3eb7},
+         {0x74a2f57ffe1cc, 0x1bc3073087301, 0x7ec57f4019c34,
+          0x34e082e1fa524, 0x2698ca635126a}},
+        {{0x5702f5e3dd90e, 0x31c9a4a70c5c7, 0x136a5aa78fc24,
+          0x1992f3b9f7b01, 0x3c004b0c4afa3},
+         {0x5318832b0ba78, 0x6f24b9ff17cec, 0x0a47f30e060c7,
+          0x58384540dc8d0, 0x1fb43dcc49cae},
+         {0x146ac06f4b82b, 0x4b500d89e7355, 0x3351e1c728a12,
+          0x10b9f69932fe3, 0x6b43fd01cd1fd}},
+        {{0x742583e760ef3, 0x73dc1573216b8, 0x4ae48fdd7714a,
+          0x4f85f8a13e103, 0x73420b2d6ff0d},
+         {0x75d4b4697c544, 0x11be1fff7f8f4, 0x119e16857f7e1,
+          0x38a14345cf5d5, 0x5a68d7105b52f},
+         {0x4f6cb9e851e06, 0x278c4471895e5, 0x7efcdce3d64e4,
+          0x64f6d455c4b4c, 0x3db5632fea34b}},
+        {{0x190b1829825d5, 0x0e7d3513225c9, 0x1c12be3b7abae,
+          0x58777781e9ca6, 0x59197ea495df2},
+         {0x6ee2bf75dd9d8, 0x6c72ceb34be8d, 0x679c9cc345ec7,
+          0x7898df96898a4, 0x04321adf49d75},
+         {0x16019e4e55aae, 0x74fc5f25d209c, 0x4566a939ded0d,
+          0x66063e716e0b7, 0x45eafdc1f4d70}},
+        {{0x64624cfccb1ed, 0x257ab8072b6c1, 0x0120725676f0a,
+          0x4a018d04e8eee, 0x3f73ceea5d56d},
+         {0x401858045d72b, 0x459e5e0ca2d30, 0x488b719308bea,
+          0x56f4a0d1b32b5, 0x5a5eebc80362d},
+         {0x7bfd10a4e8dc6, 0x7c899366736f4, 0x55ebbeaf95c01,
+          0x46db060903f8a, 0x2605889126621}},
+        {{0x18e3cc676e542, 0x26079d995a990, 0x04a7c217908b2,
+          0x1dc7603e6655a, 0x0dedfa10b2444},
+         {0x704a68360ff04, 0x3cecc3cde8b3e, 0x21cd5470f64ff,
+          0x6abc18d953989, 0x54ad0c2e4e615},
+         {0x367d5b82b522a, 0x0d3f4b83d7dc7, 0x3067f4cdbc58d,
+          0x20452da697937, 0x62ecb2baa77a9}},
+        {{0x72836afb62874, 0x0af3c2094b240, 0x0c285297f357a,
+          0x7cc2d5680d6e3, 0x61913d5075663},
+         {0x5795261152b3d, 0x7a1dbbafa3cbd, 0x5ad31c52588d5,
+          0x45f3a4164685c, 0x2e59f919a966d},
+         {0x62d361a3231da, 0x65284004e01b8, 0x656533be91d60,
+          0x6ae016c00a89f, 0x3ddbc2a131c05}}
+    },
+    { /* 256^26 B */
+        {{0x257a22796bb14, 0x6f360fb443e75, 0x680e47220eaea,
+          0x2fcf2a5f10c18, 0x5ee7fb38d8320},
+         {0x40ff9ce5ec54b, 0x57185e261b35b, 0x3e254540e70a9,
+          0x1b5814003e3f8, 0x78968314ac04b},
+         {0x5fdcb41446a8e, 0x5286926ff2a71, 0x0f231e296b3f6,
+          0x684a357c84693, 0x61d0633c9bca0}},
+        {{0x328bcf8fc73df, 0x3b4de06ff95b4, 0x30aa427ba11a5,
+          0x5ee31bfda6d9c, 0x5b23ac2df8067},
+         {0x44935ffdb2566, 0x12f016d176c6e, 0x4fbb00f16f5ae,
+          0x3fab78d99402a, 0x6e965fd847aed},
+         {0x2b953ee80527b, 0x55f5bcdb1b35a, 0x43a0b3fa23c66,
+          0x76e07388b820a, 0x79b9bbb9dd95d}},
+        {{0x17dae8e9f7374, 0x719f76102da33, 0x5117c2a80ca8b,
+          0x41a66b65d0936, 0x1ba811460accb},
+         {0x355406a3126c2, 0x50d1918727d76, 0x6e5ea0b498e0e,
+          0x0a3b6063214f2, 0x5065f158c9fd2},
+         {0x169fb0c429954, 0x59aedd9ecee10, 0x39916eb851802,
+          0x57917555cc538, 0x3981f39e58a4f}},
+        {{0x5dfa56de66fde, 0x0058809075908, 0x6d3d8cb854a94,
+          0x5b2f4e970b1e3, 0x30f4452edcbc1},
+         {0x38a7559230a93, 0x52c1cde8ba31f, 0x2a4f2d4745a3d,
+          0x07e9d42d4a28a, 0x38dc083705acd},
+         {0x52782c5759740, 0x53f3397d990ad, 0x3a939c7e84d15,
+          0x234c4227e39e0, 0x632d9a1a593f2}},
+        {{0x1fd11ed0c84a7, 0x021b3ed2757e1, 0x73e1de58fc1c6,
+          0x5d110c84616ab, 0x3a5a7df28af64},
+         {0x36b15b807cba6, 0x3f78a9e1afed7, 0x0a59c2c608f1f,
+          0x52bdd8ecb81b7, 0x0b24f48847ed4},
+         {0x2d4be511beac7, 0x6bda4d99e5b9b, 0x17e6996914e01,
+          0x7b1f0ce7fcf80, 0x34fcf74475481}},
+        {{0x31dab78cfaa98, 0x4e3216e5e54b7, 0x249823973b689,
+          0x2584984e48885, 0x0119a3042fb37},
+         {0x7e04c789767ca, 0x1671b28cfb832, 0x7e57ea2e1c537,
+          0x1fbaaef444141, 0x3d3bdc164dfa6},
+         {0x2d89ce8c2177d, 0x6cd12ba182cf4, 0x20a8ac19a7697,
+          0x539fab2cc72d9, 0x56c088f1ede20}},
+        {{0x35fac24f38f02, 0x7d75c6197ab03, 0x33e4bc2a42fa7,
+          0x1c7cd10b48145, 0x038b7ea483590},
+         {0x53d1110a86e17, 0x6416eb65f466d, 0x41ca6235fce20,
+          0x5c3fc8a99bb12, 0x09674c6b99108},
+         {0x6f82199316ff8, 0x05d54f1a9f3e9, 0x3bcc5d0bd274a,
+          0x5b284b8d2d5ad, 0x6e5e31025969e}},
+        {{0x4fb0e63066222, 0x130f59747e660, 0x041868fecd41a,
+          0x3105e8c923bc6, 0x3058ad43d1838},
+         {0x462f587e593fb, 0x3d94ba7ce362d, 0x330f9b52667b7,
+          0x5d45a48e0f00a, 0x08f5114789a8d},
+         {0x40ffde57663d0, 0x71445d4c20647, 0x2653e68170f7c,
+          0x64cdee3c55ed6, 0x26549fa4efe3d}}
+    },
+    { /* 256^27 B */
+        {{0x68549af3f666e, 0x09e2941d4bb68, 0x2e8311f5dff3c,
+          0x6429ef91ffbd2, 0x3a10dfe132ce3},
+         {0x55a461e6bf9d6, 0x78eeef4b02e83, 0x1d34f648c16cf,
+          0x07fea2aba5132, 0x1926e1dc6401e},
+         {0x74e8aea17cea0, 0x0c743f83fbc0f, 0x7cb03c4bf5455,
+          0x68a8ba9917e98, 0x1fa1d01d861e5}},
+        {{0x4ac00d1df94ab, 0x3ba2101bd271b, 0x7578988b9c4af,
+          0x0f2bf89f49f7e, 0x73fced18ee9a0},
+         {0x055947d599832, 0x346fe2aa41990, 0x0164c8079195b,
+          0x799ccfb7bba27, 0x773563bc6a75c},
+         {0x1e90863139cb3, 0x4f8b407d9a0d6, 0x58e24ca924f69,
+          0x7a246bbe76456, 0x1f426b701b864}},
+        {{0x635c891a12552, 0x26aebd38ede2f, 0x66dc8faddae05,
+          0x21c7d41a03786, 0x0b76bb1b3fa7e},
+         {0x1264c41911c01, 0x702f44584bdf9, 0x43c511fc68ede,
+          0x0482c3aed35f9, 0x4e1af5271d31b},
+         {0x0c1f97f92939b, 0x17a88956dc117, 0x6ee005ef99dc7,
+          0x4aa9172b231cc, 0x7b6dd61eb772a}},
+        {{0x0abf9ab01d2c7, 0x3880287630ae6, 0x32eca045beddb,
+          0x57f43365f32d0, 0x53fa9b659bff6},
+         {0x5c1e850f33d92, 0x1ec119ab9f6f5, 0x7f16f6de663e9,
+          0x7a7d6cb16dec6, 0x703e9bceaf1d2},
+         {0x4c8e994885455, 0x4ccb5da9cad82, 0x3596bc610e975,
+          0x7a80c0ddb9f5e, 0x398d93e5c4c61}},
+        {{0x77c60d2e7e3f2, 0x4061051763870, 0x67bc4e0ecd2aa,
+          0x2bb941f1373b9, 0x699c9c9002c30},
+         {0x3d16733e248f3, 0x0e2b7e14be389, 0x42c0ddaf6784a,
+          0x589ea1fc67850, 0x53b09b5ddf191},
+         {0x6a7235946f1cc, 0x6b99cbb2fbe60, 0x6d3a5d6485c62,
+          0x4839466e923c0, 0x51caf30c6fcdd}},
+        {{0x2f99a18ac54c7, 0x398a39661ee6f, 0x384331e40cde3,
+          0x4cd15c4de19a6, 0x12ae29c189f8e},
+         {0x3a7427674e00a, 0x6142f4f7e74c1, 0x4cc93318c3a15,
+          0x6d51bac2b1ee7, 0x5504aa292383f},
+         {0x6c0cb1f0d01cf, 0x187469ef5d533, 0x27138883747bf,
+          0x2f52ae53a90e8, 0x5fd14fe958eba}},
+        {{0x2fe5ebf93cb8e, 0x226da8acbe788, 0x10883a2fb7ea1,
+          0x094707842cf44, 0x7dd73f960725d},
+         {0x42ddf2845ab2c, 0x6214ffd3276bb, 0x00b8d181a5246,
+          0x268a6d579eb20, 0x093ff26e58647},
+         {0x524fe68059829, 0x65b75e47cb621, 0x15eb0a5d5cc19,
+          0x05209b3929d5a, 0x2f59bcbc86b47}},
+        {{0x1d560b691c301, 0x7f5bafce3ce08, 0x4cd561614806c,
+          0x4588b6170b188, 0x2aa55e3d01082},
+         {0x47d429917135f, 0x3eacfa07af070, 0x1deab46b46e44,
+          0x7a53f3ba46cdf, 0x5458b42e2e51a},
+         {0x192e60c07444f, 0x5ae8843a21daa, 0x6d721910b1538,
+          0x3321a95a6417e, 0x13e9004a8a768}}
+    },
+    { /* 256^28 B */
+        {{0x600c9193b877f, 0x21c1b8a0d7765, 0x379927fb38ea2,
+          0x70d7679dbe01b, 0x5f46040898de9},
+         {0x58845832fcedb, 0x135cd7f0c6e73, 0x53ffbdfe8e35b,
+          0x22f195e06e55b, 0x73937e8814bce},
+         {0x37116297bf48d, 0x45a9e0d069720, 0x25af71aa744ec,
+          0x41af0cb8aaba3, 0x2cf8a4e891d5e}},
+        {{0x5487e17d06ba2, 0x3872a032d6596, 0x65e28c09348e0,
+          0x27b6bb2ce40c2, 0x7a6f7f2891d6a},
+         {0x3fd8707110f67, 0x26f8716a92db2, 0x1cdaa1b753027,
+          0x504be58b52661, 0x2049bd6e58252},
+         {0x1fd8d6a9aef49, 0x7cb67b7216fa1, 0x67aff53c3b982,
+          0x20ea610da9628, 0x6011aadfc5459}},
+        {{0x6d0c802cbf890, 0x141bfed554c7b, 0x6dbb667ef4263,
+          0x58f3126857edc, 0x69ce18b779340},
+         {0x7926dcf95f83c, 0x42e25120e2bec, 0x63de96df1fa15,
+          0x4f06b50f3f9cc, 0x6fc5cc1b0b62f},
+         {0x75528b29879cb, 0x79a8fd2125a3d, 0x27c8d4b746ab8,
+          0x0f8893f02210c, 0x15596b3ae5710}},
+        {{0x731167e5124ca, 0x17b38e8bbe13f, 0x3d55b942f9056,
+          0x09c1495be913f, 0x3aa4e241afb6d},
+         {0x739d23f9179a2, 0x632fadbb9e8c4, 0x7c8522bfe0c48,
+          0x6ed0983ef5aa9, 0x0d2237687b5f4},
+         {0x138bf2a3305f5, 0x1f45d24d86598, 0x5274bad2160fe,
+          0x1b6041d58d12a, 0x32fcaa6e4687a}},
+        {{0x7a4732787ccdf, 0x11e427c7f0640, 0x03659385f8c64,
+          0x5f4ead9766bfb, 0x746f6336c2600},
+         {0x56e8dc57d9af5, 0x5b3be17be4f78, 0x3bf928cf82f4b,
+          0x52e55600a6f11, 0x4627e9cefebd6},
+         {0x2f345ab6c971c, 0x653286e63e7e9, 0x51061b78a23ad,
+          0x14999acb54501, 0x7b4917007ed66}},
+        {{0x41b28dd53a2dd, 0x37be85f87ea86, 0x74be3d2a85e41,
+          0x1be87fac96ca6, 0x1d03620fe08cd},
+         {0x5fb5cab84b064, 0x2513e778285b0, 0x457383125e043,
+          0x6bda3b56e223d, 0x122ba376f844f},
+         {0x232cda2b4e554, 0x0422ba30ff840, 0x751e7667b43f5,
+          0x6261755da5f3e, 0x02c70bf52b68e}},
+        {{0x532bf458d72e1, 0x40f96e796b59c, 0x22ef79d6f9da3,
+          0x501ab67beca77, 0x6b0697e3feb43},
+         {0x7ec4b5d0b2fbb, 0x200e910595450, 0x742057105715e,
+          0x2f07022530f60, 0x26334f0a409ef},
+         {0x0f04adf62a3c0, 0x5e0edb48bb6d9, 0x7c34aa4fbc003,
+          0x7d74e4e5cac24, 0x1cc37f43441b2}},
+        {{0x656f1c9ceaeb9, 0x7031cacad5aec, 0x1308cd0716c57,
+          0x41c1373941942, 0x3a346f772f196},
+         {0x7565a5cc7324f, 0x01ca0d5244a11, 0x116b067418713,
+          0x0a57d8c55edae, 0x6c6809c103803},
+         {0x55112e2da6ac8, 0x6363d0a3dba5a, 0x319c98ba6f40c,
+          0x2e84b03a36ec7, 0x05911b9f6ef7c}}
+    },
+    { /* 256^29 B */
+        {{0x1acf3512eeaef, 0x2639839692a69, 0x669a234830507,
+          0x68b920c0603d4, 0x555ef9d1c64b2},
+         {0x39983f5df0ebb, 0x1ea2589959826, 0x6ce638703cdd6,
+          0x6311678898505, 0x6b3cecf9aa270},
+         {0x770ba3b73bd08, 0x11475f7e186d4, 0x0251bc9892bbc,
+          0x24eab9bffcc5a, 0x675f4de133817}},
+        {{0x7f6d93bdab31d, 0x1f3aca5bfd425, 0x2fa521c1c9760,
+          0x62180ce27f9cd, 0x60f450b882cd3},
+         {0x452036b1782fc, 0x02d95b07681c5, 0x5901cf99205b2,
+          0x290686e5eecb4, 0x13d99df70164c},
+         {0x35ec321e5c0ca, 0x13ae337f44029, 0x4008e813f2da7,
+          0x640272f8e0c3a, 0x1c06de9e55eda}},
+        {{0x52b40ff6d69aa, 0x31b8809377ffa, 0x536625cd14c2c,
+          0x516af252e17d1, 0x78096f8e7d32b},
+         {0x77ad6a33ec4e2, 0x717c5dc11d321, 0x4a114559823e4,
+          0x306ce50a1e2b1, 0x4cf38a1fec2db},
+         {0x2aa650dfa5ce7, 0x54916a8f19415, 0x00dc96fe71278,
+          0x55f2784e63eb8, 0x373cad3a26091}},
+        {{0x6a8fb89ddbbad, 0x78c35d5d97e37, 0x66e3674ef2cb2,
+          0x34347ac53dd8f, 0x21547eda5112a},
+         {0x4634d82c9f57c, 0x4249268a6d652, 0x6336d687f2ff7,
+          0x4fe4f4e26d9a0, 0x0040f3d945441},
+         {0x5e939fd5986d3, 0x12a2147019bdf, 0x4c466e7d09cb2,
+          0x6fa5b95d203dd, 0x63550a334a254}},
+        {{0x2584572547b49, 0x75c58811c1377, 0x4d3c637cc171b,
+          0x33d30747d34e3, 0x39a92bafaa7d7},
+         {0x7d6edb569cf37, 0x60194a5dc2ca0, 0x5af59745e10a6,
+          0x7a8f53e004875, 0x3eea62c7daf78},
+         {0x4c713e693274e, 0x6ed1b7a6eb3a4, 0x62ace697d8e15,
+          0x266b8292ab075, 0x68436a0665c9c}},
+        {{0x6d317e820107c, 0x090815d2ca3ca, 0x03ff1eb1499a1,
+          0x23960f050e319, 0x5373669c91611},
+         {0x235e8202f3f27, 0x44c9f2eb61780, 0x630905b1d7003,
+          0x4fcc8d274ead1, 0x17b6e7f68ab78},
+         {0x014ab9a0e5257, 0x09939567f8ba5, 0x4b47b2a423c82,
+          0x688d7e57ac42d, 0x1cb4b5a678f87}},
+        {{0x4aa62a2a007e7, 0x61e0e38f62d6e, 0x02f888fcc4782,
+          0x7562b83f21c00, 0x2dc0fd2d82ef6},
+         {0x4c06b394afc6c, 0x4931b4bf636cc, 0x72b60d0322378,
+          0x25127c6818b25, 0x330bca78de743},
+         {0x6ff841119744e, 0x2c560e8e49305, 0x7254fefe5a57a,
+          0x67ae2c560a7df, 0x3c31be1b369f1}},
+        {{0x0bc93f9cb4272, 0x3f8f9db73182d, 0x2b235eabae1c4,
+          0x2ddbf8729551a, 0x41cec1097e7d5},
+         {0x4864d08948aee, 0x5d237438df61e, 0x2b285601f7067,
+          0x25dbcbae6d753, 0x330b61134262d},
+         {0x619d7a26d808a, 0x3c3b3c2adbef2, 0x6877c9eec7f52,
+          0x3beb9ebe1b66d, 0x26b44cd91f287}}
+    },
+    { /* 256^30 B */
+        {{0x7f29362730383, 0x7fd7951459c36, 0x7504c512d49e7,
+          0x087ed7e3bc55f, 0x7deb10149c726},
+         {0x048478f387475, 0x69397d9678a3e, 0x67c8156c976f3,
+          0x2eb4d5589226c, 0x2c709e6c1c10a},
+         {0x2af6a8766ee7a, 0x08aaa79a1d96c, 0x42f92d59b2fb0,
+          0x1752c40009c07, 0x08e68e9ff62ce}},
+        {{0x509d50ab8f2f9, 0x1b8ab247be5e5, 0x5d9b2e6b2e486,
+          0x4faa5479a1339, 0x4cb13bd738f71},
+         {0x5500a4bc130ad, 0x127a17a938695, 0x02a26fa34e36d,
+          0x584d12e1ecc28, 0x2f1f3f87eeba3},
+         {0x48c75e515b64a, 0x75b6952071ef0, 0x5d46d42965406,
+          0x7746106989f9f, 0x19a1e353c0ae2}},
+        {{0x172cdd596bdbd, 0x0731ddf881684, 0x10426d64f8115,
+          0x71a4fd8a9a3da, 0x736bd3990266a},
+         {0x47560bafa05c3, 0x418dcabcc2fa3, 0x35991cecf8682,
+          0x24371a94b8c60, 0x41546b11c20c3},
+         {0x32d509334b3b4, 0x16c102cae70aa, 0x1720dd51bf445,
+          0x5ae662faf9821, 0x412295a2b87fa}},
+        {{0x55261e293eac6, 0x06426759b65cc, 0x40265ae116a48,
+          0x6c02304bae5bc, 0x0760bb8d195ad},
+         {0x19b88f57ed6e9, 0x4cdbf1904a339, 0x42b49cd4e4f2c,
+          0x71a2e771909d9, 0x14e153ebb52d2},
+         {0x61a17cde6818a, 0x53dad34108827, 0x32b32c55c55b6,
+          0x2f9165f9347a3, 0x6b34be9bc33ac}},
+        {{0x469656571f2d3, 0x0aa61ce6f423f, 0x3f940d71b27a1,
+          0x185f19d73d16a, 0x01b9c7b62e6dd},
+         {0x72f643a78c0b2, 0x3de45c04f9e7b, 0x706d68d30fa5c,
+          0x696f63e8e2f24, 0x2012c18f0922d},
+         {0x355e55ac89d29, 0x3e8b414ec7101, 0x39db07c520c90,
+          0x6f41e9b77efe1, 0x08af5b784e4ba}},
+        {{0x314d289cc2c4b, 0x23450e2f1bc4e, 0x0cd93392f92f4,
+          0x1370c6a946b7d, 0x6423c1d5afd98},
+         {0x499dc881f2533, 0x34ef26476c506, 0x4d107d2741497,
+          0x346c4bd6efdb3, 0x32b79d71163a1},
+         {0x5f8d9edfcb36a, 0x1e6e8dcbf3990, 0x7974f348af30a,
+          0x6e6724ef19c7c, 0x480a5efbc13e2}},
+        {{0x14ce442ce221f, 0x18980a72516cc, 0x072f80db86677,
+          0x703331fda526e, 0x24b31d47691c8},
+         {0x1e70b01622071, 0x1f163b5f8a16a, 0x56aaf341ad417,
+          0x7989635d830f7, 0x47aa27600cb7b},
+         {0x41eedc015f8c3, 0x7cf8d27ef854a, 0x289e3584693f9,
+          0x04a7857b309a7, 0x545b585d14dda}},
+        {{0x4e4d0e3b321e1, 0x7451fe3d2ac40, 0x666f678eea98d,
+          0x038858667fead, 0x4d22dc3e64c8d},
+         {0x7275ea0d43a0f, 0x681137dd7ccf7, 0x1e79cbab79a38,
+          0x22a214489a66a, 0x0f62f9c332ba5},
+         {0x46589d63b5f39, 0x7eaf979ec3f96, 0x4ebe81572b9a8,
+          0x21b7f5d61694a, 0x1c0fa01a36371}}
+    },
+    { /* 256^31 B */
+        {{0x02b0e8c936a50, 0x6b83b58b6cd21, 0x37ed8d3e72680,
+          0x0a037db9f2a62, 0x4005419b1d2bc},
+         {0x604b622943dff, 0x1c899f6741a58, 0x60219e2f232fb,
+          0x35fae92a7f9cb, 0x0fa3614f3b1ca},
+         {0x3febdb9be82f0, 0x5e74895921400, 0x553ea38822706,
+          0x5a17c24cfc88c, 0x1fba218aef40a}},
+        {{0x657043e7b0194, 0x5c11b55efe9e7, 0x7737bc6a074fb,
+          0x0eae41ce355cc, 0x6c535d13ff776},
+         {0x49448fac8f53e, 0x34f74c6e8356a, 0x0ad780607dba2,
+          0x7213a7eb63eb6, 0x392e3acaa8c86},
+         {0x534e93e8a35af, 0x08b10fd02c997, 0x26ac2acb81e05,
+          0x09d8c98ce3b79, 0x25e17fe4d50ac}},
+        {{0x77ff576f121a7, 0x4e5f9b0fc722b, 0x46f949b0d28c8,
+          0x4cde65d17ef26, 0x6bba828f89698},
+         {0x09bd71e04f676, 0x25ac841f2a145, 0x1a47eac823871,
+          0x1a8a8c36c581a, 0x255751442a9fb},
+         {0x1bc6690fe3901, 0x314132f5abc5a, 0x611835132d528,
+          0x5f24b8eb48a57, 0x559d504f7f6b7}},
+        {{0x091e7f6d266fd, 0x36060ef037389, 0x18788ec1d1286,
+          0x287441c478eb0, 0x123ea6a3354bd},
+         {0x38378b3eb54d5, 0x4d4aaa78f94ee, 0x4a002e875a74d,
+          0x10b851367b17c, 0x01ab12d5807e3},
+         {0x5189041e32d96, 0x05b062b090231, 0x0c91766e7b78f,
+          0x0aa0f55a138ec, 0x4a3961e2c918a}},
+        {{0x7d644f3233f1e, 0x1c69f9e02c064, 0x36ae5e5266898,
+          0x08fc1dad38b79, 0x68aceead9bd41},
+         {0x43be0f8e6bba0, 0x68fdffc614e3b, 0x4e91dab5b3be0,
+          0x3b1d4c9212ff0, 0x2cd6bce3fb1db},
+         {0x4c90ef3d7c210, 0x496f5a0818716, 0x79cf88cc239b8,
+          0x2cb9c306cf8db, 0x595760d5b508f}},
+        {{0x2cbebfd022790, 0x0b8822aec1105, 0x4d1cfd226bccc,
+          0x515b2fa4971be, 0x2cb2c5df54515},
+         {0x1bfe104aa6397, 0x11494ff996c25, 0x64251623e5800,
+          0x0d49fc5e044be, 0x709fa43edcb29},
+         {0x25d8c63fd2aca, 0x4c5cd29dffd61, 0x32ec0eb48af05,
+          0x18f9391f9b77c, 0x70f029ecf0c81}},
+        {{0x2afaa5e10b0b9, 0x61de08355254d, 0x0eb587de3c28d,
+          0x4f0bb9f7dbbd5, 0x44eca5a2a74bd},
+         {0x307b32eed3e33, 0x6748ab03ce8c2, 0x57c0d9ab810bc,
+          0x42c64a224e98c, 0x0b7d5d8a6c314},
+         {0x448327b95d543, 0x0146681e3a4ba, 0x38714adc34e0c,
+          0x4f26f0e298e30, 0x272224512c7de}},
+        {{0x3bb8a42a975fc, 0x6f2d5b46b17ef, 0x7b6a9223170e5,
+          0x053713fe3b7e6, 0x19735fd7f6bc2},
+         {0x492af49c5342e, 0x2365cdf5a0357, 0x32138a7ffbb60,
+          0x2a1f7d14646fe, 0x11b5df18a44cc},
+         {0x390d042c84266, 0x1efe32a8fdc75, 0x6925ee7ae1238,
+          0x4af9281d0e832, 0x0fef911191df8}}
+    },
+    { /* 256^32 B */
+        {{0x05c014dce6191, 0x14923f3bf9aad, 0x0301b7da7914a,
+          0x55563449094c1, 0x13f85b8ffc7ed},
+         {0x0fe097e44b439, 0x06ae10fbae24d, 0x6b66cf38d3ea2,
+          0x74c1a65caab98, 0x6c9068c07c8de},
+         {0x16cbad956f568, 0x14c163b48e00b, 0x77143370c5c64,
+          0x53cc4bb05e3c3, 0x31a35ea4c1a2f}},
+        {{0x7da8fb551086a, 0x5c5bce743e9ee, 0x220e859aa3027,
+          0x79b0243561116, 0x23bb4c073624f},
+         {0x1ff2a27e6c06b, 0x55e17b0963120, 0x26ea79418fa98,
+          0x18657912ecb7f, 0x7cb33327137b9},
+         {0x2133c7a03dc75, 0x031156ef7b8bd, 0x27e856cb00a85,
+          0x6dee44d808491, 0x4aad4d476d908}},
+        {{0x2b335cde14277, 0x459ec55ee5645, 0x276cef9145360,
+          0x53e0ca6f776e7, 0x6fd50e08e927a},
+         {0x51fb8f402ca86, 0x0c1672cbdf7c3, 0x46cb5f06eb4c4,
+          0x5a0b5ac44ed80, 0x475754ca97138},
+         {0x49e4794b98ccf, 0x4bdabbb77dc13, 0x4e5157a2b8d67,
+          0x5cc86102b362b, 0x78c7431103c0e}},
+        {{0x1999428ff64ce, 0x4605d52ea206d, 0x4484b37e61037,
+          0x16bc6d93d2730, 0x7de1c06a98fab},
+         {0x0574a4e545d68, 0x3a9a486312921, 0x6280d345012be,
+          0x73bf02a4a70da, 0x65ed618ff02e0},
+         {0x19434706f90cd, 0x603e892a150af, 0x41d24b7327482,
+          0x5c966ecbac859, 0x12bf1f7672b52}},
+        {{0x52cfa663bada3, 0x1af1edb7817c9, 0x7d6e195c70902,
+          0x56e79829bb722, 0x700260516336c},
+         {0x7360259e4a2b4, 0x3ab3fe24fcb02, 0x16853c38e9df2,
+          0x60e7e2c72faf6, 0x6dfa400552f8a},
+         {0x63397477eb4a6, 0x488c29901f808, 0x41975c4ee838a,
+          0x0d98175fd9c6d, 0x090bfb88c932b}},
+        {{0x585451c067c9d, 0x2f3e8ac70844c, 0x7b178c7777eab,
+          0x1788646aa3ceb, 0x67c7bbc48b2ce},
+         {0x41804b3e1cfc3, 0x771e189164519, 0x5b38e6b58b7fa,
+          0x507d7399fdbe9, 0x11e34711e78c7},
+         {0x1b61add7cb552, 0x1e63b68c07e95, 0x705ba96b77606,
+          0x7b14ac2522204, 0x04d40b42e7327}},
+        {{0x5284af7880d4c, 0x6e4ac1dafe4d3, 0x108a1fba3e066,
+          0x7c734e33d6f67, 0x0172a6600818b},
+         {0x28b0399522db7, 0x3bbd9396326b8, 0x259caf76bbc17,
+          0x75db951ec25a1, 0x43f19cf2c5290},
+         {0x2ed09d9a7c59d, 0x044ed2f40717d, 0x7304968ac119a,
+          0x002dd33d7fb2b, 0x4f69fa7e70d00}},
+        {{0x1d74c963d91b5, 0x0b93a59bf2d98, 0x65fb0f50c9cfd,
+          0x3bfea2c7f28c0, 0x0f379164c0134},
+         {0x64340cc39ed0b, 0x0ea69cce6ad23, 0x12f16c51b0241,
+          0x7c670cf088362, 0x50f4acd127ffa},
+         {0x6b665cc80503e, 0x5722c5ffeb242, 0x30fe0bf49bfd5,
+          0x454ec4a43795a, 0x1322710d7136a}}
+    }
+#else
+    { /* 256^0 B */
+        {{25967493, 19198397, 29566455, 3660896, 54414519,
+          4014786, 27544626, 21800161, 61029707, 2047604},
+         {54563134, 934261, 64385954, 3049989, 66381436,
+          9406985, 12720692, 5043384, 19500929, 18085054},
+         {58370664, 4489569, 9688441, 18769238, 10184608,
+          21191052, 29287918, 11864899, 42594502, 29115885}},
+        {{54292951, 20578084, 45527620, 11784319, 41753206,
+          30803714, 55390960, 29739860, 66750418, 23343128},
+         {45405608, 6903824, 27185491, 6451973, 37531140,
+          24000426, 51492312, 11189267, 40279186, 28235350},
+         {26966623, 11152617, 32442495, 15396054, 14353839,
+          20802097, 63980037, 24013313, 51636816, 29387734}},
+        {{15636272, 23865875, 24204772, 25642034, 616976,
+          16869170, 27787599, 18782243, 28944399, 32004408},
+         {16568933, 4717097, 55552716, 32452109, 15682895,
+          21747389, 16354576, 21778470, 7689661, 11199574},
+         {30464137, 27578307, 55329429, 17883566, 23220364,
+          15915852, 7512774, 10017326, 49359771, 23634074}},
+        {{50071967, 13921891, 10945806, 27521001, 27105051,
+          17470053, 38182653, 15006022, 3284568, 27277892},
+         {23599295, 25248385, 55915199, 25867015, 13236773,
+          10506355, 7464579, 9656445, 13059162, 10374397},
+         {7798537, 16710257, 3033922, 2874086, 28997861,
+          2835604, 32406664, 29715387, 66467155, 33453106}},
+        {{10861363, 11473154, 27284546, 1981175, 37044515,
+          12577860, 32867885, 14515107, 51670560, 10819379},
+         {4708026, 6336745, 20377586, 9066809, 55836755,
+          6594695, 41455196, 12483687, 54440373, 5581305},
+         {19563141, 16186464, 37722007, 4097518, 10237984,
+          29206317, 28542349, 13850243, 43430843, 17738489}},
+        {{51736881, 20691677, 32573249, 4720197, 40672342,
+          5875510, 47920237, 18329612, 57289923, 21468654},
+         {58559652, 109982, 15149363, 2178705, 22900618,
+          4543417, 3044240, 17864545, 1762327, 14866737},
+         {48909169, 17603008, 56635573, 1707277, 49922944,
+          3916100, 38872452, 3959420, 27914454, 4383652}},
+        {{5153727, 9909285, 1723747, 30776558, 30523604,
+          5516873, 19480852, 5230134, 43156425, 18378665},
+         {36839857, 30090922, 7665485, 10083793, 28475525,
+          1649722, 20654025, 16520125, 30598449, 7715701},
+         {28881826, 14381568, 9657904, 3680757, 46927229,
+          7843315, 35708204, 1370707, 29794553, 32145132}},
+        {{14499471, 30824833, 33917750, 29299779, 28494861,
+          14271267, 30290735, 10876454, 33954766, 2381725},
+         {59913433, 30899068, 52378708, 462250, 39384538,
+          3941371, 60872247, 3696004, 34808032, 15351954},
+         {27431194, 8222322, 16448760, 29646437, 48401861,
+          11938354, 34147463, 30583916, 29551812, 10109425}}
+    },
+    { /* 256^1 B */
+        {{53451805, 20399000, 35825113, 11777097, 21447386,
+          6519384, 64730580, 31926875, 10092782, 28790261},
+         {27939166, 14210322, 4677035, 16277044, 44144402,
+          21156292, 34600109, 12005537, 49298737, 12803509},
+         {17228999, 17892808, 65875336, 300139, 65883994,
+          21839654, 30364212, 24516238, 18016356, 4397660}},
+        {{56150021, 25864224, 4776340, 18600194, 27850027,
+          17952220, 40489757, 14544524, 49631360, 982638},
+         {29253598, 15796703, 64244882, 23645547, 10057022,
+          3163536, 7332899, 29434304, 46061167, 9934962},
+         {5793284, 16271923, 42977250, 23438027, 29188559,
+          1206517, 52360934, 4559894, 36984942, 22656481}},
+        {{39464912, 22061425, 16282656, 22517939, 28414020,
+          18542168, 24191033, 4541697, 53770555, 5500567},
+         {12650548, 32057319, 9052870, 11355358, 49428827,
+          25154267, 49678271, 12264342, 10874051, 13524335},
+         {25556948, 30508442, 714650, 2510400, 23394682,
+          23139102, 33119037, 5080568, 44580805, 5376627}},
+        {{41020600, 29543379, 50095164, 30016803, 60382070,
+          1920896, 44787559, 24106988, 4535767, 1569007},
+         {64853442, 14606629, 45416424, 25514613, 28430648,
+          8775819, 36614302, 3044289, 31848280, 12543772},
+         {45080285, 2943892, 35251351, 6777305, 13784462,
+          29262229, 39731668, 31491700, 7718481, 14474653}},
+        {{2385296, 2454213, 44477544, 46602, 62670929,
+          17874016, 656964, 26317767, 24316167, 28300865},
+         {13741529, 10911568, 33875447, 24950694, 46931033,
+          32521134, 33040650, 20129900, 46379407, 8321685},
+         {21060490, 31341688, 15712756, 29218333, 1639039,
+          10656336, 23845965, 21679594, 57124405, 608371}},
+        {{53436132, 18466845, 56219170, 25997372, 61071954,
+          11305546, 1123968, 26773855, 27229398, 23887},
+         {43864724, 33260226, 55364135, 14712570, 37643165,
+          31524814, 12797023, 27114124, 65475458, 16678953},
+         {37608244, 4770661, 51054477, 14001337, 7830047,
+          9564805, 65600720, 28759386, 49939598, 4904952}},
+        {{24059538, 14617003, 19037157, 18514524, 19766092,
+          18648003, 5169210, 16191880, 2128236, 29227599},
+         {50127693, 4124965, 58568254, 22900634, 30336521,
+          19449185, 37302527, 916032, 60226322, 30567899},
+         {44477957, 12419371, 59974635, 26081060, 50629959,
+          16739174, 285431, 2763829, 15736322, 4143876}},
+        {{2379333, 11839345, 62998462, 27565766, 11274297,
+          794957, 212801, 18959769, 23527083, 17096164},
+         {33431108, 22423954, 49269897, 17927531, 8909498,
+          8376530, 34483524, 4087880, 51919953, 19138217},
+         {1767664, 7197987, 53903638, 31531796, 54017513,
+          448825, 5799055, 4357868, 62334673, 17231393}}
+    },
+    { /* 256^2 B */
+        {{6721966, 13833823, 43585476, 32003117, 26354292,
+          21691111, 23365146, 29604700, 7390889, 2759800},
+         {4409022, 2052381, 23373853, 10530217, 7676779,
+          20668478, 21302352, 29290375, 1244379, 20634787},
+         {62687625, 7169618, 4982368, 30596842, 30256824,
+          30776892, 14086412, 9208236, 15886429, 16489664}},
+        {{1996056, 10375649, 14346367, 13311202, 60234729,
+          17116020, 53415665, 398368, 36502409, 32841498},
+         {41801399, 9795879, 64331450, 14878808, 33577029,
+          14780362, 13348553, 12076947, 36272402, 5113181},
+         {49338080, 11797795, 31950843, 13929123, 41220562,
+          12288343, 36767763, 26218045, 13847710, 5387222}},
+        {{48526701, 30138214, 17824842, 31213466, 22744342,
+          23111821, 8763060, 3617786, 47508202, 10370990},
+         {20246567, 19185054, 22358228, 33010720, 18507282,
+          23140436, 14554436, 24808340, 32232923, 16763880},
+         {9648486, 10094563, 26416693, 14745928, 36734546,
+          27081810, 11094160, 15689506, 3140038, 17044340}},
+        {{50948792, 5472694, 31895588, 4744994, 8823515,
+          10365685, 39884064, 9448612, 38334410, 366294},
+         {19153450, 11523972, 56012374, 27051289, 42461232,
+          5420646, 28344573, 8041113, 719605, 11671788},
+         {8678006, 2694440, 60300850, 2517371, 4964326,
+          11152271, 51675948, 18287915, 27000812, 23358879}},
+        {{51950941, 7134311, 8639287, 30739555, 59873175,
+          10421741, 564065, 5336097, 6750977, 19033406},
+         {11836410, 29574944, 26297893, 16080799, 23455045,
+          15735944, 1695823, 24735310, 8169719, 16220347},
+         {48993007, 8653646, 17578566, 27461813, 59083086,
+          17541668, 55964556, 30926767, 61118155, 19388398}},
+        {{43800366, 22586119, 15213227, 23473218, 36255258,
+          22504427, 27884328, 2847284, 2655861, 1738395},
+         {39571412, 19301410, 41772562, 25551651, 57738101,
+          8129820, 21651608, 30315096, 48021414, 22549153},
+         {1533110, 3437855, 23735889, 459276, 29970501,
+          11335377, 26030092, 5821408, 10478196, 8544890}},
+        {{32173102, 17425121, 24896206, 3921497, 22579056,
+          30143578, 19270448, 12217473, 17789017, 30158437},
+         {36555903, 31326030, 51530034, 23407230, 13243888,
+          517024, 15479401, 29701199, 30460519, 1052596},
+         {55493970, 13323617, 32618793, 8175907, 51878691,
+          12596686, 27491595, 28942073, 3179267, 24075541}},
+        {{31947050, 19187781, 62468280, 18214510, 51982886,
+          27514722, 52352086, 17142691, 19072639, 24043372},
+         {11685058, 11822410, 3158003, 19601838, 33402193,
+          29389366, 5977895, 28339415, 473098, 5040608},
+         {46817982, 8198641, 39698732, 11602122, 1290375,
+          30754672, 28326861, 1721092, 47550222, 30422825}}
+    },
+    { /* 256^3 B */
+        {{7881532, 10687937, 7578723, 7738378, 48157852,
+          31000479, 21820785, 8076149, 39240368, 11538388},
+         {47173198, 3899860, 18283497, 26752864, 51380203,
+          22305220, 8754524, 7446702, 61432810, 5797015},
+         {55813245, 29760862, 51326753, 25589858, 12708868,
+          25098233, 2014098, 24503858, 64739691, 27677090}},
+        {{44636488, 21985690, 39426843, 1146374, 18956691,
+          16640559, 1192730, 29840233, 15123618, 10811505},
+         {14352079, 30134717, 48166819, 10822654, 32750596,
+          4699007, 67038501, 15776355, 38222085, 21579878},
+         {38867681, 25481956, 62129901, 28239114, 29416930,
+          1847569, 46454691, 17069576, 4714546, 23953777}},
+        {{15200332, 8368572, 19679101, 15970074, 35236190,
+          1959450, 24611599, 29010600, 55362987, 12340219},
+         {12876937, 23074376, 33134380, 6590940, 60801088,
+          14872439, 9613953, 8241152, 15370987, 9608631},
+         {62965568, 21540023, 8446280, 33162829, 4407737,
+          13629032, 59383996, 15866073, 38898243, 24740332}},
+        {{26660628, 17876777, 8393733, 358047, 59707573,
+          992987, 43204631, 858696, 20571223, 8420556},
+         {14620696, 13067227, 51661590, 8264466, 14106269,
+          15080814, 33531827, 12516406, 45534429, 21077682},
+         {236881, 10476226, 57258, 18877408, 6472997,
+          2466984, 17258519, 7256740, 8791136, 15069930}},
+        {{1276391, 24182514, 22949634, 17231625, 43615824,
+          27852245, 14711874, 4874229, 36445724, 31223040},
+         {5855666, 4990204, 53397016, 7294283, 59304582,
+          1924646, 65685689, 25642053, 34039526, 9234252},
+         {20590503, 24535444, 31529743, 26201766, 64402029,
+          10650547, 31559055, 21944845, 18979185, 13396066}},
+        {{24474287, 4968103, 22267082, 4407354, 24063882,
+          25229252, 48291976, 13594781, 33514650, 7021958},
+         {55541958, 26988926, 45743778, 15928891, 40950559,
+          4315420, 41160136, 29637754, 45628383, 12868081},
+         {38473832, 13504660, 19988037, 31421671, 21078224,
+          6443208, 45662757, 2244499, 54653067, 25465048}},
+        {{36513336, 13793478, 61256044, 319135, 41385692,
+          27290532, 33086545, 8957937, 51875216, 5540520},
+         {55478669, 22050529, 58989363, 25911358, 2620055,
+          1022908, 43398120, 31985447, 50980335, 18591624},
+         {23152952, 775386, 27395463, 14006635, 57407746,
+          4649511, 1689819, 892185, 55595587, 18348483}},
+        {{9770129, 9586738, 26496094, 4324120, 1556511,
+          30004408, 27453818, 4763127, 47929250, 5867133},
+         {34343820, 1927589, 31726409, 28801137, 23962433,
+          17534932, 27846558, 5931263, 37359161, 17445976},
+         {27461885, 30576896, 22380809, 1815854, 44075111,
+          30522493, 7283489, 18406359, 47582163, 7734628}}
+    },
+    { /* 256^4 B */
+        {{59098600, 23963614, 55988460, 6196037, 29344158,
+          20123547, 7585294, 30377806, 18549496, 15302069},
+         {34450527, 27383209, 59436070, 22502750, 6258877,
+          13504381, 10458790, 27135971, 58236621, 8424745},
+         {24687186, 8613276, 36441818, 30320886, 1863891,
+          31723888, 19206233, 7134917, 55824382, 32725512}},
+        {{11334899, 24336410, 8025292, 12707519, 17523892,
+          23078361, 10243737, 18868971, 62042829, 16498836},
+         {8911542, 6887158, 57524604, 26595841, 11145640,
+          24010752, 17303924, 19430194, 6536640, 10543906},
+         {38162480, 15479762, 49642029, 568875, 65611181,
+          11223453, 64439674, 16928857, 39873154, 8876770}},
+        {{41365946, 20987567, 51458897, 32707824, 34082177,
+          32758143, 33627041, 15824473, 66504438, 24514614},
+         {10330056, 70051, 7957388, 24551765, 9764901,
+          15609756, 27698697, 28664395, 1657393, 3084098},
+         {10477963, 26084172, 12119565, 20303627, 29016246,
+          28188843, 31280318, 14396151, 36875289, 15272408}},
+        {{54820555, 3169462, 28813183, 16658753, 25116432,
+          27923966, 41934906, 20918293, 42094106, 1950503},
+         {40928506, 9489186, 11053416, 18808271, 36055143,
+          5825629, 58724558, 24786899, 15341278, 8373727},
+         {28685821, 7759505, 52730348, 21551571, 35137043,
+          4079241, 298136, 23321830, 64230656, 15190419}},
+        {{34175969, 13806335, 52771379, 17760000, 43104243,
+          10940927, 8669718, 2742393, 41075551, 26679428},
+         {65528476, 21825014, 41129205, 22109408, 49696989,
+          22641577, 9291593, 17306653, 54954121, 6048604},
+         {36803549, 14843443, 1539301, 11864366, 20201677,
+          1900163, 13934231, 5128323, 11213262, 9168384}},
+        {{40828332, 11007846, 19408960, 32613674, 48515898,
+          29225851, 62020803, 22449281, 20470156, 17155731},
+         {43972811, 9282191, 14855179, 18164354, 59746048,
+          19145871, 44324911, 14461607, 14042978, 5230683},
+         {29969548, 30812838, 50396996, 25001989, 9175485,
+          31085458, 21556950, 3506042, 61174973, 21104723}},
+        {{63964118, 8744660, 19704003, 4581278, 46678178,
+          6830682, 45824694, 8971512, 38569675, 15326562},
+         {47644235, 10110287, 49846336, 30050539, 43608476,
+          1355668, 51585814, 15300987, 46594746, 9168259},
+         {61755510, 4488612, 43305616, 16314346, 7780487,
+          17915493, 38160505, 9601604, 33087103, 24543045}},
+        {{47665694, 18041531, 46311396, 21109108, 37284416,
+          10229460, 39664535, 18553900, 61111993, 15664671},
+         {23294591, 16921819, 44458082, 25083453, 27844203,
+          11461195, 13099750, 31094076, 18151675, 13417686},
+         {42385932, 29377914, 35958184, 5988918, 40250079,
+          6685064, 1661597, 21002991, 15271675, 18101767}}
+    },
+    { /* 256^5 B */
+        {{11433023, 20325767, 8239630, 28274915, 65123427,
+          32828713, 48410099, 2167543, 60187563, 20114249},
+         {35672693, 15575145, 30436815, 12192228, 44645511,
+          9395378, 57191156, 24915434, 12215109, 12028277},
+         {14098381, 6555944, 23007258, 5757252, 51681032,
+          20603929, 30123439, 4617780, 50208775, 32898803}},
+        {{63082644, 18313596, 11893167, 13718664, 52299402,
+          1847384, 51288865, 10154008, 23973261, 20869958},
+         {40577025, 29858441, 65199965, 2534300, 35238307,
+          17004076, 18341389, 22134481, 32013173, 23450893},
+         {41629544, 10876442, 55337778, 18929291, 54739296,
+          1838103, 21911214, 6354752, 4425632, 32716610}},
+        {{56675475, 18941465, 22229857, 30463385, 53917697,
+          776728, 49693489, 21533969, 4725004, 14044970},
+         {19268631, 26250011, 1555348, 8692754, 45634805,
+          23643767, 6347389, 32142648, 47586572, 17444675},
+         {42244775, 12986007, 56209986, 27995847, 55796492,
+          33405905, 19541417, 8180106, 9282262, 10282508}},
+        {{40903763, 4428546, 58447668, 20360168, 4098401,
+          19389175, 15522534, 8372215, 5542595, 22851749},
+         {56546323, 14895632, 26814552, 16880582, 49628109,
+          31065071, 64326972, 6993760, 49014979, 10114654},
+         {47001790, 32625013, 31422703, 10427861, 59998115,
+          6150668, 38017109, 22025285, 25953724, 33448274}},
+        {{62874467, 25515139, 57989738, 3045999, 2101609,
+          20947138, 19390019, 6094296, 63793585, 12831124},
+         {51110167, 7578151, 5310217, 14408357, 33560244,
+          33329692, 31575953, 6326196, 7381791, 31132593},
+         {46206085, 3296810, 24736065, 17226043, 18374253,
+          7318640, 6295303, 8082724, 51746375, 12339663}},
+        {{27724736, 2291157, 6088201, 19369634, 1792726,
+          5857634, 13848414, 15768922, 25091167, 14856294},
+         {48242193, 8331042, 24373479, 8541013, 66406866,
+          24284974, 12927299, 20858939, 44926390, 24541532},
+         {55685435, 28132841, 11632844, 3405020, 30536730,
+          21880393, 39848098, 13866389, 30146206, 9142070}},
+        {{3924129, 18246916, 53291741, 23499471, 12291819,
+          32886066, 39406089, 9326383, 58871006, 4171293},
+         {51186905, 16037936, 6713787, 16606682, 45496729,
+          2790943, 26396185, 3731949, 345228, 28091483},
+         {45781307, 13448258, 25284571, 1143661, 20614966,
+          24705045, 2031538, 21163201, 50855680, 19972348}},
+        {{31016192, 16832003, 26371391, 19103199, 62081514,
+          14854136, 17477601, 3842657, 28012650, 17149012},
+         {62033029, 9368965, 58546785, 28953529, 51858910,
+          6970559, 57918991, 16292056, 58241707, 3507939},
+         {29439664, 3537914, 23333589, 6997794, 49553303,
+          22536363, 51899661, 18503164, 57943934, 6580395}}
+    },
+    { /* 256^6 B */
+        {{54923003, 25874643, 16438268, 10826160, 58412047,
+          27318820, 17860443, 24280586, 65013061, 9304566},
+         {20714545, 29217521, 29088194, 7406487, 11426967,
+          28458727, 14792666, 18945815, 5289420, 33077305},
+         {50443312, 22903641, 60948518, 20248671, 9192019,
+          31751970, 17271489, 12349094, 26939669, 29802138}},
+        {{54218966, 9373457, 31595848, 16374215, 21471720,
+          13221525, 39825369, 21205872, 63410057, 117886},
+         {22263325, 26994382, 3984569, 22379786, 51994855,
+          32987646, 28311252, 5358056, 43789084, 541963},
+         {16259200, 3261970, 2309254, 18019958, 50223152,
+          28972515, 24134069, 16848603, 53771797, 20002236}},
+        {{9378160, 20414246, 44262881, 20809167, 28198280,
+          26310334, 64709179, 32837080, 690425, 14876244},
+         {24977353, 33240048, 58884894, 20089345, 28432342,
+          32378079, 54040059, 21257083, 44727879, 6618998},
+         {65570671, 11685645, 12944378, 13682314, 42719353,
+          19141238, 8044828, 19737104, 32239828, 27901670}},
+        {{48505798, 4762989, 66182614, 8885303, 38696384,
+          30367116, 9781646, 23204373, 32779358, 5095274},
+         {34100715, 28339925, 34843976, 29869215, 9460460,
+          24227009, 42507207, 14506723, 21639561, 30924196},
+         {50707921, 20442216, 25239337, 15531969, 3987758,
+          29055114, 65819361, 26690896, 17874573, 558605}},
+        {{53508735, 10240080, 9171883, 16131053, 46239610,
+          9599699, 33499487, 5080151, 2085892, 5119761},
+         {44903700, 31034903, 50727262, 414690, 42089314,
+          2170429, 30634760, 25190818, 35108870, 27794547},
+         {60263160, 15791201, 8550074, 32241778, 29928808,
+          21462176, 27534429, 26362287, 44757485, 12961481}},
+        {{42616785, 23983660, 10368193, 11582341, 43711571,
+          31309144, 16533929, 8206996, 36914212, 28394793},
+         {55987368, 30172197, 2307365, 6362031, 66973409,
+          8868176, 50273234, 7031274, 7589640, 8945490},
+         {34956097, 8917966, 6661220, 21876816, 65916803,
+          17761038, 7251488, 22372252, 24099108, 19098262}},
+        {{5019539, 25646962, 4244126, 18840076, 40175591,
+          6453164, 47990682, 20265406, 60876967, 23273695},
+         {10853575, 10721687, 26480089, 5861829, 44113045,
+          1972174, 65242217, 22996533, 63745412, 27113307},
+         {50106456, 5906789, 221599, 26991285, 7828207,
+          20305514, 24362660, 31546264, 53242455, 7421391}},
+        {{8139908, 27007935, 32257645, 27663886, 30375718,
+          1886181, 45933756, 15441251, 28826358, 29431403},
+         {6267067, 9695052, 7709135, 16950835, 34239795,
+          31668296, 14795159, 25714308, 13746020, 31812384},
+         {28584883, 7787108, 60375922, 18503702, 22846040,
+          25983196, 63926927, 33190907, 4771361, 25134474}}
+    },
+    { /* 256^7 B */
+        {{24949256, 6376279, 39642383, 25379823, 48462709,
+          23623825, 33543568, 21412737, 3569626, 11342593},
+         {26514970, 4740088, 27912651, 3697550, 19331575,
+          22082093, 6809885, 4608608, 7325975, 18753361},
+         {55490446, 19000001, 42787651, 7655127, 65739590,
+          5214311, 39708324, 10258389, 49462170, 25367739}},
+        {{11431185, 15823007, 26570245, 14329124, 18029990,
+          4796082, 35662685, 15580663, 9280358, 29580745},
+         {66948081, 23228174, 44253547, 29249434, 46247496,
+          19933429, 34297962, 22372809, 51563772, 4387440},
+         {46309467, 12194511, 3937617, 27748540, 39954043,
+          9340369, 42594872, 8548136, 20617071, 26072431}},
+        {{66170039, 29623845, 58394552, 16124717, 24603125,
+          27329039, 53333511, 21678609, 24345682, 10325460},
+         {47253587, 31985546, 44906155, 8714033, 14007766,
+          6928528, 16318175, 32543743, 4766742, 3552007},
+         {45357481, 16823515, 1351762, 32751011, 63099193,
+          3950934, 3217514, 14481909, 10988822, 29559670}},
+        {{15564307, 19242862, 3101242, 5684148, 30446780,
+          25503076, 12677126, 27049089, 58813011, 13296004},
+         {57666574, 6624295, 36809900, 21640754, 62437882,
+          31497052, 31521203, 9614054, 37108040, 12074673},
+         {4771172, 33419193, 14290748, 20464580, 27992297,
+          14998318, 65694928, 31997715, 29832612, 17163397}},
+        {{7064884, 26013258, 47946901, 28486894, 48217594,
+          30641695, 25825241, 5293297, 39986204, 13101589},
+         {64810282, 2439669, 59642254, 1719964, 39841323,
+          17225986, 32512468, 28236839, 36752793, 29363474},
+         {37102324, 10162315, 33928688, 3981722, 50626726,
+          20484387, 14413973, 9515896, 19568978, 9628812}},
+        {{33053803, 199357, 15894591, 1583059, 27380243,
+          28973997, 49269969, 27447592, 60817077, 3437739},
+         {48129987, 3884492, 19469877, 12726490, 15913552,
+          13614290, 44147131, 70103, 7463304, 4176122},
+         {39984863, 10659916, 11482427, 17484051, 12771466,
+          26919315, 34389459, 28231680, 24216881, 5944158}},
+        {{8894125, 7450974, 64444715, 23788679, 39028346,
+          21165316, 19345745, 14680796, 11632993, 5847885},
+         {26942781, 31239115, 9129563, 28647825, 26024104,
+          11769399, 55590027, 6367193, 57381634, 4782139},
+         {19916442, 28726022, 44198159, 22140040, 25606323,
+          27581991, 33253852, 8220911, 6358847, 31680575}},
+        {{801428, 31472730, 16569427, 11065167, 29875704,
+          96627, 7908388, 29073952, 53570360, 1387154},
+         {19646058, 5720633, 55692158, 12814208, 11607948,
+          12749789, 14147075, 15156355, 45242033, 11835259},
+         {19299512, 1155910, 28703737, 14890794, 2925026,
+          7269399, 26121523, 15467869, 40548314, 5052482}}
+    },
+    { /* 256^8 B */
+        {{64091413, 10058205, 1980837, 3964243, 22160966,
+          12322533, 60677741, 20936246, 12228556, 26550755},
+         {32944382, 14922211, 44263970, 5188527, 21913450,
+          24834489, 4001464, 13238564, 60994061, 8653814},
+         {22865569, 28901697, 27603667, 21009037, 14348957,
+          8234005, 24808405, 5719875, 28483275, 2841751}},
+        {{50687877, 32441126, 66781144, 21446575, 21886281,
+          18001658, 65220897, 33238773, 19932057, 20815229},
+         {55452759, 10087520, 58243976, 28018288, 47830290,
+          30498519, 3999227, 13239134, 62331395, 19644223},
+         {1382174, 21859713, 17266789, 9194690, 53784508,
+          9720080, 20403944, 11284705, 53095046, 3093229}},
+        {{16650902, 22516500, 66044685, 1570628, 58779118,
+          7352752, 66806440, 16271224, 43059443, 26862581},
+         {45197768, 27626490, 62497547, 27994275, 35364760,
+          22769138, 24123613, 15193618, 45456747, 16815042},
+         {57172930, 29264984, 41829040, 4372841, 2087473,
+          10399484, 31870908, 14690798, 17361620, 11864968}},
+        {{55801235, 6210371, 13206574, 5806320, 38091172,
+          19587231, 54777658, 26067830, 41530403, 17313742},
+         {14668443, 21284197, 26039038, 15305210, 25515617,
+          4542480, 10453892, 6577524, 9145645, 27110552},
+         {5974855, 3053895, 57675815, 23169240, 35243739,
+          3225008, 59136222, 3936127, 61456591, 30504127}},
+        {{30625386, 28825032, 41552902, 20761565, 46624288,
+          7695098, 17097188, 17250936, 39109084, 1803631},
+         {63555773, 9865098, 61880298, 4272700, 61435032,
+          16864731, 14911343, 12196514, 45703375, 7047411},
+         {20093258, 9920966, 55970670, 28210574, 13161586,
+          12044805, 34252013, 4124600, 34765036, 23296865}},
+        {{46320040, 14084653, 53577151, 7842146, 19119038,
+          19731827, 4752376, 24839792, 45429205, 2288037},
+         {40289628, 30270716, 29965058, 3039786, 52635099,
+          2540456, 29457502, 14625692, 42289247, 12570231},
+         {66045306, 22002608, 16920317, 12494842, 1278292,
+          27685323, 45948920, 30055751, 55134159, 4724942}},
+        {{17960970, 21778898, 62967895, 23851901, 58232301,
+          32143814, 54201480, 24894499, 37532563, 1903855},
+         {23134274, 19275300, 56426866, 31942495, 20684484,
+          15770816, 54119114, 3190295, 26955097, 14109738},
+         {15308788, 5320727, 36995055, 19235554, 22902007,
+          7767164, 29425325, 22276870, 31960941, 11934971}},
+        {{39713153, 8435795, 4109644, 12222639, 42480996,
+          14818668, 20638173, 4875028, 10491392, 1379718},
+         {53949449, 9197840, 3875503, 24618324, 65725151,
+          27674630, 33518458, 16176658, 21432314, 12180697},
+         {55321537, 11500837, 13787581, 19721842, 44678184,
+          10140204, 1465425, 12689540, 56807545, 19681548}}
+    },
+    { /* 256^9 B */
+        {{5414091, 18168391, 46101199, 9643569, 12834970,
+          1186149, 64485948, 32212200, 26128230, 6032912},
+         {40771450, 19788269, 32496024, 19900513, 17847800,
+          20885276, 3604024, 8316894, 41233830, 23117073},
+         {3296484, 6223048, 24680646, 21307972, 44056843,
+          5903204, 58246567, 28915267, 12376616, 3188849}},
+        {{29190469, 18895386, 27549112, 32370916, 3520065,
+          22857131, 32049514, 26245319, 50999629, 23702124},
+         {52364359, 24245275, 735817, 32955454, 46701176,
+          28496527, 25246077, 17758763, 18640740, 32593455},
+         {60180029, 17123636, 10361373, 5642961, 4910474,
+          12345252, 35470478, 33060001, 10530746, 1053335}},
+        {{37842897, 19367626, 53570647, 21437058, 47651804,
+          22899047, 35646494, 30605446, 24018830, 15026644},
+         {44516310, 30409154, 64819587, 5953842, 53668675,
+          9425630, 25310643, 13003497, 64794073, 18408815},
+         {39688860, 32951110, 59064879, 31885314, 41016598,
+          13987818, 39811242, 187898, 43942445, 31022696}},
+        {{45364466, 19743956, 1844839, 5021428, 56674465,
+          17642958, 9716666, 16266922, 62038647, 726098},
+         {29370903, 27500434, 7334070, 18212173, 9385286,
+          2247707, 53446902, 28714970, 30007387, 17731091},
+         {66172485, 16086690, 23751945, 33011114, 65941325,
+          28365395, 9137108, 730663, 9835848, 4555336}},
+        {{43732429, 1410445, 44855111, 20654817, 30867634,
+          15826977, 17693930, 544696, 55123566, 12422645},
+         {31117226, 21338698, 53606025, 6561946, 57231997,
+          20796761, 61990178, 29457725, 29120152, 13924425},
+         {49707966, 19321222, 19675798, 30819676, 56101901,
+          27695611, 57724924, 22236731, 7240930, 33317044}},
+        {{35747106, 22207651, 52101416, 27698213, 44655523,
+          21401660, 1222335, 4389483, 3293637, 18002689},
+         {50424044, 19110186, 11038543, 11054958, 53307689,
+          30215898, 42789283, 7733546, 12796905, 27218610},
+         {58349431, 22736595, 41689999, 10783768, 36493307,
+          23807620, 38855524, 3647835, 3222231, 22393970}},
+        {{18606113, 1693100, 41660478, 18384159, 4112352,
+          10045021, 23603893, 31506198, 59558087, 2484984},
+         {9255298, 30423235, 54952701, 32550175, 13098012,
+          24339566, 16377219, 31451620, 47306788, 30519729},
+         {44379556, 7496159, 61366665, 11329248, 19991973,
+          30206930, 35390715, 9936965, 37011176, 22935634}},
+        {{21878571, 28553135, 4338335, 13643897, 64071999,
+          13160959, 19708896, 5415497, 59748361, 29445138},
+         {27736842, 10103576, 12500508, 8502413, 63695848,
+          23920873, 10436917, 32004156, 43449720, 25422331},
+         {19492550, 21450067, 37426887, 32701801, 63900692,
+          12403436, 30066266, 8367329, 13243957, 8709688}}
+    },
+    { /* 256^10 B */
+        {{12015105, 2801261, 28198131, 10151021, 24818120,
+          28811299, 55914672, 27908697, 5150967, 7274186},
+         {2831347, 21062286, 1478974, 6122054, 23825128,
+          20820846, 31097298, 6083058, 31021603, 23760822},
+         {64578913, 31324785, 445612, 10720828, 53259337,
+          22048494, 43601132, 16354464, 15067285, 19406725}},
+        {{7840923, 14037873, 33744001, 15934015, 66380651,
+          29911725, 21403987, 1057586, 47729402, 21151211},
+         {915865, 17085158, 15608284, 24765302, 42751837,
+          6060029, 49737545, 8410996, 59888403, 16527024},
+         {32922597, 32997445, 20336073, 17369864, 10903704,
+          28169945, 16957573, 52992, 23834301, 6588044}},
+        {{32752011, 11232950, 3381995, 24839566, 22652987,
+          22810329, 17159698, 16689107, 46794284, 32248439},
+         {62419196, 9166775, 41398568, 22707125, 11576751,
+          12733943, 7924251, 30802151, 1976122, 26305405},
+         {21251203, 16309901, 64125849, 26771309, 30810596,
+          12967303, 156041, 30183180, 12331344, 25317235}},
+        {{8651595, 29077400, 51023227, 28557437, 13002506,
+          2950805, 29054427, 28447462, 10008135, 28886531},
+         {31486061, 15114593, 52847614, 12951353, 14369431,
+          26166587, 16347320, 19892343, 8684154, 23021480},
+         {19443825, 11385320, 24468943, 23895364, 43189605,
+          2187568, 40845657, 27467510, 31316347, 14219878}},
+        {{38514374, 1193784, 32245219, 11392485, 31092169,
+          15722801, 27146014, 6992409, 29126555, 9207390},
+         {32382916, 1110093, 18477781, 11028262, 39697101,
+          26006320, 62128346, 10843781, 59151264, 19118701},
+         {2814918, 7836403, 27519878, 25686276, 46214848,
+          22000742, 45614304, 8550129, 28346258, 1994730}},
+        {{47530565, 8085544, 53108345, 29605809, 2785837,
+          17323125, 47591912, 7174893, 22628102, 8115180},
+         {36703732, 955510, 55975026, 18476362, 34661776,
+          20276352, 41457285, 3317159, 57165847, 930271},
+         {51805164, 26720662, 28856489, 1357446, 23421993,
+          1057177, 24091212, 32165462, 44343487, 22903716}},
+        {{44357633, 28250434, 54201256, 20785565, 51297352,
+          25757378, 52269845, 17000211, 65241845, 8398969},
+         {35139535, 2106402, 62372504, 1362500, 12813763,
+          16200670, 22981545, 27263159, 18009407, 17781660},
+         {49887941, 24009210, 39324209, 14166834, 29815394,
+          7444469, 29551787, 29827013, 19288548, 1325865}},
+        {{15100138, 17718680, 43184885, 32549333, 40658671,
+          15509407, 12376730, 30075286, 33166106, 25511682},
+         {20909212, 13023121, 57899112, 16251777, 61330449,
+          25459517, 12412150, 10018715, 2213263, 19676059},
+         {32529814, 22479743, 30361438, 16864679, 57972923,
+          1513225, 22922121, 6382134, 61341936, 8371347}}
+    },
+    { /* 256^11 B */
+        {{9923462, 11271500, 12616794, 3544722, 37110496,
+          31832805, 12891686, 25361300, 40665920, 10486143},
+         {44511638, 26541766, 8587002, 25296571, 4084308,
+          20584370, 361725, 2610596, 43187334, 22099236},
+         {5408392, 32417741, 62139741, 10561667, 24145918,
+          14240566, 31319731, 29318891, 19985174, 30118346}},
+        {{53114407, 16616820, 14549246, 3341099, 32155958,
+          13648976, 49531796, 8849296, 65030, 8370684},
+         {58787919, 21504805, 31204562, 5839400, 46481576,
+          32497154, 47665921, 6922163, 12743482, 23753914},
+         {64747493, 12678784, 28815050, 4759974, 43215817,
+          4884716, 23783145, 11038569, 18800704, 255233}},
+        {{61839187, 31780545, 13957885, 7990715, 23132995,
+          728773, 13393847, 9066957, 19258688, 18800639},
+         {64172210, 22726896, 56676774, 14516792, 63468078,
+          4372540, 35173943, 2209389, 65584811, 2055793},
+         {580882, 16705327, 5468415, 30871414, 36182444,
+          18858431, 59905517, 24560042, 37087844, 7394434}},
+        {{23838809, 1822728, 51370421, 15242726, 8318092,
+          29821328, 45436683, 30062226, 62287122, 14799920},
+         {13345610, 9759151, 3371034, 17416641, 16353038,
+          8577942, 31129804, 13496856, 58052846, 7402517},
+         {2286874, 29118501, 47066405, 31546095, 53412636,
+          5038121, 11006906, 17794080, 8205060, 1607563}},
+        {{14414067, 25552300, 3331829, 30346215, 22249150,
+          27960244, 18364660, 30647474, 30019586, 24525154},
+         {39420813, 1585952, 56333811, 931068, 37988643,
+          22552112, 52698034, 12029092, 9944378, 8024},
+         {4368715, 29844802, 29874199, 18531449, 46878477,
+          22143727, 50994269, 32555346, 58966475, 5640029}},
+        {{10299591, 13746483, 11661824, 16234854, 7630238,
+          5998374, 9809887, 16859868, 15219797, 19226649},
+         {27425505, 27835351, 3055005, 10660664, 23458024,
+          595578, 51710259, 32381236, 48766680, 9742716},
+         {6744077, 2427284, 26042789, 2720740, 66260958,
+          1118973, 32324614, 7406442, 12420155, 1994844}},
+        {{14012502, 28529712, 48724410, 23975962, 40623521,
+          29617992, 54075385, 22644628, 24319928, 27108099},
+         {16412671, 29047065, 10772640, 15929391, 50040076,
+          28895810, 10555944, 23070383, 37006495, 28815383},
+         {22397363, 25786748, 57815702, 20761563, 17166286,
+          23799296, 39775798, 6199365, 21880021, 21303672}},
+        {{62825557, 5368522, 35991846, 8163388, 36785801,
+          3209127, 16557151, 8890729, 8840445, 4957760},
+         {51661137, 709326, 60189418, 22684253, 37330941,
+          6522331, 45388683, 12130071, 52312361, 5005756},
+         {64994094, 19246303, 23019041, 15765735, 41839181,
+          6002751, 10183197, 20315106, 50713577, 31378319}}
+    },
+    { /* 256^12 B */
+        {{48083108, 1632004, 13466291, 25559332, 43468412,
+          16573536, 35094956, 30497327, 22208661, 2000468},
+         {3065054, 32141671, 41510189, 33192999, 49425798,
+          27851016, 58944651, 11248526, 63417650, 26140247},
+         {10379208, 27508878, 8877318, 1473647, 37817580,
+          21046851, 16690914, 2553332, 63976176, 16400288}},
+        {{15716668, 1254266, 48636174, 7446273, 58659946,
+          6344163, 45011593, 26268851, 26894936, 9132066},
+         {24158868, 12938817, 11085297, 25376834, 39045385,
+          29097348, 36532400, 64451, 60291780, 30861549},
+         {13488534, 7794716, 22236231, 5989356, 25426474,
+          20976224, 2350709, 30135921, 62420857, 2364225}},
+        {{16335033, 9132434, 25640582, 6678888, 1725628,
+          8517937, 55301840, 21856974, 15445874, 25756331},
+         {29004188, 25687351, 28661401, 32914020, 54314860,
+          25611345, 31863254, 29418892, 66830813, 17795152},
+         {60986784, 18687766, 38493958, 14569918, 56250865,
+          29962602, 10343411, 26578142, 37280576, 22738620}},
+        {{27081650, 3463984, 14099042, 29036828, 1616302,
+          27348828, 29542635, 15372179, 17293797, 960709},
+         {20263915, 11434237, 61343429, 11236809, 13505955,
+          22697330, 50997518, 6493121, 47724353, 7639713},
+         {64278047, 18715199, 25403037, 25339236, 58791851,
+          17380732, 18006286, 17510682, 29994676, 17746311}},
+        {{9769828, 5202651, 42951466, 19923039, 39057860,
+          21992807, 42495722, 19693649, 35924288, 709463},
+         {12286395, 13076066, 45333675, 32377809, 42105665,
+          4057651, 35090736, 24663557, 16102006, 13205847},
+         {13733362, 5599946, 10557076, 3195751, 61550873,
+          8536969, 41568694, 8525971, 10151379, 10394400}},
+        {{4024660, 17416881, 22436261, 12276534, 58009849,
+          30868332, 19698228, 11743039, 33806530, 8934413},
+         {51229064, 29029191, 58528116, 30620370, 14634844,
+          32856154, 57659786, 3137093, 55571978, 11721157},
+         {17555920, 28540494, 8268605, 2331751, 44370049,
+          9761012, 9319229, 8835153, 57903375, 32274386}},
+        {{66647436, 25724417, 20614117, 16688288, 59594098,
+          28747312, 22300303, 505429, 6108462, 27371017},
+         {62038564, 12367916, 36445330, 3234472, 32617080,
+          25131790, 29880582, 20071101, 40210373, 25686972},
+         {35133562, 5726538, 26934134, 10237677, 63935147,
+          32949378, 24199303, 3795095, 7592688, 18562353}},
+        {{21594432, 18590204, 17466407, 29477210, 32537083,
+          2739898, 6407723, 12018833, 38852812, 4298411},
+         {46458361, 21592935, 39872588, 570497, 3767144,
+          31836892, 13891941, 31985238, 13717173, 10805743},
+         {52432215, 17910135, 15287173, 11927123, 24177847,
+          25378864, 66312432, 14860608, 40169934, 27690595}}
+    },
+    { /* 256^13 B */
+        {{12962541, 5311799, 57048096, 11658279, 18855286,
+          25600231, 13286262, 20745728, 62727807, 9882021},
+         {18512060, 11319350, 46985740, 15090308, 18818594,
+          5271736, 44380960, 3666878, 43141434, 30255002},
+         {60319844, 30408388, 16192428, 13241070, 15898607,
+          19348318, 57023983, 26893321, 64705764, 5276064}},
+        {{30169808, 28236784, 26306205, 21803573, 27814963,
+          7069267, 7152851, 3684982, 1449224, 13082861},
+         {10342807, 3098505, 2119311, 193222, 25702612,
+          12233820, 23697382, 15056736, 46092426, 25352431},
+         {33958735, 3261607, 22745853, 7948688, 19370557,
+          18376767, 40936887, 6482813, 56808784, 22494330}},
+        {{32869458, 28145887, 25609742, 15678670, 56421095,
+          18083360, 26112420, 2521008, 44444576, 6904814},
+         {29506904, 4457497, 3377935, 23757988, 36598817,
+          12935079, 1561737, 3841096, 38105225, 26896789},
+         {10340844, 26924055, 48452231, 31276001, 12621150,
+          20215377, 30878496, 21730062, 41524312, 5181965}},
+        {{25940096, 20896407, 17324187, 23247058, 58437395,
+          15029093, 24396252, 17103510, 64786011, 21165857},
+         {45343161, 9916822, 65808455, 4079497, 66080518,
+          11909558, 1782390, 12641087, 20603771, 26992690},
+         {48226577, 21881051, 24849421, 11501709, 13161720,
+          28785558, 1925522, 11914390, 4662781, 7820689}},
+        {{12241050, 33128450, 8132690, 9393934, 32846760,
+          31954812, 29749455, 12172924, 16136752, 15264020},
+         {56758909, 18873868, 58896884, 2330219, 49446315,
+          19008651, 10658212, 6671822, 19012087, 3772772},
+         {3753511, 30133366, 10617073, 2028709, 14841030,
+          26832768, 28718731, 17791548, 20527770, 12988982}},
+        {{52286360, 27757162, 63400876, 12689772, 66209881,
+          22639565, 42925817, 22989488, 3299664, 21129479},
+         {50331161, 18301130, 57466446, 4978982, 3308785,
+          8755439, 6943197, 6461331, 41525717, 8991217},
+         {49882601, 1816361, 65435576, 27467992, 31783887,
+          25378441, 34160718, 7417949, 36866577, 1507264}},
+        {{29692644, 6829891, 56610064, 4334895, 20945975,
+          21647936, 38221255, 8209390, 14606362, 22907359},
+         {63627275, 8707080, 32188102, 5672294, 22096700,
+          1711240, 34088169, 9761486, 4170404, 31469107},
+         {55521375, 14855944, 62981086, 32022574, 40459774,
+          15084045, 22186522, 16002000, 52832027, 25153633}},
+        {{62297408, 13761028, 35404987, 31070512, 63796392,
+          7869046, 59995292, 23934339, 13240844, 10965870},
+         {59366301, 25297669, 52340529, 19898171, 43876480,
+          12387165, 4498947, 14147411, 29514390, 4302863},
+         {53695440, 21146572, 20757301, 19752600, 14785142,
+          8976368, 62047588, 31410058, 17846987, 19582505}}
+    },
+    { /* 256^14 B */
+        {{64864412, 32799703, 62511833, 32488122, 60861691,
+          1455298, 45461136, 24339642, 61886162, 12650266},
+         {57202067, 17484121, 21134159, 12198166, 40044289,
+          708125, 387813, 13770293, 47974538, 10958662},
+         {22470984, 12369526, 23446014, 28113323, 45588061,
+          23855708, 55336367, 21979976, 42025033, 4271861}},
+        {{41939299, 23500789, 47199531, 15361594, 61124506,
+          2159191, 75375, 29275903, 34582642, 8469672},
+         {15854951, 4148314, 58214974, 7259001, 11666551,
+          13824734, 36577666, 2697371, 24154791, 24093489},
+         {15446137, 17747788, 29759746, 14019369, 30811221,
+          23944241, 35526855, 12840103, 24913809, 9815020}},
+        {{62399578, 27940162, 35267365, 21265538, 52665326,
+          10799413, 58005188, 13438768, 18735128, 9466238},
+         {11933045, 9281483, 5081055, 28370608, 64480701,
+          28648802, 59381042, 22658328, 44380208, 16199063},
+         {14576810, 379472, 40322331, 25237195, 37682355,
+          22741457, 67006097, 1876698, 30801119, 2164795}},
+        {{15995086, 3199873, 13672555, 13712240, 47730029,
+          28906785, 54027253, 18058162, 53616056, 1268051},
+         {56818250, 29895392, 63822271, 10948817, 23037027,
+          3794475, 63638526, 20954210, 50053494, 3565903},
+         {29210069, 24135095, 61189071, 28601646, 10834810,
+          20226706, 50596761, 22733718, 39946641, 19523900}},
+        {{53946955, 15508587, 16663704, 25398282, 38758921,
+          9019122, 37925443, 29785008, 2244110, 19552453},
+         {61955989, 29753495, 57802388, 27482848, 16243068,
+          14684434, 41435776, 17373631, 13491505, 4641841},
+         {10813398, 643330, 47920349, 32825515, 30292061,
+          16954354, 27548446, 25833190, 14476988, 20787001}},
+        {{10292079, 9984945, 6481436, 8279905, 59857350,
+          7032742, 27282937, 31910173, 39196053, 12651323},
+         {35923332, 32741048, 22271203, 11835308, 10201545,
+          15351028, 17099662, 3988035, 21721536, 30405492},
+         {10202177, 27008593, 35735631, 23979793, 34958221,
+          25434748, 54202543, 3852693, 13216206, 14842320}},
+        {{51293224, 22953365, 60569911, 26295436, 60124204,
+          26972653, 35608016, 13765823, 39674467, 9900183},
+         {14465486, 19721101, 34974879, 18815558, 39665676,
+          12990491, 33046193, 15796406, 60056998, 25514317},
+         {30924398, 25274812, 6359015, 20738097, 16508376,
+          9071735, 41620263, 15413634, 9524356, 26535554}},
+        {{12274201, 20378885, 32627640, 31769106, 6736624,
+          13267305, 5237659, 28444949, 15663515, 4035784},
+         {64157555, 8903984, 17349946, 601635, 50676049,
+          28941875, 53376124, 17665097, 44850385, 4659090},
+         {50192582, 28601458, 36715152, 18395610, 20774811,
+          15897498, 5736189, 15026997, 64930608, 20098846}}
+    },
+    { /* 256^15 B */
+        {{58249865, 31335375, 28571665, 23398914, 66634396,
+          23448733, 63307367, 278094, 23440562, 33264224},
+         {10226222, 27625730, 15139955, 120818, 52241171,
+          5218602, 32937275, 11551483, 50536904, 26111567},
+         {17932739, 21117156, 43069306, 10749059, 11316803,
+          7535897, 22503767, 5561594, 63462240, 3898660}},
+        {{7749907, 32584865, 50769132, 33537967, 42090752,
+          15122142, 65535333, 7152529, 21831162, 1245233},
+         {26958440, 18896406, 4314585, 8346991, 61431100,
+          11960071, 34519569, 32934396, 36706772, 16838219},
+         {54942968, 9166946, 33491384, 13673479, 29787085,
+          13096535, 6280834, 14587357, 44770839, 13987524}},
+        {{42758936, 7778774, 21116000, 15572597, 62275598,
+          28196653, 62807965, 28429792, 59639082, 30696363},
+         {9681908, 26817309, 35157219, 13591837, 60225043,
+          386949, 31622781, 6439245, 52527852, 4091396},
+         {58682418, 1470726, 38999185, 31957441, 3978626,
+          28430809, 47486180, 12092162, 29077877, 18812444}},
+        {{5269168, 26694706, 53878652, 25533716, 25932562,
+          1763552, 61502754, 28048550, 47091016, 2357888},
+         {32264008, 18146780, 61721128, 32394338, 65017541,
+          29607531, 23104803, 20684524, 5727337, 189038},
+         {14609104, 24599962, 61108297, 16931650, 52531476,
+          25810533, 40363694, 10942114, 41219933, 18669734}},
+        {{20513481, 5557931, 51504251, 7829530, 26413943,
+          31535028, 45729895, 7471780, 13913677, 28416557},
+         {41534488, 11967825, 29233242, 12948236, 60354399,
+          4713226, 58167894, 14059179, 12878652, 8511905},
+         {41452044, 3393630, 64153449, 26478905, 64858154,
+          9366907, 36885446, 6812973, 5568676, 30426776}},
+        {{11630004, 12144454, 2116339, 13606037, 27378885,
+          15676917, 49700111, 20050058, 52713667, 8070817},
+         {27117677, 23547054, 35826092, 27984343, 1127281,
+          12772488, 37262958, 10483305, 55556115, 32525717},
+         {10637467, 27866368, 5674780, 1072708, 40765276,
+          26572129, 65424888, 9177852, 39615702, 15431202}},
+        {{20525126, 10892566, 54366392, 12779442, 37615830,
+          16150074, 38868345, 14943141, 52052074, 25618500},
+         {37084402, 5626925, 66557297, 23573344, 753597,
+          11981191, 25244767, 30314666, 63752313, 9594023},
+         {43356201, 2636869, 61944954, 23450613, 585133,
+          7877383, 11345683, 27062142, 13352334, 22577348}},
+        {{65177046, 28146973, 3304648, 20669563, 17015805,
+          28677341, 37325013, 25801949, 53893326, 33235227},
+         {20239939, 6607058, 6203985, 3483793, 48721888,
+          32775202, 46385121, 15077869, 44358105, 14523816},
+         {27406023, 27512775, 27423595, 29057038, 4996213,
+          10002360, 38266833, 29008937, 36936121, 28748764}}
+    },
+    { /* 256^16 B */
+        {{11374242, 12660715, 17861383, 21013599, 10935567,
+          1099227, 53222788, 24462691, 39381819, 11358503},
+         {54378055, 10311866, 1510375, 10778093, 64989409,
+          24408729, 32676002, 11149336, 40985213, 4985767},
+         {48012542, 341146, 60911379, 33315398, 15756972,
+          24757770, 66125820, 13794113, 47694557, 17933176}},
+        {{6490062, 11940286, 25495923, 25828072, 8668372,
+          24803116, 3367602, 6970005, 65417799, 24549641},
+         {1656478, 13457317, 15370807, 6364910, 13605745,
+          8362338, 47934242, 28078708, 50312267, 28522993},
+         {44835530, 20030007, 67044178, 29220208, 48503227,
+          22632463, 46537798, 26546453, 67009010, 23317098}},
+        {{17747446, 10039260, 19368299, 29503841, 46478228,
+          17513145, 31992682, 17696456, 37848500, 28042460},
+         {31932008, 28568291, 47496481, 16366579, 22023614,
+          88450, 11371999, 29810185, 4882241, 22927527},
+         {29796488, 37186, 19818052, 10115756, 55279832,
+          3352735, 18551198, 3272828, 61917932, 29392022}},
+        {{12501267, 4044383, 58495907, 20162046, 34678811,
+          5136598, 47878486, 30024734, 330069, 29895023},
+         {6384877, 2899513, 17807477, 7663917, 64749976,
+          12363164, 25366522, 24980540, 66837568, 12071498},
+         {58743349, 29511910, 25133447, 29037077, 60897836,
+          2265926, 34339246, 1936674, 61949167, 3829362}},
+        {{28425966, 27718999, 66531773, 28857233, 52891308,
+          6870929, 7921550, 26986645, 26333139, 14267664},
+         {56041645, 11871230, 27385719, 22994888, 62522949,
+          22365119, 10004785, 24844944, 45347639, 8930323},
+         {45911060, 17158396, 25654215, 31829035, 12282011,
+          11008919, 1541940, 4757911, 40617363, 17145491}},
+        {{13537262, 25794942, 46504023, 10961926, 61186044,
+          20336366, 53952279, 6217253, 51165165, 13814989},
+         {49686272, 15157789, 18705543, 29619, 24409717,
+          33293956, 27361680, 9257833, 65152338, 31777517},
+         {42063564, 23362465, 15366584, 15166509, 54003778,
+          8423555, 37937324, 12361134, 48422886, 4578289}},
+        {{24579768, 3711570, 1342322, 22374306, 40103728,
+          14124955, 44564335, 14074918, 21964432, 8235257},
+         {60580251, 31142934, 9442965, 27628844, 12025639,
+          32067012, 64127349, 31885225, 13006805, 2355433},
+         {50803946, 19949172, 60476436, 28412082, 16974358,
+          22643349, 27202043, 1719366, 1141648, 20758196}},
+        {{54244920, 20334445, 58790597, 22536340, 60298718,
+          28710537, 13475065, 30420460, 32674894, 13715045},
+         {11423316, 28086373, 32344215, 8962751, 24989809,
+          9241752, 53843611, 16086211, 38367983, 17912338},
+         {65699196, 12530727, 60740138, 10847386, 19531186,
+          19422272, 55399715, 7791793, 39862921, 4383346}}
+    },
+    { /* 256^17 B */
+        {{38137966, 5271446, 65842855, 23817442, 54653627,
+          16732598, 62246457, 28647982, 27193556, 6245191},
+         {51914908, 5362277, 65324971, 2695833, 4960227,
+          12840725, 23061898, 3260492, 22510453, 8577507},
+         {54476394, 11257345, 34415870, 13548176, 66387860,
+          10879010, 31168030, 13952092, 37537372, 29918525}},
+        {{3877321, 23981693, 32416691, 5405324, 56104457,
+          19897796, 3759768, 11935320, 5611860, 8164018},
+         {50833043, 14667796, 15906460, 12155291, 44997715,
+          24514713, 32003001, 24722143, 5773084, 25132323},
+         {43320746, 25300131, 1950874, 8937633, 18686727,
+          16459170, 66203139, 12376319, 31632953, 190926}},
+        {{42515238, 17415546, 58684872, 13378745, 14162407,
+          6901328, 58820115, 4508563, 41767309, 29926903},
+         {8884438, 27670423, 6023973, 10104341, 60227295,
+          28612898, 18722940, 18768427, 65436375, 827624},
+         {34388281, 17265135, 34605316, 7101209, 13354605,
+          2659080, 65308289, 19446395, 42230385, 1541285}},
+        {{2901328, 32436745, 3880375, 23495044, 49487923,
+          29941650, 45306746, 29986950, 20456844, 31669399},
+         {27019610, 12299467, 53450576, 31951197, 54247203,
+          28692960, 47568713, 28538373, 29439640, 15138866},
+         {21536104, 26928012, 34661045, 22864223, 44700786,
+          5175813, 61688824, 17193268, 7779327, 109896}},
+        {{30279725, 14648750, 59063993, 6425557, 13639621,
+          32810923, 28698389, 12180118, 23177719, 33000357},
+         {26572828, 3405927, 35407164, 12890904, 47843196,
+          5335865, 60615096, 2378491, 4439158, 20275085},
+         {44392139, 3489069, 57883598, 33221678, 18875721,
+          32414337, 14819433, 20822905, 49391106, 28092994}},
+        {{62052362, 16566550, 15953661, 3767752, 56672365,
+          15627059, 66287910, 2177224, 8550082, 18440267},
+         {48635543, 16596774, 66727204, 15663610, 22860960,
+          15585581, 39264755, 29971692, 43848403, 25125843},
+         {34628313, 15707274, 58902952, 27902350, 29464557,
+          2713815, 44383727, 15860481, 45206294, 1494192}},
+        {{47546773, 19467038, 41524991, 24254879, 13127841,
+          759709, 21923482, 16529112, 8742704, 12967017},
+         {38643965, 1553204, 32536856, 23080703, 42417258,
+          33148257, 58194238, 30620535, 37205105, 15553882},
+         {21877890, 3230008, 9881174, 10539357, 62311749,
+          2841331, 11543572, 14513274, 19375923, 20906471}},
+        {{8832269, 19058947, 13253510, 5137575, 5037871,
+          4078777, 24880818, 27331716, 2862652, 9455043},
+         {29306751, 5123106, 20245049, 19404543, 9592565,
+          8447059, 65031740, 30564351, 15511448, 4789663},
+         {46429108, 7004546, 8824831, 24119455, 63063159,
+          29803695, 61354101, 108892, 23513200, 16652362}}
+    },
+    { /* 256^18 B */
+        {{33852691, 4144781, 62632835, 26975308, 10770038,
+          26398890, 60458447, 20618131, 48789665, 10212859},
+         {2756062, 8598110, 7383731, 26694540, 22312758,
+          32449420, 21179800, 2600940, 57120566, 21047965},
+         {42463153, 13317461, 36659605, 17900503, 21365573,
+          22684775, 11344423, 864440, 64609187, 16844368}},
+        {{40676061, 6148328, 49924452, 19080277, 18782928,
+          33278435, 44547329, 211299, 2719757, 4940997},
+         {65784982, 3911312, 60160120, 14759764, 37081714,
+          7851206, 21690126, 8518463, 26699843, 5276295},
+         {53958991, 27125364, 9396248, 365013, 24703301,
+          23065493, 1321585, 149635, 51656090, 7159368}},
+        {{9987761, 30149673, 17507961, 9505530, 9731535,
+          31388918, 22356008, 8312176, 22477218, 25151047},
+         {18155857, 17049442, 19744715, 9006923, 15154154,
+          23015456, 24256459, 28689437, 44560690, 9334108},
+         {2986088, 28642539, 10776627, 30080588, 10620589,
+          26471229, 45695018, 14253544, 44521715, 536905}},
+        {{4377737, 8115836, 24567078, 15495314, 11625074,
+          13064599, 7390551, 10589625, 10838060, 18134008},
+         {47766460, 867879, 9277171, 30335973, 52677291,
+          31567988, 19295825, 17757482, 6378259, 699185},
+         {7895007, 4057113, 60027092, 20476675, 49222032,
+          33231305, 66392824, 15693154, 62063800, 20180469}},
+        {{59371282, 27685029, 52542544, 26147512, 11385653,
+          13201616, 31730678, 22591592, 63190227, 23885106},
+         {10188286, 17783598, 59772502, 13427542, 22223443,
+          14896287, 30743455, 7116568, 45322357, 5427592},
+         {696102, 13206899, 27047647, 22922350, 15285304,
+          23701253, 10798489, 28975712, 19236242, 12477404}},
+        {{55879425, 11243795, 50054594, 25513566, 66320635,
+          25386464, 63211194, 11180503, 43939348, 7733643},
+         {17800790, 19518253, 40108434, 21787760, 23887826,
+          3149671, 23466177, 23016261, 10322026, 15313801},
+         {26246234, 11968874, 32263343, 28085704, 6830754,
+          20231401, 51314159, 33452449, 42659621, 10890803}},
+        {{35743198, 10271362, 54448239, 27287163, 16690206,
+          20491888, 52126651, 16484930, 25180797, 28219548},
+         {66522290, 10376443, 34522450, 22268075, 19801892,
+          10997610, 2276632, 9482883, 316878, 13820577},
+         {57226037, 29044064, 64993357, 16457135, 56008783,
+          11674995, 30756178, 26039378, 30696929, 29841583}},
+        {{32988917, 23951020, 12499365, 7910787, 56491607,
+          21622917, 59766047, 23569034, 34759346, 7392472},
+         {58253184, 15927860, 9866406, 29905021, 64711949,
+          16898650, 36699387, 24419436, 25112946, 30627788},
+         {64604801, 33117465, 25621773, 27875660, 15085041,
+          28074555, 42223985, 20028237, 5537437, 19640113}}
+    },
+    { /* 256^19 B */
+        {{55883280, 2320284, 57524584, 10149186, 33664201,
+          5808647, 52232613, 31824764, 31234589, 6090599},
+         {57475529, 116425, 26083934, 2897444, 60744427,
+          30866345, 609720, 15878753, 60138459, 24519663},
+         {39351007, 247743, 51914090, 24551880, 23288160,
+          23542496, 43239268, 6503645, 20650474, 1804084}},
+        {{39519059, 15456423, 8972517, 8469608, 15640622,
+          4439847, 3121995, 23224719, 27842615, 33352104},
+         {51801891, 2839643, 22530074, 10026331, 4602058,
+          5048462, 28248656, 5031932, 55733782, 12714368},
+         {20807691, 26283607, 29286140, 11421711, 39232341,
+          19686201, 45881388, 1035545, 47375635, 12796919}},
+        {{12076880, 19253146, 58323862, 21705509, 42096072,
+          16400683, 49517369, 20654993, 3480664, 18371617},
+         {34747315, 5457596, 28548107, 7833186, 7303070,
+          21600887, 42745799, 17632556, 33734809, 2771024},
+         {45719598, 421931, 26597266, 6860826, 22486084,
+          26817260, 49971378, 29344205, 42556581, 15673396}},
+        {{46924223, 2338215, 19788685, 23933476, 63107598,
+          24813538, 46837679, 4733253, 3727144, 20619984},
+         {6120100, 814863, 55314462, 32931715, 6812204,
+          17806661, 2019593, 7975683, 31123697, 22595451},
+         {30069250, 22119100, 30434653, 2958439, 18399564,
+          32578143, 12296868, 9204260, 50676426, 9648164}},
+        {{32705413, 32003455, 30705657, 7451065, 55303258,
+          9631812, 3305266, 5248604, 41100532, 22176930},
+         {17219846, 2375039, 35537917, 27978816, 47649184,
+          9219902, 294711, 15298639, 2662509, 17257359},
+         {65935918, 25995736, 62742093, 29266687, 45762450,
+          25120105, 32087528, 32331655, 32247247, 19164571}},
+        {{14312609, 1221556, 17395390, 24854289, 62163122,
+          24869796, 38911119, 23916614, 51081240, 20175586},
+         {65680039, 23875441, 57873182, 6549686, 59725795,
+          33085767, 23046501, 9803137, 17597934, 2346211},
+         {18510781, 15337574, 26171504, 981392, 44867312,
+          7827555, 43617730, 22231079, 3059832, 21771562}},
+        {{10141598, 6082907, 17829293, 31606789, 9830091,
+          13613136, 41552228, 28009845, 33606651, 3592095},
+         {33114149, 17665080, 40583177, 20211034, 33076704,
+          8716171, 1151462, 1521897, 66126199, 26716628},
+         {34169699, 29298616, 23947180, 33230254, 34035889,
+          21248794, 50471177, 3891703, 26353178, 693168}},
+        {{30374239, 1595580, 50224825, 13186930, 4600344,
+          406904, 9585294, 33153764, 31375463, 14369965},
+         {52738210, 25781902, 1510300, 6434173, 48324075,
+          27291703, 32732229, 20445593, 17901440, 16011505},
+         {18171223, 21619806, 54608461, 15197121, 56070717,
+          18324396, 47936623, 17508055, 8764034, 12309598}}
+    },
+    { /* 256^20 B */
+        {{5975889, 28311244, 47649501, 23872684, 55567586,
+          14015781, 43443107, 1228318, 17544096, 22960650},
+         {5811932, 31839139, 3442886, 31285122, 48741515,
+          25194890, 49064820, 18144304, 61543482, 12348899},
+         {35709185, 11407554, 25755363, 6891399, 63851926,
+          14872273, 42259511, 8141294, 56476330, 32968952}},
+        {{54433560, 694025, 62032719, 13300343, 14015258,
+          19103038, 57410191, 22225381, 30944592, 1130208},
+         {8247747, 26843490, 40546482, 25845122, 52706924,
+          18905521, 4652151, 2488540, 23550156, 33283200},
+         {17294297, 29765994, 7026747, 15626851, 22990044,
+          113481, 2267737, 27646286, 66700045, 33416712}},
+        {{16091066, 17300506, 18599251, 7340678, 2137637,
+          32332775, 63744702, 14550935, 3260525, 26388161},
+         {62198760, 20221544, 18550886, 10864893, 50649539,
+          26262835, 44079994, 20349526, 54360141, 2701325},
+         {58534169, 16099414, 4629974, 17213908, 46322650,
+          27548999, 57090500, 9276970, 11329923, 1862132}},
+        {{14763057, 17650824, 36190593, 3689866, 3511892,
+          10313526, 45157776, 12219230, 58070901, 32614131},
+         {8894987, 30108338, 6150752, 3013931, 301220,
+          15693451, 35127648, 30644714, 51670695, 11595569},
+         {15214943, 3537601, 40870142, 19495559, 4418656,
+          18323671, 13947275, 10730794, 53619402, 29190761}},
+        {{64570558, 7682792, 32759013, 263109, 37124133,
+          25598979, 44776739, 23365796, 977107, 699994},
+         {54642373, 4195083, 57897332, 550903, 51543527,
+          12917919, 19118110, 33114591, 36574330, 19216518},
+         {31788442, 19046775, 4799988, 7372237, 8808585,
+          18806489, 9408236, 23502657, 12493931, 28145115}},
+        {{41428258, 5260743, 47873055, 27269961, 63412921,
+          16566086, 27218280, 2607121, 29375955, 6024730},
+         {842132, 30759739, 62345482, 24831616, 26332017,
+          21148791, 11831879, 6985184, 57168503, 2854095},
+         {62261602, 25585100, 2516241, 27706719, 9695690,
+          26333246, 16512644, 960770, 12121869, 16648078}},
+        {{51890212, 14667095, 53772635, 2013716, 30598287,
+          33090295, 35603941, 25672367, 20237805, 2838411},
+         {47820798, 4453151, 15298546, 17376044, 22115042,
+          17581828, 12544293, 20083975, 1068880, 21054527},
+         {57549981, 17035596, 33238497, 13506958, 30505848,
+          32439836, 58621956, 30924378, 12521377, 4845654}},
+        {{38910324, 10744107, 64150484, 10199663, 7759311,
+          20465832, 3409347, 32681032, 60626557, 20668561},
+         {43547042, 6230155, 46726851, 10655313, 43068279,
+          21933259, 10477733, 32314216, 63995636, 13974497},
+         {12966261, 15550616, 35069916, 31939085, 21025979,
+          32924988, 5642324, 7188737, 18895762, 12629579}}
+    },
+    { /* 256^21 B */
+        {{14741879, 18607545, 22177207, 21833195, 1279740,
+          8058600, 11758140, 789443, 32195181, 3895677},
+         {10758205, 15755439, 62598914, 9243697, 62229442,
+          6879878, 64904289, 29988312, 58126794, 4429646},
+         {64654951, 15725972, 46672522, 23143759, 61304955,
+          22514211, 59972993, 21911536, 18047435, 18272689}},
+        {{41935844, 22247266, 29759955, 11776784, 44846481,
+          17733976, 10993113, 20703595, 49488162, 24145963},
+         {21987233, 700364, 42603816, 14972007, 59334599,
+          27836036, 32155025, 2581431, 37149879, 8773374},
+         {41540495, 454462, 53896929, 16126714, 25240068,
+          8594567, 20656846, 12017935, 59234475, 19634276}},
+        {{6028163, 6263078, 36097058, 22252721, 66289944,
+          2461771, 35267690, 28086389, 65387075, 30777706},
+         {54829870, 16624276, 987579, 27631834, 32908202,
+          1248608, 7719845, 29387734, 28408819, 6816612},
+         {56750770, 25316602, 19549650, 21385210, 22082622,
+          16147817, 20613181, 13982702, 56769294, 5067942}},
+        {{36602878, 29732664, 12074680, 13582412, 47230892,
+          2443950, 47389578, 12746131, 5331210, 23448488},
+         {30528792, 3601899, 65151774, 4619784, 39747042,
+          18118043, 24180792, 20984038, 27679907, 31905504},
+         {9402385, 19597367, 32834042, 10838634, 40528714,
+          20317236, 26653273, 24868867, 22611443, 20839026}},
+        {{22190590, 1118029, 22736441, 15130463, 36648172,
+          27563110, 19189624, 28905490, 4854858, 6622139},
+         {58798126, 30600981, 58846284, 30166382, 56707132,
+          33282502, 13424425, 29987205, 26404408, 13001963},
+         {35867026, 18138731, 64114613, 8939345, 11562230,
+          20713762, 41044498, 21932711, 51703708, 11020692}},
+        {{1866042, 25604943, 59210214, 23253421, 12483314,
+          13477547, 3175636, 21130269, 28761761, 1406734},
+         {66660290, 31776765, 13018550, 3194501, 57528444,
+          22392694, 24760584, 29207344, 25577410, 20175752},
+         {42818486, 4759344, 66418211, 31701615, 2066746,
+          10693769, 37513074, 9884935, 57739938, 4745409}},
+        {{57967561, 6049713, 47577803, 29213020, 35848065,
+          9944275, 51646856, 22242579, 10931923, 21622501},
+         {50547351, 14112679, 59096219, 4817317, 59068400,
+          22139825, 44255434, 10856640, 46638094, 13434653},
+         {22759470, 23480998, 50342599, 31683009, 13637441,
+          23386341, 1765143, 20900106, 28445306, 28189722}},
+        {{29875063, 12493613, 2795536, 29768102, 1710619,
+          15181182, 56913147, 24765756, 9074233, 1167180},
+         {40903181, 11014232, 57266213, 30918946, 40200743,
+          7532293, 48391976, 24018933, 3843902, 9367684},
+         {56139269, 27150720, 9591133, 9582310, 11349256,
+          108879, 16235123, 8601684, 66969667, 4242894}}
+    },
+    { /* 256^22 B */
+        {{22092954, 20363309, 65066070, 21585919, 32186752,
+          22037044, 60534522, 2470659, 39691498, 16625500},
+         {56051142, 3042015, 13770083, 24296510, 584235,
+          33009577, 59338006, 2602724, 39757248, 14247412},
+         {6314156, 23289540, 34336361, 15957556, 56951134,
+          168749, 58490057, 14290060, 27108877, 32373552}},
+        {{58522267, 26383465, 13241781, 10960156, 34117849,
+          19759835, 33547975, 22495543, 39960412, 981873},
+         {22833421, 9293594, 34459416, 19935764, 57971897,
+          14756818, 44180005, 19583651, 56629059, 17356469},
+         {59340277, 3326785, 38997067, 10783823, 19178761,
+          14905060, 22680049, 13906969, 51175174, 3797898}},
+        {{21721337, 29341686, 54902740, 9310181, 63226625,
+          19901321, 23740223, 30845200, 20491982, 25512280},
+         {9209251, 18419377, 53852306, 27386633, 66377847,
+          15289672, 25947805, 15286587, 30997318, 26851369},
+         {7392013, 16618386, 23946583, 25514540, 53843699,
+          32020573, 52911418, 31232855, 17649997, 33304352}},
+        {{57807776, 19360604, 30609525, 30504889, 41933794,
+          32270679, 51867297, 24028707, 64875610, 7662145},
+         {49550191, 1763593, 33994528, 15908609, 37067994,
+          21380136, 7335079, 25082233, 63934189, 3440182},
+         {47219164, 27577423, 42997570, 23865561, 10799742,
+          16982475, 40449, 29122597, 4862399, 1133}},
+        {{34252636, 25680474, 61686474, 14860949, 50789833,
+          7956141, 7258061, 311861, 36513873, 26175010},
+         {63335436, 31988495, 28985339, 7499440, 24445838,
+          9325937, 29727763, 16527196, 18278453, 15405622},
+         {62726958, 8508651, 47210498, 29880007, 61124410,
+          15149969, 53795266, 843522, 45233802, 13626196}},
+        {{2281448, 20067377, 56193445, 30944521, 1879357,
+          16164207, 56324982, 3953791, 13340839, 15928663},
+         {31727126, 26374577, 48671360, 25270779, 2875792,
+          17164102, 41838969, 26539605, 43656557, 5964752},
+         {4100401, 27594980, 49929526, 6017713, 48403027,
+          12227140, 40424029, 11344143, 2538215, 25983677}},
+        {{57675240, 6123112, 11159803, 31397824, 30016279,
+          14966241, 46633881, 1485420, 66479608, 17595569},
+         {40304287, 4260918, 11851389, 9658551, 35091757,
+          16367491, 46903439, 20363143, 11659921, 22439314},
+         {26180377, 10015009, 36264640, 24973138, 5418196,
+          9480663, 2231568, 23384352, 33100371, 32248261}},
+        {{15121094, 28352561, 56718958, 15427820, 39598927,
+          17561924, 21670946, 4486675, 61177054, 19088051},
+         {16166467, 24070699, 56004733, 6023907, 35182066,
+          32189508, 2340059, 17299464, 56373093, 23514607},
+         {28042865, 29997343, 54982337, 12259705, 63391366,
+          26608532, 6766452, 24864833, 18036435, 5803270}}
+    },
+    { /* 256^23 B */
+        {{66291264, 6763911, 11803561, 1585585, 10958447,
+          30883267, 23855390, 4598332, 60949433, 19436993},
+         {36077558, 19298237, 17332028, 31170912, 31312681,
+          27587249, 696308, 50292, 47013125, 11763583},
+         {66514282, 31040148, 34874710, 12643979, 12650761,
+          14811489, 665117, 20940800, 47335652, 22840869}},
+        {{30464590, 22291560, 62981387, 20819953, 19835326,
+          26448819, 42712688, 2075772, 50088707, 992470},
+         {18357166, 26559999, 7766381, 16342475, 37783946,
+          411173, 14578841, 8080033, 55534529, 22952821},
+         {19598397, 10334610, 12555054, 2555664, 18821899,
+          23214652, 21873262, 16014234, 26224780, 16452269}},
+        {{36884939, 5145195, 5944548, 16385966, 3976735,
+          2009897, 55731060, 25936245, 46575034, 3698649},
+         {14187449, 3448569, 56472628, 22743496, 44444983,
+          30120835, 7268409, 22663988, 27394300, 12015369},
+         {19695742, 16087646, 28032085, 12999827, 6817792,
+          11427614, 20244189, 32241655, 53849736, 30151970}},
+        {{30860084, 12735208, 65220619, 28854697, 50133957,
+          2256939, 58942851, 12298311, 58558340, 23160969},
+         {61389038, 22309106, 65198214, 15569034, 26642876,
+          25966672, 61319509, 18435777, 62132699, 12651792},
+         {64260450, 9953420, 11531313, 28271553, 26895122,
+          20857343, 53990043, 17036529, 9768697, 31021214}},
+        {{42389405, 1894650, 66821166, 28850346, 15348718,
+          25397902, 32767512, 12765450, 4940095, 10678226},
+         {18860224, 15980149, 48121624, 31991861, 40875851,
+          22482575, 59264981, 13944023, 42736516, 16582018},
+         {51604604, 4970267, 37215820, 4175592, 46115652,
+          31354675, 55404809, 15444559, 56105103, 7989036}},
+        {{31490433, 5568061, 64696061, 2182382, 34772017,
+          4531685, 35030595, 6200205, 47422751, 18754260},
+         {49800177, 17674491, 35586086, 33551600, 34221481,
+          16375548, 8680158, 17182719, 28550067, 26697300},
+         {38981977, 27866340, 16837844, 31733974, 60258182,
+          12700015, 37068883, 4364037, 1155602, 5988841}},
+        {{21890435, 20281525, 54484852, 12154348, 59276991,
+          15300495, 23148983, 29083951, 24618406, 8283181},
+         {33972757, 23041680, 9975415, 6841041, 35549071,
+          16356535, 3070187, 26528504, 1466168, 10740210},
+         {65599446, 18066246, 53605478, 22898515, 32799043,
+          909394, 53169961, 27774712, 34944214, 18227391}},
+        {{3960804, 19286629, 39082773, 17636380, 47704005,
+          13146867, 15567327, 951507, 63848543, 32980496},
+         {24740822, 5052253, 37014733, 8961360, 25877428,
+          6165135, 42740684, 14397371, 59728495, 27410326},
+         {38220480, 3510802, 39005586, 32395953, 55870735,
+          22922977, 51667400, 19101303, 65483377, 27059617}}
+    },
+    { /* 256^24 B */
+        {{793280, 24323954, 8836301, 27318725, 39747955,
+          31184838, 33152842, 28669181, 57202663, 32932579},
+         {5666214, 525582, 20782575, 25516013, 42570364,
+          14657739, 16099374, 1468826, 60937436, 18367850},
+         {62249590, 29775088, 64191105, 26806412, 7778749,
+          11688288, 36704511, 23683193, 65549940, 23690785}},
+        {{10896313, 25834728, 824274, 472601, 47648556,
+          3009586, 25248958, 14783338, 36527388, 17796587},
+         {10566929, 12612572, 35164652, 11118702, 54475488,
+          12362878, 21752402, 8822496, 24003793, 14264025},
+         {27713843, 26198459, 56100623, 9227529, 27050101,
+          2504721, 23886875, 20436907, 13958494, 27821979}},
+        {{43627235, 4867225, 39861736, 3900520, 29838369,
+          25342141, 35219464, 23512650, 7340520, 18144364},
+         {4646495, 25543308, 44342840, 22021777, 23184552,
+          8566613, 31366726, 32173371, 52042079, 23179239},
+         {49838347, 12723031, 50115803, 14878793, 21619651,
+          27356856, 27584816, 3093888, 58265170, 3849920}},
+        {{58043933, 2103171, 25561640, 18428694, 61869039,
+          9582957, 32477045, 24536477, 5002293, 18004173},
+         {55051311, 22376525, 21115584, 20189277, 8808711,
+          21523724, 16489529, 13378448, 41263148, 12741425},
+         {61162478, 10645102, 36197278, 15390283, 63821882,
+          26435754, 24306471, 15852464, 28834118, 25908360}},
+        {{49773116, 24447374, 42577584, 9434952, 58636780,
+          32971069, 54018092, 455840, 20461858, 5491305},
+         {13669229, 17458950, 54626889, 23351392, 52539093,
+          21661233, 42112877, 11293806, 38520660, 24132599},
+         {28497909, 6272777, 34085870, 14470569, 8906179,
+          32328802, 18504673, 19389266, 29867744, 24758489}},
+        {{50901822, 13517195, 39309234, 19856633, 24009063,
+          27180541, 60741263, 20379039, 22853428, 29542421},
+         {24191359, 16712145, 53177067, 15217830, 14542237,
+          1646131, 18603514, 22516545, 12876622, 31441985},
+         {17902668, 4518229, 66697162, 30725184, 26878216,
+          5258055, 54248111, 608396, 16031844, 3723494}},
+        {{38476072, 12763727, 46662418, 7577503, 33001348,
+          20536687, 17558841, 25681542, 23896953, 29240187},
+         {47103464, 21542479, 31520463, 605201, 2543521,
+          5991821, 64163800, 7229063, 57189218, 24727572},
+         {28816026, 298879, 38943848, 17633493, 19000927,
+          31888542, 54428030, 30605106, 49057085, 31471516}},
+        {{16000882, 33209536, 3493091, 22107234, 37604268,
+          20394642, 12577739, 16041268, 47393624, 7847706},
+         {10151868, 10572098, 27312476, 7922682, 14825339,
+          4723128, 34252933, 27035413, 57088296, 3852847},
+         {55678375, 15697595, 45987307, 29133784, 5386313,
+          15063598, 16514493, 17622322, 29330898, 18478208}}
+    },
+    { /* 256^25 B */
+        {{41609129, 29175637, 51885955, 26653220, 16615730,
+          2051784, 3303702, 15490, 39560068, 12314390},
+         {15683501, 27551389, 18109119, 23573784, 15337967,
+          27556609, 50391428, 15921865, 16103996, 29823217},
+         {43939021, 22773182, 13588191, 31925625, 63310306,
+          32479502, 47835256, 5402698, 37293151, 23713330}},
+        {{23190676, 2384583, 34394524, 3462153, 37205209,
+          32025299, 55842007, 8911516, 41903005, 2739712},
+         {21374101, 30000182, 33584214, 9874410, 15377179,
+          11831242, 33578960, 6134906, 4931255, 11987849},
+         {67101132, 30575573, 50885377, 7277596, 105524,
+          33232381, 35628324, 13861387, 37032554, 10117929}},
+        {{37607694, 22809559, 40945095, 13051538, 41483300,
+          5089642, 60783361, 6704078, 12890019, 15728940},
+         {45136504, 21783052, 66157804, 29135591, 14704839,
+          2695116, 903376, 23126293, 12885166, 8311031},
+         {49592363, 5352193, 10384213, 19742774, 7506450,
+          13453191, 26423267, 4384730, 1888765, 28119028}},
+        {{41291507, 30447119, 53614264, 30371925, 30896458,
+          19632703, 34857219, 20846562, 47644429, 30214188},
+         {43500868, 30888657, 66582772, 4651135, 5765089,
+          4618330, 6092245, 14845197, 17151279, 23700316},
+         {42278406, 20820711, 51942885, 10367249, 37577956,
+          33289075, 22825804, 26467153, 50242379, 16176524}},
+        {{43525589, 6564960, 20063689, 3798228, 62368686,
+          7359224, 2006182, 23191006, 38362610, 23356922},
+         {56482264, 29068029, 53788301, 28429114, 3432135,
+          27161203, 23632036, 31613822, 32808309, 1099883},
+         {15030958, 5768825, 39657628, 30667132, 60681485,
+          18193060, 51830967, 26745081, 2051440, 18328567}},
+        {{63746541, 26315059, 7517889, 9824992, 23555850,
+          295369, 5148398, 19400244, 44422509, 16633659},
+         {4577067, 16802144, 13249840, 18250104, 19958762,
+          19017158, 18559669, 22794883, 8402477, 23690159},
+         {38702534, 32502850, 40318708, 32646733, 49896449,
+          22523642, 9453450, 18574360, 17983009, 9967138}},
+        {{41346370, 6524721, 26585488, 9969270, 24709298,
+          1220360, 65430874, 7806336, 17507396, 3651560},
+         {56688388, 29436320, 14584638, 15971087, 51340543,
+          8861009, 26556809, 27979875, 48555541, 22197296},
+         {2839082, 14284142, 4029895, 3472686, 14402957,
+          12689363, 40466743, 8459446, 61503401, 25932490}},
+        {{62269556, 30018987, 9744960, 2871048, 25113978,
+          3187018, 41998051, 32705365, 17258083, 25576693},
+         {18164541, 22959256, 49953981, 32012014, 19237077,
+          23809137, 23357532, 18337424, 26908269, 12150756},
+         {36843994, 25906566, 5112248, 26517760, 65609056,
+          26580174, 43167, 28016731, 34806789, 16215818}}
+    },
+    { /* 256^26 B */
+        {{60209940, 9824393, 54804085, 29153342, 35711722,
+          27277596, 32574488, 12532905, 59605792, 24879084},
+         {39765323, 17038963, 39957339, 22831480, 946345,
+          16291093, 254968, 7168080, 21676107, 31611404},
+         {21260942, 25129680, 50276977, 21633609, 43430902,
+          3968120, 63456915, 27338965, 63552672, 25641356}},
+        {{16544735, 13250366, 50304436, 15546241, 62525861,
+          12757257, 64646556, 24874095, 48201831, 23891632},
+         {64693606, 17976703, 18312302, 4964443, 51836334,
+          20900867, 26820650, 16690659, 25459437, 28989823},
+         {41964155, 11425019, 28423002, 22533875, 60963942,
+          17728207, 9142794, 31162830, 60676445, 31909614}},
+        {{44004212, 6253475, 16964147, 29785560, 41994891,
+          21257994, 39651638, 17209773, 6335691, 7249989},
+         {36775618, 13979674, 7503222, 21186118, 55152142,
+          28932738, 36836594, 2682241, 25993170, 21075909},
+         {4364628, 5930691, 32304656, 23509878, 59054082,
+          15091130, 22857016, 22955477, 31820367, 15075278}},
+        {{31879134, 24635739, 17258760, 90626, 59067028,
+          28636722, 24162787, 23903546, 49138625, 12833044},
+         {19073683, 14851414, 42705695, 21694263, 7625277,
+          11091125, 47489674, 2074448, 57694925, 14905376},
+         {24483648, 21618865, 64589997, 22007013, 65555733,
+          15355505, 41826784, 9253128, 27628530, 25998952}},
+        {{17597607, 8340603, 19355617, 552187, 26198470,
+          30377849, 4593323, 24396850, 52997988, 15297015},
+         {510886, 14337390, 35323607, 16638631, 6328095,
+          2713355, 46891447, 21690211, 8683220, 2921426},
+         {18606791, 11874196, 27155355, 28272950, 43077121,
+          6265445, 41930624, 32275507, 4674689, 13890525}},
+        {{13609624, 13069022, 39736503, 20498523, 24360585,
+          9592974, 14977157, 9835105, 4389687, 288396},
+         {9922506, 33035038, 13613106, 5883594, 48350519,
+          33120168, 54804801, 8317627, 23388070, 16052080},
+         {12719997, 11937594, 35138804, 28525742, 26900119,
+          8561328, 46953177, 21921452, 52354592, 22741539}},
+        {{15961858, 14150409, 26716931, 32888600, 44314535,
+          13603568, 11829573, 7467844, 38286736, 929274},
+         {11038231, 21972036, 39798381, 26237869, 56610336,
+          17246600, 43629330, 24182562, 45715720, 2465073},
+         {20017144, 29231206, 27915241, 1529148, 12396362,
+          15675764, 13817261, 23896366, 2463390, 28932292}},
+        {{50749986, 20890520, 55043680, 4996453, 65852442,
+          1073571, 9583558, 12851107, 4003896, 12673717},
+         {65377275, 18398561, 63845933, 16143081, 19294135,
+          13385325, 14741514, 24450706, 7903885, 2348101},
+         {24536016, 17039225, 12715591, 29692277, 1511292,
+          10047386, 63266518, 26425272, 38731325, 10048126}}
+    },
+    { /* 256^27 B */
+        {{54486638, 27349611, 30718824, 2591312, 56491836,
+          12192839, 18873298, 26257342, 34811107, 15221631},
+         {40630742, 22450567, 11546243, 31701949, 9180879,
+          7656409, 45764914, 2095754, 29769758, 6593415},
+         {35114656, 30646970, 4176911, 3264766, 12538965,
+          32686321, 26312344, 27435754, 30958053, 8292160}},
+        {{31429803, 19595316, 29173531, 15632448, 12174511,
+          30794338, 32808830, 3977186, 26143136, 30405556},
+         {22648882, 1402143, 44308880, 13746058, 7936347,
+          365344, 58440231, 31879998, 63350620, 31249806},
+         {51616947, 8012312, 64594134, 20851969, 43143017,
+          23300402, 65496150, 32018862, 50444388, 8194477}},
+        {{27338066, 26047012, 59694639, 10140404, 48082437,
+          26964542, 27277190, 8855376, 28572286, 3005164},
+         {26287105, 4821776, 25476601, 29408529, 63344350,
+          17765447, 49100281, 1182478, 41014043, 20474836},
+         {59937691, 3178079, 23970071, 6201893, 49913287,
+          29065239, 45232588, 19571804, 32208682, 32356184}},
+        {{50451143, 2817642, 56822502, 14811297, 6024667,
+          13349505, 39793360, 23056589, 39436278, 22014573},
+         {15941010, 24148500, 45741813, 8062054, 31876073,
+          33315803, 51830470, 32110002, 15397330, 29424239},
+         {8934485, 20068965, 43822466, 20131190, 34662773,
+          14047985, 31170398, 32113411, 39603297, 15087183}},
+        {{48751602, 31397940, 24524912, 16876564, 15520426,
+          27193656, 51606457, 11461895, 16788528, 27685490},
+         {65161459, 16013772, 21750665, 3714552, 49707082,
+          17498998, 63338576, 23231111, 31322513, 21938797},
+         {21426636, 27904214, 53460576, 28206894, 38296674,
+          28633461, 48833472, 18933017, 13040861, 21441484}},
+        {{11293895, 12478086, 39972463, 15083749, 37801443,
+          14748871, 14555558, 20137329, 1613710, 4896935},
+         {41213962, 15323293, 58619073, 25496531, 25967125,
+          20128972, 2825959, 28657387, 43137087, 22287016},
+         {51184079, 28324551, 49665331, 6410663, 3622847,
+          10243618, 20615400, 12405433, 43355834, 25118015}},
+        {{60017550, 12556207, 46917512, 9025186, 50036385,
+          4333800, 4378436, 2432030, 23097949, 32988414},
+         {4565804, 17528778, 20084411, 25711615, 1724998,
+          189254, 24767264, 10103221, 48596551, 2424777},
+         {366633, 21577626, 8173089, 26664313, 30788633,
+          5745705, 59940186, 1344108, 63466311, 12412658}},
+        {{43107073, 7690285, 14929416, 33386175, 34898028,
+          20141445, 24162696, 18227928, 63967362, 11179384},
+         {18289503, 18829478, 8056944, 16430056, 45379140,
+          7842513, 61107423, 32067534, 48424218, 22110928},
+         {476239, 6601091, 60956074, 23831056, 17503544,
+          28690532, 27672958, 13403813, 11052904, 5219329}}
+    },
+    { /* 256^28 B */
+        {{20678527, 25178694, 34436965, 8849122, 62099106,
+          14574751, 31186971, 29580702, 9014761, 24975376},
+         {53464795, 23204192, 51146355, 5075807, 65594203,
+          22019831, 34006363, 9160279, 8473550, 30297594},
+         {24900749, 14435722, 17209120, 18261891, 44516588,
+          9878982, 59419555, 17218610, 42540382, 11788947}},
+        {{63990690, 22159237, 53306774, 14797440, 9652448,
+          26708528, 47071426, 10410732, 42540394, 32095740},
+         {51449703, 16736705, 44641714, 10215877, 58011687,
+          7563910, 11871841, 21049238, 48595538, 8464117},
+         {43708233, 8348506, 52522913, 32692717, 63158658,
+          27181012, 14325288, 8628612, 33313881, 25183915}},
+        {{46921872, 28586496, 22367355, 5271547, 66011747,
+          28765593, 42303196, 23317577, 58168128, 27736162},
+         {60160060, 31759219, 34483180, 17533252, 32635413,
+          26180187, 15989196, 20716244, 28358191, 29300528},
+         {43547083, 30755372, 34757181, 31892468, 57961144,
+          10429266, 50471180, 4072015, 61757200, 5596588}},
+        {{38872266, 30164383, 12312895, 6213178, 3117142,
+          16078565, 29266239, 2557221, 1768301, 15373193},
+         {59865506, 30307471, 62515396, 26001078, 66980936,
+          32642186, 66017961, 29049440, 42448372, 3442909},
+         {36898293, 5124042, 14181784, 8197961, 18964734,
+          21615339, 22597930, 7176455, 48523386, 13365929}},
+        {{59231455, 32054473, 8324672, 4690079, 6261860,
+          890446, 24538107, 24984246, 57419264, 30522764},
+         {25008885, 22782833, 62803832, 23916421, 16265035,
+          15721635, 683793, 21730648, 15723478, 18390951},
+         {57448220, 12374378, 40101865, 26528283, 59384749,
+          21239917, 11879681, 5400171, 519526, 32318556}},
+        {{22258397, 17222199, 59239046, 14613015, 44588609,
+          30603508, 46754982, 7315966, 16648397, 7605640},
+         {59027556, 25089834, 58885552, 9719709, 19259459,
+          18206220, 23994941, 28272877, 57640015, 4763277},
+         {45409620, 9220968, 51378240, 1084136, 41632757,
+          30702041, 31088446, 25789909, 55752334, 728111}},
+        {{26047201, 21802961, 60208540, 17032633, 24092067,
+          9158119, 62835319, 20998873, 37743427, 28056159},
+         {17510331, 33231575, 5854288, 8403524, 17133918,
+          30441820, 38997856, 12327944, 10750447, 10014012},
+         {56796096, 3936951, 9156313, 24656749, 16498691,
+          32559785, 39627812, 32887699, 3424690, 7540221}},
+        {{30322361, 26590322, 11361004, 29411115, 7433303,
+          4989748, 60037442, 17237212, 57864598, 15258045},
+         {13054543, 30774935, 19155473, 469045, 54626067,
+          4566041, 5631406, 2711395, 1062915, 28418087},
+         {47868616, 22299832, 37599834, 26054466, 61273100,
+          13005410, 61042375, 12194496, 32960380, 1459310}}
+    },
+    { /* 256^29 B */
+        {{19852015, 7027924, 23669353, 10020366, 8586503,
+          26896525, 394196, 27452547, 18638002, 22379495},
+         {31395515, 15098109, 26581030, 8030562, 50580950,
+          28547297, 9012485, 25970078, 60465776, 28111795},
+         {57916680, 31207054, 65111764, 4529533, 25766844,
+          607986, 67095642, 9677542, 34813975, 27098423}},
+        {{64664349, 33404494, 29348901, 8186665, 1873760,
+          12489863, 36174285, 25714739, 59256019, 25416002},
+         {51872508, 18120922, 7766469, 746860, 26346930,
+          23332670, 39775412, 10754587, 57677388, 5203575},
+         {31834314, 14135496, 66338857, 5159117, 20917671,
+          16786336, 59640890, 26216907, 31809242, 7347066}},
+        {{57502122, 21680191, 20414458, 13033986, 13716524,
+          21862551, 19797969, 21343177, 15192875, 31466942},
+         {54445282, 31372712, 1168161, 29749623, 26747876,
+          19416341, 10609329, 12694420, 33473243, 20172328},
+         {33184999, 11180355, 15832085, 22169002, 65475192,
+          225883, 15089336, 22530529, 60973201, 14480052}},
+        {{31308717, 27934434, 31030839, 31657333, 15674546,
+          26971549, 5496207, 13685227, 27595050, 8737275},
+         {46790012, 18404192, 10933842, 17376410, 8335351,
+          26008410, 36100512, 20943827, 26498113, 66511},
+         {22644435, 24792703, 50437087, 4884561, 64003250,
+          19995065, 30540765, 29267685, 53781076, 26039336}},
+        {{39091017, 9834844, 18617207, 30873120, 63706907,
+          20246925, 8205539, 13585437, 49981399, 15115438},
+         {23711543, 32881517, 31206560, 25191721, 6164646,
+          23844445, 33572981, 32128335, 8236920, 16492939},
+         {43198286, 20038905, 40809380, 29050590, 25005589,
+          25867162, 19574901, 10071562, 6708380, 27332008}},
+        {{2101372, 28624378, 19702730, 2367575, 51681697,
+          1047674, 5301017, 9328700, 29955601, 21876122},
+         {3096359, 9271816, 45488000, 18032587, 52260867,
+          25961494, 41216721, 20918836, 57191288, 6216607},
+         {34493015, 338662, 41913253, 2510421, 37895298,
+          19734218, 24822829, 27407865, 40341383, 7525078}},
+        {{44042215, 19568808, 16133486, 25658254, 63719298,
+          778787, 66198528, 30771936, 47722230, 11994100},
+         {21691500, 19929806, 66467532, 19187410, 3285880,
+          30070836, 42044197, 9718257, 59631427, 13381417},
+         {18445390, 29352196, 14979845, 11622458, 65381754,
+          29971451, 23111647, 27179185, 28535281, 15779576}},
+        {{30098034, 3089662, 57874477, 16662134, 45801924,
+          11308410, 53040410, 12021729, 9955285, 17251076},
+         {9734894, 18977602, 59635230, 24415696, 2060391,
+          11313496, 48682835, 9924398, 20194861, 13380996},
+         {40730762, 25589224, 44941042, 15789296, 49053522,
+          27385639, 65123949, 15707770, 26342023, 10146099}}
+    },
+    { /* 256^30 B */
+        {{41091971, 33334488, 21339190, 33513044, 19745255,
+          30675732, 37471583, 2227039, 21612326, 33008704},
+         {54031477, 1184227, 23562814, 27583990, 46757619,
+          27205717, 25764460, 12243797, 46252298, 11649657},
+         {57077370, 11262625, 27384172, 2271902, 26947504,
+          17556661, 39943, 6114064, 33514190, 2333242}},
+        {{45675257, 21132610, 8119781, 7219913, 45278342,
+          24538297, 60429113, 20883793, 24350577, 20104431},
+         {62992557, 22282898, 43222677, 4843614, 37020525,
+          690622, 35572776, 23147595, 8317859, 12352766},
+         {18200138, 19078521, 34021104, 30857812, 43406342,
+          24451920, 43556767, 31266881, 20712162, 6719373}},
+        {{26656189, 6075253, 59250308, 1886071, 38764821,
+          4262325, 11117530, 29791222, 26224234, 30256974},
+         {49939907, 18700334, 63713187, 17184554, 47154818,
+          14050419, 21728352, 9493610, 18620611, 17125804},
+         {53785524, 13325348, 11432106, 5964811, 18609221,
+          6062965, 61839393, 23828875, 36407290, 17074774}},
+        {{43248326, 22321272, 26961356, 1640861, 34695752,
+          16816491, 12248508, 28313793, 13735341, 1934062},
+         {25089769, 6742589, 17081145, 20148166, 21909292,
+          17486451, 51972569, 29789085, 45830866, 5473615},
+         {31883658, 25593331, 1083431, 21982029, 22828470,
+          13290673, 59983779, 12469655, 29111212, 28103418}},
+        {{24244947, 18504025, 40845887, 2791539, 52111265,
+          16666677, 24367466, 6388839, 56813277, 452382},
+         {41468082, 30136590, 5217915, 16224624, 19987036,
+          29472163, 42872612, 27639183, 15766061, 8407814},
+         {46701865, 13990230, 15495425, 16395525, 5377168,
+          15166495, 58191841, 29165478, 59040954, 2276717}},
+        {{30157899, 12924066, 49396814, 9245752, 19895028,
+          3368142, 43281277, 5096218, 22740376, 26251015},
+         {2041139, 19298082, 7783686, 13876377, 41161879,
+          20201972, 24051123, 13742383, 51471265, 13295221},
+         {33338218, 25048699, 12532112, 7977527, 9106186,
+          31839181, 49388668, 28941459, 62657506, 18884987}},
+        {{47063583, 5454096, 52762316, 6447145, 28862071,
+          1883651, 64639598, 29412551, 7770568, 9620597},
+         {23208049, 7979712, 33071466, 8149229, 1758231,
+          22719437, 30945527, 31860109, 33606523, 18786461},
+         {1439939, 17283952, 66028874, 32760649, 4625401,
+          10647766, 62065063, 1220117, 30494170, 22113633}},
+        {{62071265, 20526136, 64138304, 30492664, 15640973,
+          26852766, 40369837, 926049, 65424525, 20220784},
+         {13908495, 30005160, 30919927, 27280607, 45587000,
+          7989038, 9021034, 9078865, 3353509, 4033511},
+         {37445433, 18440821, 32259990, 33209950, 24295848,
+          20642309, 23161162, 8839127, 27485041, 7356032}}
+    },
+    { /* 256^31 B */
+        {{9661008, 705443, 11980065, 28184278, 65480320,
+          14661172, 60762722, 2625014, 28431036, 16782598},
+         {43269631, 25243016, 41163352, 7480957, 49427195,
+          25200248, 44562891, 14150564, 15970762, 4099461},
+         {29262576, 16756590, 26350592, 24760869, 8529670,
+          22346382, 13617292, 23617289, 11465738, 8317062}},
+        {{41615764, 26591503, 32500199, 24135381, 44070139,
+          31252209, 14898636, 3848455, 20969334, 28396916},
+         {46724414, 19206718, 48772458, 13884721, 34069410,
+          2842113, 45498038, 29904543, 11177094, 14989547},
+         {42612143, 21838415, 16959895, 2278463, 12066309,
+          10137771, 13515641, 2581286, 38621356, 9930239}},
+        {{49357223, 31456605, 16544299, 20545132, 51194056,
+          18605350, 18345766, 20150679, 16291480, 28240394},
+         {33879670, 2553287, 32678213, 9875984, 8534129,
+          6889387, 57432090, 6957616, 4368891, 9788741},
+         {16660737, 7281060, 56278106, 12911819, 20108584,
+          25452756, 45386327, 24941283, 16250551, 22443329}},
+        {{47343357, 2390525, 50557833, 14161979, 1905286,
+          6414907, 4689584, 10604807, 36918461, 4782746},
+         {65754325, 14736940, 59741422, 20261545, 7710541,
+          19398842, 57127292, 4383044, 22546403, 437323},
+         {31665558, 21373968, 50922033, 1491338, 48740239,
+          3294681, 27343084, 2786261, 36475274, 19457415}},
+        {{52641566, 32870716, 33734756, 7448551, 19294360,
+          14334329, 47418233, 2355318, 47824193, 27440058},
+         {15121312, 17758270, 6377019, 27523071, 56310752,
+          20596586, 18952176, 15496498, 37728731, 11754227},
+         {64471568, 20071356, 8488726, 19250536, 12728760,
+          31931939, 7141595, 11724556, 22761615, 23420291}},
+        {{16918416, 11729663, 49025285, 3022986, 36093132,
+          20214772, 38367678, 21327038, 32851221, 11717399},
+         {11166615, 7338049, 60386341, 4531519, 37640192,
+          26252376, 31474878, 3483633, 65915689, 29523600},
+         {66923210, 9921304, 31456609, 20017994, 55095045,
+          13348922, 33142652, 6546660, 47123585, 29606055}},
+        {{34648249, 11266711, 55911757, 25655328, 31703693,
+          3855903, 58571733, 20721383, 36336829, 18068118},
+         {49102387, 12709067, 3991746, 27075244, 45617340,
+          23004006, 35973516, 17504552, 10928916, 3011958},
+         {60151107, 17960094, 31696058, 334240, 29576716,
+          14796075, 36277808, 20749251, 18008030, 10258577}},
+        {{44660220, 15655568, 7018479, 29144429, 36794597,
+          32352840, 65255398, 1367119, 25127874, 6671743},
+         {29701166, 19180498, 56230743, 9279287, 67091296,
+          13127209, 21382910, 11042292, 25838796, 4642684},
+         {46678630, 14955536, 42982517, 8124618, 61739576,
+          27563961, 30468146, 19653792, 18423288, 4177476}}
+    },
+    { /* 256^32 B */
+        {{30302609, 1507411, 62888621, 5392636, 27758922,
+          788191, 9475265, 22370513, 16762861, 5235054},
+         {38057017, 4162143, 62579277, 1751107, 59588258,
+          28154684, 30059416, 30607001, 510174, 28459427},
+         {22476136, 5975734, 55107595, 5440910, 51141732,
+          31215821, 50717635, 21967150, 38541871, 13012346}},
+        {{22087786, 32941037, 54782446, 24211257, 27930663,
+          8927766, 55972118, 31899792, 7561807, 9366832},
+         {65454187, 8374921, 9842976, 22513132, 1637016,
+          10201573, 19843967, 6395364, 40974265, 32689356},
+         {33807477, 8703774, 49789117, 804187, 11537029,
+          10461531, 25199761, 28817683, 7788808, 19576117}},
+        {{31539831, 11324787, 32396869, 18250517, 18109280,
+          10335166, 49772263, 21988137, 9343610, 29316152},
+         {182918, 21491261, 12449731, 3168715, 7255236,
+          18558332, 4517248, 23604587, 11104568, 18701651},
+         {12160207, 19370469, 58186771, 19884782, 36408679,
+          20530526, 2831915, 24322436, 17841166, 31661324}},
+        {{16737486, 6710538, 48898157, 18356052, 65409079,
+          17961677, 20784944, 5960118, 44666795, 32999169},
+         {39083368, 1430163, 36776225, 15362337, 5247678,
+          25822029, 38432986, 30342154, 16712416, 26719622},
+         {7311565, 6622492, 44126383, 25229860, 53638274,
+          17254701, 12240985, 24271291, 57092946, 4914301}},
+        {{37465507, 21708441, 58202057, 7063478, 29821186,
+          32880741, 43759394, 22781536, 18232172, 29362561},
+         {31761076, 30245014, 38783746, 15388664, 59678194,
+          5903600, 7535350, 25403275, 5582730, 28829952},
+         {58635430, 26011089, 16906248, 19017894, 15631242,
+          17194353, 33397869, 3563613, 9212715, 2371566}},
+        {{425117, 23155015, 7373900, 12384811, 58162859,
+          32267825, 44711147, 6168977, 4764366, 27205359},
+         {65130435, 17170732, 18236697, 31225954, 56145914,
+          23913370, 27253737, 21099982, 18774215, 4689180},
+         {24950098, 7177911, 12615317, 7966426, 45577734,
+          29453989, 38937092, 32264880, 3044135, 1265709}},
+        {{59247948, 21631677, 28304595, 28912391, 61071462,
+          4335742, 54357863, 32623928, 33587595, 379545},
+         {22162871, 10666214, 23275192, 15660622, 57392151,
+          9859773, 32253345, 30895700, 53236368, 17811059},
+         {27772317, 12272246, 54555005, 1129291, 11276698,
+          30151258, 64486187, 46924, 65473792, 20817897}},
+        {{37589429, 7721765, 29306264, 3034774, 17603837,
+          26733629, 8333504, 15727243, 38535476, 3989061},
+         {3796235, 26267699, 15117603, 3840627, 18547265,
+          4965809, 50889570, 32611379, 17989626, 21222067},
+         {8409150, 28154227, 67023426, 22842135, 55164885,
+          12843055, 37976410, 18168594, 14095210, 5016004}}
+    }
+#endif
+};
+
+static void ge_p3_0(ge_p3 *h)
+{
+    fe_0(h->X);
+    fe_1(h->Y);
+    fe_1(h->Z);
+    fe_0(h->T);
+}
+
+static void ge_precomp_0(ge_precomp *h)
+{
+    fe_1(h->yplusx);
+    fe_1(h->yminusx);
+    fe_0(h->xy2d);
+}
+
+static void ge_p1p1_to_p2(ge_p2 *r, const ge_p1p1 *p)
+{
+    fe_mul(r->X, p->X, p->T);
+    fe_mul(r->Y, p->Y, p->Z);
+    fe_mul(r->Z, p->Z, p->T);
+}
+
+static void ge_p1p1_to_p3(ge_p3 *r, const ge_p1p1 *p)
+{
+    fe_mul(r->X, p->X, p->T);
+    fe_mul(r->Y, p->Y, p->Z);
+    fe_mul(r->Z, p->Z, p->T);
+    fe_mul(r->T, p->X, p->Y);
+}
+
+/* r = 2p, the "dbl-2008-hwcd" formulas. */
+void ge_p2_dbl(ge_p1p1 *r, const ge_p2 *p)
+{
+    fe t0;
+
+    fe_sq(r->X, p->X);
+    fe_sq(r->Z, p->Y);
+    fe_sq(r->T, p->Z);
+    fe_add(r->T, r->T, r->T);
+    fe_add(r->Y, p->X, p->Y);
+    fe_sq(t0, r->Y);
+    fe_add(r->Y, r->Z, r->X);
+    fe_sub(r->Z, r->Z, r->X);
+    fe_sub(r->X, t0, r->Y);
+    fe_sub(r->T, r->T, r->Z);
+}
+
+/* r = p + q, the "madd-2008-hwcd-3" formulas, which are complete. */
+void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q)
+{
+    fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+    fe_sub(r->Y, p->Y, p->X);
+    fe_mul(r->Z, r->X, q->yplusx);
+    fe_mul(r->Y, r->Y, q->yminusx);
+    fe_mul(r->T, q->xy2d, p->T);
+    fe_add(t0, p->Z, p->Z);
+    fe_sub(r->X, r->Z, r->Y);
+    fe_add(r->Y, r->Z, r->Y);
+    fe_add(r->Z, t0, r->T);
+    fe_sub(r->T, t0, r->T);
+}
+
+static void ge_precomp_cmov(ge_precomp *t, const ge_precomp *u,
+                            unsigned int b)
+{
+    fe_cmov(t->yplusx, u->yplusx, b);
+    fe_cmov(t->yminusx, u->yminusx, b);
+    fe_cmov(t->xy2d, u->xy2d, b);
+}
+
+/* Returns 1 if b == c, and 0 otherwise, without branching. */
+static unsigned int equal(unsigned int b, unsigned int c)
+{
+    uint32_t y = (uint32_t)(b ^ c);
+    return (unsigned int)((y - 1) >> 31);
+}
+
+/* Sets t to b times base[pos][0], for -8 <= b <= 8, reading every entry of
+ * the row so as not to reveal b through the cache. */
+void ge_select(ge_precomp *t, int pos, signed char b)
+{
+    unsigned int negative = (unsigned int)((uint64_t)(int64_t)b >> 63);
+    unsigned int babs = (unsigned int)(b - ((-(int)negative & b) * 2));
+    ge_precomp minus;
+    int j;
+
+    ge_precomp_0(t);
+
+    for (j = 0; j < 8; ++j)
+        ge_precomp_cmov(t, &base[pos][j], equal(babs, (unsigned int)j + 1));
+
+    memcpy(minus.yplusx, t->yminusx, sizeof(fe));
+    memcpy(minus.yminusx, t->yplusx, sizeof(fe));
+    fe_neg(minus.xy2d, t->xy2d);
+
+    ge_precomp_cmov(t, &minus, negative);
+}
+
+/* h = a B, where a is any 256-bit little-endian scalar, which is written as
+ * 65 signed radix-16 digits e[i] in [-8, 8), the last being 0 or 1, so that
+ * a = sum e[i] 16^i = sum e[2i] 256^i + 16 sum e[2i+1] 256^i. */
+void ge_scalarmult_base(ge_p3 *h, const uint8_t *a)
+{
+    signed char e[65], carry = 0;
+    ge_precomp t;
+    ge_p1p1 r;
+    ge_p2 s;
+    int i;
+
+    for (i = 0; i < 32; ++i)
+    {
+        e[2 * i + 0] = (signed char)((a[i] >> 0) & 15);
+        e[2 * i + 1] = (signed char)((a[i] >> 4) & 15);
+    }
+
+    for (i = 0; i < 64; ++i)
+    {
+        e[i] = (signed char)(e[i] + carry);
+        carry = (signed char)((e[i] + 8) >> 4);
+        e[i] = (signed char)(e[i] - carry * 16);
+    }
+
+    e[64] = carry;
+
+    ge_p3_0(h);
+
+    for (i = 1; i < 65; i += 2)
+    {
+        ge_select(&t, i / 2, e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+
+    memcpy(s.X, h->X, sizeof(fe));
+    memcpy(s.Y, h->Y, sizeof(fe));
+    memcpy(s.Z, h->Z, sizeof(fe));
+
+    for (i = 0; i < 3; ++i)
+    {
+        ge_p2_dbl(&r, &s);
+        ge_p1p1_to_p2(&s, &r);
+    }
+
+    ge_p2_dbl(&r, &s);
+    ge_p1p1_to_p3(h, &r);
+
+    for (i = 0; i < 65; i += 2)
+    {
+        ge_select(&t, i / 2, e[i]);
+        ge_madd(&r, h, &t);
+        ge_p1p1_to_p3(h, &r);
+    }
+
+    memset(e, 0, sizeof(e));
+    memset(&t, 0, sizeof(t));
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* The functions below are for signatures, and those which are only used to
+ * verify them deal with public data alone, so they run in variable time. */
+
+static void ge_p2_0(ge_p2 *h)
+{
+    fe_0(h->X);
+    fe_1(h->Y);
+    fe_1(h->Z);
+}
+
+static void ge_p3_to_p2(ge_p2 *r, const ge_p3 *p)
+{
+    memcpy(r->X, p->X, sizeof(fe));
+    memcpy(r->Y, p->Y, sizeof(fe));
+    memcpy(r->Z, p->Z, sizeof(fe));
+}
+
+static void ge_p3_to_cached(ge_cached *r, const ge_p3 *p)
+{
+    fe_add(r->YplusX, p->Y, p->X);
+    fe_sub(r->YminusX, p->Y, p->X);
+    memcpy(r->Z, p->Z, sizeof(fe));
+    fe_mul(r->T2d, p->T, fe_d2);
+}
+
+static void ge_p3_neg(ge_p3 *r, const ge_p3 *p)
+{
+    fe_neg(r->X, p->X);
+    memcpy(r->Y, p->Y, sizeof(fe));
+    memcpy(r->Z, p->Z, sizeof(fe));
+    fe_neg(r->T, p->T);
+}
+
+static void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p)
+{
+    ge_p2 q;
+
+    ge_p3_to_p2(&q, p);
+    ge_p2_dbl(r, &q);
+}
+
+/* r = p + q, the "add-2008-hwcd-3" formulas, which are complete. */
+void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q)
+{
+    fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+    fe_sub(r->Y, p->Y, p->X);
+    fe_mul(r->Z, r->X, q->YplusX);
+    fe_mul(r->Y, r->Y, q->YminusX);
+    fe_mul(r->T, q->T2d, p->T);
+    fe_mul(r->X, p->Z, q->Z);
+    fe_add(t0, r->X, r->X);
+    fe_sub(r->X, r->Z, r->Y);
+    fe_add(r->Y, r->Z, r->Y);
+    fe_add(r->Z, t0, r->T);
+    fe_sub(r->T, t0, r->T);
+}
+
+/* r = p - q, which is ge_add with -q, whose y + x and y - x are swapped
+ * and whose 2dt is negated. */
+static void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q)
+{
+    fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+    fe_sub(r->Y, p->Y, p->X);
+    fe_mul(r->Z, r->X, q->YminusX);
+    fe_mul(r->Y, r->Y, q->YplusX);
+    fe_mul(r->T, q->T2d, p->T);
+    fe_mul(r->X, p->Z, q->Z);
+    fe_add(t0, r->X, r->X);
+    fe_sub(r->X, r->Z, r->Y);
+    fe_add(r->Y, r->Z, r->Y);
+    fe_sub(r->Z, t0, r->T);
+    fe_add(r->T, t0, r->T);
+}
+
+/* r = p - q, as ge_sub but for a point of the table. */
+static void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q)
+{
+    fe t0;
+
+    fe_add(r->X, p->Y, p->X);
+    fe_sub(r->Y, p->Y, p->X);
+    fe_mul(r->Z, r->X, q->yminusx);
+    fe_mul(r->Y, r->Y, q->yplusx);
+    fe_mul(r->T, q->xy2d, p->T);
+    fe_add(t0, p->Z, p->Z);
+    fe_sub(r->X, r->Z, r->Y);
+    fe_add(r->Y, r->Z, r->Y);
+    fe_sub(r->Z, t0, r->T);
+    fe_add(r->T, t0, r->T);
+}
+
+static void ge_tobytes(uint8_t *s, const ge_p3 *h)
+{
+    fe recip, x, y;
+
+    fe_invert(recip, h->Z);
+    fe_mul(x, h->X, recip);
+    fe_mul(y, h->Y, recip);
+    fe_tobytes(s, y);
+
+    s[31] ^= (uint8_t)(fe_isnegative(x) << 7);
+}
+
+/* Decodes the point encoded as s, as in RFC 8032, and negates it, which is
+ * how verification needs it. Returns 0 if s is not a canonical encoding of
+ * a point, that is, if y is not reduced, if there is no x for y, or if the
+ * sign bit is set for x = 0. */
+static int ge_frombytes_neg(ge_p3 *h, const uint8_t *s)
+{
+    fe u, v, v3, vxx, t;
+    unsigned int sign = s[31] >> 7;
+    uint8_t check[32];
+
+    fe_frombytes(h->Y, s);
+    fe_tobytes(check, h->Y);
+
+    if (memcmp(check, s, 31) || check[31] != (s[31] & 0x7f)) return 0;
+
+    fe_1(h->Z);
+    fe_sq(u, h->Y);
+    fe_mul(v, u, fe_d);
+    fe_sub(u, u, h->Z);                     /* u = y^2 - 1 */
+    fe_add(v, v, h->Z);                     /* v = dy^2 + 1 */
+
+    fe_sq(v3, v);
+    fe_mul(v3, v3, v);
+    fe_sq(h->X, v3);
+    fe_mul(h->X, h->X, v);
+    fe_mul(h->X, h->X, u);                  /* x = uv^7 */
+
+    fe_pow22523(h->X, h->X);
+    fe_mul(h->X, h->X, v3);
+    fe_mul(h->X, h->X, u);                  /* x = uv^3 (uv^7)^((p-5)/8) */
+
+    /* Then vx^2 is u if x is a root, or -u if x sqrt(-1) is one. */
+    fe_sq(vxx, h->X);
+    fe_mul(vxx, vxx, v);
+    fe_sub(t, vxx, u);
+
+    if (!fe_iszero(t))
+    {
+        fe_add(t, vxx, u);
+        if (!fe_iszero(t)) return 0;
+
+        fe_mul(h->X, h->X, fe_sqrtm1);
+    }
+
+    if (sign && fe_iszero(h->X)) return 0;
+
+    if (fe_isnegative(h->X) == sign) fe_neg(h->X, h->X);
+
+    fe_mul(h->T, h->X, h->Y);
+
+    return 1;
+}
+
+/* Returns 1 if p is the identity, (0 : 1), and 0 otherwise. */
+static int ge_p2_is_0(const ge_p2 *p)
+{
+    fe t;
+
+    fe_sub(t, p->Y, p->Z);
+
+    return fe_iszero(p->X) && fe_iszero(t);
+}
+
+/* Writes the scalar a, below 2^255, as 256 signed digits r[i] such that a
+ * is the sum of r[i] 2^i, as in ref10. Each nonzero digit is odd and at
+ * most "max" in absolute value, and is followed by several zero digits. */
+static void slide(signed char *r, const uint8_t *a, int max)
+{
+    int i, b, k;
+
+    for (i = 0; i < 256; ++i)
+        r[i] = (signed char)((a[i >> 3] >> (i & 7)) & 1);
+
+    for (i = 0; i < 256; ++i)
+    {
+        if (!r[i]) continue;
+
+        for (b = 1; b <= 6 && i + b < 256; ++b)
+        {
+            if (!r[i + b]) continue;
+
+            if (r[i] + (r[i + b] << b) <= max)
+            {
+                r[i] = (signed char)(r[i] + (r[i + b] << b));
+                r[i + b] = 0;
+            }
+            else if (r[i] - (r[i + b] << b) >= -max)
+            {
+                r[i] = (signed char)(r[i] - (r[i + b] << b));
+
+                for (k = i + b; k < 256; ++k)
+                {
+                    if (!r[k])
+                    {
+                        r[k] = 1;
+                        break;
+                    }
+
+                    r[k] = 0;
+                }
+            }
+            else break;
+        }
+    }
+}
+
+/* r = a A + b B, for a and b below 2^255, by Straus' method on the sliding
+ * windows of both scalars, with the odd multiples of A up to 15 A computed
+ * here, and those of B up to 7 B taken from the first row of the table. */
+static void ge_double_scalarmult_vartime(ge_p3 *r, const uint8_t *a,
+                                         const ge_p3 *A, const uint8_t *b)
+{
+    signed char aslide[256], bslide[256];
+    ge_cached Ai[8];
+    ge_p1p1 t;
+    ge_p3 u, A2;
+    ge_p2 s;
+    int i;
+
+    slide(aslide, a, 15);
+    slide(bslide, b, 7);
+
+    ge_p3_to_cached(&Ai[0], A);
+    ge_p3_dbl(&t, A);
+    ge_p1p1_to_p3(&A2, &t);
+
+    for (i = 1; i < 8; ++i)
+    {
+        ge_add(&t, &A2, &Ai[i - 1]);
+        ge_p1p1_to_p3(&u, &t);
+        ge_p3_to_cached(&Ai[i], &u);
+    }
+
+    ge_p3_0(r);
+    ge_p2_0(&s);
+
+    for (i = 255; i >= 0 && !aslide[i] && !bslide[i]; --i);
+
+    for (; i >= 0; --i)
+    {
+        ge_p2_dbl(&t, &s);
+
+        if (aslide[i] > 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+            ge_add(&t, &u, &Ai[aslide[i] / 2]);
+        }
+        else if (aslide[i] < 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+            ge_sub(&t, &u, &Ai[-aslide[i] / 2]);
+        }
+
+        if (bslide[i] > 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+            ge_madd(&t, &u, &base[0][bslide[i] - 1]);
+        }
+        else if (bslide[i] < 0)
+        {
+            ge_p1p1_to_p3(&u, &t);
+            ge_msub(&t, &u, &base[0][-bslide[i] - 1]);
+        }
+
+        if (i)
+            ge_p1p1_to_p2(&s, &t);
+        else
+            ge_p1p1_to_p3(r, &t);
+    }
+}
+
+/* Returns the c bits of s from bit "pos", reading zeros past the end. */
+static int sc_bits(const uint8_t *s, int pos, int c)
+{
+    int x = 0, b;
+
+    for (b = 0; b < c && pos + b < 256; ++b)
+        x |= ((s[(pos + b) >> 3] >> ((pos + b) & 7)) & 1) << b;
+
+    return x;
+}
+
+/* r = the sum of s[i] p[i] for the n points p (with pc their cached form),
+ * by Pippenger's method with signed digits of c bits: for each position of
+ * digits, from the top, r is multiplied by 2^c, each point is added to the
+ * bucket of its digit (or subtracted, for a negative digit), and the sum of
+ * the buckets, each times its digit, is added to r by summing the running
+ * sums of the buckets from the top. */
+static void ge_multi_scalarmult_vartime(ge_p3 *r, const ge_p3 *p,
+                                        const ge_cached *pc,
+                                        const uint8_t (*s)[32],
+                                        size_t n, int c)
+{
+    signed char digit[EDWARDS25519_POINTS][EDWARDS25519_WINDOWS];
+    ge_p3 bucket[1 << (EDWARDS25519_BITS - 1)], run, sum;
+    int used[1 << (EDWARDS25519_BITS - 1)], nonzero = 0;
+    int windows = 256 / c + 1, k, w;
+    ge_cached q;
+    ge_p1p1 t;
+    ge_p2 u;
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        int carry = 0;
+
+        for (w = 0; w < windows; ++w)
+        {
+            int x = sc_bits(s[i], w * c, c) + carry;
+            carry = x >= (1 << (c - 1));
+            digit[i][w] = (signed char)(x - (carry << c));
+        }
+    }
+
+    ge_p3_0(r);
+
+    for (w = windows - 1; w >= 0; --w)
+    {
+        int has_run = 0, has_sum = 0;
+
+        if (nonzero)
+        {
+            ge_p3_to_p2(&u, r);
+
+            for (k = 0; k < c - 1; ++k)
+            {
+                ge_p2_dbl(&t, &u);
+                ge_p1p1_to_p2(&u, &t);
+            }
+
+            ge_p2_dbl(&t, &u);
+            ge_p1p1_to_p3(r, &t);
+        }
+
+        memset(used, 0, sizeof(used));
+
+        for (i = 0; i < n; ++i)
+        {
+            int d = digit[i][w], j = (d < 0 ? -d : d) - 1;
+
+            if (!d) continue;
+
+            if (!used[j])
+            {
+                if (d > 0)
+                    memcpy(&bucket[j], &p[i], sizeof(ge_p3));
+                else
+                    ge_p3_neg(&bucket[j], &p[i]);
+
+                used[j] = 1;
+            }
+            else
+            {
+                if (d > 0)
+                    ge_add(&t, &bucket[j], &pc[i]);
+                else
+                    ge_sub(&t, &bucket[j], &pc[i]);
+
+                ge_p1p1_to_p3(&bucket[j], &t);
+            }
+        }
+
+        for (k = (1 << (c - 1)) - 1; k >= 0; --k)
+        {
+            if (used[k])
+            {
+                if (has_run)
+                {
+                    ge_p3_to_cached(&q, &bucket[k]);
+                    ge_add(&t, &run, &q);
+                    ge_p1p1_to_p3(&run, &t);
+                }
+                else
+                    memcpy(&run, &bucket[k], sizeof(ge_p3));
+
+                has_run = 1;
+            }
+
+            if (!has_run) continue;
+
+            if (has_sum)
+            {
+                ge_p3_to_cached(&q, &run);
+                ge_add(&t, &sum, &q);
+                ge_p1p1_to_p3(&sum, &t);
+            }
+            else
+                memcpy(&sum, &run, sizeof(ge_p3));
+
+            has_sum = 1;
+        }
+
+        if (has_sum)
+        {
+            if (nonzero)
+            {
+                ge_p3_to_cached(&q, &sum);
+                ge_add(&t, r, &q);
+                ge_p1p1_to_p3(r, &t);
+            }
+            else
+                memcpy(r, &sum, sizeof(ge_p3));
+
+            nonzero = 1;
+        }
+    }
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* Scalars modulo the order L = 2^252 + 27742317777372353535851937790883648493
+ * of the base point, as 21-bit signed limbs in 64-bit integers, following
+ * ref10's sc_reduce and sc_muladd, where a limb past 2^252 is folded back
+ * by 2^252 = -27742317777372353535851937790883648493 (mod L). */
+
+/* Loads n limbs from 8n/3 bytes, the last taking all the remaining bits. */
+static void sc_load(int64_t *s, const uint8_t *in, int n)
+{
+    int i;
+
+    for (i = 0; i < n; ++i)
+    {
+        int pos = 21 * i;
+        const uint8_t *b = in + pos / 8;
+        uint64_t x = (uint64_t)b[0] | ((uint64_t)b[1] << 8)
+                   | ((uint64_t)b[2] << 16) | ((uint64_t)b[3] << 24);
+
+        x >>= pos % 8;
+        s[i] = (int64_t)(i == n - 1 ? x : x & 0x1fffff);
+    }
+}
+
+static void sc_fold(int64_t *s, int i)
+{
+    s[i - 12] += s[i] * 666643;
+    s[i - 11] += s[i] * 470296;
+    s[i - 10] += s[i] * 654183;
+    s[i - 9] -= s[i] * 997805;
+    s[i - 8] += s[i] * 136657;
+    s[i - 7] -= s[i] * 683901;
+    s[i] = 0;
+}
+
+/* Carries s[i] into s[i + 1], leaving it in [-2^20, 2^20). */
+static void sc_carry(int64_t *s, int i)
+{
+    int64_t c = (s[i] + (1 << 20)) >> 21;
+
+    s[i + 1] += c;
+    s[i] -= c * (1 << 21);
+}
+
+/* Carries s[i] into s[i + 1], leaving it in [0, 2^21). */
+static void sc_carry_floor(int64_t *s, int i)
+{
+    int64_t c = s[i] >> 21;
+
+    s[i + 1] += c;
+    s[i] -= c * (1 << 21);
+}
+
+/* Reduces the 24 limbs of s modulo L into the 32 bytes of out. */
+static void sc_reduce_limbs(uint8_t *out, int64_t *s)
+{
+    uint64_t w[4] = {0};
+    int i, pos;
+
+    for (i = 23; i >= 18; --i) sc_fold(s, i);
+    for (i = 6; i <= 16; i += 2) sc_carry(s, i);
+    for (i = 7; i <= 15; i += 2) sc_carry(s, i);
+
+    for (i = 17; i >= 12; --i) sc_fold(s, i);
+    for (i = 0; i <= 10; i += 2) sc_carry(s, i);
+    for (i = 1; i <= 11; i += 2) sc_carry(s, i);
+
+    sc_fold(s, 12);
+    for (i = 0; i <= 11; ++i) sc_carry_floor(s, i);
+
+    sc_fold(s, 12);
+    for (i = 0; i <= 10; ++i) sc_carry_floor(s, i);
+
+    for (i = 0, pos = 0; i < 12; ++i, pos += 21)
+    {
+        w[pos / 64] |= (uint64_t)s[i] << (pos % 64);
+
+        if (pos % 64 + 21 > 64)
+            w[pos / 64 + 1] |= (uint64_t)s[i] >> (64 - pos % 64);
+    }
+
+    store_words(out, w);
+}
+
+/* Returns 1 if the scalar s is below L, and 0 otherwise. */
+static int sc_is_canonical(const uint8_t *s)
+{
+    static const uint8_t L[32] =
+    {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58,
+        0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+
+    int i;
+
+    for (i = 31; i >= 0; --i)
+        if (s[i] != L[i]) return s[i] < L[i];
+
+    return 0;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void edwards25519_base(uint8_t *out, const uint8_t *scalar)
+{
+    ge_p3 A;
+
+    ge_scalarmult_base(&A, scalar);
+    ge_tobytes(out, &A);
+
+    memset(&A, 0, sizeof(A));
+}
+
+void edwards25519_reduce(uint8_t *out, const uint8_t *in)
+{
+    int64_t s[24];
+
+    sc_load(s, in, 24);
+    sc_reduce_limbs(out, s);
+
+    memset(s, 0, sizeof(s));
+}
+
+void edwards25519_muladd(uint8_t *s, const uint8_t *a, const uint8_t *b,
+                         const uint8_t *c)
+{
+    int64_t x[12], y[12], t[24];
+    int i, j;
+
+    sc_load(x, a, 12);
+    sc_load(y, b, 12);
+    sc_load(t, c, 12);
+
+    for (i = 12; i < 24; ++i) t[i] = 0;
+
+    for (i = 0; i < 12; ++i)
+        for (j = 0; j < 12; ++j)
+            t[i + j] += x[i] * y[j];
+
+    for (i = 0; i <= 22; i += 2) sc_carry(t, i);
+    for (i = 1; i <= 21; i += 2) sc_carry(t, i);
+
+    sc_reduce_limbs(s, t);
+
+    memset(x, 0, sizeof(x));
+    memset(y, 0, sizeof(y));
+    memset(t, 0, sizeof(t));
+}
+
+/* The equation is multiplied by the cofactor 8, as RFC 8032 has it, so that
+ * it holds for the same signatures whether they are checked one at a time
+ * or in batches, whatever components of small order they might carry. */
+int edwards25519_verify(const uint8_t *sig, const uint8_t *h,
+                        const uint8_t *pub)
+{
+    ge_p3 A, R, P;
+    ge_cached c;
+    ge_p1p1 t;
+    ge_p2 s;
+    int i;
+
+    if (!sc_is_canonical(sig + 32)) return 0;
+    if (!ge_frombytes_neg(&A, pub)) return 0;
+    if (!ge_frombytes_neg(&R, sig)) return 0;
+
+    ge_double_scalarmult_vartime(&P, h, &A, sig + 32);
+
+    ge_p3_to_cached(&c, &R);
+    ge_add(&t, &P, &c);
+    ge_p1p1_to_p2(&s, &t);
+
+    for (i = 0; i < 3; ++i)
+    {
+        ge_p2_dbl(&t, &s);
+        ge_p1p1_to_p2(&s, &t);
+    }
+
+    return ge_p2_is_0(&s);
+}
+
+/* The multiple of B is computed apart, which is as fast as including B in
+ * the buckets, and there are then only points of signatures to decode. The
+ * R have 128-bit scalars, so only the lower windows ever include them. */
+int edwards25519_verify_many(const uint8_t *const *sig, const uint8_t *h,
+                             const uint8_t *const *pub, const uint8_t *z,
+                             size_t count)
+{
+    ge_p3 point[EDWARDS25519_POINTS], B, P;
+    ge_cached cached[EDWARDS25519_POINTS], c;
+    uint8_t scalar[EDWARDS25519_POINTS][32], zs[32], zi[32];
+    ge_p1p1 t;
+    ge_p2 s;
+    size_t i;
+    int k;
+
+    memset(zs, 0, sizeof(zs));
+    memset(zi, 0, sizeof(zi));
+
+    for (i = 0; i < count; ++i)
+    {
+        if (!sc_is_canonical(sig[i] + 32)) return 0;
+        if (!ge_frombytes_neg(&point[2 * i + 0], sig[i])) return 0;
+        if (!ge_frombytes_neg(&point[2 * i + 1], pub[i])) return 0;
+
+        ge_p3_to_cached(&cached[2 * i + 0], &point[2 * i + 0]);
+        ge_p3_to_cached(&cached[2 * i + 1], &point[2 * i + 1]);
+
+        memcpy(zi, z + 16 * i, 16);
+        memcpy(scalar[2 * i + 0], zi, 32);
+        edwards25519_muladd(zs, zi, sig[i] + 32, zs);
+        memset(scalar[2 * i + 1], 0, 32);
+        edwards25519_muladd(scalar[2 * i + 1], zi, h + 32 * i,
+                            scalar[2 * i + 1]);
+    }
+
+    ge_multi_scalarmult_vartime(&P, point, cached,
+                                (const uint8_t (*)[32])scalar, 2 * count,
+                                count < 32 ? 4 : 5);
+
+    ge_scalarmult_base(&B, zs);
+    ge_p3_to_cached(&c, &B);
+    ge_add(&t, &P, &c);
+    ge_p1p1_to_p2(&s, &t);
+
+    for (k = 0; k < 3; ++k)
+    {
+        ge_p2_dbl(&t, &s);
+        ge_p1p1_to_p2(&s, &t);
+    }
+
+    return ge_p2_is_0(&s);
+}
+/*===----------------------------------------------------------------------===*/
+
+void edwards25519_base_u(uint8_t *u, const uint8_t *scalar, size_t count)
+{
+    fe num[EDWARDS25519_BATCH], den[EDWARDS25519_BATCH];
+    fe acc[EDWARDS25519_BATCH], one, zero, prod, inv, t;
+    ge_p3 A;
+
+    fe_1(one);
+    fe_0(zero);
+
+    while (count)
+    {
+        size_t n = smin(count, EDWARDS25519_BATCH), i;
+
+        for (i = 0; i < n; ++i)
+        {
+            unsigned int identity;
+
+            ge_scalarmult_base(&A, scalar + 32 * i);
+
+            /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y), except for the
+             * identity, which has Z = Y, where the ladder gives 0, so the
+             * denominator is then replaced by 1 and the numerator by 0,
+             * which also keeps it from zeroing the product below. */
+            fe_add(num[i], A.Z, A.Y);
+            fe_sub(den[i], A.Z, A.Y);
+
+            identity = fe_iszero(den[i]);
+            fe_cmov(den[i], one, identity);
+            fe_cmov(num[i], zero, identity);
+
+            if (i)
+            {
+                memcpy(acc[i], prod, sizeof(fe));
+                fe_mul(prod, prod, den[i]);
+            }
+            else
+                memcpy(prod, den[0], sizeof(fe));
+        }
+
+        /* Montgomery's trick: the product of the denominators is inverted,
+         * and each inverse is then recovered with two multiplications, acc[i]
+         * being the product of the denominators before the i-th. */
+        fe_invert(inv, prod);
+
+        for (i = n - 1; i > 0; --i)
+        {
+            fe_mul(t, inv, acc[i]);
+            fe_mul(inv, inv, den[i]);
+            fe_mul(t, t, num[i]);
+            fe_tobytes(u + 32 * i, t);
+        }
+
+        fe_mul(t, inv, num[0]);
+        fe_tobytes(u, t);
+
+        u += 32 * n;
+        scalar += 32 * n;
+        count -= n;
+    }
+
+    memset(&A, 0, sizeof(A));
+    memset(num, 0, sizeof(num));
+    memset(den, 0, sizeof(den));
+    memset(acc, 0, sizeof(acc));
+    memset(prod, 0, sizeof(prod));
+    memset(inv, 0, sizeof(inv));
+    memset(t, 0, sizeof(t));
+}
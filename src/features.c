@@ -154,6 +154,33 @@ int sha256_limits(struct HASH_LIMITS *limits)
 }
 #endif
 
+#if WITH_SHA512
+#include "ordo/primitives/hash_functions/sha512.h"
+int sha512_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1024);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+
+int sha384_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1024);
+    limits->digest_len = bits(384);
+
+    return ORDO_SUCCESS;
+}
+
+int sha512_256_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1024);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
 #if WITH_SKEIN256
 #include "ordo/primitives/hash_functions/skein256.h"
 int skein256_limits(struct HASH_LIMITS *limits)
@@ -165,6 +192,123 @@ int skein256_limits(struct HASH_LIMITS *limits)
 }
 #endif
 
+#if WITH_SKEIN512
+#include "ordo/primitives/hash_functions/skein512.h"
+int skein512_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(512);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_BLAKE2B
+#include "ordo/primitives/hash_functions/blake2b.h"
+int blake2b_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1024);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_BLAKE2S
+#include "ordo/primitives/hash_functions/blake2s.h"
+int blake2s_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(512);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_BLAKE2BP
+#include "ordo/primitives/hash_functions/blake2b.h"
+int blake2bp_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1024);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_BLAKE2SP
+#include "ordo/primitives/hash_functions/blake2s.h"
+int blake2sp_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(512);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_BLAKE3
+#include "ordo/primitives/hash_functions/blake3.h"
+int blake3_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(512);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
+#if WITH_SHA3
+#include "ordo/primitives/hash_functions/sha3.h"
+int sha3_224_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1152);
+    limits->digest_len = bits(224);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_256_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1088);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_384_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(832);
+    limits->digest_len = bits(384);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_512_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(576);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+
+int shake128_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1344);
+    limits->digest_len = bits(256);
+
+    return ORDO_SUCCESS;
+}
+
+int shake256_limits(struct HASH_LIMITS *limits)
+{
+    limits->block_size = bits(1088);
+    limits->digest_len = bits(512);
+
+    return ORDO_SUCCESS;
+}
+#endif
+
 #if WITH_RC4
 #include "ordo/primitives/stream_ciphers/rc4.h"
 int rc4_limits(struct STREAM_LIMITS *limits)
@@ -216,6 +360,19 @@ int threefish256_limits(struct BLOCK_LIMITS *limits)
 }
 #endif
 
+#if WITH_THREEFISH512
+#include "ordo/primitives/block_ciphers/threefish512.h"
+int threefish512_limits(struct BLOCK_LIMITS *limits)
+{
+    limits->block_size = bits(512);
+    limits->key_min = bits(512);
+    limits->key_max = bits(512);
+    limits->key_mul = 1;
+
+    return ORDO_SUCCESS;
+}
+#endif
+
 /*===----------------------------------------------------------------------===*/
 
 #include "ordo/digest/digest.h"
@@ -292,6 +449,14 @@ size_t threefish256_bsize(void)
 }
 #endif
 
+#if WITH_THREEFISH512
+#include "ordo/primitives/block_ciphers/threefish512.h"
+size_t threefish512_bsize(void)
+{
+    return sizeof(struct THREEFISH512_STATE);
+}
+#endif
+
 #if WITH_RC4
 #include "ordo/primitives/stream_ciphers/rc4.h"
 size_t rc4_bsize(void)
@@ -324,12 +489,86 @@ size_t sha256_bsize(void)
 }
 #endif
 
+#if WITH_SHA512
+#include "ordo/primitives/hash_functions/sha512.h"
+size_t sha512_bsize(void)
+{
+    return sizeof(struct SHA512_STATE);
+}
+#endif
+
 #if WITH_SKEIN256
 #include "ordo/primitives/hash_functions/skein256.h"
 size_t skein256_bsize(void)
 {
     return sizeof(struct SKEIN256_STATE);
 }
+
+size_t skein256_tree_bsize(void)
+{
+    return sizeof(struct SKEIN256_TREE_STATE);
+}
+#endif
+
+#if WITH_SKEIN512
+#include "ordo/primitives/hash_functions/skein512.h"
+size_t skein512_bsize(void)
+{
+    return sizeof(struct SKEIN512_STATE);
+}
+#endif
+
+#if WITH_BLAKE2B
+#include "ordo/primitives/hash_functions/blake2b.h"
+size_t blake2b_bsize(void)
+{
+    return sizeof(struct BLAKE2B_STATE);
+}
+#endif
+
+#if WITH_BLAKE2S
+#include "ordo/primitives/hash_functions/blake2s.h"
+size_t blake2s_bsize(void)
+{
+    return sizeof(struct BLAKE2S_STATE);
+}
+#endif
+
+#if WITH_BLAKE2BP
+#include "ordo/primitives/hash_functions/blake2b.h"
+size_t blake2bp_bsize(void)
+{
+    return sizeof(struct BLAKE2BP_STATE);
+}
+#endif
+
+#if WITH_BLAKE2SP
+#include "ordo/primitives/hash_functions/blake2s.h"
+size_t blake2sp_bsize(void)
+{
+    return sizeof(struct BLAKE2SP_STATE);
+}
+#endif
+
+#if WITH_BLAKE3
+#include "ordo/primitives/hash_functions/blake3.h"
+size_t blake3_bsize(void)
+{
+    return sizeof(struct BLAKE3_STATE);
+}
+
+size_t blake3_xof_bsize(void)
+{
+    return sizeof(struct BLAKE3_XOF_STATE);
+}
+#endif
+
+#if WITH_SHA3
+#include "ordo/primitives/hash_functions/sha3.h"
+size_t sha3_bsize(void)
+{
+    return sizeof(struct SHA3_STATE);
+}
 #endif
 
 #include "ordo/primitives/block_ciphers.h"
@@ -367,3 +606,31 @@ size_t hmac_bsize(void)
 {
     return sizeof(struct HMAC_CTX);
 }
+
+#include "ordo/kdf/pbkdf2.h"
+size_t pbkdf2_bsize(void)
+{
+    return sizeof(struct PBKDF2_CTX);
+}
+
+#include "ordo/kdf/hkdf.h"
+size_t hkdf_bsize(void)
+{
+    return sizeof(struct HKDF_CTX);
+}
+
+#if WITH_AES
+#include "ordo/misc/ctr_drbg.h"
+size_t ctr_drbg_bsize(void)
+{
+    return sizeof(struct CTR_DRBG_CTX);
+}
+#endif
+
+#if WITH_THREEFISH256
+#include "ordo/misc/threefry.h"
+size_t threefry_bsize(void)
+{
+    return sizeof(struct THREEFRY_CTX);
+}
+#endif
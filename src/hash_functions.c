@@ -17,9 +17,27 @@
 #if WITH_SHA256
 #include "ordo/primitives/hash_functions/sha256.h"
 #endif
+#if WITH_SHA512
+#include "ordo/primitives/hash_functions/sha512.h"
+#endif
 #if WITH_SKEIN256
 #include "ordo/primitives/hash_functions/skein256.h"
 #endif
+#if WITH_SKEIN512
+#include "ordo/primitives/hash_functions/skein512.h"
+#endif
+#if WITH_BLAKE2B || WITH_BLAKE2BP
+#include "ordo/primitives/hash_functions/blake2b.h"
+#endif
+#if WITH_BLAKE2S || WITH_BLAKE2SP
+#include "ordo/primitives/hash_functions/blake2s.h"
+#endif
+#if WITH_BLAKE3
+#include "ordo/primitives/hash_functions/blake3.h"
+#endif
+#if WITH_SHA3
+#include "ordo/primitives/hash_functions/sha3.h"
+#endif
 
 int hash_init(struct HASH_STATE *state,
               prim_t primitive, const void *params)
@@ -38,10 +56,56 @@ int hash_init(struct HASH_STATE *state,
         case HASH_SHA256:
             return sha256_init(&state->jmp.sha256, params);
         #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+            return sha512_init(&state->jmp.sha512, params);
+        case HASH_SHA384:
+            return sha384_init(&state->jmp.sha512, params);
+        case HASH_SHA512_256:
+            return sha512_256_init(&state->jmp.sha512, params);
+        #endif
         #if WITH_SKEIN256
         case HASH_SKEIN256:
             return skein256_init(&state->jmp.skein256, params);
         #endif
+        #if WITH_SKEIN512
+        case HASH_SKEIN512:
+            return skein512_init(&state->jmp.skein512, params);
+        #endif
+        #if WITH_BLAKE2B
+        case HASH_BLAKE2B:
+            return blake2b_init(&state->jmp.blake2b, params);
+        #endif
+        #if WITH_BLAKE2S
+        case HASH_BLAKE2S:
+            return blake2s_init(&state->jmp.blake2s, params);
+        #endif
+        #if WITH_BLAKE2BP
+        case HASH_BLAKE2BP:
+            return blake2bp_init(&state->jmp.blake2bp, params);
+        #endif
+        #if WITH_BLAKE2SP
+        case HASH_BLAKE2SP:
+            return blake2sp_init(&state->jmp.blake2sp, params);
+        #endif
+        #if WITH_BLAKE3
+        case HASH_BLAKE3:
+            return blake3_init(&state->jmp.blake3, params);
+        #endif
+        #if WITH_SHA3
+        case HASH_SHA3_224:
+            return sha3_224_init(&state->jmp.sha3, params);
+        case HASH_SHA3_256:
+            return sha3_256_init(&state->jmp.sha3, params);
+        case HASH_SHA3_384:
+            return sha3_384_init(&state->jmp.sha3, params);
+        case HASH_SHA3_512:
+            return sha3_512_init(&state->jmp.sha3, params);
+        case HASH_SHAKE128:
+            return shake128_init(&state->jmp.sha3, params);
+        case HASH_SHAKE256:
+            return shake256_init(&state->jmp.sha3, params);
+        #endif
     }
 
     return ORDO_ARG;
@@ -67,11 +131,58 @@ void hash_update(struct HASH_STATE *state,
             sha256_update(&state->jmp.sha256, buffer, len);
             break;
         #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+        case HASH_SHA384:
+        case HASH_SHA512_256:
+            sha512_update(&state->jmp.sha512, buffer, len);
+            break;
+        #endif
         #if WITH_SKEIN256
         case HASH_SKEIN256:
             skein256_update(&state->jmp.skein256, buffer, len);
             break;
         #endif
+        #if WITH_SKEIN512
+        case HASH_SKEIN512:
+            skein512_update(&state->jmp.skein512, buffer, len);
+            break;
+        #endif
+        #if WITH_BLAKE2B
+        case HASH_BLAKE2B:
+            blake2b_update(&state->jmp.blake2b, buffer, len);
+            break;
+        #endif
+        #if WITH_BLAKE2S
+        case HASH_BLAKE2S:
+            blake2s_update(&state->jmp.blake2s, buffer, len);
+            break;
+        #endif
+        #if WITH_BLAKE2BP
+        case HASH_BLAKE2BP:
+            blake2bp_update(&state->jmp.blake2bp, buffer, len);
+            break;
+        #endif
+        #if WITH_BLAKE2SP
+        case HASH_BLAKE2SP:
+            blake2sp_update(&state->jmp.blake2sp, buffer, len);
+            break;
+        #endif
+        #if WITH_BLAKE3
+        case HASH_BLAKE3:
+            blake3_update(&state->jmp.blake3, buffer, len);
+            break;
+        #endif
+        #if WITH_SHA3
+        case HASH_SHA3_224:
+        case HASH_SHA3_256:
+        case HASH_SHA3_384:
+        case HASH_SHA3_512:
+        case HASH_SHAKE128:
+        case HASH_SHAKE256:
+            sha3_update(&state->jmp.sha3, buffer, len);
+            break;
+        #endif
     }
 }
 
@@ -95,11 +206,155 @@ void hash_final(struct HASH_STATE *state,
             sha256_final(&state->jmp.sha256, digest);
             break;
         #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+            sha512_final(&state->jmp.sha512, digest);
+            break;
+        case HASH_SHA384:
+            sha384_final(&state->jmp.sha512, digest);
+            break;
+        case HASH_SHA512_256:
+            sha512_256_final(&state->jmp.sha512, digest);
+            break;
+        #endif
         #if WITH_SKEIN256
         case HASH_SKEIN256:
             skein256_final(&state->jmp.skein256, digest);
             break;
         #endif
+        #if WITH_SKEIN512
+        case HASH_SKEIN512:
+            skein512_final(&state->jmp.skein512, digest);
+            break;
+        #endif
+        #if WITH_BLAKE2B
+        case HASH_BLAKE2B:
+            blake2b_final(&state->jmp.blake2b, digest);
+            break;
+        #endif
+        #if WITH_BLAKE2S
+        case HASH_BLAKE2S:
+            blake2s_final(&state->jmp.blake2s, digest);
+            break;
+        #endif
+        #if WITH_BLAKE2BP
+        case HASH_BLAKE2BP:
+            blake2bp_final(&state->jmp.blake2bp, digest);
+            break;
+        #endif
+        #if WITH_BLAKE2SP
+        case HASH_BLAKE2SP:
+            blake2sp_final(&state->jmp.blake2sp, digest);
+            break;
+        #endif
+        #if WITH_BLAKE3
+        case HASH_BLAKE3:
+            blake3_final(&state->jmp.blake3, digest);
+            break;
+        #endif
+        #if WITH_SHA3
+        case HASH_SHA3_224:
+        case HASH_SHA3_256:
+        case HASH_SHA3_384:
+        case HASH_SHA3_512:
+        case HASH_SHAKE128:
+        case HASH_SHAKE256:
+            sha3_final(&state->jmp.sha3, digest);
+            break;
+        #endif
+    }
+}
+
+int hash_squeeze(struct HASH_STATE *state,
+                 void *out, size_t len)
+{
+    switch (state->primitive)
+    {
+        #if WITH_SHA3
+        case HASH_SHAKE128:
+        case HASH_SHAKE256:
+            sha3_squeeze(&state->jmp.sha3, out, len);
+            return ORDO_SUCCESS;
+        #endif
+    }
+
+    return ORDO_ARG;
+}
+
+void hash_copy(struct HASH_STATE *dst,
+               const struct HASH_STATE *src)
+{
+    /* Only copy the state actually in use, the union is as large as the
+     * largest state, which can be much larger than most of the others. */
+    switch (dst->primitive = src->primitive)
+    {
+        #if WITH_MD5
+        case HASH_MD5:
+            dst->jmp.md5 = src->jmp.md5;
+            break;
+        #endif
+        #if WITH_SHA1
+        case HASH_SHA1:
+            dst->jmp.sha1 = src->jmp.sha1;
+            break;
+        #endif
+        #if WITH_SHA256
+        case HASH_SHA256:
+            dst->jmp.sha256 = src->jmp.sha256;
+            break;
+        #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+        case HASH_SHA384:
+        case HASH_SHA512_256:
+            dst->jmp.sha512 = src->jmp.sha512;
+            break;
+        #endif
+        #if WITH_SKEIN256
+        case HASH_SKEIN256:
+            dst->jmp.skein256 = src->jmp.skein256;
+            break;
+        #endif
+        #if WITH_SKEIN512
+        case HASH_SKEIN512:
+            dst->jmp.skein512 = src->jmp.skein512;
+            break;
+        #endif
+        #if WITH_BLAKE2B
+        case HASH_BLAKE2B:
+            dst->jmp.blake2b = src->jmp.blake2b;
+            break;
+        #endif
+        #if WITH_BLAKE2S
+        case HASH_BLAKE2S:
+            dst->jmp.blake2s = src->jmp.blake2s;
+            break;
+        #endif
+        #if WITH_BLAKE2BP
+        case HASH_BLAKE2BP:
+            dst->jmp.blake2bp = src->jmp.blake2bp;
+            break;
+        #endif
+        #if WITH_BLAKE2SP
+        case HASH_BLAKE2SP:
+            dst->jmp.blake2sp = src->jmp.blake2sp;
+            break;
+        #endif
+        #if WITH_BLAKE3
+        case HASH_BLAKE3:
+            dst->jmp.blake3 = src->jmp.blake3;
+            break;
+        #endif
+        #if WITH_SHA3
+        case HASH_SHA3_224:
+        case HASH_SHA3_256:
+        case HASH_SHA3_384:
+        case HASH_SHA3_512:
+        case HASH_SHAKE128:
+        case HASH_SHAKE256:
+            dst->jmp.sha3 = src->jmp.sha3;
+            break;
+        #endif
     }
 }
 
@@ -119,10 +374,56 @@ int hash_limits(prim_t primitive, struct HASH_LIMITS *limits)
         case HASH_SHA256:
             return sha256_limits(limits);
         #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+            return sha512_limits(limits);
+        case HASH_SHA384:
+            return sha384_limits(limits);
+        case HASH_SHA512_256:
+            return sha512_256_limits(limits);
+        #endif
         #if WITH_SKEIN256
         case HASH_SKEIN256:
             return skein256_limits(limits);
         #endif
+        #if WITH_SKEIN512
+        case HASH_SKEIN512:
+            return skein512_limits(limits);
+        #endif
+        #if WITH_BLAKE2B
+        case HASH_BLAKE2B:
+            return blake2b_limits(limits);
+        #endif
+        #if WITH_BLAKE2S
+        case HASH_BLAKE2S:
+            return blake2s_limits(limits);
+        #endif
+        #if WITH_BLAKE2BP
+        case HASH_BLAKE2BP:
+            return blake2bp_limits(limits);
+        #endif
+        #if WITH_BLAKE2SP
+        case HASH_BLAKE2SP:
+            return blake2sp_limits(limits);
+        #endif
+        #if WITH_BLAKE3
+        case HASH_BLAKE3:
+            return blake3_limits(limits);
+        #endif
+        #if WITH_SHA3
+        case HASH_SHA3_224:
+            return sha3_224_limits(limits);
+        case HASH_SHA3_256:
+            return sha3_256_limits(limits);
+        case HASH_SHA3_384:
+            return sha3_384_limits(limits);
+        case HASH_SHA3_512:
+            return sha3_512_limits(limits);
+        case HASH_SHAKE128:
+            return shake128_limits(limits);
+        case HASH_SHAKE256:
+            return shake256_limits(limits);
+        #endif
     }
 
     return ORDO_ARG;
@@ -7,8 +7,33 @@
 #include "ordo/kdf/hkdf.h"
 #include "ordo/auth/hmac.h"
 
+/* The context holds the HMAC context keyed with the PRK, so the PRK itself
+ * is not kept, and each expansion starts from a copy of it. */
+#ifdef OPAQUE
+struct HKDF_CTX
+{
+    struct HMAC_CTX prk;
+    size_t digest_len;
+};
+#endif
+
+/* See hmac.c. */
+ORDO_HIDDEN void hmac_copy(struct HMAC_CTX *dst,
+                           const struct HMAC_CTX *src);
+
 /*===----------------------------------------------------------------------===*/
 
+/* The output is limited to 255 blocks, as the block counter is one byte. */
+static int hkdf_check(const struct HKDF_CTX *ctx, size_t out_len)
+{
+    if (!out_len) return ORDO_ARG;
+
+    /* Maximum output length exceeded! */
+    if ((out_len - 1) / ctx->digest_len >= 255) return ORDO_ARG;
+
+    return ORDO_SUCCESS;
+}
+
 int kdf_hkdf(prim_t hash, const void *params,
              const void *key, size_t key_len,
              const void *salt, size_t salt_len,
@@ -17,60 +42,111 @@ int kdf_hkdf(prim_t hash, const void *params,
 {
     int err;
 
-    unsigned char buf[HASH_DIGEST_LEN] = {0};
+    struct HKDF_CTX ctx;
+
+    if (!out_len) return ORDO_ARG;
+
+    if ((err = hkdf_extract(&ctx, hash, params, key, key_len,
+                            salt, salt_len)))
+        return err;
+
+    return hkdf_expand(&ctx, info, info_len, out, out_len);
+}
+
+int hkdf_extract(struct HKDF_CTX *ctx,
+                 prim_t hash, const void *params,
+                 const void *key, size_t key_len,
+                 const void *salt, size_t salt_len)
+{
+    int err;
+
+    unsigned char zero[HASH_DIGEST_LEN] = {0};
     unsigned char prk[HASH_DIGEST_LEN];
-    struct HMAC_CTX ctx, cst;
-    uint8_t counter = 1;
-    size_t digest_len;
 
-    if (!key_len || !out_len) return ORDO_ARG;
+    if (!key_len) return ORDO_ARG;
 
     if (prim_type(hash) != PRIM_TYPE_HASH)
         return ORDO_ARG;
 
-    digest_len = digest_length(hash);
+    ctx->digest_len = digest_length(hash);
 
     if (!salt_len && !salt)
     {
         /* No salt provided - default to digest_len zero bytes. */
-        if ((err = hmac_init(&ctx, buf, digest_len, hash, params)))
+        if ((err = hmac_init(&ctx->prk, zero, ctx->digest_len, hash, params)))
             return err;
     }
     else
     {
         /* Salt provided (even if zero length) - just hash it. */
-        if ((err = hmac_init(&ctx, salt, salt_len, hash, params)))
+        if ((err = hmac_init(&ctx->prk, salt, salt_len, hash, params)))
             return err;
     }
 
-    hmac_update(&ctx, key, key_len);
-    if ((err = hmac_final(&ctx, prk)))
+    hmac_update(&ctx->prk, key, key_len);
+    if ((err = hmac_final(&ctx->prk, prk)))
         return err;
 
-    if ((err = hmac_init(&cst, prk, digest_len, hash, params)))
-        return err;
+    err = hmac_init(&ctx->prk, prk, ctx->digest_len, hash, params);
+
+    memset(prk, 0, sizeof(prk));
+
+    return err;
+}
+
+int hkdf_expand(const struct HKDF_CTX *ctx,
+                const void *info, size_t info_len,
+                void *out, size_t out_len)
+{
+    int err;
+
+    unsigned char buf[HASH_DIGEST_LEN];
+    struct HMAC_CTX hmac;
+    uint8_t counter = 1;
+
+    if ((err = hkdf_check(ctx, out_len))) return err;
+
+    hmac_copy(&hmac, &ctx->prk);
 
     while (out_len)
     {
-        /* Maximum output length reached! */
-        if (counter == 0) return ORDO_ARG;
+        size_t len = smin(out_len, ctx->digest_len);
 
-        ctx = cst;
+        hmac_reset(&hmac);
 
         /* First buffer ("T(0)") is the empty string (zero length) */
-        hmac_update(&ctx, buf, (counter == 1) ? 0 : digest_len);
-        hmac_update(&ctx, info, info_len);
-        hmac_update(&ctx, &counter, 1);
+        hmac_update(&hmac, buf, (counter == 1) ? 0 : ctx->digest_len);
+        hmac_update(&hmac, info, info_len);
+        hmac_update(&hmac, &counter, 1);
 
-        if ((err = hmac_final(&ctx, buf)))
+        if ((err = hmac_final(&hmac, buf)))
             return err;
 
-        memcpy(out, buf, out_len >= digest_len ? digest_len : out_len);
-        out_len -= out_len >= digest_len ? digest_len : out_len;
-        out = offset(out, digest_len);
+        memcpy(out, buf, len);
+        out = offset(out, len);
+        out_len -= len;
 
         ++counter;
     }
 
     return ORDO_SUCCESS;
 }
+
+int hkdf_expand_many(const struct HKDF_CTX *ctx,
+                     const struct HKDF_LABEL *labels, size_t count)
+{
+    int err;
+
+    size_t t;
+
+    for (t = 0; t < count; ++t)
+        if ((err = hkdf_check(ctx, labels[t].out_len)))
+            return err;
+
+    for (t = 0; t < count; ++t)
+        if ((err = hkdf_expand(ctx, labels[t].info, labels[t].info_len,
+                               labels[t].out, labels[t].out_len)))
+            return err;
+
+    return ORDO_SUCCESS;
+}
@@ -8,21 +8,33 @@
 
 /*===----------------------------------------------------------------------===*/
 
+/* The inner and outer hash states are kept as they are right after hashing
+ * the masked key, so that each message only costs the hashing of the message
+ * itself and of the inner digest, the masked key blocks are never rehashed.
+ * The key itself is not kept around, only these states are. */
 #ifdef OPAQUE
 struct HMAC_CTX
 {
     struct DIGEST_CTX ctx;
+    struct DIGEST_CTX inner;
+    struct DIGEST_CTX outer;
     struct HASH_LIMITS limits;
-    unsigned char key[HASH_BLOCK_LEN];
 };
 #endif
 
+/* Copies an HMAC context, hash state by hash state, so that only the states
+ * in use are copied and not the whole of each union. This is used by the
+ * HKDF module, which starts every expansion from a copy of its context. */
+ORDO_HIDDEN void hmac_copy(struct HMAC_CTX *dst,
+                           const struct HMAC_CTX *src);
+
 /*===----------------------------------------------------------------------===*/
 
 int hmac_init(struct HMAC_CTX *ctx,
               const void *key, size_t key_len,
               prim_t hash, const void *params)
 {
+    unsigned char pad[HASH_BLOCK_LEN];
     int err = ORDO_SUCCESS;
     size_t t;
 
@@ -33,7 +45,7 @@ int hmac_init(struct HMAC_CTX *ctx,
         return err;
 
     /* The key may be smaller than the hash's block size, pad with zeroes. */
-    memset(ctx->key, 0x00, ctx->limits.block_size);
+    memset(pad, 0x00, ctx->limits.block_size);
 
     /* If the key is larger than the hash function's block size, it needs to
      * be reduced. This is done by hashing it once, as per RFC 2104. */
@@ -42,17 +54,28 @@ int hmac_init(struct HMAC_CTX *ctx,
         if ((err = digest_init(&ctx->ctx, hash, 0)))
             return err;
         digest_update(&ctx->ctx, key, key_len);
-        digest_final(&ctx->ctx, ctx->key);
+        digest_final(&ctx->ctx, pad);
     }
-    else memcpy(ctx->key, key, key_len);
+    else memcpy(pad, key, key_len);
 
     for (t = 0; t < ctx->limits.block_size; ++t)
-        ctx->key[t] ^= 0x36;
+        pad[t] ^= 0x36;
 
-    if ((err = digest_init(&ctx->ctx, hash, params)))
+    if ((err = digest_init(&ctx->inner, hash, params)))
         return err;
 
-    digest_update(&ctx->ctx, ctx->key, ctx->limits.block_size);
+    digest_update(&ctx->inner, pad, ctx->limits.block_size);
+
+    /* This will implicitly go from inner mask to outer mask. */
+    for (t = 0; t < ctx->limits.block_size; ++t)
+        pad[t] ^= 0x5c ^ 0x36;
+
+    if ((err = digest_init(&ctx->outer, hash, 0)))
+        return err;
+
+    digest_update(&ctx->outer, pad, ctx->limits.block_size);
+
+    hmac_reset(ctx);
 
     return err;
 }
@@ -65,21 +88,26 @@ void hmac_update(struct HMAC_CTX *ctx,
 
 int hmac_final(struct HMAC_CTX *ctx, void *digest)
 {
-    size_t t;
-    int err;
-
     digest_final(&ctx->ctx, digest);
 
-    /* This will implicitly go from inner mask to outer mask. */
-    for (t = 0; t < ctx->limits.block_size; ++t)
-        ctx->key[t] ^= 0x5c ^ 0x36;
-
-    if ((err = digest_init(&ctx->ctx, ctx->ctx.primitive, 0)))
-        return err;
-
-    digest_update(&ctx->ctx, ctx->key, ctx->limits.block_size);
+    digest_copy(&ctx->ctx, &ctx->outer);
     digest_update(&ctx->ctx, digest, ctx->limits.digest_len);
     digest_final(&ctx->ctx, digest);
 
     return ORDO_SUCCESS;
 }
+
+void hmac_reset(struct HMAC_CTX *ctx)
+{
+    digest_copy(&ctx->ctx, &ctx->inner);
+}
+
+void hmac_copy(struct HMAC_CTX *dst,
+               const struct HMAC_CTX *src)
+{
+    digest_copy(&dst->ctx, &src->ctx);
+    digest_copy(&dst->inner, &src->inner);
+    digest_copy(&dst->outer, &src->outer);
+
+    dst->limits = src->limits;
+}
@@ -24,10 +24,26 @@ int prim_avail(prim_t prim)
         case BLOCK_AES:                    return WITH_AES;
         case BLOCK_NULLCIPHER:             return WITH_NULLCIPHER;
         case BLOCK_THREEFISH256:           return WITH_THREEFISH256;
+        case BLOCK_THREEFISH512:           return WITH_THREEFISH512;
         case HASH_MD5:                     return WITH_MD5;
         case HASH_SHA1:                    return WITH_SHA1;
         case HASH_SHA256:                  return WITH_SHA256;
+        case HASH_SHA512:                  return WITH_SHA512;
+        case HASH_SHA384:                  return WITH_SHA512;
+        case HASH_SHA512_256:              return WITH_SHA512;
         case HASH_SKEIN256:                return WITH_SKEIN256;
+        case HASH_SKEIN512:                return WITH_SKEIN512;
+        case HASH_BLAKE2B:                 return WITH_BLAKE2B;
+        case HASH_BLAKE2S:                 return WITH_BLAKE2S;
+        case HASH_BLAKE2BP:                return WITH_BLAKE2BP;
+        case HASH_BLAKE2SP:                return WITH_BLAKE2SP;
+        case HASH_BLAKE3:                  return WITH_BLAKE3;
+        case HASH_SHA3_224:                return WITH_SHA3;
+        case HASH_SHA3_256:                return WITH_SHA3;
+        case HASH_SHA3_384:                return WITH_SHA3;
+        case HASH_SHA3_512:                return WITH_SHA3;
+        case HASH_SHAKE128:                return WITH_SHA3;
+        case HASH_SHAKE256:                return WITH_SHA3;
         case STREAM_RC4:                   return WITH_RC4;
         case BLOCK_MODE_ECB:               return WITH_ECB;
         case BLOCK_MODE_CBC:               return WITH_CBC;
@@ -49,10 +65,26 @@ const char *prim_name(prim_t prim)
         case BLOCK_AES:                    return "AES";
         case BLOCK_NULLCIPHER:             return "NullCipher";
         case BLOCK_THREEFISH256:           return "Threefish-256";
+        case BLOCK_THREEFISH512:           return "Threefish-512";
         case HASH_MD5:                     return "MD5";
         case HASH_SHA1:                    return "SHA-1";
         case HASH_SHA256:                  return "SHA-256";
+        case HASH_SHA512:                  return "SHA-512";
+        case HASH_SHA384:                  return "SHA-384";
+        case HASH_SHA512_256:              return "SHA-512/256";
         case HASH_SKEIN256:                return "Skein-256";
+        case HASH_SKEIN512:                return "Skein-512";
+        case HASH_BLAKE2B:                 return "BLAKE2b";
+        case HASH_BLAKE2S:                 return "BLAKE2s";
+        case HASH_BLAKE2BP:                return "BLAKE2bp";
+        case HASH_BLAKE2SP:                return "BLAKE2sp";
+        case HASH_BLAKE3:                  return "BLAKE3";
+        case HASH_SHA3_224:                return "SHA3-224";
+        case HASH_SHA3_256:                return "SHA3-256";
+        case HASH_SHA3_384:                return "SHA3-384";
+        case HASH_SHA3_512:                return "SHA3-512";
+        case HASH_SHAKE128:                return "SHAKE128";
+        case HASH_SHAKE256:                return "SHAKE256";
         case STREAM_RC4:                   return "RC4";
         case BLOCK_MODE_ECB:               return "ECB";
         case BLOCK_MODE_CBC:               return "CBC";
@@ -95,6 +127,9 @@ prim_t prim_from_name(const char *name)
         #if WITH_THREEFISH256
         case 0x652cf289: return BLOCK_THREEFISH256;
         #endif
+        #if WITH_THREEFISH512
+        case 0xc73b2ddc: return BLOCK_THREEFISH512;
+        #endif
         #if WITH_MD5
         case 0x7360d733: return HASH_MD5;
         #endif
@@ -104,9 +139,40 @@ prim_t prim_from_name(const char *name)
         #if WITH_SHA256
         case 0xc64cb93d: return HASH_SHA256;
         #endif
+        #if WITH_SHA512
+        case 0x87550878: return HASH_SHA512;
+        case 0xa4d7ea95: return HASH_SHA384;
+        case 0xb39d7192: return HASH_SHA512_256;
+        #endif
         #if WITH_SKEIN256
         case 0x24488a55: return HASH_SKEIN256;
         #endif
+        #if WITH_SKEIN512
+        case 0xe50127b0: return HASH_SKEIN512;
+        #endif
+        #if WITH_BLAKE2B
+        case 0x2ab159f2: return HASH_BLAKE2B;
+        #endif
+        #if WITH_BLAKE2S
+        case 0x3bb174b5: return HASH_BLAKE2S;
+        #endif
+        #if WITH_BLAKE2BP
+        case 0xb72fe7a6: return HASH_BLAKE2BP;
+        #endif
+        #if WITH_BLAKE2SP
+        case 0xbd5ad21f: return HASH_BLAKE2SP;
+        #endif
+        #if WITH_BLAKE3
+        case 0xdfbdbf77: return HASH_BLAKE3;
+        #endif
+        #if WITH_SHA3
+        case 0xd4f89393: return HASH_SHA3_224;
+        case 0xd4e74a72: return HASH_SHA3_256;
+        case 0x7a70709e: return HASH_SHA3_384;
+        case 0x58a7cc63: return HASH_SHA3_512;
+        case 0x66a52226: return HASH_SHAKE128;
+        case 0x2747f932: return HASH_SHAKE256;
+        #endif
         #if WITH_RC4
         case 0xd7de26c2: return STREAM_RC4;
         #endif
@@ -143,9 +209,40 @@ const prim_t *prims_by_type(enum PRIM_TYPE type)
         #if WITH_SHA256
         HASH_SHA256,
         #endif
+        #if WITH_SHA512
+        HASH_SHA512,
+        HASH_SHA384,
+        HASH_SHA512_256,
+        #endif
         #if WITH_SKEIN256
         HASH_SKEIN256,
         #endif
+        #if WITH_SKEIN512
+        HASH_SKEIN512,
+        #endif
+        #if WITH_BLAKE2B
+        HASH_BLAKE2B,
+        #endif
+        #if WITH_BLAKE2S
+        HASH_BLAKE2S,
+        #endif
+        #if WITH_BLAKE2BP
+        HASH_BLAKE2BP,
+        #endif
+        #if WITH_BLAKE2SP
+        HASH_BLAKE2SP,
+        #endif
+        #if WITH_BLAKE3
+        HASH_BLAKE3,
+        #endif
+        #if WITH_SHA3
+        HASH_SHA3_224,
+        HASH_SHA3_256,
+        HASH_SHA3_384,
+        HASH_SHA3_512,
+        HASH_SHAKE128,
+        HASH_SHAKE256,
+        #endif
         0
     };
 
@@ -165,6 +262,9 @@ const prim_t *prims_by_type(enum PRIM_TYPE type)
         #if WITH_THREEFISH256
         BLOCK_THREEFISH256,
         #endif
+        #if WITH_THREEFISH512
+        BLOCK_THREEFISH512,
+        #endif
         #if WITH_NULLCIPHER
         BLOCK_NULLCIPHER,
         #endif
@@ -212,10 +312,22 @@ prim_t prim_default(enum PRIM_TYPE type)
         case PRIM_TYPE_HASH:
             #if WITH_SHA256
             return HASH_SHA256;
+            #elif WITH_SHA512
+            return HASH_SHA512;
             #elif WITH_SHA1
             return HASH_SHA1;
             #elif WITH_SKEIN256
             return HASH_SKEIN256;
+            #elif WITH_SKEIN512
+            return HASH_SKEIN512;
+            #elif WITH_BLAKE2B
+            return HASH_BLAKE2B;
+            #elif WITH_BLAKE2S
+            return HASH_BLAKE2S;
+            #elif WITH_BLAKE3
+            return HASH_BLAKE3;
+            #elif WITH_SHA3
+            return HASH_SHA3_256;
             #elif WITH_MD5
             return HASH_MD5;
             #else
@@ -232,6 +344,8 @@ prim_t prim_default(enum PRIM_TYPE type)
             return BLOCK_AES;
             #elif WITH_THREEFISH256
             return BLOCK_THREEFISH256;
+            #elif WITH_THREEFISH512
+            return BLOCK_THREEFISH512;
             #elif WITH_NULLCIPHER
             return BLOCK_NULLCIPHER; /* ... */
             #else
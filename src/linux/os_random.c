@@ -1 +0,0 @@
-../shared/unix/os_random.c
\ No newline at end of file
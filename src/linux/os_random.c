@@ -0,0 +1,187 @@
+/*===-- os_random.c -------------------------------------*- linux -*- C -*-===*/
+
+/* Needed for syscall() and O_CLOEXEC in strict C89 mode. */
+#define _DEFAULT_SOURCE
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/misc/os_random.h"
+
+#include <sys/syscall.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/*===----------------------------------------------------------------------===*/
+
+/* Small requests, such as nonces and IVs, are served from a per-thread pool
+ * which is refilled POOL_SIZE bytes at a time, so that they do not each cost
+ * a system call. Bytes are wiped from the pool as soon as they are handed
+ * out, and larger requests bypass it. */
+#define POOL_SIZE (1024)
+
+struct POOL
+{
+    unsigned char buf[POOL_SIZE];
+    size_t pos;
+    unsigned long generation;
+};
+
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+static pthread_key_t pool_key;
+static int pool_ok;
+
+/* Kernels older than 3.17 have no getrandom(), so /dev/urandom is used in
+ * that case, opened once and kept open rather than on every call. */
+static pthread_once_t urandom_once = PTHREAD_ONCE_INIT;
+static int urandom_fd = -1;
+
+/* Bumped in the child process after a fork, which invalidates every pool,
+ * as otherwise the parent and child would hand out the same bytes. */
+static volatile unsigned long generation;
+
+static void on_fork(void)
+{
+    ++generation;
+}
+
+static void pool_free(void *ptr)
+{
+    memset(ptr, 0, sizeof(struct POOL));
+    free(ptr);
+}
+
+static void init(void)
+{
+    pool_ok = !pthread_key_create(&pool_key, pool_free)
+           && !pthread_atfork(0, 0, on_fork);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+static void open_urandom(void)
+{
+    urandom_fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+}
+
+static int read_urandom(void *out, size_t len)
+{
+    pthread_once(&urandom_once, open_urandom);
+    if (urandom_fd < 0) return ORDO_FAIL;
+
+    while (len)
+    {
+        ssize_t n = read(urandom_fd, out, len);
+
+        if (n <= 0)
+        {
+            if (n < 0 && errno == EINTR) continue;
+            return ORDO_FAIL;
+        }
+
+        out = offset(out, (size_t)n);
+        len -= (size_t)n;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+/* Fills the buffer from the kernel CSPRNG. The getrandom() call only blocks
+ * until the kernel's pool has been seeded once, early at boot, unlike reads
+ * from /dev/random on older kernels. */
+static int fill(void *out, size_t len)
+{
+    #if defined(SYS_getrandom)
+    while (len)
+    {
+        long n = syscall(SYS_getrandom, out, len, 0);
+
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            if (errno == ENOSYS) break;
+            return ORDO_FAIL;
+        }
+
+        out = offset(out, (size_t)n);
+        len -= (size_t)n;
+    }
+
+    if (!len) return ORDO_SUCCESS;
+    #endif
+
+    return read_urandom(out, len);
+}
+
+static struct POOL *get_pool(void)
+{
+    struct POOL *pool;
+
+    pthread_once(&once, init);
+    if (!pool_ok) return 0;
+
+    if (!(pool = pthread_getspecific(pool_key)))
+    {
+        if (!(pool = malloc(sizeof(struct POOL))))
+            return 0;
+
+        if (pthread_setspecific(pool_key, pool))
+        {
+            free(pool);
+            return 0;
+        }
+
+        pool->pos = POOL_SIZE;
+        pool->generation = generation;
+    }
+
+    if (pool->generation != generation)
+    {
+        memset(pool->buf, 0, sizeof(pool->buf));
+        pool->pos = POOL_SIZE;
+        pool->generation = generation;
+    }
+
+    return pool;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int os_random(void *out, size_t len)
+{
+    struct POOL *pool;
+
+    if (len >= POOL_SIZE / 4 || !(pool = get_pool()))
+        return fill(out, len);
+
+    while (len)
+    {
+        size_t n;
+
+        if (pool->pos == POOL_SIZE)
+        {
+            if (fill(pool->buf, POOL_SIZE)) return ORDO_FAIL;
+            pool->pos = 0;
+        }
+
+        n = smin(len, POOL_SIZE - pool->pos);
+
+        memcpy(out, pool->buf + pool->pos, n);
+        memset(pool->buf + pool->pos, 0, n);
+        out = offset(out, n);
+        pool->pos += n;
+        len -= n;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+/* Key material does not go through the pool, so that it never sits in
+ * memory before it is needed, but is read directly from the kernel. */
+int os_secure_random(void *out, size_t len)
+{
+    return fill(out, len);
+}
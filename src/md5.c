@@ -16,8 +16,8 @@ static const uint32_t md5_iv[4] =
     0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476
 };
 
-static void md5_compress(const uint32_t * RESTRICT block,
-                         uint32_t * RESTRICT digest) HOT_CODE;
+ORDO_HIDDEN void md5_compress(const void * RESTRICT block,
+                              uint32_t * RESTRICT digest) HOT_CODE;
 
 #ifdef OPAQUE
 struct MD5_STATE
@@ -56,21 +56,24 @@ void md5_update(struct MD5_STATE *state,
     /* Do we have enough to complete a message block? */
     if (state->block_len + len >= MD5_BLOCK)
     {
-        /* This is certain to be in [0 .. MD5_BLOCK - 1]. */
-        size_t pad = (size_t)(MD5_BLOCK - state->block_len);
+        /* Only stage the input if a partial block is already buffered. */
+        if (state->block_len)
+        {
+            /* This is certain to be in [1 .. MD5_BLOCK - 1]. */
+            size_t pad = (size_t)(MD5_BLOCK - state->block_len);
 
-        memcpy(offset(state->block, state->block_len), buffer, pad);
-        md5_compress(state->block, state->digest);
-        state->block_len = 0;
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            md5_compress(state->block, state->digest);
+            state->block_len = 0;
 
-        buffer = offset(buffer, pad);
-        len -= pad;
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
 
-        /* Process all blocks. */
+        /* Process all blocks directly from the user's buffer. */
         while (len >= MD5_BLOCK)
         {
-            memcpy(state->block, buffer, MD5_BLOCK);
-            md5_compress(state->block, state->digest);
+            md5_compress(buffer, state->digest);
 
             buffer = offset(buffer, MD5_BLOCK);
             len -= MD5_BLOCK;
@@ -113,7 +116,7 @@ void md5_final(struct MD5_STATE *state,
 
 /*===----------------------------------------------------------------------===*/
 
-void md5_compress(const uint32_t * RESTRICT block,
+void md5_compress(const void * RESTRICT block,
                   uint32_t * RESTRICT digest)
 {
     uint32_t a = digest[0];
@@ -123,7 +126,10 @@ void md5_compress(const uint32_t * RESTRICT block,
     uint32_t data[16];
     size_t t;
 
-    for (t = 0; t < 16; ++t) data[t] = tole32(block[t]);
+    /* The block may be unaligned, as it can come straight from the user. */
+    memcpy(data, block, sizeof(data));
+
+    for (t = 0; t < 16; ++t) data[t] = tole32(data[t]);
 
     a += data[ 0] + 0xD76AA478 + (d ^ (b & (c ^ d)));
     a = ((a <<  7) | (a >> 25)) + b;
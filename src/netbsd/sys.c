@@ -0,0 +1 @@
+../shared/unix/sys.c
\ No newline at end of file
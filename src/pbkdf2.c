@@ -9,17 +9,344 @@
 
 /*===----------------------------------------------------------------------===*/
 
-int kdf_pbkdf2(prim_t hash, const void *params,
-               const void *pwd, size_t pwd_len,
-               const void *salt, size_t salt_len,
-               uintmax_t iterations,
-               void *out, size_t out_len)
+/* See md5.c, sha1.c, sha256.c and sha512.c. */
+#if WITH_MD5
+ORDO_HIDDEN void md5_compress(const void * RESTRICT block,
+                              uint32_t * RESTRICT digest);
+#endif
+#if WITH_SHA1
+ORDO_HIDDEN void sha1_compress(const void * RESTRICT block,
+                               uint32_t * RESTRICT digest);
+#endif
+#if WITH_SHA256
+ORDO_HIDDEN void sha256_compress(const void * RESTRICT block,
+                                 uint32_t * RESTRICT digest);
+#endif
+#if WITH_SHA512
+ORDO_HIDDEN void sha512_compress(const void * RESTRICT block,
+                                 uint64_t * RESTRICT digest);
+#endif
+
+/* See sha1.c and sha256.c. */
+#if WITH_SHA1
+ORDO_HIDDEN void sha1_compress_x8(uint32_t * RESTRICT state,
+                                  const uint32_t * RESTRICT block);
+#endif
+#if WITH_SHA256
+ORDO_HIDDEN void sha256_compress_x8(uint32_t * RESTRICT state,
+                                    const uint32_t * RESTRICT block);
+#endif
+
+/* For the Merkle-Damgard hash functions, every iteration after the first one
+ * hashes exactly one digest, under HMAC contexts whose inner and outer states
+ * are the chaining values obtained right after the masked keys. The message
+ * block can then be laid out once, padding and length included, and only the
+ * digest part of it rewritten, so that each iteration is just two calls to the
+ * compression function. These run the given number of iterations on the last
+ * iteration result in "feedback", and the XOR of all results so far in "acc",
+ * both as bytes, and update them in place, so that they can be resumed. */
+
+#if WITH_MD5
+static void pbkdf2_md5(const uint32_t inner[4],
+                       const uint32_t outer[4],
+                       void *feedback, void *acc,
+                       uintmax_t iterations)
+{
+    uint32_t block[16] = {0}, sum[4], state[4];
+    size_t t;
+
+    memcpy(block, feedback, sizeof(sum));
+    memcpy(sum, acc, sizeof(sum));
+
+    block[ 4] = tole32(0x00000080);
+    block[14] = tole32((64 + 16) * 8);
+
+    while (iterations--)
+    {
+        memcpy(state, inner, sizeof(state));
+        md5_compress(block, state);
+
+        for (t = 0; t < 4; ++t) block[t] = tole32(state[t]);
+
+        memcpy(state, outer, sizeof(state));
+        md5_compress(block, state);
+
+        for (t = 0; t < 4; ++t) sum[t] ^= (block[t] = tole32(state[t]));
+    }
+
+    memcpy(feedback, block, sizeof(sum));
+    memcpy(acc, sum, sizeof(sum));
+}
+#endif
+
+#if WITH_SHA1
+static void pbkdf2_sha1(const uint32_t inner[5],
+                        const uint32_t outer[5],
+                        void *feedback, void *acc,
+                        uintmax_t iterations)
+{
+    uint32_t block[16] = {0}, sum[5], state[5];
+    size_t t;
+
+    memcpy(block, feedback, sizeof(sum));
+    memcpy(sum, acc, sizeof(sum));
+
+    block[ 5] = tobe32(0x80000000);
+    block[15] = tobe32((64 + 20) * 8);
+
+    while (iterations--)
+    {
+        memcpy(state, inner, sizeof(state));
+        sha1_compress(block, state);
+
+        for (t = 0; t < 5; ++t) block[t] = tobe32(state[t]);
+
+        memcpy(state, outer, sizeof(state));
+        sha1_compress(block, state);
+
+        for (t = 0; t < 5; ++t) sum[t] ^= (block[t] = tobe32(state[t]));
+    }
+
+    memcpy(feedback, block, sizeof(sum));
+    memcpy(acc, sum, sizeof(sum));
+}
+#endif
+
+#if WITH_SHA256
+static void pbkdf2_sha256(const uint32_t inner[8],
+                          const uint32_t outer[8],
+                          void *feedback, void *acc,
+                          uintmax_t iterations)
+{
+    uint32_t block[16] = {0}, sum[8], state[8];
+    size_t t;
+
+    memcpy(block, feedback, sizeof(sum));
+    memcpy(sum, acc, sizeof(sum));
+
+    block[ 8] = tobe32(0x80000000);
+    block[15] = tobe32((64 + 32) * 8);
+
+    while (iterations--)
+    {
+        memcpy(state, inner, sizeof(state));
+        sha256_compress(block, state);
+
+        for (t = 0; t < 8; ++t) block[t] = tobe32(state[t]);
+
+        memcpy(state, outer, sizeof(state));
+        sha256_compress(block, state);
+
+        for (t = 0; t < 8; ++t) sum[t] ^= (block[t] = tobe32(state[t]));
+    }
+
+    memcpy(feedback, block, sizeof(sum));
+    memcpy(acc, sum, sizeof(sum));
+}
+#endif
+
+#if WITH_SHA512
+/* This also serves SHA-384 and SHA-512/256, which are truncations of SHA-512
+ * with different initial values, so only the digest length differs. */
+static void pbkdf2_sha512(const uint64_t inner[8],
+                          const uint64_t outer[8],
+                          void *feedback, void *acc,
+                          uintmax_t iterations,
+                          size_t digest_len)
+{
+    uint64_t block[16] = {0}, sum[8], state[8];
+    size_t t, words = digest_len / 8;
+
+    memcpy(block, feedback, digest_len);
+    memcpy(sum, acc, digest_len);
+
+    block[words] = tobe64(UINT64_C(0x8000000000000000));
+    block[15] = tobe64((uint64_t)(128 + digest_len) * 8);
+
+    while (iterations--)
+    {
+        memcpy(state, inner, sizeof(state));
+        sha512_compress(block, state);
+
+        for (t = 0; t < words; ++t) block[t] = tobe64(state[t]);
+
+        memcpy(state, outer, sizeof(state));
+        sha512_compress(block, state);
+
+        for (t = 0; t < words; ++t) sum[t] ^= (block[t] = tobe64(state[t]));
+    }
+
+    memcpy(feedback, block, digest_len);
+    memcpy(acc, sum, digest_len);
+}
+#endif
+
+/* Runs the given number of iterations, with one of the functions above if
+ * there is one for this hash function, else with the HMAC context itself. */
+static int pbkdf2_iterate(struct HMAC_CTX *ctx, prim_t hash,
+                          void *feedback, void *acc,
+                          uintmax_t iterations, size_t digest_len)
 {
     int err;
 
+    switch (hash)
+    {
+        #if WITH_MD5
+        case HASH_MD5:
+            pbkdf2_md5(ctx->inner.jmp.md5.digest,
+                       ctx->outer.jmp.md5.digest,
+                       feedback, acc, iterations);
+            return ORDO_SUCCESS;
+        #endif
+        #if WITH_SHA1
+        case HASH_SHA1:
+            pbkdf2_sha1(ctx->inner.jmp.sha1.digest,
+                        ctx->outer.jmp.sha1.digest,
+                        feedback, acc, iterations);
+            return ORDO_SUCCESS;
+        #endif
+        #if WITH_SHA256
+        case HASH_SHA256:
+            pbkdf2_sha256(ctx->inner.jmp.sha256.digest,
+                          ctx->outer.jmp.sha256.digest,
+                          feedback, acc, iterations);
+            return ORDO_SUCCESS;
+        #endif
+        #if WITH_SHA512
+        case HASH_SHA512:
+        case HASH_SHA384:
+        case HASH_SHA512_256:
+            pbkdf2_sha512(ctx->inner.jmp.sha512.digest,
+                          ctx->outer.jmp.sha512.digest,
+                          feedback, acc, iterations, digest_len);
+            return ORDO_SUCCESS;
+        #endif
+    }
+
+    while (iterations--)
+    {
+        hmac_reset(ctx);
+
+        /* Next iteration: Ui+1 = PRF(Ui). */
+        hmac_update(ctx, feedback, digest_len);
+        if ((err = hmac_final(ctx, feedback))) return err;
+
+        /* U1 ^ U2 ^ ... ^ Ui accumulation. */
+        xor_buffer(acc, feedback, digest_len);
+    }
+
+    return ORDO_SUCCESS;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* Output blocks are independent of one another, so they are derived in
+ * batches of up to PBKDF2_BATCH blocks, which kdf_pbkdf2_parallel() spreads
+ * over several threads if there are at least PBKDF2_PARALLEL iterations,
+ * below which the threads are not worth starting. Each block goes to its own
+ * part of the output. */
+#define PBKDF2_BATCH    (16)
+#define PBKDF2_PARALLEL (1024)
+
+struct BLOCK_BATCH
+{
+    const struct HMAC_CTX *key;
+    prim_t hash;
+    const void *salt;
+    size_t salt_len;
+    uintmax_t iterations;
+    uint32_t counter;
+    void *out;
+    size_t out_len;
+    size_t digest_len;
+    int err[PBKDF2_BATCH];
+};
+
+/* Derives the output block of the given counter, writing its first "out_len"
+ * bytes out, the HMAC context is keyed with the password but left as is. */
+static int pbkdf2_block(const struct HMAC_CTX *key, prim_t hash,
+                        const void *salt, size_t salt_len,
+                        uintmax_t iterations, uint32_t counter,
+                        void *out, size_t out_len, size_t digest_len)
+{
     unsigned char buf[HASH_DIGEST_LEN], feedback[HASH_DIGEST_LEN];
-    struct HMAC_CTX ctx, cst;
+    uint32_t ctr_endian = tobe32(counter); /* Big endian counter */
+    struct HMAC_CTX ctx = *key;
+    int err;
+
+    hmac_reset(&ctx);
+
+    hmac_update(&ctx, salt, salt_len);
+    hmac_update(&ctx, &ctr_endian, sizeof(uint32_t));
+
+    /* We copy the first iteration result into the "feedback" buffer which
+     * is used to store the previous iteration result for the next one. */
+    if ((err = hmac_final(&ctx, feedback))) return err;
+    memcpy(buf, feedback, digest_len);
+
+    if ((err = pbkdf2_iterate(&ctx, hash, feedback, buf,
+                              iterations - 1, digest_len)))
+        return err;
+
+    /* Copy this block into the output buffer (handle truncation). Note
+     * this ensures that even if something goes wrong at any point, the
+     * user-provided buffer will only ever contain either indeterminate
+     * data or valid data, and no intermediate, sensitive information. */
+    memcpy(out, buf, out_len);
+
+    return ORDO_SUCCESS;
+}
+
+static void pbkdf2_job(void *ctx, size_t index)
+{
+    struct BLOCK_BATCH *batch = ctx;
+    size_t pos = index * batch->digest_len;
+
+    batch->err[index] = pbkdf2_block(batch->key, batch->hash,
+                                     batch->salt, batch->salt_len,
+                                     batch->iterations,
+                                     batch->counter + (uint32_t)index,
+                                     offset(batch->out, pos),
+                                     smin(batch->out_len - pos,
+                                          batch->digest_len),
+                                     batch->digest_len);
+}
+
+/* The incremental context keeps a copy of the keyed HMAC context which has
+ * absorbed the salt, from which every block's first iteration starts, so the
+ * salt need not be kept around. A block's first iteration is pending while
+ * "left" equals the iteration count. */
+#ifdef OPAQUE
+struct PBKDF2_CTX
+{
+    struct HMAC_CTX salted;
+    struct HMAC_CTX hmac;
+    unsigned char feedback[HASH_DIGEST_LEN];
+    unsigned char acc[HASH_DIGEST_LEN];
+    prim_t hash;
+    uintmax_t iterations;
+    uintmax_t left;
+    uint32_t counter;
+    void *out;
+    size_t out_len;
     size_t digest_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+static int pbkdf2_derive(prim_t hash, const void *params,
+                         const void *pwd, size_t pwd_len,
+                         const void *salt, size_t salt_len,
+                         uintmax_t iterations,
+                         void *out, size_t out_len,
+                         int parallel)
+{
+    int err;
+
+    struct BLOCK_BATCH batch;
+    struct HMAC_CTX ctx;
+    size_t digest_len, t;
 
     /* The output counter is a 32-bit counter which for some reason starts
      * at 1, putting an upper bound on the maximum output length allowed. */
@@ -32,51 +359,389 @@ int kdf_pbkdf2(prim_t hash, const void *params,
 
     digest_len = digest_length(hash);
 
+    /* Maximum output length exceeded! */
+    if ((out_len - 1) / digest_len >= UINT32_C(0xFFFFFFFF))
+        return ORDO_ARG;
+
     /* This HMAC initialization need be done only once, because for each
      * iteration the key is always the same (the password). Thanks to
      * the design of HMAC, most of the work can then be precomputed. */
-    if ((err = hmac_init(&cst, pwd, pwd_len, hash, params))) return err;
+    if ((err = hmac_init(&ctx, pwd, pwd_len, hash, params))) return err;
+
+    batch.key = &ctx;
+    batch.hash = hash;
+    batch.salt = salt;
+    batch.salt_len = salt_len;
+    batch.iterations = iterations;
+    batch.digest_len = digest_len;
 
     while (out_len)
     {
-        uint32_t ctr_endian = tobe32(counter); /* Big endian counter */
-        uintmax_t iters = iterations;
+        size_t count = smin((out_len - 1) / digest_len + 1, PBKDF2_BATCH);
+
+        batch.counter = counter;
+        batch.out = out;
+        batch.out_len = smin(out_len, count * digest_len);
+
+        if (parallel && count > 1 && iterations >= PBKDF2_PARALLEL)
+            sys_parallel(count, pbkdf2_job, &batch);
+        else
+            for (t = 0; t < count; ++t) pbkdf2_job(&batch, t);
+
+        for (t = 0; t < count; ++t)
+            if (batch.err[t]) return batch.err[t];
+
+        counter += (uint32_t)count;
+        out = offset(out, batch.out_len);
+        out_len -= batch.out_len;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+int kdf_pbkdf2(prim_t hash, const void *params,
+               const void *pwd, size_t pwd_len,
+               const void *salt, size_t salt_len,
+               uintmax_t iterations,
+               void *out, size_t out_len)
+{
+    return pbkdf2_derive(hash, params, pwd, pwd_len, salt, salt_len,
+                         iterations, out, out_len, 0);
+}
+
+int kdf_pbkdf2_parallel(prim_t hash, const void *params,
+                        const void *pwd, size_t pwd_len,
+                        const void *salt, size_t salt_len,
+                        uintmax_t iterations,
+                        void *out, size_t out_len)
+{
+    return pbkdf2_derive(hash, params, pwd, pwd_len, salt, salt_len,
+                         iterations, out, out_len, 1);
+}
+
+int pbkdf2_init(struct PBKDF2_CTX *ctx,
+                prim_t hash, const void *params,
+                const void *pwd, size_t pwd_len,
+                const void *salt, size_t salt_len,
+                uintmax_t iterations,
+                void *out, size_t out_len)
+{
+    int err;
+
+    if (!pwd_len || !iterations || !out_len) return ORDO_ARG;
+
+    if (prim_type(hash) != PRIM_TYPE_HASH)
+        return ORDO_ARG;
+
+    ctx->digest_len = digest_length(hash);
+
+    /* Maximum output length exceeded! */
+    if ((out_len - 1) / ctx->digest_len >= UINT32_C(0xFFFFFFFF))
+        return ORDO_ARG;
+
+    if ((err = hmac_init(&ctx->salted, pwd, pwd_len, hash, params)))
+        return err;
+
+    hmac_update(&ctx->salted, salt, salt_len);
+
+    ctx->hash = hash;
+    ctx->iterations = iterations;
+    ctx->left = iterations;
+    ctx->counter = 1;
+    ctx->out = out;
+    ctx->out_len = out_len;
+
+    return ORDO_SUCCESS;
+}
+
+int pbkdf2_step(struct PBKDF2_CTX *ctx, uintmax_t max_iters, int *done)
+{
+    int err;
+
+    while (ctx->out_len && max_iters)
+    {
+        uintmax_t n = 1;
 
-        ++counter;
-        ctx = cst;
+        if (ctx->left == ctx->iterations)
+        {
+            uint32_t ctr_endian = tobe32(ctx->counter);
 
-        hmac_update(&ctx, salt, salt_len);
-        hmac_update(&ctx, &ctr_endian, sizeof(uint32_t));
+            ctx->hmac = ctx->salted;
 
-        /* We copy the first iteration result into the "feedback" buffer which
-         * is used to store the previous iteration result for the next one. */
-        if ((err = hmac_final(&ctx, feedback))) return err;
-        memcpy(buf, feedback, digest_len);
+            hmac_update(&ctx->hmac, &ctr_endian, sizeof(uint32_t));
+            if ((err = hmac_final(&ctx->hmac, ctx->feedback))) return err;
+            memcpy(ctx->acc, ctx->feedback, ctx->digest_len);
+        }
+        else
+        {
+            n = (max_iters < ctx->left) ? max_iters : ctx->left;
 
-        while (--iters)
+            if ((err = pbkdf2_iterate(&ctx->hmac, ctx->hash,
+                                      ctx->feedback, ctx->acc,
+                                      n, ctx->digest_len)))
+                return err;
+        }
+
+        ctx->left -= n;
+        max_iters -= n;
+
+        if (!ctx->left)
         {
-            ctx = cst;
+            size_t len = smin(ctx->out_len, ctx->digest_len);
 
-            /* Next iteration: Ui+1 = PRF(Ui). */
-            hmac_update(&ctx, feedback, digest_len);
-            if ((err = hmac_final(&ctx, feedback))) return err;
+            memcpy(ctx->out, ctx->acc, len);
+            ctx->out = offset(ctx->out, len);
+            ctx->out_len -= len;
 
-            /* U1 ^ U2 ^ ... ^ Ui accumulation. */
-            xor_buffer(buf, feedback, digest_len);
+            ctx->left = ctx->iterations;
+            ++ctx->counter;
         }
+    }
+
+    *done = (ctx->out_len == 0);
+
+    return ORDO_SUCCESS;
+}
+
+int pbkdf2_final(struct PBKDF2_CTX *ctx)
+{
+    int done;
+
+    return pbkdf2_step(ctx, UINTMAX_MAX, &done);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* The batch API runs eight output blocks side by side, one in each lane of
+ * the x8 compression functions, exactly like pbkdf2_sha256() runs one, but
+ * with every buffer interleaved word by word as the x8 functions expect, and
+ * holding native words instead of big-endian bytes (for SHA-1 and SHA-256,
+ * the digest words are the message words of the next block as they are). A
+ * lane whose block is done is refilled with the next block of the same job,
+ * or with the first block of the next job, until there are none left. */
+
+#define PBKDF2_LANES (8)
+
+typedef void (*COMPRESS_X8)(uint32_t * RESTRICT state,
+                            const uint32_t * RESTRICT block);
+
+struct LANES
+{
+    uint32_t inner[8 * PBKDF2_LANES];
+    uint32_t outer[8 * PBKDF2_LANES];
+    uint32_t block[16 * PBKDF2_LANES];
+    uint32_t acc[8 * PBKDF2_LANES];
+    struct PBKDF2_JOB *job[PBKDF2_LANES]; /* Nil if the lane is idle. */
+    uint32_t counter[PBKDF2_LANES];
+    uintmax_t left[PBKDF2_LANES];
+    COMPRESS_X8 compress;
+    size_t words; /* In the state as well as in the digest. */
+};
+
+/* Writes out the block of a lane whose iterations are all done. */
+static void lane_store(struct LANES *lanes, size_t lane)
+{
+    struct PBKDF2_JOB *job = lanes->job[lane];
+    size_t digest_len = lanes->words * sizeof(uint32_t);
+    size_t pos = (lanes->counter[lane] - 1) * digest_len;
+    uint32_t buf[8];
+    size_t t;
+
+    for (t = 0; t < lanes->words; ++t)
+        buf[t] = tobe32(lanes->acc[PBKDF2_LANES * t + lane]);
+
+    memcpy(offset(job->out, pos), buf, smin(job->out_len - pos, digest_len));
+
+    lanes->job[lane] = 0;
+}
+
+/* Starts a lane on a block, doing its first iteration right away. */
+static int lane_load(struct LANES *lanes, size_t lane,
+                     prim_t hash, const void *params,
+                     struct PBKDF2_JOB *job, uint32_t counter)
+{
+    uint32_t u[8], ctr_endian = tobe32(counter);
+    const uint32_t *inner = 0, *outer = 0;
+    struct HMAC_CTX ctx;
+    size_t t;
+    int err;
 
-        /* Copy this block into the output buffer (handle truncation). Note
-         * this ensures that even if something goes wrong at any point, the
-         * user-provided buffer will only ever contain either indeterminate
-         * data or valid data, and no intermediate, sensitive information. */
-        memcpy(out, buf, out_len >= digest_len ? digest_len : out_len);
-        out_len -= out_len >= digest_len ? digest_len : out_len;
-        out = offset(out, digest_len);
-
-        /* Maximum output length reached! */
-        if ((counter == 0) && out_len)
-            return ORDO_ARG;
+    if ((err = hmac_init(&ctx, job->pwd, job->pwd_len, hash, params)))
+        return err;
+
+    hmac_update(&ctx, job->salt, job->salt_len);
+    hmac_update(&ctx, &ctr_endian, sizeof(uint32_t));
+
+    if ((err = hmac_final(&ctx, u))) return err;
+
+    switch (hash)
+    {
+        #if WITH_SHA1
+        case HASH_SHA1:
+            inner = ctx.inner.jmp.sha1.digest;
+            outer = ctx.outer.jmp.sha1.digest;
+            break;
+        #endif
+        #if WITH_SHA256
+        case HASH_SHA256:
+            inner = ctx.inner.jmp.sha256.digest;
+            outer = ctx.outer.jmp.sha256.digest;
+            break;
+        #endif
+    }
+
+    for (t = 0; t < lanes->words; ++t)
+    {
+        lanes->inner[PBKDF2_LANES * t + lane] = inner[t];
+        lanes->outer[PBKDF2_LANES * t + lane] = outer[t];
+        lanes->block[PBKDF2_LANES * t + lane] = fmbe32(u[t]);
+        lanes->acc  [PBKDF2_LANES * t + lane] = fmbe32(u[t]);
+    }
+
+    lanes->job[lane] = job;
+    lanes->counter[lane] = counter;
+    lanes->left[lane] = job->iterations - 1;
+
+    return ORDO_SUCCESS;
+}
+
+/* Runs the given number of iterations on all lanes, idle ones included. */
+static void lanes_iterate(struct LANES *lanes, uintmax_t iterations)
+{
+    size_t len = lanes->words * PBKDF2_LANES * sizeof(uint32_t);
+    uint32_t state[8 * PBKDF2_LANES];
+    size_t t;
+
+    while (iterations--)
+    {
+        memcpy(state, lanes->inner, len);
+        lanes->compress(state, lanes->block);
+        memcpy(lanes->block, state, len);
+
+        memcpy(state, lanes->outer, len);
+        lanes->compress(state, lanes->block);
+        memcpy(lanes->block, state, len);
+
+        for (t = 0; t < lanes->words * PBKDF2_LANES; ++t)
+            lanes->acc[t] ^= state[t];
+    }
+}
+
+static void pbkdf2_lanes(struct LANES *lanes,
+                         prim_t hash, const void *params,
+                         struct PBKDF2_JOB *jobs, size_t count)
+{
+    size_t digest_len = lanes->words * sizeof(uint32_t);
+    size_t next = 0, t;
+    uint32_t counter = 1;
+
+    memset(lanes->block, 0, sizeof(lanes->block));
+
+    for (t = 0; t < PBKDF2_LANES; ++t)
+    {
+        lanes->block[PBKDF2_LANES * lanes->words + t] = 0x80000000;
+        lanes->block[PBKDF2_LANES * 15 + t] = (uint32_t)(64 + digest_len) * 8;
+        lanes->job[t] = 0;
+    }
+
+    for (;;)
+    {
+        uintmax_t iterations = 0;
+
+        for (t = 0; t < PBKDF2_LANES; ++t)
+            while (!lanes->job[t] && next < count)
+            {
+                struct PBKDF2_JOB *job = &jobs[next];
+                uint32_t block = counter;
+
+                /* Move on to the next block, or to the next job. */
+                if (!job->err && (size_t)counter * digest_len < job->out_len)
+                    ++counter;
+                else
+                {
+                    counter = 1;
+                    ++next;
+                }
+
+                if (job->err) continue;
+
+                job->err = lane_load(lanes, t, hash, params, job, block);
+
+                if (!job->err && !lanes->left[t])
+                    lane_store(lanes, t);
+            }
+
+        for (t = 0; t < PBKDF2_LANES; ++t)
+            if (lanes->job[t] && (!iterations || lanes->left[t] < iterations))
+                iterations = lanes->left[t];
+
+        /* No lane is busy, and no block is left. */
+        if (!iterations) break;
+
+        lanes_iterate(lanes, iterations);
+
+        for (t = 0; t < PBKDF2_LANES; ++t)
+            if (lanes->job[t] && !(lanes->left[t] -= iterations))
+                lane_store(lanes, t);
+    }
+}
+
+int kdf_pbkdf2_batch(prim_t hash, const void *params,
+                     struct PBKDF2_JOB *jobs, size_t count)
+{
+    struct LANES lanes;
+    size_t digest_len, t;
+
+    if (prim_type(hash) != PRIM_TYPE_HASH)
+        return ORDO_ARG;
+
+    digest_len = digest_length(hash);
+    lanes.compress = 0;
+
+    switch (hash)
+    {
+        #if WITH_SHA1
+        case HASH_SHA1:
+            lanes.compress = sha1_compress_x8;
+            break;
+        #endif
+        #if WITH_SHA256
+        case HASH_SHA256:
+            lanes.compress = sha256_compress_x8;
+            break;
+        #endif
     }
 
+    lanes.words = digest_len / sizeof(uint32_t);
+
+    /* The same checks as kdf_pbkdf2(), before any of the lanes start. */
+    for (t = 0; t < count; ++t)
+    {
+        struct PBKDF2_JOB *job = &jobs[t];
+
+        if (!job->pwd_len || !job->iterations || !job->out_len)
+            job->err = ORDO_ARG;
+        else if ((job->out_len - 1) / digest_len >= UINT32_C(0xFFFFFFFF))
+            job->err = ORDO_ARG;
+        else
+            job->err = ORDO_SUCCESS;
+    }
+
+    /* A single job is better served by kdf_pbkdf2(), which does not compute
+     * idle lanes. Either way, all of the work stays on the calling thread. */
+    if (lanes.compress && count > 1)
+        pbkdf2_lanes(&lanes, hash, params, jobs, count);
+    else
+        for (t = 0; t < count; ++t)
+            if (!jobs[t].err)
+                jobs[t].err = kdf_pbkdf2(hash, params,
+                                         jobs[t].pwd, jobs[t].pwd_len,
+                                         jobs[t].salt, jobs[t].salt_len,
+                                         jobs[t].iterations,
+                                         jobs[t].out, jobs[t].out_len);
+
+    for (t = 0; t < count; ++t)
+        if (jobs[t].err) return jobs[t].err;
+
     return ORDO_SUCCESS;
 }
@@ -0,0 +1,169 @@
+/*===-- scrypt.c --------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/kdf/scrypt.h"
+#include "ordo/kdf/pbkdf2.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* See scrypt_blockmix.c. */
+ORDO_HIDDEN void scrypt_blockmix(const uint32_t * RESTRICT in,
+                                 const uint32_t * RESTRICT with,
+                                 uint32_t * RESTRICT out,
+                                 size_t r);
+
+/* Where each word of a Salsa20 block goes in the diagonal order used by the
+ * BlockMix, see scrypt_blockmix.c. */
+static const unsigned char scrypt_order[16] =
+{
+    0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3
+};
+
+/* The work area is a single allocation, laid out as the "p" blocks of B, each
+ * of 128r bytes, followed by one slot per lane, each holding the two blocks X
+ * and Y of ROMix and its N-block array V. Each lane runs the ROMix of every
+ * "lanes"-th block of B, so that they all use their own slot. */
+struct ROMIX_BATCH
+{
+    uint32_t *b, *slots;
+    size_t block, slot;
+    size_t r, p, lanes;
+    uintmax_t n;
+};
+
+/*===----------------------------------------------------------------------===*/
+
+static void romix(uint32_t *b, uint32_t *x, uint32_t *y, uint32_t *v,
+                  uintmax_t n, size_t r)
+{
+    /* The first word of the i-th block of V. */
+    #define V(i) (v + (size_t)(i) * 32 * r)
+
+    uintmax_t i;
+
+    memcpy(V(0), b, 128 * r);
+
+    for (i = 0; i < n - 1; ++i)
+        scrypt_blockmix(V(i), 0, V(i + 1), r);
+
+    scrypt_blockmix(V(n - 1), 0, x, r);
+
+    for (i = 0; i < n; ++i)
+    {
+        /* Integerify takes the first eight bytes of the last 64-byte block,
+         * that is, Salsa20 words 0 and 1, in their diagonal positions. */
+        const uint32_t *last = x + 16 * (2 * r - 1);
+        uintmax_t j = last[scrypt_order[0]];
+        uint32_t *t;
+
+        j |= (uintmax_t)last[scrypt_order[1]] << 16 << 16;
+
+        scrypt_blockmix(x, V(j & (n - 1)), y, r);
+
+        t = x; x = y; y = t;
+    }
+
+    memcpy(b, x, 128 * r);
+
+    #undef V
+}
+
+static void romix_job(void *ctx, size_t index)
+{
+    const struct ROMIX_BATCH *batch = (const struct ROMIX_BATCH *)ctx;
+    uint32_t *slot = batch->slots + index * (batch->slot / 4);
+    size_t t;
+
+    for (t = index; t < batch->p; t += batch->lanes)
+        romix(batch->b + t * (batch->block / 4),
+              slot, slot + batch->block / 4, slot + batch->block / 2,
+              batch->n, batch->r);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int kdf_scrypt(const void *pwd, size_t pwd_len,
+               const void *salt, size_t salt_len,
+               uintmax_t n, size_t r, size_t p,
+               void *out, size_t out_len)
+{
+    int err;
+
+    struct ROMIX_BATCH batch;
+    size_t words, len, t, k;
+    void *work;
+
+    if (!pwd_len || !out_len || !r || !p) return ORDO_ARG;
+
+    /* N must be a power of two greater than one, which is also less than
+     * 2^(16r), and the product rp must be less than 2^30. */
+    if (n < 2 || (n & (n - 1))) return ORDO_ARG;
+    if (r < sizeof(uintmax_t) / 2 && n >> (16 * r)) return ORDO_ARG;
+    if (p > ((1UL << 30) - 1) / r) return ORDO_ARG;
+
+    /* The whole work area must fit in memory, ruling out silly parameters. */
+    if (r > ((size_t)-1) / 256) return ORDO_ARG;
+
+    batch.block = 128 * r;
+    batch.lanes = smin(p, sys_threads());
+
+    if (p > ((size_t)-1) / batch.block) return ORDO_ARG;
+
+    if (n > ((size_t)-1) / batch.block - 2) return ORDO_ARG;
+    batch.slot = batch.block * ((size_t)n + 2);
+
+    if (batch.lanes > (((size_t)-1) - batch.block * p) / batch.slot)
+        return ORDO_ARG;
+    len = batch.block * p + batch.lanes * batch.slot;
+
+    if (!(work = sys_alloc(len))) return ORDO_FAIL;
+
+    batch.b = (uint32_t *)work;
+    batch.slots = batch.b + p * (batch.block / 4);
+    batch.r = r;
+    batch.p = p;
+    batch.n = n;
+
+    err = kdf_pbkdf2(HASH_SHA256, 0, pwd, pwd_len, salt, salt_len, 1,
+                     batch.b, batch.block * p);
+
+    if (!err)
+    {
+        words = p * (batch.block / 4);
+
+        /* B is read as little-endian words, each block shuffled into the
+         * order the BlockMix works in, with the slots as scratch space. */
+        for (t = 0; t < words; t += 16)
+        {
+            uint32_t *w = batch.b + t;
+
+            for (k = 0; k < 16; ++k)
+                batch.slots[scrypt_order[k]] = fmle32(w[k]);
+
+            memcpy(w, batch.slots, 64);
+        }
+
+        sys_parallel(batch.lanes, romix_job, &batch);
+
+        for (t = 0; t < words; t += 16)
+        {
+            uint32_t *w = batch.b + t;
+
+            for (k = 0; k < 16; ++k)
+                batch.slots[k] = tole32(w[scrypt_order[k]]);
+
+            memcpy(w, batch.slots, 64);
+        }
+
+        err = kdf_pbkdf2(HASH_SHA256, 0, pwd, pwd_len,
+                         batch.b, batch.block * p, 1, out, out_len);
+    }
+
+    memset(work, 0, len);
+    sys_free(work, len);
+
+    return err;
+}
@@ -0,0 +1,84 @@
+/*===-- scrypt_blockmix.c -----------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* Computes the scrypt BlockMix of the "2r" 64-byte blocks of "in", XORed with
+ * those of "with" first unless it is nil, into "out", which may overlap with
+ * neither of them. The blocks are in native byte order, with the words of each
+ * block in the diagonal order of SIMD implementations of Salsa20, see below. */
+ORDO_HIDDEN void scrypt_blockmix(const uint32_t * RESTRICT in,
+                                 const uint32_t * RESTRICT with,
+                                 uint32_t * RESTRICT out,
+                                 size_t r)
+HOT_CODE;
+
+/*===----------------------------------------------------------------------===*/
+
+#define QR(a, b, c, d)                                                       \
+    do {                                                                     \
+        b ^= rol32(a + d,  7);                                               \
+        c ^= rol32(b + a,  9);                                               \
+        d ^= rol32(c + b, 13);                                               \
+        a ^= rol32(d + c, 18);                                               \
+    } while (0)
+
+/* The Salsa20/8 core, on a block in the diagonal order, so that position i
+ * holds Salsa20 word {0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11}[i],
+ * which lets this code load the words in place. */
+static void salsa20_8(uint32_t b[16])
+{
+    uint32_t x0  = b[ 0], x5  = b[ 1], x10 = b[ 2], x15 = b[ 3];
+    uint32_t x4  = b[ 4], x9  = b[ 5], x14 = b[ 6], x3  = b[ 7];
+    uint32_t x8  = b[ 8], x13 = b[ 9], x2  = b[10], x7  = b[11];
+    uint32_t x12 = b[12], x1  = b[13], x6  = b[14], x11 = b[15];
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        QR( x0,  x4,  x8, x12);
+        QR( x5,  x9, x13,  x1);
+        QR(x10, x14,  x2,  x6);
+        QR(x15,  x3,  x7, x11);
+
+        QR( x0,  x1,  x2,  x3);
+        QR( x5,  x6,  x7,  x4);
+        QR(x10, x11,  x8,  x9);
+        QR(x15, x12, x13, x14);
+    }
+
+    b[ 0] += x0;  b[ 1] += x5;  b[ 2] += x10; b[ 3] += x15;
+    b[ 4] += x4;  b[ 5] += x9;  b[ 6] += x14; b[ 7] += x3;
+    b[ 8] += x8;  b[ 9] += x13; b[10] += x2;  b[11] += x7;
+    b[12] += x12; b[13] += x1;  b[14] += x6;  b[15] += x11;
+}
+
+void scrypt_blockmix(const uint32_t * RESTRICT in,
+                     const uint32_t * RESTRICT with,
+                     uint32_t * RESTRICT out,
+                     size_t r)
+{
+    uint32_t x[16];
+    size_t i, t;
+
+    memcpy(x, in + 16 * (2 * r - 1), sizeof(x));
+
+    if (with)
+        for (t = 0; t < 16; ++t) x[t] ^= with[16 * (2 * r - 1) + t];
+
+    /* The even output blocks go to the first half, the odd ones after. */
+    for (i = 0; i < 2 * r; ++i)
+    {
+        for (t = 0; t < 16; ++t) x[t] ^= in[16 * i + t];
+
+        if (with)
+            for (t = 0; t < 16; ++t) x[t] ^= with[16 * i + t];
+
+        salsa20_8(x);
+
+        memcpy(out + 16 * (i / 2 + (i & 1) * r), x, sizeof(x));
+    }
+}
@@ -11,8 +11,12 @@
 #define SHA1_DIGEST (bits(160))
 #define SHA1_BLOCK  (bits(512))
 
-static void sha1_compress(const uint32_t * RESTRICT block,
-                          uint32_t * RESTRICT digest) HOT_CODE;
+ORDO_HIDDEN void sha1_compress(const void * RESTRICT block,
+                               uint32_t * RESTRICT digest) HOT_CODE;
+
+/* Compresses eight blocks into eight states at once, see sha256.c. */
+ORDO_HIDDEN void sha1_compress_x8(uint32_t * RESTRICT state,
+                                  const uint32_t * RESTRICT block) HOT_CODE;
 
 static const uint32_t sha1_iv[5] =
 {
@@ -54,19 +58,21 @@ void sha1_update(struct SHA1_STATE *state,
 
     if (state->block_len + len >= SHA1_BLOCK)
     {
-        size_t pad = (size_t)(SHA1_BLOCK - state->block_len);
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SHA1_BLOCK - state->block_len);
 
-        memcpy(offset(state->block, state->block_len), buffer, pad);
-        sha1_compress(state->block, state->digest);
-        state->block_len = 0;
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            sha1_compress(state->block, state->digest);
+            state->block_len = 0;
 
-        buffer = offset(buffer, pad);
-        len -= pad;
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
 
         while (len >= SHA1_BLOCK)
         {
-            memcpy(state->block, buffer, SHA1_BLOCK);
-            sha1_compress(state->block, state->digest);
+            sha1_compress(buffer, state->digest);
 
             buffer = offset(buffer, SHA1_BLOCK);
             len -= SHA1_BLOCK;
@@ -109,7 +115,7 @@ void sha1_final(struct SHA1_STATE *state,
 #define F3(x, y, z) ((x & y) | (x & z) | (y & z))
 #define F4(x, y, z) F2(x, y, z)
 
-void sha1_compress(const uint32_t * RESTRICT block,
+void sha1_compress(const void * RESTRICT block,
                    uint32_t * RESTRICT digest)
 {
     size_t t;
@@ -122,8 +128,10 @@ void sha1_compress(const uint32_t * RESTRICT block,
 
     uint32_t w[80];
 
+    memcpy(w, block, SHA1_BLOCK);
+
     for (t = 0; t < 16; ++t)
-        w[t] = tobe32(block[t]);
+        w[t] = tobe32(w[t]);
 
     for (t = 16; t < 80; ++t)
         w[t] = rol32(w[t - 3] ^ w[t - 8] ^ w[t - 14] ^ w[t - 16], 1);
@@ -158,3 +166,46 @@ void sha1_compress(const uint32_t * RESTRICT block,
     digest[3] += d;
     digest[4] += e;
 }
+
+#define SHA1_X8_ROUNDS(first, last, F, k)                                    \
+    for (t = first; t < last; ++t)                                           \
+        for (j = 0; j < 8; ++j)                                              \
+        {                                                                    \
+            uint32_t a = v[0][j], b = v[1][j], c = v[2][j];                  \
+            uint32_t d = v[3][j], e = v[4][j];                               \
+                                                                             \
+            v[4][j] = d;                                                     \
+            v[3][j] = c;                                                     \
+            v[2][j] = rol32(b, 30);                                          \
+            v[1][j] = a;                                                     \
+            v[0][j] = rol32(a, 5) + F(b, c, d) + e + w[t][j] + k;            \
+        }
+
+void sha1_compress_x8(uint32_t * RESTRICT state,
+                      const uint32_t * RESTRICT block)
+{
+    uint32_t w[80][8], v[5][8];
+    size_t t, j;
+
+    for (t = 0; t < 16; ++t)
+        for (j = 0; j < 8; ++j)
+            w[t][j] = block[8 * t + j];
+
+    for (t = 16; t < 80; ++t)
+        for (j = 0; j < 8; ++j)
+            w[t][j] = rol32(w[t -  3][j] ^ w[t -  8][j]
+                          ^ w[t - 14][j] ^ w[t - 16][j], 1);
+
+    for (t = 0; t < 5; ++t)
+        for (j = 0; j < 8; ++j)
+            v[t][j] = state[8 * t + j];
+
+    SHA1_X8_ROUNDS( 0, 20, F1, 0x5a827999)
+    SHA1_X8_ROUNDS(20, 40, F2, 0x6ed9eba1)
+    SHA1_X8_ROUNDS(40, 60, F3, 0x8f1bbcdc)
+    SHA1_X8_ROUNDS(60, 80, F4, 0xca62c1d6)
+
+    for (t = 0; t < 5; ++t)
+        for (j = 0; j < 8; ++j)
+            state[8 * t + j] += v[t][j];
+}
@@ -11,8 +11,15 @@
 #define SHA256_DIGEST (bits(256))
 #define SHA256_BLOCK  (bits(512))
 
-static void sha256_compress(const uint32_t * RESTRICT block,
-                            uint32_t * RESTRICT digest) HOT_CODE;
+ORDO_HIDDEN void sha256_compress(const void * RESTRICT block,
+                                 uint32_t * RESTRICT digest) HOT_CODE;
+
+/* Compresses eight independent blocks into as many states at once. Both are
+ * interleaved word by word, so that word i of state or block j is at index
+ * 8i + j, and the block words are native integers, not big-endian bytes. The
+ * lanes are processed in loops which compilers vectorize, see pbkdf2.c. */
+ORDO_HIDDEN void sha256_compress_x8(uint32_t * RESTRICT state,
+                                    const uint32_t * RESTRICT block) HOT_CODE;
 
 static const uint32_t sha256_iv[8] =
 {
@@ -58,19 +65,21 @@ void sha256_update(struct SHA256_STATE *state,
 
     if (state->block_len + len >= SHA256_BLOCK)
     {
-        size_t pad = (size_t)(SHA256_BLOCK - state->block_len);
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SHA256_BLOCK - state->block_len);
 
-        memcpy(offset(state->block, state->block_len), buffer, pad);
-        sha256_compress(state->block, state->digest);
-        state->block_len = 0;
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            sha256_compress(state->block, state->digest);
+            state->block_len = 0;
 
-        buffer = offset(buffer, pad);
-        len -= pad;
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
 
         while (len >= SHA256_BLOCK)
         {
-            memcpy(state->block, buffer, SHA256_BLOCK);
-            sha256_compress(state->block, state->digest);
+            sha256_compress(buffer, state->digest);
 
             buffer = offset(buffer, SHA256_BLOCK);
             len -= SHA256_BLOCK;
@@ -135,7 +144,7 @@ static const uint32_t sha256_table[64] =
 #define ma(x, y, z) ((x & y) ^ (x & z) ^ (y & z))
 #define ch(x, y, z) ((x & y) ^ (~x & z))
 
-void sha256_compress(const uint32_t * RESTRICT block,
+void sha256_compress(const void * RESTRICT block,
                      uint32_t * RESTRICT digest)
 {
     size_t t;
@@ -151,7 +160,10 @@ void sha256_compress(const uint32_t * RESTRICT block,
 
     uint32_t w[64]; /* The "message schedule" array. */
 
-    for (t = 0; t < 16; ++t) w[t] = tobe32(block[t]);
+    /* Unaligned-safe load of the (possibly user-provided) input block. */
+    memcpy(w, block, SHA256_BLOCK);
+
+    for (t = 0; t < 16; ++t) w[t] = tobe32(w[t]);
 
     for (t = 16; t < 64; ++t)
     {
@@ -191,3 +203,56 @@ void sha256_compress(const uint32_t * RESTRICT block,
     digest[6] += g;
     digest[7] += h;
 }
+
+void sha256_compress_x8(uint32_t * RESTRICT state,
+                        const uint32_t * RESTRICT block)
+{
+    uint32_t w[64][8], v[8][8];
+    size_t t, j;
+
+    for (t = 0; t < 16; ++t)
+        for (j = 0; j < 8; ++j)
+            w[t][j] = block[8 * t + j];
+
+    for (t = 16; t < 64; ++t)
+        for (j = 0; j < 8; ++j)
+        {
+            uint32_t r1 = ror32(w[t -  2][j], 17) ^ ror32(w[t -  2][j], 19);
+            uint32_t r2 = ror32(w[t - 15][j],  7) ^ ror32(w[t - 15][j], 18);
+
+            r1 ^= w[t -  2][j] >> 10;
+            r2 ^= w[t - 15][j] >>  3;
+
+            w[t][j] = w[t - 16][j] + w[t - 7][j] + r1 + r2;
+        }
+
+    for (t = 0; t < 8; ++t)
+        for (j = 0; j < 8; ++j)
+            v[t][j] = state[8 * t + j];
+
+    for (t = 0; t < 64; ++t)
+        for (j = 0; j < 8; ++j)
+        {
+            uint32_t a = v[0][j], b = v[1][j], c = v[2][j], d = v[3][j];
+            uint32_t e = v[4][j], f = v[5][j], g = v[6][j], h = v[7][j];
+
+            uint32_t t2 = (ror32(a, 2) ^ ror32(a, 13) ^ ror32(a, 22));
+            uint32_t t1 = (ror32(e, 6) ^ ror32(e, 11) ^ ror32(e, 25));
+
+            t1 += ch(e, f, g) + h + w[t][j] + sha256_table[t];
+            t2 += ma(a, b, c);
+
+            v[7][j] = g;
+            v[6][j] = f;
+            v[5][j] = e;
+            v[4][j] = d + t1;
+            v[3][j] = c;
+            v[2][j] = b;
+            v[1][j] = a;
+            v[0][j] = t1 + t2;
+        }
+
+    for (t = 0; t < 8; ++t)
+        for (j = 0; j < 8; ++j)
+            state[8 * t + j] += v[t][j];
+}
@@ -0,0 +1,305 @@
+/*===-- sha3.c ----------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/sha3.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* The largest rate, that of SHAKE128, in bytes. */
+#define SHA3_MAX_RATE (168)
+
+/* Domain separation suffixes, which include the first bit of the padding. */
+#define SHA3_SUFFIX  0x06
+#define SHAKE_SUFFIX 0x1F
+
+/* See keccak.c. */
+ORDO_HIDDEN void keccak_f1600(uint64_t state[25]);
+ORDO_HIDDEN void keccak_f1600_x4(uint64_t state[100]);
+
+/* Absorbs a whole block of "rate" bytes into the state and permutes it. The
+ * block need not be aligned. */
+static void sha3_absorb(uint64_t * RESTRICT lanes,
+                        const void * RESTRICT block,
+                        size_t rate) HOT_CODE;
+
+/* Pads the message and starts squeezing, see sha3_squeeze(). */
+static void sha3_pad(struct SHA3_STATE *state);
+
+/* The block buffer holds input until there is a whole block to absorb, and
+ * once squeezing, it holds the current output block, of which the first
+ * "block_len" bytes have been read already. */
+#ifdef OPAQUE
+struct SHA3_STATE
+{
+    uint64_t lanes[25];
+    uint64_t block[21];
+    uint64_t block_len;
+    uint64_t rate;
+    uint64_t digest_len;
+    uint64_t suffix;
+    uint64_t squeezing;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+static void sha3_start(struct SHA3_STATE *state,
+                       size_t digest_len, size_t rate, int suffix)
+{
+    memset(state->lanes, 0, sizeof(state->lanes));
+    state->block_len = 0;
+    state->rate = rate;
+    state->digest_len = digest_len;
+    state->suffix = suffix;
+    state->squeezing = 0;
+}
+
+int sha3_224_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(224), 144, SHA3_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_256_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(256), 136, SHA3_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_384_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(384), 104, SHA3_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+int sha3_512_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(512), 72, SHA3_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+int shake128_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(256), 168, SHAKE_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+int shake256_init(struct SHA3_STATE *state,
+                  const void *params)
+{
+    sha3_start(state, bits(512), 136, SHAKE_SUFFIX);
+
+    return ORDO_SUCCESS;
+}
+
+void sha3_update(struct SHA3_STATE *state,
+                 const void *buffer, size_t len)
+{
+    size_t rate = (size_t)state->rate;
+
+    if (!len) return;
+
+    if (state->block_len + len >= rate)
+    {
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(rate - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            sha3_absorb(state->lanes, state->block, rate);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        while (len >= rate)
+        {
+            sha3_absorb(state->lanes, buffer, rate);
+
+            buffer = offset(buffer, rate);
+            len -= rate;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void sha3_final(struct SHA3_STATE *state,
+                void *digest)
+{
+    sha3_squeeze(state, digest, (size_t)state->digest_len);
+}
+
+void sha3_squeeze(struct SHA3_STATE *state,
+                  void *out, size_t len)
+{
+    size_t rate = (size_t)state->rate;
+
+    if (!state->squeezing) sha3_pad(state);
+
+    while (len)
+    {
+        size_t n;
+
+        if (state->block_len == rate)
+        {
+            size_t t;
+
+            keccak_f1600(state->lanes);
+
+            for (t = 0; t < rate / 8; ++t)
+                state->block[t] = tole64(state->lanes[t]);
+
+            state->block_len = 0;
+        }
+
+        n = smin(len, (size_t)(rate - state->block_len));
+
+        memcpy(out, offset(state->block, state->block_len), n);
+        state->block_len += n;
+
+        out = offset(out, n);
+        len -= n;
+    }
+}
+
+int sha3_hash4(prim_t hash,
+               const void *const in[4], size_t len,
+               void *const out[4], size_t out_len)
+{
+    uint64_t lanes[100];
+    unsigned char block[4][SHA3_MAX_RATE];
+    struct SHA3_STATE info;
+    size_t rate, pos, i, t;
+
+    switch (hash)
+    {
+        case HASH_SHA3_224: sha3_224_init(&info, 0); break;
+        case HASH_SHA3_256: sha3_256_init(&info, 0); break;
+        case HASH_SHA3_384: sha3_384_init(&info, 0); break;
+        case HASH_SHA3_512: sha3_512_init(&info, 0); break;
+        case HASH_SHAKE128: shake128_init(&info, 0); break;
+        case HASH_SHAKE256: shake256_init(&info, 0); break;
+        default: return ORDO_ARG;
+    }
+
+    if (info.suffix == SHA3_SUFFIX && out_len != info.digest_len)
+        return ORDO_ARG;
+
+    rate = (size_t)info.rate;
+    memset(lanes, 0, sizeof(lanes));
+
+    /* The last block is always padded, even if it is empty. */
+    for (pos = 0; pos + rate <= len; pos += rate)
+    {
+        for (t = 0; t < rate / 8; ++t)
+            for (i = 0; i < 4; ++i)
+            {
+                uint64_t word;
+
+                memcpy(&word, offset(in[i], pos + t * 8), sizeof(word));
+                lanes[4 * t + i] ^= fmle64(word);
+            }
+
+        keccak_f1600_x4(lanes);
+    }
+
+    for (i = 0; i < 4; ++i)
+    {
+        memset(block[i], 0, rate);
+        memcpy(block[i], offset(in[i], pos), len - pos);
+
+        block[i][len - pos] = (unsigned char)info.suffix;
+        block[i][rate - 1] |= 0x80;
+    }
+
+    for (t = 0; t < rate / 8; ++t)
+        for (i = 0; i < 4; ++i)
+        {
+            uint64_t word;
+
+            memcpy(&word, block[i] + t * 8, sizeof(word));
+            lanes[4 * t + i] ^= fmle64(word);
+        }
+
+    for (pos = 0;;)
+    {
+        size_t n = smin(out_len - pos, rate);
+
+        keccak_f1600_x4(lanes);
+
+        for (t = 0; t < rate / 8; ++t)
+            for (i = 0; i < 4; ++i)
+            {
+                uint64_t word = tole64(lanes[4 * t + i]);
+
+                memcpy(block[i] + t * 8, &word, sizeof(word));
+            }
+
+        for (i = 0; i < 4; ++i)
+            memcpy(offset(out[i], pos), block[i], n);
+
+        if ((pos += n) == out_len) break;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void sha3_pad(struct SHA3_STATE *state)
+{
+    /* Keccak uses "pad10*1" padding, appended to the domain suffix bits. If
+     * there is only one byte left in the block, the first and last padding
+     * bits end up in the same byte, and the block is always absorbed. */
+
+    size_t rate = (size_t)state->rate;
+    unsigned char *block = (unsigned char *)state->block;
+    size_t t;
+
+    memset(block + state->block_len, 0, (size_t)(rate - state->block_len));
+
+    block[state->block_len] = (unsigned char)state->suffix;
+    block[rate - 1] |= 0x80;
+
+    sha3_absorb(state->lanes, state->block, rate);
+
+    for (t = 0; t < rate / 8; ++t)
+        state->block[t] = tole64(state->lanes[t]);
+
+    state->block_len = 0;
+    state->squeezing = 1;
+}
+
+void sha3_absorb(uint64_t * RESTRICT lanes,
+                 const void * RESTRICT block,
+                 size_t rate)
+{
+    size_t t;
+
+    for (t = 0; t < rate / 8; ++t)
+    {
+        uint64_t word;
+
+        /* Unaligned-safe load of the (possibly user-provided) input block. */
+        memcpy(&word, offset(block, t * 8), sizeof(word));
+        lanes[t] ^= fmle64(word);
+    }
+
+    keccak_f1600(lanes);
+}
@@ -0,0 +1,502 @@
+;/===-- argon2_compress.asm ---------------*- shared/unix/amd64 -*- ASM -*-===*/
+
+; Argon2 block compression for AMD64 with SSE2
+;
+; Computes G(X, Y) = P(X ^ Y) ^ X ^ Y, where P is applied to the eight
+; rows of the block, then to its eight columns, each of these being one
+; BLAKE2b round with multiplications added, as used by Argon2. The rows
+; go through a 1 KiB buffer on the stack, and the final XOR reloads the
+; input blocks rather than keeping them. The output block is also XORed
+; in if "xor" is set, which is tested once per column.
+;
+; Each row of the BLAKE2b working state, of four words, is held in a pair
+; of XMM registers, and the diagonal steps are done by rotating the rows,
+; with unpacks as SSE2 has no PALIGNR. The register names of the halves
+; of a row are swapped rather than their contents where possible.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global argon2_compress_ASM:function hidden
+
+section .text
+
+argon2_compress_ASM:
+    sub RSP, 0x400
+
+    ; rows, into the buffer
+    xor R11, R11
+.rows:
+    movdqu xmm0, [RSI + R11 + 0x00]
+    movdqu xmm8, [RDX + R11 + 0x00]
+    pxor xmm0, xmm8
+    movdqu xmm1, [RSI + R11 + 0x10]
+    movdqu xmm8, [RDX + R11 + 0x10]
+    pxor xmm1, xmm8
+    movdqu xmm2, [RSI + R11 + 0x20]
+    movdqu xmm8, [RDX + R11 + 0x20]
+    pxor xmm2, xmm8
+    movdqu xmm3, [RSI + R11 + 0x30]
+    movdqu xmm8, [RDX + R11 + 0x30]
+    pxor xmm3, xmm8
+    movdqu xmm4, [RSI + R11 + 0x40]
+    movdqu xmm8, [RDX + R11 + 0x40]
+    pxor xmm4, xmm8
+    movdqu xmm5, [RSI + R11 + 0x50]
+    movdqu xmm8, [RDX + R11 + 0x50]
+    pxor xmm5, xmm8
+    movdqu xmm6, [RSI + R11 + 0x60]
+    movdqu xmm8, [RDX + R11 + 0x60]
+    pxor xmm6, xmm8
+    movdqu xmm7, [RSI + R11 + 0x70]
+    movdqu xmm8, [RDX + R11 + 0x70]
+    pxor xmm7, xmm8
+
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm6, xmm0
+    pshufd xmm6, xmm6, 0xB1
+    pxor xmm7, xmm1
+    pshufd xmm7, xmm7, 0xB1
+    movdqa xmm8, xmm4
+    pmuludq xmm8, xmm6
+    paddq xmm4, xmm6
+    paddq xmm8, xmm8
+    paddq xmm4, xmm8
+    movdqa xmm9, xmm5
+    pmuludq xmm9, xmm7
+    paddq xmm5, xmm7
+    paddq xmm9, xmm9
+    paddq xmm5, xmm9
+    pxor xmm2, xmm4
+    movdqa xmm8, xmm2
+    psrlq xmm2, 24
+    psllq xmm8, 40
+    por xmm2, xmm8
+    pxor xmm3, xmm5
+    movdqa xmm9, xmm3
+    psrlq xmm3, 24
+    psllq xmm9, 40
+    por xmm3, xmm9
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm6, xmm0
+    movdqa xmm8, xmm6
+    psrlq xmm6, 16
+    psllq xmm8, 48
+    por xmm6, xmm8
+    pxor xmm7, xmm1
+    movdqa xmm9, xmm7
+    psrlq xmm7, 16
+    psllq xmm9, 48
+    por xmm7, xmm9
+    movdqa xmm8, xmm4
+    pmuludq xmm8, xmm6
+    paddq xmm4, xmm6
+    paddq xmm8, xmm8
+    paddq xmm4, xmm8
+    movdqa xmm9, xmm5
+    pmuludq xmm9, xmm7
+    paddq xmm5, xmm7
+    paddq xmm9, xmm9
+    paddq xmm5, xmm9
+    pxor xmm2, xmm4
+    movdqa xmm8, xmm2
+    psrlq xmm8, 63
+    paddq xmm2, xmm2
+    por xmm2, xmm8
+    pxor xmm3, xmm5
+    movdqa xmm9, xmm3
+    psrlq xmm9, 63
+    paddq xmm3, xmm3
+    por xmm3, xmm9
+
+    movdqa xmm8, xmm2
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm3
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm2, xmm9
+    punpckhqdq xmm3, xmm8
+    movdqa xmm8, xmm6
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm7
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm7, xmm8
+    punpckhqdq xmm6, xmm9
+
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm7, xmm0
+    pshufd xmm7, xmm7, 0xB1
+    pxor xmm6, xmm1
+    pshufd xmm6, xmm6, 0xB1
+    movdqa xmm8, xmm5
+    pmuludq xmm8, xmm7
+    paddq xmm5, xmm7
+    paddq xmm8, xmm8
+    paddq xmm5, xmm8
+    movdqa xmm9, xmm4
+    pmuludq xmm9, xmm6
+    paddq xmm4, xmm6
+    paddq xmm9, xmm9
+    paddq xmm4, xmm9
+    pxor xmm2, xmm5
+    movdqa xmm8, xmm2
+    psrlq xmm2, 24
+    psllq xmm8, 40
+    por xmm2, xmm8
+    pxor xmm3, xmm4
+    movdqa xmm9, xmm3
+    psrlq xmm3, 24
+    psllq xmm9, 40
+    por xmm3, xmm9
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm7, xmm0
+    movdqa xmm8, xmm7
+    psrlq xmm7, 16
+    psllq xmm8, 48
+    por xmm7, xmm8
+    pxor xmm6, xmm1
+    movdqa xmm9, xmm6
+    psrlq xmm6, 16
+    psllq xmm9, 48
+    por xmm6, xmm9
+    movdqa xmm8, xmm5
+    pmuludq xmm8, xmm7
+    paddq xmm5, xmm7
+    paddq xmm8, xmm8
+    paddq xmm5, xmm8
+    movdqa xmm9, xmm4
+    pmuludq xmm9, xmm6
+    paddq xmm4, xmm6
+    paddq xmm9, xmm9
+    paddq xmm4, xmm9
+    pxor xmm2, xmm5
+    movdqa xmm8, xmm2
+    psrlq xmm8, 63
+    paddq xmm2, xmm2
+    por xmm2, xmm8
+    pxor xmm3, xmm4
+    movdqa xmm9, xmm3
+    psrlq xmm9, 63
+    paddq xmm3, xmm3
+    por xmm3, xmm9
+
+    movdqa xmm8, xmm2
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm3
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm3, xmm8
+    punpckhqdq xmm2, xmm9
+    movdqa xmm8, xmm7
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm6
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm7, xmm9
+    punpckhqdq xmm6, xmm8
+
+    movdqu [RSP + R11 + 0x00], xmm0
+    movdqu [RSP + R11 + 0x10], xmm1
+    movdqu [RSP + R11 + 0x20], xmm3
+    movdqu [RSP + R11 + 0x30], xmm2
+    movdqu [RSP + R11 + 0x40], xmm4
+    movdqu [RSP + R11 + 0x50], xmm5
+    movdqu [RSP + R11 + 0x60], xmm7
+    movdqu [RSP + R11 + 0x70], xmm6
+
+    add R11, 0x80
+    cmp R11, 0x400
+    jne .rows
+
+    ; columns, into the output
+    xor R11, R11
+.columns:
+    movdqu xmm0, [RSP + R11 + 0x000]
+    movdqu xmm1, [RSP + R11 + 0x080]
+    movdqu xmm2, [RSP + R11 + 0x100]
+    movdqu xmm3, [RSP + R11 + 0x180]
+    movdqu xmm4, [RSP + R11 + 0x200]
+    movdqu xmm5, [RSP + R11 + 0x280]
+    movdqu xmm6, [RSP + R11 + 0x300]
+    movdqu xmm7, [RSP + R11 + 0x380]
+
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm6, xmm0
+    pshufd xmm6, xmm6, 0xB1
+    pxor xmm7, xmm1
+    pshufd xmm7, xmm7, 0xB1
+    movdqa xmm8, xmm4
+    pmuludq xmm8, xmm6
+    paddq xmm4, xmm6
+    paddq xmm8, xmm8
+    paddq xmm4, xmm8
+    movdqa xmm9, xmm5
+    pmuludq xmm9, xmm7
+    paddq xmm5, xmm7
+    paddq xmm9, xmm9
+    paddq xmm5, xmm9
+    pxor xmm2, xmm4
+    movdqa xmm8, xmm2
+    psrlq xmm2, 24
+    psllq xmm8, 40
+    por xmm2, xmm8
+    pxor xmm3, xmm5
+    movdqa xmm9, xmm3
+    psrlq xmm3, 24
+    psllq xmm9, 40
+    por xmm3, xmm9
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm6, xmm0
+    movdqa xmm8, xmm6
+    psrlq xmm6, 16
+    psllq xmm8, 48
+    por xmm6, xmm8
+    pxor xmm7, xmm1
+    movdqa xmm9, xmm7
+    psrlq xmm7, 16
+    psllq xmm9, 48
+    por xmm7, xmm9
+    movdqa xmm8, xmm4
+    pmuludq xmm8, xmm6
+    paddq xmm4, xmm6
+    paddq xmm8, xmm8
+    paddq xmm4, xmm8
+    movdqa xmm9, xmm5
+    pmuludq xmm9, xmm7
+    paddq xmm5, xmm7
+    paddq xmm9, xmm9
+    paddq xmm5, xmm9
+    pxor xmm2, xmm4
+    movdqa xmm8, xmm2
+    psrlq xmm8, 63
+    paddq xmm2, xmm2
+    por xmm2, xmm8
+    pxor xmm3, xmm5
+    movdqa xmm9, xmm3
+    psrlq xmm9, 63
+    paddq xmm3, xmm3
+    por xmm3, xmm9
+
+    movdqa xmm8, xmm2
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm3
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm2, xmm9
+    punpckhqdq xmm3, xmm8
+    movdqa xmm8, xmm6
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm7
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm7, xmm8
+    punpckhqdq xmm6, xmm9
+
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm7, xmm0
+    pshufd xmm7, xmm7, 0xB1
+    pxor xmm6, xmm1
+    pshufd xmm6, xmm6, 0xB1
+    movdqa xmm8, xmm5
+    pmuludq xmm8, xmm7
+    paddq xmm5, xmm7
+    paddq xmm8, xmm8
+    paddq xmm5, xmm8
+    movdqa xmm9, xmm4
+    pmuludq xmm9, xmm6
+    paddq xmm4, xmm6
+    paddq xmm9, xmm9
+    paddq xmm4, xmm9
+    pxor xmm2, xmm5
+    movdqa xmm8, xmm2
+    psrlq xmm2, 24
+    psllq xmm8, 40
+    por xmm2, xmm8
+    pxor xmm3, xmm4
+    movdqa xmm9, xmm3
+    psrlq xmm3, 24
+    psllq xmm9, 40
+    por xmm3, xmm9
+    movdqa xmm8, xmm0
+    pmuludq xmm8, xmm2
+    paddq xmm0, xmm2
+    paddq xmm8, xmm8
+    paddq xmm0, xmm8
+    movdqa xmm9, xmm1
+    pmuludq xmm9, xmm3
+    paddq xmm1, xmm3
+    paddq xmm9, xmm9
+    paddq xmm1, xmm9
+    pxor xmm7, xmm0
+    movdqa xmm8, xmm7
+    psrlq xmm7, 16
+    psllq xmm8, 48
+    por xmm7, xmm8
+    pxor xmm6, xmm1
+    movdqa xmm9, xmm6
+    psrlq xmm6, 16
+    psllq xmm9, 48
+    por xmm6, xmm9
+    movdqa xmm8, xmm5
+    pmuludq xmm8, xmm7
+    paddq xmm5, xmm7
+    paddq xmm8, xmm8
+    paddq xmm5, xmm8
+    movdqa xmm9, xmm4
+    pmuludq xmm9, xmm6
+    paddq xmm4, xmm6
+    paddq xmm9, xmm9
+    paddq xmm4, xmm9
+    pxor xmm2, xmm5
+    movdqa xmm8, xmm2
+    psrlq xmm8, 63
+    paddq xmm2, xmm2
+    por xmm2, xmm8
+    pxor xmm3, xmm4
+    movdqa xmm9, xmm3
+    psrlq xmm9, 63
+    paddq xmm3, xmm3
+    por xmm3, xmm9
+
+    movdqa xmm8, xmm2
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm3
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm3, xmm8
+    punpckhqdq xmm2, xmm9
+    movdqa xmm8, xmm7
+    punpcklqdq xmm8, xmm8
+    movdqa xmm9, xmm6
+    punpcklqdq xmm9, xmm9
+    punpckhqdq xmm7, xmm9
+    punpckhqdq xmm6, xmm8
+
+    movdqu xmm8, [RSI + R11 + 0x000]
+    movdqu xmm9, [RDX + R11 + 0x000]
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    movdqu xmm8, [RSI + R11 + 0x080]
+    movdqu xmm9, [RDX + R11 + 0x080]
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqu xmm8, [RSI + R11 + 0x100]
+    movdqu xmm9, [RDX + R11 + 0x100]
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqu xmm8, [RSI + R11 + 0x180]
+    movdqu xmm9, [RDX + R11 + 0x180]
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqu xmm8, [RSI + R11 + 0x200]
+    movdqu xmm9, [RDX + R11 + 0x200]
+    pxor xmm4, xmm8
+    pxor xmm4, xmm9
+    movdqu xmm8, [RSI + R11 + 0x280]
+    movdqu xmm9, [RDX + R11 + 0x280]
+    pxor xmm5, xmm8
+    pxor xmm5, xmm9
+    movdqu xmm8, [RSI + R11 + 0x300]
+    movdqu xmm9, [RDX + R11 + 0x300]
+    pxor xmm7, xmm8
+    pxor xmm7, xmm9
+    movdqu xmm8, [RSI + R11 + 0x380]
+    movdqu xmm9, [RDX + R11 + 0x380]
+    pxor xmm6, xmm8
+    pxor xmm6, xmm9
+
+    test ECX, ECX
+    jz .store
+
+    movdqu xmm8, [RDI + R11 + 0x000]
+    pxor xmm0, xmm8
+    movdqu xmm8, [RDI + R11 + 0x080]
+    pxor xmm1, xmm8
+    movdqu xmm8, [RDI + R11 + 0x100]
+    pxor xmm3, xmm8
+    movdqu xmm8, [RDI + R11 + 0x180]
+    pxor xmm2, xmm8
+    movdqu xmm8, [RDI + R11 + 0x200]
+    pxor xmm4, xmm8
+    movdqu xmm8, [RDI + R11 + 0x280]
+    pxor xmm5, xmm8
+    movdqu xmm8, [RDI + R11 + 0x300]
+    pxor xmm7, xmm8
+    movdqu xmm8, [RDI + R11 + 0x380]
+    pxor xmm6, xmm8
+
+.store:
+    movdqu [RDI + R11 + 0x000], xmm0
+    movdqu [RDI + R11 + 0x080], xmm1
+    movdqu [RDI + R11 + 0x100], xmm3
+    movdqu [RDI + R11 + 0x180], xmm2
+    movdqu [RDI + R11 + 0x200], xmm4
+    movdqu [RDI + R11 + 0x280], xmm5
+    movdqu [RDI + R11 + 0x300], xmm7
+    movdqu [RDI + R11 + 0x380], xmm6
+
+    add R11, 0x10
+    cmp R11, 0x80
+    jne .columns
+
+    add RSP, 0x400
+
+    ret
@@ -0,0 +1,262 @@
+;/===-- argon2_compress.asm ----------*- shared/unix/amd64/avx2 -*- ASM -*-===*/
+
+; Argon2 block compression for AMD64 with AVX2
+;
+; Computes G(X, Y) = P(X ^ Y) ^ X ^ Y, where P is applied to the eight
+; rows of the block, then to its eight columns, each of these being one
+; BLAKE2b round with multiplications added, as used by Argon2. The rows
+; go through a 1 KiB buffer on the stack, and the final XOR reloads the
+; input blocks rather than keeping them. The output block is also XORed
+; in if "xor" is set, which is tested once per column.
+;
+; Each row of the BLAKE2b working state, of four words, is held in a YMM
+; register, and the diagonal steps are done by rotating the rows. The
+; rows of a column are not contiguous, so they are gathered in halves.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global argon2_compress_ASM:function hidden
+
+section .text
+
+argon2_compress_ASM:
+    sub RSP, 0x440
+
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x400], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x408], RAX
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x410], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x418], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x420], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x428], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x430], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x438], RAX
+
+    vmovdqu ymm6, [RSP + 0x400]
+    vmovdqu ymm7, [RSP + 0x420]
+
+    ; rows, into the buffer
+    xor R11, R11
+.rows:
+    vmovdqu ymm0, [RSI + R11 + 0x00]
+    vpxor ymm0, ymm0, [RDX + R11 + 0x00]
+    vmovdqu ymm1, [RSI + R11 + 0x20]
+    vpxor ymm1, ymm1, [RDX + R11 + 0x20]
+    vmovdqu ymm2, [RSI + R11 + 0x40]
+    vpxor ymm2, ymm2, [RDX + R11 + 0x40]
+    vmovdqu ymm3, [RSI + R11 + 0x60]
+    vpxor ymm3, ymm3, [RDX + R11 + 0x60]
+
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm6
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm7
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm4, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm4
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm6
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm7
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm4, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm4
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    vmovdqu [RSP + R11 + 0x00], ymm0
+    vmovdqu [RSP + R11 + 0x20], ymm1
+    vmovdqu [RSP + R11 + 0x40], ymm2
+    vmovdqu [RSP + R11 + 0x60], ymm3
+
+    add R11, 0x80
+    cmp R11, 0x400
+    jne .rows
+
+    ; columns, into the output
+    xor R11, R11
+.columns:
+    vmovdqu xmm0, [RSP + R11 + 0x000]
+    vinserti128 ymm0, ymm0, [RSP + R11 + 0x080], 1
+    vmovdqu xmm1, [RSP + R11 + 0x100]
+    vinserti128 ymm1, ymm1, [RSP + R11 + 0x180], 1
+    vmovdqu xmm2, [RSP + R11 + 0x200]
+    vinserti128 ymm2, ymm2, [RSP + R11 + 0x280], 1
+    vmovdqu xmm3, [RSP + R11 + 0x300]
+    vinserti128 ymm3, ymm3, [RSP + R11 + 0x380], 1
+
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm6
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm7
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm4, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm4
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm6
+    vpmuludq ymm4, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm7
+    vpmuludq ymm4, ymm2, ymm3
+    vpaddq ymm2, ymm2, ymm3
+    vpaddq ymm4, ymm4, ymm4
+    vpaddq ymm2, ymm2, ymm4
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm4, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm4
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    vmovdqu xmm4, [RSI + R11 + 0x000]
+    vinserti128 ymm4, ymm4, [RSI + R11 + 0x080], 1
+    vmovdqu xmm5, [RDX + R11 + 0x000]
+    vinserti128 ymm5, ymm5, [RDX + R11 + 0x080], 1
+    vpxor ymm0, ymm0, ymm4
+    vpxor ymm0, ymm0, ymm5
+    vmovdqu xmm4, [RSI + R11 + 0x100]
+    vinserti128 ymm4, ymm4, [RSI + R11 + 0x180], 1
+    vmovdqu xmm5, [RDX + R11 + 0x100]
+    vinserti128 ymm5, ymm5, [RDX + R11 + 0x180], 1
+    vpxor ymm1, ymm1, ymm4
+    vpxor ymm1, ymm1, ymm5
+    vmovdqu xmm4, [RSI + R11 + 0x200]
+    vinserti128 ymm4, ymm4, [RSI + R11 + 0x280], 1
+    vmovdqu xmm5, [RDX + R11 + 0x200]
+    vinserti128 ymm5, ymm5, [RDX + R11 + 0x280], 1
+    vpxor ymm2, ymm2, ymm4
+    vpxor ymm2, ymm2, ymm5
+    vmovdqu xmm4, [RSI + R11 + 0x300]
+    vinserti128 ymm4, ymm4, [RSI + R11 + 0x380], 1
+    vmovdqu xmm5, [RDX + R11 + 0x300]
+    vinserti128 ymm5, ymm5, [RDX + R11 + 0x380], 1
+    vpxor ymm3, ymm3, ymm4
+    vpxor ymm3, ymm3, ymm5
+
+    test ECX, ECX
+    jz .store
+
+    vmovdqu xmm4, [RDI + R11 + 0x000]
+    vinserti128 ymm4, ymm4, [RDI + R11 + 0x080], 1
+    vpxor ymm0, ymm0, ymm4
+    vmovdqu xmm4, [RDI + R11 + 0x100]
+    vinserti128 ymm4, ymm4, [RDI + R11 + 0x180], 1
+    vpxor ymm1, ymm1, ymm4
+    vmovdqu xmm4, [RDI + R11 + 0x200]
+    vinserti128 ymm4, ymm4, [RDI + R11 + 0x280], 1
+    vpxor ymm2, ymm2, ymm4
+    vmovdqu xmm4, [RDI + R11 + 0x300]
+    vinserti128 ymm4, ymm4, [RDI + R11 + 0x380], 1
+    vpxor ymm3, ymm3, ymm4
+
+.store:
+    vmovdqu [RDI + R11 + 0x000], xmm0
+    vextracti128 [RDI + R11 + 0x080], ymm0, 1
+    vmovdqu [RDI + R11 + 0x100], xmm1
+    vextracti128 [RDI + R11 + 0x180], ymm1, 1
+    vmovdqu [RDI + R11 + 0x200], xmm2
+    vextracti128 [RDI + R11 + 0x280], ymm2, 1
+    vmovdqu [RDI + R11 + 0x300], xmm3
+    vextracti128 [RDI + R11 + 0x380], ymm3, 1
+
+    add R11, 0x10
+    cmp R11, 0x80
+    jne .columns
+
+    add RSP, 0x440
+
+    vzeroupper
+    ret
@@ -0,0 +1,146 @@
+/*===-- blake2b.c ----------------------*- shared/unix/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2b.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2B_DIGEST  (bits(512))
+#define BLAKE2B_BLOCK   (bits(1024))
+#define BLAKE2B_KEY_MAX (bits(512))
+
+/* Compresses one block into the chaining value. The "tf" array holds the two
+ * counter words followed by the two finalization flags, in the order in which
+ * they are mixed into the working state. This is also used by BLAKE2bp. */
+ORDO_HIDDEN void blake2b_compress(uint64_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint64_t * RESTRICT tf)
+HOT_CODE;
+
+/* Compresses one block with AVX2, with each row of the working state held in
+ * a YMM register. The IV is passed in to keep the assembly free of data. */
+extern void blake2b_compress_ASM(uint64_t * RESTRICT h,
+                                 const void * RESTRICT block,
+                                 const uint64_t * RESTRICT tf,
+                                 const uint64_t * RESTRICT iv);
+
+static const uint64_t blake2b_iv[8] =
+{
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b),
+    UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
+    UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
+    UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)
+};
+
+#ifdef OPAQUE
+struct BLAKE2B_STATE
+{
+    uint64_t h[8];
+    uint64_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2b_init(struct BLAKE2B_STATE *state,
+                 const struct BLAKE2B_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+
+    if (key_len > BLAKE2B_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    memcpy(state->h, blake2b_iv, sizeof(blake2b_iv));
+
+    /* The parameter block, for sequential hashing with a full digest. */
+    state->h[0] ^= UINT64_C(0x01010000) | (key_len << 8) | BLAKE2B_DIGEST;
+
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    /* A key is hashed as a first, zero-padded, message block. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2B_BLOCK);
+        memcpy(state->block, params->key, key_len);
+        state->block_len = BLAKE2B_BLOCK;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2b_update(struct BLAKE2B_STATE *state,
+                    const void *buffer, size_t len)
+{
+    uint64_t tf[4] = { 0, 0, 0, 0 };
+
+    if (!len) return;
+
+    /* The last block must be compressed with the final flag set, so a block
+     * is only compressed once it is known that more data follows it. */
+
+    if (state->block_len + len > BLAKE2B_BLOCK)
+    {
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(BLAKE2B_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->msg_len += BLAKE2B_BLOCK;
+            tf[0] = state->msg_len;
+            blake2b_compress(state->h, state->block, tf);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        while (len > BLAKE2B_BLOCK)
+        {
+            state->msg_len += BLAKE2B_BLOCK;
+            tf[0] = state->msg_len;
+            blake2b_compress(state->h, buffer, tf);
+
+            buffer = offset(buffer, BLAKE2B_BLOCK);
+            len -= BLAKE2B_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2b_final(struct BLAKE2B_STATE *state,
+                   void *digest)
+{
+    uint64_t tf[4] = { 0, 0, 0, 0 };
+    size_t t;
+
+    memset(offset(state->block, state->block_len), 0,
+           (size_t)(BLAKE2B_BLOCK - state->block_len));
+
+    state->msg_len += state->block_len;
+    tf[0] = state->msg_len;
+    tf[2] = ~UINT64_C(0);
+    blake2b_compress(state->h, state->block, tf);
+
+    for (t = 0; t < 8; ++t)
+        state->h[t] = tole64(state->h[t]);
+
+    memcpy(digest, state->h, BLAKE2B_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void blake2b_compress(uint64_t * RESTRICT h,
+                      const void * RESTRICT block,
+                      const uint64_t * RESTRICT tf)
+{
+    /* This handles unaligned input blocks just fine. */
+    blake2b_compress_ASM(h, block, tf, blake2b_iv);
+}
@@ -0,0 +1,1765 @@
+;/===-- blake2bp.asm -----------------*- shared/unix/amd64/avx2 -*- ASM -*-===*/
+
+; BLAKE2bp stripe compression for AMD64 with AVX2
+;
+; Compresses one block into each of the 4 leaves at once, with one leaf
+; per lane: each of the sixteen words of the working state has its own
+; YMM register, so the G functions need no shuffling at all. The stripe
+; is first transposed into lanes on the stack, and a working register
+; is spilled whenever a rotation needs a scratch register.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global blake2bp_stripe_ASM:function hidden
+
+section .text
+
+blake2bp_stripe_ASM:
+    sub RSP, 0x260
+
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x200], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x208], RAX
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x210], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x218], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x220], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x228], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x230], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x238], RAX
+
+    ; transpose the stripe so that m[i] holds word i of every leaf
+    vmovdqu ymm0, [RSI + 0x000]
+    vmovdqu ymm1, [RSI + 0x080]
+    vmovdqu ymm2, [RSI + 0x100]
+    vmovdqu ymm3, [RSI + 0x180]
+    vpunpcklqdq ymm4, ymm0, ymm1
+    vpunpckhqdq ymm5, ymm0, ymm1
+    vpunpcklqdq ymm6, ymm2, ymm3
+    vpunpckhqdq ymm7, ymm2, ymm3
+    vperm2i128 ymm8, ymm4, ymm6, 0x20
+    vperm2i128 ymm9, ymm5, ymm7, 0x20
+    vperm2i128 ymm10, ymm4, ymm6, 0x31
+    vperm2i128 ymm11, ymm5, ymm7, 0x31
+    vmovdqu [RSP + 0x000], ymm8
+    vmovdqu [RSP + 0x020], ymm9
+    vmovdqu [RSP + 0x040], ymm10
+    vmovdqu [RSP + 0x060], ymm11
+
+    vmovdqu ymm0, [RSI + 0x020]
+    vmovdqu ymm1, [RSI + 0x0A0]
+    vmovdqu ymm2, [RSI + 0x120]
+    vmovdqu ymm3, [RSI + 0x1A0]
+    vpunpcklqdq ymm4, ymm0, ymm1
+    vpunpckhqdq ymm5, ymm0, ymm1
+    vpunpcklqdq ymm6, ymm2, ymm3
+    vpunpckhqdq ymm7, ymm2, ymm3
+    vperm2i128 ymm8, ymm4, ymm6, 0x20
+    vperm2i128 ymm9, ymm5, ymm7, 0x20
+    vperm2i128 ymm10, ymm4, ymm6, 0x31
+    vperm2i128 ymm11, ymm5, ymm7, 0x31
+    vmovdqu [RSP + 0x080], ymm8
+    vmovdqu [RSP + 0x0A0], ymm9
+    vmovdqu [RSP + 0x0C0], ymm10
+    vmovdqu [RSP + 0x0E0], ymm11
+
+    vmovdqu ymm0, [RSI + 0x040]
+    vmovdqu ymm1, [RSI + 0x0C0]
+    vmovdqu ymm2, [RSI + 0x140]
+    vmovdqu ymm3, [RSI + 0x1C0]
+    vpunpcklqdq ymm4, ymm0, ymm1
+    vpunpckhqdq ymm5, ymm0, ymm1
+    vpunpcklqdq ymm6, ymm2, ymm3
+    vpunpckhqdq ymm7, ymm2, ymm3
+    vperm2i128 ymm8, ymm4, ymm6, 0x20
+    vperm2i128 ymm9, ymm5, ymm7, 0x20
+    vperm2i128 ymm10, ymm4, ymm6, 0x31
+    vperm2i128 ymm11, ymm5, ymm7, 0x31
+    vmovdqu [RSP + 0x100], ymm8
+    vmovdqu [RSP + 0x120], ymm9
+    vmovdqu [RSP + 0x140], ymm10
+    vmovdqu [RSP + 0x160], ymm11
+
+    vmovdqu ymm0, [RSI + 0x060]
+    vmovdqu ymm1, [RSI + 0x0E0]
+    vmovdqu ymm2, [RSI + 0x160]
+    vmovdqu ymm3, [RSI + 0x1E0]
+    vpunpcklqdq ymm4, ymm0, ymm1
+    vpunpckhqdq ymm5, ymm0, ymm1
+    vpunpcklqdq ymm6, ymm2, ymm3
+    vpunpckhqdq ymm7, ymm2, ymm3
+    vperm2i128 ymm8, ymm4, ymm6, 0x20
+    vperm2i128 ymm9, ymm5, ymm7, 0x20
+    vperm2i128 ymm10, ymm4, ymm6, 0x31
+    vperm2i128 ymm11, ymm5, ymm7, 0x31
+    vmovdqu [RSP + 0x180], ymm8
+    vmovdqu [RSP + 0x1A0], ymm9
+    vmovdqu [RSP + 0x1C0], ymm10
+    vmovdqu [RSP + 0x1E0], ymm11
+
+    ; the working state, one word of every leaf per register
+    vmovq xmm12, RDX
+    vpbroadcastq ymm12, xmm12
+    vpbroadcastq ymm13, [RCX + 0x20]
+    vpxor ymm12, ymm12, ymm13
+    vpbroadcastq ymm13, [RCX + 0x28]
+    vpbroadcastq ymm14, [RCX + 0x30]
+    vpbroadcastq ymm15, [RCX + 0x38]
+    vpbroadcastq ymm8, [RCX + 0x00]
+    vpbroadcastq ymm9, [RCX + 0x08]
+    vpbroadcastq ymm10, [RCX + 0x10]
+    vpbroadcastq ymm11, [RCX + 0x18]
+    vmovdqu ymm0, [RDI + 0x000]
+    vmovdqu ymm1, [RDI + 0x020]
+    vmovdqu ymm2, [RDI + 0x040]
+    vmovdqu ymm3, [RDI + 0x060]
+    vmovdqu ymm4, [RDI + 0x080]
+    vmovdqu ymm5, [RDI + 0x0A0]
+    vmovdqu ymm6, [RDI + 0x0C0]
+    vmovdqu ymm7, [RDI + 0x0E0]
+
+    ; round 0
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x000]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x040]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x080]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x020]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x060]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x0A0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x100]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x140]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x180]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x120]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x160]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x1A0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 1
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x1C0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x080]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x120]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x140]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x100]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x1E0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x020]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x000]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x160]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x0A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x180]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x040]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x0E0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x060]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 2
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x160]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x180]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x0A0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x100]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x000]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x040]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x140]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x060]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x0E0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x120]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x1C0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0C0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x020]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x080]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 3
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x0E0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x060]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x1A0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x160]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x120]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x020]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x180]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x040]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0A0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x080]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x0C0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x140]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x000]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 4
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x120]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x0A0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x040]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x140]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x000]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x0E0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x080]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x1C0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x160]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x0C0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x060]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x020]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x180]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x100]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 5
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x040]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x0C0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x000]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x180]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x140]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x160]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x060]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x080]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0E0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x1E0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x020]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x1A0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0A0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x1C0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x120]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 6
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x180]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x020]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x1C0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x080]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x0A0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x1E0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x1A0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x140]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x000]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0C0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x120]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x0E0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x060]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x040]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x160]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 7
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x1A0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x0E0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x180]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x060]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x160]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x1C0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x020]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x120]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x0A0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x1E0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x100]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x040]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x000]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x080]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x0C0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x140]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 8
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x0C0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x1C0]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x160]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x000]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x1E0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x120]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x060]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x100]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x180]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x1A0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x020]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x140]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x040]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x0E0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x080]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x0A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 9
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x140]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x100]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x0E0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x020]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x040]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x080]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x0C0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x1E0]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x120]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x060]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x160]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x1C0]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x180]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x000]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 10
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x000]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x040]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x080]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x020]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x060]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x0A0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0E0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x100]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x140]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x180]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1C0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x120]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x160]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x1A0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x1E0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    ; round 11
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x1C0]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x080]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x120]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x1A0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpshufd ymm15, ymm15, 0xB1
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm4
+    vpaddq ymm0, ymm0, [RSP + 0x140]
+    vpaddq ymm1, ymm1, ymm5
+    vpaddq ymm1, ymm1, [RSP + 0x100]
+    vpaddq ymm2, ymm2, ymm6
+    vpaddq ymm2, ymm2, [RSP + 0x1E0]
+    vpaddq ymm3, ymm3, ymm7
+    vpaddq ymm3, ymm3, [RSP + 0x0C0]
+    vpxor ymm12, ymm12, ymm0
+    vpxor ymm13, ymm13, ymm1
+    vpxor ymm14, ymm14, ymm2
+    vpxor ymm15, ymm15, ymm3
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpaddq ymm8, ymm8, ymm12
+    vpaddq ymm9, ymm9, ymm13
+    vpaddq ymm10, ymm10, ymm14
+    vpaddq ymm11, ymm11, ymm15
+    vpxor ymm4, ymm4, ymm8
+    vpxor ymm5, ymm5, ymm9
+    vpxor ymm6, ymm6, ymm10
+    vpxor ymm7, ymm7, ymm11
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x020]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x000]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x160]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x0A0]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufd ymm15, ymm15, 0xB1
+    vpshufd ymm12, ymm12, 0xB1
+    vpshufd ymm13, ymm13, 0xB1
+    vpshufd ymm14, ymm14, 0xB1
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vpshufb ymm5, ymm5, [RSP + 0x200]
+    vpshufb ymm6, ymm6, [RSP + 0x200]
+    vpshufb ymm7, ymm7, [RSP + 0x200]
+    vpshufb ymm4, ymm4, [RSP + 0x200]
+    vpaddq ymm0, ymm0, ymm5
+    vpaddq ymm0, ymm0, [RSP + 0x180]
+    vpaddq ymm1, ymm1, ymm6
+    vpaddq ymm1, ymm1, [RSP + 0x040]
+    vpaddq ymm2, ymm2, ymm7
+    vpaddq ymm2, ymm2, [RSP + 0x0E0]
+    vpaddq ymm3, ymm3, ymm4
+    vpaddq ymm3, ymm3, [RSP + 0x060]
+    vpxor ymm15, ymm15, ymm0
+    vpxor ymm12, ymm12, ymm1
+    vpxor ymm13, ymm13, ymm2
+    vpxor ymm14, ymm14, ymm3
+    vpshufb ymm15, ymm15, [RSP + 0x220]
+    vpshufb ymm12, ymm12, [RSP + 0x220]
+    vpshufb ymm13, ymm13, [RSP + 0x220]
+    vpshufb ymm14, ymm14, [RSP + 0x220]
+    vpaddq ymm10, ymm10, ymm15
+    vpaddq ymm11, ymm11, ymm12
+    vpaddq ymm8, ymm8, ymm13
+    vpaddq ymm9, ymm9, ymm14
+    vpxor ymm5, ymm5, ymm10
+    vpxor ymm6, ymm6, ymm11
+    vpxor ymm7, ymm7, ymm8
+    vpxor ymm4, ymm4, ymm9
+    vmovdqu [RSP + 0x240], ymm8
+    vpsrlq ymm8, ymm5, 63
+    vpaddq ymm5, ymm5, ymm5
+    vpor ymm5, ymm5, ymm8
+    vpsrlq ymm8, ymm6, 63
+    vpaddq ymm6, ymm6, ymm6
+    vpor ymm6, ymm6, ymm8
+    vpsrlq ymm8, ymm7, 63
+    vpaddq ymm7, ymm7, ymm7
+    vpor ymm7, ymm7, ymm8
+    vpsrlq ymm8, ymm4, 63
+    vpaddq ymm4, ymm4, ymm4
+    vpor ymm4, ymm4, ymm8
+    vmovdqu ymm8, [RSP + 0x240]
+
+    vpxor ymm0, ymm0, ymm8
+    vpxor ymm0, ymm0, [RDI + 0x000]
+    vmovdqu [RDI + 0x000], ymm0
+    vpxor ymm1, ymm1, ymm9
+    vpxor ymm1, ymm1, [RDI + 0x020]
+    vmovdqu [RDI + 0x020], ymm1
+    vpxor ymm2, ymm2, ymm10
+    vpxor ymm2, ymm2, [RDI + 0x040]
+    vmovdqu [RDI + 0x040], ymm2
+    vpxor ymm3, ymm3, ymm11
+    vpxor ymm3, ymm3, [RDI + 0x060]
+    vmovdqu [RDI + 0x060], ymm3
+    vpxor ymm4, ymm4, ymm12
+    vpxor ymm4, ymm4, [RDI + 0x080]
+    vmovdqu [RDI + 0x080], ymm4
+    vpxor ymm5, ymm5, ymm13
+    vpxor ymm5, ymm5, [RDI + 0x0A0]
+    vmovdqu [RDI + 0x0A0], ymm5
+    vpxor ymm6, ymm6, ymm14
+    vpxor ymm6, ymm6, [RDI + 0x0C0]
+    vmovdqu [RDI + 0x0C0], ymm6
+    vpxor ymm7, ymm7, ymm15
+    vpxor ymm7, ymm7, [RDI + 0x0E0]
+    vmovdqu [RDI + 0x0E0], ymm7
+
+    add RSP, 0x260
+
+    vzeroupper
+    ret
@@ -0,0 +1,219 @@
+/*===-- blake3_compress.c --------------*- shared/unix/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE3_BLOCK (bits(512))
+
+/* Compresses one block into a chaining value, producing the full 16 words of
+ * output, of which the first 8 are the new chaining value, and all are needed
+ * for extendable output. The "block" need not be aligned. */
+ORDO_HIDDEN void blake3_compress(const uint32_t cv[8],
+                                 const void *block,
+                                 uint32_t block_len,
+                                 uint64_t counter,
+                                 uint32_t flags,
+                                 uint32_t out[16])
+HOT_CODE;
+
+/* Hashes "count" inputs of "blocks" whole blocks each, "stride" bytes apart,
+ * into as many little-endian chaining values. The counter is incremented for
+ * each input if "increment" is set, and the first and last blocks of every
+ * input respectively get the extra "flags_start" and "flags_end" flags. The
+ * output may overlap the input, provided that each chaining value is written
+ * no further than the start of the input it comes from. */
+ORDO_HIDDEN void blake3_hash_many(const void *input,
+                                  size_t stride,
+                                  size_t count,
+                                  size_t blocks,
+                                  const uint32_t key[8],
+                                  uint64_t counter,
+                                  int increment,
+                                  uint32_t flags,
+                                  uint32_t flags_start,
+                                  uint32_t flags_end,
+                                  void *out)
+HOT_CODE;
+
+/* Hashes eight inputs at once with AVX2, one per lane. The chaining values
+ * are transposed, word by word, and the parameter block holds the per-lane
+ * counters (low then high words), the block count, the three flags words,
+ * the block length, and (at word 24) the first half of the IV. */
+extern void blake3_hash8_ASM(uint32_t *cv,
+                             const void *input,
+                             size_t stride,
+                             const uint32_t *param);
+
+static const uint32_t blake3_iv[4] =
+{
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A
+};
+
+/* The message word permutation, applied once per round, precomputed. */
+static const unsigned char blake3_schedule[7][16] =
+{
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+    {  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+    {  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+    { 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+    { 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+    {  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+    { 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 }
+};
+
+/*===----------------------------------------------------------------------===*/
+
+#define G(r, i, a, b, c, d)                                                  \
+    do {                                                                     \
+        a += b + m[blake3_schedule[r][2 * i + 0]];                           \
+        d = ror32(d ^ a, 16);                                                \
+        c += d;                                                              \
+        b = ror32(b ^ c, 12);                                                \
+        a += b + m[blake3_schedule[r][2 * i + 1]];                           \
+        d = ror32(d ^ a,  8);                                                \
+        c += d;                                                              \
+        b = ror32(b ^ c,  7);                                                \
+    } while (0)
+
+void blake3_compress(const uint32_t cv[8],
+                     const void *block,
+                     uint32_t block_len,
+                     uint64_t counter,
+                     uint32_t flags,
+                     uint32_t out[16])
+{
+    uint32_t m[16], v[16];
+    size_t t;
+
+    memcpy(m, block, BLAKE3_BLOCK);
+
+    for (t = 0; t < 16; ++t) m[t] = fmle32(m[t]);
+
+    for (t = 0; t < 8; ++t) v[t] = cv[t];
+    for (t = 0; t < 4; ++t) v[t + 8] = blake3_iv[t];
+
+    v[12] = (uint32_t)counter;
+    v[13] = (uint32_t)(counter >> 32);
+    v[14] = block_len;
+    v[15] = flags;
+
+    for (t = 0; t < 7; ++t)
+    {
+        G(t, 0, v[ 0], v[ 4], v[ 8], v[12]);
+        G(t, 1, v[ 1], v[ 5], v[ 9], v[13]);
+        G(t, 2, v[ 2], v[ 6], v[10], v[14]);
+        G(t, 3, v[ 3], v[ 7], v[11], v[15]);
+        G(t, 4, v[ 0], v[ 5], v[10], v[15]);
+        G(t, 5, v[ 1], v[ 6], v[11], v[12]);
+        G(t, 6, v[ 2], v[ 7], v[ 8], v[13]);
+        G(t, 7, v[ 3], v[ 4], v[ 9], v[14]);
+    }
+
+    for (t = 0; t < 8; ++t)
+    {
+        out[t + 8] = v[t + 8] ^ cv[t];
+        out[t + 0] = v[t + 0] ^ v[t + 8];
+    }
+}
+
+/* Hashes a single input of "blocks" whole blocks, see blake3_hash_many(). */
+static void hash_one(const void *input,
+                     size_t blocks,
+                     const uint32_t key[8],
+                     uint64_t counter,
+                     uint32_t flags,
+                     uint32_t flags_start,
+                     uint32_t flags_end,
+                     void *out)
+{
+    uint32_t cv[8], words[16];
+    size_t b, t;
+
+    memcpy(cv, key, sizeof(cv));
+
+    for (b = 0; b < blocks; ++b)
+    {
+        uint32_t f = flags;
+
+        if (b == 0)          f |= flags_start;
+        if (b == blocks - 1) f |= flags_end;
+
+        blake3_compress(cv, offset(input, b * BLAKE3_BLOCK),
+                        BLAKE3_BLOCK, counter, f, words);
+
+        memcpy(cv, words, sizeof(cv));
+    }
+
+    for (t = 0; t < 8; ++t) cv[t] = tole32(cv[t]);
+
+    memcpy(out, cv, sizeof(cv));
+}
+
+void blake3_hash_many(const void *input,
+                      size_t stride,
+                      size_t count,
+                      size_t blocks,
+                      const uint32_t key[8],
+                      uint64_t counter,
+                      int increment,
+                      uint32_t flags,
+                      uint32_t flags_start,
+                      uint32_t flags_end,
+                      void *out)
+{
+    size_t t, i;
+
+    while (count >= 8)
+    {
+        uint32_t cv[8][8], param[28];
+
+        for (i = 0; i < 8; ++i)
+            for (t = 0; t < 8; ++t) cv[i][t] = key[i];
+
+        for (t = 0; t < 8; ++t)
+        {
+            uint64_t lane = counter + (increment ? t : 0);
+
+            param[t + 0] = (uint32_t)lane;
+            param[t + 8] = (uint32_t)(lane >> 32);
+        }
+
+        param[16] = (uint32_t)blocks;
+        param[17] = flags;
+        param[18] = flags_start;
+        param[19] = flags_end;
+        param[20] = BLAKE3_BLOCK;
+
+        for (t = 0; t < 4; ++t) param[t + 24] = blake3_iv[t];
+
+        /* This handles unaligned inputs just fine. */
+        blake3_hash8_ASM(&cv[0][0], input, stride, param);
+
+        for (t = 0; t < 8; ++t)
+        {
+            uint32_t words[8];
+
+            for (i = 0; i < 8; ++i) words[i] = cv[i][t];
+
+            memcpy(offset(out, t * bits(256)), words, sizeof(words));
+        }
+
+        input = offset(input, 8 * stride);
+        out = offset(out, 8 * bits(256));
+        count -= 8;
+
+        if (increment) counter += 8;
+    }
+
+    for (t = 0; t < count; ++t)
+    {
+        hash_one(offset(input, t * stride), blocks, key,
+                 counter, flags, flags_start, flags_end,
+                 offset(out, t * bits(256)));
+
+        if (increment) ++counter;
+    }
+}
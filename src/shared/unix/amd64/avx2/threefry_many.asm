@@ -0,0 +1,277 @@
+;/===-- threefry_many.asm ------------*- shared/unix/amd64/avx2 -*- ASM -*-===*/
+
+; Threefry-4x64 for AMD64 with AVX2
+;
+; Computes Threefry-4x64 for four consecutive counters at a time, with
+; word i of each of the four blocks in register YMMi, so that every
+; round is done on all four blocks at once. There is no AVX2 rotation
+; on 64-bit words, so rotations by whole bytes are done with pshufb and
+; the others with two shifts. The first counter of each group and the
+; other (fixed) counter words have the first subkey added in advance,
+; and the blocks are transposed back into place before being stored.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global threefry_many_ASM:function hidden
+
+section .text
+
+threefry_many_ASM:
+    sub RSP, 0x60
+
+    mov RAX, 0x0504030201000706
+    mov [RSP + 0x000], RAX
+    mov RAX, 0x0D0C0B0A09080F0E
+    mov [RSP + 0x008], RAX
+    mov RAX, 0x0504030201000706
+    mov [RSP + 0x010], RAX
+    mov RAX, 0x0D0C0B0A09080F0E
+    mov [RSP + 0x018], RAX
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x020], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x028], RAX
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x030], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x038], RAX
+
+    vmovdqu ymm4, [RSP + 0x00]
+    vmovdqu ymm5, [RSP + 0x20]
+
+    mov qword [RSP + 0x40], 0
+    mov qword [RSP + 0x48], 1
+    mov qword [RSP + 0x50], 2
+    mov qword [RSP + 0x58], 3
+
+    mov R10, [RDX + 0x00]
+    add R10, [RSI + 0x00]
+    vmovq xmm7, R10
+    vpbroadcastq ymm7, xmm7
+    vpaddq ymm7, ymm7, [RSP + 0x40]
+
+    mov R10, 4
+    vmovq xmm8, R10
+    vpbroadcastq ymm8, xmm8
+
+    mov R10, [RDX + 0x08]
+    add R10, [RSI + 0x08]
+    vmovq xmm9, R10
+    vpbroadcastq ymm9, xmm9
+
+    mov R10, [RDX + 0x10]
+    add R10, [RSI + 0x10]
+    vmovq xmm10, R10
+    vpbroadcastq ymm10, xmm10
+
+    mov R10, [RDX + 0x18]
+    add R10, [RSI + 0x18]
+    vmovq xmm11, R10
+    vpbroadcastq ymm11, xmm11
+
+.block:
+    vmovdqa ymm0, ymm7
+    vmovdqa ymm1, ymm9
+    vmovdqa ymm2, ymm10
+    vmovdqa ymm3, ymm11
+
+    lea R10, [RSI + 0x20]
+    mov R11D, R8D
+    shr R11D, 3
+
+.eight:
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 14
+    vpsrlq ymm1, ymm1, 50
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpshufb ymm3, ymm3, ymm4
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpsllq ymm6, ymm3, 52
+    vpsrlq ymm3, ymm3, 12
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpsllq ymm6, ymm1, 57
+    vpsrlq ymm1, ymm1, 7
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm2
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 23
+    vpsrlq ymm1, ymm1, 41
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpshufb ymm3, ymm3, ymm5
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpsllq ymm6, ymm3, 5
+    vpsrlq ymm3, ymm3, 59
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpsllq ymm6, ymm1, 37
+    vpsrlq ymm1, ymm1, 27
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm2
+
+    vpbroadcastq ymm6, [R10 + 0x00]
+    vpaddq ymm0, ymm0, ymm6
+    vpbroadcastq ymm6, [R10 + 0x08]
+    vpaddq ymm1, ymm1, ymm6
+    vpbroadcastq ymm6, [R10 + 0x10]
+    vpaddq ymm2, ymm2, ymm6
+    vpbroadcastq ymm6, [R10 + 0x18]
+    vpaddq ymm3, ymm3, ymm6
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 25
+    vpsrlq ymm1, ymm1, 39
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpsllq ymm6, ymm3, 33
+    vpsrlq ymm3, ymm3, 31
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpsllq ymm6, ymm3, 46
+    vpsrlq ymm3, ymm3, 18
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpsllq ymm6, ymm1, 12
+    vpsrlq ymm1, ymm1, 52
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm2
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 58
+    vpsrlq ymm1, ymm1, 6
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpsllq ymm6, ymm3, 22
+    vpsrlq ymm3, ymm3, 42
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpshufd ymm3, ymm3, 0xB1
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpshufd ymm1, ymm1, 0xB1
+    vpxor ymm1, ymm1, ymm2
+
+    vpbroadcastq ymm6, [R10 + 0x20]
+    vpaddq ymm0, ymm0, ymm6
+    vpbroadcastq ymm6, [R10 + 0x28]
+    vpaddq ymm1, ymm1, ymm6
+    vpbroadcastq ymm6, [R10 + 0x30]
+    vpaddq ymm2, ymm2, ymm6
+    vpbroadcastq ymm6, [R10 + 0x38]
+    vpaddq ymm3, ymm3, ymm6
+
+    add R10, 0x40
+    dec R11D
+    jnz .eight
+
+    test R8D, 4
+    jz .odd
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 14
+    vpsrlq ymm1, ymm1, 50
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpshufb ymm3, ymm3, ymm4
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpsllq ymm6, ymm3, 52
+    vpsrlq ymm3, ymm3, 12
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpsllq ymm6, ymm1, 57
+    vpsrlq ymm1, ymm1, 7
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm2
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 23
+    vpsrlq ymm1, ymm1, 41
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpshufb ymm3, ymm3, ymm5
+    vpxor ymm3, ymm3, ymm2
+
+    vpaddq ymm0, ymm0, ymm3
+    vpsllq ymm6, ymm3, 5
+    vpsrlq ymm3, ymm3, 59
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpaddq ymm2, ymm2, ymm1
+    vpsllq ymm6, ymm1, 37
+    vpsrlq ymm1, ymm1, 27
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm2
+
+    vpbroadcastq ymm6, [R10 + 0x00]
+    vpaddq ymm0, ymm0, ymm6
+    vpbroadcastq ymm6, [R10 + 0x08]
+    vpaddq ymm1, ymm1, ymm6
+    vpbroadcastq ymm6, [R10 + 0x10]
+    vpaddq ymm2, ymm2, ymm6
+    vpbroadcastq ymm6, [R10 + 0x18]
+    vpaddq ymm3, ymm3, ymm6
+
+.odd:
+    test R8D, 1
+    jz .store
+
+    vpaddq ymm0, ymm0, ymm1
+    vpsllq ymm6, ymm1, 25
+    vpsrlq ymm1, ymm1, 39
+    vpor ymm1, ymm1, ymm6
+    vpxor ymm1, ymm1, ymm0
+    vpaddq ymm2, ymm2, ymm3
+    vpsllq ymm6, ymm3, 33
+    vpsrlq ymm3, ymm3, 31
+    vpor ymm3, ymm3, ymm6
+    vpxor ymm3, ymm3, ymm2
+
+.store:
+    vpunpcklqdq ymm6, ymm0, ymm1
+    vpunpckhqdq ymm1, ymm0, ymm1
+    vpunpcklqdq ymm0, ymm2, ymm3
+    vpunpckhqdq ymm3, ymm2, ymm3
+
+    vperm2i128 ymm2, ymm6, ymm0, 0x20
+    vmovdqu [RDI + 0x00], ymm2
+    vperm2i128 ymm2, ymm1, ymm3, 0x20
+    vmovdqu [RDI + 0x20], ymm2
+    vperm2i128 ymm2, ymm6, ymm0, 0x31
+    vmovdqu [RDI + 0x40], ymm2
+    vperm2i128 ymm2, ymm1, ymm3, 0x31
+    vmovdqu [RDI + 0x60], ymm2
+
+    vpaddq ymm7, ymm7, ymm8
+    add RDI, 0x80
+    dec RCX
+    jnz .block
+
+    add RSP, 0x60
+
+    vzeroupper
+    ret
@@ -9,6 +9,13 @@
 
 /*===----------------------------------------------------------------------===*/
 
+/* See edwards25519.c. */
+ORDO_HIDDEN void edwards25519_base_u(uint8_t *u, const uint8_t *scalar,
+                                     size_t count);
+
+/* The largest number of scalar multiplications done by curve25519_many. */
+#define CURVE25519_BATCH (16)
+
 typedef uint8_t u8;
 typedef uint64_t felem;
 
@@ -34,12 +41,30 @@ static void curve25519_donna(u8 *mypublic, const u8 *secret,
                              const u8 *basepoint)
 HOT_CODE;
 
+/* See curve25519.asm, these need BMI2 and ADX. */
+extern int fe64_adx_ASM(void);
+extern void fe64_mul_ASM(uint64_t *out, const uint64_t *a, const uint64_t *b);
+extern void fe64_sqr_ASM(uint64_t *out, const uint64_t *a);
+extern void fe64_mul121666_ASM(uint64_t *out, const uint64_t *a);
+extern void fe64_add_ASM(uint64_t *out, const uint64_t *a, const uint64_t *b);
+extern void fe64_sub_ASM(uint64_t *out, const uint64_t *a, const uint64_t *b);
+static void fe64_invert(uint64_t *out, const uint64_t *z)
+HOT_CODE;
+static void curve25519_ladder(uint64_t *x, uint64_t *z, const u8 *secret,
+                              const u8 *basepoint)
+HOT_CODE;
+static void curve25519_adx(u8 *out, const u8 *secret, const u8 *point,
+                           size_t count)
+HOT_CODE;
+static void curve25519_many(u8 *out, const u8 *secret, const u8 *point,
+                            size_t count);
+
 /*===----------------------------------------------------------------------===*/
 
 int curve25519_gen(void *priv)
 {
     int err = os_secure_random(priv, bits(256));
-    if (!err) return err;
+    if (err) return err;
     *((uint8_t *)priv +  0) &= 248;
     *((uint8_t *)priv + 31) &= 127;
     *((uint8_t *)priv + 31) |=  64;
@@ -48,13 +73,294 @@ int curve25519_gen(void *priv)
 
 void curve25519_pub(void *pub, const void *priv)
 {
-    static const uint8_t basepoint[32] = { 9 };
-    curve25519_donna(pub, priv, basepoint);
+    edwards25519_base_u(pub, priv, 1);
 }
 
 void curve25519_ecdh(void *shared, const void *priv, const void *other)
 {
-    curve25519_donna(shared, priv, other);
+    curve25519_many(shared, priv, other, 1);
+}
+
+void curve25519_pub_batch(void *pub, const void *priv, size_t count)
+{
+    edwards25519_base_u(pub, priv, count);
+}
+
+void curve25519_ecdh_batch(void *shared, const void *priv,
+                           const void *other, size_t count)
+{
+    while (count)
+    {
+        size_t n = smin(count, CURVE25519_BATCH);
+
+        curve25519_many(shared, priv, other, n);
+
+        shared = offset(shared, bits(256) * n);
+        priv = offset(priv, bits(256) * n);
+        other = offset(other, bits(256) * n);
+        count -= n;
+    }
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* Whether the processor has BMI2 and ADX, or -1 if not yet known. This is a
+ * benign race, as every thread would store the same value anyway. */
+static int has_adx = -1;
+
+/* Only the ADX code shares the inversions, the fallback being one call to
+ * curve25519_donna per scalar multiplication. */
+void curve25519_many(u8 *out, const u8 *secret, const u8 *point,
+                     size_t count)
+{
+    size_t t;
+
+    if (has_adx < 0) has_adx = fe64_adx_ASM();
+
+    if (has_adx)
+        curve25519_adx(out, secret, point, count);
+    else
+        for (t = 0; t < count; ++t)
+            curve25519_donna(out + 32 * t, secret + 32 * t, point + 32 * t);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+/* The ladder below works on field elements of four 64-bit words, kept in
+ * [0, 2^256) by the assembly, and only fully reduced on output. It follows
+ * RFC 7748 over all 256 bits of the scalar, as cmult does. */
+
+static void fe64_load(uint64_t *out, const u8 *in)
+{
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        memcpy(out + t, in + 8 * t, 8);
+        out[t] = fmle64(out[t]);
+    }
+
+    out[3] &= 0x7fffffffffffffffULL;
+}
+
+/* Adds a small value to "x", returning the carry out of the last word. */
+static uint64_t fe64_carry(uint64_t *x, uint64_t c)
+{
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        x[t] += c;
+        c = (x[t] < c);
+    }
+
+    return c;
+}
+
+static void fe64_store(u8 *out, const uint64_t *in)
+{
+    uint64_t x[4], y[4], mask;
+    size_t t;
+
+    memcpy(x, in, sizeof(x));
+
+    /* Fold bit 255 twice, so that x < 2^255, then subtract p if x >= p,
+     * that is, if x + 19 has bit 255 set. */
+    for (t = 0; t < 2; ++t)
+    {
+        uint64_t top = x[3] >> 63;
+        x[3] &= 0x7fffffffffffffffULL;
+        fe64_carry(x, 19 * top);
+    }
+
+    memcpy(y, x, sizeof(y));
+    fe64_carry(y, 19);
+
+    mask = 0 - (y[3] >> 63);
+    y[3] &= 0x7fffffffffffffffULL;
+
+    for (t = 0; t < 4; ++t)
+    {
+        x[t] ^= mask & (x[t] ^ y[t]);
+        x[t] = tole64(x[t]);
+        memcpy(out + 8 * t, x + t, 8);
+    }
+}
+
+static void fe64_cswap(uint64_t *a, uint64_t *b, uint64_t swap)
+{
+    uint64_t mask = 0 - swap;
+    size_t t;
+
+    for (t = 0; t < 4; ++t)
+    {
+        uint64_t x = mask & (a[t] ^ b[t]);
+        a[t] ^= x;
+        b[t] ^= x;
+    }
+}
+
+static void fe64_sqr_n(uint64_t *out, const uint64_t *in, int n)
+{
+    fe64_sqr_ASM(out, in);
+    while (--n) fe64_sqr_ASM(out, out);
+}
+
+/* The same addition chain as crecip, for z^(p - 2). */
+void fe64_invert(uint64_t *out, const uint64_t *z)
+{
+    uint64_t z2[4], z9[4], z11[4], z2_5_0[4], z2_10_0[4], z2_20_0[4];
+    uint64_t z2_50_0[4], z2_100_0[4], t0[4], t1[4];
+
+    fe64_sqr_ASM(z2, z);
+    fe64_sqr_n(t0, z2, 2);
+    fe64_mul_ASM(z9, t0, z);
+    fe64_mul_ASM(z11, z9, z2);
+    fe64_sqr_ASM(t0, z11);
+    fe64_mul_ASM(z2_5_0, t0, z9);
+
+    fe64_sqr_n(t0, z2_5_0, 5);
+    fe64_mul_ASM(z2_10_0, t0, z2_5_0);
+    fe64_sqr_n(t0, z2_10_0, 10);
+    fe64_mul_ASM(z2_20_0, t0, z2_10_0);
+    fe64_sqr_n(t0, z2_20_0, 20);
+    fe64_mul_ASM(t1, t0, z2_20_0);
+    fe64_sqr_n(t0, t1, 10);
+    fe64_mul_ASM(z2_50_0, t0, z2_10_0);
+    fe64_sqr_n(t0, z2_50_0, 50);
+    fe64_mul_ASM(z2_100_0, t0, z2_50_0);
+    fe64_sqr_n(t0, z2_100_0, 100);
+    fe64_mul_ASM(t1, t0, z2_100_0);
+    fe64_sqr_n(t0, t1, 50);
+    fe64_mul_ASM(t1, t0, z2_50_0);
+    fe64_sqr_n(t0, t1, 5);
+    fe64_mul_ASM(out, t0, z11);
+}
+
+void curve25519_ladder(uint64_t *x, uint64_t *z, const u8 *secret,
+                       const u8 *basepoint)
+{
+    uint64_t x1[4], x2[4] = {1}, z2[4] = {0}, x3[4], z3[4] = {1};
+    uint64_t a[4], aa[4], b[4], bb[4], e[4], c[4], d[4];
+    uint64_t swap = 0;
+    int t;
+
+    fe64_load(x1, basepoint);
+    memcpy(x3, x1, sizeof(x3));
+
+    for (t = 255; t >= 0; --t)
+    {
+        uint64_t bit = (secret[t / 8] >> (t % 8)) & 1;
+
+        swap ^= bit;
+        fe64_cswap(x2, x3, swap);
+        fe64_cswap(z2, z3, swap);
+        swap = bit;
+
+        fe64_add_ASM(a, x2, z2);
+        fe64_sub_ASM(b, x2, z2);
+        fe64_add_ASM(c, x3, z3);
+        fe64_sub_ASM(d, x3, z3);
+        fe64_sqr_ASM(aa, a);
+        fe64_sqr_ASM(bb, b);
+        fe64_mul_ASM(d, d, a);               /* DA */
+        fe64_mul_ASM(c, c, b);               /* CB */
+        fe64_sub_ASM(e, aa, bb);
+
+        fe64_add_ASM(x3, d, c);
+        fe64_sqr_ASM(x3, x3);
+        fe64_sub_ASM(z3, d, c);
+        fe64_sqr_ASM(z3, z3);
+        fe64_mul_ASM(z3, z3, x1);
+
+        fe64_mul_ASM(x2, aa, bb);
+        fe64_mul121666_ASM(z2, e);
+        fe64_add_ASM(z2, z2, bb);
+        fe64_mul_ASM(z2, z2, e);
+    }
+
+    fe64_cswap(x2, x3, swap);
+    fe64_cswap(z2, z3, swap);
+
+    memcpy(x, x2, sizeof(x2));
+    memcpy(z, z2, sizeof(z2));
+
+    memset(x2, 0, sizeof(x2));
+    memset(z2, 0, sizeof(z2));
+    memset(x3, 0, sizeof(x3));
+    memset(z3, 0, sizeof(z3));
+}
+
+/* A point of small order gives z = 0, which would make the product of all
+ * the z coordinates zero, so z is replaced by 1 and x by 0, which leaves the
+ * result at 0, as it would be with the inverse of 0. */
+static void fe64_zero_fixup(uint64_t *x, uint64_t *z)
+{
+    uint64_t mask;
+    unsigned int acc = 0;
+    u8 bytes[32];
+    size_t t;
+
+    fe64_store(bytes, z);
+    for (t = 0; t < 32; ++t) acc |= bytes[t];
+    mask = 0 - (uint64_t)(((acc - 1) >> 8) & 1);
+
+    for (t = 0; t < 4; ++t)
+    {
+        z[t] ^= mask & (z[t] ^ (t == 0));
+        x[t] &= ~mask;
+    }
+
+    memset(bytes, 0, sizeof(bytes));
+}
+
+/* Computes "count" scalar multiplications, at most CURVE25519_BATCH, with
+ * a single inversion by Montgomery's trick: the product of all the z is
+ * inverted, and each inverse is then recovered with two multiplications,
+ * working back from the last one, acc[i] being the product of the z before
+ * the i-th. */
+void curve25519_adx(u8 *out, const u8 *secret, const u8 *point,
+                    size_t count)
+{
+    uint64_t x[CURVE25519_BATCH][4], z[CURVE25519_BATCH][4];
+    uint64_t acc[CURVE25519_BATCH][4], prod[4], inv[4], t[4];
+    size_t i;
+
+    if (!count) return;
+
+    for (i = 0; i < count; ++i)
+    {
+        curve25519_ladder(x[i], z[i], secret + 32 * i, point + 32 * i);
+        fe64_zero_fixup(x[i], z[i]);
+
+        if (i)
+        {
+            memcpy(acc[i], prod, sizeof(prod));
+            fe64_mul_ASM(prod, prod, z[i]);
+        }
+        else
+            memcpy(prod, z[0], sizeof(prod));
+    }
+
+    fe64_invert(inv, prod);
+
+    for (i = count - 1; i > 0; --i)
+    {
+        fe64_mul_ASM(t, inv, acc[i]);
+        fe64_mul_ASM(inv, inv, z[i]);
+        fe64_mul_ASM(t, t, x[i]);
+        fe64_store(out + 32 * i, t);
+    }
+
+    fe64_mul_ASM(t, inv, x[0]);
+    fe64_store(out, t);
+
+    memset(x, 0, sizeof(x));
+    memset(z, 0, sizeof(z));
+    memset(acc, 0, sizeof(acc));
+    memset(prod, 0, sizeof(prod));
+    memset(inv, 0, sizeof(inv));
+    memset(t, 0, sizeof(t));
 }
 
 /*===----------------------------------------------------------------------===*/
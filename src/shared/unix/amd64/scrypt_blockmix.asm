@@ -0,0 +1,632 @@
+;/===-- scrypt_blockmix.asm ---------------*- shared/unix/amd64 -*- ASM -*-===*/
+
+; scrypt BlockMix with Salsa20/8 for AMD64 with SSE2
+;
+; Each row of the Salsa20 state, in the diagonal order, is held in one
+; XMM register, so that the four quarter-rounds of a column or row step
+; run side by side, the row steps being done by rotating the rows. SSE2
+; has no rotations, so each one is two shifts and two XORs. The blocks
+; of "with", when it is not nil, are XORed in as the input is read, by
+; a second copy of the loop.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global scrypt_blockmix_ASM:function hidden
+
+section .text
+
+scrypt_blockmix_ASM:
+    mov R11, RCX
+    shl R11, 6
+    lea R10, [RDX + R11]
+    lea RAX, [RDI + 2 * R11 - 0x40]
+
+    ; X starts out as the last block
+    movdqu xmm0, [RAX + 0x00]
+    movdqu xmm1, [RAX + 0x10]
+    movdqu xmm2, [RAX + 0x20]
+    movdqu xmm3, [RAX + 0x30]
+
+    test RSI, RSI
+    jz .start
+
+    lea RAX, [RSI + 2 * R11 - 0x40]
+    movdqu xmm4, [RAX + 0x00]
+    pxor xmm0, xmm4
+    movdqu xmm5, [RAX + 0x10]
+    pxor xmm1, xmm5
+    movdqu xmm6, [RAX + 0x20]
+    pxor xmm2, xmm6
+    movdqu xmm7, [RAX + 0x30]
+    pxor xmm3, xmm7
+    shr R11, 5
+
+.with:
+    movdqu xmm4, [RDI + 0x00]
+    pxor xmm0, xmm4
+    movdqu xmm5, [RDI + 0x10]
+    pxor xmm1, xmm5
+    movdqu xmm6, [RDI + 0x20]
+    pxor xmm2, xmm6
+    movdqu xmm7, [RDI + 0x30]
+    pxor xmm3, xmm7
+    movdqu xmm4, [RSI + 0x00]
+    pxor xmm0, xmm4
+    movdqu xmm5, [RSI + 0x10]
+    pxor xmm1, xmm5
+    movdqu xmm6, [RSI + 0x20]
+    pxor xmm2, xmm6
+    movdqu xmm7, [RSI + 0x30]
+    pxor xmm3, xmm7
+    movdqa xmm4, xmm0
+    movdqa xmm5, xmm1
+    movdqa xmm6, xmm2
+    movdqa xmm7, xmm3
+
+    ; double round 0
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 1
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 2
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 3
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm4
+    paddd xmm1, xmm5
+    paddd xmm2, xmm6
+    paddd xmm3, xmm7
+    movdqu [RDX + 0x00], xmm0
+    movdqu [RDX + 0x10], xmm1
+    movdqu [RDX + 0x20], xmm2
+    movdqu [RDX + 0x30], xmm3
+
+    ; the even and odd blocks go to either half of the output
+    add RDX, 0x40
+    xchg RDX, R10
+    add RDI, 0x40
+    add RSI, 0x40
+    dec R11
+    jnz .with
+    jmp .done
+
+.start:
+    shr R11, 5
+
+.plain:
+    movdqu xmm4, [RDI + 0x00]
+    pxor xmm0, xmm4
+    movdqu xmm5, [RDI + 0x10]
+    pxor xmm1, xmm5
+    movdqu xmm6, [RDI + 0x20]
+    pxor xmm2, xmm6
+    movdqu xmm7, [RDI + 0x30]
+    pxor xmm3, xmm7
+    movdqa xmm4, xmm0
+    movdqa xmm5, xmm1
+    movdqa xmm6, xmm2
+    movdqa xmm7, xmm3
+
+    ; double round 0
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 1
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 2
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    ; double round 3
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x93
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x39
+    movdqa xmm8, xmm0
+    paddd xmm8, xmm1
+    movdqa xmm9, xmm8
+    pslld xmm8, 7
+    psrld xmm9, 25
+    pxor xmm3, xmm8
+    pxor xmm3, xmm9
+    movdqa xmm8, xmm3
+    paddd xmm8, xmm0
+    movdqa xmm9, xmm8
+    pslld xmm8, 9
+    psrld xmm9, 23
+    pxor xmm2, xmm8
+    pxor xmm2, xmm9
+    movdqa xmm8, xmm2
+    paddd xmm8, xmm3
+    movdqa xmm9, xmm8
+    pslld xmm8, 13
+    psrld xmm9, 19
+    pxor xmm1, xmm8
+    pxor xmm1, xmm9
+    movdqa xmm8, xmm1
+    paddd xmm8, xmm2
+    movdqa xmm9, xmm8
+    pslld xmm8, 18
+    psrld xmm9, 14
+    pxor xmm0, xmm8
+    pxor xmm0, xmm9
+    pshufd xmm1, xmm1, 0x39
+    pshufd xmm2, xmm2, 0x4E
+    pshufd xmm3, xmm3, 0x93
+
+    paddd xmm0, xmm4
+    paddd xmm1, xmm5
+    paddd xmm2, xmm6
+    paddd xmm3, xmm7
+    movdqu [RDX + 0x00], xmm0
+    movdqu [RDX + 0x10], xmm1
+    movdqu [RDX + 0x20], xmm2
+    movdqu [RDX + 0x30], xmm3
+
+    ; the even and odd blocks go to either half of the output
+    add RDX, 0x40
+    xchg RDX, R10
+    add RDI, 0x40
+    dec R11
+    jnz .plain
+
+.done:
+    ret
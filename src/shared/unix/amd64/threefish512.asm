@@ -0,0 +1,356 @@
+;/===-- threefish512.asm ------------------*- shared/unix/amd64 -*- ASM -*-===*/
+
+; Threefish-512 implementation for AMD64
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global threefish512_forward_ASM:function hidden
+global threefish512_inverse_ASM:function hidden
+
+section .text
+
+threefish512_forward_ASM:
+    push R12
+    push R13
+    push R14
+    push R15
+
+    xor RAX, RAX
+
+    mov  R8, [RDI + 0x00]
+    mov  R9, [RDI + 0x08]
+    mov R10, [RDI + 0x10]
+    mov R11, [RDI + 0x18]
+    mov R12, [RDI + 0x20]
+    mov R13, [RDI + 0x28]
+    mov R14, [RDI + 0x30]
+    mov R15, [RDI + 0x38]
+
+    add  R8, [RSI + 0x00]
+    add  R9, [RSI + 0x08]
+    add R10, [RSI + 0x10]
+    add R11, [RSI + 0x18]
+    add R12, [RSI + 0x20]
+    add R13, [RSI + 0x28]
+    add R14, [RSI + 0x30]
+    add R15, [RSI + 0x38]
+
+    .loopf:
+        add  R8,  R9
+        rol  R9,   46
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   36
+        xor R11, R10
+        add R12, R13
+        rol R13,   19
+        xor R13, R12
+        add R14, R15
+        rol R15,   37
+        xor R15, R14
+
+        add R10,  R9
+        rol  R9,   33
+        xor  R9, R10
+        add R12, R15
+        rol R15,   27
+        xor R15, R12
+        add R14, R13
+        rol R13,   14
+        xor R13, R14
+        add  R8, R11
+        rol R11,   42
+        xor R11,  R8
+
+        add R12,  R9
+        rol  R9,   17
+        xor  R9, R12
+        add R14, R11
+        rol R11,   49
+        xor R11, R14
+        add  R8, R13
+        rol R13,   36
+        xor R13,  R8
+        add R10, R15
+        rol R15,   39
+        xor R15, R10
+
+        add R14,  R9
+        rol  R9,   44
+        xor  R9, R14
+        add  R8, R15
+        rol R15,    9
+        xor R15,  R8
+        add R10, R13
+        rol R13,   54
+        xor R13, R10
+        add R12, R11
+        rol R11,   56
+        xor R11, R12
+
+        add  R8, [RSI + 0x40 + 0x00]
+        add  R9, [RSI + 0x40 + 0x08]
+        add R10, [RSI + 0x40 + 0x10]
+        add R11, [RSI + 0x40 + 0x18]
+        add R12, [RSI + 0x40 + 0x20]
+        add R13, [RSI + 0x40 + 0x28]
+        add R14, [RSI + 0x40 + 0x30]
+        add R15, [RSI + 0x40 + 0x38]
+
+        add  R8,  R9
+        rol  R9,   39
+        xor  R9,  R8
+        add R10, R11
+        rol R11,   30
+        xor R11, R10
+        add R12, R13
+        rol R13,   34
+        xor R13, R12
+        add R14, R15
+        rol R15,   24
+        xor R15, R14
+
+        add R10,  R9
+        rol  R9,   13
+        xor  R9, R10
+        add R12, R15
+        rol R15,   50
+        xor R15, R12
+        add R14, R13
+        rol R13,   10
+        xor R13, R14
+        add  R8, R11
+        rol R11,   17
+        xor R11,  R8
+
+        add R12,  R9
+        rol  R9,   25
+        xor  R9, R12
+        add R14, R11
+        rol R11,   29
+        xor R11, R14
+        add  R8, R13
+        rol R13,   39
+        xor R13,  R8
+        add R10, R15
+        rol R15,   43
+        xor R15, R10
+
+        add R14,  R9
+        rol  R9,    8
+        xor  R9, R14
+        add  R8, R15
+        rol R15,   35
+        xor R15,  R8
+        add R10, R13
+        rol R13,   56
+        xor R13, R10
+        add R12, R11
+        rol R11,   22
+        xor R11, R12
+
+        add  R8, [RSI + 0x80 + 0x00]
+        add  R9, [RSI + 0x80 + 0x08]
+        add R10, [RSI + 0x80 + 0x10]
+        add R11, [RSI + 0x80 + 0x18]
+        add R12, [RSI + 0x80 + 0x20]
+        add R13, [RSI + 0x80 + 0x28]
+        add R14, [RSI + 0x80 + 0x30]
+        add R15, [RSI + 0x80 + 0x38]
+
+        add RSI, 0x80
+
+        inc RAX
+        cmp RAX, 9
+        jne .loopf
+
+    mov [RDI + 0x00],  R8
+    mov [RDI + 0x08],  R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+    mov [RDI + 0x20], R12
+    mov [RDI + 0x28], R13
+    mov [RDI + 0x30], R14
+    mov [RDI + 0x38], R15
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+
+    ret
+
+threefish512_inverse_ASM:
+    push R12
+    push R13
+    push R14
+    push R15
+
+    xor RAX, RAX
+
+    add RSI, 0x480
+
+    mov  R8, [RDI + 0x00]
+    mov  R9, [RDI + 0x08]
+    mov R10, [RDI + 0x10]
+    mov R11, [RDI + 0x18]
+    mov R12, [RDI + 0x20]
+    mov R13, [RDI + 0x28]
+    mov R14, [RDI + 0x30]
+    mov R15, [RDI + 0x38]
+
+    .loopi:
+        sub  R8, [RSI + 0x00]
+        sub  R9, [RSI + 0x08]
+        sub R10, [RSI + 0x10]
+        sub R11, [RSI + 0x18]
+        sub R12, [RSI + 0x20]
+        sub R13, [RSI + 0x28]
+        sub R14, [RSI + 0x30]
+        sub R15, [RSI + 0x38]
+
+        xor  R9, R14
+        ror  R9,    8
+        sub R14,  R9
+        xor R15,  R8
+        ror R15,   35
+        sub  R8, R15
+        xor R13, R10
+        ror R13,   56
+        sub R10, R13
+        xor R11, R12
+        ror R11,   22
+        sub R12, R11
+
+        xor  R9, R12
+        ror  R9,   25
+        sub R12,  R9
+        xor R11, R14
+        ror R11,   29
+        sub R14, R11
+        xor R13,  R8
+        ror R13,   39
+        sub  R8, R13
+        xor R15, R10
+        ror R15,   43
+        sub R10, R15
+
+        xor  R9, R10
+        ror  R9,   13
+        sub R10,  R9
+        xor R15, R12
+        ror R15,   50
+        sub R12, R15
+        xor R13, R14
+        ror R13,   10
+        sub R14, R13
+        xor R11,  R8
+        ror R11,   17
+        sub  R8, R11
+
+        xor  R9,  R8
+        ror  R9,   39
+        sub  R8,  R9
+        xor R11, R10
+        ror R11,   30
+        sub R10, R11
+        xor R13, R12
+        ror R13,   34
+        sub R12, R13
+        xor R15, R14
+        ror R15,   24
+        sub R14, R15
+
+        sub  R8, [RSI - 0x40 + 0x00]
+        sub  R9, [RSI - 0x40 + 0x08]
+        sub R10, [RSI - 0x40 + 0x10]
+        sub R11, [RSI - 0x40 + 0x18]
+        sub R12, [RSI - 0x40 + 0x20]
+        sub R13, [RSI - 0x40 + 0x28]
+        sub R14, [RSI - 0x40 + 0x30]
+        sub R15, [RSI - 0x40 + 0x38]
+
+        xor  R9, R14
+        ror  R9,   44
+        sub R14,  R9
+        xor R15,  R8
+        ror R15,    9
+        sub  R8, R15
+        xor R13, R10
+        ror R13,   54
+        sub R10, R13
+        xor R11, R12
+        ror R11,   56
+        sub R12, R11
+
+        xor  R9, R12
+        ror  R9,   17
+        sub R12,  R9
+        xor R11, R14
+        ror R11,   49
+        sub R14, R11
+        xor R13,  R8
+        ror R13,   36
+        sub  R8, R13
+        xor R15, R10
+        ror R15,   39
+        sub R10, R15
+
+        xor  R9, R10
+        ror  R9,   33
+        sub R10,  R9
+        xor R15, R12
+        ror R15,   27
+        sub R12, R15
+        xor R13, R14
+        ror R13,   14
+        sub R14, R13
+        xor R11,  R8
+        ror R11,   42
+        sub  R8, R11
+
+        xor  R9,  R8
+        ror  R9,   46
+        sub  R8,  R9
+        xor R11, R10
+        ror R11,   36
+        sub R10, R11
+        xor R13, R12
+        ror R13,   19
+        sub R12, R13
+        xor R15, R14
+        ror R15,   37
+        sub R14, R15
+
+        sub RSI, 0x80
+
+        inc RAX
+        cmp RAX, 9
+        jne .loopi
+
+    sub  R8, [RSI + 0x00]
+    sub  R9, [RSI + 0x08]
+    sub R10, [RSI + 0x10]
+    sub R11, [RSI + 0x18]
+    sub R12, [RSI + 0x20]
+    sub R13, [RSI + 0x28]
+    sub R14, [RSI + 0x30]
+    sub R15, [RSI + 0x38]
+
+    mov [RDI + 0x00],  R8
+    mov [RDI + 0x08],  R9
+    mov [RDI + 0x10], R10
+    mov [RDI + 0x18], R11
+    mov [RDI + 0x20], R12
+    mov [RDI + 0x28], R13
+    mov [RDI + 0x30], R14
+    mov [RDI + 0x38], R15
+
+    pop R15
+    pop R14
+    pop R13
+    pop R12
+
+    ret
@@ -0,0 +1,101 @@
+/*===-- threefish512.c ----------------------*- shared/unix/amd64 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/block_ciphers/threefish512.h"
+
+/*===----------------------------------------------------------------------===*/
+
+static void threefish512_key_schedule(const uint64_t *key,
+                                      const uint64_t *tweak,
+                                      uint64_t * RESTRICT subkeys)
+HOT_CODE;
+
+/* These only do 64-bit loads and stores, which need not be aligned, so they
+ * work on the caller's block in place. */
+extern void threefish512_forward_ASM(uint64_t * RESTRICT block,
+                                     const uint64_t * RESTRICT subkeys);
+
+extern void threefish512_inverse_ASM(uint64_t * RESTRICT block,
+                                     const uint64_t * RESTRICT subkeys);
+
+#ifdef OPAQUE
+struct THREEFISH512_STATE
+{
+    uint64_t subkey[19 * 8];
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int threefish512_init(struct THREEFISH512_STATE *state,
+                      const void *key, size_t key_len,
+                      const struct THREEFISH512_PARAMS *params)
+{
+    uint64_t data[8];
+
+    if (!limit_check(key_len, bits(512), bits(512), 1))
+        return ORDO_KEY_LEN;
+
+    memcpy(data, key, sizeof(data));
+    threefish512_key_schedule(data, (params == 0) ? 0 : params->tweak,
+                              state->subkey);
+
+    return ORDO_SUCCESS;
+}
+
+void threefish512_forward(const struct THREEFISH512_STATE *state,
+                          void *block)
+{
+    threefish512_forward_ASM(block, state->subkey);
+}
+
+void threefish512_inverse(const struct THREEFISH512_STATE *state,
+                          void *block)
+{
+    threefish512_inverse_ASM(block, state->subkey);
+}
+
+void threefish512_final(struct THREEFISH512_STATE *state)
+{
+    return;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+#define K_S (UINT64_C(0x1BD11BDAA9FC1A22))
+
+void threefish512_key_schedule(const uint64_t *key,
+                               const uint64_t *tweak,
+                               uint64_t * RESTRICT subkeys)
+{
+    uint64_t tweak_w[3];
+    uint64_t key_w[9];
+    size_t n, i;
+
+    key_w[8] = K_S;
+
+    for (i = 0; i < 8; ++i)
+    {
+        key_w[i] = tole64(key[i]);
+        key_w[8] ^= key_w[i];
+    }
+
+    tweak_w[0] = (tweak ? tole64(tweak[0]) : 0);
+    tweak_w[1] = (tweak ? tole64(tweak[1]) : 0);
+    tweak_w[2] = tweak_w[0] ^ tweak_w[1];
+
+    /* Subkey n uses key words n to n + 7 (mod 9), with the tweak words added
+     * to its last three words and the subkey index added to the last one. */
+    for (n = 0; n < 19; ++n)
+    {
+        for (i = 0; i < 8; ++i)
+            subkeys[n * 8 + i] = key_w[(n + i) % 9];
+
+        subkeys[n * 8 + 5] += tweak_w[n % 3];
+        subkeys[n * 8 + 6] += tweak_w[(n + 1) % 3];
+        subkeys[n * 8 + 7] += n;
+    }
+}
@@ -5,7 +5,6 @@
 /** @endcond **/
 
 #include "ordo/primitives/hash_functions/skein256.h"
-#include "ordo/primitives/block_ciphers/threefish256.h"
 
 /*===----------------------------------------------------------------------===*/
 
@@ -13,6 +12,7 @@
 #define SKEIN256_BLOCK    (bits(256))
 
 /* Some UBI block type constants. */
+#define SKEIN_UBI_KEY 0
 #define SKEIN_UBI_CFG 4
 #define SKEIN_UBI_MSG 48
 #define SKEIN_UBI_OUT 63
@@ -26,18 +26,27 @@ static const uint64_t skein256_iv[4] =
 };
 
 /* Note this assumes "first" and "final" are boolean (0 or 1). The result is a
- * UBI-compliant tweak, however with a message length only up to 2^64 bits. */
+ * UBI-compliant tweak (in native byte order), however with a message length
+ * only up to 2^64 bits. */
 static void make_tweak(uint64_t tweak[2],
                        uint64_t type,
                        uint64_t position,
                        uint64_t first,
                        uint64_t final) HOT_CODE;
 
-static void skein256_compress(const uint64_t * RESTRICT block,
-                              uint64_t * RESTRICT state,
+/* See skein256_ubi.c. */
+ORDO_HIDDEN void skein256_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
                               uint64_t * RESTRICT tweak)
 HOT_CODE;
 
+/* Processes a key through UBI, from a zero chaining value. This is also used
+ * by the tree hashing module. */
+ORDO_HIDDEN void skein256_key(uint64_t state[4],
+                              const void *key,
+                              size_t key_len);
+
 #ifdef OPAQUE
 struct SKEIN256_STATE
 {
@@ -64,8 +73,14 @@ int skein256_init(struct SKEIN256_STATE *state,
         if (bits(params->out_len) != SKEIN256_INTERNAL)
             return ORDO_ARG;
 
-        /* Generate the initial state from the configuration block. */
-        memset(state->state, 0, SKEIN256_BLOCK);
+        /* Tree hashing is handled by skein256_tree_init(). */
+        if (params->tree_leaf || params->tree_fan || params->tree_max)
+            return ORDO_ARG;
+
+        /* Generate the initial state from the key, if any, followed by the
+         * configuration block. */
+        skein256_key(state->state, params->key, params->key_len);
+
         memcpy((unsigned char *)state->block + 0,
                &params->schema, sizeof(params->schema));
         memcpy((unsigned char *)state->block + 4,
@@ -75,10 +90,11 @@ int skein256_init(struct SKEIN256_STATE *state,
         len_tmp = tole64(params->out_len);
         memcpy((unsigned char *)state->block + 8,
                &len_tmp, sizeof(len_tmp));
-        memcpy((unsigned char *)state->block + 16,
+        memset((unsigned char *)state->block + 16, 0, 3);
+        memcpy((unsigned char *)state->block + 19,
                &params->unused, sizeof(params->unused));
         make_tweak(tweak, SKEIN_UBI_CFG, SKEIN256_BLOCK, 1, 1);
-        skein256_compress(state->block, state->state, tweak);
+        skein256_ubi(state->state, state->block, 1, tweak);
     }
     else
     {
@@ -102,40 +118,45 @@ void skein256_update(struct SKEIN256_STATE *state,
 
     if (state->block_len + len > SKEIN256_BLOCK)
     {
-        size_t pad = (size_t)(SKEIN256_BLOCK - state->block_len);
         uint64_t tweak[2];
 
-        memcpy(offset(state->block, state->block_len), buffer, pad);
-        state->msg_len += pad;
+        /* A partial (or held back) block must be completed first. */
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SKEIN256_BLOCK - state->block_len);
 
-        make_tweak(tweak,
-                   SKEIN_UBI_MSG,
-                   state->msg_len,
-                   state->msg_len <= SKEIN256_BLOCK,
-                   0); /* can't be the last block */
+            memcpy(offset(state->block, state->block_len), buffer, pad);
 
-        skein256_compress(state->block, state->state, tweak);
-        state->block_len = 0;
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       state->msg_len + SKEIN256_BLOCK,
+                       state->msg_len == 0,
+                       0); /* can't be the last block */
 
-        buffer = offset(buffer, pad);
-        len -= pad;
+            skein256_ubi(state->state, state->block, 1, tweak);
+            state->msg_len += SKEIN256_BLOCK;
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
 
         /* Do NOT process the final block. */
-        while (len > SKEIN256_BLOCK)
+        if (len > SKEIN256_BLOCK)
         {
-            memcpy(state->block, buffer, SKEIN256_BLOCK);
-            state->msg_len += SKEIN256_BLOCK;
+            size_t count = (len - 1) / SKEIN256_BLOCK;
 
             make_tweak(tweak,
                        SKEIN_UBI_MSG,
-                       state->msg_len,
-                       state->msg_len <= SKEIN256_BLOCK,
+                       state->msg_len + SKEIN256_BLOCK,
+                       state->msg_len == 0,
                        0);
 
-            skein256_compress(state->block, state->state, tweak);
+            skein256_ubi(state->state, buffer, count, tweak);
+            state->msg_len += count * SKEIN256_BLOCK;
 
-            buffer = offset(buffer, SKEIN256_BLOCK);
-            len -= SKEIN256_BLOCK;
+            buffer = offset(buffer, count * SKEIN256_BLOCK);
+            len -= count * SKEIN256_BLOCK;
         }
     }
 
@@ -163,7 +184,7 @@ void skein256_final(struct SKEIN256_STATE *state,
                state->msg_len <= SKEIN256_BLOCK,
                1); /* this'll be the last block */
 
-    skein256_compress(state->block, state->state, tweak);
+    skein256_ubi(state->state, state->block, 1, tweak);
 
     {
         uint64_t out[4];
@@ -179,37 +200,43 @@ void skein256_final(struct SKEIN256_STATE *state,
         out[3] = state->state[3];
 
         make_tweak(tweak, SKEIN_UBI_OUT, sizeof(uint64_t), 1, 1);
-        skein256_compress(state->block, out, tweak);
+        skein256_ubi(out, state->block, 1, tweak);
         memcpy(digest, out, SKEIN256_BLOCK);
     }
 }
 
 /*===----------------------------------------------------------------------===*/
 
+void skein256_key(uint64_t state[4],
+                  const void *key,
+                  size_t key_len)
+{
+    memset(state, 0, SKEIN256_INTERNAL);
+
+    if (key_len)
+    {
+        size_t count = (key_len - 1) / SKEIN256_BLOCK;
+        uint64_t block[4] = {0};
+        uint64_t tweak[2];
+
+        make_tweak(tweak, SKEIN_UBI_KEY, SKEIN256_BLOCK, 1, 0);
+        skein256_ubi(state, key, count, tweak);
+
+        /* The last block is zero-padded, and may well be the first. */
+        memcpy(block, offset(key, count * SKEIN256_BLOCK),
+               key_len - count * SKEIN256_BLOCK);
+        tweak[0] = key_len;
+        tweak[1] |= UINT64_C(1) << 63;
+        skein256_ubi(state, block, 1, tweak);
+    }
+}
+
 void make_tweak(uint64_t tweak[2],
                 uint64_t type,
                 uint64_t position,
                 uint64_t first,
                 uint64_t final)
 {
-    tweak[0] = tole64(position);
-    tweak[1] = tole64((final << 63) | (first << 62) | (type  << 56));
-}
-
-void skein256_compress(const uint64_t * RESTRICT block,
-                       uint64_t * RESTRICT state,
-                       uint64_t * RESTRICT tweak)
-{
-    struct THREEFISH256_PARAMS params;
-    struct THREEFISH256_STATE cipher;
-    params.tweak[0] = tweak[0];
-    params.tweak[1] = tweak[1];
-
-    threefish256_init(&cipher, state, SKEIN256_INTERNAL, &params);
-
-    memcpy(state, block, SKEIN256_INTERNAL);
-    threefish256_forward(&cipher, state);
-    threefish256_final(&cipher);
-
-    xor_buffer(state, block, SKEIN256_INTERNAL);
+    tweak[0] = position;
+    tweak[1] = (final << 63) | (first << 62) | (type  << 56);
 }
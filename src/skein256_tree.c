@@ -0,0 +1,429 @@
+/*===-- skein256_tree.c -------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/skein256.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define SKEIN256_BLOCK    (bits(256))
+
+/* Some UBI block type constants. */
+#define SKEIN_UBI_CFG 4
+#define SKEIN_UBI_MSG 48
+#define SKEIN_UBI_OUT 63
+
+/* The maximum number of leaves hashed per batch, and the minimum amount of
+ * input in a batch for it to be worth spreading over multiple threads. The
+ * threads are kept between batches, so this is low enough for the buffers of
+ * ordinary streaming reads to be spread, given leaves smaller than them. */
+#define SKEIN256_TREE_BATCH    256
+#define SKEIN256_TREE_PARALLEL (32 * 1024)
+
+/* See skein256_ubi.c and skein256.c, these are provided by the Skein-256
+ * module. */
+ORDO_HIDDEN void skein256_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak);
+
+ORDO_HIDDEN void skein256_key(uint64_t state[4],
+                              const void *key,
+                              size_t key_len);
+
+/* As in skein256.c, but with a tree level (with 0 outside of tree hashing),
+ * which goes in bits 112 to 118 of the tweak. */
+static void make_tweak(uint64_t tweak[2],
+                       uint64_t type,
+                       uint64_t level,
+                       uint64_t position,
+                       uint64_t first,
+                       uint64_t final);
+
+/* There is one node per tree level above the leaves, which holds the chain
+ * of the node currently being built at that level. The last child received
+ * is held back until it is known whether it is the last of its node, as it
+ * then needs the "final" flag, or even the last of the whole tree. As leaves
+ * are at least two blocks long and nodes have at least two children, there
+ * can be no more than 64 levels for inputs shorter than 2^64 bytes. */
+#ifdef OPAQUE
+struct SKEIN256_TREE_NODE
+{
+    uint64_t state[4];
+    uint64_t block[4];
+    uint64_t children;
+    uint64_t total;
+};
+
+struct SKEIN256_TREE_STATE
+{
+    uint64_t iv[4];
+    uint64_t leaf[4];
+    uint64_t block[4];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t leaf_count;
+    uint64_t leaf_exp;
+    uint64_t fan_exp;
+    uint64_t max_height;
+    struct SKEIN256_TREE_NODE node[64];
+};
+#endif
+
+struct LEAF_BATCH
+{
+    const uint64_t *iv;
+    const void *buffer;
+    size_t leaf_size;
+    uint64_t start;
+    uint64_t (*out)[4];
+};
+
+/*===----------------------------------------------------------------------===*/
+
+/* Hashes a complete leaf of "len" bytes in one go, "start" being its offset
+ * in the message. Leaves always contain at least two blocks. */
+static void hash_leaf(const uint64_t iv[4],
+                      const void *leaf, size_t len,
+                      uint64_t start, uint64_t out[4])
+{
+    uint64_t tweak[2];
+
+    memcpy(out, iv, SKEIN256_BLOCK);
+
+    make_tweak(tweak, SKEIN_UBI_MSG, 1, start + SKEIN256_BLOCK, 1, 0);
+    skein256_ubi(out, leaf, len / SKEIN256_BLOCK - 1, tweak);
+
+    tweak[1] |= UINT64_C(1) << 63; /* this'll be the last block */
+    skein256_ubi(out, offset(leaf, len - SKEIN256_BLOCK), 1, tweak);
+}
+
+static void leaf_job(void *ctx, size_t index)
+{
+    const struct LEAF_BATCH *batch = (const struct LEAF_BATCH *)ctx;
+
+    hash_leaf(batch->iv,
+              offset(batch->buffer, index * batch->leaf_size),
+              batch->leaf_size,
+              batch->start + (uint64_t)index * batch->leaf_size,
+              batch->out[index]);
+}
+
+/* Feeds a child's output into the node at index "k" (so at tree level k + 2)
+ * and carries completed nodes up the tree. */
+static void push_node(struct SKEIN256_TREE_STATE *state,
+                      size_t k, const uint64_t digest[4])
+{
+    uint64_t child[4];
+
+    memcpy(child, digest, SKEIN256_BLOCK);
+
+    while (1)
+    {
+        struct SKEIN256_TREE_NODE *node = state->node + k;
+        uint64_t level = k + 2;
+
+        if (node->total)
+        {
+            uint64_t tweak[2];
+
+            /* The top level is never split into nodes. */
+            int full = (level < state->max_height)
+                    && (state->fan_exp < 64)
+                    && (node->children >> state->fan_exp);
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       level,
+                       node->total * SKEIN256_BLOCK,
+                       node->children == 1,
+                       full);
+
+            skein256_ubi(node->state, node->block, 1, tweak);
+
+            if (full)
+            {
+                uint64_t out[4];
+
+                memcpy(out, node->state, SKEIN256_BLOCK);
+                memcpy(node->state, state->iv, SKEIN256_BLOCK);
+                memcpy(node->block, child, SKEIN256_BLOCK);
+                node->children = 1;
+                ++node->total;
+
+                memcpy(child, out, SKEIN256_BLOCK);
+                ++k;
+                continue;
+            }
+        }
+        else
+            memcpy(node->state, state->iv, SKEIN256_BLOCK);
+
+        memcpy(node->block, child, SKEIN256_BLOCK);
+        ++node->children;
+        ++node->total;
+
+        return;
+    }
+}
+
+/* Feeds data into the current leaf, which must have room for all of it. */
+static void feed_leaf(struct SKEIN256_TREE_STATE *state,
+                      const void *buffer, size_t len)
+{
+    uint64_t start = state->leaf_count << state->leaf_exp;
+    start *= SKEIN256_BLOCK;
+
+    if (state->block_len + len > SKEIN256_BLOCK)
+    {
+        uint64_t done = state->leaf_len - state->block_len;
+        uint64_t tweak[2];
+
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SKEIN256_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       1,
+                       start + done + SKEIN256_BLOCK,
+                       done == 0,
+                       0);
+
+            skein256_ubi(state->leaf, state->block, 1, tweak);
+            state->leaf_len += pad;
+            state->block_len = 0;
+            done += SKEIN256_BLOCK;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        /* Do NOT process the final block. */
+        if (len > SKEIN256_BLOCK)
+        {
+            size_t count = (len - 1) / SKEIN256_BLOCK;
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       1,
+                       start + done + SKEIN256_BLOCK,
+                       done == 0,
+                       0);
+
+            skein256_ubi(state->leaf, buffer, count, tweak);
+            state->leaf_len += count * SKEIN256_BLOCK;
+
+            buffer = offset(buffer, count * SKEIN256_BLOCK);
+            len -= count * SKEIN256_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+    state->leaf_len += len;
+}
+
+/* Completes the current leaf (which may be partial) and starts a new one. */
+static void finish_leaf(struct SKEIN256_TREE_STATE *state, uint64_t out[4])
+{
+    uint64_t start = state->leaf_count << state->leaf_exp;
+    uint64_t tweak[2];
+
+    start *= SKEIN256_BLOCK;
+
+    memset(offset(state->block, state->block_len),
+           0x00,
+           (size_t)(SKEIN256_BLOCK - state->block_len));
+
+    make_tweak(tweak,
+               SKEIN_UBI_MSG,
+               1,
+               start + state->leaf_len,
+               state->leaf_len == state->block_len,
+               1);
+
+    skein256_ubi(state->leaf, state->block, 1, tweak);
+    memcpy(out, state->leaf, SKEIN256_BLOCK);
+
+    memcpy(state->leaf, state->iv, SKEIN256_BLOCK);
+    state->block_len = 0;
+    state->leaf_len = 0;
+    ++state->leaf_count;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int skein256_tree_init(struct SKEIN256_TREE_STATE *state,
+                       const struct SKEIN256_PARAMS *params)
+{
+    uint64_t config[4];
+    uint64_t tweak[2];
+    uint64_t len_tmp;
+
+    if (!params || bits(params->out_len) != SKEIN256_BLOCK)
+        return ORDO_ARG;
+
+    if ((params->tree_leaf < 1) || (params->tree_fan < 1)
+     || (params->tree_max < 2))
+        return ORDO_ARG;
+
+    /* The leaf size must fit in a size_t. */
+    if (params->tree_leaf >= bytes(sizeof(size_t)) - 5)
+        return ORDO_ARG;
+
+    memcpy((unsigned char *)config + 0,
+           &params->schema, sizeof(params->schema));
+    memcpy((unsigned char *)config + 4,
+           &params->version, sizeof(params->version));
+    memcpy((unsigned char *)config + 6,
+           &params->reserved, sizeof(params->reserved));
+    len_tmp = tole64(params->out_len);
+    memcpy((unsigned char *)config + 8,
+           &len_tmp, sizeof(len_tmp));
+    *((unsigned char *)config + 16) = params->tree_leaf;
+    *((unsigned char *)config + 17) = params->tree_fan;
+    *((unsigned char *)config + 18) = params->tree_max;
+    memcpy((unsigned char *)config + 19,
+           &params->unused, sizeof(params->unused));
+
+    skein256_key(state->iv, params->key, params->key_len);
+    make_tweak(tweak, SKEIN_UBI_CFG, 0, SKEIN256_BLOCK, 1, 1);
+    skein256_ubi(state->iv, config, 1, tweak);
+
+    memcpy(state->leaf, state->iv, SKEIN256_BLOCK);
+    state->block_len = 0;
+    state->leaf_len = 0;
+    state->leaf_count = 0;
+
+    state->leaf_exp = params->tree_leaf;
+    state->fan_exp = params->tree_fan;
+    state->max_height = params->tree_max;
+
+    memset(state->node, 0, sizeof(state->node));
+
+    return ORDO_SUCCESS;
+}
+
+void skein256_tree_update(struct SKEIN256_TREE_STATE *state,
+                          const void *buffer, size_t len)
+{
+    size_t leaf_size = (size_t)SKEIN256_BLOCK << state->leaf_exp;
+
+    while (len)
+    {
+        if (state->leaf_len == leaf_size)
+        {
+            uint64_t digest[4];
+
+            finish_leaf(state, digest);
+            push_node(state, 0, digest);
+        }
+
+        /* Whole leaves can be hashed straight from the input concurrently,
+         * but always keep the last one, in case it ends the message. */
+        if (!state->leaf_len && (len > leaf_size))
+        {
+            uint64_t out[SKEIN256_TREE_BATCH][4];
+            struct LEAF_BATCH batch;
+            size_t count, t;
+
+            count = smin((len - 1) / leaf_size, SKEIN256_TREE_BATCH);
+
+            batch.iv = state->iv;
+            batch.buffer = buffer;
+            batch.leaf_size = leaf_size;
+            batch.start = (state->leaf_count << state->leaf_exp)
+                        * SKEIN256_BLOCK;
+            batch.out = out;
+
+            if (count * leaf_size >= SKEIN256_TREE_PARALLEL)
+                sys_parallel(count, leaf_job, &batch);
+            else
+                for (t = 0; t < count; ++t) leaf_job(&batch, t);
+
+            for (t = 0; t < count; ++t)
+                push_node(state, 0, out[t]);
+
+            state->leaf_count += count;
+            buffer = offset(buffer, count * leaf_size);
+            len -= count * leaf_size;
+        }
+        else
+        {
+            size_t take = smin(len, (size_t)(leaf_size - state->leaf_len));
+
+            feed_leaf(state, buffer, take);
+            buffer = offset(buffer, take);
+            len -= take;
+        }
+    }
+}
+
+void skein256_tree_final(struct SKEIN256_TREE_STATE *state,
+                         void *digest)
+{
+    uint64_t tweak[2];
+    uint64_t out[4];
+    size_t k;
+
+    finish_leaf(state, out);
+
+    /* If there is only one leaf, it is the result. Otherwise, complete the
+     * node at every level in turn, bottom-up, until a level holds a single
+     * child (which is the result) or the maximum height is reached. */
+    if (state->leaf_count > 1)
+    {
+        push_node(state, 0, out);
+
+        for (k = 0; ; ++k)
+        {
+            struct SKEIN256_TREE_NODE *node = state->node + k;
+
+            if (node->total == 1)
+            {
+                memcpy(out, node->block, SKEIN256_BLOCK);
+                break;
+            }
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       k + 2,
+                       node->total * SKEIN256_BLOCK,
+                       node->children == 1,
+                       1);
+
+            skein256_ubi(node->state, node->block, 1, tweak);
+
+            if (k + 2 == state->max_height)
+            {
+                memcpy(out, node->state, SKEIN256_BLOCK);
+                break;
+            }
+
+            push_node(state, k + 1, node->state);
+        }
+    }
+
+    memset(state->block, 0, SKEIN256_BLOCK);
+    make_tweak(tweak, SKEIN_UBI_OUT, 0, sizeof(uint64_t), 1, 1);
+    skein256_ubi(out, state->block, 1, tweak);
+    memcpy(digest, out, SKEIN256_BLOCK);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void make_tweak(uint64_t tweak[2],
+                uint64_t type,
+                uint64_t level,
+                uint64_t position,
+                uint64_t first,
+                uint64_t final)
+{
+    tweak[0] = position;
+    tweak[1] = (final << 63) | (first << 62) | (type << 56) | (level << 48);
+}
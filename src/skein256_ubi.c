@@ -0,0 +1,68 @@
+/*===-- skein256_ubi.c --------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/block_ciphers/threefish256.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define SKEIN256_INTERNAL (bits(256))
+#define SKEIN256_BLOCK    (bits(256))
+
+/* Processes "count" consecutive blocks through UBI, starting with the given
+ * tweak. The tweak is updated to the one following the last block, that is,
+ * the position is advanced by one block and the "first" flag cleared for
+ * every block processed. This is used by the Skein-256 and tree hashing
+ * modules. */
+ORDO_HIDDEN void skein256_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+static void skein256_compress(const void * RESTRICT block,
+                              uint64_t * RESTRICT state,
+                              const uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/*===----------------------------------------------------------------------===*/
+
+void skein256_compress(const void * RESTRICT block,
+                       uint64_t * RESTRICT state,
+                       const uint64_t * RESTRICT tweak)
+{
+    struct THREEFISH256_PARAMS params;
+    struct THREEFISH256_STATE cipher;
+    uint64_t msg[4];
+
+    params.tweak[0] = tole64(tweak[0]);
+    params.tweak[1] = tole64(tweak[1]);
+
+    /* The block may be unaligned as it can come from the user's buffer. */
+    memcpy(msg, block, SKEIN256_BLOCK);
+
+    threefish256_init(&cipher, state, SKEIN256_INTERNAL, &params);
+
+    memcpy(state, msg, SKEIN256_INTERNAL);
+    threefish256_forward(&cipher, state);
+    threefish256_final(&cipher);
+
+    xor_buffer(state, msg, SKEIN256_INTERNAL);
+}
+
+void skein256_ubi(uint64_t * RESTRICT state,
+                  const void * RESTRICT blocks,
+                  size_t count,
+                  uint64_t * RESTRICT tweak)
+{
+    while (count--)
+    {
+        skein256_compress(blocks, state, tweak);
+        blocks = offset(blocks, SKEIN256_BLOCK);
+
+        tweak[0] += SKEIN256_BLOCK;
+        tweak[1] &= ~(UINT64_C(1) << 62);
+    }
+}
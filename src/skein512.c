@@ -0,0 +1,231 @@
+/*===-- skein512.c ------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/skein512.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define SKEIN512_INTERNAL (bits(512))
+#define SKEIN512_BLOCK    (bits(512))
+
+/* Some UBI block type constants. */
+#define SKEIN_UBI_KEY 0
+#define SKEIN_UBI_CFG 4
+#define SKEIN_UBI_MSG 48
+#define SKEIN_UBI_OUT 63
+
+/* This also represents the default configuration block, to avoid recreating
+ * it in case the parameters do not specify a different configuration block. */
+static const uint64_t skein512_iv[8] =
+{
+    UINT64_C(0x4903ADFF749C51CE), UINT64_C(0x0D95DE399746DF03),
+    UINT64_C(0x8FD1934127C79BCE), UINT64_C(0x9A255629FF352CB1),
+    UINT64_C(0x5DB62599DF6CA7B0), UINT64_C(0xEABE394CA9D5C3F4),
+    UINT64_C(0x991112C71A75B523), UINT64_C(0xAE18A40B660FCC33)
+};
+
+/* Note this assumes "first" and "final" are boolean (0 or 1). The result is a
+ * UBI-compliant tweak (in native byte order), however with a message length
+ * only up to 2^64 bits. */
+static void make_tweak(uint64_t tweak[2],
+                       uint64_t type,
+                       uint64_t position,
+                       uint64_t first,
+                       uint64_t final) HOT_CODE;
+
+/* See skein512_ubi.c. */
+ORDO_HIDDEN void skein512_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/* Processes a key through UBI, from a zero chaining value. */
+static void skein512_key(uint64_t state[8],
+                         const void *key,
+                         size_t key_len);
+
+#ifdef OPAQUE
+struct SKEIN512_STATE
+{
+    uint64_t state[8];
+    uint64_t block[8];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int skein512_init(struct SKEIN512_STATE *state,
+                  const struct SKEIN512_PARAMS *params)
+{
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    if (params)
+    {
+        uint64_t tweak[2];
+        uint64_t len_tmp;
+
+        if (bits(params->out_len) != SKEIN512_INTERNAL)
+            return ORDO_ARG;
+
+        /* Generate the initial state from the key, if any, followed by the
+         * configuration block. */
+        skein512_key(state->state, params->key, params->key_len);
+
+        memset(state->block, 0, SKEIN512_BLOCK);
+        memcpy((unsigned char *)state->block + 0,
+               &params->schema, sizeof(params->schema));
+        memcpy((unsigned char *)state->block + 4,
+               &params->version, sizeof(params->version));
+        memcpy((unsigned char *)state->block + 6,
+               &params->reserved, sizeof(params->reserved));
+        len_tmp = tole64(params->out_len);
+        memcpy((unsigned char *)state->block + 8,
+               &len_tmp, sizeof(len_tmp));
+        memcpy((unsigned char *)state->block + 16,
+               &params->unused, sizeof(params->unused));
+        /* The configuration block is only 32 bytes long, zero-padded. */
+        make_tweak(tweak, SKEIN_UBI_CFG, 32, 1, 1);
+        skein512_ubi(state->state, state->block, 1, tweak);
+    }
+    else
+    {
+        size_t t;
+
+        /* No parameters, use default configuration block, which is actually
+         * little-endian. */
+        for (t = 0; t < 8; ++t)
+            state->state[t] = fmle64(skein512_iv[t]);
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void skein512_update(struct SKEIN512_STATE *state,
+                     const void *buffer, size_t len)
+{
+    if (!len) return;
+
+    if (state->block_len + len > SKEIN512_BLOCK)
+    {
+        uint64_t tweak[2];
+
+        /* A partial (or held back) block must be completed first. */
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SKEIN512_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       state->msg_len + SKEIN512_BLOCK,
+                       state->msg_len == 0,
+                       0); /* can't be the last block */
+
+            skein512_ubi(state->state, state->block, 1, tweak);
+            state->msg_len += SKEIN512_BLOCK;
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        /* Do NOT process the final block. */
+        if (len > SKEIN512_BLOCK)
+        {
+            size_t count = (len - 1) / SKEIN512_BLOCK;
+
+            make_tweak(tweak,
+                       SKEIN_UBI_MSG,
+                       state->msg_len + SKEIN512_BLOCK,
+                       state->msg_len == 0,
+                       0);
+
+            skein512_ubi(state->state, buffer, count, tweak);
+            state->msg_len += count * SKEIN512_BLOCK;
+
+            buffer = offset(buffer, count * SKEIN512_BLOCK);
+            len -= count * SKEIN512_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void skein512_final(struct SKEIN512_STATE *state,
+                    void *digest)
+{
+    uint64_t tweak[2];
+
+    /* Here, we need to process one complete block - the Skein specification
+     * mandates zero-fill, so erase any residual input data in the state. */
+    memset(offset(state->block, state->block_len),
+           0x00,
+           (size_t)(SKEIN512_BLOCK - state->block_len));
+
+    /* However, only the actual input data counts towards the length. */
+    state->msg_len += state->block_len;
+
+    make_tweak(tweak,
+               SKEIN_UBI_MSG,
+               state->msg_len,
+               state->msg_len <= SKEIN512_BLOCK,
+               1); /* this'll be the last block */
+
+    skein512_ubi(state->state, state->block, 1, tweak);
+
+    {
+        uint64_t out[8];
+
+        memset(state->block, 0, SKEIN512_BLOCK);
+        memcpy(out, state->state, SKEIN512_INTERNAL);
+
+        make_tweak(tweak, SKEIN_UBI_OUT, sizeof(uint64_t), 1, 1);
+        skein512_ubi(out, state->block, 1, tweak);
+        memcpy(digest, out, SKEIN512_BLOCK);
+    }
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void skein512_key(uint64_t state[8],
+                  const void *key,
+                  size_t key_len)
+{
+    memset(state, 0, SKEIN512_INTERNAL);
+
+    if (key_len)
+    {
+        size_t count = (key_len - 1) / SKEIN512_BLOCK;
+        uint64_t block[8] = {0};
+        uint64_t tweak[2];
+
+        make_tweak(tweak, SKEIN_UBI_KEY, SKEIN512_BLOCK, 1, 0);
+        skein512_ubi(state, key, count, tweak);
+
+        /* The last block is zero-padded, and may well be the first. */
+        memcpy(block, offset(key, count * SKEIN512_BLOCK),
+               key_len - count * SKEIN512_BLOCK);
+        tweak[0] = key_len;
+        tweak[1] |= UINT64_C(1) << 63;
+        skein512_ubi(state, block, 1, tweak);
+    }
+}
+
+void make_tweak(uint64_t tweak[2],
+                uint64_t type,
+                uint64_t position,
+                uint64_t first,
+                uint64_t final)
+{
+    tweak[0] = position;
+    tweak[1] = (final << 63) | (first << 62) | (type  << 56);
+}
@@ -0,0 +1,249 @@
+/*===-- skein512_ubi.c --------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+#define SKEIN512_BLOCK    (bits(512))
+
+#define K_S (UINT64_C(0x1BD11BDAA9FC1A22))
+
+/* Processes "count" consecutive blocks through UBI, starting with the given
+ * tweak. The tweak is updated to the one following the last block, that is,
+ * the position is advanced by one block and the "first" flag cleared for
+ * every block processed. This is used by the Skein-512 module. */
+ORDO_HIDDEN void skein512_ubi(uint64_t * RESTRICT state,
+                              const void * RESTRICT blocks,
+                              size_t count,
+                              uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/* Runs Threefish-512 on "block" with the subkeys injected on the fly, which
+ * is cheaper than scheduling them up front as the key changes every block.
+ * Subkey n is key words n to n + 7 plus tweak words n and n + 1, so the key
+ * and tweak words are repeated in "key" and "tweak" for them to be read at
+ * increasing offsets, without reducing any index modulo 9 or 3. */
+static void skein512_threefish(uint64_t * RESTRICT block,
+                               const uint64_t * RESTRICT key,
+                               const uint64_t * RESTRICT tweak)
+HOT_CODE;
+
+/*===----------------------------------------------------------------------===*/
+
+void skein512_threefish(uint64_t * RESTRICT block,
+                        const uint64_t * RESTRICT key,
+                        const uint64_t * RESTRICT tweak)
+{
+    size_t t;
+
+    block[0] += key[0];
+    block[1] += key[1];
+    block[2] += key[2];
+    block[3] += key[3];
+    block[4] += key[4];
+    block[5] += key[5] + tweak[0];
+    block[6] += key[6] + tweak[1];
+    block[7] += key[7];
+
+    for (t = 0; t < 9; t++)
+    {
+        block[0] += block[1];
+        block[1] = rol64(block[1], 46);
+        block[1] ^= block[0];
+
+        block[2] += block[3];
+        block[3] = rol64(block[3], 36);
+        block[3] ^= block[2];
+
+        block[4] += block[5];
+        block[5] = rol64(block[5], 19);
+        block[5] ^= block[4];
+
+        block[6] += block[7];
+        block[7] = rol64(block[7], 37);
+        block[7] ^= block[6];
+
+        block[2] += block[1];
+        block[1] = rol64(block[1], 33);
+        block[1] ^= block[2];
+
+        block[4] += block[7];
+        block[7] = rol64(block[7], 27);
+        block[7] ^= block[4];
+
+        block[6] += block[5];
+        block[5] = rol64(block[5], 14);
+        block[5] ^= block[6];
+
+        block[0] += block[3];
+        block[3] = rol64(block[3], 42);
+        block[3] ^= block[0];
+
+        block[4] += block[1];
+        block[1] = rol64(block[1], 17);
+        block[1] ^= block[4];
+
+        block[6] += block[3];
+        block[3] = rol64(block[3], 49);
+        block[3] ^= block[6];
+
+        block[0] += block[5];
+        block[5] = rol64(block[5], 36);
+        block[5] ^= block[0];
+
+        block[2] += block[7];
+        block[7] = rol64(block[7], 39);
+        block[7] ^= block[2];
+
+        block[6] += block[1];
+        block[1] = rol64(block[1], 44);
+        block[1] ^= block[6];
+
+        block[0] += block[7];
+        block[7] = rol64(block[7],  9);
+        block[7] ^= block[0];
+
+        block[2] += block[5];
+        block[5] = rol64(block[5], 54);
+        block[5] ^= block[2];
+
+        block[4] += block[3];
+        block[3] = rol64(block[3], 56);
+        block[3] ^= block[4];
+
+        block[0] += key[t * 2 + 1];
+        block[1] += key[t * 2 + 2];
+        block[2] += key[t * 2 + 3];
+        block[3] += key[t * 2 + 4];
+        block[4] += key[t * 2 + 5];
+        block[5] += key[t * 2 + 6] + tweak[t * 2 + 1];
+        block[6] += key[t * 2 + 7] + tweak[t * 2 + 2];
+        block[7] += key[t * 2 + 8] + (t * 2 + 1);
+
+        block[0] += block[1];
+        block[1] = rol64(block[1], 39);
+        block[1] ^= block[0];
+
+        block[2] += block[3];
+        block[3] = rol64(block[3], 30);
+        block[3] ^= block[2];
+
+        block[4] += block[5];
+        block[5] = rol64(block[5], 34);
+        block[5] ^= block[4];
+
+        block[6] += block[7];
+        block[7] = rol64(block[7], 24);
+        block[7] ^= block[6];
+
+        block[2] += block[1];
+        block[1] = rol64(block[1], 13);
+        block[1] ^= block[2];
+
+        block[4] += block[7];
+        block[7] = rol64(block[7], 50);
+        block[7] ^= block[4];
+
+        block[6] += block[5];
+        block[5] = rol64(block[5], 10);
+        block[5] ^= block[6];
+
+        block[0] += block[3];
+        block[3] = rol64(block[3], 17);
+        block[3] ^= block[0];
+
+        block[4] += block[1];
+        block[1] = rol64(block[1], 25);
+        block[1] ^= block[4];
+
+        block[6] += block[3];
+        block[3] = rol64(block[3], 29);
+        block[3] ^= block[6];
+
+        block[0] += block[5];
+        block[5] = rol64(block[5], 39);
+        block[5] ^= block[0];
+
+        block[2] += block[7];
+        block[7] = rol64(block[7], 43);
+        block[7] ^= block[2];
+
+        block[6] += block[1];
+        block[1] = rol64(block[1],  8);
+        block[1] ^= block[6];
+
+        block[0] += block[7];
+        block[7] = rol64(block[7], 35);
+        block[7] ^= block[0];
+
+        block[2] += block[5];
+        block[5] = rol64(block[5], 56);
+        block[5] ^= block[2];
+
+        block[4] += block[3];
+        block[3] = rol64(block[3], 22);
+        block[3] ^= block[4];
+
+        block[0] += key[t * 2 + 2];
+        block[1] += key[t * 2 + 3];
+        block[2] += key[t * 2 + 4];
+        block[3] += key[t * 2 + 5];
+        block[4] += key[t * 2 + 6];
+        block[5] += key[t * 2 + 7] + tweak[t * 2 + 2];
+        block[6] += key[t * 2 + 8] + tweak[t * 2 + 3];
+        block[7] += key[t * 2 + 9] + (t * 2 + 2);
+    }
+}
+
+void skein512_ubi(uint64_t * RESTRICT state,
+                  const void * RESTRICT blocks,
+                  size_t count,
+                  uint64_t * RESTRICT tweak)
+{
+    uint64_t key[26], tweak_w[21];
+    uint64_t msg[8], block[8];
+    size_t t;
+
+    /* The chaining value is kept in the key words between blocks. */
+    for (t = 0; t < 8; ++t)
+        key[t] = tole64(state[t]);
+
+    while (count--)
+    {
+        key[8] = K_S;
+
+        for (t = 0; t < 8; ++t)
+            key[8] ^= key[t];
+
+        for (t = 9; t < 26; ++t)
+            key[t] = key[t - 9];
+
+        tweak_w[0] = tweak[0];
+        tweak_w[1] = tweak[1];
+        tweak_w[2] = tweak[0] ^ tweak[1];
+
+        for (t = 3; t < 21; ++t)
+            tweak_w[t] = tweak_w[t - 3];
+
+        /* The block may be unaligned as it can come from the user's buffer. */
+        memcpy(msg, blocks, SKEIN512_BLOCK);
+
+        for (t = 0; t < 8; ++t)
+            block[t] = msg[t] = tole64(msg[t]);
+
+        skein512_threefish(block, key, tweak_w);
+
+        for (t = 0; t < 8; ++t)
+            key[t] = block[t] ^ msg[t];
+
+        blocks = offset(blocks, SKEIN512_BLOCK);
+
+        tweak[0] += SKEIN512_BLOCK;
+        tweak[1] &= ~(UINT64_C(1) << 62);
+    }
+
+    for (t = 0; t < 8; ++t)
+        state[t] = tole64(key[t]);
+}
@@ -0,0 +1,30 @@
+/*===-- sys.c -----------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+void sys_parallel(size_t count, SYS_JOB job, void *ctx)
+{
+    size_t t;
+
+    for (t = 0; t < count; ++t)
+        job(ctx, t);
+}
+
+size_t sys_threads(void)
+{
+    return 1;
+}
+
+void *sys_alloc(size_t len)
+{
+    return malloc(len);
+}
+
+void sys_free(void *ptr, size_t len)
+{
+    free(ptr);
+}
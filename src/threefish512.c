@@ -0,0 +1,473 @@
+/*===-- threefish512.c --------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/block_ciphers/threefish512.h"
+
+/*===----------------------------------------------------------------------===*/
+
+static void threefish512_key_schedule(const uint64_t *key,
+                                      const uint64_t *tweak,
+                                      uint64_t * RESTRICT subkeys)
+HOT_CODE;
+
+static void threefish512_forward_C(uint64_t * RESTRICT block,
+                                   const uint64_t * RESTRICT subkeys)
+HOT_CODE;
+
+static void threefish512_inverse_C(uint64_t * RESTRICT block,
+                                   const uint64_t * RESTRICT subkeys)
+HOT_CODE;
+
+#ifdef OPAQUE
+struct THREEFISH512_STATE
+{
+    uint64_t subkey[19 * 8];
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int threefish512_init(struct THREEFISH512_STATE *state,
+                      const void *key, size_t key_len,
+                      const struct THREEFISH512_PARAMS *params)
+{
+    uint64_t data[8];
+
+    if (!limit_check(key_len, bits(512), bits(512), 1))
+        return ORDO_KEY_LEN;
+
+    memcpy(data, key, sizeof(data));
+    threefish512_key_schedule(data, (params == 0) ? 0 : params->tweak,
+                              state->subkey);
+
+    return ORDO_SUCCESS;
+}
+
+void threefish512_forward(const struct THREEFISH512_STATE *state,
+                          void *block)
+{
+    uint64_t data[8];
+
+    memcpy(data, block, sizeof(data));
+    threefish512_forward_C(data, state->subkey);
+    memcpy(block, data, sizeof(data));
+}
+
+void threefish512_inverse(const struct THREEFISH512_STATE *state,
+                          void *block)
+{
+    uint64_t data[8];
+
+    memcpy(data, block, sizeof(data));
+    threefish512_inverse_C(data, state->subkey);
+    memcpy(block, data, sizeof(data));
+}
+
+void threefish512_final(struct THREEFISH512_STATE *state)
+{
+    return;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void threefish512_forward_C(uint64_t * RESTRICT block,
+                            const uint64_t * RESTRICT subkeys)
+{
+    size_t t;
+
+    block[0] = tole64(block[0]);
+    block[1] = tole64(block[1]);
+    block[2] = tole64(block[2]);
+    block[3] = tole64(block[3]);
+    block[4] = tole64(block[4]);
+    block[5] = tole64(block[5]);
+    block[6] = tole64(block[6]);
+    block[7] = tole64(block[7]);
+
+    block[0] += subkeys[0 * 8 + 0];
+    block[1] += subkeys[0 * 8 + 1];
+    block[2] += subkeys[0 * 8 + 2];
+    block[3] += subkeys[0 * 8 + 3];
+    block[4] += subkeys[0 * 8 + 4];
+    block[5] += subkeys[0 * 8 + 5];
+    block[6] += subkeys[0 * 8 + 6];
+    block[7] += subkeys[0 * 8 + 7];
+
+    for (t = 0; t < 9; t++)
+    {
+        block[0] += block[1];
+        block[1] = rol64(block[1], 46);
+        block[1] ^= block[0];
+
+        block[2] += block[3];
+        block[3] = rol64(block[3], 36);
+        block[3] ^= block[2];
+
+        block[4] += block[5];
+        block[5] = rol64(block[5], 19);
+        block[5] ^= block[4];
+
+        block[6] += block[7];
+        block[7] = rol64(block[7], 37);
+        block[7] ^= block[6];
+
+        block[2] += block[1];
+        block[1] = rol64(block[1], 33);
+        block[1] ^= block[2];
+
+        block[4] += block[7];
+        block[7] = rol64(block[7], 27);
+        block[7] ^= block[4];
+
+        block[6] += block[5];
+        block[5] = rol64(block[5], 14);
+        block[5] ^= block[6];
+
+        block[0] += block[3];
+        block[3] = rol64(block[3], 42);
+        block[3] ^= block[0];
+
+        block[4] += block[1];
+        block[1] = rol64(block[1], 17);
+        block[1] ^= block[4];
+
+        block[6] += block[3];
+        block[3] = rol64(block[3], 49);
+        block[3] ^= block[6];
+
+        block[0] += block[5];
+        block[5] = rol64(block[5], 36);
+        block[5] ^= block[0];
+
+        block[2] += block[7];
+        block[7] = rol64(block[7], 39);
+        block[7] ^= block[2];
+
+        block[6] += block[1];
+        block[1] = rol64(block[1], 44);
+        block[1] ^= block[6];
+
+        block[0] += block[7];
+        block[7] = rol64(block[7],  9);
+        block[7] ^= block[0];
+
+        block[2] += block[5];
+        block[5] = rol64(block[5], 54);
+        block[5] ^= block[2];
+
+        block[4] += block[3];
+        block[3] = rol64(block[3], 56);
+        block[3] ^= block[4];
+
+        block[0] += subkeys[(t * 2 + 1) * 8 + 0];
+        block[1] += subkeys[(t * 2 + 1) * 8 + 1];
+        block[2] += subkeys[(t * 2 + 1) * 8 + 2];
+        block[3] += subkeys[(t * 2 + 1) * 8 + 3];
+        block[4] += subkeys[(t * 2 + 1) * 8 + 4];
+        block[5] += subkeys[(t * 2 + 1) * 8 + 5];
+        block[6] += subkeys[(t * 2 + 1) * 8 + 6];
+        block[7] += subkeys[(t * 2 + 1) * 8 + 7];
+
+        block[0] += block[1];
+        block[1] = rol64(block[1], 39);
+        block[1] ^= block[0];
+
+        block[2] += block[3];
+        block[3] = rol64(block[3], 30);
+        block[3] ^= block[2];
+
+        block[4] += block[5];
+        block[5] = rol64(block[5], 34);
+        block[5] ^= block[4];
+
+        block[6] += block[7];
+        block[7] = rol64(block[7], 24);
+        block[7] ^= block[6];
+
+        block[2] += block[1];
+        block[1] = rol64(block[1], 13);
+        block[1] ^= block[2];
+
+        block[4] += block[7];
+        block[7] = rol64(block[7], 50);
+        block[7] ^= block[4];
+
+        block[6] += block[5];
+        block[5] = rol64(block[5], 10);
+        block[5] ^= block[6];
+
+        block[0] += block[3];
+        block[3] = rol64(block[3], 17);
+        block[3] ^= block[0];
+
+        block[4] += block[1];
+        block[1] = rol64(block[1], 25);
+        block[1] ^= block[4];
+
+        block[6] += block[3];
+        block[3] = rol64(block[3], 29);
+        block[3] ^= block[6];
+
+        block[0] += block[5];
+        block[5] = rol64(block[5], 39);
+        block[5] ^= block[0];
+
+        block[2] += block[7];
+        block[7] = rol64(block[7], 43);
+        block[7] ^= block[2];
+
+        block[6] += block[1];
+        block[1] = rol64(block[1],  8);
+        block[1] ^= block[6];
+
+        block[0] += block[7];
+        block[7] = rol64(block[7], 35);
+        block[7] ^= block[0];
+
+        block[2] += block[5];
+        block[5] = rol64(block[5], 56);
+        block[5] ^= block[2];
+
+        block[4] += block[3];
+        block[3] = rol64(block[3], 22);
+        block[3] ^= block[4];
+
+        block[0] += subkeys[(t * 2 + 2) * 8 + 0];
+        block[1] += subkeys[(t * 2 + 2) * 8 + 1];
+        block[2] += subkeys[(t * 2 + 2) * 8 + 2];
+        block[3] += subkeys[(t * 2 + 2) * 8 + 3];
+        block[4] += subkeys[(t * 2 + 2) * 8 + 4];
+        block[5] += subkeys[(t * 2 + 2) * 8 + 5];
+        block[6] += subkeys[(t * 2 + 2) * 8 + 6];
+        block[7] += subkeys[(t * 2 + 2) * 8 + 7];
+    }
+
+    block[0] = fmle64(block[0]);
+    block[1] = fmle64(block[1]);
+    block[2] = fmle64(block[2]);
+    block[3] = fmle64(block[3]);
+    block[4] = fmle64(block[4]);
+    block[5] = fmle64(block[5]);
+    block[6] = fmle64(block[6]);
+    block[7] = fmle64(block[7]);
+}
+
+void threefish512_inverse_C(uint64_t * RESTRICT block,
+                            const uint64_t * RESTRICT subkeys)
+{
+    size_t t;
+
+    block[0] = tole64(block[0]);
+    block[1] = tole64(block[1]);
+    block[2] = tole64(block[2]);
+    block[3] = tole64(block[3]);
+    block[4] = tole64(block[4]);
+    block[5] = tole64(block[5]);
+    block[6] = tole64(block[6]);
+    block[7] = tole64(block[7]);
+
+    for (t = 9; t > 0; t--)
+    {
+        block[0] -= subkeys[((t - 1) * 2 + 2) * 8 + 0];
+        block[1] -= subkeys[((t - 1) * 2 + 2) * 8 + 1];
+        block[2] -= subkeys[((t - 1) * 2 + 2) * 8 + 2];
+        block[3] -= subkeys[((t - 1) * 2 + 2) * 8 + 3];
+        block[4] -= subkeys[((t - 1) * 2 + 2) * 8 + 4];
+        block[5] -= subkeys[((t - 1) * 2 + 2) * 8 + 5];
+        block[6] -= subkeys[((t - 1) * 2 + 2) * 8 + 6];
+        block[7] -= subkeys[((t - 1) * 2 + 2) * 8 + 7];
+
+        block[1] ^= block[6];
+        block[1] = ror64(block[1],  8);
+        block[6] -= block[1];
+
+        block[7] ^= block[0];
+        block[7] = ror64(block[7], 35);
+        block[0] -= block[7];
+
+        block[5] ^= block[2];
+        block[5] = ror64(block[5], 56);
+        block[2] -= block[5];
+
+        block[3] ^= block[4];
+        block[3] = ror64(block[3], 22);
+        block[4] -= block[3];
+
+        block[1] ^= block[4];
+        block[1] = ror64(block[1], 25);
+        block[4] -= block[1];
+
+        block[3] ^= block[6];
+        block[3] = ror64(block[3], 29);
+        block[6] -= block[3];
+
+        block[5] ^= block[0];
+        block[5] = ror64(block[5], 39);
+        block[0] -= block[5];
+
+        block[7] ^= block[2];
+        block[7] = ror64(block[7], 43);
+        block[2] -= block[7];
+
+        block[1] ^= block[2];
+        block[1] = ror64(block[1], 13);
+        block[2] -= block[1];
+
+        block[7] ^= block[4];
+        block[7] = ror64(block[7], 50);
+        block[4] -= block[7];
+
+        block[5] ^= block[6];
+        block[5] = ror64(block[5], 10);
+        block[6] -= block[5];
+
+        block[3] ^= block[0];
+        block[3] = ror64(block[3], 17);
+        block[0] -= block[3];
+
+        block[1] ^= block[0];
+        block[1] = ror64(block[1], 39);
+        block[0] -= block[1];
+
+        block[3] ^= block[2];
+        block[3] = ror64(block[3], 30);
+        block[2] -= block[3];
+
+        block[5] ^= block[4];
+        block[5] = ror64(block[5], 34);
+        block[4] -= block[5];
+
+        block[7] ^= block[6];
+        block[7] = ror64(block[7], 24);
+        block[6] -= block[7];
+
+        block[0] -= subkeys[((t - 1) * 2 + 1) * 8 + 0];
+        block[1] -= subkeys[((t - 1) * 2 + 1) * 8 + 1];
+        block[2] -= subkeys[((t - 1) * 2 + 1) * 8 + 2];
+        block[3] -= subkeys[((t - 1) * 2 + 1) * 8 + 3];
+        block[4] -= subkeys[((t - 1) * 2 + 1) * 8 + 4];
+        block[5] -= subkeys[((t - 1) * 2 + 1) * 8 + 5];
+        block[6] -= subkeys[((t - 1) * 2 + 1) * 8 + 6];
+        block[7] -= subkeys[((t - 1) * 2 + 1) * 8 + 7];
+
+        block[1] ^= block[6];
+        block[1] = ror64(block[1], 44);
+        block[6] -= block[1];
+
+        block[7] ^= block[0];
+        block[7] = ror64(block[7],  9);
+        block[0] -= block[7];
+
+        block[5] ^= block[2];
+        block[5] = ror64(block[5], 54);
+        block[2] -= block[5];
+
+        block[3] ^= block[4];
+        block[3] = ror64(block[3], 56);
+        block[4] -= block[3];
+
+        block[1] ^= block[4];
+        block[1] = ror64(block[1], 17);
+        block[4] -= block[1];
+
+        block[3] ^= block[6];
+        block[3] = ror64(block[3], 49);
+        block[6] -= block[3];
+
+        block[5] ^= block[0];
+        block[5] = ror64(block[5], 36);
+        block[0] -= block[5];
+
+        block[7] ^= block[2];
+        block[7] = ror64(block[7], 39);
+        block[2] -= block[7];
+
+        block[1] ^= block[2];
+        block[1] = ror64(block[1], 33);
+        block[2] -= block[1];
+
+        block[7] ^= block[4];
+        block[7] = ror64(block[7], 27);
+        block[4] -= block[7];
+
+        block[5] ^= block[6];
+        block[5] = ror64(block[5], 14);
+        block[6] -= block[5];
+
+        block[3] ^= block[0];
+        block[3] = ror64(block[3], 42);
+        block[0] -= block[3];
+
+        block[1] ^= block[0];
+        block[1] = ror64(block[1], 46);
+        block[0] -= block[1];
+
+        block[3] ^= block[2];
+        block[3] = ror64(block[3], 36);
+        block[2] -= block[3];
+
+        block[5] ^= block[4];
+        block[5] = ror64(block[5], 19);
+        block[4] -= block[5];
+
+        block[7] ^= block[6];
+        block[7] = ror64(block[7], 37);
+        block[6] -= block[7];
+    }
+
+    block[0] -= subkeys[0 * 8 + 0];
+    block[1] -= subkeys[0 * 8 + 1];
+    block[2] -= subkeys[0 * 8 + 2];
+    block[3] -= subkeys[0 * 8 + 3];
+    block[4] -= subkeys[0 * 8 + 4];
+    block[5] -= subkeys[0 * 8 + 5];
+    block[6] -= subkeys[0 * 8 + 6];
+    block[7] -= subkeys[0 * 8 + 7];
+
+    block[0] = fmle64(block[0]);
+    block[1] = fmle64(block[1]);
+    block[2] = fmle64(block[2]);
+    block[3] = fmle64(block[3]);
+    block[4] = fmle64(block[4]);
+    block[5] = fmle64(block[5]);
+    block[6] = fmle64(block[6]);
+    block[7] = fmle64(block[7]);
+}
+
+#define K_S (UINT64_C(0x1BD11BDAA9FC1A22))
+
+void threefish512_key_schedule(const uint64_t *key,
+                               const uint64_t *tweak,
+                               uint64_t * RESTRICT subkeys)
+{
+    uint64_t tweak_w[3];
+    uint64_t key_w[9];
+    size_t n, i;
+
+    key_w[8] = K_S;
+
+    for (i = 0; i < 8; ++i)
+    {
+        key_w[i] = tole64(key[i]);
+        key_w[8] ^= key_w[i];
+    }
+
+    tweak_w[0] = (tweak ? tole64(tweak[0]) : 0);
+    tweak_w[1] = (tweak ? tole64(tweak[1]) : 0);
+    tweak_w[2] = tweak_w[0] ^ tweak_w[1];
+
+    /* Subkey n uses key words n to n + 7 (mod 9), with the tweak words added
+     * to its last three words and the subkey index added to the last one. */
+    for (n = 0; n < 19; ++n)
+    {
+        for (i = 0; i < 8; ++i)
+            subkeys[n * 8 + i] = key_w[(n + i) % 9];
+
+        subkeys[n * 8 + 5] += tweak_w[n % 3];
+        subkeys[n * 8 + 6] += tweak_w[(n + 1) % 3];
+        subkeys[n * 8 + 7] += n;
+    }
+}
@@ -0,0 +1,152 @@
+/*===-- threefry.c ------------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/misc/threefry.h"
+#include "ordo/primitives/block_ciphers/threefish256.h"
+
+/*===----------------------------------------------------------------------===*/
+
+/* See threefry_many.c. */
+ORDO_HIDDEN size_t threefry_many(const uint64_t * RESTRICT subkeys,
+                                 int rounds,
+                                 const uint64_t * RESTRICT counter,
+                                 uint64_t * RESTRICT out, size_t count);
+
+static void threefry_block(const uint64_t * RESTRICT subkeys, int rounds,
+                           const uint64_t * RESTRICT counter,
+                           uint64_t * RESTRICT out)
+HOT_CODE;
+
+/* The Threefry key schedule is that of Threefish-256 with a zero tweak, so
+ * the context is a Threefish-256 state, whose subkeys are used directly. */
+#ifdef OPAQUE
+struct THREEFRY_CTX
+{
+    struct THREEFISH256_STATE key;
+    int rounds;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+/* Unlike the Threefish-256 code, the words are not swapped after each round,
+ * and the pairs of words mixed alternate instead, as in Random123, which is
+ * only visible when the number of rounds is not a multiple of four. */
+#define MIX(a, b, r) do { a += b; b = rol64(b, r) ^ a; } while (0)
+
+#define ROUNDS(r0, r1, r2, r3, r4, r5, r6, r7)                               \
+    do {                                                                     \
+        MIX(x0, x1, r0); MIX(x2, x3, r1);                                    \
+        MIX(x0, x3, r2); MIX(x2, x1, r3);                                    \
+        MIX(x0, x1, r4); MIX(x2, x3, r5);                                    \
+        MIX(x0, x3, r6); MIX(x2, x1, r7);                                    \
+    } while (0)
+
+#define INJECT(k)                                                            \
+    do {                                                                     \
+        x0 += (k)[0]; x1 += (k)[1]; x2 += (k)[2]; x3 += (k)[3];              \
+    } while (0)
+
+void threefry_block(const uint64_t * RESTRICT subkeys, int rounds,
+                    const uint64_t * RESTRICT counter,
+                    uint64_t * RESTRICT out)
+{
+    const uint64_t *k = subkeys + 4;
+    uint64_t x0, x1, x2, x3;
+    int r;
+
+    x0 = counter[0] + subkeys[0];
+    x1 = counter[1] + subkeys[1];
+    x2 = counter[2] + subkeys[2];
+    x3 = counter[3] + subkeys[3];
+
+    for (r = 0; r < rounds / 8; ++r, k += 8)
+    {
+        ROUNDS(14, 16, 52, 57, 23, 40,  5, 37); INJECT(k + 0);
+        ROUNDS(25, 33, 46, 12, 58, 22, 32, 32); INJECT(k + 4);
+    }
+
+    if (rounds % 8 >= 4)
+    {
+        ROUNDS(14, 16, 52, 57, 23, 40,  5, 37); INJECT(k);
+    }
+
+    /* Only 13 rounds leave a last round, with no injection after it. */
+    if (rounds % 4)
+    {
+        MIX(x0, x1, 25); MIX(x2, x3, 33);
+    }
+
+    out[0] = x0;
+    out[1] = x1;
+    out[2] = x2;
+    out[3] = x3;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+int threefry_init(struct THREEFRY_CTX *ctx,
+                  const uint64_t *key, int rounds)
+{
+    uint64_t data[THREEFRY_WORDS];
+    size_t t;
+
+    if (rounds != 13 && rounds != 20 && rounds != 72) return ORDO_ARG;
+
+    for (t = 0; t < THREEFRY_WORDS; ++t) data[t] = tole64(key[t]);
+
+    threefish256_init(&ctx->key, data, sizeof(data), 0);
+    ctx->rounds = rounds;
+
+    memset(data, 0, sizeof(data));
+
+    return ORDO_SUCCESS;
+}
+
+void threefry_eval(const struct THREEFRY_CTX *ctx,
+                   const uint64_t *counter, uint64_t *out)
+{
+    threefry_block(ctx->key.subkey, ctx->rounds, counter, out);
+}
+
+void threefry_bulk(const struct THREEFRY_CTX *ctx,
+                   const uint64_t *counter, uint64_t *out, size_t count)
+{
+    uint64_t next[THREEFRY_WORDS];
+
+    memcpy(next, counter, sizeof(next));
+
+    /* The kernel only increments the first word of the counter, so the
+     * counters are split into runs over which that word does not wrap. It
+     * may leave a few counters at the end of a run, done one at a time. */
+    while (count)
+    {
+        size_t n = count, t;
+
+        if (next[0] && (uint64_t)(0 - next[0]) < n)
+            n = (size_t)(0 - next[0]);
+
+        t = threefry_many(ctx->key.subkey, ctx->rounds, next, out, n);
+
+        for (next[0] += t; t < n; ++t, ++next[0])
+            threefry_block(ctx->key.subkey, ctx->rounds, next,
+                           out + t * THREEFRY_WORDS);
+
+        if (!next[0])
+            if (!++next[1])
+                if (!++next[2])
+                    ++next[3];
+
+        out += n * THREEFRY_WORDS;
+        count -= n;
+    }
+}
+
+void threefry_final(struct THREEFRY_CTX *ctx)
+{
+    threefish256_final(&ctx->key);
+    memset(ctx, 0, sizeof(*ctx));
+}
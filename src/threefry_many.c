@@ -0,0 +1,30 @@
+/*===-- threefry_many.c -------------------------------*- generic -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* Computes Threefry-4x64 with "rounds" rounds (13, 20 or 72) for as many of
+ * "count" counters as can be done in bulk, into "out", four words each, and
+ * returns how many that is, the caller doing the others one at a time. The
+ * first counter is "counter" and the next ones are obtained by incrementing
+ * its first word only, which the caller ensures will not wrap around. The
+ * subkeys are those of Threefish-256 for a zero tweak.
+ *
+ * There is no generic bulk code, as the single-block code in threefry.c is
+ * what it would be. */
+ORDO_HIDDEN size_t threefry_many(const uint64_t * RESTRICT subkeys,
+                                 int rounds,
+                                 const uint64_t * RESTRICT counter,
+                                 uint64_t * RESTRICT out, size_t count);
+
+/*===----------------------------------------------------------------------===*/
+
+size_t threefry_many(const uint64_t * RESTRICT subkeys, int rounds,
+                     const uint64_t * RESTRICT counter,
+                     uint64_t * RESTRICT out, size_t count)
+{
+    return 0;
+}
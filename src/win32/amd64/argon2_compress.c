@@ -0,0 +1,31 @@
+/*===-- argon2_compress.c -------------------------*- win32/amd64 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic argon2_compress.c. */
+ORDO_HIDDEN void argon2_compress(uint64_t * RESTRICT out,
+                                 const uint64_t * RESTRICT x,
+                                 const uint64_t * RESTRICT y,
+                                 int xor)
+HOT_CODE;
+
+/* Runs the whole compression with SSE2, which all AMD64 processors have, on
+ * two words of the BLAKE2b state per XMM register. */
+extern void argon2_compress_ASM(uint64_t * RESTRICT out,
+                                const uint64_t * RESTRICT x,
+                                const uint64_t * RESTRICT y,
+                                int xor);
+
+/*===----------------------------------------------------------------------===*/
+
+void argon2_compress(uint64_t * RESTRICT out,
+                     const uint64_t * RESTRICT x,
+                     const uint64_t * RESTRICT y,
+                     int xor)
+{
+    argon2_compress_ASM(out, x, y, xor);
+}
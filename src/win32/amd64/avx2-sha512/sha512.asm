@@ -0,0 +1,153 @@
+;/===-- sha512.asm ------------------*- win32/amd64/avx2-sha512 -*- ASM -*-===*/
+
+; SHA-512 message schedule for AMD64 with AVX2 (Windows ABI)
+;
+; Expands a 128-byte big-endian block into the 80 words of the message
+; schedule and adds the round constants to them, four words at a time. The
+; words depending on W[t - 2] are computed two at a time, as the first pair
+; is needed to compute the second. The rounds themselves are done in C.
+;
+; XMM6 and XMM7 are callee-saved on Windows, so they are spilled on entry.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global sha512_schedule_ASM
+
+section .text
+
+sha512_schedule_ASM:
+    mov RAX, [RDX + 0x00]
+    bswap RAX
+    mov [RCX + 0x00], RAX
+    mov RAX, [RDX + 0x08]
+    bswap RAX
+    mov [RCX + 0x08], RAX
+    mov RAX, [RDX + 0x10]
+    bswap RAX
+    mov [RCX + 0x10], RAX
+    mov RAX, [RDX + 0x18]
+    bswap RAX
+    mov [RCX + 0x18], RAX
+    mov RAX, [RDX + 0x20]
+    bswap RAX
+    mov [RCX + 0x20], RAX
+    mov RAX, [RDX + 0x28]
+    bswap RAX
+    mov [RCX + 0x28], RAX
+    mov RAX, [RDX + 0x30]
+    bswap RAX
+    mov [RCX + 0x30], RAX
+    mov RAX, [RDX + 0x38]
+    bswap RAX
+    mov [RCX + 0x38], RAX
+    mov RAX, [RDX + 0x40]
+    bswap RAX
+    mov [RCX + 0x40], RAX
+    mov RAX, [RDX + 0x48]
+    bswap RAX
+    mov [RCX + 0x48], RAX
+    mov RAX, [RDX + 0x50]
+    bswap RAX
+    mov [RCX + 0x50], RAX
+    mov RAX, [RDX + 0x58]
+    bswap RAX
+    mov [RCX + 0x58], RAX
+    mov RAX, [RDX + 0x60]
+    bswap RAX
+    mov [RCX + 0x60], RAX
+    mov RAX, [RDX + 0x68]
+    bswap RAX
+    mov [RCX + 0x68], RAX
+    mov RAX, [RDX + 0x70]
+    bswap RAX
+    mov [RCX + 0x70], RAX
+    mov RAX, [RDX + 0x78]
+    bswap RAX
+    mov [RCX + 0x78], RAX
+
+    sub RSP, 0x20
+    vmovdqu [RSP + 0x00], xmm6
+    vmovdqu [RSP + 0x10], xmm7
+
+    vmovdqu ymm2, [RCX + 0x40]
+    vmovdqu ymm3, [RCX + 0x60]
+    vextracti128 xmm6, ymm3, 1
+
+    lea R10, [RCX + 0x80]
+    mov R11, 16
+
+    ; YMM2 and YMM3 hold W[t - 8] to W[t - 1] and XMM6 holds W[t - 2] and
+    ; W[t - 1], so the dependency chain through s1 never goes via memory.
+
+    .expand:
+        ; W[t - 16] + s0(W[t - 15]) + W[t - 7] for the four words
+        vmovdqu ymm0, [R10 - 0x80]
+        vperm2i128 ymm1, ymm0, [R10 - 0x60], 0x21
+        vpalignr ymm1, ymm1, ymm0, 8
+        vpsrlq ymm4, ymm1, 1
+        vpsllq ymm5, ymm1, 63
+        vpsrlq ymm7, ymm1, 8
+        vpxor ymm4, ymm4, ymm5
+        vpsllq ymm5, ymm1, 56
+        vpxor ymm7, ymm7, ymm5
+        vpsrlq ymm5, ymm1, 7
+        vpxor ymm4, ymm4, ymm7
+        vpxor ymm4, ymm4, ymm5
+        vpaddq ymm0, ymm0, ymm4
+        vperm2i128 ymm1, ymm2, ymm3, 0x21
+        vpalignr ymm1, ymm1, ymm2, 8
+        vpaddq ymm0, ymm0, ymm1
+
+        ; the low pair depends on W[t - 2] and W[t - 1]
+        vpsrlq xmm4, xmm6, 19
+        vpsllq xmm5, xmm6, 45
+        vpsrlq xmm7, xmm6, 61
+        vpxor xmm4, xmm4, xmm5
+        vpsllq xmm5, xmm6, 3
+        vpxor xmm7, xmm7, xmm5
+        vpsrlq xmm5, xmm6, 6
+        vpxor xmm4, xmm4, xmm7
+        vpxor xmm4, xmm4, xmm5
+        vpaddq xmm1, xmm0, xmm4
+
+        ; the high pair depends on the low pair
+        vpsrlq xmm4, xmm1, 19
+        vpsllq xmm5, xmm1, 45
+        vpsrlq xmm7, xmm1, 61
+        vpxor xmm4, xmm4, xmm5
+        vpsllq xmm5, xmm1, 3
+        vpxor xmm7, xmm7, xmm5
+        vpsrlq xmm5, xmm1, 6
+        vpxor xmm4, xmm4, xmm7
+        vpxor xmm4, xmm4, xmm5
+        vextracti128 xmm5, ymm0, 1
+        vpaddq xmm6, xmm5, xmm4
+
+        vmovdqa ymm2, ymm3
+        vinserti128 ymm3, ymm1, xmm6, 1
+        vmovdqu [R10], ymm3
+
+        add R10, 0x20
+        dec R11
+        jnz .expand
+
+    mov R11, 20
+
+    .constants:
+        vmovdqu ymm0, [RCX]
+        vpaddq ymm0, ymm0, [R8]
+        vmovdqu [RCX], ymm0
+
+        add RCX, 0x20
+        add R8, 0x20
+        dec R11
+        jnz .constants
+
+    vmovdqu xmm6, [RSP + 0x00]
+    vmovdqu xmm7, [RSP + 0x10]
+    add RSP, 0x20
+
+    vzeroupper
+    ret
@@ -0,0 +1,269 @@
+/*===-- sha512.c ----------------------*- win32/amd64/avx2-sha512 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/sha512.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define SHA512_DIGEST     (bits(512))
+#define SHA384_DIGEST     (bits(384))
+#define SHA512_256_DIGEST (bits(256))
+#define SHA512_BLOCK      (bits(1024))
+
+ORDO_HIDDEN void sha512_compress(const void * RESTRICT block,
+                                 uint64_t * RESTRICT digest) HOT_CODE;
+
+/* Computes the whole message schedule with AVX2, including the round constant
+ * additions, so that w[t] = W[t] + K[t] for each round t. */
+extern void sha512_schedule_ASM(uint64_t * RESTRICT w,
+                                const void * RESTRICT block,
+                                const uint64_t * RESTRICT table);
+
+/* Pads the message and converts the final state to big-endian, it is shared
+ * by all three variants, which differ only in the IV and the digest length. */
+static void sha512_pad(struct SHA512_STATE *state);
+
+static const uint64_t sha512_iv[8] =
+{
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b),
+    UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
+    UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
+    UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)
+};
+
+static const uint64_t sha384_iv[8] =
+{
+    UINT64_C(0xcbbb9d5dc1059ed8), UINT64_C(0x629a292a367cd507),
+    UINT64_C(0x9159015a3070dd17), UINT64_C(0x152fecd8f70e5939),
+    UINT64_C(0x67332667ffc00b31), UINT64_C(0x8eb44a8768581511),
+    UINT64_C(0xdb0c2e0d64f98fa7), UINT64_C(0x47b5481dbefa4fa4)
+};
+
+static const uint64_t sha512_256_iv[8] =
+{
+    UINT64_C(0x22312194fc2bf72c), UINT64_C(0x9f555fa3c84c64c2),
+    UINT64_C(0x2393b86b6f53b151), UINT64_C(0x963877195940eabd),
+    UINT64_C(0x96283ee2a88effe3), UINT64_C(0xbe5e1e2553863992),
+    UINT64_C(0x2b0199fc2c85b8aa), UINT64_C(0x0eb72ddc81c52ca2)
+};
+
+#ifdef OPAQUE
+struct SHA512_STATE
+{
+    uint64_t digest[8];
+    uint64_t block[16];
+    uint64_t block_len;
+    uint64_t msg_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int sha512_init(struct SHA512_STATE *state,
+                const void *params)
+{
+    memcpy(state->digest, sha512_iv, sizeof(sha512_iv));
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    return ORDO_SUCCESS;
+}
+
+int sha384_init(struct SHA512_STATE *state,
+                const void *params)
+{
+    memcpy(state->digest, sha384_iv, sizeof(sha384_iv));
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    return ORDO_SUCCESS;
+}
+
+int sha512_256_init(struct SHA512_STATE *state,
+                    const void *params)
+{
+    memcpy(state->digest, sha512_256_iv, sizeof(sha512_256_iv));
+    state->block_len = 0;
+    state->msg_len = 0;
+
+    return ORDO_SUCCESS;
+}
+
+void sha512_update(struct SHA512_STATE *state,
+                   const void *buffer, size_t len)
+{
+    if (!len) return;
+
+    state->msg_len += len;
+
+    if (state->block_len + len >= SHA512_BLOCK)
+    {
+        if (state->block_len)
+        {
+            size_t pad = (size_t)(SHA512_BLOCK - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            sha512_compress(state->block, state->digest);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+
+        while (len >= SHA512_BLOCK)
+        {
+            sha512_compress(buffer, state->digest);
+
+            buffer = offset(buffer, SHA512_BLOCK);
+            len -= SHA512_BLOCK;
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void sha512_final(struct SHA512_STATE *state,
+                  void *digest)
+{
+    sha512_pad(state);
+    memcpy(digest, state->digest, SHA512_DIGEST);
+}
+
+void sha384_final(struct SHA512_STATE *state,
+                  void *digest)
+{
+    sha512_pad(state);
+    memcpy(digest, state->digest, SHA384_DIGEST);
+}
+
+void sha512_256_final(struct SHA512_STATE *state,
+                      void *digest)
+{
+    sha512_pad(state);
+    memcpy(digest, state->digest, SHA512_256_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void sha512_pad(struct SHA512_STATE *state)
+{
+    /* See the MD5 code for a description of Merkle padding. The length is a
+     * 128-bit integer here, of which we only ever use the low 67 bits. */
+
+    unsigned char padding[SHA512_BLOCK] = { 0x80 };
+    uint64_t len[2];
+    size_t block_len = (size_t)state->block_len;
+    size_t t;
+
+    size_t pad_len = SHA512_BLOCK - block_len - sizeof(len)
+                   + (block_len < SHA512_BLOCK - sizeof(len)
+                     ? 0 : SHA512_BLOCK);
+
+    len[0] = tobe64(state->msg_len >> 61);
+    len[1] = tobe64(bytes(state->msg_len));
+
+    sha512_update(state, padding, pad_len);
+    sha512_update(state, len, sizeof(len));
+
+    /* SHA-512 takes big-endian input, convert it back. */
+    for (t = 0; t < 8; ++t)
+        state->digest[t] = tobe64(state->digest[t]);
+}
+
+static const uint64_t sha512_table[80] =
+{
+    UINT64_C(0x428a2f98d728ae22), UINT64_C(0x7137449123ef65cd),
+    UINT64_C(0xb5c0fbcfec4d3b2f), UINT64_C(0xe9b5dba58189dbbc),
+    UINT64_C(0x3956c25bf348b538), UINT64_C(0x59f111f1b605d019),
+    UINT64_C(0x923f82a4af194f9b), UINT64_C(0xab1c5ed5da6d8118),
+    UINT64_C(0xd807aa98a3030242), UINT64_C(0x12835b0145706fbe),
+    UINT64_C(0x243185be4ee4b28c), UINT64_C(0x550c7dc3d5ffb4e2),
+    UINT64_C(0x72be5d74f27b896f), UINT64_C(0x80deb1fe3b1696b1),
+    UINT64_C(0x9bdc06a725c71235), UINT64_C(0xc19bf174cf692694),
+    UINT64_C(0xe49b69c19ef14ad2), UINT64_C(0xefbe4786384f25e3),
+    UINT64_C(0x0fc19dc68b8cd5b5), UINT64_C(0x240ca1cc77ac9c65),
+    UINT64_C(0x2de92c6f592b0275), UINT64_C(0x4a7484aa6ea6e483),
+    UINT64_C(0x5cb0a9dcbd41fbd4), UINT64_C(0x76f988da831153b5),
+    UINT64_C(0x983e5152ee66dfab), UINT64_C(0xa831c66d2db43210),
+    UINT64_C(0xb00327c898fb213f), UINT64_C(0xbf597fc7beef0ee4),
+    UINT64_C(0xc6e00bf33da88fc2), UINT64_C(0xd5a79147930aa725),
+    UINT64_C(0x06ca6351e003826f), UINT64_C(0x142929670a0e6e70),
+    UINT64_C(0x27b70a8546d22ffc), UINT64_C(0x2e1b21385c26c926),
+    UINT64_C(0x4d2c6dfc5ac42aed), UINT64_C(0x53380d139d95b3df),
+    UINT64_C(0x650a73548baf63de), UINT64_C(0x766a0abb3c77b2a8),
+    UINT64_C(0x81c2c92e47edaee6), UINT64_C(0x92722c851482353b),
+    UINT64_C(0xa2bfe8a14cf10364), UINT64_C(0xa81a664bbc423001),
+    UINT64_C(0xc24b8b70d0f89791), UINT64_C(0xc76c51a30654be30),
+    UINT64_C(0xd192e819d6ef5218), UINT64_C(0xd69906245565a910),
+    UINT64_C(0xf40e35855771202a), UINT64_C(0x106aa07032bbd1b8),
+    UINT64_C(0x19a4c116b8d2d0c8), UINT64_C(0x1e376c085141ab53),
+    UINT64_C(0x2748774cdf8eeb99), UINT64_C(0x34b0bcb5e19b48a8),
+    UINT64_C(0x391c0cb3c5c95a63), UINT64_C(0x4ed8aa4ae3418acb),
+    UINT64_C(0x5b9cca4f7763e373), UINT64_C(0x682e6ff3d6b2b8a3),
+    UINT64_C(0x748f82ee5defb2fc), UINT64_C(0x78a5636f43172f60),
+    UINT64_C(0x84c87814a1f0ab72), UINT64_C(0x8cc702081a6439ec),
+    UINT64_C(0x90befffa23631e28), UINT64_C(0xa4506cebde82bde9),
+    UINT64_C(0xbef9a3f7b2c67915), UINT64_C(0xc67178f2e372532b),
+    UINT64_C(0xca273eceea26619c), UINT64_C(0xd186b8c721c0c207),
+    UINT64_C(0xeada7dd6cde0eb1e), UINT64_C(0xf57d4f7fee6ed178),
+    UINT64_C(0x06f067aa72176fba), UINT64_C(0x0a637dc5a2c898a6),
+    UINT64_C(0x113f9804bef90dae), UINT64_C(0x1b710b35131c471b),
+    UINT64_C(0x28db77f523047d84), UINT64_C(0x32caab7b40c72493),
+    UINT64_C(0x3c9ebe0a15c9bebc), UINT64_C(0x431d67c49c100d4c),
+    UINT64_C(0x4cc5d4becb3e42b6), UINT64_C(0x597f299cfc657e2a),
+    UINT64_C(0x5fcb6fab3ad6faec), UINT64_C(0x6c44198c4a475817)
+};
+
+#define ma(x, y, z) ((x & y) ^ (x & z) ^ (y & z))
+#define ch(x, y, z) ((x & y) ^ (~x & z))
+
+void sha512_compress(const void * RESTRICT block,
+                     uint64_t * RESTRICT digest)
+{
+    size_t t;
+
+    uint64_t a = digest[0];
+    uint64_t b = digest[1];
+    uint64_t c = digest[2];
+    uint64_t d = digest[3];
+    uint64_t e = digest[4];
+    uint64_t f = digest[5];
+    uint64_t g = digest[6];
+    uint64_t h = digest[7];
+
+    uint64_t w[80]; /* The "message schedule" array, plus round constants. */
+
+    /* This handles unaligned input blocks just fine. */
+    sha512_schedule_ASM(w, block, sha512_table);
+
+    for (t = 0; t < 80; ++t)
+    {
+        uint64_t t2 = (ror64(a, 28) ^ ror64(a, 34) ^ ror64(a, 39));
+        uint64_t t1 = (ror64(e, 14) ^ ror64(e, 18) ^ ror64(e, 41));
+
+        t1 += ch(e, f, g) + h + w[t];
+        t2 += ma(a, b, c);
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    digest[0] += a;
+    digest[1] += b;
+    digest[2] += c;
+    digest[3] += d;
+    digest[4] += e;
+    digest[5] += f;
+    digest[6] += g;
+    digest[7] += h;
+}
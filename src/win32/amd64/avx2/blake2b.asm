@@ -0,0 +1,837 @@
+;/===-- blake2b.asm ------------------------*- win32/amd64/avx2 -*- ASM -*-===*/
+
+; BLAKE2b compression for AMD64 with AVX2 (Windows ABI)
+;
+; Each row of the working state is held in one YMM register, so that the
+; four G functions of a column or diagonal step run side by side, the
+; diagonal steps being done by rotating the rows. The message words for
+; each step are gathered with scalar inserts, as they are not contiguous.
+;
+; XMM6-XMM10 are callee-saved on Windows, so they are spilled on entry.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global blake2b_compress_ASM
+
+section .text
+
+blake2b_compress_ASM:
+    sub RSP, 0x90
+    vmovdqu [RSP + 0x40], xmm6
+    vmovdqu [RSP + 0x50], xmm7
+    vmovdqu [RSP + 0x60], xmm8
+    vmovdqu [RSP + 0x70], xmm9
+    vmovdqu [RSP + 0x80], xmm10
+
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x000], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x008], RAX
+    mov RAX, 0x0201000706050403
+    mov [RSP + 0x010], RAX
+    mov RAX, 0x0A09080F0E0D0C0B
+    mov [RSP + 0x018], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x020], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x028], RAX
+    mov RAX, 0x0100070605040302
+    mov [RSP + 0x030], RAX
+    mov RAX, 0x09080F0E0D0C0B0A
+    mov [RSP + 0x038], RAX
+
+    vmovdqu ymm8, [RSP + 0x00]
+    vmovdqu ymm9, [RSP + 0x20]
+
+    vmovdqu ymm0, [RCX + 0x00]
+    vmovdqu ymm1, [RCX + 0x20]
+    vmovdqu ymm2, [R9 + 0x00]
+    vmovdqu ymm3, [R9 + 0x20]
+    vpxor ymm3, ymm3, [R8]
+
+    ; round 0
+    vmovq xmm4, [RDX + 0x00]
+    vpinsrq xmm4, xmm4, [RDX + 0x10], 1
+    vmovq xmm10, [RDX + 0x20]
+    vpinsrq xmm10, xmm10, [RDX + 0x30], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x08]
+    vpinsrq xmm5, xmm5, [RDX + 0x18], 1
+    vmovq xmm10, [RDX + 0x28]
+    vpinsrq xmm10, xmm10, [RDX + 0x38], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x40]
+    vpinsrq xmm6, xmm6, [RDX + 0x50], 1
+    vmovq xmm10, [RDX + 0x60]
+    vpinsrq xmm10, xmm10, [RDX + 0x70], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x48]
+    vpinsrq xmm7, xmm7, [RDX + 0x58], 1
+    vmovq xmm10, [RDX + 0x68]
+    vpinsrq xmm10, xmm10, [RDX + 0x78], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 1
+    vmovq xmm4, [RDX + 0x70]
+    vpinsrq xmm4, xmm4, [RDX + 0x20], 1
+    vmovq xmm10, [RDX + 0x48]
+    vpinsrq xmm10, xmm10, [RDX + 0x68], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x50]
+    vpinsrq xmm5, xmm5, [RDX + 0x40], 1
+    vmovq xmm10, [RDX + 0x78]
+    vpinsrq xmm10, xmm10, [RDX + 0x30], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x08]
+    vpinsrq xmm6, xmm6, [RDX + 0x00], 1
+    vmovq xmm10, [RDX + 0x58]
+    vpinsrq xmm10, xmm10, [RDX + 0x28], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x60]
+    vpinsrq xmm7, xmm7, [RDX + 0x10], 1
+    vmovq xmm10, [RDX + 0x38]
+    vpinsrq xmm10, xmm10, [RDX + 0x18], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 2
+    vmovq xmm4, [RDX + 0x58]
+    vpinsrq xmm4, xmm4, [RDX + 0x60], 1
+    vmovq xmm10, [RDX + 0x28]
+    vpinsrq xmm10, xmm10, [RDX + 0x78], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x40]
+    vpinsrq xmm5, xmm5, [RDX + 0x00], 1
+    vmovq xmm10, [RDX + 0x10]
+    vpinsrq xmm10, xmm10, [RDX + 0x68], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x50]
+    vpinsrq xmm6, xmm6, [RDX + 0x18], 1
+    vmovq xmm10, [RDX + 0x38]
+    vpinsrq xmm10, xmm10, [RDX + 0x48], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x70]
+    vpinsrq xmm7, xmm7, [RDX + 0x30], 1
+    vmovq xmm10, [RDX + 0x08]
+    vpinsrq xmm10, xmm10, [RDX + 0x20], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 3
+    vmovq xmm4, [RDX + 0x38]
+    vpinsrq xmm4, xmm4, [RDX + 0x18], 1
+    vmovq xmm10, [RDX + 0x68]
+    vpinsrq xmm10, xmm10, [RDX + 0x58], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x48]
+    vpinsrq xmm5, xmm5, [RDX + 0x08], 1
+    vmovq xmm10, [RDX + 0x60]
+    vpinsrq xmm10, xmm10, [RDX + 0x70], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x10]
+    vpinsrq xmm6, xmm6, [RDX + 0x28], 1
+    vmovq xmm10, [RDX + 0x20]
+    vpinsrq xmm10, xmm10, [RDX + 0x78], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x30]
+    vpinsrq xmm7, xmm7, [RDX + 0x50], 1
+    vmovq xmm10, [RDX + 0x00]
+    vpinsrq xmm10, xmm10, [RDX + 0x40], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 4
+    vmovq xmm4, [RDX + 0x48]
+    vpinsrq xmm4, xmm4, [RDX + 0x28], 1
+    vmovq xmm10, [RDX + 0x10]
+    vpinsrq xmm10, xmm10, [RDX + 0x50], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x00]
+    vpinsrq xmm5, xmm5, [RDX + 0x38], 1
+    vmovq xmm10, [RDX + 0x20]
+    vpinsrq xmm10, xmm10, [RDX + 0x78], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x70]
+    vpinsrq xmm6, xmm6, [RDX + 0x58], 1
+    vmovq xmm10, [RDX + 0x30]
+    vpinsrq xmm10, xmm10, [RDX + 0x18], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x08]
+    vpinsrq xmm7, xmm7, [RDX + 0x60], 1
+    vmovq xmm10, [RDX + 0x40]
+    vpinsrq xmm10, xmm10, [RDX + 0x68], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 5
+    vmovq xmm4, [RDX + 0x10]
+    vpinsrq xmm4, xmm4, [RDX + 0x30], 1
+    vmovq xmm10, [RDX + 0x00]
+    vpinsrq xmm10, xmm10, [RDX + 0x40], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x60]
+    vpinsrq xmm5, xmm5, [RDX + 0x50], 1
+    vmovq xmm10, [RDX + 0x58]
+    vpinsrq xmm10, xmm10, [RDX + 0x18], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x20]
+    vpinsrq xmm6, xmm6, [RDX + 0x38], 1
+    vmovq xmm10, [RDX + 0x78]
+    vpinsrq xmm10, xmm10, [RDX + 0x08], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x68]
+    vpinsrq xmm7, xmm7, [RDX + 0x28], 1
+    vmovq xmm10, [RDX + 0x70]
+    vpinsrq xmm10, xmm10, [RDX + 0x48], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 6
+    vmovq xmm4, [RDX + 0x60]
+    vpinsrq xmm4, xmm4, [RDX + 0x08], 1
+    vmovq xmm10, [RDX + 0x70]
+    vpinsrq xmm10, xmm10, [RDX + 0x20], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x28]
+    vpinsrq xmm5, xmm5, [RDX + 0x78], 1
+    vmovq xmm10, [RDX + 0x68]
+    vpinsrq xmm10, xmm10, [RDX + 0x50], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x00]
+    vpinsrq xmm6, xmm6, [RDX + 0x30], 1
+    vmovq xmm10, [RDX + 0x48]
+    vpinsrq xmm10, xmm10, [RDX + 0x40], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x38]
+    vpinsrq xmm7, xmm7, [RDX + 0x18], 1
+    vmovq xmm10, [RDX + 0x10]
+    vpinsrq xmm10, xmm10, [RDX + 0x58], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 7
+    vmovq xmm4, [RDX + 0x68]
+    vpinsrq xmm4, xmm4, [RDX + 0x38], 1
+    vmovq xmm10, [RDX + 0x60]
+    vpinsrq xmm10, xmm10, [RDX + 0x18], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x58]
+    vpinsrq xmm5, xmm5, [RDX + 0x70], 1
+    vmovq xmm10, [RDX + 0x08]
+    vpinsrq xmm10, xmm10, [RDX + 0x48], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x28]
+    vpinsrq xmm6, xmm6, [RDX + 0x78], 1
+    vmovq xmm10, [RDX + 0x40]
+    vpinsrq xmm10, xmm10, [RDX + 0x10], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x00]
+    vpinsrq xmm7, xmm7, [RDX + 0x20], 1
+    vmovq xmm10, [RDX + 0x30]
+    vpinsrq xmm10, xmm10, [RDX + 0x50], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 8
+    vmovq xmm4, [RDX + 0x30]
+    vpinsrq xmm4, xmm4, [RDX + 0x70], 1
+    vmovq xmm10, [RDX + 0x58]
+    vpinsrq xmm10, xmm10, [RDX + 0x00], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x78]
+    vpinsrq xmm5, xmm5, [RDX + 0x48], 1
+    vmovq xmm10, [RDX + 0x18]
+    vpinsrq xmm10, xmm10, [RDX + 0x40], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x60]
+    vpinsrq xmm6, xmm6, [RDX + 0x68], 1
+    vmovq xmm10, [RDX + 0x08]
+    vpinsrq xmm10, xmm10, [RDX + 0x50], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x10]
+    vpinsrq xmm7, xmm7, [RDX + 0x38], 1
+    vmovq xmm10, [RDX + 0x20]
+    vpinsrq xmm10, xmm10, [RDX + 0x28], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 9
+    vmovq xmm4, [RDX + 0x50]
+    vpinsrq xmm4, xmm4, [RDX + 0x40], 1
+    vmovq xmm10, [RDX + 0x38]
+    vpinsrq xmm10, xmm10, [RDX + 0x08], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x10]
+    vpinsrq xmm5, xmm5, [RDX + 0x20], 1
+    vmovq xmm10, [RDX + 0x30]
+    vpinsrq xmm10, xmm10, [RDX + 0x28], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x78]
+    vpinsrq xmm6, xmm6, [RDX + 0x48], 1
+    vmovq xmm10, [RDX + 0x18]
+    vpinsrq xmm10, xmm10, [RDX + 0x68], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x58]
+    vpinsrq xmm7, xmm7, [RDX + 0x70], 1
+    vmovq xmm10, [RDX + 0x60]
+    vpinsrq xmm10, xmm10, [RDX + 0x00], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 10
+    vmovq xmm4, [RDX + 0x00]
+    vpinsrq xmm4, xmm4, [RDX + 0x10], 1
+    vmovq xmm10, [RDX + 0x20]
+    vpinsrq xmm10, xmm10, [RDX + 0x30], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x08]
+    vpinsrq xmm5, xmm5, [RDX + 0x18], 1
+    vmovq xmm10, [RDX + 0x28]
+    vpinsrq xmm10, xmm10, [RDX + 0x38], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x40]
+    vpinsrq xmm6, xmm6, [RDX + 0x50], 1
+    vmovq xmm10, [RDX + 0x60]
+    vpinsrq xmm10, xmm10, [RDX + 0x70], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x48]
+    vpinsrq xmm7, xmm7, [RDX + 0x58], 1
+    vmovq xmm10, [RDX + 0x68]
+    vpinsrq xmm10, xmm10, [RDX + 0x78], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    ; round 11
+    vmovq xmm4, [RDX + 0x70]
+    vpinsrq xmm4, xmm4, [RDX + 0x20], 1
+    vmovq xmm10, [RDX + 0x48]
+    vpinsrq xmm10, xmm10, [RDX + 0x68], 1
+    vinserti128 ymm4, ymm4, xmm10, 1
+    vmovq xmm5, [RDX + 0x50]
+    vpinsrq xmm5, xmm5, [RDX + 0x40], 1
+    vmovq xmm10, [RDX + 0x78]
+    vpinsrq xmm10, xmm10, [RDX + 0x30], 1
+    vinserti128 ymm5, ymm5, xmm10, 1
+    vmovq xmm6, [RDX + 0x08]
+    vpinsrq xmm6, xmm6, [RDX + 0x00], 1
+    vmovq xmm10, [RDX + 0x58]
+    vpinsrq xmm10, xmm10, [RDX + 0x28], 1
+    vinserti128 ymm6, ymm6, xmm10, 1
+    vmovq xmm7, [RDX + 0x60]
+    vpinsrq xmm7, xmm7, [RDX + 0x10], 1
+    vmovq xmm10, [RDX + 0x38]
+    vpinsrq xmm10, xmm10, [RDX + 0x18], 1
+    vinserti128 ymm7, ymm7, xmm10, 1
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm4
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm5
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x39
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x93
+
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm6
+    vpxor ymm3, ymm3, ymm0
+    vpshufd ymm3, ymm3, 0xB1
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpshufb ymm1, ymm1, ymm8
+    vpaddq ymm0, ymm0, ymm1
+    vpaddq ymm0, ymm0, ymm7
+    vpxor ymm3, ymm3, ymm0
+    vpshufb ymm3, ymm3, ymm9
+    vpaddq ymm2, ymm2, ymm3
+    vpxor ymm1, ymm1, ymm2
+    vpsrlq ymm10, ymm1, 63
+    vpaddq ymm1, ymm1, ymm1
+    vpor ymm1, ymm1, ymm10
+
+    vpermq ymm1, ymm1, 0x93
+    vpermq ymm2, ymm2, 0x4E
+    vpermq ymm3, ymm3, 0x39
+
+    vpxor ymm0, ymm0, ymm2
+    vpxor ymm1, ymm1, ymm3
+    vpxor ymm0, ymm0, [RCX + 0x00]
+    vpxor ymm1, ymm1, [RCX + 0x20]
+    vmovdqu [RCX + 0x00], ymm0
+    vmovdqu [RCX + 0x20], ymm1
+
+    vmovdqu xmm6, [RSP + 0x40]
+    vmovdqu xmm7, [RSP + 0x50]
+    vmovdqu xmm8, [RSP + 0x60]
+    vmovdqu xmm9, [RSP + 0x70]
+    vmovdqu xmm10, [RSP + 0x80]
+    add RSP, 0x90
+
+    vzeroupper
+    ret
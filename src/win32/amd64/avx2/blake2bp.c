@@ -0,0 +1,234 @@
+/*===-- blake2bp.c ---------------------------*- win32/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2b.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2B_DIGEST  (bits(512))
+#define BLAKE2B_BLOCK   (bits(1024))
+#define BLAKE2B_KEY_MAX (bits(512))
+
+/* The input is striped over the leaves one block at a time, so that a stripe
+ * of four blocks gives one block to each leaf. */
+#define BLAKE2BP_LEAVES 4
+#define BLAKE2BP_STRIPE (BLAKE2BP_LEAVES * BLAKE2B_BLOCK)
+
+/* A stripe may only be compressed once every leaf is known to have more input
+ * after it, as each leaf's last block must be compressed with the final flag
+ * set, so up to this many bytes are held back. */
+#define BLAKE2BP_HOLD   (BLAKE2BP_STRIPE + (BLAKE2BP_LEAVES - 1) * BLAKE2B_BLOCK)
+
+ORDO_HIDDEN void blake2b_compress(uint64_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint64_t * RESTRICT tf);
+
+/* Compresses one stripe into all four leaves at once, as none of them can be
+ * on their last block. The state is stored word by word, with the four leaves
+ * next to one another, so that each leaf maps to one SIMD lane. */
+static void blake2bp_stripe(uint64_t h[8][BLAKE2BP_LEAVES],
+                            const void *stripe,
+                            uint64_t counter) HOT_CODE;
+
+/* Compresses one stripe with AVX2, with one leaf per lane, after transposing
+ * the stripe. The IV is passed in to keep the assembly free of data. */
+extern void blake2bp_stripe_ASM(uint64_t * RESTRICT h,
+                                const void * RESTRICT stripe,
+                                uint64_t counter,
+                                const uint64_t * RESTRICT iv);
+
+/* Returns the parameter block's first three words for a BLAKE2bp node. */
+static void blake2bp_param(uint64_t param[3],
+                           size_t key_len,
+                           uint64_t node_offset,
+                           uint64_t node_depth);
+
+static const uint64_t blake2b_iv[8] =
+{
+    UINT64_C(0x6a09e667f3bcc908), UINT64_C(0xbb67ae8584caa73b),
+    UINT64_C(0x3c6ef372fe94f82b), UINT64_C(0xa54ff53a5f1d36f1),
+    UINT64_C(0x510e527fade682d1), UINT64_C(0x9b05688c2b3e6c1f),
+    UINT64_C(0x1f83d9abfb41bd6b), UINT64_C(0x5be0cd19137e2179)
+};
+
+#ifdef OPAQUE
+struct BLAKE2BP_STATE
+{
+    uint64_t h[8][4];
+    uint64_t block[112];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t key_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2bp_init(struct BLAKE2BP_STATE *state,
+                  const struct BLAKE2B_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+    size_t t, l;
+
+    if (key_len > BLAKE2B_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    for (l = 0; l < BLAKE2BP_LEAVES; ++l)
+    {
+        uint64_t param[3];
+
+        blake2bp_param(param, key_len, l, 0);
+
+        for (t = 0; t < 8; ++t)
+            state->h[t][l] = blake2b_iv[t] ^ (t < 3 ? param[t] : 0);
+    }
+
+    state->block_len = 0;
+    state->leaf_len = 0;
+    state->key_len = key_len;
+
+    /* Each leaf hashes the key as its first block, which amounts to prefixing
+     * the input with one stripe holding a copy of the key block per leaf. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2BP_STRIPE);
+
+        for (l = 0; l < BLAKE2BP_LEAVES; ++l)
+            memcpy(offset(state->block, l * BLAKE2B_BLOCK),
+                   params->key, key_len);
+
+        state->block_len = BLAKE2BP_STRIPE;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2bp_update(struct BLAKE2BP_STATE *state,
+                     const void *buffer, size_t len)
+{
+    while (state->block_len + len > BLAKE2BP_HOLD)
+    {
+        if (!state->block_len)
+        {
+            state->leaf_len += BLAKE2B_BLOCK;
+            blake2bp_stripe(state->h, buffer, state->leaf_len);
+
+            buffer = offset(buffer, BLAKE2BP_STRIPE);
+            len -= BLAKE2BP_STRIPE;
+        }
+        else if (state->block_len < BLAKE2BP_STRIPE)
+        {
+            size_t pad = (size_t)(BLAKE2BP_STRIPE - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->leaf_len += BLAKE2B_BLOCK;
+            blake2bp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+        else
+        {
+            /* Only happens when a small update left more than one stripe's
+             * worth of data held back, so the copy is short and rare. */
+            state->leaf_len += BLAKE2B_BLOCK;
+            blake2bp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len -= BLAKE2BP_STRIPE;
+
+            memmove(state->block, offset(state->block, BLAKE2BP_STRIPE),
+                    (size_t)state->block_len);
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2bp_final(struct BLAKE2BP_STATE *state,
+                    void *digest)
+{
+    uint64_t root[8], leaves[BLAKE2BP_LEAVES][8];
+    uint64_t block[16], param[3], tf[4];
+    size_t t, l;
+
+    /* The held back data holds at most two blocks for each leaf, the second
+     * one (if any) being a stripe further than the first. */
+    for (l = 0; l < BLAKE2BP_LEAVES; ++l)
+    {
+        size_t pos = l * BLAKE2B_BLOCK;
+        size_t len = 0;
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = state->h[t][l];
+
+        tf[0] = state->leaf_len;
+        tf[1] = tf[2] = tf[3] = 0;
+
+        if (state->block_len > pos + BLAKE2BP_STRIPE)
+        {
+            tf[0] += BLAKE2B_BLOCK;
+            blake2b_compress(leaves[l], offset(state->block, pos), tf);
+            pos += BLAKE2BP_STRIPE;
+        }
+
+        if (state->block_len > pos)
+            len = smin((size_t)state->block_len - pos, BLAKE2B_BLOCK);
+
+        memset(block, 0, BLAKE2B_BLOCK);
+        memcpy(block, offset(state->block, pos), len);
+
+        /* The last leaf is also the last node of its level. */
+        tf[0] += len;
+        tf[2] = ~UINT64_C(0);
+        tf[3] = (l == BLAKE2BP_LEAVES - 1) ? ~UINT64_C(0) : 0;
+        blake2b_compress(leaves[l], block, tf);
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = tole64(leaves[l][t]);
+    }
+
+    /* The root node hashes the four leaf digests, which are two blocks. */
+    blake2bp_param(param, (size_t)state->key_len, 0, 1);
+
+    for (t = 0; t < 8; ++t)
+        root[t] = blake2b_iv[t] ^ (t < 3 ? param[t] : 0);
+
+    tf[0] = BLAKE2B_BLOCK;
+    tf[1] = tf[2] = tf[3] = 0;
+    blake2b_compress(root, leaves[0], tf);
+
+    tf[0] = 2 * BLAKE2B_BLOCK;
+    tf[2] = tf[3] = ~UINT64_C(0);
+    blake2b_compress(root, leaves[2], tf);
+
+    for (t = 0; t < 8; ++t)
+        root[t] = tole64(root[t]);
+
+    memcpy(digest, root, BLAKE2B_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void blake2bp_param(uint64_t param[3],
+                    size_t key_len,
+                    uint64_t node_offset,
+                    uint64_t node_depth)
+{
+    /* Digest length, key length, a fan-out of four and a depth of two. */
+    param[0] = UINT64_C(0x02040000) | ((uint64_t)key_len << 8)
+             | BLAKE2B_DIGEST;
+    param[1] = node_offset;
+    param[2] = node_depth | (BLAKE2B_DIGEST << 8);
+}
+
+void blake2bp_stripe(uint64_t h[8][BLAKE2BP_LEAVES],
+                     const void *stripe,
+                     uint64_t counter)
+{
+    /* This handles unaligned stripes just fine. */
+    blake2bp_stripe_ASM(&h[0][0], stripe, counter, blake2b_iv);
+}
@@ -0,0 +1,715 @@
+;/===-- blake2s.asm ------------------------*- win32/amd64/avx2 -*- ASM -*-===*/
+
+; BLAKE2s compression for AMD64 with AVX2 (Windows ABI)
+;
+; Each row of the working state is held in one XMM register, so that the
+; four G functions of a column or diagonal step run side by side, the
+; diagonal steps being done by rotating the rows. The message words for
+; each step are gathered with PINSRD, as they are not contiguous.
+;
+; This is the SSE4.1 code with VEX encodings, as AVX2 implies SSE4.1,
+; which avoids the register copies needed by two-operand instructions.
+;
+; XMM6-XMM10 are callee-saved on Windows, so they are spilled on entry.
+
+;/===----------------------------------------------------------------------===*/
+
+BITS 64
+
+global blake2s_compress_ASM
+
+section .text
+
+blake2s_compress_ASM:
+    sub RSP, 0x90
+    vmovdqu [RSP + 0x40], xmm6
+    vmovdqu [RSP + 0x50], xmm7
+    vmovdqu [RSP + 0x60], xmm8
+    vmovdqu [RSP + 0x70], xmm9
+    vmovdqu [RSP + 0x80], xmm10
+
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x000], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x008], RAX
+    mov RAX, 0x0504070601000302
+    mov [RSP + 0x010], RAX
+    mov RAX, 0x0D0C0F0E09080B0A
+    mov [RSP + 0x018], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x020], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x028], RAX
+    mov RAX, 0x0407060500030201
+    mov [RSP + 0x030], RAX
+    mov RAX, 0x0C0F0E0D080B0A09
+    mov [RSP + 0x038], RAX
+
+    vmovdqu xmm8, [RSP + 0x00]
+    vmovdqu xmm9, [RSP + 0x20]
+
+    vmovdqu xmm0, [RCX + 0x00]
+    vmovdqu xmm1, [RCX + 0x10]
+    vmovdqu xmm2, [R9 + 0x00]
+    vmovdqu xmm3, [R9 + 0x10]
+    vmovdqu xmm10, [R8]
+    vpxor xmm3, xmm3, xmm10
+
+    ; round 0
+    vmovd xmm4, [RDX + 0x00]
+    vpinsrd xmm4, xmm4, [RDX + 0x08], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x10], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x18], 3
+    vmovd xmm5, [RDX + 0x04]
+    vpinsrd xmm5, xmm5, [RDX + 0x0C], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x14], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x1C], 3
+    vmovd xmm6, [RDX + 0x20]
+    vpinsrd xmm6, xmm6, [RDX + 0x28], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x30], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x38], 3
+    vmovd xmm7, [RDX + 0x24]
+    vpinsrd xmm7, xmm7, [RDX + 0x2C], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x34], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x3C], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 1
+    vmovd xmm4, [RDX + 0x38]
+    vpinsrd xmm4, xmm4, [RDX + 0x10], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x24], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x34], 3
+    vmovd xmm5, [RDX + 0x28]
+    vpinsrd xmm5, xmm5, [RDX + 0x20], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x3C], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x18], 3
+    vmovd xmm6, [RDX + 0x04]
+    vpinsrd xmm6, xmm6, [RDX + 0x00], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x2C], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x14], 3
+    vmovd xmm7, [RDX + 0x30]
+    vpinsrd xmm7, xmm7, [RDX + 0x08], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x1C], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x0C], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 2
+    vmovd xmm4, [RDX + 0x2C]
+    vpinsrd xmm4, xmm4, [RDX + 0x30], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x14], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x3C], 3
+    vmovd xmm5, [RDX + 0x20]
+    vpinsrd xmm5, xmm5, [RDX + 0x00], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x08], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x34], 3
+    vmovd xmm6, [RDX + 0x28]
+    vpinsrd xmm6, xmm6, [RDX + 0x0C], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x1C], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x24], 3
+    vmovd xmm7, [RDX + 0x38]
+    vpinsrd xmm7, xmm7, [RDX + 0x18], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x04], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x10], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 3
+    vmovd xmm4, [RDX + 0x1C]
+    vpinsrd xmm4, xmm4, [RDX + 0x0C], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x34], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x2C], 3
+    vmovd xmm5, [RDX + 0x24]
+    vpinsrd xmm5, xmm5, [RDX + 0x04], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x30], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x38], 3
+    vmovd xmm6, [RDX + 0x08]
+    vpinsrd xmm6, xmm6, [RDX + 0x14], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x10], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x3C], 3
+    vmovd xmm7, [RDX + 0x18]
+    vpinsrd xmm7, xmm7, [RDX + 0x28], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x00], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x20], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 4
+    vmovd xmm4, [RDX + 0x24]
+    vpinsrd xmm4, xmm4, [RDX + 0x14], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x08], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x28], 3
+    vmovd xmm5, [RDX + 0x00]
+    vpinsrd xmm5, xmm5, [RDX + 0x1C], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x10], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x3C], 3
+    vmovd xmm6, [RDX + 0x38]
+    vpinsrd xmm6, xmm6, [RDX + 0x2C], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x18], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x0C], 3
+    vmovd xmm7, [RDX + 0x04]
+    vpinsrd xmm7, xmm7, [RDX + 0x30], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x20], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x34], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 5
+    vmovd xmm4, [RDX + 0x08]
+    vpinsrd xmm4, xmm4, [RDX + 0x18], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x00], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x20], 3
+    vmovd xmm5, [RDX + 0x30]
+    vpinsrd xmm5, xmm5, [RDX + 0x28], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x2C], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x0C], 3
+    vmovd xmm6, [RDX + 0x10]
+    vpinsrd xmm6, xmm6, [RDX + 0x1C], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x3C], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x04], 3
+    vmovd xmm7, [RDX + 0x34]
+    vpinsrd xmm7, xmm7, [RDX + 0x14], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x38], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x24], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 6
+    vmovd xmm4, [RDX + 0x30]
+    vpinsrd xmm4, xmm4, [RDX + 0x04], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x38], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x10], 3
+    vmovd xmm5, [RDX + 0x14]
+    vpinsrd xmm5, xmm5, [RDX + 0x3C], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x34], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x28], 3
+    vmovd xmm6, [RDX + 0x00]
+    vpinsrd xmm6, xmm6, [RDX + 0x18], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x24], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x20], 3
+    vmovd xmm7, [RDX + 0x1C]
+    vpinsrd xmm7, xmm7, [RDX + 0x0C], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x08], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x2C], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 7
+    vmovd xmm4, [RDX + 0x34]
+    vpinsrd xmm4, xmm4, [RDX + 0x1C], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x30], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x0C], 3
+    vmovd xmm5, [RDX + 0x2C]
+    vpinsrd xmm5, xmm5, [RDX + 0x38], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x04], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x24], 3
+    vmovd xmm6, [RDX + 0x14]
+    vpinsrd xmm6, xmm6, [RDX + 0x3C], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x20], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x08], 3
+    vmovd xmm7, [RDX + 0x00]
+    vpinsrd xmm7, xmm7, [RDX + 0x10], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x18], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x28], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 8
+    vmovd xmm4, [RDX + 0x18]
+    vpinsrd xmm4, xmm4, [RDX + 0x38], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x2C], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x00], 3
+    vmovd xmm5, [RDX + 0x3C]
+    vpinsrd xmm5, xmm5, [RDX + 0x24], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x0C], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x20], 3
+    vmovd xmm6, [RDX + 0x30]
+    vpinsrd xmm6, xmm6, [RDX + 0x34], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x04], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x28], 3
+    vmovd xmm7, [RDX + 0x08]
+    vpinsrd xmm7, xmm7, [RDX + 0x1C], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x10], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x14], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    ; round 9
+    vmovd xmm4, [RDX + 0x28]
+    vpinsrd xmm4, xmm4, [RDX + 0x20], 1
+    vpinsrd xmm4, xmm4, [RDX + 0x1C], 2
+    vpinsrd xmm4, xmm4, [RDX + 0x04], 3
+    vmovd xmm5, [RDX + 0x08]
+    vpinsrd xmm5, xmm5, [RDX + 0x10], 1
+    vpinsrd xmm5, xmm5, [RDX + 0x18], 2
+    vpinsrd xmm5, xmm5, [RDX + 0x14], 3
+    vmovd xmm6, [RDX + 0x3C]
+    vpinsrd xmm6, xmm6, [RDX + 0x24], 1
+    vpinsrd xmm6, xmm6, [RDX + 0x0C], 2
+    vpinsrd xmm6, xmm6, [RDX + 0x34], 3
+    vmovd xmm7, [RDX + 0x2C]
+    vpinsrd xmm7, xmm7, [RDX + 0x38], 1
+    vpinsrd xmm7, xmm7, [RDX + 0x30], 2
+    vpinsrd xmm7, xmm7, [RDX + 0x00], 3
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm4
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm5
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x39
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x93
+
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm6
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm8
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 12
+    vpslld xmm1, xmm1, 20
+    vpor xmm1, xmm1, xmm10
+    vpaddd xmm0, xmm0, xmm1
+    vpaddd xmm0, xmm0, xmm7
+    vpxor xmm3, xmm3, xmm0
+    vpshufb xmm3, xmm3, xmm9
+    vpaddd xmm2, xmm2, xmm3
+    vpxor xmm1, xmm1, xmm2
+    vpsrld xmm10, xmm1, 7
+    vpslld xmm1, xmm1, 25
+    vpor xmm1, xmm1, xmm10
+
+    vpshufd xmm1, xmm1, 0x93
+    vpshufd xmm2, xmm2, 0x4E
+    vpshufd xmm3, xmm3, 0x39
+
+    vmovdqu xmm4, [RCX + 0x00]
+    vmovdqu xmm5, [RCX + 0x10]
+    vpxor xmm0, xmm0, xmm2
+    vpxor xmm1, xmm1, xmm3
+    vpxor xmm0, xmm0, xmm4
+    vpxor xmm1, xmm1, xmm5
+    vmovdqu [RCX + 0x00], xmm0
+    vmovdqu [RCX + 0x10], xmm1
+
+    vmovdqu xmm6, [RSP + 0x40]
+    vmovdqu xmm7, [RSP + 0x50]
+    vmovdqu xmm8, [RSP + 0x60]
+    vmovdqu xmm9, [RSP + 0x70]
+    vmovdqu xmm10, [RSP + 0x80]
+    add RSP, 0x90
+
+    vzeroupper
+    ret
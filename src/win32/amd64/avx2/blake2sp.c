@@ -0,0 +1,243 @@
+/*===-- blake2sp.c ---------------------------*- win32/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include "ordo/primitives/hash_functions/blake2s.h"
+
+/*===----------------------------------------------------------------------===*/
+
+#define BLAKE2S_DIGEST  (bits(256))
+#define BLAKE2S_BLOCK   (bits(512))
+#define BLAKE2S_KEY_MAX (bits(256))
+
+/* The input is striped over the leaves one block at a time, so that a stripe
+ * of eight blocks gives one block to each leaf. */
+#define BLAKE2SP_LEAVES 8
+#define BLAKE2SP_STRIPE (BLAKE2SP_LEAVES * BLAKE2S_BLOCK)
+
+/* A stripe may only be compressed once every leaf is known to have more input
+ * after it, as each leaf's last block must be compressed with the final flag
+ * set, so up to this many bytes are held back. */
+#define BLAKE2SP_HOLD   (BLAKE2SP_STRIPE + (BLAKE2SP_LEAVES - 1) * BLAKE2S_BLOCK)
+
+ORDO_HIDDEN void blake2s_compress(uint32_t * RESTRICT h,
+                                  const void * RESTRICT block,
+                                  const uint32_t * RESTRICT tf);
+
+/* Compresses one stripe into all eight leaves at once, as none of them can be
+ * on their last block. The state is stored word by word, with the eight leaves
+ * next to one another, so that each leaf maps to one SIMD lane. */
+static void blake2sp_stripe(uint32_t h[8][BLAKE2SP_LEAVES],
+                            const void *stripe,
+                            uint64_t counter) HOT_CODE;
+
+/* Compresses one stripe with AVX2, with one leaf per lane, after transposing
+ * the stripe. The IV is passed in to keep the assembly free of data. */
+extern void blake2sp_stripe_ASM(uint32_t * RESTRICT h,
+                                const void * RESTRICT stripe,
+                                uint64_t counter,
+                                const uint32_t * RESTRICT iv);
+
+/* Returns the parameter block's first four words for a BLAKE2sp node. */
+static void blake2sp_param(uint32_t param[4],
+                           size_t key_len,
+                           uint32_t node_offset,
+                           uint32_t node_depth);
+
+static const uint32_t blake2s_iv[8] =
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#ifdef OPAQUE
+struct BLAKE2SP_STATE
+{
+    uint32_t h[8][8];
+    uint32_t block[240];
+    uint64_t block_len;
+    uint64_t leaf_len;
+    uint64_t key_len;
+};
+#endif
+
+/*===----------------------------------------------------------------------===*/
+
+int blake2sp_init(struct BLAKE2SP_STATE *state,
+                  const struct BLAKE2S_PARAMS *params)
+{
+    size_t key_len = params ? params->key_len : 0;
+    size_t t, l;
+
+    if (key_len > BLAKE2S_KEY_MAX)
+        return ORDO_KEY_LEN;
+
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+    {
+        uint32_t param[4];
+
+        blake2sp_param(param, key_len, l, 0);
+
+        for (t = 0; t < 8; ++t)
+            state->h[t][l] = blake2s_iv[t] ^ (t < 4 ? param[t] : 0);
+    }
+
+    state->block_len = 0;
+    state->leaf_len = 0;
+    state->key_len = key_len;
+
+    /* Each leaf hashes the key as its first block, which amounts to prefixing
+     * the input with one stripe holding a copy of the key block per leaf. */
+    if (key_len)
+    {
+        memset(state->block, 0, BLAKE2SP_STRIPE);
+
+        for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+            memcpy(offset(state->block, l * BLAKE2S_BLOCK),
+                   params->key, key_len);
+
+        state->block_len = BLAKE2SP_STRIPE;
+    }
+
+    return ORDO_SUCCESS;
+}
+
+void blake2sp_update(struct BLAKE2SP_STATE *state,
+                     const void *buffer, size_t len)
+{
+    while (state->block_len + len > BLAKE2SP_HOLD)
+    {
+        if (!state->block_len)
+        {
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, buffer, state->leaf_len);
+
+            buffer = offset(buffer, BLAKE2SP_STRIPE);
+            len -= BLAKE2SP_STRIPE;
+        }
+        else if (state->block_len < BLAKE2SP_STRIPE)
+        {
+            size_t pad = (size_t)(BLAKE2SP_STRIPE - state->block_len);
+
+            memcpy(offset(state->block, state->block_len), buffer, pad);
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len = 0;
+
+            buffer = offset(buffer, pad);
+            len -= pad;
+        }
+        else
+        {
+            /* Only happens when a small update left more than one stripe's
+             * worth of data held back, so the copy is short and rare. */
+            state->leaf_len += BLAKE2S_BLOCK;
+            blake2sp_stripe(state->h, state->block, state->leaf_len);
+            state->block_len -= BLAKE2SP_STRIPE;
+
+            memmove(state->block, offset(state->block, BLAKE2SP_STRIPE),
+                    (size_t)state->block_len);
+        }
+    }
+
+    memcpy(offset(state->block, state->block_len), buffer, len);
+    state->block_len += len;
+}
+
+void blake2sp_final(struct BLAKE2SP_STATE *state,
+                    void *digest)
+{
+    uint32_t root[8], leaves[BLAKE2SP_LEAVES][8];
+    uint32_t block[16], param[4], tf[4];
+    uint64_t counter;
+    size_t t, l;
+
+    /* The held back data holds at most two blocks for each leaf, the second
+     * one (if any) being a stripe further than the first. */
+    for (l = 0; l < BLAKE2SP_LEAVES; ++l)
+    {
+        size_t pos = l * BLAKE2S_BLOCK;
+        size_t len = 0;
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = state->h[t][l];
+
+        counter = state->leaf_len;
+        tf[0] = (uint32_t)counter;
+        tf[1] = (uint32_t)(counter >> 32);
+        tf[2] = tf[3] = 0;
+
+        if (state->block_len > pos + BLAKE2SP_STRIPE)
+        {
+            counter += BLAKE2S_BLOCK;
+            tf[0] = (uint32_t)counter;
+            tf[1] = (uint32_t)(counter >> 32);
+            blake2s_compress(leaves[l], offset(state->block, pos), tf);
+            pos += BLAKE2SP_STRIPE;
+        }
+
+        if (state->block_len > pos)
+            len = smin((size_t)state->block_len - pos, BLAKE2S_BLOCK);
+
+        memset(block, 0, BLAKE2S_BLOCK);
+        memcpy(block, offset(state->block, pos), len);
+
+        /* The last leaf is also the last node of its level. */
+        counter += len;
+        tf[0] = (uint32_t)counter;
+        tf[1] = (uint32_t)(counter >> 32);
+        tf[2] = ~(uint32_t)0;
+        tf[3] = (l == BLAKE2SP_LEAVES - 1) ? ~(uint32_t)0 : 0;
+        blake2s_compress(leaves[l], block, tf);
+
+        for (t = 0; t < 8; ++t)
+            leaves[l][t] = tole32(leaves[l][t]);
+    }
+
+    /* The root node hashes the eight leaf digests, which are four blocks. */
+    blake2sp_param(param, (size_t)state->key_len, 0, 1);
+
+    for (t = 0; t < 8; ++t)
+        root[t] = blake2s_iv[t] ^ (t < 4 ? param[t] : 0);
+
+    tf[1] = tf[2] = tf[3] = 0;
+
+    for (l = 0; l < BLAKE2SP_LEAVES; l += 2)
+    {
+        tf[0] = (uint32_t)((l / 2 + 1) * BLAKE2S_BLOCK);
+
+        if (l == BLAKE2SP_LEAVES - 2)
+            tf[2] = tf[3] = ~(uint32_t)0;
+
+        blake2s_compress(root, leaves[l], tf);
+    }
+
+    for (t = 0; t < 8; ++t)
+        root[t] = tole32(root[t]);
+
+    memcpy(digest, root, BLAKE2S_DIGEST);
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void blake2sp_param(uint32_t param[4],
+                    size_t key_len,
+                    uint32_t node_offset,
+                    uint32_t node_depth)
+{
+    /* Digest length, key length, a fan-out of eight and a depth of two. */
+    param[0] = 0x02080000 | (uint32_t)(key_len << 8) | BLAKE2S_DIGEST;
+    param[1] = 0;
+    param[2] = node_offset;
+    param[3] = (node_depth << 16) | ((uint32_t)BLAKE2S_DIGEST << 24);
+}
+
+void blake2sp_stripe(uint32_t h[8][BLAKE2SP_LEAVES],
+                     const void *stripe,
+                     uint64_t counter)
+{
+    /* This handles unaligned stripes just fine. */
+    blake2sp_stripe_ASM(&h[0][0], stripe, counter, blake2s_iv);
+}
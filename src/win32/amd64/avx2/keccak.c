@@ -0,0 +1,188 @@
+/*===-- keccak.c -----------------------------*- win32/amd64/avx2 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* Applies the Keccak-f[1600] permutation to a state of 25 native lanes, the
+ * lane at (x, y) being at index x + 5y. */
+ORDO_HIDDEN void keccak_f1600(uint64_t state[25]) HOT_CODE;
+
+/* Applies the Keccak-f[1600] permutation to four independent states at once,
+ * interleaved lane by lane, so that lane i of state j is at index 4i + j. */
+ORDO_HIDDEN void keccak_f1600_x4(uint64_t state[100]) HOT_CODE;
+
+/* Permutes four interleaved states with AVX2, with one state per lane. The
+ * round constants are passed in to keep the assembly free of data. */
+extern void keccak_f1600_x4_ASM(uint64_t *state, const uint64_t *rc);
+
+static const uint64_t keccak_rc[24] =
+{
+    UINT64_C(0x0000000000000001), UINT64_C(0x0000000000008082),
+    UINT64_C(0x800000000000808a), UINT64_C(0x8000000080008000),
+    UINT64_C(0x000000000000808b), UINT64_C(0x0000000080000001),
+    UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008009),
+    UINT64_C(0x000000000000008a), UINT64_C(0x0000000000000088),
+    UINT64_C(0x0000000080008009), UINT64_C(0x000000008000000a),
+    UINT64_C(0x000000008000808b), UINT64_C(0x800000000000008b),
+    UINT64_C(0x8000000000008089), UINT64_C(0x8000000000008003),
+    UINT64_C(0x8000000000008002), UINT64_C(0x8000000000000080),
+    UINT64_C(0x000000000000800a), UINT64_C(0x800000008000000a),
+    UINT64_C(0x8000000080008081), UINT64_C(0x8000000000008080),
+    UINT64_C(0x0000000080000001), UINT64_C(0x8000000080008008)
+};
+
+/*===----------------------------------------------------------------------===*/
+
+/* This is the lane complementing implementation from the Keccak team, where
+ * six lanes are kept inverted during the permutation, so that the chi step
+ * can be computed with only eight NOTs per round instead of twenty-five (the
+ * inversions are undone on exit, so the state passed in is a plain one). The
+ * theta, rho and pi steps are merged, and the state is held in 25 variables
+ * which are swapped with 25 others every round, so that a good compiler will
+ * keep as much of it in registers as possible. */
+
+#define ROUND(A, E, rc)                                                      \
+    do {                                                                     \
+        c0 = A##0 ^ A##5 ^ A##10 ^ A##15 ^ A##20;                            \
+        c1 = A##1 ^ A##6 ^ A##11 ^ A##16 ^ A##21;                            \
+        c2 = A##2 ^ A##7 ^ A##12 ^ A##17 ^ A##22;                            \
+        c3 = A##3 ^ A##8 ^ A##13 ^ A##18 ^ A##23;                            \
+        c4 = A##4 ^ A##9 ^ A##14 ^ A##19 ^ A##24;                            \
+                                                                             \
+        d0 = c4 ^ rol64(c1, 1);                                              \
+        d1 = c0 ^ rol64(c2, 1);                                              \
+        d2 = c1 ^ rol64(c3, 1);                                              \
+        d3 = c2 ^ rol64(c4, 1);                                              \
+        d4 = c3 ^ rol64(c0, 1);                                              \
+                                                                             \
+        b0 = A##0 ^ d0;                                                      \
+        b1 = rol64(A##6 ^ d1, 44);                                           \
+        b2 = rol64(A##12 ^ d2, 43);                                          \
+        b3 = rol64(A##18 ^ d3, 21);                                          \
+        b4 = rol64(A##24 ^ d4, 14);                                          \
+        E##0 = b0 ^ (b1 | b2) ^ rc;                                          \
+        E##1 = b1 ^ (~b2 | b3);                                              \
+        E##2 = b2 ^ (b3 & b4);                                               \
+        E##3 = b3 ^ (b4 | b0);                                               \
+        E##4 = b4 ^ (b0 & b1);                                               \
+                                                                             \
+        b0 = rol64(A##3 ^ d3, 28);                                           \
+        b1 = rol64(A##9 ^ d4, 20);                                           \
+        b2 = rol64(A##10 ^ d0, 3);                                           \
+        b3 = rol64(A##16 ^ d1, 45);                                          \
+        b4 = rol64(A##22 ^ d2, 61);                                          \
+        E##5 = b0 ^ (b1 | b2);                                               \
+        E##6 = b1 ^ (b2 & b3);                                               \
+        E##7 = b2 ^ (b3 | ~b4);                                              \
+        E##8 = b3 ^ (b4 | b0);                                               \
+        E##9 = b4 ^ (b0 & b1);                                               \
+                                                                             \
+        b0 = rol64(A##1 ^ d1, 1);                                            \
+        b1 = rol64(A##7 ^ d2, 6);                                            \
+        b2 = rol64(A##13 ^ d3, 25);                                          \
+        b3 = rol64(A##19 ^ d4, 8);                                           \
+        b4 = rol64(A##20 ^ d0, 18);                                          \
+        E##10 = b0 ^ (b1 | b2);                                              \
+        E##11 = b1 ^ (b2 & b3);                                              \
+        E##12 = b2 ^ (~b3 & b4);                                             \
+        E##13 = ~b3 ^ (b4 | b0);                                             \
+        E##14 = b4 ^ (b0 & b1);                                              \
+                                                                             \
+        b0 = rol64(A##4 ^ d4, 27);                                           \
+        b1 = rol64(A##5 ^ d0, 36);                                           \
+        b2 = rol64(A##11 ^ d1, 10);                                          \
+        b3 = rol64(A##17 ^ d2, 15);                                          \
+        b4 = rol64(A##23 ^ d3, 56);                                          \
+        E##15 = b0 ^ (b1 & b2);                                              \
+        E##16 = b1 ^ (b2 | b3);                                              \
+        E##17 = b2 ^ (~b3 | b4);                                             \
+        E##18 = ~b3 ^ (b4 & b0);                                             \
+        E##19 = b4 ^ (b0 | b1);                                              \
+                                                                             \
+        b0 = rol64(A##2 ^ d2, 62);                                           \
+        b1 = rol64(A##8 ^ d3, 55);                                           \
+        b2 = rol64(A##14 ^ d4, 39);                                          \
+        b3 = rol64(A##15 ^ d0, 41);                                          \
+        b4 = rol64(A##21 ^ d1, 2);                                           \
+        E##20 = b0 ^ (~b1 & b2);                                             \
+        E##21 = ~b1 ^ (b2 | b3);                                             \
+        E##22 = b2 ^ (b3 & b4);                                              \
+        E##23 = b3 ^ (b4 | b0);                                              \
+        E##24 = b4 ^ (b0 & b1);                                              \
+    } while (0)
+
+void keccak_f1600(uint64_t state[25])
+{
+    uint64_t a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
+             a15, a16, a17, a18, a19, a20, a21, a22, a23, a24;
+    uint64_t e0, e1, e2, e3, e4, e5, e6, e7, e8, e9, e10, e11, e12, e13, e14,
+             e15, e16, e17, e18, e19, e20, e21, e22, e23, e24;
+    uint64_t b0, b1, b2, b3, b4, c0, c1, c2, c3, c4, d0, d1, d2, d3, d4;
+    size_t t;
+
+    a0 = state[0];
+    a1 = ~state[1];
+    a2 = ~state[2];
+    a3 = state[3];
+    a4 = state[4];
+    a5 = state[5];
+    a6 = state[6];
+    a7 = state[7];
+    a8 = ~state[8];
+    a9 = state[9];
+    a10 = state[10];
+    a11 = state[11];
+    a12 = ~state[12];
+    a13 = state[13];
+    a14 = state[14];
+    a15 = state[15];
+    a16 = state[16];
+    a17 = ~state[17];
+    a18 = state[18];
+    a19 = state[19];
+    a20 = ~state[20];
+    a21 = state[21];
+    a22 = state[22];
+    a23 = state[23];
+    a24 = state[24];
+
+    for (t = 0; t < 24; t += 2)
+    {
+        ROUND(a, e, keccak_rc[t + 0]);
+        ROUND(e, a, keccak_rc[t + 1]);
+    }
+
+    state[0] = a0;
+    state[1] = ~a1;
+    state[2] = ~a2;
+    state[3] = a3;
+    state[4] = a4;
+    state[5] = a5;
+    state[6] = a6;
+    state[7] = a7;
+    state[8] = ~a8;
+    state[9] = a9;
+    state[10] = a10;
+    state[11] = a11;
+    state[12] = ~a12;
+    state[13] = a13;
+    state[14] = a14;
+    state[15] = a15;
+    state[16] = a16;
+    state[17] = ~a17;
+    state[18] = a18;
+    state[19] = a19;
+    state[20] = ~a20;
+    state[21] = a21;
+    state[22] = a22;
+    state[23] = a23;
+    state[24] = a24;
+}
+
+void keccak_f1600_x4(uint64_t state[100])
+{
+    keccak_f1600_x4_ASM(state, keccak_rc);
+}
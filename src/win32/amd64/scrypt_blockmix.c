@@ -0,0 +1,32 @@
+/*===-- scrypt_blockmix.c -------------------------*- win32/amd64 -*- C -*-===*/
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+/*===----------------------------------------------------------------------===*/
+
+/* See the generic scrypt_blockmix.c. */
+ORDO_HIDDEN void scrypt_blockmix(const uint32_t * RESTRICT in,
+                                 const uint32_t * RESTRICT with,
+                                 uint32_t * RESTRICT out,
+                                 size_t r)
+HOT_CODE;
+
+/* Runs the whole BlockMix with SSE2, which all AMD64 processors have. There
+ * is no AVX2 version, as the Salsa20/8 calls in a BlockMix are chained and so
+ * cannot use more than the four lanes of an XMM register. */
+extern void scrypt_blockmix_ASM(const uint32_t * RESTRICT in,
+                                const uint32_t * RESTRICT with,
+                                uint32_t * RESTRICT out,
+                                size_t r);
+
+/*===----------------------------------------------------------------------===*/
+
+void scrypt_blockmix(const uint32_t * RESTRICT in,
+                     const uint32_t * RESTRICT with,
+                     uint32_t * RESTRICT out,
+                     size_t r)
+{
+    scrypt_blockmix_ASM(in, with, out, r);
+}
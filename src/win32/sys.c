@@ -0,0 +1,178 @@
+/*===-- sys.c -------------------------------------------*- win32 -*- C -*-===*/
+
+/* Needed for slim reader/writer locks and condition variables, which first
+ * appeared in Windows Vista. */
+#if !defined(_WIN32_WINNT) || (_WIN32_WINNT < 0x0600)
+#undef _WIN32_WINNT
+#define _WIN32_WINNT 0x0600
+#endif
+
+/** @cond **/
+#include "ordo/internal/implementation.h"
+/** @endcond **/
+
+#include <windows.h>
+
+/*===----------------------------------------------------------------------===*/
+
+#define MAX_THREADS 64
+
+/* The workers are started the first time they are needed and then kept for
+ * the life of the process, waiting on "wake" for a batch to be posted. The
+ * batch is split into "stride" shares, the calling thread running share 0
+ * and each of the others being claimed by whichever worker gets to it first
+ * ("next" being the next unclaimed share), "pending" counting the claimed or
+ * unclaimed shares which have not completed yet. Only one batch is run at a
+ * time, and a batch posted while another one runs is run by its caller. */
+struct POOL
+{
+    SRWLOCK lock;
+    CONDITION_VARIABLE wake, done;
+    size_t workers;
+    int busy;
+
+    SYS_JOB job;
+    void *ctx;
+    size_t count, stride;
+    size_t next, pending;
+};
+
+static struct POOL pool =
+{
+    SRWLOCK_INIT,
+    CONDITION_VARIABLE_INIT,
+    CONDITION_VARIABLE_INIT,
+    0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static void run_share(SYS_JOB job, void *ctx,
+                      size_t first, size_t count, size_t stride)
+{
+    size_t t;
+
+    for (t = first; t < count; t += stride)
+        job(ctx, t);
+}
+
+static DWORD WINAPI worker_main(LPVOID arg)
+{
+    (void)arg;
+
+    AcquireSRWLockExclusive(&pool.lock);
+
+    while (1)
+    {
+        SYS_JOB job;
+        void *ctx;
+        size_t first, count, stride;
+
+        while (pool.next == pool.stride)
+            SleepConditionVariableSRW(&pool.wake, &pool.lock, INFINITE, 0);
+
+        job = pool.job;
+        ctx = pool.ctx;
+        count = pool.count;
+        stride = pool.stride;
+        first = pool.next++;
+
+        ReleaseSRWLockExclusive(&pool.lock);
+        run_share(job, ctx, first, count, stride);
+        AcquireSRWLockExclusive(&pool.lock);
+
+        if (!--pool.pending)
+            WakeConditionVariable(&pool.done);
+    }
+
+    return 0;
+}
+
+/* Starts workers until there are "want" of them, if possible. This is done
+ * with the lock held. */
+static void pool_grow(size_t want)
+{
+    while (pool.workers < want)
+    {
+        HANDLE thread = CreateThread(0, 0, worker_main, 0, 0, 0);
+
+        if (!thread) return;
+
+        CloseHandle(thread);
+        ++pool.workers;
+    }
+}
+
+static size_t cpu_count(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+
+    return (info.dwNumberOfProcessors < 1)
+         ? 1 : (size_t)info.dwNumberOfProcessors;
+}
+
+/*===----------------------------------------------------------------------===*/
+
+void sys_parallel(size_t count, SYS_JOB job, void *ctx)
+{
+    size_t threads = smin(smin(cpu_count(), count), MAX_THREADS);
+
+    if (threads > 1)
+    {
+        AcquireSRWLockExclusive(&pool.lock);
+
+        /* If another batch is running, possibly the one whose job is making
+         * this call, this one is run here instead of waiting for it. */
+        if (pool.busy)
+            threads = 1;
+        else
+        {
+            pool_grow(threads - 1);
+            threads = smin(threads, pool.workers + 1);
+        }
+
+        if (threads > 1)
+        {
+            pool.busy = 1;
+            pool.job = job;
+            pool.ctx = ctx;
+            pool.count = count;
+            pool.stride = threads;
+            pool.next = 1;
+            pool.pending = threads - 1;
+
+            WakeAllConditionVariable(&pool.wake);
+            ReleaseSRWLockExclusive(&pool.lock);
+
+            run_share(job, ctx, 0, count, threads);
+
+            AcquireSRWLockExclusive(&pool.lock);
+
+            while (pool.pending)
+                SleepConditionVariableSRW(&pool.done, &pool.lock, INFINITE, 0);
+
+            pool.busy = 0;
+        }
+
+        ReleaseSRWLockExclusive(&pool.lock);
+    }
+
+    if (threads <= 1)
+        run_share(job, ctx, 0, count, 1);
+}
+
+size_t sys_threads(void)
+{
+    return smin(cpu_count(), MAX_THREADS);
+}
+
+/* Large pages need a privilege that processes rarely hold, so this sticks
+ * to normal pages. */
+void *sys_alloc(size_t len)
+{
+    return VirtualAlloc(0, len, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+void sys_free(void *ptr, size_t len)
+{
+    if (ptr) VirtualFree(ptr, 0, MEM_RELEASE);
+}